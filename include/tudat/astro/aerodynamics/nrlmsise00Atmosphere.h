@@ -25,6 +25,7 @@
 #include "tudat/astro/aerodynamics/nrlmsise00InputFunctions.h"
 #include "tudat/math/basic/mathematicalConstants.h"
 #include "tudat/io/solarActivityData.h"
+#include "tudat/io/solarActivityTable.h"
 
 extern "C"
 {
@@ -145,23 +146,56 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         useIdealGasLaw_ = useIdealGasLaw;
     }
 
-    NRLMSISE00Atmosphere( const tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData,
-                          const bool useIdealGasLaw = true )
+    //! Constructor from table of solar activity data.
+    /*!
+     * Constructor from table of solar activity data, from which the NRLMSISE00 model input is retrieved with a constant-time
+     * daily lookup (see nrlmsiseInputFunctionFromTable).
+     * \param solarActivityTable Table of daily solar activity data.
+     * \param useIdealGasLaw Variable denoting whether to use the ideal gas law for computation of pressure.
+     */
+    NRLMSISE00Atmosphere( const std::shared_ptr< tudat::input_output::solar_activity::SolarActivityTable > solarActivityTable,
+                          const bool useIdealGasLaw = true ):
+        NRLMSISE00Atmosphere( solarActivityTable, 1.4, GasComponentProperties( ), useIdealGasLaw )
+    { }
+
+    //! Constructor from table of solar activity data, setting the gas component properties and specific heat ratio.
+    /*!
+     * Constructor from table of solar activity data, setting the gas component properties and specific heat ratio.
+     * \param solarActivityTable Table of daily solar activity data.
+     * \param specificHeatRatio value of the specific heat ratio.
+     * \param gasProperties a GasComponentProperties data structure that contains
+     *  the molecule collision diameters and the molar mass.
+     * \param useIdealGasLaw Boolean denoting whether the ideal gas law is to be used.
+     */
+    NRLMSISE00Atmosphere( const std::shared_ptr< tudat::input_output::solar_activity::SolarActivityTable > solarActivityTable,
+                          const double specificHeatRatio,
+                          const GasComponentProperties gasProperties,
+                          const bool useIdealGasLaw = true ):
+        solarActivityTable_( solarActivityTable )
     {
-        nrlmsise00InputFunction_ = std::bind( &tudat::aerodynamics::nrlmsiseInputFunction,
+        nrlmsise00InputFunction_ = std::bind( &tudat::aerodynamics::nrlmsiseInputFunctionFromTable,
                    std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
-                   solarActivityData, false, TUDAT_NAN );
-        solarActivityContainer_ = std::make_shared< input_output::solar_activity::SolarActivityContainer >(
-                    solarActivityData );
+                   solarActivityTable, false, TUDAT_NAN );
 
         resetHashKey( );
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
-        specificHeatRatio_ = 1.4;
-        GasComponentProperties gasProperties;
-        gasComponentProperties_ = gasProperties; // Default gas properties
+        specificHeatRatio_ = specificHeatRatio;
+        gasComponentProperties_ = gasProperties;
         useIdealGasLaw_ = useIdealGasLaw;
     }
 
+    //! Constructor from map of solar activity data.
+    /*!
+     * Constructor from map of solar activity data, which is converted to a SolarActivityTable for constant-time lookup.
+     * \param solarActivityData Map of solar activity data, as produced by readSolarActivityData.
+     * \param useIdealGasLaw Variable denoting whether to use the ideal gas law for computation of pressure.
+     */
+    NRLMSISE00Atmosphere( const tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData,
+                          const bool useIdealGasLaw = true ):
+        NRLMSISE00Atmosphere( std::make_shared< input_output::solar_activity::SolarActivityTable >( solarActivityData ),
+                              useIdealGasLaw )
+    { }
+
     //! Constructor
     /*!
      * Constructor that sets the gas component properties and specific heat ratio.
@@ -174,20 +208,10 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     NRLMSISE00Atmosphere(const tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData,
                          const double specificHeatRatio,
                          const GasComponentProperties gasProperties,
-                         const bool useIdealGasLaw = true)
-    {
-        nrlmsise00InputFunction_ = std::bind( &tudat::aerodynamics::nrlmsiseInputFunction,
-                   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4,
-                   solarActivityData, false, TUDAT_NAN );
-        solarActivityContainer_ = std::make_shared< input_output::solar_activity::SolarActivityContainer >(
-                    solarActivityData );
-
-        resetHashKey( );
-        molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
-        specificHeatRatio_ = specificHeatRatio;
-        gasComponentProperties_ = gasProperties;
-        useIdealGasLaw_ = useIdealGasLaw;
-    }
+                         const bool useIdealGasLaw = true):
+        NRLMSISE00Atmosphere( std::make_shared< input_output::solar_activity::SolarActivityTable >( solarActivityData ),
+                              specificHeatRatio, gasProperties, useIdealGasLaw )
+    { }
 
     //! Set gas component properties.
     /*!
@@ -380,9 +404,20 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
 
     std::shared_ptr< input_output::solar_activity::SolarActivityContainer > getSolarActivityContainer( )
     {
+        if( solarActivityContainer_ == nullptr && solarActivityTable_ != nullptr )
+        {
+            solarActivityContainer_ = std::make_shared< input_output::solar_activity::SolarActivityContainer >(
+                        solarActivityTable_->getSolarActivityDataMap( ) );
+        }
         return solarActivityContainer_;
     }
 
+    //! Function to retrieve the table of solar activity data (nullptr if model is created from input function).
+    std::shared_ptr< input_output::solar_activity::SolarActivityTable > getSolarActivityTable( )
+    {
+        return solarActivityTable_;
+    }
+
     //! Function to get  Input data to NRLMSISE00 atmosphere model
     /*!
      *  Function to get input data to NRLMSISE00 atmosphere model
@@ -555,6 +590,10 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     //! Input data to NRLMSISE00 atmosphere model
     NRLMSISE00Input inputData_;
 
+    //! Table of solar activity data (nullptr if model is created from input function).
+    std::shared_ptr< input_output::solar_activity::SolarActivityTable > solarActivityTable_;
+
+    //! Container of solar activity data, created from solarActivityTable_ when first requested.
     std::shared_ptr< input_output::solar_activity::SolarActivityContainer > solarActivityContainer_;
 };
 
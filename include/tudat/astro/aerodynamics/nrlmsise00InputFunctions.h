@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "tudat/io/solarActivityData.h"
+#include "tudat/io/solarActivityTable.h"
 
 
 namespace tudat
@@ -109,6 +110,27 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
                                        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
                                        const bool adjustSolarTime = false, const double localSolarTime = 0.0 );
 
+//! NRLMSISE00 Input function, using columnar solar activity table
+/*!
+ * This function is used to define the input for the NRLMSISE model, retrieving the solar activity data of the current day
+ * from a columnar table in constant time (see SolarActivityTable). Days without an entry in the space weather file use the
+ * data of the most recent preceding entry.
+ * \param altitude Altitude at which output is to be computed [m].
+ * \param longitude Longitude at which output is to be computed [rad].
+ * \param latitude Latitude at which output is to be computed [rad].
+ * \param time Time at which output is to be computed (seconds since J2000).
+ * \param solarActivityTable Table of daily solar activity data
+ * \param adjustSolarTime Boolean denoting whether the computed local solar time should be overidden with localSolarTime
+ * input.
+ * \param localSolarTime Local solar time that is used when adjustSolarTime is set to true.
+ * \return NRLMSISE00Input nrlmsiseInputFunctionFromTable
+ */
+NRLMSISE00Input nrlmsiseInputFunctionFromTable(
+        const double altitude, const double longitude,
+        const double latitude, const double time,
+        const std::shared_ptr< tudat::input_output::solar_activity::SolarActivityTable > solarActivityTable,
+        const bool adjustSolarTime = false, const double localSolarTime = 0.0 );
+
 }  // namespace aerodynamics
 }  // namespace tudat
 
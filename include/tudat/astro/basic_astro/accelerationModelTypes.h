@@ -23,6 +23,7 @@
 #include "tudat/astro/propulsion/thrustAccelerationModel.h"
 #include "tudat/astro/propulsion/massRateFromThrust.h"
 #include "tudat/astro/relativity/relativisticAccelerationCorrection.h"
+#include "tudat/astro/relativity/einsteinInfeldHoffmannAcceleration.h"
 #include "tudat/astro/basic_astro/empiricalAcceleration.h"
 #include "tudat/astro/propulsion/massRateFromThrust.h"
 #include "tudat/astro/electromagnetism/radiationPressureAcceleration.h"
@@ -51,11 +52,13 @@ enum AvailableAcceleration
     mutual_spherical_harmonic_gravity,
     polyhedron_gravity,
     ring_gravity,
+    mascon_gravity,
     third_body_point_mass_gravity,
     third_body_spherical_harmonic_gravity,
     third_body_mutual_spherical_harmonic_gravity,
     third_body_polyhedron_gravity,
     third_body_ring_gravity,
+    third_body_mascon_gravity,
     thrust_acceleration,
     relativistic_correction_acceleration,
     empirical_acceleration,
@@ -64,7 +67,8 @@ enum AvailableAcceleration
     radiation_pressure,
     momentum_wheel_desaturation_acceleration,
     custom_acceleration,
-    yarkovsky_acceleration
+    yarkovsky_acceleration,
+    einstein_infeld_hoffmann_acceleration
 };
 
 // Function to get a string representing a 'named identification' of an acceleration type
@@ -0,0 +1,71 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Battin, R.H. An Introduction to the Mathematics and Methods of Astrodynamics, AIAA Education Series, 1999.
+ *      Conway, B.A. An improved algorithm due to Laguerre for the solution of Kepler's equation.
+ *          Celestial Mechanics 39, 199–211, 1986.
+ *      Shepperd, S.W. Universal Keplerian state transition matrix. Celestial Mechanics 35, 129–144, 1985.
+ *
+ */
+
+#ifndef TUDAT_UNIVERSAL_VARIABLE_KEPLER_PROPAGATOR_H
+#define TUDAT_UNIVERSAL_VARIABLE_KEPLER_PROPAGATOR_H
+
+#include <Eigen/Core>
+
+#include "tudat/basics/basicTypedefs.h"
+
+namespace tudat
+{
+
+namespace orbital_element_conversions
+{
+
+//! Compute universal functions U_0 to U_5 of the universal anomaly.
+/*!
+ * Computes the universal functions U_k( chi; alpha ) = chi^k c_k( alpha chi^2 ), with c_k the Stumpff functions
+ * (Battin, 1999). For small arguments of the Stumpff functions, a series expansion is used to avoid cancellation.
+ * \param universalAnomaly Universal anomaly chi                                                        [m^1/2]
+ * \param reciprocalSemiMajorAxis Reciprocal of semi-major axis alpha (negative for hyperbolic orbits)  [m^-1]
+ * \return Values of U_0 to U_5 (in that order)
+ */
+Eigen::Vector6d computeUniversalFunctions(
+        const double universalAnomaly,
+        const double reciprocalSemiMajorAxis );
+
+//! Propagate Cartesian state along a Kepler orbit using universal variables.
+/*!
+ * Propagates a Cartesian state along a Kepler orbit, using the Lagrange coefficients expressed in universal
+ * functions (Battin, 1999). The universal Kepler equation is solved using the Laguerre-Conway method (Conway, 1986).
+ * As opposed to propagateKeplerOrbit, no conversion to and from Keplerian elements is required, and elliptic,
+ * parabolic and hyperbolic orbits are handled uniformly. Optionally, the state transition matrix
+ * d( final state )/d( initial state ) is computed as a by-product of the Lagrange coefficients.
+ * \param initialCartesianState Initial Cartesian state                                                 [m, m/s]
+ * \param propagationTime Propagation time (may be negative)                                            [s]
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body                     [m^3 s^-2]
+ * \param stateTransitionMatrix State transition matrix from initial to final state (returned by reference, only
+ *          computed if pointer is not null)
+ * \param convergenceTolerance Relative tolerance on universal anomaly for solution of Kepler equation
+ * \param maximumNumberOfIterations Maximum number of iterations for solution of Kepler equation
+ * \return Final Cartesian state                                                                         [m, m/s]
+ */
+Eigen::Vector6d propagateCartesianStateWithUniversalVariables(
+        const Eigen::Vector6d& initialCartesianState,
+        const double propagationTime,
+        const double centralBodyGravitationalParameter,
+        Eigen::Matrix6d* stateTransitionMatrix = nullptr,
+        const double convergenceTolerance = 1.0E-14,
+        const int maximumNumberOfIterations = 100 );
+
+} // namespace orbital_element_conversions
+
+} // namespace tudat
+
+#endif // TUDAT_UNIVERSAL_VARIABLE_KEPLER_PROPAGATOR_H
@@ -385,6 +385,88 @@ private:
     std::vector<RadiationSourcePanel> panels_;
 };
 
+/*!
+ * Class holding the geometry of a spherical cap paneled with equal projected, attenuated area (Knocke, 1988) in a
+ * pole-aligned frame, and rotating it to the sub-target direction. This produces the same panels as
+ * generatePaneledSphericalCap_EqualProjectedAttenuatedArea, but avoids recomputing the geometry on every call:
+ *  - the azimuthal directions of all ring panels only depend on the ring configuration and are computed once
+ *  - the ring boundaries and panel areas only depend on the target distance and body radius and are only recomputed
+ *    when either changes
+ *  - panel centers are stored in structure-of-arrays form and rotated with a single matrix product
+ */
+class SphericalCapPanelingTemplate
+{
+public:
+    /*!
+     * Constructor.
+     *
+     * @param numberOfPanelsPerRing Number of panels for each ring, excluding the central cap
+     */
+    explicit SphericalCapPanelingTemplate(const std::vector<int>& numberOfPanelsPerRing);
+
+    /*!
+     * Generate panels for the spherical cap of the source body that is visible from the target.
+     *
+     * @param targetPosition Position of the target in local frame
+     * @param bodyRadius Radius of the body
+     */
+    void generatePanels(const Eigen::Vector3d& targetPosition, double bodyRadius);
+
+    //! Cartesian panel centers (one per column) from the last call to generatePanels
+    const Eigen::Matrix3Xd& getPanelCenters() const
+    {
+        return panelCenters_;
+    }
+
+    //! Polar angles (between 0 and π) of panel centers from the last call to generatePanels
+    const std::vector<double>& getPolarAngles() const
+    {
+        return polarAngles_;
+    }
+
+    //! Azimuth angles (between 0 and 2π) of panel centers from the last call to generatePanels
+    const std::vector<double>& getAzimuthAngles() const
+    {
+        return azimuthAngles_;
+    }
+
+    //! Panel areas from the last call to generatePanels
+    const std::vector<double>& getAreas() const
+    {
+        return areas_;
+    }
+
+    unsigned int getNumberOfPanels() const
+    {
+        return numberOfPanels_;
+    }
+
+private:
+    void updatePoleAlignedTemplate(double targetDistance, double bodyRadius);
+
+    const std::vector<int> numberOfPanelsPerRing_;
+
+    unsigned int numberOfPanels_;
+
+    // Cosine and sine of azimuth angle of each panel in pole-aligned frame (first column is central cap)
+    Eigen::Matrix2Xd poleAlignedAzimuthDirections_;
+
+    // Panel centers in pole-aligned frame, valid for templateTargetDistance_ and templateBodyRadius_
+    Eigen::Matrix3Xd poleAlignedPanelCenters_;
+
+    double templateTargetDistance_{TUDAT_NAN};
+
+    double templateBodyRadius_{TUDAT_NAN};
+
+    Eigen::Matrix3Xd panelCenters_;
+
+    std::vector<double> polarAngles_;
+
+    std::vector<double> azimuthAngles_;
+
+    std::vector<double> areas_;
+};
+
 /*!
  * Class modeling a paneled source with paneling created dynamically based on the spacecraft position. Panel
  * properties such as albedo and emissivity are evaluated anew with every panel generation.
@@ -428,12 +510,16 @@ private:
 
     const std::vector<int> numberOfPanelsPerRing_;
 
+    SphericalCapPanelingTemplate panelingTemplate_;
+
     std::vector<RadiationSourcePanel> panels_;
 };
 
 class SourcePanelRadiosityModelUpdater
 {
 public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
     /*!
      * Constructor.
      *
@@ -501,6 +587,11 @@ private:
     std::map<std::string, Eigen::Vector3d> originalSourceToSourceCenterDirections_; // in source frame
     std::map<std::string, double> originalSourceUnoccultedIrradiances_;
 
+    // Source and original source states at current time, retrieved once per time instead of once per panel
+    Eigen::Vector3d sourceCenterPositionInGlobalFrame_;
+    Eigen::Quaterniond sourceRotationFromLocalToGlobalFrame_;
+    std::map<std::string, Eigen::Vector3d> originalSourceCenterPositionsInGlobalFrame_;
+
     double currentTime_{TUDAT_NAN};
 };
 
@@ -15,6 +15,8 @@
 #ifndef TUDAT_SURFACEPROPERTYDISTRIBUTION_H
 #define TUDAT_SURFACEPROPERTYDISTRIBUTION_H
 
+#include <memory>
+
 #include <Eigen/Core>
 
 #include "tudat/math/basic/mathematicalConstants.h"
@@ -219,6 +221,48 @@ private:
     const double angularFrequency;
 };
 
+/*!
+ * Class modeling the distribution of a property on the surface of a sphere, such as albedo or emissivity, by bilinear
+ * interpolation in a regular latitude/longitude grid. The grid is sampled once from another, time-invariant,
+ * distribution at construction. This avoids repeated costly evaluations of, e.g., spherical harmonics distributions,
+ * which is especially relevant for dynamically paneled sources, where panels move with every evaluation.
+ */
+class GriddedSurfacePropertyDistribution : public SurfacePropertyDistribution
+{
+public:
+    /*!
+     * Constructor.
+     *
+     * @param originalDistribution Time-invariant distribution from which grid is sampled
+     * @param numberOfLatitudes Number of grid points in latitude direction (including both poles)
+     * @param numberOfLongitudes Number of grid points in longitude direction
+     */
+    explicit GriddedSurfacePropertyDistribution(
+            const std::shared_ptr<SurfacePropertyDistribution>& originalDistribution,
+            const unsigned int numberOfLatitudes,
+            const unsigned int numberOfLongitudes);
+
+    double getValue(double latitude, double longitude) override;
+
+    bool isTimeInvariant() override
+    {
+        return true;
+    }
+
+    //! Grid values, with rows corresponding to latitudes (from south to north pole) and columns to longitudes
+    const Eigen::MatrixXd& getGridValues() const
+    {
+        return gridValues_;
+    }
+
+private:
+    Eigen::MatrixXd gridValues_;
+
+    double latitudeStep_;
+
+    double longitudeStep_;
+};
+
 class CustomSurfacePropertyDistribution : public SurfacePropertyDistribution
 {
 public:
@@ -0,0 +1,348 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *      Barnes, J. and Hut, P., A hierarchical O(N log N) force-calculation algorithm, Nature, 324, 446-449, 1986.
+ *      Park, R.S., Werner, R.A. and Bhaskaran, S., Estimating small-body gravity field from shape model and navigation
+ *          data, Journal of Guidance, Control, and Dynamics, 33(1), 212-221, 2010.
+ */
+
+#ifndef TUDAT_MASCONGRAVITYFIELD_H
+#define TUDAT_MASCONGRAVITYFIELD_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/gravitation/gravityFieldModel.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Node of the octree used to aggregate distant groups of mascons in the MasconGravityField.
+/*!
+ *  Node of the octree used to aggregate distant groups of mascons in the MasconGravityField. The mascons of each node are
+ *  stored contiguously in the (reordered) mascon arrays of the field, and the children of each node are stored
+ *  contiguously in the node list. The multipole moments are expressed per unit gravitational parameter of the field, and
+ *  w.r.t. the expansion center of the node, which is the center of mass of the node if all its mass fractions are
+ *  positive, and the geometric center of its mascons otherwise (as may occur for fitted mass fractions).
+ */
+struct MasconOctreeNode
+{
+    //! Index of first mascon in node.
+    int firstMascon_;
+
+    //! Number of mascons in node.
+    int numberOfMascons_;
+
+    //! Index of first child node (-1 for leaf nodes).
+    int firstChild_;
+
+    //! Number of child nodes.
+    int numberOfChildren_;
+
+    //! Sum of mass fractions of mascons in node.
+    double massFraction_;
+
+    //! Radius of the sphere, centered at expansionCenter_, containing all mascons of the node.
+    double radius_;
+
+    //! Center w.r.t. which the multipole moments of the node are defined.
+    Eigen::Vector3d expansionCenter_;
+
+    //! Dipole moment of mascons in node w.r.t. expansionCenter_: sum f_i d_i (zero if expanded about center of mass).
+    Eigen::Vector3d dipoleMoment_;
+
+    //! Traceless quadrupole tensor of mascons in node w.r.t. expansionCenter_: sum f_i ( 3 d_i d_i^T - d_i^2 I ).
+    Eigen::Matrix3d quadrupoleTensor_;
+};
+
+//! Class to represent the gravity field of a set of point masses (mascons).
+/*!
+ *  Class to represent the gravity field of a set of point masses (mascons), each of which has a fixed position in the
+ *  body-fixed frame and a fixed fraction of the total gravitational parameter of the body. The mascon properties are
+ *  stored as a structure-of-arrays, which is evaluated in blocks of fixed maximum size, such that the direct summation is
+ *  vectorized. The mascons are sorted into an octree, which is used to replace the contribution of groups of mascons that
+ *  are sufficiently far from the field point by their monopole and quadrupole terms. A group is aggregated if its radius
+ *  is smaller than the opening angle times its distance to the field point, so that the relative truncation error of a
+ *  group contribution is of the order of the cube of the opening angle. For an opening angle of zero, the direct sum over
+ *  all mascons is used.
+ */
+class MasconGravityField: public GravityFieldModel
+{
+public:
+
+    /*! Constructor.
+     *
+     * Constructor.
+     * @param gravitationalParameter Gravitational parameter of the body.
+     * @param masconPositions Body-fixed positions of the mascons (one row per mascon, 3 columns).
+     * @param masconMassFractions Fraction of the gravitational parameter of the body represented by each mascon. If empty,
+     *      the mass is distributed equally over the mascons.
+     * @param openingAngle Opening angle used to decide whether a group of mascons is aggregated into its multipole terms.
+     *      (default 0, no aggregation).
+     * @param maximumMasconsPerLeaf Maximum number of mascons in a leaf node of the octree.
+     * @param fixedReferenceFrame Identifier for body-fixed reference frame to which the field is fixed (optional).
+     * @param updateInertiaTensor Function that is to be called to update the inertia tensor (typically in Body class;
+     *      default empty)
+     */
+    MasconGravityField(
+            const double gravitationalParameter,
+            const Eigen::MatrixXd& masconPositions,
+            const Eigen::VectorXd& masconMassFractions = Eigen::VectorXd::Zero( 0 ),
+            const double openingAngle = 0.0,
+            const int maximumMasconsPerLeaf = 32,
+            const std::string& fixedReferenceFrame = "",
+            const std::function< void( ) > updateInertiaTensor = std::function< void( ) > ( ) );
+
+    /*! Function to calculate the gravitational potential.
+     *
+     * Function to calculate the gravitational potential.
+     * @param bodyFixedPosition Position of point at which potential is to be calculated, in body-fixed frame.
+     * @return Gravitational potential.
+     */
+    double getGravitationalPotential( const Eigen::Vector3d& bodyFixedPosition ) override
+    {
+        double potential = 0.0;
+        computeGravityFieldTerms( bodyFixedPosition, gravitationalParameter_, &potential, nullptr, nullptr );
+        return potential;
+    }
+
+    /*! Function to calculate the gradient of the gravitational potential (i.e. the acceleration).
+     *
+     * Function to calculate the gradient of the gravitational potential (i.e. the acceleration).
+     * @param bodyFixedPosition Position of point at which gradient is to be calculated, in body-fixed frame.
+     * @return Gradient of the gravitational potential.
+     */
+    Eigen::Vector3d getGradientOfPotential( const Eigen::Vector3d& bodyFixedPosition ) override
+    {
+        Eigen::Vector3d gradient;
+        computeGravityFieldTerms( bodyFixedPosition, gravitationalParameter_, nullptr, &gradient, nullptr );
+        return gradient;
+    }
+
+    /*! Function to calculate the hessian of the gravitational potential.
+     *
+     * Function to calculate the hessian of the gravitational potential.
+     * @param bodyFixedPosition Position of point at which hessian is to be calculated, in body-fixed frame.
+     * @return Hessian of the gravitational potential.
+     */
+    Eigen::Matrix3d getHessianOfPotential( const Eigen::Vector3d& bodyFixedPosition )
+    {
+        Eigen::Matrix3d hessian;
+        computeGravityFieldTerms( bodyFixedPosition, gravitationalParameter_, nullptr, nullptr, &hessian );
+        return hessian;
+    }
+
+    /*! Function to calculate the laplacian of the gravitational potential.
+     *
+     * Function to calculate the laplacian of the gravitational potential, which is zero outside the mascons.
+     * @param bodyFixedPosition Position of point at which laplacian is to be calculated, in body-fixed frame.
+     * @return Laplacian of the gravitational potential.
+     */
+    double getLaplacianOfPotential( const Eigen::Vector3d& bodyFixedPosition ) override
+    {
+        return getHessianOfPotential( bodyFixedPosition ).trace( );
+    }
+
+    /*! Function to compute the potential, its gradient and its hessian in a single pass over the mascons.
+     *
+     * Function to compute the potential, its gradient and its hessian in a single pass over the mascons (and octree, if
+     * used). Each of the outputs is only computed if the associated pointer is not a nullptr.
+     * @param bodyFixedPosition Position of point at which the terms are to be calculated, in body-fixed frame.
+     * @param gravitationalParameter Gravitational parameter by which the mass fractions are to be scaled (typically that of
+     *      the field, or the sum of the gravitational parameters of the two bodies for mutual attraction).
+     * @param potential Gravitational potential (returned by reference, if not nullptr).
+     * @param gradient Gradient of the gravitational potential (returned by reference, if not nullptr).
+     * @param hessian Hessian of the gravitational potential (returned by reference, if not nullptr).
+     */
+    void computeGravityFieldTerms(
+            const Eigen::Vector3d& bodyFixedPosition,
+            const double gravitationalParameter,
+            double* potential,
+            Eigen::Vector3d* gradient,
+            Eigen::Matrix3d* hessian ) const;
+
+    //! Function to retrieve the center of mass of the mascon distribution.
+    Eigen::Vector3d getCenterOfMass( ) override
+    {
+        return centerOfMass_;
+    }
+
+    //! Function to retrieve the inertia tensor of the mascon distribution, w.r.t. the origin of the body-fixed frame.
+    Eigen::Matrix3d getInertiaTensor( ) override;
+
+    //! Function to retrieve the number of mascons.
+    int getNumberOfMascons( )
+    {
+        return static_cast< int >( masconOrder_.size( ) );
+    }
+
+    //! Function to retrieve the mascon positions, in the order in which they were provided to the constructor.
+    Eigen::MatrixXd getMasconPositions( );
+
+    //! Function to retrieve the mascon mass fractions, in the order in which they were provided to the constructor.
+    Eigen::VectorXd getMasconMassFractions( );
+
+    //! Function to retrieve the opening angle used for aggregating groups of mascons.
+    double getOpeningAngle( )
+    {
+        return openingAngle_;
+    }
+
+    //! Function to reset the opening angle used for aggregating groups of mascons.
+    void resetOpeningAngle( const double openingAngle )
+    {
+        openingAngle_ = openingAngle;
+    }
+
+    //! Function to retrieve the nodes of the octree (the first node is the root).
+    const std::vector< MasconOctreeNode >& getOctreeNodes( )
+    {
+        return octreeNodes_;
+    }
+
+    //! Function to retrieve the identifier for the body-fixed reference frame.
+    std::string getFixedReferenceFrame( )
+    {
+        return fixedReferenceFrame_;
+    }
+
+protected:
+
+    //! Function to recursively create the octree node with given index, and its children.
+    void createOctreeNode( const int nodeIndex );
+
+    //! Function to compute the multipole moments of an octree node.
+    void computeOctreeNodeMoments( MasconOctreeNode& node );
+
+    //! Function to add the contribution of a contiguous range of mascons, summed directly, to the requested terms.
+    void addDirectContribution(
+            const Eigen::Vector3d& bodyFixedPosition,
+            const int firstMascon,
+            const int numberOfMascons,
+            double* potential,
+            Eigen::Vector3d* gradient,
+            Eigen::Matrix3d* hessian ) const;
+
+    //! Function to recursively add the contribution of an octree node to the requested terms.
+    void addOctreeNodeContribution(
+            const Eigen::Vector3d& bodyFixedPosition,
+            const MasconOctreeNode& node,
+            double* potential,
+            Eigen::Vector3d* gradient,
+            Eigen::Matrix3d* hessian ) const;
+
+    //! Function to add the multipole (up to quadrupole) contribution of an octree node to the requested terms.
+    void addMultipoleContribution(
+            const Eigen::Vector3d& bodyFixedPosition,
+            const MasconOctreeNode& node,
+            double* potential,
+            Eigen::Vector3d* gradient,
+            Eigen::Matrix3d* hessian ) const;
+
+    //! Body-fixed x-coordinates of mascons, sorted in octree order.
+    Eigen::VectorXd masconPositionsX_;
+
+    //! Body-fixed y-coordinates of mascons, sorted in octree order.
+    Eigen::VectorXd masconPositionsY_;
+
+    //! Body-fixed z-coordinates of mascons, sorted in octree order.
+    Eigen::VectorXd masconPositionsZ_;
+
+    //! Mass fractions of mascons, sorted in octree order.
+    Eigen::VectorXd masconMassFractions_;
+
+    //! Index (in the input order) of each mascon in octree order.
+    std::vector< int > masconOrder_;
+
+    //! Nodes of the octree, with the root node first.
+    std::vector< MasconOctreeNode > octreeNodes_;
+
+    //! Center of mass of the mascon distribution.
+    Eigen::Vector3d centerOfMass_;
+
+    //! Opening angle used for aggregating groups of mascons.
+    double openingAngle_;
+
+    //! Maximum number of mascons in a leaf node of the octree.
+    int maximumMasconsPerLeaf_;
+
+    //! Identifier for body-fixed reference frame.
+    std::string fixedReferenceFrame_;
+
+};
+
+//! Function to create mascons on a regular grid inside a polyhedron.
+/*!
+ *  Function to create mascons at the centers of the cells of a regular cubic grid that lie inside a polyhedron, which
+ *  represents a homogeneous body. The grid is aligned with the axes of the body-fixed frame, and covers the bounding box
+ *  of the polyhedron. A cell center is considered to be inside the polyhedron if the sum of the solid angles subtended by
+ *  the facets is 4 pi. The mascon mass fractions of the resulting distribution are equal.
+ *  \param verticesCoordinates Cartesian coordinates of each vertex (one row per vertex, 3 columns).
+ *  \param verticesDefiningEachFacet Index (0 based) of the vertices constituting each facet (one row per facet, 3 columns).
+ *  \param numberOfCellsAlongLargestDimension Number of grid cells along the largest dimension of the bounding box.
+ *  \param shiftToPolyhedronCentroid Boolean denoting whether the mascons are to be translated such that their center of
+ *      mass coincides with the centroid of the polyhedron.
+ *  \return Positions of the mascons (one row per mascon, 3 columns).
+ */
+Eigen::MatrixXd createMasconPositionsFromPolyhedron(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const int numberOfCellsAlongLargestDimension,
+        const bool shiftToPolyhedronCentroid = true );
+
+//! Function to compute the mascon mass fractions that reproduce a given spherical harmonic gravity field.
+/*!
+ *  Function to compute the mascon mass fractions for which the spherical harmonic coefficients of the mascon distribution
+ *  reproduce the given (geodesy-normalized) coefficients, up to the maximum degree and order of the coefficient
+ *  matrices. The mass fractions are computed as the solution of the (typically underdetermined) linear system that is
+ *  closest to an equal distribution of the mass over the mascons, in a least-squares sense. The C_00 coefficient is
+ *  used to constrain the sum of the mass fractions, and should normally be equal to 1.
+ *  \param masconPositions Body-fixed positions of the mascons (one row per mascon, 3 columns).
+ *  \param cosineCoefficients Cosine spherical harmonic coefficients (geodesy-normalized).
+ *  \param sineCoefficients Sine spherical harmonic coefficients (geodesy-normalized).
+ *  \param referenceRadius Reference radius of the spherical harmonic coefficients.
+ *  \return Mass fractions of the mascons.
+ */
+Eigen::VectorXd fitMasconMassFractionsToSphericalHarmonics(
+        const Eigen::MatrixXd& masconPositions,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        const double referenceRadius );
+
+//! Function to compute the (geodesy-normalized) spherical harmonic coefficients of a mascon distribution.
+/*!
+ *  Function to compute the (geodesy-normalized) spherical harmonic coefficients of a mascon distribution.
+ *  \param masconPositions Body-fixed positions of the mascons (one row per mascon, 3 columns).
+ *  \param masconMassFractions Mass fractions of the mascons.
+ *  \param referenceRadius Reference radius of the spherical harmonic coefficients.
+ *  \param maximumDegree Maximum degree (and order) of the coefficients.
+ *  \param cosineCoefficients Cosine spherical harmonic coefficients (returned by reference).
+ *  \param sineCoefficients Sine spherical harmonic coefficients (returned by reference).
+ */
+void computeMasconSphericalHarmonicCoefficients(
+        const Eigen::MatrixXd& masconPositions,
+        const Eigen::VectorXd& masconMassFractions,
+        const double referenceRadius,
+        const int maximumDegree,
+        Eigen::MatrixXd& cosineCoefficients,
+        Eigen::MatrixXd& sineCoefficients );
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_MASCONGRAVITYFIELD_H
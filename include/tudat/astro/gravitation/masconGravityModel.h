@@ -0,0 +1,232 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_MASCONGRAVITYMODEL_H
+#define TUDAT_MASCONGRAVITYMODEL_H
+
+#include <memory>
+#include <functional>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "tudat/astro/basic_astro/accelerationModel.h"
+#include "tudat/astro/gravitation/masconGravityField.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Class for calculating the gravitational acceleration due to a set of mascons.
+/*!
+ *  Class for calculating the gravitational acceleration due to a set of mascons, defined by a MasconGravityField. The
+ *  hessian of the potential (used for the partials of the acceleration w.r.t. position) is only computed when requested
+ *  through resetUpdateHessian, in which case it is obtained in the same pass over the mascons as the acceleration.
+ */
+class MasconGravitationalAccelerationModel: public basic_astrodynamics::AccelerationModel< Eigen::Vector3d >
+{
+protected:
+
+    //! Typedef for a position-returning function.
+    typedef std::function< void( Eigen::Vector3d& ) > StateFunction;
+
+public:
+
+    //! Constructor taking position-functions for bodies, and mascon gravity field.
+    /*!
+     * Constructor taking position-functions for bodies, and mascon gravity field.
+     * \param positionOfBodySubjectToAccelerationFunction Pointer to function returning position of
+     *          body subject to gravitational acceleration.
+     * \param gravitationalParameterFunction Pointer to function returning the gravitational parameter by which the mascon
+     *          mass fractions are scaled.
+     * \param masconGravityField Mascon gravity field of the body exerting the acceleration.
+     * \param positionOfBodyExertingAccelerationFunction Pointer to function returning position of
+     *          body exerting gravitational acceleration (default = (0,0,0)).
+     * \param rotationFromBodyFixedToIntegrationFrameFunction Function providing the rotation from
+     * body-fixes from to the frame in which the numerical integration is performed.
+     * \param isMutualAttractionUsed Variable denoting whether attraction from body undergoing acceleration on
+     * body exerting acceleration is included (i.e. whether gravitationalParameterFunction refers to the property
+     * of the body exerting the acceleration, if variable is false, or the sum of the gravitational parameters,
+     * if the variable is true.
+     * \param updateGravitationalPotential Flag indicating whether to update the gravitational potential when calling
+     * the updateMembers function.
+     */
+    MasconGravitationalAccelerationModel(
+            const StateFunction positionOfBodySubjectToAccelerationFunction,
+            const std::function< double( ) > gravitationalParameterFunction,
+            const std::shared_ptr< MasconGravityField > masconGravityField,
+            const StateFunction positionOfBodyExertingAccelerationFunction =
+                    [ ]( Eigen::Vector3d& input ){ input = Eigen::Vector3d::Zero( ); },
+            const std::function< Eigen::Quaterniond( ) > rotationFromBodyFixedToIntegrationFrameFunction =
+                    [ ]( ){ return Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ); },
+            const bool isMutualAttractionUsed = 0,
+            const bool updateGravitationalPotential = false ):
+        subjectPositionFunction_( positionOfBodySubjectToAccelerationFunction ),
+        gravitationalParameterFunction_( gravitationalParameterFunction ),
+        masconGravityField_( masconGravityField ),
+        sourcePositionFunction_( positionOfBodyExertingAccelerationFunction ),
+        rotationFromBodyFixedToIntegrationFrameFunction_( rotationFromBodyFixedToIntegrationFrameFunction ),
+        isMutualAttractionUsed_( isMutualAttractionUsed ),
+        currentPotential_( TUDAT_NAN ),
+        currentBodyFixedHessian_( Eigen::Matrix3d::Constant( TUDAT_NAN ) ),
+        updatePotential_( updateGravitationalPotential ),
+        updateHessian_( false )
+    { }
+
+    //! Update class members.
+    /*!
+     * Updates all the base class members to their current values and also updates the class members of this class.
+     * The potential and hessian of the potential are only updated if the associated flags indicate so.
+     * \param currentTime Time at which acceleration model is to be updated.
+     */
+    void updateMembers( const double currentTime = TUDAT_NAN );
+
+    //! Function to return current position vector from body exerting acceleration to body undergoing acceleration, in frame
+    //! fixed to body exerting acceleration
+    Eigen::Vector3d getCurrentRelativePosition( )
+    {
+        return currentRelativePosition_;
+    }
+
+    //! Function to return current position vector from body exerting acceleration to body undergoing acceleration, in inertial
+    //! frame
+    Eigen::Vector3d getCurrentInertialRelativePosition( )
+    {
+        return currentInertialRelativePosition_;
+    }
+
+    //! Function to retrieve the current rotation from body-fixed frame to integration frame, in the form of a quaternion.
+    Eigen::Quaterniond getCurrentRotationToIntegrationFrame( )
+    {
+        return rotationToIntegrationFrame_;
+    }
+
+    //! Function to retrieve the current rotation from body-fixed frame to integration frame, as a rotation matrix.
+    Eigen::Matrix3d getCurrentRotationToIntegrationFrameMatrix( )
+    {
+        return rotationToIntegrationFrame_.toRotationMatrix( );
+    }
+
+    //! Function to return the function returning the relevant gravitational parameter.
+    std::function< double( ) > getGravitationalParameterFunction( )
+    {
+        return gravitationalParameterFunction_;
+    }
+
+    //! Function to return the mascon gravity field.
+    std::shared_ptr< MasconGravityField > getMasconGravityField( )
+    {
+        return masconGravityField_;
+    }
+
+    //! Function to return current position vector of body undergoing gravitational acceleration in inertial frame.
+    Eigen::Vector3d getCurrentPositionOfBodySubjectToAcceleration( )
+    {
+        return positionOfBodySubjectToAcceleration_;
+    }
+
+    //! Function to return current position vector of body exerting gravitational acceleration in inertial frame.
+    Eigen::Vector3d getCurrentPositionOfBodyExertingAcceleration( )
+    {
+        return positionOfBodyExertingAcceleration_;
+    }
+
+    //! Function to return the function returning position of body exerting acceleration.
+    StateFunction getStateFunctionOfBodyExertingAcceleration( )
+    { return sourcePositionFunction_; }
+
+    //! Function to return the function returning position of body subject to acceleration.
+    StateFunction getStateFunctionOfBodyUndergoingAcceleration( )
+    { return subjectPositionFunction_; }
+
+    //! Function to return whether the mutual attraction is used.
+    bool getIsMutualAttractionUsed( )
+    { return isMutualAttractionUsed_; }
+
+    //! Function to return the value of the current gravitational potential.
+    double getCurrentPotential( )
+    { return currentPotential_; }
+
+    //! Function to return the current hessian of the gravitational potential, in the body-fixed frame.
+    Eigen::Matrix3d getCurrentBodyFixedHessian( )
+    { return currentBodyFixedHessian_; }
+
+    //! Function to return the update potential flag.
+    bool getUpdatePotential( )
+    { return updatePotential_; }
+
+    //! Function to reset the update potential flag.
+    void resetUpdatePotential( bool updatePotential )
+    { updatePotential_ = updatePotential; }
+
+    //! Function to reset the flag indicating whether the hessian is to be computed (typically set by partial object).
+    void resetUpdateHessian( bool updateHessian )
+    { updateHessian_ = updateHessian; }
+
+private:
+
+    //! Pointer to function returning position of body subject to acceleration.
+    const StateFunction subjectPositionFunction_;
+
+    //! Function returning a gravitational parameter [m^3 s^-2].
+    const std::function< double( ) > gravitationalParameterFunction_;
+
+    //! Mascon gravity field of the body exerting the acceleration.
+    std::shared_ptr< MasconGravityField > masconGravityField_;
+
+    //! Pointer to function returning position of body exerting acceleration.
+    const StateFunction sourcePositionFunction_;
+
+    //! Function returning the current rotation from body-fixed frame to integration frame.
+    std::function< Eigen::Quaterniond( ) > rotationFromBodyFixedToIntegrationFrameFunction_;
+
+    //! Variable denoting whether mutual acceleration between bodies is included.
+    bool isMutualAttractionUsed_;
+
+    //! Current rotation from body-fixed frame to integration frame.
+    Eigen::Quaterniond rotationToIntegrationFrame_;
+
+    //! Current position vector from body exerting acceleration to body undergoing acceleration, in inertial frame
+    Eigen::Vector3d currentInertialRelativePosition_;
+
+    //! Current position vector from body exerting acceleration to body undergoing acceleration, in frame fixed to body
+    //! exerting acceleration
+    Eigen::Vector3d currentRelativePosition_;
+
+    //! Current acceleration in frame fixed to body exerting acceleration, as computed by last call to updateMembers function
+    Eigen::Vector3d currentAccelerationInBodyFixedFrame_;
+
+    //! Position of body subject to acceleration.
+    Eigen::Vector3d positionOfBodySubjectToAcceleration_;
+
+    //! Position of body exerting acceleration.
+    Eigen::Vector3d positionOfBodyExertingAcceleration_;
+
+    //! Current gravitational potential, as computed by last call to updateMembers function
+    double currentPotential_;
+
+    //! Current hessian of the gravitational potential in body-fixed frame, as computed by last call to updateMembers function
+    Eigen::Matrix3d currentBodyFixedHessian_;
+
+    //! Flag indicating whether to update the gravitational potential when calling the updateMembers function.
+    bool updatePotential_;
+
+    //! Flag indicating whether to update the hessian of the gravitational potential when calling the updateMembers function.
+    bool updateHessian_;
+};
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_MASCONGRAVITYMODEL_H
@@ -10,6 +10,8 @@
  *    References:
  *          Precise computation of acceleration due to uniform ring or disk, Toshio Fukushima (2010), Celestial Mechanics
  *          and Dynamical Astronomy, 108:339–356.
+ *          Fast computation of complete elliptic integrals and Jacobian elliptic functions, Toshio Fukushima (2009),
+ *          Celestial Mechanics and Dynamical Astronomy, 105:305–328.
  */
 
 #ifndef TUDAT_RINGGRAVITYFIELD_H
@@ -24,18 +26,57 @@
 
 #include "tudat/astro/gravitation/gravityFieldModel.h"
 
-#include <boost/math/special_functions/ellint_1.hpp>
-#include <boost/math/special_functions/ellint_2.hpp>
-#include <boost/math/special_functions/ellint_d.hpp>
-#include <boost/math/special_functions/ellint_rf.hpp>
-#include <boost/math/special_functions/ellint_rf.hpp>
-
 namespace tudat
 {
 
 namespace gravitation
 {
 
+//! Computes the complete elliptic integrals K(m), E(m), B(m) and D(m) in a single evaluation.
+/*!
+ * Computes the complete elliptic integrals of the first and second kind, K(m) and E(m), and the associated complete
+ * elliptic integrals B(m) = (E(m) - (1-m) K(m)) / m and D(m) = (K(m) - E(m)) / m, for parameter m = k^2 in [0,1).
+ * For m < 0.9, B(m) and D(m) are evaluated from tabulated piecewise Taylor series (Fukushima, 2009), from which
+ * K(m) = B(m) + D(m) and E(m) = B(m) + (1-m) D(m) follow. For m >= 0.9, K(m) and E(m) are evaluated from a single
+ * arithmetic-geometric mean sequence. In both cases, the results are accurate to a few units in the last place.
+ *
+ * @param m Parameter of the elliptic integrals, m = k^2, with k the modulus.
+ * @param ellipticIntegralK Complete elliptic integral K (returned by reference).
+ * @param ellipticIntegralE Complete elliptic integral E (returned by reference).
+ * @param ellipticIntegralB Complete elliptic integral B (returned by reference).
+ * @param ellipticIntegralD Complete elliptic integral D (returned by reference).
+ */
+void computeCompleteEllipticIntegrals(
+        const double m,
+        double& ellipticIntegralK,
+        double& ellipticIntegralE,
+        double& ellipticIntegralB,
+        double& ellipticIntegralD );
+
+//! Computes the complete elliptic integrals required for the ring gravity field at a given position.
+/*!
+ * Computes the complete elliptic integrals K(m), E(m), B(m) and S(m) required for the computation of the potential,
+ * acceleration and hessian of a one-dimensional ring, with m computed according to Fukushima (2010), eq. 5. The
+ * elliptic integral S(m) is computed according to Fukushima (2010), eq. 31 or 32, or section A.1 (for m <= 0.01).
+ *
+ * @param positionOfBodySubjectToAcceleration Position of the body subject to the acceleration wrt the ring's body-fixed frame.
+ * @param ringRadius Radius of the ring.
+ * @param ellipticIntegralSFromDAndB Flag indicating whether to compute S(m) from D(m) and B(m) (if true),
+ *      or from K(m) and E(m) (if false)
+ * @param ellipticIntegralK Complete elliptic integral K (returned by reference).
+ * @param ellipticIntegralE Complete elliptic integral E (returned by reference).
+ * @param ellipticIntegralB Complete elliptic integral B (returned by reference).
+ * @param ellipticIntegralS Complete elliptic integral S (returned by reference).
+ */
+void computeRingEllipticIntegrals(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double ringRadius,
+        const bool ellipticIntegralSFromDAndB,
+        double& ellipticIntegralK,
+        double& ellipticIntegralE,
+        double& ellipticIntegralB,
+        double& ellipticIntegralS );
+
 //! Computes the gravitational potential of a one-dimensional ring.
 /*!
  * Computes the gravitational potential of a one-dimensional ring, according to Fukushima (2010), eq. 1. The ring is
@@ -81,6 +122,24 @@ Eigen::Vector3d computeRingGravitationalAcceleration(
         const double ellipticIntegralE,
         const double ellipticIntegralS );
 
+//! Computes the gravitational acceleration of a one-dimensional ring at a set of positions.
+/*!
+ * Computes the gravitational acceleration of a one-dimensional ring at a set of positions (e.g. the field points of a
+ * grid), computing the required elliptic integrals directly, without the use of a RingGravityCache.
+ *
+ * @param positionsOfBodiesSubjectToAcceleration Positions (one per column) wrt the ring's body-fixed frame.
+ * @param ringRadius Radius of the ring.
+ * @param gravitationalParameter Gravitational parameter of the ring.
+ * @param ellipticIntegralSFromDAndB Flag indicating whether to compute S(m) from D(m) and B(m) (if true),
+ *      or from K(m) and E(m) (if false)
+ * @return Gravitational accelerations (one per column).
+ */
+Eigen::Matrix3Xd computeRingGravitationalAccelerations(
+        const Eigen::Matrix3Xd& positionsOfBodiesSubjectToAcceleration,
+        const double ringRadius,
+        const double gravitationalParameter,
+        const bool ellipticIntegralSFromDAndB );
+
 /*!
  * Computes the hessian matrix of the gravitational potential of a 1-dimensional ring. The ring is assumed to be
  * contained in the xy plane, with center at the origin of the reference frame.
@@ -264,6 +323,19 @@ public:
                 ringGravityCache_->getEllipticIntegralS( ) );
     }
 
+    /*! Function to calculate the gradient of the gravitational potential at a set of positions.
+     *
+     * Function to calculate the gradient of the gravitational potential (i.e. the acceleration) at a set of positions.
+     * The cache of the gravity field is not modified.
+     * @param bodyFixedPositions Positions (one per column) at which the gradient is to be calculated, in body-fixed frame.
+     * @return Gradients of the gravitational potential (one per column).
+     */
+    Eigen::Matrix3Xd getGradientsOfPotential( const Eigen::Matrix3Xd& bodyFixedPositions )
+    {
+        return computeRingGravitationalAccelerations(
+                bodyFixedPositions, ringRadius_, gravitationalParameter_, ellipticIntegralSFromDAndB_ );
+    }
+
     //! Function to retrieve the identifier for the body-fixed reference frame.
     std::string getFixedReferenceFrame( )
     { return fixedReferenceFrame_; }
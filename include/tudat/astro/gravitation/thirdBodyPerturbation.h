@@ -24,6 +24,7 @@
 #include "tudat/astro/gravitation/mutualSphericalHarmonicGravityModel.h"
 #include "tudat/astro/gravitation/polyhedronGravityModel.h"
 #include "tudat/astro/gravitation/ringGravityModel.h"
+#include "tudat/astro/gravitation/masconGravityModel.h"
 
 namespace tudat
 {
@@ -114,9 +115,18 @@ public:
     {
         if( !( this->currentTime_ == currentTime ) )
         {
-            // Update two constituent acceleration models.
+            // Update two constituent acceleration models (central body model only if not yet updated by another
+            // third-body acceleration sharing it).
             accelerationModelForBodyUndergoingAcceleration_->updateMembers( currentTime );
-            accelerationModelForCentralBody_->updateMembers( currentTime );
+            if( centralBodyAccelerationUpdateTime_ == nullptr )
+            {
+                accelerationModelForCentralBody_->updateMembers( currentTime );
+            }
+            else if( !( *centralBodyAccelerationUpdateTime_ == currentTime ) )
+            {
+                accelerationModelForCentralBody_->updateMembers( currentTime );
+                *centralBodyAccelerationUpdateTime_ = currentTime;
+            }
             currentAcceleration_ = accelerationModelForBodyUndergoingAcceleration_->getAcceleration( ) -
                     accelerationModelForCentralBody_->getAcceleration( );
         }
@@ -131,6 +141,49 @@ public:
     {
         accelerationModelForBodyUndergoingAcceleration_->resetCurrentTime( );
         accelerationModelForCentralBody_->resetCurrentTime( );
+        if( centralBodyAccelerationUpdateTime_ != nullptr )
+        {
+            *centralBodyAccelerationUpdateTime_ = TUDAT_NAN;
+        }
+    }
+
+    //! Function to share the acceleration model on the central body with another third-body acceleration
+    /*!
+     *  Function to share the acceleration model on the central body (i.e. the indirect term of the third-body
+     *  acceleration) with another third-body acceleration with the same body exerting acceleration and central body,
+     *  such as the acceleration due to the same perturber on another satellite orbiting the same central body. The
+     *  acceleration model of the other object replaces the model of this object, and is evaluated only once for all
+     *  third-body accelerations sharing it, for each evaluation of the state derivative (i.e. between two calls to
+     *  resetCurrentTime).
+     *  \param otherThirdBodyAcceleration Third-body acceleration from which the central body acceleration model is
+     *  to be used.
+     */
+    void shareAccelerationModelForCentralBody(
+            const std::shared_ptr< ThirdBodyAcceleration< DirectAccelerationModelType > > otherThirdBodyAcceleration )
+    {
+        if( otherThirdBodyAcceleration->getCentralBodyName( ) != centralBodyName_ )
+        {
+            throw std::runtime_error( "Error when sharing central body acceleration of third-body acceleration, central bodies " +
+                                      otherThirdBodyAcceleration->getCentralBodyName( ) + " and " + centralBodyName_ +
+                                      " are not the same" );
+        }
+
+        if( otherThirdBodyAcceleration->centralBodyAccelerationUpdateTime_ == nullptr )
+        {
+            otherThirdBodyAcceleration->centralBodyAccelerationUpdateTime_ = std::make_shared< double >( TUDAT_NAN );
+        }
+        accelerationModelForCentralBody_ = otherThirdBodyAcceleration->accelerationModelForCentralBody_;
+        centralBodyAccelerationUpdateTime_ = otherThirdBodyAcceleration->centralBodyAccelerationUpdateTime_;
+    }
+
+    //! Function to return whether the acceleration model on central body is shared with other third-body accelerations
+    /*!
+     *  Function to return whether the acceleration model on central body is shared with other third-body accelerations
+     *  \return True if the acceleration model on central body is shared with other third-body accelerations
+     */
+    bool isAccelerationModelForCentralBodyShared( )
+    {
+        return ( centralBodyAccelerationUpdateTime_ != nullptr );
     }
 
     //! Function to return the direct acceleration model on body undergoing acceleration.
@@ -184,6 +237,9 @@ private:
 
     //! Name of the central body w.r.t. which the acceleration is computed.
      std::string centralBodyName_;
+
+    //! Time at which shared acceleration model on central body was last updated (nullptr if model is not shared)
+    std::shared_ptr< double > centralBodyAccelerationUpdateTime_;
 };
 
 //! Typedef for third body central gravity acceleration.
@@ -206,6 +262,10 @@ ThirdBodyPolyhedronGravitationalAccelerationModel;
 typedef ThirdBodyAcceleration< RingGravitationalAccelerationModel >
 ThirdBodyRingGravitationalAccelerationModel;
 
+//! Typedef for third body mascon gravity acceleration.
+typedef ThirdBodyAcceleration< MasconGravitationalAccelerationModel >
+ThirdBodyMasconGravitationalAccelerationModel;
+
 } // namespace gravitation
 
 } // namespace tudat
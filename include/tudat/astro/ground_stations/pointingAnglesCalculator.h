@@ -117,6 +117,18 @@ public:
      */
     Eigen::Vector3d convertVectorFromInertialToTopocentricFrame( const Eigen::Vector3d& inertialVector, const double time );
 
+    //! Function to compute the rotation from the inertial to the topocentric frame.
+    /*!
+     *  Function to compute the rotation from the inertial to the topocentric frame, with unit vectors in ENU order.
+     *  Can be used to transform multiple vectors at the same time without recomputing the rotation.
+     *  \param time Time at which rotation is to be calculated.
+     *  \return Rotation from inertial to topocentric frame.
+     */
+    Eigen::Quaterniond getRotationFromInertialToTopocentricFrame( const double time )
+    {
+        return rotationFromBodyFixedToTopoCentricFrame_( time ) * rotationFromInertialToBodyFixedFrame_( time );
+    }
+
     std::function< Eigen::Quaterniond( const double ) > getRotsationFromInertialToBodyFixedFrame( )
     {
         return rotationFromInertialToBodyFixedFrame_;
@@ -144,20 +156,20 @@ private:
 
 std::pair< double, double > calculateGroundStationPointingAngles(
         const std::shared_ptr< PointingAnglesCalculator > angleCalculator,
-        const std::vector< Eigen::Vector6d > linkEndStates,
-        const std::vector< double > linkEndTimes,
+        const std::vector< Eigen::Vector6d >& linkEndStates,
+        const std::vector< double >& linkEndTimes,
         const std::pair< int, int >& linkEndIndices );
 
 double calculateGroundStationElevationAngle(
         const std::shared_ptr< PointingAnglesCalculator > angleCalculator,
-        const std::vector< Eigen::Vector6d > linkEndStates,
-        const std::vector< double > linkEndTimes,
+        const std::vector< Eigen::Vector6d >& linkEndStates,
+        const std::vector< double >& linkEndTimes,
         const std::pair< int, int >& linkEndIndices );
 
 double calculateGroundStationAzimuthAngle(
         const std::shared_ptr< PointingAnglesCalculator > angleCalculator,
-        const std::vector< Eigen::Vector6d > linkEndStates,
-        const std::vector< double > linkEndTimes,
+        const std::vector< Eigen::Vector6d >& linkEndStates,
+        const std::vector< double >& linkEndTimes,
         const std::pair< int, int >& linkEndIndices );
 
 }
@@ -0,0 +1,183 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Jimenez-Lluva, D. Robust and Fast Trajectory Optimization Methods for Low-Thrust Trajectories, MSc thesis,
+ *          Delft University of Technology, 2018.
+ *
+ */
+
+#ifndef TUDAT_HYBRID_METHOD_PROPAGATOR_H
+#define TUDAT_HYBRID_METHOD_PROPAGATOR_H
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/basics/basicTypedefs.h"
+#include "tudat/math/integrators/createNumericalIntegrator.h"
+
+namespace tudat
+{
+namespace low_thrust_trajectories
+{
+
+//! Compute optimal thrust direction from modified equinoctial elements co-states.
+/*!
+ * Compute optimal thrust direction from modified equinoctial elements (MEE) co-states, according to optimal control theory.
+ * The thrust direction minimizes the Hamiltonian, so that it is opposite to B^T lambda, with B the matrix mapping an
+ * acceleration in the RSW frame to the time derivatives of the MEE (Gauss planetary equations), and lambda the co-states.
+ * This is the same direction as the one defined by the optimal thrust angles alpha and beta in the
+ * MeeCostatesBangBangThrustMagnitudeWrapper.
+ * \param modifiedEquinoctialElements Current modified equinoctial elements of the spacecraft.
+ * \param costates Current co-states of the MEE (semi-latus rectum, f, g, h and k elements).
+ * \return Unit vector of optimal thrust direction, expressed in RSW frame (zero vector if direction is undefined).
+ */
+Eigen::Vector3d computeMeeCostatesBasedThrustDirectionInRswFrame(
+        const Eigen::Vector6d& modifiedEquinoctialElements,
+        const Eigen::VectorXd& costates );
+
+//! Class to propagate a hybrid method low-thrust trajectory.
+/*!
+ * Class to propagate a hybrid method low-thrust trajectory, in which the thrust direction is computed from MEE co-states that
+ * vary linearly between their initial and final values over the time of flight, and the thrust magnitude is at its maximum
+ * (the bang-bang switching function is always non-positive along the optimal thrust direction). The MEE and mass of the
+ * spacecraft are propagated directly from the Gauss planetary equations and the mass rate, without creating any environment,
+ * acceleration or propagator settings. The numerical integrator is created once, upon construction, and is reset for each
+ * propagation, so that a single object can be reused for a large number of propagations (e.g. over the fitness evaluations
+ * of an optimisation).
+ */
+class HybridMethodPropagator
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param centralBodyGravitationalParameter Gravitational parameter of the central body.
+     * \param maximumThrust Maximum thrust magnitude.
+     * \param specificImpulse Specific impulse of the engine.
+     * \param integratorSettings Settings for the numerical integrator (must be of a Runge-Kutta type, the initial time step is
+     * used as (initial) step size for each propagation).
+     */
+    HybridMethodPropagator(
+            const double centralBodyGravitationalParameter,
+            const double maximumThrust,
+            const double specificImpulse,
+            const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings );
+
+    //! Default destructor.
+    ~HybridMethodPropagator( ){ }
+
+    //! Function to reset the MEE co-states profile.
+    /*!
+     * Function to reset the MEE co-states profile, varying linearly from initial to final co-states over the time of flight.
+     * \param initialCostates Co-states of the MEE at departure (time 0).
+     * \param finalCostates Co-states of the MEE at arrival (time of flight).
+     * \param timeOfFlight Time of flight of the leg.
+     */
+    void resetCostates( const Eigen::VectorXd& initialCostates,
+                        const Eigen::VectorXd& finalCostates,
+                        const double timeOfFlight );
+
+    //! Function to compute the MEE co-states at a given time.
+    /*!
+     * Function to compute the MEE co-states at a given time.
+     * \param currentTime Time since departure at which co-states are to be computed.
+     * \return Current co-states.
+     */
+    Eigen::VectorXd getCurrentCostates( const double currentTime )
+    {
+        return initialCostates_ + ( currentTime / timeOfFlight_ ) * ( finalCostates_ - initialCostates_ );
+    }
+
+    //! Function to compute the derivative of the propagated state (MEE and mass).
+    /*!
+     * Function to compute the derivative of the propagated state (MEE and mass).
+     * \param currentTime Current time since departure.
+     * \param currentState Current MEE (first six entries) and spacecraft mass (last entry).
+     * \return Derivative of the MEE and spacecraft mass.
+     */
+    Eigen::VectorXd computeStateDerivative( const double currentTime, const Eigen::VectorXd& currentState );
+
+    //! Function to propagate the trajectory from initial to final time.
+    /*!
+     * Function to propagate the trajectory from initial to final time, only retrieving the final state.
+     * \param initialTime Time since departure at start of propagation.
+     * \param finalTime Time since departure at end of propagation.
+     * \param initialState Cartesian state at start of propagation.
+     * \param initialMass Spacecraft mass at start of propagation.
+     * \return Cartesian state at end of propagation (propagated mass can be retrieved with getPropagatedMass).
+     */
+    Eigen::Vector6d propagateTrajectory( const double initialTime,
+                                         const double finalTime,
+                                         const Eigen::Vector6d& initialState,
+                                         const double initialMass );
+
+    //! Function to propagate the trajectory to a set of epochs.
+    /*!
+     * Function to propagate the trajectory to a set of epochs, only retrieving the states at these epochs.
+     * \param epochs Times since departure at which the state is to be retrieved (in increasing order, and not before initial
+     * time).
+     * \param initialTime Time since departure at start of propagation.
+     * \param initialState Cartesian state at start of propagation.
+     * \param initialMass Spacecraft mass at start of propagation.
+     * \return Cartesian states at requested epochs (propagated mass at last epoch can be retrieved with getPropagatedMass).
+     */
+    std::map< double, Eigen::Vector6d > propagateTrajectory( const std::vector< double >& epochs,
+                                                             const double initialTime,
+                                                             const Eigen::Vector6d& initialState,
+                                                             const double initialMass );
+
+    //! Function to retrieve the spacecraft mass at the end of the last propagation.
+    double getPropagatedMass( )
+    {
+        return propagatedMass_;
+    }
+
+private:
+
+    //! Gravitational parameter of the central body.
+    double centralBodyGravitationalParameter_;
+
+    //! Maximum thrust magnitude.
+    double maximumThrust_;
+
+    //! Mass rate when thrusting at maximum thrust magnitude.
+    double massRate_;
+
+    //! Initial time step used for numerical integration.
+    double initialTimeStep_;
+
+    //! Numerical integrator, reused for each propagation.
+    std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > integrator_;
+
+    //! Co-states of the MEE at departure.
+    Eigen::VectorXd initialCostates_;
+
+    //! Co-states of the MEE at arrival.
+    Eigen::VectorXd finalCostates_;
+
+    //! Time of flight of the leg.
+    double timeOfFlight_;
+
+    //! Pre-allocated MEE and mass vector, used to (re)set the integrator state.
+    Eigen::VectorXd propagatedState_;
+
+    //! Spacecraft mass at the end of the last propagation.
+    double propagatedMass_;
+
+};
+
+} // namespace low_thrust_trajectories
+} // namespace tudat
+
+#endif // TUDAT_HYBRID_METHOD_PROPAGATOR_H
@@ -22,6 +22,8 @@
 #ifndef TUDAT_SOLARCORONACORRECTION_H
 #define TUDAT_SOLARCORONACORRECTION_H
 
+#include <vector>
+
 #include "tudat/astro/observation_models/observableTypes.h"
 #include "tudat/astro/observation_models/corrections/lightTimeCorrection.h"
 
@@ -31,6 +33,18 @@ namespace tudat
 namespace observation_models
 {
 
+/*!
+ * Computes the integral of cos^p(theta) from theta = 0 to theta = atan( s / d ), in closed form (through the incomplete beta
+ * function) for p > -2. Used to compute the integral of (s^2 + d^2)^(-k/2) along a line of sight, with s the distance along
+ * the line of sight w.r.t. the point closest to the Sun, and d the distance of that point to the Sun.
+ * @param distanceAlongLineOfSight Distance s along line of sight.
+ * @param minimumDistance Minimum distance d of the line of sight to the Sun.
+ * @param cosinePower Exponent p of the cosine.
+ * @return Integral value.
+ */
+double computeCosinePowerIntegralFromLineOfSightDistance(
+        const double distanceAlongLineOfSight, const double minimumDistance, const double cosinePower );
+
 // Abstract class. Doesn't implement any correction model.
 class SolarCoronaCorrection: public LightTimeCorrection
 {
@@ -208,7 +222,6 @@ public:
                 ") are incompatible." );
         }
 
-        exponentsAreIntegers_ = true;
         for ( double exponent : positiveExponents )
         {
             // Check if all exponents are positive
@@ -217,18 +230,14 @@ public:
                 throw std::runtime_error( "Error when creating inverse power series solar corona correction: negative exponent was"
                                           "provided (" + std::to_string( exponent ) + "). All provided exponents should be positive." );
             }
-
-            // Check if all exponents are integers
-            if ( std::fmod( exponent, 1.0 ) != 0 )
-            {
-                exponentsAreIntegers_ = false;
-            }
         }
     }
 
     /*!
     * Function to compute the light-time correction, assuming an inverse power series model for the electron density
-    * distribution, according to Verma et al. (2013).
+    * distribution, according to Verma et al. (2013). The integral of the electron density along the line of sight is
+    * computed in closed form for any (positive) exponent. The Sun states and the resulting correction are cached per link
+    * leg, such that they are reused during the light-time iterations and by the computation of the position partial.
     * @param linkEndsStates List of states at each link end during observation.
     * @param linkEndsTimes List of times at each link end during observation.
     * @param currentMultiLegTransmitterIndex Index in the linkEndsStates and linkEndsTimes of the transmitter in the current link.
@@ -241,8 +250,54 @@ public:
             const unsigned int currentMultiLegTransmitterIndex,
             const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancillarySettings ) override;
 
+    /*!
+     * Function to compute the partial derivative of the light-time correction w.r.t. link end position. The partial is
+     * computed analytically, using the frequency and Sun positions stored when computing the correction for the same link
+     * leg (i.e. the correction must have been computed for the same transmission and reception times).
+     * \param transmitterState State of transmitted at transmission time
+     * \param receiverState State of receiver at reception time
+     * \param transmissionTime Time of signal transmission
+     * \param receptionTime Time of singal reception
+     * \param linkEndAtWhichPartialIsEvaluated Link end at which the position partial is to be taken
+     * \return Partial of light-time correction w.r.t. link end position
+     */
+    Eigen::Matrix< double, 3, 1 > calculateLightTimeCorrectionPartialDerivativeWrtLinkEndPosition(
+            const Eigen::Vector6d& transmitterState,
+            const Eigen::Vector6d& receiverState,
+            const double transmissionTime,
+            const double receptionTime,
+            const LinkEndType linkEndAtWhichPartialIsEvaluated ) override;
+
 private:
 
+    // Quantities of a single link leg, stored to be reused over light-time iterations and by the partial computation
+    struct LinkLegCache
+    {
+        LinkLegCache( ):
+            transmissionTime_( TUDAT_NAN ), receptionTime_( TUDAT_NAN ),
+            transmitterPositionWrtSun_( Eigen::Vector3d::Constant( TUDAT_NAN ) ),
+            receiverPositionWrtSun_( Eigen::Vector3d::Constant( TUDAT_NAN ) ),
+            electronDensityIntegral_( TUDAT_NAN ), correctionScalingFactor_( TUDAT_NAN ){ }
+
+        // Transmission and reception time of the leg
+        double transmissionTime_;
+        double receptionTime_;
+
+        // Position of the Sun at transmission and reception time
+        Eigen::Vector3d sunPositionAtTransmission_;
+        Eigen::Vector3d sunPositionAtReception_;
+
+        // Positions of the transmitter and receiver w.r.t. the Sun for which the integral was last computed
+        Eigen::Vector3d transmitterPositionWrtSun_;
+        Eigen::Vector3d receiverPositionWrtSun_;
+
+        // Integral of the electron density along the line of sight
+        double electronDensityIntegral_;
+
+        // Factor converting the electron density integral to the light-time correction (depends on frequency)
+        double correctionScalingFactor_;
+    };
+
     /*!
      * Computes the electron density, according to Verma et al. (2013).
      *
@@ -252,32 +307,37 @@ private:
     double computeElectronDensity( const Eigen::Vector3d& positionWrtSun, const double time ) override;
 
     /*!
-     * Computes the integral of a single r^{-k} electron density term over the line of sight. Does so analytically, which
-     * is only valid if k is an integer >= 0.
-     *
+     * Computes the integral of the electron density along the line of sight, in closed form.
+     * @param transmitterPositionWrtSun Position of the transmitter with respect to the Sun.
      * @param receiverPositionWrtSun Position of the receiver with respect to the Sun.
-     * @param sunReceiverTransmitterAngle Angle between Receiver-Sun and Receiver-Transmitter vectors.
-     * @param receiverSunTransmitterAngle Angle between Sun-Receiver and Sun-Transmitter vectors.
-     * @param positiveExponent Value of the k exponent. Should be an integer.
      * @return Integral value.
      */
-    double computeSingleTermIntegralAnalytically(
-            const Eigen::Vector3d& receiverPositionWrtSun,
-            const double sunReceiverTransmitterAngle,
-            const double receiverSunTransmitterAngle,
-            const unsigned int positiveExponent );
+    double computeElectronDensityIntegralAnalytically(
+            const Eigen::Vector3d& transmitterPositionWrtSun,
+            const Eigen::Vector3d& receiverPositionWrtSun );
 
     /*!
-     * Computes the integral of (cos(x))^k analytically, for an integer k >= 0.
-     * @param lowerBound Lower bound of the integral.
-     * @param upperBound Upper bound of the integral.
-     * @param positiveExponent Exponent k.
+     * Computes the integral of (s^2 + d^2)^{-k/2} over s, with s the distance along the line of sight w.r.t. the point
+     * closest to the Sun, and d the minimum distance of the (infinite) line of sight to the Sun. The integral is computed
+     * in closed form through incomplete beta functions for any k > 0. If both link ends are on the same side of the point
+     * closest to the Sun and d is small w.r.t. the distance of the link ends to the Sun (link ends nearly radially
+     * aligned), the integral is instead computed from a series expansion in (d/s)^2, in which limit the closed form
+     * suffers from cancellation.
+     *
+     * @param transmitterDistanceAlongLineOfSight Value of s at the transmitter.
+     * @param receiverDistanceAlongLineOfSight Value of s at the receiver.
+     * @param minimumDistance Minimum distance d of the line of sight to the Sun.
+     * @param positiveExponent Value of the k exponent.
      * @return Integral value.
      */
-    double computeCosinePowerIntegral(
-            const double lowerBound,
-            const double upperBound,
-            const unsigned int positiveExponent );
+    double computeSingleTermIntegral(
+            const double transmitterDistanceAlongLineOfSight,
+            const double receiverDistanceAlongLineOfSight,
+            const double minimumDistance,
+            const double positiveExponent );
+
+    // Retrieves the cache of the link leg with the given transmission and reception times, updating the Sun positions
+    LinkLegCache& getLinkLegCache( const unsigned int legIndex, const double transmissionTime, const double receptionTime );
 
     // Vector containing the c coefficients of the electron density model (\sum c r^{-k}).
     const std::vector< double > coefficients_;
@@ -285,17 +345,14 @@ private:
     // Vector containing the k exponents of the electron density model (\sum c r^{-k}).
     const std::vector< double > positiveExponents_;
 
-    // Boolean indicating whether all exponents are integers. If so, correction can be calculated fully analytically
-    bool exponentsAreIntegers_;
-
     // Solar corona correction coefficient.
     const double criticalPlasmaDensityDelayCoefficient_;
 
     // Radius of the Sun.
     const double sunRadius_;
 
-    // Cache containing the integral of the already computed cosine-powers integrals.
-    std::map< unsigned int, double > cosinePowersIntegralsCache_;
+    // Cached quantities of each link leg (index of transmitter in multi-leg link) of the most recent observation
+    std::vector< LinkLegCache > linkLegCaches_;
 
 };
 
@@ -17,6 +17,7 @@
 #include "tudat/astro/orbit_determination/estimatable_parameters/constantDragCoefficient.h"
 
 #include "tudat/astro/orbit_determination/acceleration_partials/accelerationPartial.h"
+#include "tudat/math/basic/numericalDerivative.h"
 
 namespace tudat
 {
@@ -27,7 +28,9 @@ namespace acceleration_partials
 //! Class to calculate the partials of the aerodynamic acceleration w.r.t. parameters and states.
 /*!
  * Class to calculate the partials of the aerodynamic acceleration w.r.t. parameters and states. Note that the state partials
- * are computed numerically by 2nd-order central difference with perturbations hard-coded in the constructor
+ * are computed numerically by 2nd-order central difference with perturbations set in the constructor. Optionally, these
+ * perturbations are periodically re-selected from an estimate of the truncation and rounding errors (see
+ * CentralDifferenceJacobianCalculator).
  */
 class AerodynamicAccelerationPartial: public AccelerationPartial
 {
@@ -43,6 +46,9 @@ public:
      * \param vehicleStateSetFunction Function to set the state of the body undergoing the acceleration.
      * \param acceleratedBody Body undergoing acceleration.
      * \param acceleratingBody Body exerting acceleration.
+     * \param stepSizeUpdateInterval Number of calls to update after which the state perturbations are re-selected from an
+     * error estimate (0 if the initial perturbations are to be used throughout).
+     * \param bodyStatePerturbations Initial perturbations of the vehicle state used for the numerical state partials.
      */
     AerodynamicAccelerationPartial(
             const std::shared_ptr< aerodynamics::AerodynamicAcceleration > aerodynamicAcceleration,
@@ -50,12 +56,17 @@ public:
             const std::function< Eigen::Vector6d( ) > vehicleStateGetFunction,
             const std::function< void( const Eigen::Vector6d& ) > vehicleStateSetFunction,
             const std::string acceleratedBody,
-            const std::string acceleratingBody ):
+            const std::string acceleratingBody,
+            const int stepSizeUpdateInterval = 0,
+            const Eigen::Vector6d& bodyStatePerturbations =
+            ( Eigen::Vector6d( ) << 10.0, 10.0, 10.0, 1.0E-2, 1.0E-2, 1.0E-2 ).finished( ) ):
         AccelerationPartial( acceleratedBody, acceleratingBody, basic_astrodynamics::aerodynamic ),
+        bodyStatePerturbations_( bodyStatePerturbations ),
         aerodynamicAcceleration_( aerodynamicAcceleration ), flightConditions_( flightConditions ),
         vehicleStateGetFunction_( vehicleStateGetFunction ), vehicleStateSetFunction_( vehicleStateSetFunction )
     {
-        bodyStatePerturbations_ << 10.0, 10.0, 10.0, 1.0E-2, 1.0E-2, 1.0E-2;
+        stateJacobianCalculator_ = std::make_shared< numerical_derivatives::CentralDifferenceJacobianCalculator >(
+                    bodyStatePerturbations_, stepSizeUpdateInterval );
     }
 
     //! Function for calculating the partial of the acceleration w.r.t. the position of body undergoing acceleration..
@@ -277,6 +288,16 @@ public:
      */
     void update( const double currentTime = TUDAT_NAN );
 
+    //! Function to retrieve the object used to compute the state partials by central differences
+    /*!
+     *  Function to retrieve the object used to compute the state partials by central differences
+     *  \return Object used to compute the state partials by central differences
+     */
+    std::shared_ptr< numerical_derivatives::CentralDifferenceJacobianCalculator > getStateJacobianCalculator( )
+    {
+        return stateJacobianCalculator_;
+    }
+
 protected:
 
     //! Function to compute the partial derivative of the acceleration w.r.t. the drag coefficient
@@ -335,6 +356,9 @@ protected:
     //! currentAccelerationStatePartials_
     Eigen::Vector6d bodyStatePerturbations_;
 
+    //! Object used to compute currentAccelerationStatePartials_ by central differences (starting from bodyStatePerturbations_)
+    std::shared_ptr< numerical_derivatives::CentralDifferenceJacobianCalculator > stateJacobianCalculator_;
+
     //! Partial derivative of aerodynamic acceleration w.r.t. current state, numerically computed by update function
     Eigen::Matrix< double, 3, 6 > currentAccelerationStatePartials_;
 
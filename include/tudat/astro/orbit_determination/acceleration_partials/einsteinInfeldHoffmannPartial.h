@@ -0,0 +1,290 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_EINSTEININFELDHOFFMANNPARTIAL_H
+#define TUDAT_EINSTEININFELDHOFFMANNPARTIAL_H
+
+#include <memory>
+
+#include "tudat/astro/relativity/einsteinInfeldHoffmannAcceleration.h"
+#include "tudat/astro/orbit_determination/acceleration_partials/accelerationPartial.h"
+
+namespace tudat
+{
+
+namespace acceleration_partials
+{
+
+//! Class to calculate the partials of a contribution to the Einstein-Infeld-Hoffmann acceleration w.r.t. parameters and states.
+/*!
+ *  Class to calculate the partials of the contribution of a single body to the Einstein-Infeld-Hoffmann (EIH) acceleration
+ *  of another body w.r.t. parameters and states. Since the contribution depends on the positions of all bodies in the set of
+ *  mutually attracting bodies, all bodies other than the bodies undergoing and exerting acceleration are treated as
+ *  additional bodies. The partials themselves are computed analytically by the (shared) EinsteinInfeldHoffmannEquations
+ *  object, once per time step for all EIH accelerations.
+ */
+class EinsteinInfeldHoffmannPartial: public AccelerationPartial
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param accelerationModel EIH acceleration w.r.t. which partials are to be taken.
+     *  \param acceleratedBody Body undergoing acceleration.
+     *  \param acceleratingBody Body exerting acceleration.
+     */
+    EinsteinInfeldHoffmannPartial(
+            const std::shared_ptr< relativity::EinsteinInfeldHoffmannAcceleration > accelerationModel,
+            const std::string& acceleratedBody,
+            const std::string& acceleratingBody ):
+        AccelerationPartial( acceleratedBody, acceleratingBody, basic_astrodynamics::einstein_infeld_hoffmann_acceleration ),
+        eihEquations_( accelerationModel->getEihEquations( ) ),
+        acceleratedBodyIndex_( accelerationModel->getAcceleratedBodyIndex( ) ),
+        acceleratingBodyIndex_( accelerationModel->getAcceleratingBodyIndex( ) )
+    { }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the position of body undergoing acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the position of body undergoing acceleration
+     *  and adding it to the existing partial block
+     *  Update( ) function must have been called during current time step before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian position of body
+     *  undergoing acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtPositionOfAcceleratedBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 0 )
+    {
+        addPartialBlock( eihEquations_->getPartialWrtPositions( acceleratedBodyIndex_, acceleratingBodyIndex_ ),
+                         acceleratedBodyIndex_, partialMatrix, addContribution, startRow, startColumn );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the velocity of body undergoing acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the velocity of body undergoing acceleration
+     *  and adding it to the existing partial block
+     *  Update( ) function must have been called during current time step before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian velocity of body
+     *  undergoing acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtVelocityOfAcceleratedBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 3 )
+    {
+        addPartialBlock( eihEquations_->getPartialWrtVelocities( acceleratedBodyIndex_, acceleratingBodyIndex_ ),
+                         acceleratedBodyIndex_, partialMatrix, addContribution, startRow, startColumn );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the position of body exerting acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the position of body exerting acceleration and
+     *  adding it to the existing partial block.
+     *  Update( ) function must have been called during current time step before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian position of body
+     *  exerting acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtPositionOfAcceleratingBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 0 )
+    {
+        addPartialBlock( eihEquations_->getPartialWrtPositions( acceleratedBodyIndex_, acceleratingBodyIndex_ ),
+                         acceleratingBodyIndex_, partialMatrix, addContribution, startRow, startColumn );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the velocity of body exerting acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the velocity of body exerting acceleration and
+     *  adding it to the existing partial block.
+     *  Update( ) function must have been called during current time step before calling this function.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian velocity of body
+     *  exerting acceleration where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtVelocityOfAcceleratingBody(
+            Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 3 )
+    {
+        addPartialBlock( eihEquations_->getPartialWrtVelocities( acceleratedBodyIndex_, acceleratingBodyIndex_ ),
+                         acceleratingBodyIndex_, partialMatrix, addContribution, startRow, startColumn );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the position of a third body in the EIH equations.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the position of a third body in the set of mutually
+     *  attracting bodies, and adding it to the existing partial block.
+     *  Update( ) function must have been called during current time step before calling this function.
+     *  \param bodyName Name of third body.
+     *  \param partialMatrix Block of partial derivatives of acceleration w.r.t. Cartesian position of third body where
+     *  current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtPositionOfAdditionalBody(
+            const std::string& bodyName, Eigen::Block< Eigen::MatrixXd > partialMatrix,
+            const bool addContribution = 1, const int startRow = 0, const int startColumn = 0 )
+    {
+        addPartialBlock( eihEquations_->getPartialWrtPositions( acceleratedBodyIndex_, acceleratingBodyIndex_ ),
+                         eihEquations_->getBodyIndex( bodyName ), partialMatrix, addContribution, startRow, startColumn );
+    }
+
+    //! Function to check whether the partial derivative w.r.t. the translational state of a third body is non-zero.
+    /*!
+     * Function to check whether the partial derivative w.r.t. the translational state of a third body is non-zero, which
+     * is the case for all other bodies in the set of mutually attracting bodies.
+     * \param bodyName Name of third body.
+     * \return True if third body dependency exists, false otherwise.
+     */
+    bool isAccelerationPartialWrtAdditionalBodyNonnullptr( const std::string& bodyName )
+    {
+        return ( bodyName != acceleratedBody_ && bodyName != acceleratingBody_ && eihEquations_->isBodyInSet( bodyName ) );
+    }
+
+    //! Function for determining if the acceleration is dependent on a non-translational integrated state.
+    /*!
+     *  Function for determining if the acceleration is dependent on a non-translational integrated state.
+     *  No dependency exists for this acceleration model.
+     *  \param stateReferencePoint Reference point id of propagated state
+     *  \param integratedStateType Type of propagated state for which dependency is to be determined.
+     *  \return True if dependency exists (non-zero partial), false otherwise.
+     */
+    bool isStateDerivativeDependentOnIntegratedAdditionalStateTypes(
+            const std::pair< std::string, std::string >& stateReferencePoint,
+            const propagators::IntegratedStateType integratedStateType )
+    {
+        return 0;
+    }
+
+    //! Function for setting up and retrieving a function returning a partial w.r.t. a double parameter.
+    /*!
+     *  Function for setting up and retrieving a function returning a partial w.r.t. a double parameter. Partials w.r.t.
+     *  the gravitational parameters of all bodies in the set of mutually attracting bodies, and w.r.t. the PPN parameters
+     *  gamma and beta are implemented.
+     *  Function returns empty function and zero size indicator for parameters with no dependency for current acceleration.
+     *  \param parameter Parameter w.r.t. which partial is to be taken.
+     *  \return Pair of parameter partial function and number of columns in partial (0 for no dependency, 1 otherwise).
+     */
+    std::pair< std::function< void( Eigen::MatrixXd& ) >, int >
+    getParameterPartialFunction( std::shared_ptr< estimatable_parameters::EstimatableParameter< double > > parameter );
+
+    //! Function for setting up and retrieving a function returning a partial w.r.t. a vector parameter.
+    /*!
+     *  Function for setting up and retrieving a function returning a partial w.r.t. a vector parameter.
+     *  Function returns empty function and zero size indicator for parameters with no dependency for current acceleration.
+     *  \param parameter Parameter w.r.t. which partial is to be taken.
+     *  \return Pair of parameter partial function and number of columns in partial (0 for no dependency).
+     */
+    std::pair< std::function< void( Eigen::MatrixXd& ) >, int >
+    getParameterPartialFunction( std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > parameter )
+    {
+        std::function< void( Eigen::MatrixXd& ) > partialFunction;
+        return std::make_pair( partialFunction, 0 );
+    }
+
+    //! Function to compute partial derivative of acceleration w.r.t. gravitational parameter of a body in the EIH equations
+    /*!
+     * Function to compute partial derivative of acceleration w.r.t. gravitational parameter of a body in the set of mutually
+     * attracting bodies
+     * \param partialMatrix Requested partial (returned by reference)
+     * \param bodyIndex Index of body in the EIH equations
+     */
+    void wrtGravitationalParameter( Eigen::MatrixXd& partialMatrix, const int bodyIndex )
+    {
+        partialMatrix = eihEquations_->getPartialWrtGravitationalParameters(
+                    acceleratedBodyIndex_, acceleratingBodyIndex_ ).col( bodyIndex );
+    }
+
+    //! Function to compute partial derivative of acceleration w.r.t. PPN parameter gamma
+    /*!
+     * Function to compute partial derivative of acceleration w.r.t. PPN parameter gamma
+     * \param partialMatrix Requested partial (returned by reference)
+     */
+    void wrtPpnParameterGamma( Eigen::MatrixXd& partialMatrix )
+    {
+        partialMatrix = eihEquations_->getPartialWrtPpnParameterGamma( acceleratedBodyIndex_, acceleratingBodyIndex_ );
+    }
+
+    //! Function to compute partial derivative of acceleration w.r.t. PPN parameter beta
+    /*!
+     * Function to compute partial derivative of acceleration w.r.t. PPN parameter beta
+     * \param partialMatrix Requested partial (returned by reference)
+     */
+    void wrtPpnParameterBeta( Eigen::MatrixXd& partialMatrix )
+    {
+        partialMatrix = eihEquations_->getPartialWrtPpnParameterBeta( acceleratedBodyIndex_, acceleratingBodyIndex_ );
+    }
+
+    //! Function for updating partial w.r.t. the bodies' states
+    /*!
+     *  Function for updating the partials to the current time/state, which are computed by the shared EIH equations
+     *  object (if not yet done for the current time step by another EIH acceleration partial).
+     *  \param currentTime Time at which partials are to be calculated
+     */
+    void update( const double currentTime = TUDAT_NAN )
+    {
+        if( !( currentTime_ == currentTime ) )
+        {
+            eihEquations_->updatePartials( currentTime );
+            currentTime_ = currentTime;
+        }
+    }
+
+protected:
+
+    //! Function to reset the partials of the shared EIH equations, so that they are recomputed at the next update
+    void resetCurrentTimeOfMemberObjects( )
+    {
+        eihEquations_->resetCurrentPartialsTime( );
+    }
+
+private:
+
+    //! Function to add (or subtract) the 3x3 block of a given body from the partials of the EIH equations
+    void addPartialBlock( const Eigen::Matrix3Xd& partials, const int bodyIndex,
+                          Eigen::Block< Eigen::MatrixXd >& partialMatrix,
+                          const bool addContribution, const int startRow, const int startColumn )
+    {
+        if( addContribution )
+        {
+            partialMatrix.block( startRow, startColumn, 3, 3 ) += partials.block( 0, 3 * bodyIndex, 3, 3 );
+        }
+        else
+        {
+            partialMatrix.block( startRow, startColumn, 3, 3 ) -= partials.block( 0, 3 * bodyIndex, 3, 3 );
+        }
+    }
+
+    //! Object computing the EIH equations (and their partials) for the full set of mutually attracting bodies
+    std::shared_ptr< relativity::EinsteinInfeldHoffmannEquations > eihEquations_;
+
+    //! Index of the body undergoing acceleration in the EIH equations
+    int acceleratedBodyIndex_;
+
+    //! Index of the body exerting acceleration in the EIH equations
+    int acceleratingBodyIndex_;
+};
+
+} // namespace acceleration_partials
+
+} // namespace tudat
+
+#endif // TUDAT_EINSTEININFELDHOFFMANNPARTIAL_H
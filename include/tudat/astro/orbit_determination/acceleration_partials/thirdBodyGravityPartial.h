@@ -20,6 +20,7 @@
 #include "tudat/astro/orbit_determination/acceleration_partials/mutualSphericalHarmonicGravityPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/polyhedronAccelerationPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/ringAccelerationPartial.h"
+#include "tudat/astro/orbit_determination/acceleration_partials/masconAccelerationPartial.h"
 
 #include "tudat/astro/orbit_determination/acceleration_partials/accelerationPartial.h"
 
@@ -64,6 +65,10 @@ basic_astrodynamics::AvailableAcceleration getAccelerationTypeOfThirdBodyGravity
     {
         accelerationType = third_body_ring_gravity;
     }
+    else if( std::dynamic_pointer_cast< MasconGravityPartial >( directGravityPartial ) != nullptr )
+    {
+        accelerationType = third_body_mascon_gravity;
+    }
 
     else
     {
@@ -561,6 +566,11 @@ inline std::string getCentralBodyNameFromThirdBodyAccelerationPartial(
             centralBody = std::dynamic_pointer_cast< ThirdBodyGravityPartial< RingGravityPartial > >(
                         accelerationPartial )->getCentralBodyName( );
         }
+        else if( accelerationPartial->getAccelerationType( ) == basic_astrodynamics::third_body_mascon_gravity )
+        {
+            centralBody = std::dynamic_pointer_cast< ThirdBodyGravityPartial< MasconGravityPartial > >(
+                        accelerationPartial )->getCentralBodyName( );
+        }
         else
         {
             throw std::runtime_error( "Error, requested third body from acceleration partial, input third-body type not recognized." );
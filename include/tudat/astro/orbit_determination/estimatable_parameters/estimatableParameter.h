@@ -185,13 +185,19 @@ public:
         const std::string bodyExertingAcceleration,
         const basic_astrodynamics::AvailableAcceleration accelerationType,
         const std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >& environmentUpdateSettings =
-        std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >( ) ):
+        std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >( ),
+        const int stepSizeUpdateInterval = 0 ):
         CustomAccelerationPartialSettings( bodyUndergoingAcceleration, bodyExertingAcceleration, accelerationType ),
-        parameterPerturbation_( parameterPerturbation ), environmentUpdateSettings_( environmentUpdateSettings ){ }
+        parameterPerturbation_( parameterPerturbation ), environmentUpdateSettings_( environmentUpdateSettings ),
+        stepSizeUpdateInterval_( stepSizeUpdateInterval ){ }
 
     Eigen::VectorXd parameterPerturbation_;
 
     std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > > environmentUpdateSettings_;
+
+    //! Number of partial updates after which the perturbations are re-selected from an error estimate (0 if never). Only
+    //! used by partials that compute their state partials numerically internally (aerodynamic acceleration).
+    int stepSizeUpdateInterval_;
 };
 
 class AnalyticalAccelerationPartialSettings: public CustomAccelerationPartialSettings
@@ -226,10 +232,12 @@ inline std::shared_ptr< CustomAccelerationPartialSettings > numericalAcceleratio
     const std::string bodyExertingAcceleration,
     const basic_astrodynamics::AvailableAcceleration accelerationType,
     const std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >& environmentUpdateSettings  =
-    std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >( ) )
+    std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >( ),
+    const int stepSizeUpdateInterval = 0 )
 {
     return std::make_shared< NumericalAccelerationPartialSettings >(
-        parameterPerturbation, bodyUndergoingAcceleration, bodyExertingAcceleration, accelerationType, environmentUpdateSettings );
+        parameterPerturbation, bodyUndergoingAcceleration, bodyExertingAcceleration, accelerationType, environmentUpdateSettings,
+        stepSizeUpdateInterval );
 }
 
 //! Base class for a parameter that is to be estimated.
@@ -251,11 +251,17 @@ public:
 
     //! Function to reset all parameter values.
     /*!
-     *  Function to reset all parameter values.
+     *  Function to reset all parameter values. Parameters for which the new value is identical to the current value are
+     *  skipped by default, so that the associated environment models (and any quantities that depend on them) are only
+     *  updated for parameters that are actually modified. This is typically the case for all but one parameter when
+     *  computing numerical partials, and for many parameters when restoring a previous parameter vector.
      *  \param newParameterValues New parameter values. Order of values in vector must be same order as return vector of getFullParameterValues
+     *  \param resetUnchangedParameters Boolean denoting whether parameters for which the value is not changed are to
+     *  be reset as well (default false)
      */
     template< typename ParameterScalar >
-    void resetParameterValues( const Eigen::Matrix< ParameterScalar, Eigen::Dynamic, 1 >& newParameterValues )
+    void resetParameterValues( const Eigen::Matrix< ParameterScalar, Eigen::Dynamic, 1 >& newParameterValues,
+                               const bool resetUnchangedParameters = false )
     {
         // Check input consistency
         if( newParameterValues.rows( ) != totalParameterSetSize_ )
@@ -266,43 +272,49 @@ public:
         }
         else
         {
-            int currentStartIndex = 0;
+            // Start indices and sizes of parameters are taken from parameterIndices_, which has the same order as
+            // the loops below (initial states, followed by double and vector parameters)
+            int parameterIndex = 0;
 
-//            std::cout << "before reset initial state parameters" << "\n\n";
+            // Set initial state parameter values.
+            Eigen::Matrix< InitialStateParameterType, Eigen::Dynamic, 1 > newInitialStateValue;
             for( unsigned int i = 0; i < estimateInitialStateParameters_.size( ); i++ )
             {
-                estimateInitialStateParameters_[ i ]->setParameterValue(
-                            newParameterValues.segment( currentStartIndex, estimateInitialStateParameters_[ i ]->getParameterSize( ) ).
-                            template cast< InitialStateParameterType >( ) );
-                currentStartIndex += estimateInitialStateParameters_[ i ]->getParameterSize( );
+                newInitialStateValue = newParameterValues.segment(
+                            parameterIndices_.at( parameterIndex ).first, parameterIndices_.at( parameterIndex ).second ).
+                        template cast< InitialStateParameterType >( );
+                if( resetUnchangedParameters || newInitialStateValue != estimateInitialStateParameters_[ i ]->getParameterValue( ) )
+                {
+                    estimateInitialStateParameters_[ i ]->setParameterValue( newInitialStateValue );
+                }
+                parameterIndex++;
             }
-//            std::cout << "after reset initial state parameters" << "\n\n";
 
             // Set double parameter values.
-//            std::cout << "before reset double parameters" << "\n\n";
+            double newDoubleValue;
             for( unsigned int i = 0; i < estimatedDoubleParameters_.size( ); i++ )
             {
-                estimatedDoubleParameters_[ i ]->setParameterValue( static_cast< double >( newParameterValues( currentStartIndex ) ) );
-                currentStartIndex++;
+                newDoubleValue = static_cast< double >( newParameterValues( parameterIndices_.at( parameterIndex ).first ) );
+                if( resetUnchangedParameters || newDoubleValue != estimatedDoubleParameters_[ i ]->getParameterValue( ) )
+                {
+                    estimatedDoubleParameters_[ i ]->setParameterValue( newDoubleValue );
+                }
+                parameterIndex++;
             }
-//            std::cout << "after reset double parameters" << "\n\n";
 
             // Set vector parameter values.
-//            std::cout << "before reset vector parameters" << "\n\n";
-//            std::cout << "new parameters values: " << newParameterValues.transpose( ) << "\n\n";
+            Eigen::VectorXd newVectorValue;
             for( unsigned int i = 0; i < estimatedVectorParameters_.size( ); i++ )
             {
-//                std::cout << "current start index: " << currentStartIndex << "\n\n";
-//                std::cout << "current parameter size: " << estimatedVectorParameters_[ i ]->getParameterSize( ) << "\n\n";
-//                std::cout << "newParameterValues current parameter: "
-//                          << newParameterValues.segment( currentStartIndex, estimatedVectorParameters_[ i ]->getParameterSize( ) ).transpose( ) << "\n\n";
-                estimatedVectorParameters_[ i ]->setParameterValue(
-                            newParameterValues.segment( currentStartIndex, estimatedVectorParameters_[ i ]->getParameterSize( ) ).
-                            template cast< double >( ) );
-
-                currentStartIndex += estimatedVectorParameters_[ i ]->getParameterSize( );
+                newVectorValue = newParameterValues.segment(
+                            parameterIndices_.at( parameterIndex ).first, parameterIndices_.at( parameterIndex ).second ).
+                        template cast< double >( );
+                if( resetUnchangedParameters || newVectorValue != estimatedVectorParameters_[ i ]->getParameterValue( ) )
+                {
+                    estimatedVectorParameters_[ i ]->setParameterValue( newVectorValue );
+                }
+                parameterIndex++;
             }
-//            std::cout << "after reset vector parameters" << "\n\n";
         }
     }
 
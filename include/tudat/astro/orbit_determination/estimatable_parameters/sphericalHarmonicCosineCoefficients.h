@@ -47,7 +47,7 @@ public:
      */
     SphericalHarmonicsCosineCoefficients(
             const std::function< Eigen::MatrixXd( ) > getCosineCoefficients,
-            const std::function< void( Eigen::MatrixXd ) > setCosineCoefficients,
+            const std::function< void( const Eigen::MatrixXd& ) > setCosineCoefficients,
             const std::vector< std::pair< int, int > > blockIndices,
             const std::string& associatedBody ):
         EstimatableParameter< Eigen::VectorXd >( spherical_harmonics_cosine_coefficient_block, associatedBody ),
@@ -148,7 +148,7 @@ private:
     std::function< Eigen::MatrixXd( ) > getCosineCoefficients_;
 
     //! Function to reset the full set of sine coefficients, of which a subset is to be estimated.
-    std::function< void( Eigen::MatrixXd ) > setCosineCoefficients_;
+    std::function< void( const Eigen::MatrixXd& ) > setCosineCoefficients_;
 
     //! List of cosine coefficient indices which are to be estimated
     /*!
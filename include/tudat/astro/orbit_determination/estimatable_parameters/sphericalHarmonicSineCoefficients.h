@@ -48,7 +48,7 @@ public:
      */
     SphericalHarmonicsSineCoefficients(
             const std::function< Eigen::MatrixXd( ) > getSineCoefficients,
-            const std::function< void( Eigen::MatrixXd ) > setSineCoefficients,
+            const std::function< void( const Eigen::MatrixXd& ) > setSineCoefficients,
             const std::vector< std::pair< int, int > >& blockIndices,
             const std::string& associatedBody ):
         EstimatableParameter< Eigen::VectorXd >( spherical_harmonics_sine_coefficient_block, associatedBody ),
@@ -145,7 +145,7 @@ private:
     std::function< Eigen::MatrixXd( ) > getSineCoefficients_;
 
     //! Function to reset the full set of sine coefficients, of which a subset is to be estimated.
-    std::function< void( Eigen::MatrixXd ) > setSineCoefficients_;
+    std::function< void( const Eigen::MatrixXd& ) > setSineCoefficients_;
 
     //! List of sine coefficient indices which are to be estimated
     /*!
@@ -11,6 +11,7 @@
 #ifndef TUDAT_PODINPUTOUTPUTTYPES_H
 #define TUDAT_PODINPUTOUTPUTTYPES_H
 
+#include <algorithm>
 #include <map>
 #include <vector>
 #include <iostream>
@@ -647,7 +648,9 @@ public:
         convergenceChecker_( convergenceChecker ),
         considerParametersDeviations_( considerParametersDeviations ),
         conditionNumberWarningEachIteration_( true ),
-        applyFinalParameterCorrection_( applyFinalParameterCorrection )
+        applyFinalParameterCorrection_( applyFinalParameterCorrection ),
+        tileSizeForTiledNormalEquations_( 0 ),
+        numberOfThreadsForTiledNormalEquations_( 1 )
 
     {
         if ( this->areConsiderParametersIncluded( ) )
@@ -743,6 +746,98 @@ public:
         return saveStateHistoryForEachIteration_;
     }
 
+    //! Function to set the arcs for which arc-local parameters are eliminated when solving the normal equations
+    /*!
+     * Function to set the arcs for which arc-local parameters are eliminated when solving the normal equations. When set,
+     * the parameters with non-zero partials for observations of only a single arc (e.g. arc initial states, per-arc
+     * empirical accelerations and per-pass biases) are eliminated arc-by-arc, so that only the reduced system of global
+     * parameters needs to be inverted (see linear_algebra::performArcwiseReducedLeastSquaresAdjustment). If the estimation
+     * includes linear constraints, the full normal equations are solved instead.
+     *
+     * Note that this only reduces the cost of solving the normal equations. The design matrix is still assembled in full, and
+     * the full (dense) inverse covariance is still formed, since the EstimationOutput provides the covariance, formal errors and
+     * correlations of all estimated parameters. The memory of this N x N matrix is small compared to that of the M x N design
+     * matrix (with M the number of observations).
+     * \param arcStartTimes Start times of the observation arcs (an observation is in the last arc that starts at or before
+     * the observation time). An empty list denotes that the full normal equations are to be solved.
+     */
+    void setArcwiseReducedNormalEquations( const std::vector< double >& arcStartTimes )
+    {
+        if( !std::is_sorted( arcStartTimes.begin( ), arcStartTimes.end( ) ) )
+        {
+            throw std::runtime_error( "Error when setting arcs for reduced normal equations, arc start times are not sorted" );
+        }
+        arcStartTimesForReducedNormalEquations_ = arcStartTimes;
+    }
+
+    //! Function to return the start times of the arcs for which arc-local parameters are eliminated
+    /*!
+     * Function to return the start times of the arcs for which arc-local parameters are eliminated
+     * \return Start times of the arcs for which arc-local parameters are eliminated (empty if full normal equations are solved)
+     */
+    std::vector< double > getArcStartTimesForReducedNormalEquations( )
+    {
+        return arcStartTimesForReducedNormalEquations_;
+    }
+
+    //! Function to set the normal equations to be solved with a tiled Cholesky decomposition
+    /*!
+     * Function to set the normal equations to be solved with a blocked Cholesky decomposition of a tiled normal matrix (see
+     * linear_algebra::performTiledLeastSquaresAdjustment), instead of an SVD of the dense normal matrix. The normal matrix
+     * is accumulated from blocks of design matrix rows, and can be stored in a memory-mapped file and decomposed using
+     * multiple threads. This removes the weighted copy of the design matrix and the SVD work matrices from the peak memory
+     * use of each iteration. The design matrix and the dense inverse covariance are still formed, since these are part of the
+     * EstimationOutput. Since no SVD is computed, the condition number is not checked, and the estimation terminates if the
+     * normal matrix is not positive definite. If arc-wise reduced normal equations are also set, or the estimation includes
+     * linear constraints, these take precedence.
+     * \param tileSize Number of rows/columns of a single tile of the normal matrix. A value of 0 denotes that the dense
+     * normal equations are solved.
+     * \param storageFile Name of file used to store the tiles as a memory-mapped file. If empty, tiles are stored in memory.
+     * \param numberOfThreads Number of threads over which tile operations are distributed
+     */
+    void setTiledNormalEquations( const int tileSize,
+                                  const std::string& storageFile = "",
+                                  const int numberOfThreads = 1 )
+    {
+        if( tileSize < 0 || numberOfThreads < 1 )
+        {
+            throw std::runtime_error( "Error when setting tiled normal equations, tile size and number of threads must be positive" );
+        }
+        tileSizeForTiledNormalEquations_ = tileSize;
+        storageFileForTiledNormalEquations_ = storageFile;
+        numberOfThreadsForTiledNormalEquations_ = numberOfThreads;
+    }
+
+    //! Function to return the tile size with which the normal equations are solved (0 if dense normal equations are solved)
+    /*!
+     * Function to return the tile size with which the normal equations are solved (0 if dense normal equations are solved)
+     * \return Tile size with which the normal equations are solved (0 if dense normal equations are solved)
+     */
+    int getTileSizeForTiledNormalEquations( )
+    {
+        return tileSizeForTiledNormalEquations_;
+    }
+
+    //! Function to return the name of the file in which the tiled normal matrix is stored (empty if stored in memory)
+    /*!
+     * Function to return the name of the file in which the tiled normal matrix is stored (empty if stored in memory)
+     * \return Name of the file in which the tiled normal matrix is stored (empty if stored in memory)
+     */
+    std::string getStorageFileForTiledNormalEquations( )
+    {
+        return storageFileForTiledNormalEquations_;
+    }
+
+    //! Function to return the number of threads over which the tiled normal matrix operations are distributed
+    /*!
+     * Function to return the number of threads over which the tiled normal matrix operations are distributed
+     * \return Number of threads over which the tiled normal matrix operations are distributed
+     */
+    int getNumberOfThreadsForTiledNormalEquations( )
+    {
+        return numberOfThreadsForTiledNormalEquations_;
+    }
+
     //! Boolean denoting whether the residuals and parameters from the each iteration are to be saved
     bool saveResidualsAndParametersFromEachIteration_;
 
@@ -758,6 +853,17 @@ public:
 
     bool applyFinalParameterCorrection_;
 
+    //! Start times of the arcs for which arc-local parameters are eliminated (empty if full normal equations are solved)
+    std::vector< double > arcStartTimesForReducedNormalEquations_;
+
+    //! Tile size with which the normal equations are solved (0 if dense normal equations are solved)
+    int tileSizeForTiledNormalEquations_;
+
+    //! Name of the file in which the tiled normal matrix is stored (empty if stored in memory)
+    std::string storageFileForTiledNormalEquations_;
+
+    //! Number of threads over which the tiled normal matrix operations are distributed
+    int numberOfThreadsForTiledNormalEquations_;
 
 };
 
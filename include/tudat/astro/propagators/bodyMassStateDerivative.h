@@ -209,6 +209,12 @@ public:
         currentCartesianLocalSoluton = internalSolution;
     }
 
+    //! Function to return whether the conventional form of the state is identical to the propagated form (true for this class).
+    bool isOutputSolutionEqualToPropagatedSolution( )
+    {
+        return true;
+    }
+
     //! Function to get the total size of the state of propagated masses.
     /*!
      * Function to get the total size of the state of propagated masses. Equal to number of bodies for which the mass
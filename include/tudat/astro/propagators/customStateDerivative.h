@@ -92,6 +92,12 @@ public:
         currentLocalSolution = internalSolution;
     }
 
+    //! Function to return whether the conventional form of the state is identical to the propagated form (true for this class).
+    bool isOutputSolutionEqualToPropagatedSolution( )
+    {
+        return true;
+    }
+
     //! Function to get the total size of the state of propagated masses.
     /*!
      * Function to get the total size of the state of propagated masses.
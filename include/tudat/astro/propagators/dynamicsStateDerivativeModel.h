@@ -74,6 +74,7 @@ public:
         std::vector< IntegratedStateType > stateTypeList;
         totalConventionalStateSize_ = 0;
         totalPropagatedStateSize_ = 0;
+        outputSolutionIsEqualToPropagatedSolution_ = true;
 
         // Iterate over vector of state derivative models, check validity, set member variable map
         // stateDerivativeModels_ and size indices.
@@ -124,6 +125,13 @@ public:
             // Set current model in member map.
             stateDerivativeModels_[ stateDerivativeModels.at( i )->getIntegratedStateType( ) ].push_back(
                         stateDerivativeModels.at( i ) );
+            propagatedStateSegments_[ stateDerivativeModels.at( i )->getIntegratedStateType( ) ].push_back(
+                        Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >::Zero(
+                            stateDerivativeModels.at( i )->getPropagatedStateSize( ), 1 ) );
+            if( !stateDerivativeModels.at( i )->isOutputSolutionEqualToPropagatedSolution( ) )
+            {
+                outputSolutionIsEqualToPropagatedSolution_ = false;
+            }
 
             currentStatesPerTypeInConventionalRepresentation_[ stateDerivativeModels.at( i )->getIntegratedStateType( )  ] =
                     Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero(
@@ -322,34 +330,68 @@ public:
     {
         Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > outputState =
                 Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero( totalConventionalStateSize_, 1 );
+        convertToOutputSolution( internalSolution, time, outputState );
+        return outputState;
+    }
 
-        // Iterate over all state derivative models and convert associated state entries
-        std::vector< std::pair< int, int > > currentConventionalStateIndices;
-        std::vector< std::pair< int, int > > currentPropagatedStateIndices;
+    //! Function to convert the propagator-specific form of the state to the conventional form, in place.
+    /*!
+     * Function to convert the propagator-specific form of the state to the conventional form, writing the result
+     * directly into an existing vector. No memory is allocated if outputState already has the size of the
+     * conventional state.
+     * \sa DynamicsStateDerivativeModel::convertToOutputSolution
+     * \param internalSolution State in propagator-specific form (i.e. form that is used in numerical integration).
+     * \param time Current time at which the state is valid.
+     * \param outputState State (internalSolution), converted to the 'conventional form' (returned by reference).
+     */
+    void convertToOutputSolution(
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& internalSolution,
+            const TimeType& time,
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& outputState )
+    {
+        if( outputState.rows( ) != totalConventionalStateSize_ )
+        {
+            outputState.setZero( totalConventionalStateSize_, 1 );
+        }
+
+        if( outputSolutionIsEqualToPropagatedSolution_ )
+        {
+            outputState = internalSolution;
+            return;
+        }
+
+        // Iterate over all state derivative models and convert associated state entries, using the pre-allocated
+        // propagated state segments as input (to prevent creating temporary matrices for each model)
         for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
              stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
              stateDerivativeModelsIterator_++ )
         {
-            currentConventionalStateIndices = conventionalStateIndices_.at( stateDerivativeModelsIterator_->first );
-            currentPropagatedStateIndices = propagatedStateIndices_.at( stateDerivativeModelsIterator_->first );
+            const std::vector< std::pair< int, int > >& currentConventionalStateIndices =
+                    conventionalStateIndices_.at( stateDerivativeModelsIterator_->first );
+            const std::vector< std::pair< int, int > >& currentPropagatedStateIndices =
+                    propagatedStateIndices_.at( stateDerivativeModelsIterator_->first );
+            std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >& currentPropagatedStateSegments =
+                    propagatedStateSegments_.at( stateDerivativeModelsIterator_->first );
             for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
             {
+                currentPropagatedStateSegments.at( i ) = internalSolution.segment(
+                            currentPropagatedStateIndices.at( i ).first,
+                            currentPropagatedStateIndices.at( i ).second );
                 stateDerivativeModelsIterator_->second.at( i )->convertToOutputSolution(
-                            internalSolution.segment(
-                                currentPropagatedStateIndices.at( i ).first,
-                                currentPropagatedStateIndices.at( i ).second ), time,
+                            currentPropagatedStateSegments.at( i ), time,
                             outputState.block( currentConventionalStateIndices.at( i ).first, 0,
                                                currentConventionalStateIndices.at( i ).second, 1 ) );
             }
         }
-
-        return outputState;
     }
 
     //! Function to convert a state history from propagator-specific form to the conventional form.
     /*!
      * Function to convert a state history from propagator-specific form to the conventional form
-     * (not necessarily in inertial frame).
+     * (not necessarily in inertial frame). Since the raw solution is sorted by time, each converted state is inserted
+     * at the end of the output map (constant-time insertion), after which the conversion is performed directly in the
+     * map entry, without intermediate vectors. If the conventional and propagated forms are identical for all
+     * state types, the raw solution is copied directly.
      * \sa DynamicsStateDerivativeModel::convertToOutputSolution
      * \param convertedSolution State history (rawSolution), converted to the 'conventional form' (by reference)
      * \param rawSolution State history in propagator-specific form (i.e. form that is used in
@@ -359,18 +401,38 @@ public:
             std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& convertedSolution,
             const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& rawSolution )
     {
+        if( outputSolutionIsEqualToPropagatedSolution_ && convertedSolution.size( ) == 0 )
+        {
+            convertedSolution = rawSolution;
+            return;
+        }
+
         // Iterate over all times.
+        typename std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >::iterator
+                convertedStateIterator = convertedSolution.end( );
         for( typename std::map< TimeType, Eigen::Matrix< StateScalarType,
              Eigen::Dynamic, 1 > >::const_iterator
              stateIterator = rawSolution.begin( ); stateIterator != rawSolution.end( ); stateIterator++ )
         {
             // Convert solution at this time to output (Cartesian with propagation origin frame for
             // translational dynamics) solution
-            convertedSolution[ stateIterator->first ] =
-                    convertToOutputSolution( stateIterator->second, stateIterator->first );
+            convertedStateIterator = convertedSolution.emplace_hint(
+                        convertedSolution.end( ), stateIterator->first, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >( ) );
+            convertToOutputSolution( stateIterator->second, stateIterator->first, convertedStateIterator->second );
         }
     }
 
+    //! Function to check whether the conventional form of the full state is identical to the propagated form.
+    /*!
+     * Function to check whether the conventional form of the full state is identical to the propagated form (i.e. all
+     * state derivative models use a propagator for which no conversion is needed, such as Cowell).
+     * \return True if the conventional form of the full state is identical to the propagated form.
+     */
+    bool isOutputSolutionEqualToPropagatedSolution( )
+    {
+        return outputSolutionIsEqualToPropagatedSolution_;
+    }
+
     //! Function to process the state vector during propagation.
     /*!
      * Function to process the state vector during propagation.
@@ -708,6 +770,13 @@ private:
     //! Total length of propagated state vector.
     int totalPropagatedStateSize_;
 
+    //! Boolean denoting whether the conventional form of the full state is identical to the propagated form.
+    bool outputSolutionIsEqualToPropagatedSolution_;
+
+    //! Pre-allocated propagated states per state derivative model, used as input when converting to conventional form.
+    std::map< IntegratedStateType, std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > >
+    propagatedStateSegments_;
+
     //! List of states that are not propagated in current numerical integration, i.e, for which
     //! current state is taken from the environment.
     std::vector< IntegratedStateType > integratedStatesFromEnvironment_;
@@ -101,6 +101,12 @@ public:
         currentCartesianLocalSoluton = internalSolution;
     }
 
+    //! Function to return whether the conventional form of the state is identical to the propagated form (true for this class).
+    bool isOutputSolutionEqualToPropagatedSolution( )
+    {
+        return true;
+    }
+
 };
 
 extern template class NBodyCowellStateDerivative< double, double >;
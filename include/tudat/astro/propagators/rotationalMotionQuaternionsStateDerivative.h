@@ -155,6 +155,12 @@ public:
         currentLocalSolution = internalSolution;
     }
 
+    //! Function to return whether the conventional form of the state is identical to the propagated form (true for this class).
+    bool isOutputSolutionEqualToPropagatedSolution( )
+    {
+        return true;
+    }
+
     //! Function to process the state during propagation.
     /*!
      * Function to process the state during propagation. For quaternions, this function normalizes the quaternion vector
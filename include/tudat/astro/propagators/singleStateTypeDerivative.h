@@ -233,6 +233,17 @@ public:
         return false;
     }
 
+    // Function to return whether the conventional form of the state is identical to the propagated form.
+    /*
+     * Function to return whether the conventional form of the state is identical to the propagated form, in which case
+     * the convertToOutputSolution function is a direct copy. Default value is false.
+     * \return Boolean informing whether the conventional and propagated form of the state are identical.
+     */
+    virtual bool isOutputSolutionEqualToPropagatedSolution( )
+    {
+        return false;
+    }
+
 protected:
 
     // Type of dynamics for which the state derivative is calculated.
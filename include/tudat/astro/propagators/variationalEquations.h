@@ -141,21 +141,54 @@ public:
     {
         setBodyStatePartialMatrix( );
 
-        // Add partials of body positions and velocities.
-        currentMatrixDerivative.block( 0, 0, totalDynamicalStateSize_, numberOfParameterValues_ ) =
-                ( variationalMatrix_.template cast< StateScalarType >( ) * stateTransitionAndSensitivityMatrices );
+        if( propagatedColumnBlocks_.size( ) == 0 )
+        {
+            // Add partials of body positions and velocities.
+            currentMatrixDerivative.block( 0, 0, totalDynamicalStateSize_, numberOfParameterValues_ ) =
+                    ( variationalMatrix_.template cast< StateScalarType >( ) * stateTransitionAndSensitivityMatrices );
 
-        if( couplingEntriesToSuppress_ > 0 )
+            if( couplingEntriesToSuppress_ > 0 )
+            {
+                int numberOfStaticParameters = numberOfParameterValues_ - totalDynamicalStateSize_;
+                int numberOfUncoupledEntries = totalDynamicalStateSize_ - couplingEntriesToSuppress_;
+
+                currentMatrixDerivative.block( couplingEntriesToSuppress_, totalDynamicalStateSize_, numberOfUncoupledEntries, numberOfStaticParameters ) =
+                        variationalMatrix_.template cast< StateScalarType >( ).block(
+                            couplingEntriesToSuppress_, couplingEntriesToSuppress_,
+                            numberOfUncoupledEntries, numberOfUncoupledEntries ) *
+                        stateTransitionAndSensitivityMatrices.block(
+                            couplingEntriesToSuppress_, totalDynamicalStateSize_, numberOfUncoupledEntries, numberOfStaticParameters );
+            }
+        }
+        else
         {
-            int numberOfStaticParameters = numberOfParameterValues_ - totalDynamicalStateSize_;
-            int numberOfUncoupledEntries = totalDynamicalStateSize_ - couplingEntriesToSuppress_;
-
-            currentMatrixDerivative.block( couplingEntriesToSuppress_, totalDynamicalStateSize_, numberOfUncoupledEntries, numberOfStaticParameters ) =
-                    variationalMatrix_.template cast< StateScalarType >( ).block(
-                        couplingEntriesToSuppress_, couplingEntriesToSuppress_,
-                        numberOfUncoupledEntries, numberOfUncoupledEntries ) *
-                    stateTransitionAndSensitivityMatrices.block(
-                        couplingEntriesToSuppress_, totalDynamicalStateSize_, numberOfUncoupledEntries, numberOfStaticParameters );
+            // Set derivatives of columns that are not propagated to zero
+            for( unsigned int i = 0; i < unpropagatedColumnBlocks_.size( ); i++ )
+            {
+                currentMatrixDerivative.block( 0, unpropagatedColumnBlocks_.at( i ).first, totalDynamicalStateSize_,
+                                               unpropagatedColumnBlocks_.at( i ).second ).setZero( );
+            }
+
+            // Add partials of body positions and velocities, for propagated columns only
+            for( unsigned int i = 0; i < propagatedColumnBlocks_.size( ); i++ )
+            {
+                int startColumn = propagatedColumnBlocks_.at( i ).first;
+                int numberOfColumns = propagatedColumnBlocks_.at( i ).second;
+                currentMatrixDerivative.block( 0, startColumn, totalDynamicalStateSize_, numberOfColumns ) =
+                        variationalMatrix_.template cast< StateScalarType >( ) *
+                        stateTransitionAndSensitivityMatrices.block( 0, startColumn, totalDynamicalStateSize_, numberOfColumns );
+
+                if( couplingEntriesToSuppress_ > 0 && startColumn >= totalDynamicalStateSize_ )
+                {
+                    int numberOfUncoupledEntries = totalDynamicalStateSize_ - couplingEntriesToSuppress_;
+                    currentMatrixDerivative.block( couplingEntriesToSuppress_, startColumn, numberOfUncoupledEntries, numberOfColumns ) =
+                            variationalMatrix_.template cast< StateScalarType >( ).block(
+                                couplingEntriesToSuppress_, couplingEntriesToSuppress_,
+                                numberOfUncoupledEntries, numberOfUncoupledEntries ) *
+                            stateTransitionAndSensitivityMatrices.block(
+                                couplingEntriesToSuppress_, startColumn, numberOfUncoupledEntries, numberOfColumns );
+                }
+            }
         }
     }
 
@@ -190,6 +223,13 @@ public:
                      functionIterator != typeIterator->second[ i ].end( );
                      functionIterator++ )
                 {
+                    // Skip partials w.r.t. parameters of which no column is propagated
+                    if( propagatedColumnBlocks_.size( ) > 0 &&
+                            !isAnyColumnPropagated( functionIterator->first.first, functionIterator->first.second ) )
+                    {
+                        continue;
+                    }
+
                     functionIterator->second(
                                 variationalParameterMatrix_.block(
                                     startIndex + entriesToSkipPerEntry + currentStateSize * i,
@@ -210,13 +250,27 @@ public:
                         numberOfParameterValues_ - totalDynamicalStateSize_ ).eval( );
         }
 
-        currentMatrixDerivative.block( 0, totalDynamicalStateSize_, totalDynamicalStateSize_,
-                                       numberOfParameterValues_ - totalDynamicalStateSize_ ) +=
-                variationalParameterMatrix_.template cast< StateScalarType >( );
-
-
-
-
+        if( propagatedColumnBlocks_.size( ) == 0 )
+        {
+            currentMatrixDerivative.block( 0, totalDynamicalStateSize_, totalDynamicalStateSize_,
+                                           numberOfParameterValues_ - totalDynamicalStateSize_ ) +=
+                    variationalParameterMatrix_.template cast< StateScalarType >( );
+        }
+        else
+        {
+            for( unsigned int i = 0; i < propagatedColumnBlocks_.size( ); i++ )
+            {
+                int startColumn = propagatedColumnBlocks_.at( i ).first;
+                int numberOfColumns = propagatedColumnBlocks_.at( i ).second;
+                if( startColumn >= totalDynamicalStateSize_ )
+                {
+                    currentMatrixDerivative.block( 0, startColumn, totalDynamicalStateSize_, numberOfColumns ) +=
+                            variationalParameterMatrix_.block(
+                                0, startColumn - totalDynamicalStateSize_, totalDynamicalStateSize_, numberOfColumns ).
+                            template cast< StateScalarType >( );
+                }
+            }
+        }
     }
     
     //! Evaluates the complete variational equations.
@@ -323,6 +377,23 @@ public:
         couplingEntriesToSuppress_ = couplingEntriesToSuppress;
     }
 
+    //! Function to set the columns of the state transition and sensitivity matrix that are to be propagated
+    /*!
+     *  Function to set the columns of the combined state transition and sensitivity matrix that are to be propagated. The
+     *  derivatives of all other columns are set to zero, so that these columns retain their initial value (unit vector for
+     *  state transition matrix columns, zero for sensitivity matrix columns). Partials w.r.t. parameters of which none of
+     *  the columns are propagated are not evaluated. This is useful when only a subset of the columns is required, for
+     *  instance when propagating only the sensitivity to consider parameters.
+     *  \param propagatedColumns Indices of columns that are to be propagated (all columns are propagated if empty)
+     */
+    void setPropagatedColumns( const std::vector< int >& propagatedColumns );
+
+    //! Function to retrieve the list of propagated column blocks (start column and number of columns; empty if all are propagated)
+    std::vector< std::pair< int, int > > getPropagatedColumnBlocks( )
+    {
+        return propagatedColumnBlocks_;
+    }
+
 protected:
     
 private:
@@ -334,6 +405,15 @@ private:
      */
     void setStatePartialFunctionList( );
 
+    //! Function to check whether any of the columns in a given range is propagated
+    /*!
+     *  Function to check whether any of the columns in a given range is propagated
+     *  \param startColumn First column in range
+     *  \param numberOfColumns Number of columns in range
+     *  \return True if any of the columns in the range is propagated
+     */
+    bool isAnyColumnPropagated( const int startColumn, const int numberOfColumns );
+
     //! Function to add parameter partial functions for single state derivative model, and set of parameter objects.
     /*!
      *  Function to add parameter partial functions for single state derivative model, and set of parameter objects.
@@ -635,6 +715,15 @@ private:
 
     int couplingEntriesToSuppress_;
 
+    //! Blocks of columns (start column, number of columns) of variational equations that are propagated (empty if all are)
+    std::vector< std::pair< int, int > > propagatedColumnBlocks_;
+
+    //! Blocks of columns (start column, number of columns) of variational equations that are not propagated
+    std::vector< std::pair< int, int > > unpropagatedColumnBlocks_;
+
+    //! Boolean per column of variational equations denoting whether it is propagated (empty if all are)
+    std::vector< bool > isColumnPropagated_;
+
     //! Total matrix of partial derivatives of state derivatives w.r.t. current states.
     Eigen::MatrixXd variationalMatrix_;
 
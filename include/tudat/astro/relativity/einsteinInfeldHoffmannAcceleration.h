@@ -0,0 +1,440 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *      Moyer, T.D., Formulation for Observed and Computed Values of Deep Space Network Data Types for Navigation,
+ *          JPL Deep Space Communications and Navigation Series, 2000.
+ *      Urban, S.E., and Seidelmann, P.K., Explanatory Supplement to the Astronomical Almanac, 3rd ed., 2012.
+ */
+
+#ifndef TUDAT_EINSTEININFELDHOFFMANNACCELERATION_H
+#define TUDAT_EINSTEININFELDHOFFMANNACCELERATION_H
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/basic_astro/accelerationModel.h"
+#include "tudat/basics/basicTypedefs.h"
+
+namespace tudat
+{
+
+namespace relativity
+{
+
+//! Class to compute the Einstein-Infeld-Hoffmann (EIH) equations of motion for a set of mutually attracting point masses.
+/*!
+ *  Class to compute the Einstein-Infeld-Hoffmann (EIH) equations of motion, i.e. the Newtonian point-mass accelerations
+ *  and the full first post-Newtonian (1PN) corrections in the PPN formalism (Moyer, 2000; Urban and Seidelmann, 2012), for a
+ *  set of mutually attracting point masses. The acceleration of each body is computed as a sum of contributions of all
+ *  other bodies (each of which depends on the states of all bodies through the potentials and Newtonian accelerations
+ *  appearing in the 1PN terms). All pairwise relative states and distances are computed once per update, for all bodies
+ *  together, and shared by all the accelerations. The partial derivatives of each contribution w.r.t. the states and
+ *  gravitational parameters of all bodies, and w.r.t. the PPN parameters, are computed (separately from the accelerations)
+ *  by the updatePartials function. The accelerations are computed in the frame in which the body states are given, which
+ *  should be (quasi-)inertial.
+ */
+class EinsteinInfeldHoffmannEquations
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param bodyNames Names of the bodies in the set of mutually attracting bodies
+     * \param gravitationalParameterFunctions Functions returning the gravitational parameters of the bodies (in same
+     * order as bodyNames)
+     * \param stateFunctions Functions returning the Cartesian states of the bodies (in same order as bodyNames)
+     * \param ppnParameterGammaFunction Function returning the PPN parameter gamma (default 1)
+     * \param ppnParameterBetaFunction Function returning the PPN parameter beta (default 1)
+     */
+    EinsteinInfeldHoffmannEquations(
+            const std::vector< std::string >& bodyNames,
+            const std::vector< std::function< double( ) > >& gravitationalParameterFunctions,
+            const std::vector< std::function< Eigen::Vector6d( ) > >& stateFunctions,
+            const std::function< double( ) > ppnParameterGammaFunction = [ ]( ){ return 1.0; },
+            const std::function< double( ) > ppnParameterBetaFunction = [ ]( ){ return 1.0; } );
+
+    //! Destructor
+    ~EinsteinInfeldHoffmannEquations( ){ }
+
+    //! Function to update the accelerations of all bodies to the current time
+    /*!
+     * Function to update the accelerations of all bodies to the current time. The states and gravitational parameters of
+     * all bodies are retrieved, after which all pairwise distances, the Newtonian accelerations and potentials, and the
+     * 1PN accelerations are computed. The computation is only performed if the time differs from that of the last update,
+     * or if resetCurrentTime has been called since.
+     * \param currentTime Time at which the accelerations are to be computed.
+     */
+    void update( const double currentTime );
+
+    //! Function to update the partial derivatives of the accelerations to the current time
+    /*!
+     * Function to update the partial derivatives of the accelerations (of each contribution to the acceleration of each
+     * body) w.r.t. the states and gravitational parameters of all bodies, and w.r.t. the PPN parameters gamma and beta.
+     * The accelerations are updated first (if needed). The computation is only performed if the time differs from that of
+     * the last update, or if resetCurrentTime or resetCurrentPartialsTime has been called since.
+     * \param currentTime Time at which the partials are to be computed.
+     */
+    void updatePartials( const double currentTime );
+
+    //! Function to reset the current time of the accelerations and partials, so that they are recomputed at next update
+    void resetCurrentTime( )
+    {
+        currentTime_ = TUDAT_NAN;
+        currentPartialsTime_ = TUDAT_NAN;
+    }
+
+    //! Function to reset the current time of the partials, so that they are recomputed at next update
+    void resetCurrentPartialsTime( )
+    {
+        currentPartialsTime_ = TUDAT_NAN;
+    }
+
+    //! Function to retrieve the index of a body in the list of bodies
+    /*!
+     * Function to retrieve the index of a body in the list of bodies, throws an error if the body is not found
+     * \param bodyName Name of body
+     * \return Index of body in the list of bodies
+     */
+    int getBodyIndex( const std::string& bodyName ) const;
+
+    //! Function to retrieve whether a body is in the list of bodies
+    /*!
+     * Function to retrieve whether a body is in the list of bodies
+     * \param bodyName Name of body
+     * \return True if the body is in the list of bodies
+     */
+    bool isBodyInSet( const std::string& bodyName ) const;
+
+    //! Function to retrieve the names of the bodies in the set of mutually attracting bodies
+    /*!
+     * Function to retrieve the names of the bodies in the set of mutually attracting bodies
+     * \return Names of the bodies in the set of mutually attracting bodies
+     */
+    std::vector< std::string > getBodyNames( ) const
+    {
+        return bodyNames_;
+    }
+
+    //! Function to retrieve the number of bodies in the set of mutually attracting bodies
+    /*!
+     * Function to retrieve the number of bodies in the set of mutually attracting bodies
+     * \return Number of bodies in the set of mutually attracting bodies
+     */
+    int getNumberOfBodies( ) const
+    {
+        return numberOfBodies_;
+    }
+
+    //! Function to retrieve the current contribution of one body to the acceleration of another body
+    /*!
+     * Function to retrieve the current contribution (Newtonian and 1PN terms) of one body to the acceleration of another
+     * body, as computed by the last call to update. The sum of these contributions over all bodies exerting acceleration
+     * is the total EIH acceleration of the body undergoing acceleration.
+     * \param acceleratedBodyIndex Index of body undergoing acceleration
+     * \param acceleratingBodyIndex Index of body exerting acceleration
+     * \return Current contribution of one body to the acceleration of another body
+     */
+    Eigen::Vector3d getAccelerationContribution( const int acceleratedBodyIndex, const int acceleratingBodyIndex ) const
+    {
+        return accelerationContributions_.at( acceleratedBodyIndex * numberOfBodies_ + acceleratingBodyIndex );
+    }
+
+    //! Function to retrieve the current total EIH acceleration of a body
+    /*!
+     * Function to retrieve the current total EIH acceleration of a body, as computed by the last call to update
+     * \param bodyIndex Index of body undergoing acceleration
+     * \return Current total EIH acceleration of the body
+     */
+    Eigen::Vector3d getTotalAcceleration( const int bodyIndex ) const
+    {
+        return totalAccelerations_.col( bodyIndex );
+    }
+
+    //! Function to retrieve the current Newtonian acceleration of a body due to all other bodies
+    /*!
+     * Function to retrieve the current Newtonian acceleration of a body due to all other bodies, as computed by the last
+     * call to update
+     * \param bodyIndex Index of body undergoing acceleration
+     * \return Current Newtonian acceleration of the body
+     */
+    Eigen::Vector3d getNewtonianAcceleration( const int bodyIndex ) const
+    {
+        return newtonianAccelerations_.col( bodyIndex );
+    }
+
+    //! Function to retrieve the partial of a contribution to an acceleration w.r.t. the positions of all bodies
+    /*!
+     * Function to retrieve the partial of a contribution to an acceleration w.r.t. the positions of all bodies, as computed
+     * by the last call to updatePartials
+     * \param acceleratedBodyIndex Index of body undergoing acceleration
+     * \param acceleratingBodyIndex Index of body exerting acceleration
+     * \return Partial derivative (3 x 3N matrix, with column block k the partial w.r.t. the position of body k)
+     */
+    const Eigen::Matrix3Xd& getPartialWrtPositions( const int acceleratedBodyIndex, const int acceleratingBodyIndex ) const
+    {
+        return partialsWrtPositions_.at( acceleratedBodyIndex * numberOfBodies_ + acceleratingBodyIndex );
+    }
+
+    //! Function to retrieve the partial of a contribution to an acceleration w.r.t. the velocities of all bodies
+    /*!
+     * Function to retrieve the partial of a contribution to an acceleration w.r.t. the velocities of all bodies, as
+     * computed by the last call to updatePartials (only the blocks of the bodies undergoing and exerting acceleration are
+     * non-zero).
+     * \param acceleratedBodyIndex Index of body undergoing acceleration
+     * \param acceleratingBodyIndex Index of body exerting acceleration
+     * \return Partial derivative (3 x 3N matrix, with column block k the partial w.r.t. the velocity of body k)
+     */
+    const Eigen::Matrix3Xd& getPartialWrtVelocities( const int acceleratedBodyIndex, const int acceleratingBodyIndex ) const
+    {
+        return partialsWrtVelocities_.at( acceleratedBodyIndex * numberOfBodies_ + acceleratingBodyIndex );
+    }
+
+    //! Function to retrieve the partial of a contribution to an acceleration w.r.t. the gravitational parameters
+    /*!
+     * Function to retrieve the partial of a contribution to an acceleration w.r.t. the gravitational parameters of all
+     * bodies, as computed by the last call to updatePartials
+     * \param acceleratedBodyIndex Index of body undergoing acceleration
+     * \param acceleratingBodyIndex Index of body exerting acceleration
+     * \return Partial derivative (3 x N matrix, with column k the partial w.r.t. the gravitational parameter of body k)
+     */
+    const Eigen::Matrix3Xd& getPartialWrtGravitationalParameters(
+            const int acceleratedBodyIndex, const int acceleratingBodyIndex ) const
+    {
+        return partialsWrtGravitationalParameters_.at( acceleratedBodyIndex * numberOfBodies_ + acceleratingBodyIndex );
+    }
+
+    //! Function to retrieve the partial of a contribution to an acceleration w.r.t. the PPN parameter gamma
+    /*!
+     * Function to retrieve the partial of a contribution to an acceleration w.r.t. the PPN parameter gamma, as computed
+     * by the last call to updatePartials
+     * \param acceleratedBodyIndex Index of body undergoing acceleration
+     * \param acceleratingBodyIndex Index of body exerting acceleration
+     * \return Partial derivative w.r.t. the PPN parameter gamma
+     */
+    Eigen::Vector3d getPartialWrtPpnParameterGamma( const int acceleratedBodyIndex, const int acceleratingBodyIndex ) const
+    {
+        return partialsWrtPpnParameterGamma_.at( acceleratedBodyIndex * numberOfBodies_ + acceleratingBodyIndex );
+    }
+
+    //! Function to retrieve the partial of a contribution to an acceleration w.r.t. the PPN parameter beta
+    /*!
+     * Function to retrieve the partial of a contribution to an acceleration w.r.t. the PPN parameter beta, as computed
+     * by the last call to updatePartials
+     * \param acceleratedBodyIndex Index of body undergoing acceleration
+     * \param acceleratingBodyIndex Index of body exerting acceleration
+     * \return Partial derivative w.r.t. the PPN parameter beta
+     */
+    Eigen::Vector3d getPartialWrtPpnParameterBeta( const int acceleratedBodyIndex, const int acceleratingBodyIndex ) const
+    {
+        return partialsWrtPpnParameterBeta_.at( acceleratedBodyIndex * numberOfBodies_ + acceleratingBodyIndex );
+    }
+
+private:
+
+    //! Function to retrieve the index of a pair of bodies in the lists of pairwise quantities
+    int getPairIndex( const int acceleratedBodyIndex, const int acceleratingBodyIndex ) const
+    {
+        return acceleratedBodyIndex * numberOfBodies_ + acceleratingBodyIndex;
+    }
+
+    //! Names of the bodies in the set of mutually attracting bodies
+    std::vector< std::string > bodyNames_;
+
+    //! Functions returning the gravitational parameters of the bodies
+    std::vector< std::function< double( ) > > gravitationalParameterFunctions_;
+
+    //! Functions returning the Cartesian states of the bodies
+    std::vector< std::function< Eigen::Vector6d( ) > > stateFunctions_;
+
+    //! Function returning the PPN parameter gamma
+    std::function< double( ) > ppnParameterGammaFunction_;
+
+    //! Function returning the PPN parameter beta
+    std::function< double( ) > ppnParameterBetaFunction_;
+
+    //! Number of bodies in the set of mutually attracting bodies
+    int numberOfBodies_;
+
+    //! Time of the last update of the accelerations
+    double currentTime_;
+
+    //! Time of the last update of the partials
+    double currentPartialsTime_;
+
+    //! Current PPN parameter gamma
+    double ppnParameterGamma_;
+
+    //! Current PPN parameter beta
+    double ppnParameterBeta_;
+
+    //! Current gravitational parameters of all bodies
+    Eigen::VectorXd gravitationalParameters_;
+
+    //! Current positions of all bodies (one column per body)
+    Eigen::Matrix3Xd positions_;
+
+    //! Current velocities of all bodies (one column per body)
+    Eigen::Matrix3Xd velocities_;
+
+    //! Current position of body j w.r.t. body i, for each pair (i,j) (entry i*N+j)
+    std::vector< Eigen::Vector3d > relativePositions_;
+
+    //! Current distances between all bodies
+    Eigen::MatrixXd distances_;
+
+    //! Current inverse cubed distances between all bodies
+    Eigen::MatrixXd inverseCubedDistances_;
+
+    //! Current Newtonian gravitational potentials (positive) at all bodies, due to all other bodies
+    Eigen::VectorXd newtonianPotentials_;
+
+    //! Current Newtonian accelerations of all bodies, due to all other bodies (one column per body)
+    Eigen::Matrix3Xd newtonianAccelerations_;
+
+    //! Current scalar 1PN factors multiplying the Newtonian contribution of body j to the acceleration of body i
+    Eigen::MatrixXd scalarCorrectionFactors_;
+
+    //! Current contribution of body j to the acceleration of body i, for each pair (i,j) (entry i*N+j)
+    std::vector< Eigen::Vector3d > accelerationContributions_;
+
+    //! Current total EIH accelerations of all bodies (one column per body)
+    Eigen::Matrix3Xd totalAccelerations_;
+
+    //! Current partials of acceleration contributions w.r.t. positions of all bodies (entry i*N+j)
+    std::vector< Eigen::Matrix3Xd > partialsWrtPositions_;
+
+    //! Current partials of acceleration contributions w.r.t. velocities of all bodies (entry i*N+j)
+    std::vector< Eigen::Matrix3Xd > partialsWrtVelocities_;
+
+    //! Current partials of acceleration contributions w.r.t. gravitational parameters of all bodies (entry i*N+j)
+    std::vector< Eigen::Matrix3Xd > partialsWrtGravitationalParameters_;
+
+    //! Current partials of acceleration contributions w.r.t. PPN parameter gamma (entry i*N+j)
+    std::vector< Eigen::Vector3d > partialsWrtPpnParameterGamma_;
+
+    //! Current partials of acceleration contributions w.r.t. PPN parameter beta (entry i*N+j)
+    std::vector< Eigen::Vector3d > partialsWrtPpnParameterBeta_;
+};
+
+//! Class for the contribution of a single body to the Einstein-Infeld-Hoffmann acceleration of another body.
+/*!
+ *  Class for the contribution of a single body to the Einstein-Infeld-Hoffmann (EIH) acceleration of another body, computed
+ *  by an EinsteinInfeldHoffmannEquations object that is shared by all EIH accelerations in the set of mutually attracting
+ *  bodies. The contribution includes both the Newtonian point-mass acceleration and the 1PN corrections, so that no separate
+ *  point-mass gravity or relativistic correction acceleration should be used for the same pair of bodies. The shared
+ *  equations are evaluated once per state derivative evaluation (i.e. between two calls to resetCurrentTime).
+ */
+class EinsteinInfeldHoffmannAcceleration: public basic_astrodynamics::AccelerationModel< Eigen::Vector3d >
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eihEquations Object computing the EIH equations for the full set of mutually attracting bodies
+     * \param acceleratedBodyName Name of body undergoing acceleration
+     * \param acceleratingBodyName Name of body exerting acceleration
+     */
+    EinsteinInfeldHoffmannAcceleration(
+            const std::shared_ptr< EinsteinInfeldHoffmannEquations > eihEquations,
+            const std::string& acceleratedBodyName,
+            const std::string& acceleratingBodyName ):
+        AccelerationModel< Eigen::Vector3d >( ),
+        eihEquations_( eihEquations ),
+        acceleratedBodyIndex_( eihEquations->getBodyIndex( acceleratedBodyName ) ),
+        acceleratingBodyIndex_( eihEquations->getBodyIndex( acceleratingBodyName ) )
+    {
+        if( acceleratedBodyIndex_ == acceleratingBodyIndex_ )
+        {
+            throw std::runtime_error( "Error when creating Einstein-Infeld-Hoffmann acceleration, body " +
+                                      acceleratedBodyName + " cannot exert acceleration on itself" );
+        }
+    }
+
+    //! Destructor
+    ~EinsteinInfeldHoffmannAcceleration( ){ }
+
+    //! Update member variables used by the acceleration model.
+    /*!
+     * Updates member variables used by the acceleration model, updating the shared EIH equations if this has not yet
+     * been done for the current state derivative evaluation.
+     * \param currentTime Time at which acceleration model is to be updated.
+     */
+    void updateMembers( const double currentTime = TUDAT_NAN )
+    {
+        if( !( this->currentTime_ == currentTime ) )
+        {
+            eihEquations_->update( currentTime );
+            currentAcceleration_ = eihEquations_->getAccelerationContribution(
+                        acceleratedBodyIndex_, acceleratingBodyIndex_ );
+            this->currentTime_ = currentTime;
+        }
+    }
+
+    //! Function to reset the current time of the acceleration model, and of the shared EIH equations.
+    void resetCurrentTime( )
+    {
+        this->currentTime_ = TUDAT_NAN;
+        eihEquations_->resetCurrentTime( );
+    }
+
+    //! Function to retrieve the object computing the EIH equations for the full set of mutually attracting bodies
+    /*!
+     * Function to retrieve the object computing the EIH equations for the full set of mutually attracting bodies
+     * \return Object computing the EIH equations for the full set of mutually attracting bodies
+     */
+    std::shared_ptr< EinsteinInfeldHoffmannEquations > getEihEquations( )
+    {
+        return eihEquations_;
+    }
+
+    //! Function to retrieve the index of the body undergoing acceleration in the EIH equations
+    /*!
+     * Function to retrieve the index of the body undergoing acceleration in the EIH equations
+     * \return Index of the body undergoing acceleration in the EIH equations
+     */
+    int getAcceleratedBodyIndex( )
+    {
+        return acceleratedBodyIndex_;
+    }
+
+    //! Function to retrieve the index of the body exerting acceleration in the EIH equations
+    /*!
+     * Function to retrieve the index of the body exerting acceleration in the EIH equations
+     * \return Index of the body exerting acceleration in the EIH equations
+     */
+    int getAcceleratingBodyIndex( )
+    {
+        return acceleratingBodyIndex_;
+    }
+
+private:
+
+    //! Object computing the EIH equations for the full set of mutually attracting bodies
+    std::shared_ptr< EinsteinInfeldHoffmannEquations > eihEquations_;
+
+    //! Index of the body undergoing acceleration in the EIH equations
+    int acceleratedBodyIndex_;
+
+    //! Index of the body exerting acceleration in the EIH equations
+    int acceleratingBodyIndex_;
+};
+
+} // namespace relativity
+
+} // namespace tudat
+
+#endif // TUDAT_EINSTEININFELDHOFFMANNACCELERATION_H
@@ -164,6 +164,16 @@ struct is_direct_gravity_partial< acceleration_partials::RingGravityPartial > {
     static const bool value = true;
 };
 
+namespace acceleration_partials
+{
+class MasconGravityPartial;
+}
+
+template< >
+struct is_direct_gravity_partial< acceleration_partials::MasconGravityPartial > {
+    static const bool value = true;
+};
+
 template< typename T >
 struct is_direct_gravity_acceleration {
     static const bool value = false;
@@ -220,6 +230,16 @@ struct is_direct_gravity_acceleration< gravitation::RingGravitationalAcceleratio
     static const bool value = true;
 };
 
+namespace gravitation
+{
+class MasconGravitationalAccelerationModel;
+}
+
+template< >
+struct is_direct_gravity_acceleration< gravitation::MasconGravitationalAccelerationModel > {
+    static const bool value = true;
+};
+
 template< typename VariableType, typename std::enable_if< is_eigen_matrix< VariableType >::value, int >::type = 0 >
 static int getEigenCompileTimeNumberORows( )
 {
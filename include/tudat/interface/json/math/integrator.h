@@ -30,10 +30,12 @@ static std::map< AvailableIntegrators, std::string > integratorTypes =
     { rungeKuttaVariableStepSize, "rungeKuttaVariableStepSize" },
     { adamsBashforthMoulton, "adamsBashforthMoulton" },
     { bulirschStoer, "bulirschStoer" },
+    { shampineGordon, "shampineGordon" },
+    { bulirschStoerVariableOrder, "bulirschStoerVariableOrder" },
 };
 
 //! `AvailableIntegrators` not supported by `json_interface`.
-static std::vector< AvailableIntegrators > unsupportedIntegratorTypes = { };
+static std::vector< AvailableIntegrators > unsupportedIntegratorTypes = { shampineGordon, bulirschStoerVariableOrder };
 
 //! Convert `AvailableIntegrators` to `json`.
 inline void to_json( nlohmann::json& jsonObject, const AvailableIntegrators& availableIntegrator )
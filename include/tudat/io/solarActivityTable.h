@@ -0,0 +1,328 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Data file:
+ *                        http://celestrak.com/SpaceData/sw19571001.txt
+ *      Data format explanation:
+ *                        http://celestrak.com/SpaceData/SpaceWx-format.asp
+ *
+ */
+
+#ifndef TUDAT_SOLAR_ACTIVITY_TABLE_H
+#define TUDAT_SOLAR_ACTIVITY_TABLE_H
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tudat/astro/basic_astro/timeConversions.h"
+#include "tudat/io/solarActivityData.h"
+
+namespace tudat
+{
+namespace input_output
+{
+namespace solar_activity
+{
+
+//! Columnar table of daily solar activity data.
+/*!
+ * Class storing the contents of a space weather file (see http://celestrak.com/SpaceData/SpaceWx-format.asp) as contiguous
+ * arrays per variable, indexed by the number of days since the first day in the table. Days for which the file contains no
+ * entry (for instance between the monthly predicted values) are filled with the data of the most recent preceding day
+ * that is in the file, so that the data for any day in the table is retrieved in constant time. The 3-hourly planetary
+ * range (Kp) and equivalent amplitude (Ap) indices are stored as eight consecutive entries per day.
+ */
+class SolarActivityTable
+{
+public:
+
+    //! Number of 3-hourly geomagnetic indices per day.
+    static const int NUMBER_OF_INDICES_PER_DAY = 8;
+
+    //! Default constructor, creating an empty table.
+    SolarActivityTable( ): firstJulianDayNumber_( 0 ) { }
+
+    //! Constructor from map of solar activity data, as produced by readSolarActivityData.
+    /*!
+     * Constructor from map of solar activity data, as produced by readSolarActivityData.
+     * \param solarActivityDataMap Map of solar activity data, with the Julian day at midnight of each entry as key.
+     */
+    SolarActivityTable( const SolarActivityDataMap& solarActivityDataMap );
+
+    //! Function to add the data of a single day to the table.
+    /*!
+     * Function to add the data of a single day to the table. If there is a gap between the last day in the table and the new
+     * day, the days in between are filled with the data of the last day in the table. If the day is already in the table,
+     * its data (and that of the filled days following it) is overwritten, consistent with inserting into a
+     * SolarActivityDataMap. Days before the first day in the table can not be added.
+     * \param solarActivityData Data of the new day (date is taken from the year, month and day members).
+     */
+    void addDay( const SolarActivityData& solarActivityData );
+
+    //! Function to retrieve the number of days in the table.
+    int getNumberOfDays( ) const
+    {
+        return static_cast< int >( years_.size( ) );
+    }
+
+    //! Function to retrieve the Julian day at midnight of the first day in the table.
+    double getFirstJulianDay( ) const
+    {
+        return static_cast< double >( firstJulianDayNumber_ ) - 0.5;
+    }
+
+    //! Function to retrieve the Julian day at midnight of the last day in the table.
+    double getLastJulianDay( ) const
+    {
+        return getFirstJulianDay( ) + static_cast< double >( getNumberOfDays( ) - 1 );
+    }
+
+    //! Function to retrieve the index of the day containing a given Julian date.
+    /*!
+     * Function to retrieve the index (number of days since the first day in the table) of the day containing a given Julian
+     * date. An exception is thrown if the date is outside of the table.
+     * \param julianDate Julian date for which the day index is to be retrieved.
+     * \return Index of day containing the requested date.
+     */
+    int getDayIndex( const double julianDate ) const
+    {
+        const double dayIndex = std::floor( julianDate - getFirstJulianDay( ) );
+        if( !( dayIndex >= 0.0 && dayIndex < static_cast< double >( getNumberOfDays( ) ) ) )
+        {
+            throw std::runtime_error( "Error when retrieving solar activity data at JD " + std::to_string( julianDate ) +
+                                      ", data is available from JD " + std::to_string( getFirstJulianDay( ) ) + " to " +
+                                      std::to_string( getLastJulianDay( ) + 1.0 ) );
+        }
+        return static_cast< int >( dayIndex );
+    }
+
+    //! Function to retrieve the index of the day containing a given time.
+    /*!
+     * Function to retrieve the index (number of days since the first day in the table) of the day containing a given time.
+     * \param time Time (in seconds since J2000) for which the day index is to be retrieved.
+     * \return Index of day containing the requested time.
+     */
+    int getDayIndexAtTime( const double time ) const
+    {
+        return getDayIndex( basic_astrodynamics::convertSecondsSinceEpochToJulianDay(
+                                time, basic_astrodynamics::JULIAN_DAY_ON_J2000 ) );
+    }
+
+    //! Function to retrieve the Julian day at midnight of the day with the given index.
+    double getJulianDay( const int dayIndex ) const
+    {
+        return getFirstJulianDay( ) + static_cast< double >( dayIndex );
+    }
+
+    //! Function to retrieve the calendar year of the day with the given index.
+    int getYear( const int dayIndex ) const { return years_[ dayIndex ]; }
+
+    //! Function to retrieve the day of the year (1 for January 1st) of the day with the given index.
+    int getDayOfYear( const int dayIndex ) const { return daysOfYear_[ dayIndex ]; }
+
+    //! Function to retrieve whether the file contained an entry for the day with the given index.
+    bool isDayInFile( const int dayIndex ) const { return isDayInFile_[ dayIndex ] != 0; }
+
+    //! Function to retrieve the F10.7 solar radio flux (adjusted to 1 AU) of the day with the given index.
+    double getSolarRadioFlux107Adjusted( const int dayIndex ) const
+    {
+        return solarRadioFlux107Adjusted_[ dayIndex ];
+    }
+
+    //! Function to retrieve the centered 81-day average F10.7 flux (adjusted to 1 AU) of the day with the given index.
+    double getCentered81DaySolarRadioFlux107Adjusted( const int dayIndex ) const
+    {
+        return centered81DaySolarRadioFlux107Adjusted_[ dayIndex ];
+    }
+
+    //! Function to retrieve the last 81-day average F10.7 flux (adjusted to 1 AU) of the day with the given index.
+    double getLast81DaySolarRadioFlux107Adjusted( const int dayIndex ) const
+    {
+        return last81DaySolarRadioFlux107Adjusted_[ dayIndex ];
+    }
+
+    //! Function to retrieve the observed F10.7 solar radio flux of the day with the given index.
+    double getSolarRadioFlux107Observed( const int dayIndex ) const
+    {
+        return solarRadioFlux107Observed_[ dayIndex ];
+    }
+
+    //! Function to retrieve the centered 81-day average observed F10.7 flux of the day with the given index.
+    double getCentered81DaySolarRadioFlux107Observed( const int dayIndex ) const
+    {
+        return centered81DaySolarRadioFlux107Observed_[ dayIndex ];
+    }
+
+    //! Function to retrieve the last 81-day average observed F10.7 flux of the day with the given index.
+    double getLast81DaySolarRadioFlux107Observed( const int dayIndex ) const
+    {
+        return last81DaySolarRadioFlux107Observed_[ dayIndex ];
+    }
+
+    //! Function to retrieve the flux qualifier of the day with the given index (see SolarActivityData::fluxQualifier).
+    unsigned int getFluxQualifier( const int dayIndex ) const { return fluxQualifiers_[ dayIndex ]; }
+
+    //! Function to retrieve the daily average planetary equivalent amplitude (Ap) of the day with the given index.
+    double getPlanetaryEquivalentAmplitudeAverage( const int dayIndex ) const
+    {
+        return planetaryEquivalentAmplitudeAverages_[ dayIndex ];
+    }
+
+    //! Function to retrieve the 3-hourly planetary equivalent amplitudes (Ap) of the day with the given index.
+    /*!
+     * Function to retrieve the 3-hourly planetary equivalent amplitudes (Ap) of the day with the given index.
+     * \param dayIndex Index of the day.
+     * \return Pointer to the first of NUMBER_OF_INDICES_PER_DAY consecutive values (0-3 UT to 21-24 UT).
+     */
+    const double* getPlanetaryEquivalentAmplitudes( const int dayIndex ) const
+    {
+        return planetaryEquivalentAmplitudes_.data( ) + NUMBER_OF_INDICES_PER_DAY * dayIndex;
+    }
+
+    //! Function to retrieve the sum of the 3-hourly planetary range indices (Kp) of the day with the given index.
+    double getPlanetaryRangeIndexSum( const int dayIndex ) const { return planetaryRangeIndexSums_[ dayIndex ]; }
+
+    //! Function to retrieve the 3-hourly planetary range indices (Kp) of the day with the given index.
+    /*!
+     * Function to retrieve the 3-hourly planetary range indices (Kp, expressed in tenths) of the day with the given index.
+     * \param dayIndex Index of the day.
+     * \return Pointer to the first of NUMBER_OF_INDICES_PER_DAY consecutive values (0-3 UT to 21-24 UT).
+     */
+    const double* getPlanetaryRangeIndices( const int dayIndex ) const
+    {
+        return planetaryRangeIndices_.data( ) + NUMBER_OF_INDICES_PER_DAY * dayIndex;
+    }
+
+    //! Function to retrieve the data of the day with the given index in the format of the SolarActivityData struct.
+    std::shared_ptr< SolarActivityData > getSolarActivityData( const int dayIndex ) const;
+
+    //! Function to convert the table to a map of SolarActivityData, containing only the days that are in the file.
+    SolarActivityDataMap getSolarActivityDataMap( ) const;
+
+    //! Function to write the table to a binary file, which can be read with readFromBinaryFile.
+    /*!
+     * Function to write the table to a binary file, which can be read with readFromBinaryFile.
+     * \param filePath Path of the binary file.
+     * \param sourceFileHash Hash of the contents of the text file from which the table was read, used to check whether the
+     *      binary file is up to date when it is read.
+     */
+    void writeToBinaryFile( const std::string& filePath, const std::uint64_t sourceFileHash = 0 ) const;
+
+    //! Function to read the table from a binary file, as written by writeToBinaryFile.
+    /*!
+     * Function to read the table from a binary file, as written by writeToBinaryFile.
+     * \param filePath Path of the binary file.
+     * \param sourceFileHash Hash of the contents of the text file from which the table is to have been created. If the value
+     *      stored in the binary file is different, the table is not read (and false is returned). Not checked if zero.
+     * \return True if the table was read successfully, false if the file could not be opened or is not consistent.
+     */
+    bool readFromBinaryFile( const std::string& filePath, const std::uint64_t sourceFileHash = 0 );
+
+private:
+
+    //! Function to resize all columns of the table to the given number of days.
+    void resizeTable( const int numberOfDays );
+
+    //! Function to set the data of the day with the given index (date is taken from the year, month and day members).
+    void setDayData( const int dayIndex, const SolarActivityData& solarActivityData, const bool isDayInFile );
+
+    //! Julian day number (noon-based) of the first day in the table.
+    int firstJulianDayNumber_;
+
+    //! Calendar year of each day.
+    std::vector< int > years_;
+
+    //! Calendar month of each day.
+    std::vector< int > months_;
+
+    //! Calendar day of month of each day.
+    std::vector< int > daysOfMonth_;
+
+    //! Day of the year (1 for January 1st) of each day.
+    std::vector< int > daysOfYear_;
+
+    //! Boolean (as unsigned char) denoting for each day whether the file contained an entry.
+    std::vector< unsigned char > isDayInFile_;
+
+    //! Bartels solar rotation number of each day.
+    std::vector< int > bartelsSolarRotationNumbers_;
+
+    //! Day within the Bartels 27-day cycle of each day.
+    std::vector< int > daysOfBartelsCycle_;
+
+    //! 3-hourly planetary range indices (eight per day).
+    std::vector< double > planetaryRangeIndices_;
+
+    //! Sum of the 3-hourly planetary range indices of each day.
+    std::vector< double > planetaryRangeIndexSums_;
+
+    //! 3-hourly planetary equivalent amplitudes (eight per day).
+    std::vector< double > planetaryEquivalentAmplitudes_;
+
+    //! Daily average planetary equivalent amplitude of each day.
+    std::vector< double > planetaryEquivalentAmplitudeAverages_;
+
+    //! Planetary daily character figure of each day.
+    std::vector< double > planetaryDailyCharacterFigures_;
+
+    //! Converted planetary daily character figure of each day.
+    std::vector< int > planetaryDailyCharacterFiguresConverted_;
+
+    //! International sunspot number of each day.
+    std::vector< int > internationalSunspotNumbers_;
+
+    //! F10.7 flux (adjusted) of each day.
+    std::vector< double > solarRadioFlux107Adjusted_;
+
+    //! Flux qualifier of each day.
+    std::vector< unsigned int > fluxQualifiers_;
+
+    //! Centered 81-day average F10.7 flux (adjusted) of each day.
+    std::vector< double > centered81DaySolarRadioFlux107Adjusted_;
+
+    //! Last 81-day average F10.7 flux (adjusted) of each day.
+    std::vector< double > last81DaySolarRadioFlux107Adjusted_;
+
+    //! F10.7 flux (observed) of each day.
+    std::vector< double > solarRadioFlux107Observed_;
+
+    //! Centered 81-day average F10.7 flux (observed) of each day.
+    std::vector< double > centered81DaySolarRadioFlux107Observed_;
+
+    //! Last 81-day average F10.7 flux (observed) of each day.
+    std::vector< double > last81DaySolarRadioFlux107Observed_;
+
+    //! Data type of each day (see SolarActivityData::dataType).
+    std::vector< unsigned int > dataTypes_;
+};
+
+//! Function that reads a space weather data file into a columnar solar activity table.
+/*!
+ * Function that reads a space weather data file (in the format of http://celestrak.com/SpaceData/sw19571001.txt) into a
+ * columnar solar activity table. The fixed-width columns are parsed directly from the file contents, without the
+ * intermediate FieldValue objects used by readSolarActivityData. If a binary cache file path is provided, the table is
+ * read from that file if it exists and was created from a file with identical contents (compared by hash), and is written
+ * to it otherwise (if possible).
+ * \param filePath Path of the space weather data file.
+ * \param binaryCacheFilePath Path of the binary cache file (none used if empty).
+ * \return Solar activity table with the contents of the file.
+ */
+std::shared_ptr< SolarActivityTable > readSolarActivityTable(
+        const std::string& filePath, const std::string& binaryCacheFilePath = "" );
+
+} // namespace solar_activity
+} // namespace input_output
+} // namespace tudat
+
+#endif // TUDAT_SOLAR_ACTIVITY_TABLE_H
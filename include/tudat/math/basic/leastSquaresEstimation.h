@@ -16,12 +16,16 @@
 #define TUDAT_LEASTSQUARESESTIMATION_H
 
 #include <map>
+#include <string>
+#include <vector>
 
 #include <Eigen/Core>
 #include <Eigen/SVD>
 
 #include <boost/function.hpp>
 
+#include "tudat/math/basic/tiledSymmetricMatrix.h"
+
 namespace tudat
 {
 
@@ -111,6 +115,25 @@ Eigen::MatrixXd calculateConsiderParametersCovarianceContribution(
         const Eigen::MatrixXd& considerDesignMatrix,
         const Eigen::MatrixXd& considerCovariance );
 
+//! Function to compute inverse of covariance matrix at current iteration as a tiled symmetric matrix
+/*!
+ * Function to compute inverse of covariance matrix at current iteration (without constraints) as a tiled symmetric
+ * matrix, producing the same matrix as calculateInverseOfUpdatedCovarianceMatrix. The normal matrix is accumulated from
+ * blocks of rows of the design matrix, so that neither the weighted design matrix nor the dense normal matrix are formed.
+ * \param inverseOfCovarianceMatrix Tiled matrix in which the inverse of covariance matrix is stored (reset on input)
+ * \param designMatrix Matrix containing partial derivatives of observations (rows) w.r.t. estimated parameters
+ * (columns)
+ * \param diagonalOfWeightMatrix Diagonal of observation weights matrix (assumes all weights to be uncorrelated)
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix (size 0 if no a priori information is used)
+ * \param numberOfRowsPerBlock Number of rows of the design matrix that are added to the normal matrix at once
+ */
+void calculateTiledInverseOfUpdatedCovarianceMatrix(
+        TiledSymmetricMatrix& inverseOfCovarianceMatrix,
+        const Eigen::MatrixXd& designMatrix,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const int numberOfRowsPerBlock = 1024 );
+
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
 //! information
 /*!
@@ -173,6 +196,96 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromD
         const Eigen::VectorXd& observationResiduals,
         const double limitConditionNumberForWarning = 1.0E8 );
 
+//! Function to determine which estimated parameters are local to a single arc of observations
+/*!
+ * Function to determine which estimated parameters are local to a single arc of observations, so that they can be
+ * eliminated from the normal equations arc-by-arc (see performArcwiseReducedLeastSquaresAdjustment). A parameter is
+ * local to an arc if it has non-zero partials, and these partials are non-zero only for observations in that arc
+ * (typically arc initial states, per-arc empirical accelerations and per-pass biases). Parameters that are local to
+ * different arcs, but are correlated through the a priori covariance, are set as global parameters.
+ * \param designMatrix Matrix containing partial derivatives of observations (rows) w.r.t. estimated parameters
+ * (columns)
+ * \param arcObservationIndices List of observation (row) indices for each arc. Observations not in any arc are
+ * permitted, and make all parameters with non-zero partials for them global
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix (size 0 if no a priori information is used)
+ * \return List of indices of the parameters (columns) that are local to each arc, in ascending order
+ */
+std::vector< std::vector< int > > getArcLocalParameterIndices(
+        const Eigen::MatrixXd& designMatrix,
+        const std::vector< std::vector< int > >& arcObservationIndices,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix = Eigen::MatrixXd( 0, 0 ) );
+
+//! Function to perform an iteration of least squares estimation, eliminating arc-local parameters arc-by-arc
+/*!
+ * Function to perform an iteration of least squares estimation, producing the same result as
+ * performLeastSquaresAdjustmentFromDesignMatrix (without constraints), but exploiting the block structure of the normal
+ * equations of a multi-arc problem. For each arc, the normal equations of the arc-local parameters are formed and
+ * eliminated from the system by their Schur complement. The reduced system in the global parameters is then solved,
+ * after which the arc-local parameters are recovered by back-substitution. Computational cost of the inversion scales
+ * linearly with the number of arcs, instead of cubically with the total number of parameters.
+ *
+ * The partials of the arc-local parameters must be zero for observations not in their arc, and the a priori covariance may
+ * not correlate local parameters of different arcs (both conditions are ensured when using getArcLocalParameterIndices).
+ * \param designMatrix Matrix containing partial derivatives of observations (rows) w.r.t. estimated parameters
+ * (columns)
+ * \param observationResiduals Difference between measured and simulated observations
+ * \param diagonalOfWeightMatrix Diagonal of observation weights matrix (assumes all weights to be uncorrelated)
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix (size 0 if no a priori information is used)
+ * \param arcObservationIndices List of observation (row) indices for each arc (must be mutually disjoint)
+ * \param arcLocalParameterIndices List of indices of the parameters (columns) that are local to each arc (must be
+ * mutually disjoint). All other parameters are treated as global parameters.
+ * \param limitConditionNumberForWarning Maximum value of the condition number of the reduced normal matrix (and of the
+ * normal matrices of the arc-local parameters) that is allowed (warning printed when exceeded)
+ * \param designMatrixConsiderParameters Matrix containing partial derivatives of observations w.r.t. consider parameters
+ * \param considerParametersDeviations Deviations of consider parameters w.r.t. their nominal values
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance), identical in layout to the output of
+ * performLeastSquaresAdjustmentFromDesignMatrix
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performArcwiseReducedLeastSquaresAdjustment(
+        const Eigen::MatrixXd& designMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const std::vector< std::vector< int > >& arcObservationIndices,
+        const std::vector< std::vector< int > >& arcLocalParameterIndices,
+        const double limitConditionNumberForWarning = 1.0E8,
+        const Eigen::MatrixXd& designMatrixConsiderParameters = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& considerParametersDeviations = Eigen::VectorXd( 0 ) );
+
+//! Function to perform an iteration of least squares estimation, solving the normal equations with a tiled Cholesky decomposition
+/*!
+ * Function to perform an iteration of least squares estimation, producing the same result as
+ * performLeastSquaresAdjustmentFromDesignMatrix (without constraints), but solving the normal equations with a blocked
+ * Cholesky decomposition of a TiledSymmetricMatrix instead of an SVD. The normal matrix is accumulated tile-wise from blocks
+ * of design matrix rows (see calculateTiledInverseOfUpdatedCovarianceMatrix), and decomposed in-place, optionally in a
+ * memory-mapped file and distributed over multiple threads. Compared to performLeastSquaresAdjustmentFromDesignMatrix, this
+ * avoids the copy of the weighted design matrix, and the SVD factors and work matrices of the normal matrix. The returned
+ * inverse covariance is still a dense matrix, as required by the estimation output. Since no SVD is computed, the condition
+ * number is not checked; an exception is thrown if the normal matrix is not positive definite.
+ * \param designMatrix Matrix containing partial derivatives of observations (rows) w.r.t. estimated parameters
+ * (columns)
+ * \param observationResiduals Difference between measured and simulated observations
+ * \param diagonalOfWeightMatrix Diagonal of observation weights matrix (assumes all weights to be uncorrelated)
+ * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix (size 0 if no a priori information is used)
+ * \param tileSize Number of rows/columns of a single tile of the normal matrix
+ * \param storageFile Name of file used to store the tiles as a memory-mapped file. If empty, tiles are stored in memory.
+ * \param numberOfThreads Number of threads over which tile operations are distributed
+ * \param designMatrixConsiderParameters Matrix containing partial derivatives of observations w.r.t. consider parameters
+ * \param considerParametersDeviations Deviations of consider parameters w.r.t. their nominal values
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance), identical in layout to the output of
+ * performLeastSquaresAdjustmentFromDesignMatrix
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performTiledLeastSquaresAdjustment(
+        const Eigen::MatrixXd& designMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const int tileSize = 256,
+        const std::string& storageFile = "",
+        const int numberOfThreads = 1,
+        const Eigen::MatrixXd& designMatrixConsiderParameters = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& considerParametersDeviations = Eigen::VectorXd( 0 ) );
+
 
 Eigen::VectorXd evaluatePolynomial(
     const Eigen::VectorXd& independentValues,
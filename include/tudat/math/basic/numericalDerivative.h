@@ -19,6 +19,9 @@
 #define TUDAT_NUMERICAL_DERIVATIVE_H
 
 #include <map>
+#include <limits>
+#include <stdexcept>
+#include <string>
 
 #include <functional>
 
@@ -177,6 +180,122 @@ DependentVariableType computeCentralDifferenceFromFunction(
 
 }
 
+//! Class to compute Jacobians by central differences, with per-column step sizes selected from an error estimate
+/*!
+ * Class to compute Jacobians of a vector function by second-order central differences, with a separate step size for each
+ * column. The step sizes are (re)selected every stepSizeUpdateInterval calls (and on the first call): during such an update,
+ * each column is additionally evaluated with half the step size. The two central differences are combined by Richardson
+ * extrapolation (which is then used as the Jacobian column for that call), and their difference provides an estimate of the
+ * truncation error. The new step size is then chosen to balance the truncation error against the rounding error, which is
+ * estimated from the relative noise level of the function. In all other calls, only two function evaluations per column are
+ * used, with the step sizes from the last update. The step sizes are constrained to a fixed range around the initial step
+ * sizes, so that a single update at an atypical point cannot move them arbitrarily far.
+ */
+class CentralDifferenceJacobianCalculator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param initialStepSizes Step sizes used for each column before the first update (and reference for step size limits)
+     * \param stepSizeUpdateInterval Number of calls to computeJacobian after which step sizes are updated (0 if the step sizes
+     * are never to be updated, in which case initialStepSizes are used for all calls)
+     * \param relativeFunctionNoise Relative noise level of the function values, used to estimate the rounding error
+     * \param minimumStepSizeFactor Minimum ratio of step size to initial step size
+     * \param maximumStepSizeFactor Maximum ratio of step size to initial step size
+     */
+    CentralDifferenceJacobianCalculator(
+            const Eigen::VectorXd& initialStepSizes,
+            const int stepSizeUpdateInterval = 0,
+            const double relativeFunctionNoise = std::numeric_limits< double >::epsilon( ),
+            const double minimumStepSizeFactor = 1.0E-3,
+            const double maximumStepSizeFactor = 1.0E3 ):
+        initialStepSizes_( initialStepSizes ), stepSizes_( initialStepSizes ),
+        stepSizeUpdateInterval_( stepSizeUpdateInterval ), relativeFunctionNoise_( relativeFunctionNoise ),
+        minimumStepSizeFactor_( minimumStepSizeFactor ), maximumStepSizeFactor_( maximumStepSizeFactor ),
+        numberOfCallsSinceUpdate_( 0 ), stepSizesAreSelected_( false ){ }
+
+    //! Function to compute the Jacobian of a function at a given input.
+    /*!
+     * Function to compute the Jacobian of a function at a given input. The function is only evaluated at perturbed inputs;
+     * it is the responsibility of the caller to reset any models affected by the function evaluation to the nominal input.
+     * \param function Function of which the Jacobian is to be computed
+     * \param nominalInput Input at which the Jacobian is to be computed
+     * \param jacobian Jacobian of function at nominalInput (returned by reference)
+     */
+    void computeJacobian(
+            const std::function< Eigen::VectorXd( const Eigen::VectorXd& ) >& function,
+            const Eigen::VectorXd& nominalInput,
+            Eigen::Ref< Eigen::MatrixXd > jacobian );
+
+    //! Function to compute the Jacobian of a function at a given input (see other overload).
+    Eigen::MatrixXd computeJacobian(
+            const std::function< Eigen::VectorXd( const Eigen::VectorXd& ) >& function,
+            const Eigen::VectorXd& nominalInput );
+
+    //! Function to retrieve the current step sizes
+    Eigen::VectorXd getStepSizes( )
+    {
+        return stepSizes_;
+    }
+
+    //! Function to reset the step sizes (which will be used until the next update)
+    void resetStepSizes( const Eigen::VectorXd& stepSizes )
+    {
+        if( stepSizes.rows( ) != initialStepSizes_.rows( ) )
+        {
+            throw std::runtime_error( "Error when resetting central difference step sizes; size is inconsistent" );
+        }
+        stepSizes_ = stepSizes;
+    }
+
+    //! Function to retrieve the estimated truncation error of each column, as computed during the last step size update
+    Eigen::VectorXd getEstimatedTruncationErrors( )
+    {
+        return estimatedTruncationErrors_;
+    }
+
+private:
+
+    //! Function to compute a single Jacobian column, and select a new step size for it
+    void computeColumnAndSelectStepSize(
+            const std::function< Eigen::VectorXd( const Eigen::VectorXd& ) >& function,
+            const int columnIndex,
+            Eigen::Ref< Eigen::MatrixXd > jacobian );
+
+    //! Step sizes used for each column before the first update
+    Eigen::VectorXd initialStepSizes_;
+
+    //! Step sizes currently used for each column
+    Eigen::VectorXd stepSizes_;
+
+    //! Number of calls to computeJacobian after which step sizes are updated (0 if never)
+    int stepSizeUpdateInterval_;
+
+    //! Relative noise level of the function values
+    double relativeFunctionNoise_;
+
+    //! Minimum ratio of step size to initial step size
+    double minimumStepSizeFactor_;
+
+    //! Maximum ratio of step size to initial step size
+    double maximumStepSizeFactor_;
+
+    //! Number of calls to computeJacobian since the last step size update
+    int numberOfCallsSinceUpdate_;
+
+    //! Boolean denoting whether the step sizes have been selected at least once
+    bool stepSizesAreSelected_;
+
+    //! Estimated truncation error of each column, as computed during the last step size update
+    Eigen::VectorXd estimatedTruncationErrors_;
+
+    //! Pre-allocated perturbed input
+    Eigen::VectorXd perturbedInput_;
+
+};
+
 } // namespace numerical_derivatives
 
 } // namespace tudat
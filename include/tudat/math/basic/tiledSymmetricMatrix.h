@@ -0,0 +1,270 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *      Golub, G.H., and Van Loan, C.F., Matrix Computations, 4th ed., Johns Hopkins University Press, 2013.
+ */
+
+#ifndef TUDAT_TILEDSYMMETRICMATRIX_H
+#define TUDAT_TILEDSYMMETRICMATRIX_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Class for a large symmetric (normal) matrix, stored as square tiles of its lower triangle
+/*!
+ *  Class for a large symmetric matrix, such as the normal matrix of a least-squares problem with a very large number of
+ *  parameters (e.g. high-degree gravity field estimation). Only the tiles on and below the diagonal are stored, either in
+ *  memory, or in a memory-mapped file, so that the matrix size is not limited by the available memory. The matrix can be
+ *  accumulated tile-wise from blocks of rows of a design matrix, decomposed in-place with a blocked Cholesky decomposition
+ *  (Golub and Van Loan, 2013), after which the normal equations can be solved, and the diagonal or selected blocks of the
+ *  inverse (covariance) can be extracted without forming the full inverse. Tile operations are distributed over
+ *  the requested number of threads.
+ *
+ *  Since the decomposition is performed in-place, a failed decomposition (matrix not positive definite) leaves the tiles
+ *  partially overwritten. The object is then unusable: all operations other than setZero (and direct tile access with
+ *  getTile) throw an exception, until the matrix is reset with setZero and re-accumulated.
+ */
+class TiledSymmetricMatrix
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, creates the (zero-initialized) matrix
+     *  \param matrixSize Number of rows/columns of the matrix
+     *  \param tileSize Number of rows/columns of a single tile (last row/column of tiles may be smaller)
+     *  \param storageFile Name of file used to store the tiles as a memory-mapped file. If empty, tiles are stored in memory.
+     *  \param numberOfThreads Number of threads over which tile operations are distributed
+     *  \param removeStorageFile Boolean denoting whether the storage file is to be removed when this object is destroyed
+     */
+    TiledSymmetricMatrix( const int matrixSize,
+                          const int tileSize = 256,
+                          const std::string& storageFile = "",
+                          const int numberOfThreads = 1,
+                          const bool removeStorageFile = true );
+
+    //! Destructor, removes storage file (if requested)
+    ~TiledSymmetricMatrix( );
+
+    //! Copying is not supported, since tiles may be stored in a memory-mapped file
+    TiledSymmetricMatrix( const TiledSymmetricMatrix& ) = delete;
+
+    //! Copying is not supported, since tiles may be stored in a memory-mapped file
+    TiledSymmetricMatrix& operator=( const TiledSymmetricMatrix& ) = delete;
+
+    //! Function to retrieve a tile on or below the diagonal
+    /*!
+     *  Function to retrieve a tile on or below the diagonal, as a (modifiable) map to the stored data. After the Cholesky
+     *  decomposition, the tiles contain the lower-triangular Cholesky factor.
+     *  \param rowTileIndex Row index of tile
+     *  \param columnTileIndex Column index of tile (must be smaller than or equal to rowTileIndex)
+     *  \return Map to tile data
+     */
+    Eigen::Map< Eigen::MatrixXd > getTile( const int rowTileIndex, const int columnTileIndex );
+
+    //! Function to set all entries of the matrix to zero (and reset its decomposition status, including a failed decomposition)
+    void setZero( );
+
+    //! Function to add the normal matrix contribution of a block of rows of a design matrix
+    /*!
+     *  Function to add the normal matrix contribution A^T*W*A of a block of rows of a design matrix A, with diagonal weights
+     *  W. This allows the normal matrix to be accumulated without storing the full design matrix.
+     *  \param designMatrixRows Block of rows of design matrix (number of columns must be equal to matrix size)
+     *  \param diagonalOfWeightMatrix Weights of the observations in the block of rows
+     */
+    void addWeightedDesignMatrixRows( const Eigen::MatrixXd& designMatrixRows,
+                                      const Eigen::VectorXd& diagonalOfWeightMatrix );
+
+    //! Function to add a vector to the diagonal of the matrix (e.g. a diagonal inverse a priori covariance)
+    /*!
+     *  Function to add a vector to the diagonal of the matrix (e.g. a diagonal inverse a priori covariance)
+     *  \param diagonalToAdd Vector to add to the diagonal
+     */
+    void addToDiagonal( const Eigen::VectorXd& diagonalToAdd );
+
+    //! Function to add a (dense) symmetric matrix to the matrix (e.g. a full inverse a priori covariance)
+    /*!
+     *  Function to add a (dense) symmetric matrix to the matrix (e.g. a full inverse a priori covariance). Only the lower
+     *  triangle of the input matrix is used.
+     *  \param matrixToAdd Symmetric matrix to add
+     */
+    void addSymmetricMatrix( const Eigen::MatrixXd& matrixToAdd );
+
+    //! Function to perform the blocked Cholesky decomposition of the matrix in-place
+    /*!
+     *  Function to perform the blocked (right-looking) Cholesky decomposition of the matrix in-place, overwriting the tiles
+     *  with the lower-triangular Cholesky factor L (with N = L*L^T). An exception is thrown if the matrix is not positive
+     *  definite, in which case the tiles have been partially overwritten, and the object can only be used again after
+     *  calling setZero (see getHasDecompositionFailed).
+     */
+    void performCholeskyDecomposition( );
+
+    //! Function to solve the system of equations N*x = b (performing the Cholesky decomposition if required)
+    /*!
+     *  Function to solve the system of equations N*x = b (performing the Cholesky decomposition if required)
+     *  \param rightHandSide Right-hand side b (may have multiple columns)
+     *  \return Solution x
+     */
+    Eigen::MatrixXd solve( const Eigen::MatrixXd& rightHandSide );
+
+    //! Function to compute the diagonal of the inverse of the matrix (performing the Cholesky decomposition if required)
+    /*!
+     *  Function to compute the diagonal of the inverse of the matrix (i.e. the parameter variances when this object is a
+     *  normal matrix), computed one column of tiles of the inverse Cholesky factor at a time.
+     *  \return Diagonal of the inverse of the matrix
+     */
+    Eigen::VectorXd getInverseDiagonal( );
+
+    //! Function to compute a block of the inverse of the matrix (performing the Cholesky decomposition if required)
+    /*!
+     *  Function to compute a block of the inverse of the matrix (i.e. a block of the covariance matrix when this object is
+     *  a normal matrix), without computing the full inverse.
+     *  \param startRow First row of block
+     *  \param startColumn First column of block
+     *  \param numberOfRows Number of rows of block
+     *  \param numberOfColumns Number of columns of block
+     *  \return Requested block of the inverse of the matrix
+     */
+    Eigen::MatrixXd getInverseBlock( const int startRow, const int startColumn,
+                                     const int numberOfRows, const int numberOfColumns );
+
+    //! Function to retrieve the full matrix as a dense matrix (requires memory for the full matrix)
+    /*!
+     *  Function to retrieve the full matrix as a dense matrix (requires memory for the full matrix). After the Cholesky
+     *  decomposition, the lower-triangular Cholesky factor is returned.
+     *  \return Full matrix
+     */
+    Eigen::MatrixXd getDenseMatrix( );
+
+    //! Function to retrieve the number of rows/columns of the matrix
+    /*!
+     *  Function to retrieve the number of rows/columns of the matrix
+     *  \return Number of rows/columns of the matrix
+     */
+    int getMatrixSize( )
+    {
+        return matrixSize_;
+    }
+
+    //! Function to retrieve the number of rows/columns of a single (full) tile
+    /*!
+     *  Function to retrieve the number of rows/columns of a single (full) tile
+     *  \return Number of rows/columns of a single (full) tile
+     */
+    int getTileSize( )
+    {
+        return tileSize_;
+    }
+
+    //! Function to retrieve the number of rows/columns of tiles
+    /*!
+     *  Function to retrieve the number of rows/columns of tiles
+     *  \return Number of rows/columns of tiles
+     */
+    int getNumberOfTiles( )
+    {
+        return numberOfTiles_;
+    }
+
+    //! Function to retrieve whether the tiles contain the Cholesky factor of the matrix
+    /*!
+     *  Function to retrieve whether the tiles contain the Cholesky factor of the matrix
+     *  \return True if the tiles contain the Cholesky factor of the matrix
+     */
+    bool getIsDecomposed( )
+    {
+        return isDecomposed_;
+    }
+
+    //! Function to retrieve whether the last Cholesky decomposition failed (leaving the tiles partially overwritten)
+    /*!
+     *  Function to retrieve whether the last Cholesky decomposition failed, in which case the tiles are partially
+     *  overwritten, and all operations other than setZero and getTile throw an exception.
+     *  \return True if the last Cholesky decomposition failed
+     */
+    bool getHasDecompositionFailed( )
+    {
+        return hasDecompositionFailed_;
+    }
+
+private:
+
+    //! Function to check that the matrix can be used (i.e. no failed decomposition), throwing an exception otherwise
+    void checkDecompositionHasNotFailed( const std::string& operation );
+
+    //! Function to retrieve the number of rows/columns of a given row/column of tiles
+    int getCurrentTileSize( const int tileIndex )
+    {
+        return ( tileIndex < numberOfTiles_ - 1 ) ? tileSize_ : ( matrixSize_ - tileIndex * tileSize_ );
+    }
+
+    //! Function to perform forward substitution L*Y = B, with rows of B before given row of tiles assumed to be zero
+    void solveWithCholeskyFactor( Eigen::MatrixXd& rightHandSide, const int firstNonZeroTile = 0 );
+
+    //! Function to perform backward substitution L^T*X = Y
+    void solveWithTransposedCholeskyFactor( Eigen::MatrixXd& rightHandSide );
+
+    //! Function to evaluate a list of independent tasks, distributed over the threads
+    void performTasksInParallel( const int numberOfTasks, const std::function< void( const int ) >& taskFunction );
+
+    //! Number of rows/columns of the matrix
+    int matrixSize_;
+
+    //! Number of rows/columns of a single (full) tile
+    int tileSize_;
+
+    //! Number of rows/columns of tiles
+    int numberOfTiles_;
+
+    //! Name of file used to store the tiles (empty if tiles are stored in memory)
+    std::string storageFile_;
+
+    //! Number of threads over which tile operations are distributed
+    int numberOfThreads_;
+
+    //! Boolean denoting whether the storage file is to be removed when this object is destroyed
+    bool removeStorageFile_;
+
+    //! Offsets of the tiles (lower triangle, column-wise) in the tile data
+    std::vector< std::size_t > tileOffsets_;
+
+    //! Tile data, if stored in memory
+    std::vector< double > inMemoryTileData_;
+
+    //! Memory-mapped region of storage file, if tiles are stored in a file
+    std::unique_ptr< boost::interprocess::mapped_region > mappedRegion_;
+
+    //! Pointer to start of tile data
+    double* tileData_;
+
+    //! Boolean denoting whether the tiles contain the Cholesky factor of the matrix
+    bool isDecomposed_;
+
+    //! Boolean denoting whether the last Cholesky decomposition failed (leaving the tiles partially overwritten)
+    bool hasDecompositionFailed_;
+};
+
+} // namespace linear_algebra
+
+} // namespace tudat
+
+#endif // TUDAT_TILEDSYMMETRICMATRIX_H
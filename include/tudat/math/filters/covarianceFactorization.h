@@ -0,0 +1,246 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *      Bierman, G.J., Factorization Methods for Discrete Sequential Estimation, Academic Press, 1977.
+ *      Thornton, C.L. and Bierman, G.J., Gram-Schmidt Algorithms for Covariance Propagation, International Journal of
+ *          Control, 25(2), 1977.
+ *      Grewal, M.S. and Andrews, A.P., Kalman Filtering: Theory and Practice Using MATLAB, 3rd ed., Wiley, 2008.
+ */
+
+#ifndef TUDAT_COVARIANCE_FACTORIZATION_H
+#define TUDAT_COVARIANCE_FACTORIZATION_H
+
+#include <cmath>
+#include <stdexcept>
+
+#include <Eigen/Core>
+#include <Eigen/Cholesky>
+
+namespace tudat
+{
+
+namespace filters
+{
+
+//! Function to compute the UD factorization of a symmetric positive (semi-)definite matrix.
+/*!
+ *  Function to compute the UD factorization of a symmetric positive (semi-)definite matrix, such that
+ *  \f$ P = U D U^{T} \f$, with \f$ U \f$ unit upper triangular and \f$ D \f$ diagonal (Bierman, 1977).
+ *  \param covarianceMatrix Matrix to be factorized.
+ *  \param unitUpperTriangularFactor Unit upper triangular factor \f$ U \f$ (returned by reference).
+ *  \param diagonalFactor Diagonal entries of factor \f$ D \f$ (returned by reference).
+ */
+template< typename ScalarType >
+void computeUDFactorization( const Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >& covarianceMatrix,
+                             Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >& unitUpperTriangularFactor,
+                             Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& diagonalFactor )
+{
+    const int size = covarianceMatrix.rows( );
+    unitUpperTriangularFactor = Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >::Identity( size, size );
+    diagonalFactor = Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >::Zero( size );
+
+    for ( int j = size - 1; j >= 0; j-- )
+    {
+        ScalarType diagonalEntry = covarianceMatrix( j, j );
+        for ( int k = j + 1; k < size; k++ )
+        {
+            diagonalEntry -= diagonalFactor( k ) * unitUpperTriangularFactor( j, k ) * unitUpperTriangularFactor( j, k );
+        }
+        diagonalFactor( j ) = diagonalEntry;
+
+        for ( int i = 0; i < j; i++ )
+        {
+            ScalarType upperEntry = covarianceMatrix( i, j );
+            for ( int k = j + 1; k < size; k++ )
+            {
+                upperEntry -= diagonalFactor( k ) * unitUpperTriangularFactor( i, k ) * unitUpperTriangularFactor( j, k );
+            }
+            unitUpperTriangularFactor( i, j ) = ( diagonalEntry > static_cast< ScalarType >( 0.0 ) ) ?
+                        upperEntry / diagonalEntry : static_cast< ScalarType >( 0.0 );
+        }
+    }
+}
+
+//! Function to perform the time update of UD factors, with the modified weighted Gram-Schmidt algorithm.
+/*!
+ *  Function to perform the time update of the UD factors of the covariance, using the modified weighted Gram-Schmidt
+ *  orthogonalization of Thornton and Bierman (1977). The propagated covariance is given by \f$ W D_{W} W^{T} \f$, with
+ *  \f$ W = [ \Phi U, G U_{Q} ] \f$ and \f$ D_{W} = diag( D, D_{Q} ) \f$, where \f$ \Phi \f$ and \f$ G \f$ are the state
+ *  and noise transition matrices, and \f$ U_{Q} D_{Q} U_{Q}^{T} \f$ is the process noise covariance.
+ *  \param weightedMatrix Matrix \f$ W \f$ (modified by the function).
+ *  \param weights Diagonal entries of \f$ D_{W} \f$.
+ *  \param unitUpperTriangularFactor Propagated unit upper triangular factor (returned by reference).
+ *  \param diagonalFactor Diagonal entries of propagated diagonal factor (returned by reference).
+ */
+template< typename ScalarType >
+void performModifiedWeightedGramSchmidtTimeUpdate(
+        Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >& weightedMatrix,
+        const Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& weights,
+        Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >& unitUpperTriangularFactor,
+        Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& diagonalFactor )
+{
+    const int size = weightedMatrix.rows( );
+    unitUpperTriangularFactor.setIdentity( size, size );
+    diagonalFactor.resize( size );
+
+    Eigen::Matrix< ScalarType, 1, Eigen::Dynamic > weightedRow;
+    for ( int k = size - 1; k >= 0; k-- )
+    {
+        weightedRow = weightedMatrix.row( k ).cwiseProduct( weights.transpose( ) );
+        diagonalFactor( k ) = weightedMatrix.row( k ).dot( weightedRow );
+        if ( diagonalFactor( k ) > static_cast< ScalarType >( 0.0 ) )
+        {
+            weightedRow /= diagonalFactor( k );
+            for ( int j = 0; j < k; j++ )
+            {
+                unitUpperTriangularFactor( j, k ) = weightedMatrix.row( j ).dot( weightedRow );
+                weightedMatrix.row( j ) -= unitUpperTriangularFactor( j, k ) * weightedMatrix.row( k );
+            }
+        }
+    }
+}
+
+//! Function to perform the measurement update of UD factors for a single scalar measurement.
+/*!
+ *  Function to perform the measurement update of the UD factors of the covariance for a single scalar measurement with
+ *  uncorrelated noise, using Bierman's algorithm (Bierman, 1977). The cost is quadratic in the size of the state.
+ *  \param unitUpperTriangularFactor Unit upper triangular factor \f$ U \f$ (updated by the function).
+ *  \param diagonalFactor Diagonal entries of factor \f$ D \f$ (updated by the function).
+ *  \param measurementPartials Partial derivatives of the scalar measurement w.r.t. the state.
+ *  \param measurementVariance Variance of the scalar measurement noise.
+ *  \return Kalman gain for the scalar measurement.
+ */
+template< typename ScalarType >
+Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > performBiermanScalarMeasurementUpdate(
+        Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >& unitUpperTriangularFactor,
+        Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& diagonalFactor,
+        const Eigen::Matrix< ScalarType, 1, Eigen::Dynamic >& measurementPartials,
+        const ScalarType measurementVariance )
+{
+    const int size = diagonalFactor.rows( );
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > f = unitUpperTriangularFactor.transpose( ) * measurementPartials.transpose( );
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > v = diagonalFactor.cwiseProduct( f );
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > unnormalizedGain = Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >::Zero( size );
+
+    ScalarType innovationVariance = measurementVariance;
+    for ( int j = 0; j < size; j++ )
+    {
+        const ScalarType previousInnovationVariance = innovationVariance;
+        innovationVariance += f( j ) * v( j );
+        if ( innovationVariance <= static_cast< ScalarType >( 0.0 ) )
+        {
+            throw std::runtime_error( "Error in UD measurement update. Innovation variance is not positive; "
+                                      "the measurement variance must be positive." );
+        }
+        diagonalFactor( j ) *= previousInnovationVariance / innovationVariance;
+
+        const ScalarType lambda = -f( j ) / previousInnovationVariance;
+        for ( int i = 0; i < j; i++ )
+        {
+            const ScalarType previousUpperEntry = unitUpperTriangularFactor( i, j );
+            unitUpperTriangularFactor( i, j ) = previousUpperEntry + lambda * unnormalizedGain( i );
+            unnormalizedGain( i ) += v( j ) * previousUpperEntry;
+        }
+        unnormalizedGain( j ) = v( j );
+    }
+
+    return unnormalizedGain / innovationVariance;
+}
+
+//! Function to perform the measurement update of the square root information matrix for a single scalar measurement.
+/*!
+ *  Function to perform the measurement update of the upper triangular square root information matrix \f$ R \f$ (with
+ *  \f$ P^{-1} = R^{T} R \f$) and the associated information vector \f$ z \f$ for a single scalar measurement of unit
+ *  variance, by annihilating the new measurement row with Givens rotations. The cost is quadratic in the size of the state.
+ *  \param squareRootInformationMatrix Upper triangular square root information matrix (updated by the function).
+ *  \param informationVector Information vector (updated by the function).
+ *  \param measurementPartials Partial derivatives of the (whitened) scalar measurement w.r.t. the state.
+ *  \param measurementResidual (Whitened) scalar measurement residual.
+ *  \return Residual of the scalar measurement after the update.
+ */
+template< typename ScalarType >
+ScalarType performSquareRootInformationScalarMeasurementUpdate(
+        Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >& squareRootInformationMatrix,
+        Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& informationVector,
+        const Eigen::Matrix< ScalarType, 1, Eigen::Dynamic >& measurementPartials,
+        const ScalarType measurementResidual )
+{
+    const int size = informationVector.rows( );
+    Eigen::Matrix< ScalarType, 1, Eigen::Dynamic > measurementRow = measurementPartials;
+    ScalarType residual = measurementResidual;
+
+    for ( int j = 0; j < size; j++ )
+    {
+        if ( measurementRow( j ) == static_cast< ScalarType >( 0.0 ) )
+        {
+            continue;
+        }
+
+        // Compute Givens rotation that zeroes element j of measurement row
+        const ScalarType norm = std::hypot( squareRootInformationMatrix( j, j ), measurementRow( j ) );
+        const ScalarType cosine = squareRootInformationMatrix( j, j ) / norm;
+        const ScalarType sine = measurementRow( j ) / norm;
+
+        for ( int k = j; k < size; k++ )
+        {
+            const ScalarType informationEntry = squareRootInformationMatrix( j, k );
+            squareRootInformationMatrix( j, k ) = cosine * informationEntry + sine * measurementRow( k );
+            measurementRow( k ) = -sine * informationEntry + cosine * measurementRow( k );
+        }
+
+        const ScalarType informationVectorEntry = informationVector( j );
+        informationVector( j ) = cosine * informationVectorEntry + sine * residual;
+        residual = -sine * informationVectorEntry + cosine * residual;
+    }
+
+    return residual;
+}
+
+//! Function to transform a set of measurement equations such that the measurement noise is uncorrelated.
+/*!
+ *  Function to transform a set of measurement equations such that the measurement noise is uncorrelated, allowing the
+ *  measurements to be processed sequentially as scalars. If the measurement noise covariance is diagonal, the equations
+ *  are not modified, and the variances are given by its diagonal. Otherwise, the equations are premultiplied by the
+ *  inverse of the Cholesky factor of the noise covariance, in which case the variances are equal to one.
+ *  \param measurementPartials Partial derivatives of the measurements w.r.t. the state (modified by the function).
+ *  \param measurementResiduals Measurement residuals (modified by the function).
+ *  \param measurementNoiseCovariance Covariance of the measurement noise.
+ *  \return Variances of the (transformed) uncorrelated measurements.
+ */
+template< typename ScalarType >
+Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > decorrelateMeasurementEquations(
+        Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >& measurementPartials,
+        Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& measurementResiduals,
+        const Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >& measurementNoiseCovariance )
+{
+    const int numberOfMeasurements = measurementNoiseCovariance.rows( );
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > offDiagonalCovariance = measurementNoiseCovariance;
+    offDiagonalCovariance.diagonal( ).setZero( );
+    if ( offDiagonalCovariance.isZero( ) )
+    {
+        return measurementNoiseCovariance.diagonal( );
+    }
+
+    Eigen::LLT< Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > > choleskyDecomposition(
+                measurementNoiseCovariance );
+    if ( choleskyDecomposition.info( ) != Eigen::Success )
+    {
+        throw std::runtime_error( "Error when decorrelating measurements. Measurement noise covariance is not positive definite." );
+    }
+    choleskyDecomposition.matrixL( ).solveInPlace( measurementPartials );
+    choleskyDecomposition.matrixL( ).solveInPlace( measurementResiduals );
+    return Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >::Ones( numberOfMeasurements );
+}
+
+} // namespace filters
+
+} // namespace tudat
+
+#endif // TUDAT_COVARIANCE_FACTORIZATION_H
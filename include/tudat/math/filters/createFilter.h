@@ -22,6 +22,8 @@
 
 #include "tudat/math/filters/extendedKalmanFilter.h"
 #include "tudat/math/filters/linearKalmanFilter.h"
+#include "tudat/math/filters/squareRootInformationFilter.h"
+#include "tudat/math/filters/udExtendedKalmanFilter.h"
 #include "tudat/math/filters/unscentedKalmanFilter.h"
 
 namespace tudat
@@ -35,7 +37,9 @@ enum AvailableFilteringTechniques
 {
     linear_kalman_filter = 0,
     extended_kalman_filter = 1,
-    unscented_kalman_filter = 2
+    unscented_kalman_filter = 2,
+    ud_extended_kalman_filter = 3,
+    square_root_information_filter = 4
 };
 
 //! Filter settings.
@@ -172,6 +176,118 @@ public:
                                                                           initialCovarianceMatrix, integratorSettings )
     { }
 
+protected:
+
+    //! Constructor for factorized variants of the extended Kalman filter.
+    /*!
+     *  Constructor for factorized variants of the extended Kalman filter, which take the same inputs as the extended
+     *  Kalman filter, but differ in the filtering technique.
+     *  \param filteringTechnique Enumeration denoting the filtering technique.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     */
+    ExtendedKalmanFilterSettings( const AvailableFilteringTechniques filteringTechnique,
+                                  const DependentMatrix& systemUncertainty,
+                                  const DependentMatrix& measurementUncertainty,
+                                  const IndependentVariableType filteringStepSize,
+                                  const IndependentVariableType initialTime,
+                                  const DependentVector& initialStateVector,
+                                  const DependentMatrix& initialCovarianceMatrix,
+                                  const std::shared_ptr< IntegratorSettings > integratorSettings ) :
+        FilterSettings< IndependentVariableType, DependentVariableType >( filteringTechnique,
+                                                                          systemUncertainty, measurementUncertainty,
+                                                                          filteringStepSize, initialTime, initialStateVector,
+                                                                          initialCovarianceMatrix, integratorSettings )
+    { }
+
+};
+
+//! UD-factorized extended Kalman filter settings.
+/*!
+ *  UD-factorized extended Kalman filter (Bierman-Thornton) settings.
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class UDExtendedKalmanFilterSettings : public ExtendedKalmanFilterSettings< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::IntegratorSettings IntegratorSettings;
+
+    //! Default constructor.
+    /*!
+     *  Default constructor, taking the same inputs as the ExtendedKalmanFilterSettings class.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     */
+    UDExtendedKalmanFilterSettings( const DependentMatrix& systemUncertainty,
+                                    const DependentMatrix& measurementUncertainty,
+                                    const IndependentVariableType filteringStepSize,
+                                    const IndependentVariableType initialTime,
+                                    const DependentVector& initialStateVector,
+                                    const DependentMatrix& initialCovarianceMatrix,
+                                    const std::shared_ptr< IntegratorSettings > integratorSettings = nullptr ) :
+        ExtendedKalmanFilterSettings< IndependentVariableType, DependentVariableType >(
+            ud_extended_kalman_filter, systemUncertainty, measurementUncertainty, filteringStepSize, initialTime,
+            initialStateVector, initialCovarianceMatrix, integratorSettings )
+    { }
+
+};
+
+//! Square root information filter settings.
+/*!
+ *  Square root information filter settings.
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class SquareRootInformationFilterSettings : public ExtendedKalmanFilterSettings< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::IntegratorSettings IntegratorSettings;
+
+    //! Default constructor.
+    /*!
+     *  Default constructor, taking the same inputs as the ExtendedKalmanFilterSettings class.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system. Must be
+     *      positive definite.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     */
+    SquareRootInformationFilterSettings( const DependentMatrix& systemUncertainty,
+                                         const DependentMatrix& measurementUncertainty,
+                                         const IndependentVariableType filteringStepSize,
+                                         const IndependentVariableType initialTime,
+                                         const DependentVector& initialStateVector,
+                                         const DependentMatrix& initialCovarianceMatrix,
+                                         const std::shared_ptr< IntegratorSettings > integratorSettings = nullptr ) :
+        ExtendedKalmanFilterSettings< IndependentVariableType, DependentVariableType >(
+            square_root_information_filter, systemUncertainty, measurementUncertainty, filteringStepSize, initialTime,
+            initialStateVector, initialCovarianceMatrix, integratorSettings )
+    { }
+
 };
 
 //! Unscented Kalman filter settings.
@@ -283,6 +399,8 @@ createFilter( const std::shared_ptr< FilterSettings< IndependentVariableType, De
     switch ( filterSettings->filteringTechnique_ )
     {
     case extended_kalman_filter:
+    case ud_extended_kalman_filter:
+    case square_root_information_filter:
     {
         // Cast filter settings to extended Kalman filter
         std::shared_ptr< ExtendedKalmanFilterSettings< IndependentVariableType, DependentVariableType > > extendedKalmanFilterSettings =
@@ -304,13 +422,35 @@ createFilter( const std::shared_ptr< FilterSettings< IndependentVariableType, De
         }
 
         // Create filter
-        createdFilter = std::make_shared< ExtendedKalmanFilter< IndependentVariableType, DependentVariableType > >(
-                    systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
-                    measurementJacobianFunction, measurementNoiseJacobianFunction,
-                    extendedKalmanFilterSettings->systemUncertainty_, extendedKalmanFilterSettings->measurementUncertainty_,
-                    extendedKalmanFilterSettings->filteringStepSize_, extendedKalmanFilterSettings->initialTime_,
-                    extendedKalmanFilterSettings->initialStateEstimate_, extendedKalmanFilterSettings->initialCovarianceEstimate_,
-                    extendedKalmanFilterSettings->integratorSettings_ );
+        switch ( filterSettings->filteringTechnique_ )
+        {
+        case ud_extended_kalman_filter:
+            createdFilter = std::make_shared< UDExtendedKalmanFilter< IndependentVariableType, DependentVariableType > >(
+                        systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+                        measurementJacobianFunction, measurementNoiseJacobianFunction,
+                        extendedKalmanFilterSettings->systemUncertainty_, extendedKalmanFilterSettings->measurementUncertainty_,
+                        extendedKalmanFilterSettings->filteringStepSize_, extendedKalmanFilterSettings->initialTime_,
+                        extendedKalmanFilterSettings->initialStateEstimate_, extendedKalmanFilterSettings->initialCovarianceEstimate_,
+                        extendedKalmanFilterSettings->integratorSettings_ );
+            break;
+        case square_root_information_filter:
+            createdFilter = std::make_shared< SquareRootInformationFilter< IndependentVariableType, DependentVariableType > >(
+                        systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+                        measurementJacobianFunction, measurementNoiseJacobianFunction,
+                        extendedKalmanFilterSettings->systemUncertainty_, extendedKalmanFilterSettings->measurementUncertainty_,
+                        extendedKalmanFilterSettings->filteringStepSize_, extendedKalmanFilterSettings->initialTime_,
+                        extendedKalmanFilterSettings->initialStateEstimate_, extendedKalmanFilterSettings->initialCovarianceEstimate_,
+                        extendedKalmanFilterSettings->integratorSettings_ );
+            break;
+        default:
+            createdFilter = std::make_shared< ExtendedKalmanFilter< IndependentVariableType, DependentVariableType > >(
+                        systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+                        measurementJacobianFunction, measurementNoiseJacobianFunction,
+                        extendedKalmanFilterSettings->systemUncertainty_, extendedKalmanFilterSettings->measurementUncertainty_,
+                        extendedKalmanFilterSettings->filteringStepSize_, extendedKalmanFilterSettings->initialTime_,
+                        extendedKalmanFilterSettings->initialStateEstimate_, extendedKalmanFilterSettings->initialCovarianceEstimate_,
+                        extendedKalmanFilterSettings->integratorSettings_ );
+        }
         break;
     }
     case unscented_kalman_filter:
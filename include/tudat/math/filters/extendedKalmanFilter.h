@@ -86,6 +86,20 @@ public:
         stateJacobianFunction_( stateJacobianFunction ), stateNoiseJacobianFunction_( stateNoiseJacobianFunction ),
         measurementJacobianFunction_( measurementJacobianFunction ), measurementNoiseJacobianFunction_( measurementNoiseJacobianFunction )
     {
+        // Allocate workspace used at each filter step
+        const int stateDimension = systemUncertainty.rows( );
+        const int measurementDimension = measurementUncertainty.rows( );
+        aPrioriStateEstimate_ = DependentVector::Zero( stateDimension );
+        measurementEstimate_ = DependentVector::Zero( measurementDimension );
+        currentStateJacobianMatrix_ = DependentMatrix::Zero( stateDimension, stateDimension );
+        currentStateNoiseJacobianMatrix_ = DependentMatrix::Zero( stateDimension, stateDimension );
+        currentMeasurementJacobianMatrix_ = DependentMatrix::Zero( measurementDimension, stateDimension );
+        currentMeasurementNoiseJacobianMatrix_ = DependentMatrix::Zero( measurementDimension, measurementDimension );
+        aPrioriCovarianceEstimate_ = DependentMatrix::Zero( stateDimension, stateDimension );
+        systemNoiseProduct_ = DependentMatrix::Zero( stateDimension, stateDimension );
+        measurementNoiseProduct_ = DependentMatrix::Zero( measurementDimension, measurementDimension );
+        measurementNoiseCovariance_ = DependentMatrix::Zero( measurementDimension, measurementDimension );
+
         // Compute the discrete-time version of the system Jacobians
         if ( this->isStateToBeIntegrated_ )
         {
@@ -106,45 +120,57 @@ public:
 	void updateFilter( const DependentVector& currentMeasurementVector )
     {
         // Prediction step
-        DependentVector aPrioriStateEstimate = this->predictState( );
-        DependentMatrix currentStateJacobianMatrix;
-        DependentMatrix currentStateNoiseJacobianMatrix;
-        if ( this->isStateToBeIntegrated_ )
-        {
-            std::pair< DependentMatrix, DependentMatrix > discreteTimeJacobians =
-                    discreteTimeStateJacobians_( aPrioriStateEstimate );
-            currentStateJacobianMatrix = discreteTimeJacobians.first;
-            currentStateNoiseJacobianMatrix = discreteTimeJacobians.second;
-        }
-        else
-        {
-            currentStateJacobianMatrix = stateJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
-            currentStateNoiseJacobianMatrix = stateNoiseJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
-        }
-        DependentVector measurementEstimate = this->measurementFunction_( this->currentTime_, aPrioriStateEstimate );
+        aPrioriStateEstimate_ = this->predictState( );
+        computeSystemJacobians( aPrioriStateEstimate_, currentStateJacobianMatrix_, currentStateNoiseJacobianMatrix_ );
+        measurementEstimate_ = this->measurementFunction_( this->currentTime_, aPrioriStateEstimate_ );
 
         // Compute remaining Jacobians
-        DependentMatrix currentMeasurementJacobianMatrix = measurementJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
-        DependentMatrix currentMeasurementNoiseJacobianMatrix = measurementNoiseJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
+        currentMeasurementJacobianMatrix_ = measurementJacobianFunction_( this->currentTime_, aPrioriStateEstimate_ );
+        currentMeasurementNoiseJacobianMatrix_ = measurementNoiseJacobianFunction_( this->currentTime_, aPrioriStateEstimate_ );
 
         // Prediction step (continued)
-        DependentMatrix aPrioriCovarianceEstimate = currentStateJacobianMatrix * this->aPosterioriCovarianceEstimate_ *
-                currentStateJacobianMatrix.transpose( ) + currentStateNoiseJacobianMatrix * this->systemUncertainty_ *
-                currentStateNoiseJacobianMatrix.transpose( );
+        this->stateCovarianceProduct_.noalias( ) = currentStateJacobianMatrix_ * this->aPosterioriCovarianceEstimate_;
+        aPrioriCovarianceEstimate_.noalias( ) = this->stateCovarianceProduct_ * currentStateJacobianMatrix_.transpose( );
+        systemNoiseProduct_.noalias( ) = currentStateNoiseJacobianMatrix_ * this->systemUncertainty_;
+        aPrioriCovarianceEstimate_.noalias( ) += systemNoiseProduct_ * currentStateNoiseJacobianMatrix_.transpose( );
 
         // Compute Kalman gain
-        DependentMatrix kalmanGain = aPrioriCovarianceEstimate * currentMeasurementJacobianMatrix.transpose( ) * (
-                    currentMeasurementJacobianMatrix * aPrioriCovarianceEstimate * currentMeasurementJacobianMatrix.transpose( ) +
-                    currentMeasurementNoiseJacobianMatrix * this->measurementUncertainty_ *
-                    currentMeasurementNoiseJacobianMatrix.transpose( ) ).inverse( );
+        measurementNoiseProduct_.noalias( ) = currentMeasurementNoiseJacobianMatrix_ * this->measurementUncertainty_;
+        measurementNoiseCovariance_.noalias( ) = measurementNoiseProduct_ * currentMeasurementNoiseJacobianMatrix_.transpose( );
+        this->computeKalmanGain( aPrioriCovarianceEstimate_, currentMeasurementJacobianMatrix_, measurementNoiseCovariance_ );
 
         // Correction step
         this->currentTime_ += this->filteringStepSize_;
-        this->correctState( aPrioriStateEstimate, currentMeasurementVector, measurementEstimate, kalmanGain );
-        this->correctCovariance( aPrioriCovarianceEstimate, currentMeasurementJacobianMatrix, kalmanGain );
+        this->correctState( aPrioriStateEstimate_, currentMeasurementVector, measurementEstimate_, this->kalmanGain_ );
+        this->correctCovariance( aPrioriCovarianceEstimate_, currentMeasurementJacobianMatrix_, this->kalmanGain_ );
     }
 
-private:
+protected:
+
+    //! Function to compute the (discrete-time) system Jacobians.
+    /*!
+     *  Function to compute the Jacobians of the system function w.r.t. the state and the system noise. If the state is
+     *  integrated, the discrete-time versions of the Jacobians are returned.
+     *  \param aPrioriStateEstimate Vector denoting the a-priori state estimate, at which the Jacobians are evaluated.
+     *  \param stateJacobianMatrix Jacobian of the system function w.r.t. the state (returned by reference).
+     *  \param stateNoiseJacobianMatrix Jacobian of the system function w.r.t. the system noise (returned by reference).
+     */
+    void computeSystemJacobians( const DependentVector& aPrioriStateEstimate, DependentMatrix& stateJacobianMatrix,
+                                 DependentMatrix& stateNoiseJacobianMatrix )
+    {
+        if ( this->isStateToBeIntegrated_ )
+        {
+            std::pair< DependentMatrix, DependentMatrix > discreteTimeJacobians =
+                    discreteTimeStateJacobians_( aPrioriStateEstimate );
+            stateJacobianMatrix = discreteTimeJacobians.first;
+            stateNoiseJacobianMatrix = discreteTimeJacobians.second;
+        }
+        else
+        {
+            stateJacobianMatrix = stateJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
+            stateNoiseJacobianMatrix = stateNoiseJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
+        }
+    }
 
     //! Function to create the function that defines the system model.
     /*!
@@ -247,6 +273,36 @@ private:
      */
     std::function< std::pair< DependentMatrix, DependentMatrix >( const DependentVector& ) > discreteTimeStateJacobians_;
 
+    //! A-priori state estimate of the current step (workspace).
+    DependentVector aPrioriStateEstimate_;
+
+    //! Estimated measurement of the current step (workspace).
+    DependentVector measurementEstimate_;
+
+    //! Jacobian of the system function w.r.t. the state, for the current step (workspace).
+    DependentMatrix currentStateJacobianMatrix_;
+
+    //! Jacobian of the system function w.r.t. the system noise, for the current step (workspace).
+    DependentMatrix currentStateNoiseJacobianMatrix_;
+
+    //! Jacobian of the measurement function w.r.t. the state, for the current step (workspace).
+    DependentMatrix currentMeasurementJacobianMatrix_;
+
+    //! Jacobian of the measurement function w.r.t. the measurement noise, for the current step (workspace).
+    DependentMatrix currentMeasurementNoiseJacobianMatrix_;
+
+    //! A-priori covariance estimate of the current step (workspace).
+    DependentMatrix aPrioriCovarianceEstimate_;
+
+    //! Product of system noise Jacobian and system uncertainty (workspace).
+    DependentMatrix systemNoiseProduct_;
+
+    //! Product of measurement noise Jacobian and measurement uncertainty (workspace).
+    DependentMatrix measurementNoiseProduct_;
+
+    //! Covariance of the measurement noise, as it enters the measurement (workspace).
+    DependentMatrix measurementNoiseCovariance_;
+
 };
 
 //! Typedef for a filter with double data type.
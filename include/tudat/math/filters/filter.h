@@ -15,6 +15,7 @@
 #include <map>
 #include <limits>
 #include <iostream>
+#include <algorithm>
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
@@ -24,9 +25,11 @@
 #include <memory>
 #include <functional>
 
+#include <boost/random/mersenne_twister.hpp>
+
 #include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/filters/filterHistoryBuffer.h"
 #include "tudat/math/integrators/createNumericalIntegrator.h"
-#include "tudat/math/statistics/randomVariableGenerator.h"
 
 #include "tudat/basics/identityElements.h"
 #include "tudat/basics/utilities.h"
@@ -89,7 +92,8 @@ public:
                 const std::shared_ptr< IntegratorSettings > integratorSettings ) :
         systemUncertainty_( systemUncertainty ), measurementUncertainty_( measurementUncertainty ),
         filteringStepSize_( filteringStepSize ), initialTime_( initialTime ), currentTime_( initialTime ),
-        aPosterioriStateEstimate_( initialStateVector ), aPosterioriCovarianceEstimate_( initialCovarianceMatrix )
+        aPosterioriStateEstimate_( initialStateVector ), aPosterioriCovarianceEstimate_( initialCovarianceMatrix ),
+        maximumHistoryLength_( 0 ), saveCovarianceHistory_( true ), noiseRandomNumberGenerator_( 0 )
     {
         // Check that uncertainty matrices are square
         if ( systemUncertainty_.rows( ) != systemUncertainty_.cols( ) )
@@ -109,6 +113,7 @@ public:
 
         // Create noise distributions
         generateNoiseDistributions( );
+        measurementResidual_ = DependentVector::Zero( measurementUncertainty_.rows( ) );
 
         // Create system and measurement functions based on input parameters// Get time step information
         systemFunction_ = std::bind( &FilterBase< IndependentVariableType, DependentVariableType >::createSystemFunction,
@@ -127,8 +132,8 @@ public:
         identityMatrix_ = DependentMatrix::Identity( systemUncertainty_.rows( ), systemUncertainty_.cols( ) );
 
         // Add initial values to history
-        historyOfStateEstimates_[ initialTime ] = aPosterioriStateEstimate_;
-        historyOfCovarianceEstimates_[ initialTime ] = aPosterioriCovarianceEstimate_;
+        historyOfStateEstimates_.push( initialTime, aPosterioriStateEstimate_ );
+        historyOfCovarianceEstimates_.push( initialTime, aPosterioriCovarianceEstimate_ );
     }
 
     //! Destructor.
@@ -150,22 +155,25 @@ public:
      */
     DependentVector produceSystemNoise( )
     {
-        // Declare system noise vector
         DependentVector systemNoise = DependentVector::Zero( systemUncertainty_.rows( ) );
+        produceSystemNoise( systemNoise );
+        return systemNoise;
+    }
 
-        // Loop over dimensions and add noise
-        for ( int i = 0; i < systemUncertainty_.rows( ); i++ )
-        {
-            if ( systemNoiseDistribution_.at( i ) != nullptr )
-            {
-                systemNoise[ i ] = static_cast< DependentVariableType >(
-                            systemNoiseDistribution_.at( i )->getRandomVariableValue( ) );
-            }
-        }
+    //! Function to produce system noise, by overwriting the input vector.
+    /*!
+     *  Function to produce system noise, by overwriting the input vector. The noise is drawn from a single random number
+     *  stream for all elements (see resetNoiseSeed), and does not allocate memory if the input vector has the correct size.
+     *  \param systemNoise Vector representing system noise (returned by reference).
+     */
+    void produceSystemNoise( DependentVector& systemNoise )
+    {
+        generateStandardNormalSamples( systemUncertainty_.rows( ) );
+        systemNoise = ( systemNoiseStandardDeviations_ * standardNormalSamples_.head( systemUncertainty_.rows( ) ) ).
+                template cast< DependentVariableType >( ).matrix( );
 
-        // Give back noise
-        systemNoiseHistory_.push_back( systemNoise );
-        return systemNoise;
+        // Store noise
+        systemNoiseHistory_.push( currentTime_, systemNoise );
     }
 
     //! Function to produce measurement noise.
@@ -176,22 +184,39 @@ public:
      */
     DependentVector produceMeasurementNoise( )
     {
-        // Declare measurement noise vector
         DependentVector measurementNoise = DependentVector::Zero( measurementUncertainty_.rows( ) );
+        produceMeasurementNoise( measurementNoise );
+        return measurementNoise;
+    }
 
-        // Loop over dimensions and add noise
-        for ( int i = 0; i < measurementUncertainty_.rows( ); i++ )
-        {
-            if ( measurementNoiseDistribution_.at( i ) != nullptr )
-            {
-                measurementNoise[ i ] = static_cast< DependentVariableType >(
-                            measurementNoiseDistribution_.at( i )->getRandomVariableValue( ) );
-            }
-        }
+    //! Function to produce measurement noise, by overwriting the input vector.
+    /*!
+     *  Function to produce measurement noise, by overwriting the input vector. The noise is drawn from a single random
+     *  number stream for all elements (see resetNoiseSeed), and does not allocate memory if the input vector has the
+     *  correct size.
+     *  \param measurementNoise Vector representing measurement noise (returned by reference).
+     */
+    void produceMeasurementNoise( DependentVector& measurementNoise )
+    {
+        generateStandardNormalSamples( measurementUncertainty_.rows( ) );
+        measurementNoise = ( measurementNoiseStandardDeviations_ *
+                             standardNormalSamples_.head( measurementUncertainty_.rows( ) ) ).
+                template cast< DependentVariableType >( ).matrix( );
 
-        // Give back noise
-        measurementNoiseHistory_.push_back( measurementNoise );
-        return measurementNoise;
+        // Store noise
+        measurementNoiseHistory_.push( currentTime_, measurementNoise );
+    }
+
+    //! Function to reset the seed of the random number stream used to produce system and measurement noise.
+    /*!
+     *  Function to reset the seed of the random number stream used to produce system and measurement noise. By default,
+     *  the seed is equal to 0. Filters that are run in parallel (e.g., in a Monte Carlo analysis) should be given
+     *  different seeds.
+     *  \param seed Seed of the random number stream.
+     */
+    void resetNoiseSeed( const unsigned int seed )
+    {
+        noiseRandomNumberGenerator_.seed( seed );
     }
 
     //! Function to retrieve step-size for filtering.
@@ -214,10 +239,11 @@ public:
     //! Function to retrieve current covariance estimate.
     /*!
      *  Function to retrieve current covariance estimate. The covariance estimate needs to first be computed by
-     *  updating the filter with the updateFilter function.
+     *  updating the filter with the updateFilter function. This function is overridden by filters that propagate
+     *  a factorization of the covariance, in which case the full matrix is only formed when requested.
      *  \return Current state estimate.
      */
-    DependentMatrix getCurrentCovarianceEstimate( ) { return aPosterioriCovarianceEstimate_; }
+    virtual DependentMatrix getCurrentCovarianceEstimate( ) { return aPosterioriCovarianceEstimate_; }
 
     //! Function to retrieve the history of estimated states.
     /*!
@@ -226,7 +252,7 @@ public:
      */
     std::map< IndependentVariableType, DependentVector > getEstimatedStateHistory( )
     {
-        return historyOfStateEstimates_;
+        return historyOfStateEstimates_.getHistoryMap( );
     }
 
     //! Function to retrieve the history of estimated covariance matrices.
@@ -235,6 +261,28 @@ public:
      *  \return History of estimated covariance matrices for each time step.
      */
     std::map< IndependentVariableType, DependentMatrix > getEstimatedCovarianceHistory( )
+    {
+        return historyOfCovarianceEstimates_.getHistoryMap( );
+    }
+
+    //! Function to retrieve the buffer in which the estimated states are stored.
+    /*!
+     *  Function to retrieve the buffer in which the estimated states are stored. Contrary to getEstimatedStateHistory,
+     *  the stored entries can be accessed without copying them.
+     *  \return Buffer of estimated states.
+     */
+    const FilterHistoryBuffer< IndependentVariableType, DependentVector >& getEstimatedStateHistoryBuffer( )
+    {
+        return historyOfStateEstimates_;
+    }
+
+    //! Function to retrieve the buffer in which the estimated covariance matrices are stored.
+    /*!
+     *  Function to retrieve the buffer in which the estimated covariance matrices are stored. Contrary to
+     *  getEstimatedCovarianceHistory, the stored entries can be accessed without copying them.
+     *  \return Buffer of estimated covariance matrices.
+     */
+    const FilterHistoryBuffer< IndependentVariableType, DependentMatrix >& getEstimatedCovarianceHistoryBuffer( )
     {
         return historyOfCovarianceEstimates_;
     }
@@ -246,7 +294,7 @@ public:
      */
     std::pair< std::vector< DependentVector >, std::vector< DependentVector > > getNoiseHistory( )
     {
-        return std::make_pair( systemNoiseHistory_, measurementNoiseHistory_ );
+        return std::make_pair( systemNoiseHistory_.getHistoryVector( ), measurementNoiseHistory_.getHistoryVector( ) );
     }
 
     //! Function to modify the step size for filtering.
@@ -276,8 +324,8 @@ public:
      *  \param newStateEstimate Vector denoting the new a-posteriori state estimate.
      *  \param newCovarianceEstimate Matrix denoting the new a-posteriori covariance estimate.
      */
-    void modifyCurrentStateAndCovarianceEstimates( const DependentVector& newStateEstimate,
-                                                   const DependentMatrix& newCovarianceEstimate = DependentMatrix::Zero( ) )
+    virtual void modifyCurrentStateAndCovarianceEstimates( const DependentVector& newStateEstimate,
+                                                           const DependentMatrix& newCovarianceEstimate = DependentMatrix::Zero( ) )
     {
         // Update estimates with user-provided data
         aPosterioriStateEstimate_ = newStateEstimate;
@@ -287,6 +335,39 @@ public:
         }
     }
 
+    //! Function to set how much of the history of the filter is stored.
+    /*!
+     *  Function to set how much of the history of the filter is stored. By default, the state and covariance estimates
+     *  (and the noise and filter-specific variables) of all time steps are stored, which may use a large amount of memory
+     *  if the filter is run for very long times, or at high rate. If a maximum length is set, the histories are stored in
+     *  fixed-capacity ring buffers, which are allocated once by this function, such that storing the history does not
+     *  allocate memory during filtering (e.g., when running many filters in a Monte Carlo analysis).
+     *  \param maximumHistoryLength Maximum number of entries stored in each history; when exceeded, the oldest entries
+     *      are discarded. Unbounded if equal to zero.
+     *  \param saveCovarianceHistory Boolean denoting whether the covariance estimates are to be stored in the history.
+     *      Note that reverting to the previous time step is only possible if this is the case.
+     */
+    void setHistoryStorage( const unsigned int maximumHistoryLength, const bool saveCovarianceHistory = true )
+    {
+        maximumHistoryLength_ = maximumHistoryLength;
+        saveCovarianceHistory_ = saveCovarianceHistory;
+        if ( !saveCovarianceHistory_ )
+        {
+            historyOfCovarianceEstimates_.clear( );
+        }
+
+        // Allocate (or release) storage for histories
+        const unsigned int stateDimension = systemUncertainty_.rows( );
+        const unsigned int measurementDimension = measurementUncertainty_.rows( );
+        historyOfStateEstimates_.setCapacity( maximumHistoryLength_, DependentVector::Zero( stateDimension ) );
+        historyOfCovarianceEstimates_.setCapacity(
+                    saveCovarianceHistory_ ? maximumHistoryLength_ : 0,
+                    DependentMatrix::Zero( stateDimension, stateDimension ) );
+        systemNoiseHistory_.setCapacity( maximumHistoryLength_, DependentVector::Zero( stateDimension ) );
+        measurementNoiseHistory_.setCapacity( maximumHistoryLength_, DependentVector::Zero( measurementDimension ) );
+        setSpecificFilterHistoryStorage( );
+    }
+
     //! Function to clear the history of stored variables.
     /*!
      *  Function to clear the history of stored variables. This function should be called if the history of state and covariance
@@ -310,28 +391,34 @@ public:
         currentTime_ -= filteringStepSize_;
 
         // Erase state estimate corresponding to current time
-        if ( historyOfStateEstimates_.count( timeToBeRemoved ) != 0 )
+        if ( !historyOfStateEstimates_.empty( ) && historyOfStateEstimates_.backTime( ) == timeToBeRemoved )
         {
-            historyOfStateEstimates_.erase( timeToBeRemoved );
+            historyOfStateEstimates_.popBack( );
         }
-        aPosterioriStateEstimate_ = historyOfStateEstimates_.rbegin( )->second;
+        if ( historyOfStateEstimates_.empty( ) )
+        {
+            throw std::runtime_error( "Error while reverting filter to previous time step. No previous state is stored." );
+        }
+        aPosterioriStateEstimate_ = historyOfStateEstimates_.back( );
 
         // Erase covariance estimate corresponding to current time
-        if ( historyOfCovarianceEstimates_.count( timeToBeRemoved ) != 0 )
+        if ( historyOfCovarianceEstimates_.empty( ) )
         {
-            historyOfCovarianceEstimates_.erase( timeToBeRemoved );
+            throw std::runtime_error( "Error while reverting filter to previous time step. No covariance history is stored." );
         }
-        aPosterioriCovarianceEstimate_ = historyOfCovarianceEstimates_.rbegin( )->second;
-
-        // Erase last noise entries
-        if ( !systemNoiseHistory_.empty( ) )
+        if ( historyOfCovarianceEstimates_.backTime( ) == timeToBeRemoved )
         {
-            systemNoiseHistory_.pop_back( );
+            historyOfCovarianceEstimates_.popBack( );
         }
-        if ( !measurementNoiseHistory_.empty( ) )
+        if ( historyOfCovarianceEstimates_.empty( ) )
         {
-            measurementNoiseHistory_.pop_back( );
+            throw std::runtime_error( "Error while reverting filter to previous time step. No previous covariance is stored." );
         }
+        aPosterioriCovarianceEstimate_ = historyOfCovarianceEstimates_.back( );
+
+        // Erase last noise entries
+        systemNoiseHistory_.popBack( );
+        measurementNoiseHistory_.popBack( );
 
         // Revert elements specific to each filter
         specificRevertToPreviousTimeStep( timeToBeRemoved );
@@ -381,8 +468,39 @@ protected:
     void correctState( const DependentVector& aPrioriStateEstimate, const DependentVector& currentMeasurementVector,
                        const DependentVector& measurementEstimate, const DependentMatrix& gainMatrix )
     {
-        aPosterioriStateEstimate_ = aPrioriStateEstimate + gainMatrix * ( currentMeasurementVector - measurementEstimate );
-        historyOfStateEstimates_[ currentTime_ ] = aPosterioriStateEstimate_;
+        measurementResidual_.noalias( ) = currentMeasurementVector - measurementEstimate;
+        aPosterioriStateEstimate_ = aPrioriStateEstimate;
+        aPosterioriStateEstimate_.noalias( ) += gainMatrix * measurementResidual_;
+        saveStateEstimateToHistory( );
+    }
+
+    //! Function to store the current a-posteriori state estimate in the history.
+    void saveStateEstimateToHistory( )
+    {
+        historyOfStateEstimates_.push( currentTime_, aPosterioriStateEstimate_ );
+    }
+
+    //! Function to store the current a-posteriori covariance estimate in the history (if requested).
+    void saveCovarianceEstimateToHistory( )
+    {
+        if ( saveCovarianceHistory_ )
+        {
+            historyOfCovarianceEstimates_.push( currentTime_, getCurrentCovarianceEstimate( ) );
+        }
+    }
+
+    //! Function to store the provided covariance estimate in the history (if requested).
+    /*!
+     *  Function to store the provided covariance estimate in the history (if requested). Used by filters that store the
+     *  covariance directly, such that no copy of the covariance has to be created at each time step.
+     *  \param currentCovarianceEstimate Current a-posteriori covariance estimate.
+     */
+    void saveCovarianceEstimateToHistory( const DependentMatrix& currentCovarianceEstimate )
+    {
+        if ( saveCovarianceHistory_ )
+        {
+            historyOfCovarianceEstimates_.push( currentTime_, currentCovarianceEstimate );
+        }
     }
 
     //! Function to correct the covariance for the next time step.
@@ -400,6 +518,14 @@ protected:
      */
     virtual void clearSpecificFilterHistory( ) { }
 
+    //! Function to set how much of the history is stored, for derived class-specific variables.
+    /*!
+     *  Function to set how much of the history is stored, for derived class-specific variables, based on the
+     *  maximumHistoryLength_ member. This function can be overwritten in a derived class, to allocate the storage of other
+     *  variables that are stored at each time step.
+     */
+    virtual void setSpecificFilterHistoryStorage( ) { }
+
     //! Function to revert to the previous time step for derived class-specific variables.
     /*!
      *  Function to revert to the previous time step for derived class-specific variables. This function can be overwritten in
@@ -465,57 +591,70 @@ protected:
      */
     DependentMatrix identityMatrix_;
 
-    //! Map of estimated states vectors history.
-    std::map< IndependentVariableType, DependentVector > historyOfStateEstimates_;
+    //! Vector representing the difference between the current measurement and its estimate.
+    DependentVector measurementResidual_;
+
+    //! History of estimated states vectors.
+    FilterHistoryBuffer< IndependentVariableType, DependentVector > historyOfStateEstimates_;
+
+    //! History of estimated covariance matrices.
+    FilterHistoryBuffer< IndependentVariableType, DependentMatrix > historyOfCovarianceEstimates_;
 
-    //! Map of estimated covariance matrices history.
-    std::map< IndependentVariableType, DependentMatrix > historyOfCovarianceEstimates_;
+    //! Maximum number of entries stored in each history (unbounded if zero).
+    unsigned int maximumHistoryLength_;
+
+    //! Boolean denoting whether the covariance estimates are stored in the history.
+    bool saveCovarianceHistory_;
 
 private:
 
     //! Function to generate the noise distributions for both system and measurement modeling.
     /*!
      *  Function to generate the noise distributions for both system and measurement modeling, which uses
-     *  a Gaussian distribution, with zero mean and standard deviation given by the diagonal elements of the
-     *  input system and measurement uncertainty matrices.
+     *  a Gaussian distribution, with zero mean and standard deviation given by the square root of the diagonal elements of
+     *  the input system and measurement uncertainty matrices. The buffers used for the generation of the noise are
+     *  allocated as well.
      */
     void generateNoiseDistributions( )
     {
-        using namespace tudat::statistics;
+        // Retrieve standard deviations
+        systemNoiseStandardDeviations_ = systemUncertainty_.diagonal( ).template cast< double >( ).array( ).sqrt( );
+        measurementNoiseStandardDeviations_ = measurementUncertainty_.diagonal( ).template cast< double >( ).array( ).sqrt( );
+
+        // Allocate buffers for pairs of random samples
+        const int maximumNumberOfPairs =
+                ( std::max( systemUncertainty_.rows( ), measurementUncertainty_.rows( ) ) + 1 ) / 2;
+        uniformSamples_.resize( 2 * maximumNumberOfPairs );
+        standardNormalSamples_.resize( 2 * maximumNumberOfPairs );
+        boxMullerRadii_.resize( maximumNumberOfPairs );
+        boxMullerAngles_.resize( maximumNumberOfPairs );
+    }
 
-        // Create system noise
-        for ( unsigned int i = 0; i < systemUncertainty_.rows( ); i++ )
+    //! Function to generate samples of the standard normal distribution, for the production of noise.
+    /*!
+     *  Function to generate samples of the standard normal distribution, for the production of noise. Uniform samples are
+     *  drawn from a single random number stream, after which they are transformed to normally distributed samples with the
+     *  Box-Muller transform, evaluated for all samples at once.
+     *  \param numberOfSamples Number of samples that are required; these are stored in the first entries of the
+     *      standardNormalSamples_ member.
+     */
+    void generateStandardNormalSamples( const int numberOfSamples )
+    {
+        // Draw uniform samples in the open interval (0,1)
+        const int numberOfPairs = ( numberOfSamples + 1 ) / 2;
+        for ( int i = 0; i < 2 * numberOfPairs; i++ )
         {
-            if ( static_cast< double >( systemUncertainty_( i, i ) ) != 0.0 )
-            {
-                systemNoiseDistribution_.push_back(
-                            createBoostContinuousRandomVariableGenerator(
-                                normal_boost_distribution, { 0.0, static_cast< double >(
-                                                             std::sqrt( systemUncertainty_( i, i ) ) ) },
-                                static_cast< double >( i ) ) );
-            }
-            else
-            {
-                systemNoiseDistribution_.push_back( nullptr );
-            }
+            uniformSamples_( i ) = ( static_cast< double >( noiseRandomNumberGenerator_( ) ) + 0.5 ) / 4294967296.0;
         }
 
-        // Create measurement noise
-        for ( unsigned int i = 0; i < measurementUncertainty_.rows( ); i++ )
-        {
-            if ( static_cast< double >( measurementUncertainty_( i, i ) ) != 0.0 )
-            {
-                measurementNoiseDistribution_.push_back(
-                            createBoostContinuousRandomVariableGenerator(
-                                normal_boost_distribution, { 0.0, static_cast< double >(
-                                                             std::sqrt( measurementUncertainty_( i, i ) ) ) },
-                                static_cast< double >( systemUncertainty_.rows( ) + i ) ) );
-            }
-            else
-            {
-                measurementNoiseDistribution_.push_back( nullptr );
-            }
-        }
+        // Apply Box-Muller transform
+        boxMullerRadii_.head( numberOfPairs ) = ( -2.0 * uniformSamples_.head( numberOfPairs ).log( ) ).sqrt( );
+        boxMullerAngles_.head( numberOfPairs ) =
+                2.0 * mathematical_constants::PI * uniformSamples_.segment( numberOfPairs, numberOfPairs );
+        standardNormalSamples_.head( numberOfPairs ) =
+                boxMullerRadii_.head( numberOfPairs ) * boxMullerAngles_.head( numberOfPairs ).cos( );
+        standardNormalSamples_.segment( numberOfPairs, numberOfPairs ) =
+                boxMullerRadii_.head( numberOfPairs ) * boxMullerAngles_.head( numberOfPairs ).sin( );
     }
 
     //! Function to generate the numerical integrator to be used for propagation of the state.
@@ -540,7 +679,7 @@ private:
         case numerical_integrators::rungeKutta4:
         {
             integrator_ = numerical_integrators::createIntegrator< IndependentVariableType, DependentVector >(
-                        systemFunction_, aPosterioriStateEstimate_, integratorSettings );
+                        systemFunction_, aPosterioriStateEstimate_, initialTime_, integratorSettings );
             break;
         }
         case numerical_integrators::rungeKuttaVariableStepSize:
@@ -551,7 +690,7 @@ private:
 
             // Create integrator object
             integrator_ = numerical_integrators::createIntegrator< IndependentVariableType, DependentVector >(
-                        systemFunction_, aPosterioriStateEstimate_, integratorSettings );
+                        systemFunction_, aPosterioriStateEstimate_, initialTime_, integratorSettings );
 
             // Turn off step-size control
             integrator_->setStepSizeControl( false );
@@ -562,17 +701,32 @@ private:
         }
     }
 
-    //! Vector where the system noise generators are stored.
-    std::vector< std::shared_ptr< statistics::RandomVariableGenerator< double > > > systemNoiseDistribution_;
+    //! Random number stream from which the system and measurement noise are generated.
+    boost::random::mt19937 noiseRandomNumberGenerator_;
+
+    //! Standard deviations of the system noise.
+    Eigen::ArrayXd systemNoiseStandardDeviations_;
+
+    //! Standard deviations of the measurement noise.
+    Eigen::ArrayXd measurementNoiseStandardDeviations_;
+
+    //! Buffer of uniformly distributed samples, used for the generation of noise.
+    Eigen::ArrayXd uniformSamples_;
+
+    //! Buffer of normally distributed samples, used for the generation of noise.
+    Eigen::ArrayXd standardNormalSamples_;
+
+    //! Buffer of radii in the Box-Muller transform, used for the generation of noise.
+    Eigen::ArrayXd boxMullerRadii_;
 
-    //! Vector where the measurement noise generators are stored.
-    std::vector< std::shared_ptr< statistics::RandomVariableGenerator< double > > > measurementNoiseDistribution_;
+    //! Buffer of angles in the Box-Muller transform, used for the generation of noise.
+    Eigen::ArrayXd boxMullerAngles_;
 
-    //! Vector of system noise hisotries.
-    std::vector< DependentVector > systemNoiseHistory_;
+    //! History of system noise.
+    FilterHistoryBuffer< IndependentVariableType, DependentVector > systemNoiseHistory_;
 
-    //! Vector of measurement noise hisotries.
-    std::vector< DependentVector > measurementNoiseHistory_;
+    //! History of measurement noise.
+    FilterHistoryBuffer< IndependentVariableType, DependentVector > measurementNoiseHistory_;
 
 };
 
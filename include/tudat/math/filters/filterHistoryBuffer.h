@@ -0,0 +1,243 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_FILTER_HISTORY_BUFFER_H
+#define TUDAT_FILTER_HISTORY_BUFFER_H
+
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+namespace tudat
+{
+
+namespace filters
+{
+
+//! Buffer used to store the history of a filter, either without bound or as a fixed-capacity ring buffer.
+/*!
+ *  Buffer used to store the history of a filter. By default, all entries are stored. If a capacity is set, the buffer acts
+ *  as a ring buffer: all entries are allocated when the capacity is set, by copying a template value, and adding an entry
+ *  overwrites the oldest one once the buffer is full, by assignment to the existing entry. For Eigen types of equal size,
+ *  this does not allocate memory, such that the history of a filter may be stored at every step without heap allocation.
+ *  \tparam IndependentVariableType Type of independent variable (i.e., time).
+ *  \tparam ValueType Type of stored values.
+ */
+template< typename IndependentVariableType, typename ValueType >
+class FilterHistoryBuffer
+{
+public:
+
+    //! Constructor, creates a buffer without bound on its number of entries.
+    FilterHistoryBuffer( ): maximumNumberOfEntries_( 0 ), firstEntry_( 0 ), numberOfEntries_( 0 ) { }
+
+    //! Constructor for a fixed-capacity (ring) buffer.
+    /*!
+     *  Constructor for a fixed-capacity (ring) buffer.
+     *  \param capacity Maximum number of entries in the buffer (unbounded if equal to zero).
+     *  \param templateValue Value with which the entries are pre-allocated (should be of the same size as the values that
+     *      are to be stored).
+     */
+    FilterHistoryBuffer( const unsigned int capacity, const ValueType& templateValue ):
+        maximumNumberOfEntries_( 0 ), firstEntry_( 0 ), numberOfEntries_( 0 )
+    {
+        setCapacity( capacity, templateValue );
+    }
+
+    //! Function to reset the maximum number of entries in the buffer.
+    /*!
+     *  Function to reset the maximum number of entries in the buffer. The most recent entries, up to the new capacity, are
+     *  retained.
+     *  \param capacity Maximum number of entries in the buffer (unbounded if equal to zero).
+     *  \param templateValue Value with which the entries are pre-allocated, if the buffer is bounded.
+     */
+    void setCapacity( const unsigned int capacity, const ValueType& templateValue )
+    {
+        // Retrieve current entries, from oldest to most recent
+        std::vector< IndependentVariableType > currentTimes;
+        std::vector< ValueType > currentValues;
+        unsigned int numberOfRetainedEntries =
+                ( capacity > 0 && capacity < numberOfEntries_ ) ? capacity : numberOfEntries_;
+        for ( unsigned int i = numberOfEntries_ - numberOfRetainedEntries; i < numberOfEntries_; i++ )
+        {
+            currentTimes.push_back( getTime( i ) );
+            currentValues.push_back( getValue( i ) );
+        }
+
+        // Reset storage and re-insert entries
+        maximumNumberOfEntries_ = capacity;
+        times_.clear( );
+        values_.clear( );
+        if ( capacity > 0 )
+        {
+            times_.resize( capacity );
+            values_.resize( capacity, templateValue );
+        }
+        clear( );
+        for ( unsigned int i = 0; i < currentTimes.size( ); i++ )
+        {
+            push( currentTimes.at( i ), currentValues.at( i ) );
+        }
+    }
+
+    //! Function to add an entry to the buffer, overwriting the oldest entry if the buffer is bounded and full.
+    /*!
+     *  Function to add an entry to the buffer, overwriting the oldest entry if the buffer is bounded and full. Note that,
+     *  contrary to a std::map, entries are stored in the order in which they are added.
+     *  \param time Independent variable associated with the entry.
+     *  \param value Value that is to be stored.
+     */
+    void push( const IndependentVariableType time, const ValueType& value )
+    {
+        if ( maximumNumberOfEntries_ == 0 )
+        {
+            times_.push_back( time );
+            values_.push_back( value );
+            numberOfEntries_++;
+            return;
+        }
+
+        unsigned int index;
+        if ( numberOfEntries_ < maximumNumberOfEntries_ )
+        {
+            index = ( firstEntry_ + numberOfEntries_ ) % maximumNumberOfEntries_;
+            numberOfEntries_++;
+        }
+        else
+        {
+            index = firstEntry_;
+            firstEntry_ = ( firstEntry_ + 1 ) % maximumNumberOfEntries_;
+        }
+        times_[ index ] = time;
+        values_[ index ] = value;
+    }
+
+    //! Function to remove the most recent entry from the buffer.
+    void popBack( )
+    {
+        if ( numberOfEntries_ > 0 )
+        {
+            numberOfEntries_--;
+            if ( maximumNumberOfEntries_ == 0 )
+            {
+                times_.pop_back( );
+                values_.pop_back( );
+            }
+        }
+    }
+
+    //! Function to remove all entries from the buffer (memory of bounded buffer is retained).
+    void clear( )
+    {
+        if ( maximumNumberOfEntries_ == 0 )
+        {
+            times_.clear( );
+            values_.clear( );
+        }
+        firstEntry_ = 0;
+        numberOfEntries_ = 0;
+    }
+
+    //! Function to retrieve the maximum number of entries (unbounded if equal to zero).
+    unsigned int capacity( ) const { return maximumNumberOfEntries_; }
+
+    //! Function to retrieve the current number of entries.
+    unsigned int size( ) const { return numberOfEntries_; }
+
+    //! Function to retrieve whether the buffer is empty.
+    bool empty( ) const { return numberOfEntries_ == 0; }
+
+    //! Function to retrieve the independent variable of an entry (index 0 is the oldest entry).
+    IndependentVariableType getTime( const unsigned int index ) const
+    {
+        return times_[ getStorageIndex( index ) ];
+    }
+
+    //! Function to retrieve the value of an entry (index 0 is the oldest entry).
+    const ValueType& getValue( const unsigned int index ) const
+    {
+        return values_[ getStorageIndex( index ) ];
+    }
+
+    //! Function to retrieve the independent variable of the most recent entry.
+    IndependentVariableType backTime( ) const
+    {
+        return getTime( numberOfEntries_ - 1 );
+    }
+
+    //! Function to retrieve the value of the most recent entry.
+    const ValueType& back( ) const
+    {
+        return getValue( numberOfEntries_ - 1 );
+    }
+
+    //! Function to retrieve the entries of the buffer as a map, with the independent variable as key.
+    /*!
+     *  Function to retrieve the entries of the buffer as a map, with the independent variable as key. If multiple entries
+     *  have the same independent variable, the most recent one is retained.
+     *  \return Map of entries.
+     */
+    std::map< IndependentVariableType, ValueType > getHistoryMap( ) const
+    {
+        std::map< IndependentVariableType, ValueType > historyMap;
+        for ( unsigned int i = 0; i < numberOfEntries_; i++ )
+        {
+            historyMap[ getTime( i ) ] = getValue( i );
+        }
+        return historyMap;
+    }
+
+    //! Function to retrieve the values of the buffer as a vector, ordered from oldest to most recent.
+    std::vector< ValueType > getHistoryVector( ) const
+    {
+        std::vector< ValueType > historyVector;
+        historyVector.reserve( numberOfEntries_ );
+        for ( unsigned int i = 0; i < numberOfEntries_; i++ )
+        {
+            historyVector.push_back( getValue( i ) );
+        }
+        return historyVector;
+    }
+
+private:
+
+    //! Function to convert the index of an entry (index 0 is the oldest entry) to its index in the storage vectors.
+    unsigned int getStorageIndex( const unsigned int index ) const
+    {
+        if ( index >= numberOfEntries_ )
+        {
+            throw std::runtime_error( "Error in filter history buffer. Requested entry is not in buffer." );
+        }
+        return maximumNumberOfEntries_ == 0 ? index : ( firstEntry_ + index ) % maximumNumberOfEntries_;
+    }
+
+    //! Independent variables of the entries.
+    std::vector< IndependentVariableType > times_;
+
+    //! Values of the entries.
+    std::vector< ValueType > values_;
+
+    //! Maximum number of entries (unbounded if equal to zero).
+    unsigned int maximumNumberOfEntries_;
+
+    //! Index in storage vectors of the oldest entry.
+    unsigned int firstEntry_;
+
+    //! Current number of entries.
+    unsigned int numberOfEntries_;
+
+};
+
+} // namespace filters
+
+} // namespace tudat
+
+#endif // TUDAT_FILTER_HISTORY_BUFFER_H
@@ -62,7 +62,19 @@ public:
         FilterBase< IndependentVariableType, DependentVariableType >( systemUncertainty, measurementUncertainty,
                                                                       filteringStepSize, initialTime, initialStateVector,
                                                                       initialCovarianceMatrix, integratorSettings )
-    { }
+    {
+        // Allocate workspace for update of covariance and computation of Kalman gain
+        const unsigned int stateDimension = systemUncertainty.rows( );
+        const unsigned int measurementDimension = measurementUncertainty.rows( );
+        kalmanGain_ = DependentMatrix::Zero( stateDimension, measurementDimension );
+        transposedKalmanGain_ = DependentMatrix::Zero( measurementDimension, stateDimension );
+        innovationCovariance_ = DependentMatrix::Zero( measurementDimension, measurementDimension );
+        measurementCovarianceProduct_ = DependentMatrix::Zero( measurementDimension, stateDimension );
+        stateCovarianceProduct_ = DependentMatrix::Zero( stateDimension, stateDimension );
+        josephFormMatrix_ = DependentMatrix::Zero( stateDimension, stateDimension );
+        gainUncertaintyProduct_ = DependentMatrix::Zero( stateDimension, measurementDimension );
+        innovationDecomposition_ = Eigen::PartialPivLU< DependentMatrix >( measurementDimension );
+    }
 
     //! Destructor.
     virtual ~KalmanFilterBase( ){ }
@@ -104,12 +116,63 @@ protected:
                                     const DependentMatrix& currentMeasurementMatrix,
                                     const DependentMatrix& kalmanGain )
     {
-        this->aPosterioriCovarianceEstimate_ = ( this->identityMatrix_ - kalmanGain * currentMeasurementMatrix ) *
-                aPrioriCovarianceEstimate * ( this->identityMatrix_ - kalmanGain * currentMeasurementMatrix ).transpose( ) +
-                kalmanGain * this->measurementUncertainty_ * kalmanGain.transpose( );
-        this->historyOfCovarianceEstimates_[ this->currentTime_ ] = this->aPosterioriCovarianceEstimate_;
+        // Compute covariance in Joseph form, using pre-allocated workspace
+        josephFormMatrix_ = this->identityMatrix_;
+        josephFormMatrix_.noalias( ) -= kalmanGain * currentMeasurementMatrix;
+        stateCovarianceProduct_.noalias( ) = josephFormMatrix_ * aPrioriCovarianceEstimate;
+        this->aPosterioriCovarianceEstimate_.noalias( ) = stateCovarianceProduct_ * josephFormMatrix_.transpose( );
+        gainUncertaintyProduct_.noalias( ) = kalmanGain * this->measurementUncertainty_;
+        this->aPosterioriCovarianceEstimate_.noalias( ) += gainUncertaintyProduct_ * kalmanGain.transpose( );
+        this->saveCovarianceEstimateToHistory( this->aPosterioriCovarianceEstimate_ );
+    }
+
+    //! Function to compute the Kalman gain.
+    /*!
+     *  Function to compute the Kalman gain, which is stored in the kalmanGain_ member. The gain is computed from the
+     *  decomposition of the innovation covariance (rather than from its inverse), using pre-allocated workspace.
+     *  \param aPrioriCovarianceEstimate Matrix denoting the a-priori covariance estimate.
+     *  \param measurementMatrix Matrix denoting the partial derivatives of the measurement w.r.t. the state.
+     *  \param measurementNoiseCovariance Covariance of the measurement noise, as it enters the measurement.
+     */
+    void computeKalmanGain( const DependentMatrix& aPrioriCovarianceEstimate,
+                            const DependentMatrix& measurementMatrix,
+                            const DependentMatrix& measurementNoiseCovariance )
+    {
+        // Compute innovation covariance
+        measurementCovarianceProduct_.noalias( ) = measurementMatrix * aPrioriCovarianceEstimate;
+        innovationCovariance_ = measurementNoiseCovariance;
+        innovationCovariance_.noalias( ) += measurementCovarianceProduct_ * measurementMatrix.transpose( );
+
+        // Solve for (transposed) Kalman gain, using symmetry of covariance matrices
+        innovationDecomposition_.compute( innovationCovariance_ );
+        transposedKalmanGain_.noalias( ) = innovationDecomposition_.solve( measurementCovarianceProduct_ );
+        kalmanGain_ = transposedKalmanGain_.transpose( );
     }
 
+    //! Kalman gain, as computed by the last call to computeKalmanGain.
+    DependentMatrix kalmanGain_;
+
+    //! Transpose of Kalman gain (workspace).
+    DependentMatrix transposedKalmanGain_;
+
+    //! Covariance of the innovation (workspace).
+    DependentMatrix innovationCovariance_;
+
+    //! Product of measurement matrix and a-priori covariance (workspace).
+    DependentMatrix measurementCovarianceProduct_;
+
+    //! Product of matrices with the dimension of the state covariance (workspace).
+    DependentMatrix stateCovarianceProduct_;
+
+    //! Matrix premultiplying the a-priori covariance in the Joseph form of the covariance update (workspace).
+    DependentMatrix josephFormMatrix_;
+
+    //! Product of Kalman gain and measurement uncertainty (workspace).
+    DependentMatrix gainUncertaintyProduct_;
+
+    //! Decomposition of the innovation covariance, pre-allocated for the size of the measurement vector.
+    Eigen::PartialPivLU< DependentMatrix > innovationDecomposition_;
+
 private:
 
     //! Function to propagate state to the next time step, by overwriting previous state.
@@ -81,6 +81,15 @@ public:
             throw std::runtime_error( "Error in linear Kalman filter. propagation of the state is "
                                       "not currently supported." );
         }
+
+        // Allocate workspace used at each filter step
+        const int stateDimension = systemUncertainty.rows( );
+        const int measurementDimension = measurementUncertainty.rows( );
+        currentSystemMatrix_ = DependentMatrix::Zero( stateDimension, stateDimension );
+        currentMeasurementMatrix_ = DependentMatrix::Zero( measurementDimension, stateDimension );
+        aPrioriStateEstimate_ = DependentVector::Zero( stateDimension );
+        measurementEstimate_ = DependentVector::Zero( measurementDimension );
+        aPrioriCovarianceEstimate_ = DependentMatrix::Zero( stateDimension, stateDimension );
     }
 
     //! Constructor.
@@ -127,24 +136,23 @@ public:
     void updateFilter( const DependentVector& currentMeasurementVector )
     {
         // Compute variables for current step
-        DependentMatrix currentSystemMatrix = stateTransitionMatrixFunction_( this->currentTime_, this->aPosterioriStateEstimate_ );
-        DependentMatrix currentMeasurementMatrix = measurementMatrixFunction_( this->currentTime_, this->aPosterioriStateEstimate_ );
+        currentSystemMatrix_ = stateTransitionMatrixFunction_( this->currentTime_, this->aPosterioriStateEstimate_ );
+        currentMeasurementMatrix_ = measurementMatrixFunction_( this->currentTime_, this->aPosterioriStateEstimate_ );
 
         // Prediction step
-        DependentVector aPrioriStateEstimate = this->predictState( );
-        DependentVector measurementEstimate = this->measurementFunction_( this->currentTime_, aPrioriStateEstimate );
-        DependentMatrix aPrioriCovarianceEstimate = currentSystemMatrix * this->aPosterioriCovarianceEstimate_ *
-                currentSystemMatrix.transpose( ) + this->systemUncertainty_;
+        aPrioriStateEstimate_ = this->predictState( );
+        measurementEstimate_ = this->measurementFunction_( this->currentTime_, aPrioriStateEstimate_ );
+        this->stateCovarianceProduct_.noalias( ) = currentSystemMatrix_ * this->aPosterioriCovarianceEstimate_;
+        aPrioriCovarianceEstimate_ = this->systemUncertainty_;
+        aPrioriCovarianceEstimate_.noalias( ) += this->stateCovarianceProduct_ * currentSystemMatrix_.transpose( );
 
         // Compute Kalman gain
-        DependentMatrix kalmanGain = aPrioriCovarianceEstimate * currentMeasurementMatrix.transpose( ) * (
-                    currentMeasurementMatrix * aPrioriCovarianceEstimate * currentMeasurementMatrix.transpose( ) +
-                    this->measurementUncertainty_ ).inverse( );
+        this->computeKalmanGain( aPrioriCovarianceEstimate_, currentMeasurementMatrix_, this->measurementUncertainty_ );
 
         // Correction step
         this->currentTime_ += this->filteringStepSize_;
-        this->correctState( aPrioriStateEstimate, currentMeasurementVector, measurementEstimate, kalmanGain );
-        this->correctCovariance( aPrioriCovarianceEstimate, currentMeasurementMatrix, kalmanGain );
+        this->correctState( aPrioriStateEstimate_, currentMeasurementVector, measurementEstimate_, this->kalmanGain_ );
+        this->correctCovariance( aPrioriCovarianceEstimate_, currentMeasurementMatrix_, this->kalmanGain_ );
     }
 
 private:
@@ -198,6 +206,21 @@ private:
      */
     MatrixFunction measurementMatrixFunction_;
 
+    //! State transition matrix of the current step (workspace).
+    DependentMatrix currentSystemMatrix_;
+
+    //! Measurement matrix of the current step (workspace).
+    DependentMatrix currentMeasurementMatrix_;
+
+    //! A-priori state estimate of the current step (workspace).
+    DependentVector aPrioriStateEstimate_;
+
+    //! Estimated measurement of the current step (workspace).
+    DependentVector measurementEstimate_;
+
+    //! A-priori covariance estimate of the current step (workspace).
+    DependentMatrix aPrioriCovarianceEstimate_;
+
 };
 
 //! Typedef for a filter with double data type.
@@ -0,0 +1,284 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *      Bierman, G.J., Factorization Methods for Discrete Sequential Estimation, Academic Press, 1977.
+ */
+
+#ifndef TUDAT_SQUARE_ROOT_INFORMATION_FILTER_H
+#define TUDAT_SQUARE_ROOT_INFORMATION_FILTER_H
+
+#include <Eigen/LU>
+#include <Eigen/QR>
+
+#include "tudat/math/filters/covarianceFactorization.h"
+#include "tudat/math/filters/extendedKalmanFilter.h"
+
+namespace tudat
+{
+
+namespace filters
+{
+
+//! Square root information filter class.
+/*!
+ *  Class for the set up and use of the (extended) square root information filter (SRIF). Instead of the covariance, the
+ *  filter propagates the upper triangular square root information matrix \f$ R \f$, with \f$ P^{-1} = R^{T} R \f$. The time
+ *  update is performed with a Householder orthogonal transformation, which requires the state transition matrix to be
+ *  invertible, whereas the measurements are processed sequentially as scalars with Givens rotations, such that the cost of
+ *  each scalar measurement update is quadratic in the size of the state. Correlated measurement noise is decorrelated before
+ *  processing. The full covariance matrix is only formed when it is requested, or stored in the history.
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class SquareRootInformationFilter: public ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::Function Function;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::MatrixFunction MatrixFunction;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::IntegratorSettings IntegratorSettings;
+
+    //! Default constructor.
+    /*!
+     *  Default constructor. This constructor takes the same inputs as the ExtendedKalmanFilter class.
+     *  \param systemFunction Function returning the state as a function of time and state vector. Can be a differential
+     *      equation if the integratorSettings is set (i.e., if it is not a nullptr).
+     *  \param measurementFunction Function returning the measurement as a function of time and state.
+     *  \param stateJacobianFunction Function returning the Jacobian of the system w.r.t. the state.
+     *  \param stateNoiseJacobianFunction Function returning the Jacobian of the system function w.r.t. the system noise.
+     *  \param measurementJacobianFunction Function returning the Jacobian of the measurement function w.r.t. the state.
+     *  \param measurementNoiseJacobianFunction Function returning the Jacobian of the measurement function w.r.t. the
+     *      measurement noise.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system. Must be
+     *      positive definite.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     */
+    SquareRootInformationFilter( const Function& systemFunction,
+                                 const Function& measurementFunction,
+                                 const MatrixFunction& stateJacobianFunction,
+                                 const MatrixFunction& stateNoiseJacobianFunction,
+                                 const MatrixFunction& measurementJacobianFunction,
+                                 const MatrixFunction& measurementNoiseJacobianFunction,
+                                 const DependentMatrix& systemUncertainty,
+                                 const DependentMatrix& measurementUncertainty,
+                                 const IndependentVariableType filteringStepSize,
+                                 const IndependentVariableType initialTime,
+                                 const DependentVector& initialStateVector,
+                                 const DependentMatrix& initialCovarianceMatrix,
+                                 const std::shared_ptr< IntegratorSettings > integratorSettings = nullptr ) :
+        ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >(
+            systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+            measurementJacobianFunction, measurementNoiseJacobianFunction, systemUncertainty, measurementUncertainty,
+            filteringStepSize, initialTime, initialStateVector, initialCovarianceMatrix, integratorSettings )
+    {
+        setSquareRootInformationMatrixFromCovariance( initialCovarianceMatrix );
+
+        // Compute square root of system uncertainty, omitting directions with zero uncertainty
+        DependentMatrix unitUpperTriangularFactor;
+        DependentVector diagonalFactor;
+        computeUDFactorization( this->systemUncertainty_, unitUpperTriangularFactor, diagonalFactor );
+        std::vector< int > nonZeroColumns;
+        for ( int i = 0; i < diagonalFactor.rows( ); i++ )
+        {
+            if ( diagonalFactor( i ) > static_cast< DependentVariableType >( 0.0 ) )
+            {
+                nonZeroColumns.push_back( i );
+            }
+        }
+        systemUncertaintySquareRoot_.resize( diagonalFactor.rows( ), nonZeroColumns.size( ) );
+        for ( unsigned int i = 0; i < nonZeroColumns.size( ); i++ )
+        {
+            systemUncertaintySquareRoot_.col( i ) = unitUpperTriangularFactor.col( nonZeroColumns.at( i ) ) *
+                    std::sqrt( diagonalFactor( nonZeroColumns.at( i ) ) );
+        }
+    }
+
+    //! Destructor.
+    ~SquareRootInformationFilter( ){ }
+
+    //! Function to update the filter with the new step data.
+    /*!
+     *  Function to update the filter with the new step data.
+     *  \param currentMeasurementVector Vector representing current measurement.
+     */
+    void updateFilter( const DependentVector& currentMeasurementVector )
+    {
+        // Prediction step
+        DependentVector aPrioriStateEstimate = this->predictState( );
+        DependentMatrix currentStateJacobianMatrix;
+        DependentMatrix currentStateNoiseJacobianMatrix;
+        this->computeSystemJacobians( aPrioriStateEstimate, currentStateJacobianMatrix, currentStateNoiseJacobianMatrix );
+        DependentVector measurementEstimate = this->measurementFunction_( this->currentTime_, aPrioriStateEstimate );
+
+        // Compute remaining Jacobians
+        DependentMatrix currentMeasurementJacobianMatrix =
+                this->measurementJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
+        DependentMatrix currentMeasurementNoiseJacobianMatrix =
+                this->measurementNoiseJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
+
+        // Prediction step (continued)
+        propagateSquareRootInformationMatrix( currentStateJacobianMatrix,
+                                              currentStateNoiseJacobianMatrix * systemUncertaintySquareRoot_ );
+
+        // Decorrelate and normalize measurement equations
+        DependentVector measurementResiduals = currentMeasurementVector - measurementEstimate;
+        DependentVector measurementVariances = decorrelateMeasurementEquations< DependentVariableType >(
+                    currentMeasurementJacobianMatrix, measurementResiduals,
+                    currentMeasurementNoiseJacobianMatrix * this->measurementUncertainty_ *
+                    currentMeasurementNoiseJacobianMatrix.transpose( ) );
+
+        // Correction step, processing measurements sequentially (a-priori information vector is zero, since the
+        // correction is expressed w.r.t. the a-priori state estimate)
+        const int stateSize = aPrioriStateEstimate.rows( );
+        DependentVector informationVector = DependentVector::Zero( stateSize );
+        for ( int i = 0; i < measurementResiduals.rows( ); i++ )
+        {
+            if ( !( measurementVariances( i ) > static_cast< DependentVariableType >( 0.0 ) ) )
+            {
+                throw std::runtime_error( "Error in square root information filter. Measurement variance is not positive." );
+            }
+            const DependentVariableType measurementWeight = static_cast< DependentVariableType >( 1.0 ) /
+                    std::sqrt( measurementVariances( i ) );
+            performSquareRootInformationScalarMeasurementUpdate< DependentVariableType >(
+                        squareRootInformationMatrix_, informationVector,
+                        measurementWeight * currentMeasurementJacobianMatrix.row( i ), measurementWeight * measurementResiduals( i ) );
+        }
+
+        this->currentTime_ += this->filteringStepSize_;
+        this->aPosterioriStateEstimate_ = aPrioriStateEstimate +
+                squareRootInformationMatrix_.template triangularView< Eigen::Upper >( ).solve( informationVector );
+        this->saveStateEstimateToHistory( );
+        this->saveCovarianceEstimateToHistory( );
+    }
+
+    //! Function to retrieve current covariance estimate.
+    /*!
+     *  Function to retrieve current covariance estimate, formed from the inverse of the square root information matrix.
+     *  \return Current covariance estimate.
+     */
+    DependentMatrix getCurrentCovarianceEstimate( )
+    {
+        DependentMatrix inverseSquareRootInformationMatrix = squareRootInformationMatrix_.template triangularView< Eigen::Upper >( ).solve(
+                    DependentMatrix::Identity( squareRootInformationMatrix_.rows( ), squareRootInformationMatrix_.cols( ) ) );
+        return inverseSquareRootInformationMatrix * inverseSquareRootInformationMatrix.transpose( );
+    }
+
+    //! Function to retrieve the current square root information matrix.
+    DependentMatrix getSquareRootInformationMatrix( ) { return squareRootInformationMatrix_; }
+
+    //! Function to update the a-posteriori estimates of state and covariance with external data.
+    /*!
+     *  Function to update the a-posteriori estimates of state and covariance with external data, without interrupting the
+     *  filtering process.
+     *  \param newStateEstimate Vector denoting the new a-posteriori state estimate.
+     *  \param newCovarianceEstimate Matrix denoting the new a-posteriori covariance estimate.
+     */
+    void modifyCurrentStateAndCovarianceEstimates( const DependentVector& newStateEstimate,
+                                                   const DependentMatrix& newCovarianceEstimate = DependentMatrix::Zero( ) )
+    {
+        ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::modifyCurrentStateAndCovarianceEstimates(
+                    newStateEstimate, newCovarianceEstimate );
+        if ( !newCovarianceEstimate.isZero( ) )
+        {
+            setSquareRootInformationMatrixFromCovariance( newCovarianceEstimate );
+        }
+    }
+
+private:
+
+    //! Function to set the square root information matrix from a covariance matrix.
+    /*!
+     *  Function to set the square root information matrix from a covariance matrix, by Cholesky decomposition of its inverse.
+     *  \param covarianceMatrix Positive definite covariance matrix.
+     */
+    void setSquareRootInformationMatrixFromCovariance( const DependentMatrix& covarianceMatrix )
+    {
+        Eigen::LLT< DependentMatrix > choleskyDecomposition( covarianceMatrix.inverse( ) );
+        if ( choleskyDecomposition.info( ) != Eigen::Success )
+        {
+            throw std::runtime_error( "Error in square root information filter. Covariance matrix is not positive definite." );
+        }
+        squareRootInformationMatrix_ = choleskyDecomposition.matrixU( );
+    }
+
+    //! Function to propagate the square root information matrix to the next time step.
+    /*!
+     *  Function to propagate the square root information matrix to the next time step, by triangularizing the matrix
+     *  \f$ [ [ I, 0 ], [ -R \Phi^{-1} G, R \Phi^{-1} ] ] \f$ with a Householder transformation (Bierman, 1977).
+     *  \param stateTransitionMatrix (Discrete-time) Jacobian of the system w.r.t. the state.
+     *  \param noiseSquareRootMatrix Product of the (discrete-time) Jacobian of the system w.r.t. the system noise and
+     *      the square root of the system uncertainty.
+     */
+    void propagateSquareRootInformationMatrix( const DependentMatrix& stateTransitionMatrix,
+                                               const DependentMatrix& noiseSquareRootMatrix )
+    {
+        const int stateSize = stateTransitionMatrix.rows( );
+        const int noiseSize = noiseSquareRootMatrix.cols( );
+
+        // Map information matrix through inverse of state transition matrix, i.e., R * Phi^-1
+        DependentMatrix mappedSquareRootInformationMatrix =
+                stateTransitionMatrix.transpose( ).partialPivLu( ).solve( squareRootInformationMatrix_.transpose( ) ).transpose( );
+        if ( noiseSize == 0 )
+        {
+            Eigen::HouseholderQR< DependentMatrix > qrDecomposition( mappedSquareRootInformationMatrix );
+            squareRootInformationMatrix_ = qrDecomposition.matrixQR( ).template triangularView< Eigen::Upper >( );
+            return;
+        }
+
+        DependentMatrix augmentedMatrix = DependentMatrix::Zero( noiseSize + stateSize, noiseSize + stateSize );
+        augmentedMatrix.topLeftCorner( noiseSize, noiseSize ).setIdentity( );
+        augmentedMatrix.bottomLeftCorner( stateSize, noiseSize ) = -mappedSquareRootInformationMatrix * noiseSquareRootMatrix;
+        augmentedMatrix.bottomRightCorner( stateSize, stateSize ) = mappedSquareRootInformationMatrix;
+
+        Eigen::HouseholderQR< DependentMatrix > qrDecomposition( augmentedMatrix );
+        DependentMatrix triangularMatrix = qrDecomposition.matrixQR( ).template triangularView< Eigen::Upper >( );
+        squareRootInformationMatrix_ = triangularMatrix.bottomRightCorner( stateSize, stateSize );
+    }
+
+    //! Function to revert to the previous time step for SRIF-specific variables.
+    /*!
+     *  Function to revert to the previous time step for SRIF-specific variables, by recomputing the square root information
+     *  matrix from the covariance restored from the history.
+     *  \param timeToBeRemoved Double denoting the current time, i.e., the instant that has to be discarded.
+     */
+    void specificRevertToPreviousTimeStep( const double timeToBeRemoved )
+    {
+        TUDAT_UNUSED_PARAMETER( timeToBeRemoved );
+        setSquareRootInformationMatrixFromCovariance( this->aPosterioriCovarianceEstimate_ );
+    }
+
+    //! Upper triangular square root of the current a-posteriori information matrix.
+    DependentMatrix squareRootInformationMatrix_;
+
+    //! Square root of the system uncertainty, such that its outer product equals the system uncertainty.
+    DependentMatrix systemUncertaintySquareRoot_;
+
+};
+
+//! Typedef for a filter with double data type.
+typedef SquareRootInformationFilter< > SquareRootInformationFilterDouble;
+
+//! Typedef for a shared-pointer to a filter with double data type.
+typedef std::shared_ptr< SquareRootInformationFilterDouble > SquareRootInformationFilterDoublePointer;
+
+} // namespace filters
+
+} // namespace tudat
+
+#endif // TUDAT_SQUARE_ROOT_INFORMATION_FILTER_H
@@ -0,0 +1,222 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *      Bierman, G.J., Factorization Methods for Discrete Sequential Estimation, Academic Press, 1977.
+ *      Thornton, C.L. and Bierman, G.J., Gram-Schmidt Algorithms for Covariance Propagation, International Journal of
+ *          Control, 25(2), 1977.
+ */
+
+#ifndef TUDAT_UD_EXTENDED_KALMAN_FILTER_H
+#define TUDAT_UD_EXTENDED_KALMAN_FILTER_H
+
+#include "tudat/math/filters/covarianceFactorization.h"
+#include "tudat/math/filters/extendedKalmanFilter.h"
+
+namespace tudat
+{
+
+namespace filters
+{
+
+//! UD-factorized extended Kalman filter class.
+/*!
+ *  Class for the set up and use of the extended Kalman filter, where the covariance is propagated in the factorized form
+ *  \f$ P = U D U^{T} \f$ (Bierman-Thornton filter). The time update is performed with the modified weighted Gram-Schmidt
+ *  algorithm, whereas the measurements are processed sequentially as scalars with Bierman's algorithm, such that no
+ *  matrix inversion is needed and the cost of each scalar measurement update is quadratic in the size of the state.
+ *  Correlated measurement noise is decorrelated before processing. The full covariance matrix is only formed when it is
+ *  requested, or stored in the history.
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class UDExtendedKalmanFilter: public ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::Function Function;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::MatrixFunction MatrixFunction;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::IntegratorSettings IntegratorSettings;
+
+    //! Default constructor.
+    /*!
+     *  Default constructor. This constructor takes the same inputs as the ExtendedKalmanFilter class.
+     *  \param systemFunction Function returning the state as a function of time and state vector. Can be a differential
+     *      equation if the integratorSettings is set (i.e., if it is not a nullptr).
+     *  \param measurementFunction Function returning the measurement as a function of time and state.
+     *  \param stateJacobianFunction Function returning the Jacobian of the system w.r.t. the state.
+     *  \param stateNoiseJacobianFunction Function returning the Jacobian of the system function w.r.t. the system noise.
+     *  \param measurementJacobianFunction Function returning the Jacobian of the measurement function w.r.t. the state.
+     *  \param measurementNoiseJacobianFunction Function returning the Jacobian of the measurement function w.r.t. the
+     *      measurement noise.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     */
+    UDExtendedKalmanFilter( const Function& systemFunction,
+                            const Function& measurementFunction,
+                            const MatrixFunction& stateJacobianFunction,
+                            const MatrixFunction& stateNoiseJacobianFunction,
+                            const MatrixFunction& measurementJacobianFunction,
+                            const MatrixFunction& measurementNoiseJacobianFunction,
+                            const DependentMatrix& systemUncertainty,
+                            const DependentMatrix& measurementUncertainty,
+                            const IndependentVariableType filteringStepSize,
+                            const IndependentVariableType initialTime,
+                            const DependentVector& initialStateVector,
+                            const DependentMatrix& initialCovarianceMatrix,
+                            const std::shared_ptr< IntegratorSettings > integratorSettings = nullptr ) :
+        ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >(
+            systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+            measurementJacobianFunction, measurementNoiseJacobianFunction, systemUncertainty, measurementUncertainty,
+            filteringStepSize, initialTime, initialStateVector, initialCovarianceMatrix, integratorSettings )
+    {
+        computeUDFactorization( initialCovarianceMatrix, unitUpperTriangularFactor_, diagonalFactor_ );
+        computeUDFactorization( this->systemUncertainty_, systemUncertaintyUnitUpperTriangularFactor_,
+                                systemUncertaintyDiagonalFactor_ );
+    }
+
+    //! Destructor.
+    ~UDExtendedKalmanFilter( ){ }
+
+    //! Function to update the filter with the new step data.
+    /*!
+     *  Function to update the filter with the new step data.
+     *  \param currentMeasurementVector Vector representing current measurement.
+     */
+    void updateFilter( const DependentVector& currentMeasurementVector )
+    {
+        // Prediction step
+        DependentVector aPrioriStateEstimate = this->predictState( );
+        DependentMatrix currentStateJacobianMatrix;
+        DependentMatrix currentStateNoiseJacobianMatrix;
+        this->computeSystemJacobians( aPrioriStateEstimate, currentStateJacobianMatrix, currentStateNoiseJacobianMatrix );
+        DependentVector measurementEstimate = this->measurementFunction_( this->currentTime_, aPrioriStateEstimate );
+
+        // Compute remaining Jacobians
+        DependentMatrix currentMeasurementJacobianMatrix =
+                this->measurementJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
+        DependentMatrix currentMeasurementNoiseJacobianMatrix =
+                this->measurementNoiseJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
+
+        // Prediction step (continued), with weighted Gram-Schmidt orthogonalization of [ Phi U, G Uq ]
+        const int stateSize = aPrioriStateEstimate.rows( );
+        const int noiseSize = systemUncertaintyDiagonalFactor_.rows( );
+        DependentMatrix weightedMatrix( stateSize, stateSize + noiseSize );
+        weightedMatrix.leftCols( stateSize ) = currentStateJacobianMatrix * unitUpperTriangularFactor_;
+        weightedMatrix.rightCols( noiseSize ) = currentStateNoiseJacobianMatrix * systemUncertaintyUnitUpperTriangularFactor_;
+        DependentVector weights( stateSize + noiseSize );
+        weights << diagonalFactor_, systemUncertaintyDiagonalFactor_;
+        performModifiedWeightedGramSchmidtTimeUpdate( weightedMatrix, weights, unitUpperTriangularFactor_, diagonalFactor_ );
+
+        // Decorrelate measurement equations
+        DependentVector measurementResiduals = currentMeasurementVector - measurementEstimate;
+        DependentVector measurementVariances = decorrelateMeasurementEquations< DependentVariableType >(
+                    currentMeasurementJacobianMatrix, measurementResiduals,
+                    currentMeasurementNoiseJacobianMatrix * this->measurementUncertainty_ *
+                    currentMeasurementNoiseJacobianMatrix.transpose( ) );
+
+        // Correction step, processing measurements sequentially
+        DependentVector stateCorrection = DependentVector::Zero( stateSize );
+        for ( int i = 0; i < measurementResiduals.rows( ); i++ )
+        {
+            const Eigen::Matrix< DependentVariableType, 1, Eigen::Dynamic > measurementPartials =
+                    currentMeasurementJacobianMatrix.row( i );
+            DependentVector kalmanGain = performBiermanScalarMeasurementUpdate< DependentVariableType >(
+                        unitUpperTriangularFactor_, diagonalFactor_, measurementPartials, measurementVariances( i ) );
+            stateCorrection += kalmanGain * ( measurementResiduals( i ) - measurementPartials.dot( stateCorrection ) );
+        }
+
+        this->currentTime_ += this->filteringStepSize_;
+        this->aPosterioriStateEstimate_ = aPrioriStateEstimate + stateCorrection;
+        this->saveStateEstimateToHistory( );
+        this->saveCovarianceEstimateToHistory( );
+    }
+
+    //! Function to retrieve current covariance estimate.
+    /*!
+     *  Function to retrieve current covariance estimate, formed from its UD factors.
+     *  \return Current covariance estimate.
+     */
+    DependentMatrix getCurrentCovarianceEstimate( )
+    {
+        return unitUpperTriangularFactor_ * diagonalFactor_.asDiagonal( ) * unitUpperTriangularFactor_.transpose( );
+    }
+
+    //! Function to retrieve the unit upper triangular factor of the current covariance estimate.
+    DependentMatrix getUnitUpperTriangularFactor( ) { return unitUpperTriangularFactor_; }
+
+    //! Function to retrieve the diagonal factor of the current covariance estimate.
+    DependentVector getDiagonalFactor( ) { return diagonalFactor_; }
+
+    //! Function to update the a-posteriori estimates of state and covariance with external data.
+    /*!
+     *  Function to update the a-posteriori estimates of state and covariance with external data, without interrupting the
+     *  filtering process.
+     *  \param newStateEstimate Vector denoting the new a-posteriori state estimate.
+     *  \param newCovarianceEstimate Matrix denoting the new a-posteriori covariance estimate.
+     */
+    void modifyCurrentStateAndCovarianceEstimates( const DependentVector& newStateEstimate,
+                                                   const DependentMatrix& newCovarianceEstimate = DependentMatrix::Zero( ) )
+    {
+        ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::modifyCurrentStateAndCovarianceEstimates(
+                    newStateEstimate, newCovarianceEstimate );
+        if ( !newCovarianceEstimate.isZero( ) )
+        {
+            computeUDFactorization( newCovarianceEstimate, unitUpperTriangularFactor_, diagonalFactor_ );
+        }
+    }
+
+private:
+
+    //! Function to revert to the previous time step for UD-specific variables.
+    /*!
+     *  Function to revert to the previous time step for UD-specific variables, by re-factorizing the covariance restored
+     *  from the history.
+     *  \param timeToBeRemoved Double denoting the current time, i.e., the instant that has to be discarded.
+     */
+    void specificRevertToPreviousTimeStep( const double timeToBeRemoved )
+    {
+        TUDAT_UNUSED_PARAMETER( timeToBeRemoved );
+        computeUDFactorization( this->aPosterioriCovarianceEstimate_, unitUpperTriangularFactor_, diagonalFactor_ );
+    }
+
+    //! Unit upper triangular factor of the current a-posteriori covariance estimate.
+    DependentMatrix unitUpperTriangularFactor_;
+
+    //! Diagonal entries of the diagonal factor of the current a-posteriori covariance estimate.
+    DependentVector diagonalFactor_;
+
+    //! Unit upper triangular factor of the system uncertainty.
+    DependentMatrix systemUncertaintyUnitUpperTriangularFactor_;
+
+    //! Diagonal entries of the diagonal factor of the system uncertainty.
+    DependentVector systemUncertaintyDiagonalFactor_;
+
+};
+
+//! Typedef for a filter with double data type.
+typedef UDExtendedKalmanFilter< > UDExtendedKalmanFilterDouble;
+
+//! Typedef for a shared-pointer to a filter with double data type.
+typedef std::shared_ptr< UDExtendedKalmanFilterDouble > UDExtendedKalmanFilterDoublePointer;
+
+} // namespace filters
+
+} // namespace tudat
+
+#endif // TUDAT_UD_EXTENDED_KALMAN_FILTER_H
@@ -123,6 +123,12 @@ public:
         augmentedCovarianceMatrix_.block( stateDimension_, stateDimension_, stateDimension_, stateDimension_ ) = systemUncertainty;
         augmentedCovarianceMatrix_.block( 2 * stateDimension_, 2 * stateDimension_,
                                           measurementDimension_, measurementDimension_ ) = measurementUncertainty;
+
+        // Allocate sigma points and workspace
+        sigmaPoints_ = DependentMatrix::Zero( augmentedStateDimension_, numberOfSigmaPoints_ );
+        sigmaPointStateEstimates_ = DependentMatrix::Zero( stateDimension_, numberOfSigmaPoints_ );
+        sigmaPointMeasurementEstimates_ = DependentMatrix::Zero( measurementDimension_, numberOfSigmaPoints_ );
+        crossCorrelationMatrix_ = DependentMatrix::Zero( stateDimension_, measurementDimension_ );
     }
 
     //! Destructor.
@@ -137,89 +143,68 @@ public:
     {
         // Compute sigma points
         computeSigmaPoints( this->aPosterioriStateEstimate_, this->aPosterioriCovarianceEstimate_ );
-        historyOfSigmaPoints_[ this->currentTime_ ] = mapOfSigmaPoints_; // store points
+        historyOfSigmaPoints_.push( this->currentTime_, sigmaPoints_ ); // store points
 
         // Prediction step
         // Compute series of state estimates based on sigma points
-        std::map< unsigned int, DependentVector > sigmaPointsStateEstimates;
-        for ( sigmaPointConstantIterator_ = mapOfSigmaPoints_.begin( );
-              sigmaPointConstantIterator_ != mapOfSigmaPoints_.end( ); sigmaPointConstantIterator_++ )
+        for ( currentSigmaPoint_ = 0; currentSigmaPoint_ < numberOfSigmaPoints_; currentSigmaPoint_++ )
         {
-            currentSigmaPoint_ = sigmaPointConstantIterator_->first;
-            sigmaPointsStateEstimates[ currentSigmaPoint_ ] = this->predictState(
-                        sigmaPointConstantIterator_->second.segment( 0, stateDimension_ ) );
+            sigmaPointState_ = sigmaPoints_.col( currentSigmaPoint_ ).segment( 0, stateDimension_ );
+            sigmaPointStateEstimates_.col( currentSigmaPoint_ ) = this->predictState( sigmaPointState_ );
         }
 
         // Compute the weighted average to find the a-priori state vector
-        DependentVector aPrioriStateEstimate = DependentVector::Zero( stateDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( aPrioriStateEstimate, sigmaPointsStateEstimates );
+        computeWeightedAverageFromSigmaPointEstimates( aPrioriStateEstimate_, sigmaPointStateEstimates_ );
 
         // Compute the weighted average to find the a-priori covariance matrix
-        DependentMatrix aPrioriCovarianceEstimate = DependentMatrix::Zero( stateDimension_, stateDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( aPrioriCovarianceEstimate, aPrioriStateEstimate, sigmaPointsStateEstimates );
+        computeWeightedAverageFromSigmaPointEstimates( aPrioriCovarianceEstimate_, aPrioriStateEstimate_,
+                                                       sigmaPointStateEstimates_ );
 
         // Re-compute sigma points
-        computeSigmaPoints( aPrioriStateEstimate, aPrioriCovarianceEstimate );
+        computeSigmaPoints( aPrioriStateEstimate_, aPrioriCovarianceEstimate_ );
 
         // Compute series of measurement estimates based on sigma points
-        std::map< unsigned int, DependentVector > sigmaPointsMeasurementEstimates;
-        for ( sigmaPointConstantIterator_ = mapOfSigmaPoints_.begin( );
-              sigmaPointConstantIterator_ != mapOfSigmaPoints_.end( ); sigmaPointConstantIterator_++ )
+        for ( currentSigmaPoint_ = 0; currentSigmaPoint_ < numberOfSigmaPoints_; currentSigmaPoint_++ )
         {
-            currentSigmaPoint_ = sigmaPointConstantIterator_->first;
-            sigmaPointsMeasurementEstimates[ currentSigmaPoint_ ] = this->measurementFunction_(
-                        this->currentTime_, sigmaPointConstantIterator_->second.segment( 0, stateDimension_ ) );
+            sigmaPointState_ = sigmaPoints_.col( currentSigmaPoint_ ).segment( 0, stateDimension_ );
+            sigmaPointMeasurementEstimates_.col( currentSigmaPoint_ ) =
+                    this->measurementFunction_( this->currentTime_, sigmaPointState_ );
         }
 
         // Compute the weighted average to find the expected measurement vector
-        DependentVector measurementEstimate = DependentVector::Zero( measurementDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( measurementEstimate, sigmaPointsMeasurementEstimates );
+        computeWeightedAverageFromSigmaPointEstimates( measurementEstimate_, sigmaPointMeasurementEstimates_ );
 
         // Compute innovation and cross-correlation matrices
-        DependentMatrix innovationMatrix = DependentMatrix::Zero( measurementDimension_, measurementDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( innovationMatrix, measurementEstimate, sigmaPointsMeasurementEstimates );
-        DependentMatrix crossCorrelationMatrix = DependentMatrix::Zero( stateDimension_, measurementDimension_ );
-        for ( sigmaPointConstantIterator_ = sigmaPointsStateEstimates.begin( );
-              sigmaPointConstantIterator_ != sigmaPointsStateEstimates.end( ); sigmaPointConstantIterator_++ )
+        computeWeightedAverageFromSigmaPointEstimates( this->innovationCovariance_, measurementEstimate_,
+                                                       sigmaPointMeasurementEstimates_ );
+        crossCorrelationMatrix_.setZero( );
+        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
         {
-            crossCorrelationMatrix += covarianceEstimationWeights_.at( sigmaPointConstantIterator_->first ) *
-                    ( sigmaPointConstantIterator_->second - aPrioriStateEstimate ) *
-                    ( sigmaPointsMeasurementEstimates[ sigmaPointConstantIterator_->first ] - measurementEstimate ).transpose( );
+            stateDeviation_ = sigmaPointStateEstimates_.col( i ) - aPrioriStateEstimate_;
+            measurementDeviation_ = sigmaPointMeasurementEstimates_.col( i ) - measurementEstimate_;
+            crossCorrelationMatrix_.noalias( ) +=
+                    covarianceEstimationWeights_.at( i ) * stateDeviation_ * measurementDeviation_.transpose( );
         }
 
-        // Compute Kalman gain
-        DependentMatrix kalmanGain = crossCorrelationMatrix * innovationMatrix.inverse( );
+        // Compute Kalman gain, using symmetry of innovation matrix
+        this->innovationDecomposition_.compute( this->innovationCovariance_ );
+        this->transposedKalmanGain_.noalias( ) = this->innovationDecomposition_.solve( crossCorrelationMatrix_.transpose( ) );
+        this->kalmanGain_ = this->transposedKalmanGain_.transpose( );
 
         // Correction step
         this->currentTime_ += this->filteringStepSize_;
-        this->correctState( aPrioriStateEstimate, currentMeasurementVector, measurementEstimate, kalmanGain );
-        correctCovariance( aPrioriCovarianceEstimate, innovationMatrix, kalmanGain );
+        this->correctState( aPrioriStateEstimate_, currentMeasurementVector, measurementEstimate_, this->kalmanGain_ );
+        correctCovariance( aPrioriCovarianceEstimate_, this->innovationCovariance_, this->kalmanGain_ );
     }
 
     //! Function to return the history of sigma points.
     /*!
      *  Function to return the history of sigma points.
-     *  \return History of map of sigma points for each time step.
+     *  \return History of sigma points for each time step, where each column of the matrix represents a sigma point.
      */
     std::map< IndependentVariableType, DependentMatrix > getHistoryOfSigmaPoints( )
     {
-        // Convert map of maps into map of Eigen::Matrix
-        DependentVector vectorOfSigmaPoints;
-        std::map< IndependentVariableType, DependentMatrix > mapOfSigmaPointsHistory;
-        for ( typename std::map< IndependentVariableType, std::map< unsigned int, DependentVector > >::const_iterator
-              mapIterator = historyOfSigmaPoints_.begin( ); mapIterator != historyOfSigmaPoints_.end( ); mapIterator++ )
-        {
-            // Extract current map of sigma points and turn it into a vector
-            vectorOfSigmaPoints = utilities::createConcatenatedEigenMatrixFromMapValues( mapIterator->second );
-
-            // Reshape the vector into a matrix and store it into the output map
-            Eigen::Map< Eigen::MatrixXd > matrixOfSigmaPoints( vectorOfSigmaPoints.data( ),
-                                                               augmentedStateDimension_, numberOfSigmaPoints_ );
-            mapOfSigmaPointsHistory[ mapIterator->first ] = matrixOfSigmaPoints;
-        }
-
-        // Give output
-        return mapOfSigmaPointsHistory;
+        return historyOfSigmaPoints_.getHistoryMap( );
     }
 
 private:
@@ -236,7 +221,7 @@ private:
                                           const DependentVector& currentStateVector )
     {
         return inputSystemFunction_( currentTime, currentStateVector ) +
-                mapOfSigmaPoints_[ currentSigmaPoint_ ].segment( stateDimension_, stateDimension_ ); // add system noise
+                sigmaPoints_.col( currentSigmaPoint_ ).segment( stateDimension_, stateDimension_ ); // add system noise
     }
 
     //! Function to create the function that defines the system model.
@@ -251,7 +236,7 @@ private:
                                                const DependentVector& currentStateVector )
     {
         return inputMeasurementFunction_( currentTime, currentStateVector ) +
-                mapOfSigmaPoints_[ currentSigmaPoint_ ].segment( 2 * stateDimension_, measurementDimension_ ); // add measurement noise
+                sigmaPoints_.col( currentSigmaPoint_ ).segment( 2 * stateDimension_, measurementDimension_ ); // add measurement noise
     }
 
     //! Function to clear the history of stored variables for derived class-specific variables.
@@ -269,12 +254,22 @@ private:
      */
     virtual void specificRevertToPreviousTimeStep( const double timeToBeRemoved )
     {
-        if ( historyOfSigmaPoints_.count( timeToBeRemoved ) != 0 )
+        if ( !historyOfSigmaPoints_.empty( ) && historyOfSigmaPoints_.backTime( ) == timeToBeRemoved )
         {
-            historyOfSigmaPoints_.erase( timeToBeRemoved );
+            historyOfSigmaPoints_.popBack( );
         }
     }
 
+    //! Function to set how much of the history is stored, for derived class-specific variables.
+    /*!
+     *  Function to set how much of the history is stored, for derived class-specific variables. This function sets the
+     *  maximum length of the history of sigma points.
+     */
+    void setSpecificFilterHistoryStorage( )
+    {
+        historyOfSigmaPoints_.setCapacity( this->maximumHistoryLength_, sigmaPoints_ );
+    }
+
     //! Function to set the values of the constant parameters.
     /*!
      *  Function to set the values of the constant parameters, used by the unscented Kalman filter for various purposes.
@@ -345,16 +340,16 @@ private:
         {
             if ( i == 0 )
             {
-                mapOfSigmaPoints_[ i ] = augmentedStateVector_;
+                sigmaPoints_.col( i ) = augmentedStateVector_;
             }
             else if ( i < ( augmentedCovarianceMatrixSquareRoot.cols( ) + 1 ) )
             {
-                mapOfSigmaPoints_[ i ] = augmentedStateVector_ + constantParameters_.at( gamma_index ) *
+                sigmaPoints_.col( i ) = augmentedStateVector_ + constantParameters_.at( gamma_index ) *
                         augmentedCovarianceMatrixSquareRoot.col( i - 1 );
             }
             else
             {
-                mapOfSigmaPoints_[ i ] = augmentedStateVector_ - constantParameters_.at( gamma_index ) *
+                sigmaPoints_.col( i ) = augmentedStateVector_ - constantParameters_.at( gamma_index ) *
                         augmentedCovarianceMatrixSquareRoot.col( ( i - 1 ) - augmentedCovarianceMatrixSquareRoot.cols( ) );
             }
         }
@@ -363,43 +358,40 @@ private:
     //! Function to compute the weighted average of the state and measurement vectors.
     /*!
      *  Function to compute the weighted average of the state and measurement vectors.
-     *  \param weightedAverageVector Vector to which the weighted average is added (initially set to zero).
-     *  \param sigmaPointEstimates Map of the sigma points generated by the computeSigmaPoints function.
-     *  \return Weighted average of the state or measurement vector, i.e., the new a-priori state and the
-     *      measurement estimates (returned by reference).
+     *  \param weightedAverageVector Weighted average of the state or measurement vector, i.e., the new a-priori state and
+     *      the measurement estimates (returned by reference).
+     *  \param sigmaPointEstimates Matrix of the estimates based on the sigma points (one column per sigma point).
      */
     void computeWeightedAverageFromSigmaPointEstimates( DependentVector& weightedAverageVector,
-                                                        const std::map< unsigned int, DependentVector >& sigmaPointEstimates )
+                                                        const DependentMatrix& sigmaPointEstimates )
     {
         // Loop over each sigma point
-        for ( sigmaPointConstantIterator_ = sigmaPointEstimates.begin( );
-              sigmaPointConstantIterator_ != sigmaPointEstimates.end( ); sigmaPointConstantIterator_++ )
+        weightedAverageVector.setZero( sigmaPointEstimates.rows( ) );
+        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
         {
-            weightedAverageVector += stateEstimationWeights_.at( sigmaPointConstantIterator_->first ) *
-                    sigmaPointConstantIterator_->second;
+            weightedAverageVector.noalias( ) += stateEstimationWeights_.at( i ) * sigmaPointEstimates.col( i );
         }
     }
 
     //! Function to compute the weighted average of the covariance and innovation matrices.
     /*!
      *  Function to compute the weighted average of the covariance and innovation matrices.
-     *  \param weightedAverageMatrix Matrix to which the weighted average is added (initially set to zero).
+     *  \param weightedAverageMatrix Weighted average of the covariance and innovation matrices, i.e., the new a-priori
+     *      covariance and the innovation estimates (returned by reference).
      *  \param referenceVector Vector representing the a-priori state or measurement estimates.
-     *  \param sigmaPointEstimates Map of the sigma points generated by the computeSigmaPoints function.
-     *  \return Weighted average of the covariance and innovation matrices, i.e., the new a-priori covariance and the
-     *      innovation estimates (returned by reference).
+     *  \param sigmaPointEstimates Matrix of the estimates based on the sigma points (one column per sigma point).
      */
     void computeWeightedAverageFromSigmaPointEstimates( DependentMatrix& weightedAverageMatrix,
                                                         const DependentVector& referenceVector,
-                                                        const std::map< unsigned int, DependentVector >& sigmaPointEstimates )
+                                                        const DependentMatrix& sigmaPointEstimates )
     {
         // Loop over each sigma point
-        for ( sigmaPointConstantIterator_ = sigmaPointEstimates.begin( );
-              sigmaPointConstantIterator_ != sigmaPointEstimates.end( ); sigmaPointConstantIterator_++ )
+        weightedAverageMatrix.setZero( referenceVector.rows( ), referenceVector.rows( ) );
+        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
         {
-            weightedAverageMatrix += covarianceEstimationWeights_.at( sigmaPointConstantIterator_->first ) *
-                    ( sigmaPointConstantIterator_->second - referenceVector ) *
-                    ( sigmaPointConstantIterator_->second - referenceVector ).transpose( );
+            sigmaPointDeviation_ = sigmaPointEstimates.col( i ) - referenceVector;
+            weightedAverageMatrix.noalias( ) +=
+                    covarianceEstimationWeights_.at( i ) * sigmaPointDeviation_ * sigmaPointDeviation_.transpose( );
         }
     }
 
@@ -413,8 +405,10 @@ private:
     void correctCovariance( const DependentMatrix& aPrioriCovarianceEstimate,
                             const DependentMatrix& innovationMatrix, const DependentMatrix& kalmanGain )
     {
-        this->aPosterioriCovarianceEstimate_ = aPrioriCovarianceEstimate - kalmanGain * innovationMatrix * kalmanGain.transpose( );
-        this->historyOfCovarianceEstimates_[ this->currentTime_ ] = this->aPosterioriCovarianceEstimate_;
+        this->gainUncertaintyProduct_.noalias( ) = kalmanGain * innovationMatrix;
+        this->aPosterioriCovarianceEstimate_ = aPrioriCovarianceEstimate;
+        this->aPosterioriCovarianceEstimate_.noalias( ) -= this->gainUncertaintyProduct_ * kalmanGain.transpose( );
+        this->saveCovarianceEstimateToHistory( this->aPosterioriCovarianceEstimate_ );
     }
 
     //! System function input by user.
@@ -462,22 +456,49 @@ private:
      */
     DependentMatrix augmentedCovarianceMatrix_;
 
-    //! Map of sigma points.
+    //! Matrix of sigma points.
     /*!
-     *  Map of sigma points, as output by the computeSigmaPoints function. See the description of this function for more
-     *  details of the sigma points and their use.
+     *  Matrix of sigma points (one column per sigma point), as output by the computeSigmaPoints function. See the description
+     *  of this function for more details of the sigma points and their use.
      */
-    std::map< unsigned int, DependentVector > mapOfSigmaPoints_;
+    DependentMatrix sigmaPoints_;
+
+    //! History of sigma points.
+    FilterHistoryBuffer< IndependentVariableType, DependentMatrix > historyOfSigmaPoints_;
+
+    //! State estimates based on sigma points, one column per sigma point (workspace).
+    DependentMatrix sigmaPointStateEstimates_;
+
+    //! Measurement estimates based on sigma points, one column per sigma point (workspace).
+    DependentMatrix sigmaPointMeasurementEstimates_;
+
+    //! State part of current sigma point (workspace).
+    DependentVector sigmaPointState_;
+
+    //! Deviation of estimate based on sigma point w.r.t. weighted average (workspace).
+    DependentVector sigmaPointDeviation_;
+
+    //! Deviation of state estimate based on sigma point w.r.t. a-priori state estimate (workspace).
+    DependentVector stateDeviation_;
+
+    //! Deviation of measurement estimate based on sigma point w.r.t. measurement estimate (workspace).
+    DependentVector measurementDeviation_;
+
+    //! A-priori state estimate of the current step (workspace).
+    DependentVector aPrioriStateEstimate_;
+
+    //! A-priori covariance estimate of the current step (workspace).
+    DependentMatrix aPrioriCovarianceEstimate_;
 
-    //! Map of map of sigma points, used to store the history of sigma points.
-    std::map< IndependentVariableType, std::map< unsigned int, DependentVector > > historyOfSigmaPoints_;
+    //! Estimated measurement of the current step (workspace).
+    DependentVector measurementEstimate_;
 
-    //! Constant iterator to loop over sigma points (introduced for convenience).
-    typename std::map< unsigned int, DependentVector >::const_iterator sigmaPointConstantIterator_;
+    //! Cross-correlation between state and measurement estimates (workspace).
+    DependentMatrix crossCorrelationMatrix_;
 
     //! Integer specifying current sigma point.
     /*!
-     *  Integer specifying current sigma point, while iterating over the mapOfSigmaPoints_. This parameter is specifically used
+     *  Integer specifying current sigma point, while iterating over the sigma points. This parameter is specifically used
      *  when evaluating the systemFunction_ and measurementFunction_, such that the correct value of system and measurement
      *  noise can be added.
      */
@@ -0,0 +1,823 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Deuflhard, P. Order and stepsize control in extrapolation methods, Numerische Mathematik 41, 399-422, 1983.
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I: Nonstiff Problems, 2nd edition,
+ *          Springer, 1993 (Section II.9).
+ *
+ */
+
+#ifndef TUDAT_BULIRSCH_STOER_VARIABLE_ORDER_INTEGRATOR_H
+#define TUDAT_BULIRSCH_STOER_VARIABLE_ORDER_INTEGRATOR_H
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/integrators/numericalIntegrator.h"
+
+namespace tudat
+{
+
+namespace numerical_integrators
+{
+
+//! Class that implements an extrapolation (Gragg-Bulirsch-Stoer) integrator with variable order and step size.
+/*!
+ * Class that implements an extrapolation integrator based on the modified midpoint rule, with the order and step size
+ * control of Deuflhard (1983), as described by Hairer et al. (1993). At each step, the rows of the extrapolation tableau
+ * are only computed up to the point where the error estimate has converged (or is found not to converge, in which case the
+ * step is rejected early), and the number of rows for the next step is chosen to minimize the work (number of state
+ * derivative evaluations) per unit step. The tableau and all intermediate states are allocated once, upon construction.
+ * Dense output inside the last step is provided by a Hermite polynomial through the states and first derivatives at the
+ * start and end of the step, and the state and its higher derivatives at the middle of the step (Hairer et al., 1993). The
+ * latter are obtained by extrapolating the midpoint state and central differences of the state derivatives around the
+ * midpoint, from those rows in which the midpoint has the same parity as in the last row. For the accuracy of the dense
+ * output to be similar to that of the integration, all rows should have the same midpoint parity, as is the case for the
+ * hairer_wanner_sequence. No additional state derivative evaluations are needed for the dense output, which is only
+ * computed when it is first requested after a step.
+ * \tparam IndependentVariableType The type of the independent variable.
+ * \tparam StateType The type of the state. This type should be an Eigen::Matrix derived type.
+ * \tparam StateDerivativeType The type of the state derivative. This type should be an Eigen::Matrix derived type.
+ * \tparam TimeStepType The type of the time step.
+ * \sa NumericalIntegrator.
+ */
+template< typename IndependentVariableType = double, typename StateType = Eigen::VectorXd,
+          typename StateDerivativeType = Eigen::VectorXd, typename TimeStepType = double >
+class BulirschStoerVariableOrderIntegrator :
+        public NumericalIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+{
+public:
+
+    //! Typedef of the base class.
+    typedef NumericalIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType > Base;
+
+    //! Typedef to the state derivative function.
+    typedef typename Base::StateDerivativeFunction StateDerivativeFunction;
+
+    //! Typedef of the scalar type of the state.
+    typedef typename StateType::Scalar StateScalarType;
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param sequence Sequence of number of midpoint substeps for each row of the extrapolation tableau (at least 3 entries).
+     * \param stateDerivativeFunction State derivative function.
+     * \param intervalStart The start of the integration interval.
+     * \param initialState The initial state.
+     * \param minimumStepSize The minimum step size to take. If the step size needs to be reduced below this value to satisfy
+     *          the error tolerances, an exception is thrown.
+     * \param maximumStepSize The maximum step size to take.
+     * \param initialStepSize The initial step size.
+     * \param relativeErrorTolerance The relative error tolerance, equal for all state elements.
+     * \param absoluteErrorTolerance The absolute error tolerance, equal for all state elements.
+     */
+    BulirschStoerVariableOrderIntegrator(
+            const std::vector< unsigned int >& sequence,
+            const StateDerivativeFunction& stateDerivativeFunction,
+            const IndependentVariableType intervalStart,
+            const StateType& initialState,
+            const TimeStepType minimumStepSize,
+            const TimeStepType maximumStepSize,
+            const TimeStepType initialStepSize,
+            const StateScalarType relativeErrorTolerance = 1.0E-12,
+            const StateScalarType absoluteErrorTolerance = 1.0E-12 ):
+        Base( stateDerivativeFunction ),
+        sequence_( sequence ),
+        currentIndependentVariable_( intervalStart ), currentState_( initialState ),
+        lastIndependentVariable_( intervalStart ), lastState_( initialState ),
+        minimumStepSize_( std::fabs( minimumStepSize ) ), maximumStepSize_( std::fabs( maximumStepSize ) ),
+        stepSize_( initialStepSize ),
+        relativeErrorTolerance_( relativeErrorTolerance ), absoluteErrorTolerance_( absoluteErrorTolerance )
+    {
+        maximumNumberOfRows_ = static_cast< int >( sequence_.size( ) );
+        if( maximumNumberOfRows_ < 3 )
+        {
+            throw std::runtime_error( "Error when creating variable order Bulirsch-Stoer integrator, sequence must have at least "
+                                      "3 entries, has " + std::to_string( maximumNumberOfRows_ ) );
+        }
+
+        // Compute work (number of state derivative evaluations) needed to compute each row of the tableau.
+        workPerRow_.resize( maximumNumberOfRows_ );
+        workPerRow_[ 0 ] = static_cast< TimeStepType >( sequence_[ 0 ] + 1 );
+        for( int j = 1; j < maximumNumberOfRows_; j++ )
+        {
+            workPerRow_[ j ] = workPerRow_[ j - 1 ] + static_cast< TimeStepType >( sequence_[ j ] );
+        }
+        optimalStepSizes_.resize( maximumNumberOfRows_ );
+        workPerUnitStep_.resize( maximumNumberOfRows_ );
+
+        // Initial number of rows, chosen from tolerance (Hairer et al., 1993).
+        double logarithmOfTolerance = -std::log10( static_cast< double >( relativeErrorTolerance_ ) + 1.0E-40 ) * 0.6 + 0.5;
+        currentNumberOfRows_ = std::max( 2, std::min( maximumNumberOfRows_ - 1, static_cast< int >( logarithmOfTolerance ) ) );
+
+        // Allocate tableau and work states.
+        const StateType zeroState = StateType::Zero( initialState.rows( ), initialState.cols( ) );
+        extrapolationTableau_.assign( maximumNumberOfRows_, zeroState );
+        midpointStates_.assign( maximumNumberOfRows_, zeroState );
+        substepStateDerivatives_.resize( maximumNumberOfRows_ );
+        for( int j = 0; j < maximumNumberOfRows_; j++ )
+        {
+            substepStateDerivatives_[ j ].assign( sequence_[ j ], zeroState );
+        }
+        denseOutputTableau_.assign( maximumNumberOfRows_, zeroState );
+        denseOutputSequence_.reserve( maximumNumberOfRows_ );
+        denseOutputRowIndices_.reserve( maximumNumberOfRows_ );
+        previousTableauEntry_ = zeroState;
+        newTableauEntry_ = zeroState;
+        previousSubstepState_ = zeroState;
+        currentSubstepState_ = zeroState;
+        nextSubstepState_ = zeroState;
+        centralDifference_ = zeroState;
+        currentStateDerivative_ = zeroState;
+        lastStateDerivative_ = zeroState;
+
+        // Dense output polynomial has at most 2 * maximumNumberOfRows_ + 2 coefficients (see computeDenseOutputCoefficients).
+        denseOutputCoefficients_.assign( 2 * maximumNumberOfRows_ + 2, zeroState );
+        denseOutputNodes_.resize( 2 * maximumNumberOfRows_ + 2 );
+        midpointDerivatives_.assign( 2 * maximumNumberOfRows_ - 2, zeroState );
+    }
+
+    //! Destructor.
+    ~BulirschStoerVariableOrderIntegrator( ){ }
+
+    //! Get step size of the next step.
+    TimeStepType getNextStepSize( ) const { return stepSize_; }
+
+    //! Get current state.
+    StateType getCurrentState( ) const { return currentState_; }
+
+    //! Returns the current independent variable.
+    IndependentVariableType getCurrentIndependentVariable( ) const { return currentIndependentVariable_; }
+
+    //! Returns the previous independent variable.
+    IndependentVariableType getPreviousIndependentVariable( ) { return lastIndependentVariable_; }
+
+    //! Returns the previous state.
+    StateType getPreviousState( ) { return lastState_; }
+
+    //! Returns the number of rows of the extrapolation tableau that was used in the last step.
+    int getNumberOfRowsInLastStep( ) const { return numberOfRowsInLastStep_; }
+
+    //! Returns the number of rows of the extrapolation tableau that is targeted in the next step.
+    int getCurrentNumberOfRows( ) const { return currentNumberOfRows_; }
+
+    //! Returns the total number of state derivative evaluations.
+    unsigned int getNumberOfStateDerivativeEvaluations( ) const { return numberOfStateDerivativeEvaluations_; }
+
+    //! Perform a single integration step.
+    /*!
+     * Perform a single integration step. If the error estimate of the step exceeds the tolerances, the step is redone with
+     * a smaller step size (and possibly lower order), until it succeeds. The step size that was actually used can be
+     * obtained from the difference between the current and previous independent variable.
+     * \param stepSize The step size to attempt.
+     * \return The state at the end of the step.
+     */
+    StateType performIntegrationStep( const TimeStepType stepSize );
+
+    //! Compute the state at a given value of the independent variable inside the last step.
+    /*!
+     * Compute the state at a given value of the independent variable inside the last step, from the Hermite polynomial
+     * through the states and first derivatives at the start and end of the step, and the state and its higher derivatives
+     * at the middle of the step. The polynomial is computed upon the first call after each step.
+     * \param independentVariable Independent variable at which the state is to be computed.
+     * \return Interpolated state.
+     */
+    StateType getDenseOutputState( const IndependentVariableType independentVariable );
+
+    //! Rollback internal state to the last state.
+    /*!
+     * Performs rollback of the current state and independent variable to those before the last step. Can only be called once
+     * after each step.
+     * \return True if the rollback was successful.
+     */
+    bool rollbackToPreviousState( )
+    {
+        if( currentIndependentVariable_ == lastIndependentVariable_ )
+        {
+            return false;
+        }
+
+        currentIndependentVariable_ = lastIndependentVariable_;
+        currentState_ = lastState_;
+        currentStateDerivative_ = lastStateDerivative_;
+        numberOfRowsInLastStep_ = 0;
+        return true;
+    }
+
+    //! Replace the state with a new value.
+    /*!
+     * Replace the state with a new value.
+     * \param newState The value of the new state.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
+    {
+        currentState_ = newState;
+        if( !allowRollback )
+        {
+            lastIndependentVariable_ = currentIndependentVariable_;
+        }
+        isCurrentStateDerivativeComputed_ = false;
+        numberOfRowsInLastStep_ = 0;
+    }
+
+    //! Modify the state and time for the current step.
+    /*!
+     * Modify the state and time for the current step.
+     * \param newState The new state to set the current state to.
+     * \param newTime The time to set the current time to.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentIntegrationVariables( const StateType& newState, const IndependentVariableType newTime,
+                                            const bool allowRollback = false )
+    {
+        currentIndependentVariable_ = newTime;
+        modifyCurrentState( newState, allowRollback );
+    }
+
+private:
+
+    //! Function to compute a single row of the extrapolation tableau.
+    /*!
+     * Function to compute a single row of the extrapolation tableau, by integrating over the full step with the modified
+     * midpoint rule, and extrapolating the result with the previous rows. The state at the midpoint of the step and the
+     * state derivatives at all substeps are stored for the dense output.
+     * \param rowIndex Index of the row (from 0).
+     * \param stepSize Size of the full step.
+     */
+    void computeTableauRow( const int rowIndex, const TimeStepType stepSize );
+
+    //! Function to compute the coefficients of the dense output polynomial for the last step.
+    void computeDenseOutputCoefficients( );
+
+    //! Function to add a new entry to the first column of an extrapolation tableau, and update the other columns.
+    /*!
+     * Function to add a new entry to the first column of an extrapolation tableau, and update the other columns by
+     * polynomial extrapolation in the square of the substep size. On input, the tableau contains the entries of the previous
+     * row; on output, those of the new row (last entry being the extrapolated value of highest order).
+     * \param tableau Extrapolation tableau that is to be updated.
+     * \param newEntry Value of new entry in first column.
+     * \param numberOfSubsteps Number of substeps for each row of the tableau (up to and including the new row).
+     * \param rowIndex Index of the new row in the tableau.
+     */
+    void addEntryToTableau( std::vector< StateType >& tableau, const StateType& newEntry,
+                            const std::vector< unsigned int >& numberOfSubsteps, const int rowIndex );
+
+    //! Function to compute the weighted root-mean-square norm of the difference between two states.
+    TimeStepType computeScaledError( const StateType& firstState, const StateType& secondState )
+    {
+        return static_cast< TimeStepType >(
+                    std::sqrt( ( ( firstState - secondState ).array( ) /
+                                 ( absoluteErrorTolerance_ + relativeErrorTolerance_ *
+                                   currentState_.array( ).abs( ).max( firstState.array( ).abs( ) ) ) ).square( ).sum( ) /
+                               static_cast< StateScalarType >( firstState.size( ) ) ) );
+    }
+
+    //! Sequence of number of midpoint substeps for each row of the extrapolation tableau.
+    std::vector< unsigned int > sequence_;
+
+    //! Current independent variable.
+    IndependentVariableType currentIndependentVariable_;
+
+    //! Current state.
+    StateType currentState_;
+
+    //! Independent variable before the last step.
+    IndependentVariableType lastIndependentVariable_;
+
+    //! State before the last step.
+    StateType lastState_;
+
+    //! Minimum step size (absolute value).
+    TimeStepType minimumStepSize_;
+
+    //! Maximum step size (absolute value).
+    TimeStepType maximumStepSize_;
+
+    //! Step size to be used for the next step.
+    TimeStepType stepSize_;
+
+    //! Relative error tolerance.
+    StateScalarType relativeErrorTolerance_;
+
+    //! Absolute error tolerance.
+    StateScalarType absoluteErrorTolerance_;
+
+    //! Maximum number of rows in the tableau (size of sequence).
+    int maximumNumberOfRows_;
+
+    //! Number of rows targeted in the next step (the step may use one row more or less).
+    int currentNumberOfRows_;
+
+    //! Number of rows used in the last step (0 if no step has been taken since the last reset).
+    int numberOfRowsInLastStep_ = 0;
+
+    //! Boolean denoting whether currentStateDerivative_ corresponds to the current state.
+    bool isCurrentStateDerivativeComputed_ = false;
+
+    //! Boolean denoting whether the dense output coefficients have been computed for the last step.
+    bool areDenseOutputCoefficientsComputed_ = false;
+
+    //! Total number of state derivative evaluations.
+    unsigned int numberOfStateDerivativeEvaluations_ = 0;
+
+    //! Number of state derivative evaluations needed to compute each row of the tableau.
+    std::vector< TimeStepType > workPerRow_;
+
+    //! Optimal step size as estimated from each row of the tableau in the current step.
+    std::vector< TimeStepType > optimalStepSizes_;
+
+    //! Work per unit step, as estimated from each row of the tableau in the current step.
+    std::vector< TimeStepType > workPerUnitStep_;
+
+    //! Extrapolation tableau of states at end of step (entries of current row).
+    std::vector< StateType > extrapolationTableau_;
+
+    //! States at the middle of the step, for each row of the tableau.
+    std::vector< StateType > midpointStates_;
+
+    //! State derivatives at each substep (index 1 to number of substeps - 1), for each row of the tableau.
+    std::vector< std::vector< StateType > > substepStateDerivatives_;
+
+    //! Extrapolation tableau used for the derivatives at the middle of the step.
+    std::vector< StateType > denseOutputTableau_;
+
+    //! Number of substeps of the rows that are used in the current entry of denseOutputTableau_.
+    std::vector< unsigned int > denseOutputSequence_;
+
+    //! Indices of the rows that are used for the dense output of the last step.
+    std::vector< int > denseOutputRowIndices_;
+
+    //! Work states used in the tableau update.
+    StateType previousTableauEntry_;
+    StateType newTableauEntry_;
+
+    //! Work states used in the modified midpoint integration.
+    StateType previousSubstepState_;
+    StateType currentSubstepState_;
+    StateType nextSubstepState_;
+
+    //! Work state used for central differences of state derivatives around the midpoint.
+    StateType centralDifference_;
+
+    //! Derivatives at the middle of the last step, w.r.t. normalized independent variable and divided by factorial of order.
+    std::vector< StateType > midpointDerivatives_;
+
+    //! State derivative at the current state.
+    StateType currentStateDerivative_;
+
+    //! State derivative at the state before the last step.
+    StateType lastStateDerivative_;
+
+    //! Coefficients of the dense output polynomial (Newton form).
+    std::vector< StateType > denseOutputCoefficients_;
+
+    //! Interpolation nodes of the dense output polynomial (normalized independent variable, Newton form).
+    std::vector< TimeStepType > denseOutputNodes_;
+
+    //! Number of coefficients of the dense output polynomial for the last step.
+    int numberOfDenseOutputCoefficients_ = 0;
+
+};
+
+//! Perform a single integration step.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType BulirschStoerVariableOrderIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+performIntegrationStep( const TimeStepType stepSize )
+{
+    if( !( stepSize == stepSize ) )
+    {
+        throw std::runtime_error( "Error in variable order Bulirsch-Stoer integrator, step size is NaN" );
+    }
+
+    // Factors used in order/step size selection (Hairer et al., 1993).
+    const TimeStepType orderDecreaseFactor = 0.9;
+    const TimeStepType orderIncreaseFactor = 0.9;
+
+    if( !isCurrentStateDerivativeComputed_ )
+    {
+        currentStateDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+        numberOfStateDerivativeEvaluations_++;
+        isCurrentStateDerivativeComputed_ = true;
+    }
+
+    TimeStepType currentStepSize = stepSize;
+    if( std::fabs( currentStepSize ) > maximumStepSize_ )
+    {
+        currentStepSize = ( currentStepSize < 0.0 ) ? -maximumStepSize_ : maximumStepSize_;
+    }
+
+    // The first step after (re)initialization is treated as following a rejected step, accepting the first converged row.
+    bool stepIsRejected = ( numberOfRowsInLastStep_ == 0 );
+    int acceptedRow = -1;
+    while( acceptedRow < 0 )
+    {
+        // Compute rows up to (at most) one more than the targeted number, monitoring convergence of the error estimate.
+        const int k = currentNumberOfRows_;
+        int lastComputedRow = 0;
+        bool rejectStep = false;
+        for( int j = 0; j < std::min( k + 1, maximumNumberOfRows_ ) && acceptedRow < 0 && !rejectStep; j++ )
+        {
+            computeTableauRow( j, currentStepSize );
+            lastComputedRow = j;
+            if( j == 0 )
+            {
+                continue;
+            }
+
+            // Estimate error and optimal step size from current row.
+            TimeStepType error = computeScaledError( extrapolationTableau_[ j ], extrapolationTableau_[ j - 1 ] );
+            if( !( error == error ) || std::isinf( static_cast< double >( error ) ) )
+            {
+                error = 1.0E20;
+            }
+            TimeStepType exponent = 1.0 / static_cast< TimeStepType >( 2 * j + 1 );
+            TimeStepType minimumFactor = std::pow( 0.02, exponent );
+            TimeStepType stepSizeFactor = std::min(
+                        4.0 / minimumFactor, std::max( minimumFactor, std::pow( error / 0.65, exponent ) / 0.94 ) );
+            optimalStepSizes_[ j ] = std::min( std::fabs( currentStepSize ) / stepSizeFactor, maximumStepSize_ );
+            workPerUnitStep_[ j ] = workPerRow_[ j ] / optimalStepSizes_[ j ];
+
+            // Check convergence: accept if converged, reject early if convergence is not expected in the next rows.
+            const TimeStepType firstStepCount = static_cast< TimeStepType >( sequence_[ 0 ] );
+            if( stepIsRejected )
+            {
+                if( error <= 1.0 )
+                {
+                    acceptedRow = j;
+                }
+                else if( j == std::min( k + 1, maximumNumberOfRows_ ) - 1 )
+                {
+                    rejectStep = true;
+                }
+            }
+            else if( j == k - 2 )
+            {
+                if( error <= 1.0 )
+                {
+                    acceptedRow = j;
+                }
+                else if( error > std::pow( static_cast< TimeStepType >( sequence_[ k ] * sequence_[ k - 1 ] ) /
+                                           ( firstStepCount * firstStepCount ), 2 ) )
+                {
+                    rejectStep = true;
+                }
+            }
+            else if( j == k - 1 )
+            {
+                if( error <= 1.0 )
+                {
+                    acceptedRow = j;
+                }
+                else if( j + 1 >= maximumNumberOfRows_ ||
+                         error > std::pow( static_cast< TimeStepType >( sequence_[ k ] ) / firstStepCount, 2 ) )
+                {
+                    rejectStep = true;
+                }
+            }
+            else if( j == k )
+            {
+                if( error <= 1.0 )
+                {
+                    acceptedRow = j;
+                }
+                else
+                {
+                    rejectStep = true;
+                }
+            }
+        }
+
+        if( acceptedRow < 0 )
+        {
+            // Step is rejected: select order from rows computed so far, and reduce step size.
+            int newNumberOfRows = std::max( 2, std::min( k, lastComputedRow + 1 ) );
+            if( newNumberOfRows > 2 && workPerUnitStep_[ newNumberOfRows - 2 ] <
+                    orderDecreaseFactor * workPerUnitStep_[ newNumberOfRows - 1 ] )
+            {
+                newNumberOfRows--;
+            }
+            currentNumberOfRows_ = newNumberOfRows;
+            currentStepSize = ( currentStepSize < 0.0 ) ? -optimalStepSizes_[ newNumberOfRows - 1 ] :
+                                                          optimalStepSizes_[ newNumberOfRows - 1 ];
+            stepIsRejected = true;
+
+            if( std::fabs( currentStepSize ) < minimumStepSize_ )
+            {
+                throw std::runtime_error( "Error in variable order Bulirsch-Stoer integrator, minimum step size " +
+                                          std::to_string( static_cast< double >( minimumStepSize_ ) ) +
+                                          " is higher than required time step " +
+                                          std::to_string( static_cast< double >( currentStepSize ) ) );
+            }
+        }
+    }
+
+    // Update state.
+    lastIndependentVariable_ = currentIndependentVariable_;
+    lastState_ = currentState_;
+    lastStateDerivative_ = currentStateDerivative_;
+    currentIndependentVariable_ = lastIndependentVariable_ + currentStepSize;
+    currentState_ = extrapolationTableau_[ acceptedRow ];
+    currentStateDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+    numberOfStateDerivativeEvaluations_++;
+    isCurrentStateDerivativeComputed_ = true;
+    areDenseOutputCoefficientsComputed_ = false;
+    numberOfRowsInLastStep_ = acceptedRow + 1;
+
+    // Select number of rows for next step, minimizing work per unit step. Variables below are numbers of rows (from 1).
+    const int numberOfRowsUsed = acceptedRow + 1;
+    const int k = currentNumberOfRows_;
+    int optimalNumberOfRows;
+    if( numberOfRowsUsed == 2 )
+    {
+        optimalNumberOfRows = stepIsRejected ? 2 : std::min( 3, maximumNumberOfRows_ - 1 );
+    }
+    else if( numberOfRowsUsed <= k )
+    {
+        optimalNumberOfRows = numberOfRowsUsed;
+        if( workPerUnitStep_[ numberOfRowsUsed - 2 ] < orderDecreaseFactor * workPerUnitStep_[ numberOfRowsUsed - 1 ] )
+        {
+            optimalNumberOfRows = numberOfRowsUsed - 1;
+        }
+        if( workPerUnitStep_[ numberOfRowsUsed - 1 ] < orderIncreaseFactor * workPerUnitStep_[ numberOfRowsUsed - 2 ] )
+        {
+            optimalNumberOfRows = std::min( numberOfRowsUsed + 1, maximumNumberOfRows_ - 1 );
+        }
+    }
+    else
+    {
+        optimalNumberOfRows = numberOfRowsUsed - 1;
+        if( numberOfRowsUsed > 3 && workPerUnitStep_[ numberOfRowsUsed - 3 ] <
+                orderDecreaseFactor * workPerUnitStep_[ numberOfRowsUsed - 2 ] )
+        {
+            optimalNumberOfRows = numberOfRowsUsed - 2;
+        }
+        if( workPerUnitStep_[ numberOfRowsUsed - 1 ] < orderIncreaseFactor * workPerUnitStep_[ optimalNumberOfRows - 1 ] )
+        {
+            optimalNumberOfRows = std::min( numberOfRowsUsed, maximumNumberOfRows_ - 1 );
+        }
+    }
+
+    // Select step size for next step.
+    TimeStepType newStepSize;
+    if( stepIsRejected )
+    {
+        currentNumberOfRows_ = std::min( optimalNumberOfRows, numberOfRowsUsed );
+        newStepSize = std::min( std::fabs( currentStepSize ), optimalStepSizes_[ currentNumberOfRows_ - 1 ] );
+    }
+    else
+    {
+        if( optimalNumberOfRows <= numberOfRowsUsed )
+        {
+            newStepSize = optimalStepSizes_[ optimalNumberOfRows - 1 ];
+        }
+        else
+        {
+            newStepSize = optimalStepSizes_[ numberOfRowsUsed - 1 ] * workPerRow_[ optimalNumberOfRows - 1 ] /
+                    workPerRow_[ numberOfRowsUsed - 1 ];
+        }
+        currentNumberOfRows_ = optimalNumberOfRows;
+    }
+    newStepSize = std::max( std::min( newStepSize, maximumStepSize_ ), minimumStepSize_ );
+    stepSize_ = ( currentStepSize < 0.0 ) ? -newStepSize : newStepSize;
+
+    return currentState_;
+}
+
+//! Function to compute a single row of the extrapolation tableau.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void BulirschStoerVariableOrderIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+computeTableauRow( const int rowIndex, const TimeStepType stepSize )
+{
+    const unsigned int numberOfSubsteps = sequence_[ rowIndex ];
+    const TimeStepType substepSize = stepSize / static_cast< TimeStepType >( numberOfSubsteps );
+    const StateScalarType scalarSubstepSize = static_cast< StateScalarType >( substepSize );
+    std::vector< StateType >& substepStateDerivatives = substepStateDerivatives_[ rowIndex ];
+
+    // Modified midpoint rule, starting with Euler step.
+    previousSubstepState_ = currentState_;
+    currentSubstepState_ = currentState_ + scalarSubstepSize * currentStateDerivative_;
+    for( unsigned int i = 1; i < numberOfSubsteps; i++ )
+    {
+        substepStateDerivatives[ i ] = this->stateDerivativeFunction_(
+                    currentIndependentVariable_ + static_cast< TimeStepType >( i ) * substepSize, currentSubstepState_ );
+        numberOfStateDerivativeEvaluations_++;
+
+        if( 2 * i == numberOfSubsteps )
+        {
+            midpointStates_[ rowIndex ] = currentSubstepState_;
+        }
+
+        nextSubstepState_ = previousSubstepState_ + 2.0 * scalarSubstepSize * substepStateDerivatives[ i ];
+        previousSubstepState_.swap( currentSubstepState_ );
+        currentSubstepState_.swap( nextSubstepState_ );
+    }
+
+    // Extrapolate end state.
+    addEntryToTableau( extrapolationTableau_, currentSubstepState_, sequence_, rowIndex );
+}
+
+//! Function to add a new entry to the first column of an extrapolation tableau, and update the other columns.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void BulirschStoerVariableOrderIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+addEntryToTableau( std::vector< StateType >& tableau, const StateType& newEntry,
+                   const std::vector< unsigned int >& numberOfSubsteps, const int rowIndex )
+{
+    previousTableauEntry_.swap( tableau[ 0 ] );
+    tableau[ 0 ] = newEntry;
+    for( int l = 0; l < rowIndex; l++ )
+    {
+        // On entry, tableau[ l ] is entry l of the new row, previousTableauEntry_ is entry l of the previous row.
+        StateScalarType stepRatio = static_cast< StateScalarType >( numberOfSubsteps[ rowIndex ] ) /
+                static_cast< StateScalarType >( numberOfSubsteps[ rowIndex - l - 1 ] );
+        newTableauEntry_ = tableau[ l ] + ( tableau[ l ] - previousTableauEntry_ ) / ( stepRatio * stepRatio - 1.0 );
+        if( l + 1 < rowIndex )
+        {
+            previousTableauEntry_.swap( tableau[ l + 1 ] );
+        }
+        tableau[ l + 1 ].swap( newTableauEntry_ );
+    }
+}
+
+//! Function to compute the coefficients of the dense output polynomial for the last step.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void BulirschStoerVariableOrderIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+computeDenseOutputCoefficients( )
+{
+    const StateScalarType scalarStepSize =
+            static_cast< StateScalarType >( currentIndependentVariable_ - lastIndependentVariable_ );
+
+    // Select rows for which the midpoint has the same parity as in the last row: the substep states (and state derivatives)
+    // with even and odd index have different asymptotic error expansions, which can not be combined.
+    const int lastRow = numberOfRowsInLastStep_ - 1;
+    denseOutputRowIndices_.clear( );
+    for( int j = 0; j <= lastRow; j++ )
+    {
+        if( sequence_[ j ] % 4 == sequence_[ lastRow ] % 4 )
+        {
+            denseOutputRowIndices_.push_back( j );
+        }
+    }
+    const int numberOfRows = static_cast< int >( denseOutputRowIndices_.size( ) );
+
+    // Highest derivative at midpoint: limited by number of selected rows (as in Hairer et al., 1993), and by the number of
+    // substeps available around the midpoint for the central differences.
+    const int maximumDerivativeOrder = std::max(
+                0, std::min( 2 * numberOfRows - 3, static_cast< int >( sequence_[ lastRow ] / 2 ) ) );
+
+    // Set interpolation nodes (normalized independent variable): start, middle (with multiplicity of number of derivatives
+    // plus one) and end of step.
+    numberOfDenseOutputCoefficients_ = maximumDerivativeOrder + 5;
+    denseOutputNodes_[ 0 ] = 0.0;
+    denseOutputNodes_[ 1 ] = 0.0;
+    for( int i = 0; i <= maximumDerivativeOrder; i++ )
+    {
+        denseOutputNodes_[ i + 2 ] = 0.5;
+    }
+    denseOutputNodes_[ maximumDerivativeOrder + 3 ] = 1.0;
+    denseOutputNodes_[ maximumDerivativeOrder + 4 ] = 1.0;
+
+    // Compute derivatives of order 0 to maximumDerivativeOrder at midpoint (w.r.t. normalized independent variable, and
+    // divided by factorial of order) by extrapolation.
+    StateScalarType factorial = 1.0;
+    for( int derivativeOrder = 0; derivativeOrder <= maximumDerivativeOrder; derivativeOrder++ )
+    {
+        denseOutputSequence_.clear( );
+        for( int l = 0; l < numberOfRows; l++ )
+        {
+            const int rowIndex = denseOutputRowIndices_[ l ];
+            const int midpointIndex = static_cast< int >( sequence_[ rowIndex ] / 2 );
+            if( derivativeOrder == 0 )
+            {
+                centralDifference_ = midpointStates_[ rowIndex ];
+            }
+            else if( midpointIndex >= derivativeOrder )
+            {
+                // Central difference of state derivatives (with step of two substeps), scaled to derivative of order
+                // derivativeOrder w.r.t. normalized independent variable.
+                const int differenceOrder = derivativeOrder - 1;
+                const std::vector< StateType >& substepStateDerivatives = substepStateDerivatives_[ rowIndex ];
+                StateScalarType binomialCoefficient = 1.0;
+                centralDifference_ = substepStateDerivatives[ midpointIndex + differenceOrder ];
+                for( int k = 1; k <= differenceOrder; k++ )
+                {
+                    binomialCoefficient *= -static_cast< StateScalarType >( differenceOrder - k + 1 ) /
+                            static_cast< StateScalarType >( k );
+                    centralDifference_ += binomialCoefficient *
+                            substepStateDerivatives[ midpointIndex + differenceOrder - 2 * k ];
+                }
+                centralDifference_ *= scalarStepSize * std::pow(
+                            static_cast< StateScalarType >( sequence_[ rowIndex ] ) / 2.0, differenceOrder );
+            }
+            else
+            {
+                continue;
+            }
+            denseOutputSequence_.push_back( sequence_[ rowIndex ] );
+            addEntryToTableau( denseOutputTableau_, centralDifference_, denseOutputSequence_,
+                               denseOutputSequence_.size( ) - 1 );
+        }
+        factorial *= static_cast< StateScalarType >( std::max( derivativeOrder, 1 ) );
+        midpointDerivatives_[ derivativeOrder ] = denseOutputTableau_[ denseOutputSequence_.size( ) - 1 ] / factorial;
+    }
+
+    // Compute divided differences of confluent (Hermite) interpolation problem, overwriting the derivative values. Entry i
+    // at level l is the divided difference over nodes i - l to i, equal to the (scaled) l-th derivative divided by l! if
+    // these nodes coincide.
+    std::vector< StateType >& c = denseOutputCoefficients_;
+    for( int i = 0; i < numberOfDenseOutputCoefficients_; i++ )
+    {
+        if( denseOutputNodes_[ i ] == 0.0 )
+        {
+            c[ i ] = lastState_;
+        }
+        else if( denseOutputNodes_[ i ] == 1.0 )
+        {
+            c[ i ] = currentState_;
+        }
+        else
+        {
+            c[ i ] = midpointDerivatives_[ 0 ];
+        }
+    }
+
+    for( int level = 1; level < numberOfDenseOutputCoefficients_; level++ )
+    {
+        for( int i = numberOfDenseOutputCoefficients_ - 1; i >= level; i-- )
+        {
+            if( denseOutputNodes_[ i ] == denseOutputNodes_[ i - level ] )
+            {
+                if( denseOutputNodes_[ i ] == 0.0 )
+                {
+                    c[ i ] = scalarStepSize * lastStateDerivative_;
+                }
+                else if( denseOutputNodes_[ i ] == 1.0 )
+                {
+                    c[ i ] = scalarStepSize * currentStateDerivative_;
+                }
+                else
+                {
+                    c[ i ] = midpointDerivatives_[ level ];
+                }
+            }
+            else
+            {
+                c[ i ] = ( c[ i ] - c[ i - 1 ] ) /
+                        static_cast< StateScalarType >( denseOutputNodes_[ i ] - denseOutputNodes_[ i - level ] );
+            }
+        }
+    }
+}
+
+//! Compute the state at a given value of the independent variable inside the last step.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType BulirschStoerVariableOrderIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+getDenseOutputState( const IndependentVariableType independentVariable )
+{
+    if( numberOfRowsInLastStep_ == 0 )
+    {
+        throw std::runtime_error( "Error in variable order Bulirsch-Stoer integrator, dense output requested before first step." );
+    }
+
+    if( !areDenseOutputCoefficientsComputed_ )
+    {
+        computeDenseOutputCoefficients( );
+        areDenseOutputCoefficientsComputed_ = true;
+    }
+
+    // Evaluate polynomial in Newton form.
+    const TimeStepType theta = static_cast< TimeStepType >( independentVariable - lastIndependentVariable_ ) /
+            static_cast< TimeStepType >( currentIndependentVariable_ - lastIndependentVariable_ );
+    StateType interpolatedState = denseOutputCoefficients_[ numberOfDenseOutputCoefficients_ - 1 ];
+    for( int i = numberOfDenseOutputCoefficients_ - 2; i >= 0; i-- )
+    {
+        interpolatedState = denseOutputCoefficients_[ i ] +
+                static_cast< StateScalarType >( theta - denseOutputNodes_[ i ] ) * interpolatedState;
+    }
+    return interpolatedState;
+}
+
+extern template class BulirschStoerVariableOrderIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+extern template class BulirschStoerVariableOrderIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+extern template class BulirschStoerVariableOrderIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+//! Typedef of variable order Bulirsch-Stoer integrator (state/state derivative = VectorXd, independent variable = double).
+typedef BulirschStoerVariableOrderIntegrator< > BulirschStoerVariableOrderIntegratorXd;
+
+} // namespace numerical_integrators
+
+} // namespace tudat
+
+#endif // TUDAT_BULIRSCH_STOER_VARIABLE_ORDER_INTEGRATOR_H
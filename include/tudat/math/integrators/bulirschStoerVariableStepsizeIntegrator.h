@@ -33,7 +33,8 @@ namespace numerical_integrators
 enum ExtrapolationMethodStepSequences
 {
     bulirsch_stoer_sequence = 0,
-    deufelhard_sequence = 1
+    deufelhard_sequence = 1,
+    hairer_wanner_sequence = 2
 };
 
 // Function to retrieve the sequence of number of steps to used for Bulirsch-Stoer integration
@@ -24,6 +24,8 @@
 #include "tudat/math/integrators/euler.h"
 #include "tudat/math/integrators/adamsBashforthMoultonIntegrator.h"
 #include "tudat/math/integrators/rungeKuttaVariableStepSizeIntegrator.h"
+#include "tudat/math/integrators/shampineGordonIntegrator.h"
+#include "tudat/math/integrators/bulirschStoerVariableOrderIntegrator.h"
 #include "tudat/math/integrators/stepSizeController.h"
 
 namespace tudat
@@ -41,7 +43,9 @@ enum AvailableIntegrators
     rungeKuttaFixedStepSize,
     rungeKuttaVariableStepSize,
     bulirschStoer,
-    adamsBashforthMoulton
+    adamsBashforthMoulton,
+    shampineGordon,
+    bulirschStoerVariableOrder
 };
 
 class IntegratorStepSizeValidationSettings
@@ -981,6 +985,149 @@ public:
 
 };
 
+// Class to define settings of variable-order, variable-step Shampine-Gordon Adams numerical integrator.
+/*
+ *  Class to define settings of variable-order, variable-step Adams (PECE) numerical integrator of Shampine and Gordon,
+ *  which stores its history as modified divided differences, so that step size and order can be changed at each step
+ *  without restarting.
+ */
+template< typename IndependentVariableType = double >
+class ShampineGordonSettings: public IntegratorSettings< IndependentVariableType >
+{
+public:
+
+    // Constructor
+    /*
+     *  Constructor for Shampine-Gordon integrator settings.
+     *  \param initialTimeStep Initial time (independent variable) step used in numerical integration. Adapted during
+     *      integration (and reduced automatically if too large for the first order start).
+     *  \param minimumStepSize Minimum step size for integration. Integration stops (exception thrown) if time step
+     *      comes below this value.
+     *  \param maximumStepSize Maximum step size for integration.
+     *  \param relativeErrorTolerance Relative error tolerance for step size control.
+     *  \param absoluteErrorTolerance Absolute error tolerance for step size control.
+     *  \param maximumOrder Maximum order of integrator (default 12, which is also the highest value allowed).
+     *  \param assessTerminationOnMinorSteps Whether the propagation termination
+     *      conditions should be evaluated during the intermediate sub-steps of the integrator (`true`) or only at the end of
+     *      each integration step (`false`).
+     */
+    ShampineGordonSettings(
+            const IndependentVariableType initialTimeStep,
+            const IndependentVariableType minimumStepSize,
+            const IndependentVariableType maximumStepSize,
+            const double relativeErrorTolerance = 1.0E-12,
+            const double absoluteErrorTolerance = 1.0E-12,
+            const int maximumOrder = 12,
+            const bool assessTerminationOnMinorSteps = false ):
+        IntegratorSettings< IndependentVariableType >(
+            shampineGordon, TUDAT_NAN, initialTimeStep, assessTerminationOnMinorSteps ),
+        minimumStepSize_( minimumStepSize ), maximumStepSize_( maximumStepSize ),
+        relativeErrorTolerance_( relativeErrorTolerance ), absoluteErrorTolerance_( absoluteErrorTolerance ),
+        maximumOrder_( maximumOrder ) { }
+
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< ShampineGordonSettings< IndependentVariableType> >(
+                    this->initialTimeStep_, minimumStepSize_, maximumStepSize_,
+                    relativeErrorTolerance_, absoluteErrorTolerance_, maximumOrder_,
+                    this->assessTerminationOnMinorSteps_ );
+    }
+
+    // Destructor
+    ~ShampineGordonSettings( ){ }
+
+    // Minimum step size for integration.
+    IndependentVariableType minimumStepSize_;
+
+    // Maximum step size for integration.
+    IndependentVariableType maximumStepSize_;
+
+    // Relative error tolerance for step size control
+    double relativeErrorTolerance_;
+
+    // Absolute error tolerance for step size control
+    double absoluteErrorTolerance_;
+
+    // Maximum order of integrator
+    int maximumOrder_;
+
+};
+
+// Class to define settings of extrapolation (Bulirsch-Stoer) integrator with variable order and step size.
+/*
+ *  Class to define settings of extrapolation (Bulirsch-Stoer) integrator, for which both the number of rows of the
+ *  extrapolation tableau (order) and the step size are adapted at each step, to minimize the number of state derivative
+ *  evaluations per unit step (Deuflhard, 1983).
+ */
+template< typename IndependentVariableType = double >
+class BulirschStoerVariableOrderSettings: public IntegratorSettings< IndependentVariableType >
+{
+public:
+
+    // Constructor
+    /*
+     *  Constructor for variable order Bulirsch-Stoer integrator settings.
+     *  \param initialTimeStep Initial time (independent variable) step used in numerical integration. Adapted during
+     *      integration.
+     *  \param minimumStepSize Minimum step size for integration. Integration stops (exception thrown) if time step
+     *      comes below this value.
+     *  \param maximumStepSize Maximum step size for integration.
+     *  \param relativeErrorTolerance Relative error tolerance for step size control.
+     *  \param absoluteErrorTolerance Absolute error tolerance for step size control.
+     *  \param extrapolationSequence Type of sequence that is to be used for the number of substeps of each row. The default
+     *      deufelhard_sequence requires the fewest state derivative evaluations, the hairer_wanner_sequence should be used if
+     *      dense output is required with an accuracy similar to that of the integration itself.
+     *  \param maximumNumberOfRows Maximum number of rows of the extrapolation tableau (at least 3).
+     *  \param assessTerminationOnMinorSteps Whether the propagation termination
+     *      conditions should be evaluated during the intermediate sub-steps of the integrator (`true`) or only at the end of
+     *      each integration step (`false`).
+     */
+    BulirschStoerVariableOrderSettings(
+            const IndependentVariableType initialTimeStep,
+            const IndependentVariableType minimumStepSize,
+            const IndependentVariableType maximumStepSize,
+            const double relativeErrorTolerance = 1.0E-12,
+            const double absoluteErrorTolerance = 1.0E-12,
+            const ExtrapolationMethodStepSequences extrapolationSequence = deufelhard_sequence,
+            const unsigned int maximumNumberOfRows = 9,
+            const bool assessTerminationOnMinorSteps = false ):
+        IntegratorSettings< IndependentVariableType >(
+            bulirschStoerVariableOrder, TUDAT_NAN, initialTimeStep, assessTerminationOnMinorSteps ),
+        minimumStepSize_( minimumStepSize ), maximumStepSize_( maximumStepSize ),
+        relativeErrorTolerance_( relativeErrorTolerance ), absoluteErrorTolerance_( absoluteErrorTolerance ),
+        extrapolationSequence_( extrapolationSequence ), maximumNumberOfRows_( maximumNumberOfRows ) { }
+
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< BulirschStoerVariableOrderSettings< IndependentVariableType> >(
+                    this->initialTimeStep_, minimumStepSize_, maximumStepSize_,
+                    relativeErrorTolerance_, absoluteErrorTolerance_, extrapolationSequence_, maximumNumberOfRows_,
+                    this->assessTerminationOnMinorSteps_ );
+    }
+
+    // Destructor
+    ~BulirschStoerVariableOrderSettings( ){ }
+
+    // Minimum step size for integration.
+    IndependentVariableType minimumStepSize_;
+
+    // Maximum step size for integration.
+    IndependentVariableType maximumStepSize_;
+
+    // Relative error tolerance for step size control
+    double relativeErrorTolerance_;
+
+    // Absolute error tolerance for step size control
+    double absoluteErrorTolerance_;
+
+    // Type of sequence that is to be used for the number of substeps of each row.
+    ExtrapolationMethodStepSequences extrapolationSequence_;
+
+    // Maximum number of rows of the extrapolation tableau.
+    unsigned int maximumNumberOfRows_;
+
+};
+
 template< typename IndependentVariableType = double >
 inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > eulerSettingsDeprecated(
         const IndependentVariableType initialTime,
@@ -1362,6 +1509,39 @@ inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > adamsBas
         assessTerminationOnMinorSteps, 1.0 );
 }
 
+template< typename IndependentVariableType = double >
+inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > shampineGordonSettings(
+        const IndependentVariableType initialTimeStep,
+        const IndependentVariableType minimumStepSize,
+        const IndependentVariableType maximumStepSize,
+        const double relativeErrorTolerance = 1.0E-12,
+        const double absoluteErrorTolerance = 1.0E-12,
+        const int maximumOrder = 12,
+        const bool assessTerminationOnMinorSteps = false )
+{
+    return std::make_shared< ShampineGordonSettings< IndependentVariableType > >(
+                initialTimeStep, minimumStepSize, maximumStepSize,
+                relativeErrorTolerance, absoluteErrorTolerance,
+                maximumOrder, assessTerminationOnMinorSteps );
+}
+
+template< typename IndependentVariableType = double >
+inline std::shared_ptr< IntegratorSettings< IndependentVariableType > > bulirschStoerVariableOrderSettings(
+        const IndependentVariableType initialTimeStep,
+        const IndependentVariableType minimumStepSize,
+        const IndependentVariableType maximumStepSize,
+        const double relativeErrorTolerance = 1.0E-12,
+        const double absoluteErrorTolerance = 1.0E-12,
+        const ExtrapolationMethodStepSequences extrapolationSequence = deufelhard_sequence,
+        const unsigned int maximumNumberOfRows = 9,
+        const bool assessTerminationOnMinorSteps = false )
+{
+    return std::make_shared< BulirschStoerVariableOrderSettings< IndependentVariableType > >(
+                initialTimeStep, minimumStepSize, maximumStepSize,
+                relativeErrorTolerance, absoluteErrorTolerance,
+                extrapolationSequence, maximumNumberOfRows, assessTerminationOnMinorSteps );
+}
+
 // Function to create a numerical integrator.
 /*
  *  Function to create a numerical integrator from given integrator settings, state derivative function and initial state.
@@ -1695,6 +1875,73 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
         }
         break;
     }
+    case shampineGordon:
+    {
+        // Check input consistency
+        std::shared_ptr< ShampineGordonSettings< IndependentVariableType > > shampineGordonIntegratorSettings =
+                std::dynamic_pointer_cast< ShampineGordonSettings< IndependentVariableType > >( integratorSettings );
+
+        // Check that integrator type has been cast properly
+        if ( shampineGordonIntegratorSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, type of integrator settings (shampineGordon) not compatible with "
+                                      "selected integrator (derived class of IntegratorSettings must be ShampineGordonSettings "
+                                      "for this type)." );
+        }
+
+        if( std::fabs( static_cast< double >( shampineGordonIntegratorSettings->minimumStepSize_ ) ) >
+                std::fabs( static_cast< double >( shampineGordonIntegratorSettings->maximumStepSize_ ) ) )
+        {
+            throw std::runtime_error( "Error when making Shampine-Gordon integrator: minimum step size is larger than maximum step" );
+        }
+
+        // Create integrator
+        integrator = std::make_shared< ShampineGordonIntegrator
+                < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
+                ( stateDerivativeFunction, initialTime, initialState,
+                  static_cast< IndependentVariableStepType >( shampineGordonIntegratorSettings->minimumStepSize_ ),
+                  static_cast< IndependentVariableStepType >( shampineGordonIntegratorSettings->maximumStepSize_ ),
+                  static_cast< IndependentVariableStepType >( integratorSettings->initialTimeStep_ ),
+                  shampineGordonIntegratorSettings->relativeErrorTolerance_,
+                  shampineGordonIntegratorSettings->absoluteErrorTolerance_,
+                  shampineGordonIntegratorSettings->maximumOrder_ );
+        break;
+    }
+    case bulirschStoerVariableOrder:
+    {
+        // Check input consistency
+        std::shared_ptr< BulirschStoerVariableOrderSettings< IndependentVariableType > > bulirschStoerIntegratorSettings =
+                std::dynamic_pointer_cast< BulirschStoerVariableOrderSettings< IndependentVariableType > >(
+                    integratorSettings );
+
+        // Check that integrator type has been cast properly
+        if ( bulirschStoerIntegratorSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, type of integrator settings (bulirschStoerVariableOrder) not compatible with "
+                                      "selected integrator (derived class of IntegratorSettings must be "
+                                      "BulirschStoerVariableOrderSettings for this type)." );
+        }
+
+        if( std::fabs( static_cast< double >( bulirschStoerIntegratorSettings->minimumStepSize_ ) ) >
+                std::fabs( static_cast< double >( bulirschStoerIntegratorSettings->maximumStepSize_ ) ) )
+        {
+            throw std::runtime_error( "Error when making variable order Bulirsch-Stoer integrator: minimum step size is larger "
+                                      "than maximum step" );
+        }
+
+        // Create integrator
+        integrator = std::make_shared< BulirschStoerVariableOrderIntegrator
+                < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
+                ( getBulirschStoerStepSequence( bulirschStoerIntegratorSettings->extrapolationSequence_,
+                                                bulirschStoerIntegratorSettings->maximumNumberOfRows_ ),
+                  stateDerivativeFunction, initialTime, initialState,
+                  static_cast< IndependentVariableStepType >( bulirschStoerIntegratorSettings->minimumStepSize_ ),
+                  static_cast< IndependentVariableStepType >( bulirschStoerIntegratorSettings->maximumStepSize_ ),
+                  static_cast< IndependentVariableStepType >( integratorSettings->initialTimeStep_ ),
+                  bulirschStoerIntegratorSettings->relativeErrorTolerance_,
+                  bulirschStoerIntegratorSettings->absoluteErrorTolerance_ );
+        break;
+    }
     default:
         throw std::runtime_error( "Error, integrator " +  std::to_string( integratorSettings->integratorType_ ) + " not found." );
     }
@@ -0,0 +1,757 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Shampine, L.F., Gordon, M.K. Computer Solution of Ordinary Differential Equations: the Initial Value Problem,
+ *          W.H. Freeman, 1975.
+ *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *
+ */
+
+#ifndef TUDAT_SHAMPINE_GORDON_INTEGRATOR_H
+#define TUDAT_SHAMPINE_GORDON_INTEGRATOR_H
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <Eigen/Core>
+
+#include "tudat/math/integrators/numericalIntegrator.h"
+
+namespace tudat
+{
+
+namespace numerical_integrators
+{
+
+//! Class that implements the variable-order, variable-step Adams integrator of Shampine and Gordon.
+/*!
+ * Class that implements the variable-order, variable-step Adams-Bashforth-Moulton integrator of Shampine and Gordon (1975),
+ * in PECE mode. The integration history is stored as modified divided differences of the state derivative, so that the
+ * step size and the order (from 1 up to 12) are controlled independently at each step, without any restart or
+ * re-interpolation of the history when the step size changes. Each step requires two state derivative evaluations,
+ * regardless of the order. The integrator starts at first order, and doubles the step size/raises the order at each step
+ * until the error estimate indicates that this is no longer efficient. The state at any point inside the last step can be
+ * obtained at no additional cost from getDenseOutputState. All history is stored in preallocated fixed-size arrays, which
+ * are updated in place during the integration.
+ * \tparam IndependentVariableType The type of the independent variable.
+ * \tparam StateType The type of the state. This type should be an Eigen::Matrix derived type.
+ * \tparam StateDerivativeType The type of the state derivative. This type should be an Eigen::Matrix derived type.
+ * \tparam TimeStepType The type of the time step.
+ * \sa NumericalIntegrator.
+ */
+template< typename IndependentVariableType = double, typename StateType = Eigen::VectorXd,
+          typename StateDerivativeType = Eigen::VectorXd, typename TimeStepType = double >
+class ShampineGordonIntegrator :
+        public NumericalIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+{
+public:
+
+    //! Typedef of the base class.
+    typedef NumericalIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType > Base;
+
+    //! Typedef to the state derivative function.
+    typedef typename Base::StateDerivativeFunction StateDerivativeFunction;
+
+    //! Typedef of the scalar type of the state.
+    typedef typename StateType::Scalar StateScalarType;
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param stateDerivativeFunction State derivative function.
+     * \param intervalStart The start of the integration interval.
+     * \param initialState The initial state.
+     * \param minimumStepSize The minimum step size to take. If the step size needs to be reduced below this value to satisfy
+     *          the error tolerances, an exception is thrown.
+     * \param maximumStepSize The maximum step size to take.
+     * \param initialStepSize The initial step size (reduced internally if it is too large for the first order start).
+     * \param relativeErrorTolerance The relative error tolerance, equal for all state elements.
+     * \param absoluteErrorTolerance The absolute error tolerance, equal for all state elements.
+     * \param maximumOrder Maximum order of the integrator (between 1 and 12).
+     */
+    ShampineGordonIntegrator(
+            const StateDerivativeFunction& stateDerivativeFunction,
+            const IndependentVariableType intervalStart,
+            const StateType& initialState,
+            const TimeStepType minimumStepSize,
+            const TimeStepType maximumStepSize,
+            const TimeStepType initialStepSize,
+            const StateScalarType relativeErrorTolerance = 1.0E-12,
+            const StateScalarType absoluteErrorTolerance = 1.0E-12,
+            const int maximumOrder = 12 ):
+        Base( stateDerivativeFunction ),
+        currentIndependentVariable_( intervalStart ), currentState_( initialState ),
+        lastIndependentVariable_( intervalStart ), lastState_( initialState ),
+        minimumStepSize_( std::fabs( minimumStepSize ) ), maximumStepSize_( std::fabs( maximumStepSize ) ),
+        stepSize_( initialStepSize ),
+        relativeErrorTolerance_( relativeErrorTolerance ), absoluteErrorTolerance_( absoluteErrorTolerance ),
+        maximumOrder_( maximumOrder ), isStartingStep_( true )
+    {
+        if( maximumOrder_ < 1 || maximumOrder_ > 12 )
+        {
+            throw std::runtime_error( "Error when creating Shampine-Gordon integrator, maximum order must be between 1 and 12, "
+                                      "value is " + std::to_string( maximumOrder_ ) );
+        }
+
+        // Allocate history and work arrays once.
+        for( unsigned int i = 0; i < modifiedDividedDifferences_.size( ); i++ )
+        {
+            modifiedDividedDifferences_[ i ] = StateType::Zero( initialState.rows( ), initialState.cols( ) );
+        }
+        predictedState_ = StateType::Zero( initialState.rows( ), initialState.cols( ) );
+        currentStateDerivative_ = StateType::Zero( initialState.rows( ), initialState.cols( ) );
+        errorWeights_ = StateType::Zero( initialState.rows( ), initialState.cols( ) );
+
+        independentVariableDifferences_.fill( 0.0 );
+        alphaCoefficients_.fill( 0.0 );
+        betaCoefficients_.fill( 1.0 );
+        coefficientWorkArrayV_.fill( 0.0 );
+        coefficientWorkArrayW_.fill( 0.0 );
+        integrationCoefficients_.fill( 0.0 );
+        integrationCoefficients_[ 1 ] = 1.0;
+        integrationCoefficients_[ 2 ] = 0.5;
+        errorCoefficients_.fill( 0.0 );
+        errorCoefficients_[ 1 ] = 1.0;
+    }
+
+    //! Destructor.
+    ~ShampineGordonIntegrator( ){ }
+
+    //! Get step size of the next step.
+    /*!
+     * Returns the step size of the next step, as recommended by the step size control at the end of the last step.
+     * \return Step size to be used for the next step.
+     */
+    TimeStepType getNextStepSize( ) const { return stepSize_; }
+
+    //! Get current state.
+    /*!
+     * Returns the current state of the integrator.
+     * \return Current integrated state.
+     */
+    StateType getCurrentState( ) const { return currentState_; }
+
+    //! Returns the current independent variable.
+    /*!
+     * Returns the current value of the independent variable of the integrator.
+     * \return Current independent variable.
+     */
+    IndependentVariableType getCurrentIndependentVariable( ) const { return currentIndependentVariable_; }
+
+    //! Returns the previous independent variable.
+    IndependentVariableType getPreviousIndependentVariable( ) { return lastIndependentVariable_; }
+
+    //! Returns the previous state.
+    StateType getPreviousState( ) { return lastState_; }
+
+    //! Returns the order that was used in the last step.
+    int getOrderOfLastStep( ) const { return previousOrder_; }
+
+    //! Returns the order that will be used in the next step.
+    int getCurrentOrder( ) const { return currentOrder_; }
+
+    //! Returns the total number of state derivative evaluations.
+    unsigned int getNumberOfStateDerivativeEvaluations( ) const { return numberOfStateDerivativeEvaluations_; }
+
+    //! Perform a single integration step.
+    /*!
+     * Perform a single integration step. If the error estimate of the step exceeds the tolerances, the step size (and possibly
+     * the order) is reduced and the step is redone, until it succeeds. The step size that was actually used can be obtained
+     * from the difference between the current and previous independent variable.
+     * \param stepSize The step size to attempt.
+     * \return The state at the end of the step.
+     */
+    StateType performIntegrationStep( const TimeStepType stepSize );
+
+    //! Compute the state at a given value of the independent variable inside the last step.
+    /*!
+     * Compute the state at a given value of the independent variable from the interpolating polynomial of the last step
+     * (Shampine and Gordon, 1975), which has the same order as the integration itself. No state derivative evaluations are
+     * required. The independent variable should be between the previous and the current independent variable; values
+     * outside this interval are extrapolated.
+     * \param independentVariable Independent variable at which the state is to be computed.
+     * \return Interpolated state.
+     */
+    StateType getDenseOutputState( const IndependentVariableType independentVariable );
+
+    //! Rollback internal state to the last state.
+    /*!
+     * Performs rollback of the current state and independent variable to those before the last step. The integration history
+     * is discarded, so the integrator restarts at first order upon the next step. Can only be called once after each step.
+     * \return True if the rollback was successful.
+     */
+    bool rollbackToPreviousState( )
+    {
+        if( currentIndependentVariable_ == lastIndependentVariable_ )
+        {
+            return false;
+        }
+
+        currentIndependentVariable_ = lastIndependentVariable_;
+        currentState_ = lastState_;
+        isStartingStep_ = true;
+        return true;
+    }
+
+    //! Replace the state with a new value.
+    /*!
+     * Replace the state with a new value. The integration history is discarded, so the integrator restarts at first order
+     * upon the next step.
+     * \param newState The value of the new state.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
+    {
+        currentState_ = newState;
+        if( !allowRollback )
+        {
+            lastIndependentVariable_ = currentIndependentVariable_;
+        }
+        isStartingStep_ = true;
+    }
+
+    //! Modify the state and time for the current step.
+    /*!
+     * Modify the state and time for the current step. The integration history is discarded, so the integrator restarts at
+     * first order upon the next step.
+     * \param newState The new state to set the current state to.
+     * \param newTime The time to set the current time to.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentIntegrationVariables( const StateType& newState, const IndependentVariableType newTime,
+                                            const bool allowRollback = false )
+    {
+        currentIndependentVariable_ = newTime;
+        modifyCurrentState( newState, allowRollback );
+    }
+
+private:
+
+    //! Function to initialize the integration history at the current state (first order start).
+    /*!
+     * Function to initialize the integration history at the current state, and reduce the step size if it is too large for
+     * the first (first order) step.
+     * \param stepSize Requested step size, modified if needed.
+     */
+    void initializeIntegration( TimeStepType& stepSize );
+
+    //! Function to compute the integration coefficients for the current step size and order.
+    void computeIntegrationCoefficients( );
+
+    //! Function to compute the weighted norm of a state.
+    StateScalarType computeWeightedNorm( const StateType& state )
+    {
+        return std::sqrt( ( state.array( ) / errorWeights_.array( ) ).square( ).sum( ) );
+    }
+
+    //! Current independent variable.
+    IndependentVariableType currentIndependentVariable_;
+
+    //! Current state.
+    StateType currentState_;
+
+    //! Independent variable before the last step.
+    IndependentVariableType lastIndependentVariable_;
+
+    //! State before the last step.
+    StateType lastState_;
+
+    //! Minimum step size (absolute value).
+    TimeStepType minimumStepSize_;
+
+    //! Maximum step size (absolute value).
+    TimeStepType maximumStepSize_;
+
+    //! Step size to be used for the next step.
+    TimeStepType stepSize_;
+
+    //! Relative error tolerance.
+    StateScalarType relativeErrorTolerance_;
+
+    //! Absolute error tolerance.
+    StateScalarType absoluteErrorTolerance_;
+
+    //! Maximum order of the integrator.
+    int maximumOrder_;
+
+    //! Boolean denoting whether the next step is the first one after (re)initialization.
+    bool isStartingStep_;
+
+    //! Boolean denoting whether the integrator is in its start phase (raising order and doubling step size at each step).
+    bool isInStartPhase_ = true;
+
+    //! Order to be used in the next step.
+    int currentOrder_ = 1;
+
+    //! Order used in the last step.
+    int previousOrder_ = 0;
+
+    //! Step size used in the last successful step.
+    TimeStepType previousStepSize_ = 0.0;
+
+    //! Number of steps taken with the current step size (capped at order + 1).
+    int numberOfStepsWithConstantStepSize_ = 0;
+
+    //! Total number of state derivative evaluations.
+    unsigned int numberOfStateDerivativeEvaluations_ = 0;
+
+    //! Modified divided differences of the state derivative (elements 1 to 14 are used).
+    std::array< StateType, 15 > modifiedDividedDifferences_;
+
+    //! Predicted state at the end of the current step.
+    StateType predictedState_;
+
+    //! State derivative at the current state.
+    StateType currentStateDerivative_;
+
+    //! Weights (relative and absolute tolerances combined) used in the error norm for the current step.
+    StateType errorWeights_;
+
+    //! Differences of the independent variable at the current and previous grid points (psi, elements 1 to 12 are used).
+    std::array< TimeStepType, 14 > independentVariableDifferences_;
+
+    //! Coefficients alpha of the modified divided differences (elements 1 to 12 are used).
+    std::array< TimeStepType, 14 > alphaCoefficients_;
+
+    //! Coefficients beta of the modified divided differences (elements 1 to 12 are used).
+    std::array< TimeStepType, 14 > betaCoefficients_;
+
+    //! Coefficients sigma used for the error estimates (elements 1 to 13 are used).
+    std::array< TimeStepType, 14 > errorCoefficients_;
+
+    //! Integration coefficients g (elements 1 to 13 are used).
+    std::array< TimeStepType, 14 > integrationCoefficients_;
+
+    //! Work arrays v and w used to compute the integration coefficients (elements 1 to 12 are used).
+    std::array< TimeStepType, 14 > coefficientWorkArrayV_;
+    std::array< TimeStepType, 14 > coefficientWorkArrayW_;
+
+};
+
+//! Perform a single integration step.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType ShampineGordonIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+performIntegrationStep( const TimeStepType stepSize )
+{
+    // Error coefficients for constant step size at each order (Shampine and Gordon, 1975).
+    static const TimeStepType constantStepErrorCoefficients[ 14 ] =
+    { 0.0, 0.5, 0.0833, 0.0417, 0.0264, 0.0188, 0.0143, 0.0114, 0.00936, 0.00789, 0.00679, 0.00592, 0.00524, 0.00468 };
+    const TimeStepType roundOffLimit = 4.0 * std::numeric_limits< double >::epsilon( );
+
+    if( !( stepSize == stepSize ) )
+    {
+        throw std::runtime_error( "Error in Shampine-Gordon integrator, step size is NaN" );
+    }
+
+    // Arrays below are indexed from one, following the formulation of Shampine and Gordon (1975).
+    std::array< StateType, 15 >& phi = modifiedDividedDifferences_;
+    std::array< TimeStepType, 14 >& psi = independentVariableDifferences_;
+    std::array< TimeStepType, 14 >& g = integrationCoefficients_;
+
+    TimeStepType currentStepSize = stepSize;
+
+    // Restart the integration history if the direction of integration is reversed.
+    if( !isStartingStep_ && ( currentStepSize * previousStepSize_ < 0.0 ) )
+    {
+        isStartingStep_ = true;
+    }
+
+    errorWeights_ = ( relativeErrorTolerance_ * currentState_.array( ).abs( ) + absoluteErrorTolerance_ ).matrix( );
+    if( isStartingStep_ )
+    {
+        initializeIntegration( currentStepSize );
+    }
+
+    // The error tolerances are scaled into the weights, so the (half) tolerance of the error norm is fixed.
+    const TimeStepType halfTolerance = 0.5;
+    int numberOfFailedSteps = 0;
+    int newOrder = currentOrder_;
+    TimeStepType errorAtOrder = 0.0, errorAtOrderMinusOne = 0.0, errorAtOrderMinusTwo = 0.0;
+    TimeStepType absoluteStepSize = 0.0;
+
+    bool stepIsSuccessful = false;
+    while( !stepIsSuccessful )
+    {
+        stepSize_ = currentStepSize;
+        const int k = currentOrder_;
+
+        // Compute coefficients of the formulas for this step.
+        if( stepSize_ != previousStepSize_ )
+        {
+            numberOfStepsWithConstantStepSize_ = 0;
+        }
+        if( numberOfStepsWithConstantStepSize_ <= previousOrder_ )
+        {
+            numberOfStepsWithConstantStepSize_++;
+        }
+        if( k >= numberOfStepsWithConstantStepSize_ )
+        {
+            computeIntegrationCoefficients( );
+        }
+        const int ns = numberOfStepsWithConstantStepSize_;
+
+        // Change phi to phi star.
+        for( int i = ns + 1; i <= k; i++ )
+        {
+            phi[ i ] *= static_cast< StateScalarType >( betaCoefficients_[ i ] );
+        }
+
+        // Predict solution and differences.
+        phi[ k + 2 ] = phi[ k + 1 ];
+        phi[ k + 1 ].setZero( );
+        predictedState_.setZero( );
+        for( int i = k; i >= 1; i-- )
+        {
+            predictedState_ += static_cast< StateScalarType >( g[ i ] ) * phi[ i ];
+            phi[ i ] += phi[ i + 1 ];
+        }
+        predictedState_ = currentState_ + static_cast< StateScalarType >( stepSize_ ) * predictedState_;
+
+        // Evaluate state derivative at predicted state.
+        lastIndependentVariable_ = currentIndependentVariable_;
+        currentIndependentVariable_ = lastIndependentVariable_ + stepSize_;
+        absoluteStepSize = std::fabs( stepSize_ );
+        currentStateDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_, predictedState_ );
+        numberOfStateDerivativeEvaluations_++;
+
+        // Estimate errors at orders k, k-1 and k-2, as if constant step size were used.
+        errorAtOrderMinusTwo = 0.0;
+        errorAtOrderMinusOne = 0.0;
+        if( k > 2 )
+        {
+            errorAtOrderMinusTwo = absoluteStepSize * errorCoefficients_[ k - 1 ] * constantStepErrorCoefficients[ k - 2 ] *
+                    static_cast< TimeStepType >( computeWeightedNorm( phi[ k - 1 ] + currentStateDerivative_ - phi[ 1 ] ) );
+        }
+        if( k > 1 )
+        {
+            errorAtOrderMinusOne = absoluteStepSize * errorCoefficients_[ k ] * constantStepErrorCoefficients[ k - 1 ] *
+                    static_cast< TimeStepType >( computeWeightedNorm( phi[ k ] + currentStateDerivative_ - phi[ 1 ] ) );
+        }
+        TimeStepType scaledCorrectionNorm =
+                absoluteStepSize * static_cast< TimeStepType >( computeWeightedNorm( currentStateDerivative_ - phi[ 1 ] ) );
+        TimeStepType localError = scaledCorrectionNorm * ( g[ k ] - g[ k + 1 ] );
+        errorAtOrder = scaledCorrectionNorm * errorCoefficients_[ k + 1 ] * constantStepErrorCoefficients[ k ];
+
+        // Test if order should be lowered.
+        newOrder = k;
+        if( k > 2 )
+        {
+            if( std::max( errorAtOrderMinusOne, errorAtOrderMinusTwo ) <= errorAtOrder )
+            {
+                newOrder = k - 1;
+            }
+        }
+        else if( k == 2 )
+        {
+            if( errorAtOrderMinusOne <= 0.5 * errorAtOrder )
+            {
+                newOrder = k - 1;
+            }
+        }
+
+        if( localError <= 2.0 * halfTolerance )
+        {
+            stepIsSuccessful = true;
+        }
+        else
+        {
+            // Restore independent variable, phi and psi.
+            isInStartPhase_ = false;
+            currentIndependentVariable_ = lastIndependentVariable_;
+            for( int i = 1; i <= k; i++ )
+            {
+                phi[ i ] = static_cast< StateScalarType >( 1.0 / betaCoefficients_[ i ] ) * ( phi[ i ] - phi[ i + 1 ] );
+            }
+            for( int i = 2; i <= k; i++ )
+            {
+                psi[ i - 1 ] = psi[ i ] - stepSize_;
+            }
+
+            // On third failure, set order to one. Thereafter, use optimal step size.
+            numberOfFailedSteps++;
+            TimeStepType stepSizeFactor = 0.5;
+            if( numberOfFailedSteps > 3 && halfTolerance < 0.25 * errorAtOrder )
+            {
+                stepSizeFactor = std::sqrt( halfTolerance / errorAtOrder );
+            }
+            if( numberOfFailedSteps >= 3 )
+            {
+                newOrder = 1;
+            }
+            currentStepSize = stepSizeFactor * stepSize_;
+            currentOrder_ = newOrder;
+
+            if( std::fabs( currentStepSize ) < minimumStepSize_ ||
+                    std::fabs( currentStepSize ) < roundOffLimit * std::fabs(
+                        static_cast< TimeStepType >( currentIndependentVariable_ ) ) )
+            {
+                throw std::runtime_error( "Error in Shampine-Gordon integrator, minimum step size " +
+                                          std::to_string( static_cast< double >( minimumStepSize_ ) ) +
+                                          " is higher than required time step " +
+                                          std::to_string( static_cast< double >( currentStepSize ) ) );
+            }
+        }
+    }
+
+    const int k = currentOrder_;
+    previousOrder_ = k;
+    previousStepSize_ = stepSize_;
+
+    // Correct and evaluate.
+    lastState_ = currentState_;
+    currentState_ = predictedState_ + static_cast< StateScalarType >( stepSize_ * g[ k + 1 ] ) *
+            ( currentStateDerivative_ - phi[ 1 ] );
+    currentStateDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+    numberOfStateDerivativeEvaluations_++;
+
+    // Update differences for next step.
+    phi[ k + 1 ] = currentStateDerivative_ - phi[ 1 ];
+    phi[ k + 2 ] = phi[ k + 1 ] - phi[ k + 2 ];
+    for( int i = 1; i <= k; i++ )
+    {
+        phi[ i ] += phi[ k + 1 ];
+    }
+
+    // Estimate error at order k+1, unless in start phase (order is always raised), order has already been lowered, or step
+    // size has not been constant for enough steps for the estimate to be reliable. Then select order for next step.
+    if( newOrder == k - 1 || k == maximumOrder_ )
+    {
+        isInStartPhase_ = false;
+    }
+
+    bool raiseOrder = false, lowerOrder = false;
+    TimeStepType errorAtOrderPlusOne = 0.0;
+    if( isInStartPhase_ )
+    {
+        raiseOrder = true;
+    }
+    else if( newOrder == k - 1 )
+    {
+        lowerOrder = true;
+    }
+    else if( k + 1 <= numberOfStepsWithConstantStepSize_ )
+    {
+        errorAtOrderPlusOne = absoluteStepSize * constantStepErrorCoefficients[ k + 1 ] *
+                static_cast< TimeStepType >( computeWeightedNorm( phi[ k + 2 ] ) );
+        if( k > 1 )
+        {
+            if( errorAtOrderMinusOne <= std::min( errorAtOrder, errorAtOrderPlusOne ) )
+            {
+                lowerOrder = true;
+            }
+            else if( errorAtOrderPlusOne < errorAtOrder && k < maximumOrder_ )
+            {
+                raiseOrder = true;
+            }
+        }
+        else if( errorAtOrderPlusOne < 0.5 * errorAtOrder && k < maximumOrder_ )
+        {
+            raiseOrder = true;
+        }
+    }
+
+    if( raiseOrder )
+    {
+        currentOrder_ = k + 1;
+        errorAtOrder = errorAtOrderPlusOne;
+    }
+    else if( lowerOrder )
+    {
+        currentOrder_ = k - 1;
+        errorAtOrder = errorAtOrderMinusOne;
+    }
+
+    // With new order, determine appropriate step size for next step.
+    TimeStepType newStepSize = 2.0 * stepSize_;
+    if( !isInStartPhase_ && halfTolerance < errorAtOrder * std::pow( 2.0, currentOrder_ + 1 ) )
+    {
+        newStepSize = stepSize_;
+        if( halfTolerance < errorAtOrder )
+        {
+            TimeStepType stepSizeFactor = std::pow( halfTolerance / errorAtOrder, 1.0 / static_cast< TimeStepType >( currentOrder_ + 1 ) );
+            newStepSize = absoluteStepSize * std::max( 0.5, std::min( 0.9, static_cast< double >( stepSizeFactor ) ) );
+            newStepSize = std::max( newStepSize, roundOffLimit * std::fabs( static_cast< TimeStepType >( currentIndependentVariable_ ) ) );
+            newStepSize = ( stepSize_ < 0.0 ) ? -newStepSize : newStepSize;
+        }
+    }
+
+    // Limit step size to allowed range.
+    if( std::fabs( newStepSize ) > maximumStepSize_ )
+    {
+        newStepSize = ( stepSize_ < 0.0 ) ? -maximumStepSize_ : maximumStepSize_;
+    }
+    else if( std::fabs( newStepSize ) < minimumStepSize_ )
+    {
+        newStepSize = ( stepSize_ < 0.0 ) ? -minimumStepSize_ : minimumStepSize_;
+    }
+    stepSize_ = newStepSize;
+
+    return currentState_;
+}
+
+//! Compute the state at a given value of the independent variable inside the last step.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType ShampineGordonIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+getDenseOutputState( const IndependentVariableType independentVariable )
+{
+    if( previousOrder_ == 0 )
+    {
+        throw std::runtime_error( "Error in Shampine-Gordon integrator, dense output requested before first step." );
+    }
+
+    const TimeStepType stepFromCurrent = static_cast< TimeStepType >( independentVariable - currentIndependentVariable_ );
+    const int numberOfTerms = previousOrder_ + 1;
+
+    // Compute interpolation coefficients g.
+    std::array< TimeStepType, 14 > interpolationCoefficients;
+    std::array< TimeStepType, 14 > workArray;
+    for( int i = 1; i <= numberOfTerms; i++ )
+    {
+        workArray[ i ] = 1.0 / static_cast< TimeStepType >( i );
+    }
+    interpolationCoefficients[ 1 ] = 1.0;
+    TimeStepType term = 0.0;
+    for( int j = 2; j <= numberOfTerms; j++ )
+    {
+        TimeStepType psiOfPreviousTerm = independentVariableDifferences_[ j - 1 ];
+        TimeStepType gamma = ( stepFromCurrent + term ) / psiOfPreviousTerm;
+        TimeStepType eta = stepFromCurrent / psiOfPreviousTerm;
+        for( int i = 1; i <= numberOfTerms + 1 - j; i++ )
+        {
+            workArray[ i ] = gamma * workArray[ i ] - eta * workArray[ i + 1 ];
+        }
+        interpolationCoefficients[ j ] = workArray[ 1 ];
+        term = psiOfPreviousTerm;
+    }
+
+    // Interpolate.
+    StateType interpolatedState = StateType::Zero( currentState_.rows( ), currentState_.cols( ) );
+    for( int i = numberOfTerms; i >= 1; i-- )
+    {
+        interpolatedState += static_cast< StateScalarType >( interpolationCoefficients[ i ] ) * modifiedDividedDifferences_[ i ];
+    }
+    return currentState_ + static_cast< StateScalarType >( stepFromCurrent ) * interpolatedState;
+}
+
+//! Function to initialize the integration history at the current state (first order start).
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void ShampineGordonIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+initializeIntegration( TimeStepType& stepSize )
+{
+    currentStateDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+    numberOfStateDerivativeEvaluations_++;
+
+    modifiedDividedDifferences_[ 1 ] = currentStateDerivative_;
+    modifiedDividedDifferences_[ 2 ].setZero( );
+
+    // Reduce initial step size if it is too large for a first order step.
+    TimeStepType derivativeNorm = static_cast< TimeStepType >( computeWeightedNorm( currentStateDerivative_ ) );
+    TimeStepType absoluteStepSize = std::fabs( stepSize );
+    if( 1.0 < 16.0 * derivativeNorm * stepSize * stepSize )
+    {
+        absoluteStepSize = 0.25 * std::sqrt( 1.0 / derivativeNorm );
+    }
+    absoluteStepSize = std::max( absoluteStepSize, 4.0 * std::numeric_limits< double >::epsilon( ) *
+                                 std::fabs( static_cast< TimeStepType >( currentIndependentVariable_ ) ) );
+    stepSize = ( stepSize < 0.0 ) ? -absoluteStepSize : absoluteStepSize;
+
+    previousStepSize_ = 0.0;
+    currentOrder_ = 1;
+    previousOrder_ = 0;
+    numberOfStepsWithConstantStepSize_ = 0;
+    isInStartPhase_ = true;
+    isStartingStep_ = false;
+}
+
+//! Function to compute the integration coefficients for the current step size and order.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void ShampineGordonIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >::
+computeIntegrationCoefficients( )
+{
+    std::array< TimeStepType, 14 >& psi = independentVariableDifferences_;
+    std::array< TimeStepType, 14 >& v = coefficientWorkArrayV_;
+    std::array< TimeStepType, 14 >& w = coefficientWorkArrayW_;
+
+    const int k = currentOrder_;
+    const int ns = numberOfStepsWithConstantStepSize_;
+
+    // Compute those components of alpha, beta, psi and sigma which are changed.
+    betaCoefficients_[ ns ] = 1.0;
+    alphaCoefficients_[ ns ] = 1.0 / static_cast< TimeStepType >( ns );
+    TimeStepType nextPsi = stepSize_ * static_cast< TimeStepType >( ns );
+    errorCoefficients_[ ns + 1 ] = 1.0;
+    for( int i = ns + 1; i <= k; i++ )
+    {
+        TimeStepType previousPsi = psi[ i - 1 ];
+        psi[ i - 1 ] = nextPsi;
+        betaCoefficients_[ i ] = betaCoefficients_[ i - 1 ] * psi[ i - 1 ] / previousPsi;
+        nextPsi = previousPsi + stepSize_;
+        alphaCoefficients_[ i ] = stepSize_ / nextPsi;
+        errorCoefficients_[ i + 1 ] = static_cast< TimeStepType >( i ) * alphaCoefficients_[ i ] * errorCoefficients_[ i ];
+    }
+    psi[ k ] = nextPsi;
+
+    // Initialize v and set w, or update them if step size was constant for more than one step.
+    if( ns <= 1 )
+    {
+        for( int iq = 1; iq <= k; iq++ )
+        {
+            v[ iq ] = 1.0 / static_cast< TimeStepType >( iq * ( iq + 1 ) );
+            w[ iq ] = v[ iq ];
+        }
+    }
+    else
+    {
+        // If order was raised, update diagonal part of v.
+        if( k > previousOrder_ )
+        {
+            v[ k ] = 1.0 / static_cast< TimeStepType >( k * ( k + 1 ) );
+            for( int j = 1; j <= ns - 2; j++ )
+            {
+                int i = k - j;
+                v[ i ] -= alphaCoefficients_[ j + 1 ] * v[ i + 1 ];
+            }
+        }
+
+        // Update v and set w.
+        for( int iq = 1; iq <= k + 1 - ns; iq++ )
+        {
+            v[ iq ] -= alphaCoefficients_[ ns ] * v[ iq + 1 ];
+            w[ iq ] = v[ iq ];
+        }
+        integrationCoefficients_[ ns + 1 ] = w[ 1 ];
+    }
+
+    // Compute the integration coefficients g in the work array w.
+    for( int i = ns + 2; i <= k + 1; i++ )
+    {
+        for( int iq = 1; iq <= k + 2 - i; iq++ )
+        {
+            w[ iq ] -= alphaCoefficients_[ i - 1 ] * w[ iq + 1 ];
+        }
+        integrationCoefficients_[ i ] = w[ 1 ];
+    }
+}
+
+extern template class ShampineGordonIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+extern template class ShampineGordonIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+extern template class ShampineGordonIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+//! Typedef of Shampine-Gordon integrator (state/state derivative = VectorXd, independent variable = double).
+typedef ShampineGordonIntegrator< > ShampineGordonIntegratorXd;
+
+} // namespace numerical_integrators
+
+} // namespace tudat
+
+#endif // TUDAT_SHAMPINE_GORDON_INTEGRATOR_H
@@ -23,5 +23,6 @@
 #include "interpolators/multiLinearInterpolator.h"
 #include "interpolators/oneDimensionalInterpolator.h"
 #include "interpolators/piecewiseConstantInterpolator.h"
+#include "interpolators/quinticHermiteStateInterpolator.h"
 
 #endif//TUDAT_INTERPOLATORS_H
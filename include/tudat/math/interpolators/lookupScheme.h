@@ -12,9 +12,11 @@
 #ifndef TUDAT_LOOK_UP_SCHEME_H
 #define TUDAT_LOOK_UP_SCHEME_H
 
+#include <cmath>
 #include <vector>
 #include <iostream>
 #include <memory>
+#include <string>
 
 #include "tudat/math/basic/nearestNeighbourSearch.h"
 
@@ -31,7 +33,8 @@ enum AvailableLookupScheme
 {
     undefinedScheme,
     huntingAlgorithm,
-    binarySearch
+    binarySearch,
+    equidistantGridLookup
 };
 
 //! Look-up scheme class for nearest left neighbour search.
@@ -230,6 +233,142 @@ public:
 
 };
 
+//! Look-up scheme class for nearest left neighbour search in equidistant data.
+/*!
+ * Look-up scheme class for nearest left neighbour search in equidistant data. The nearest left neighbour is computed
+ * directly from the (constant) step size of the data, so that the lookup is done in constant time, independently of the
+ * location of the previous request. To be robust against rounding errors, the computed index is corrected by comparing the
+ * value to the independent variable values at that index.
+ * \tparam IndependentVariableType Type of entries of vector in which lookup is to be performed.
+ */
+template< typename IndependentVariableType >
+class EquidistantGridLookupScheme: public LookUpScheme< IndependentVariableType >
+{
+public:
+
+    using LookUpScheme< IndependentVariableType >::independentVariableValues_;
+
+    //! Constructor, used to set data vector.
+    /*!
+     * Constructor, used to set data vector. An exception is thrown if the data is not equidistant (to within the given
+     * relative tolerance).
+     * \param independentVariableValues vector of independent variable values in which to perform
+     * lookup procedure.
+     * \param relativeTolerance Tolerance, relative to the step size, with which data must be equidistant
+     */
+    EquidistantGridLookupScheme(
+            const std::vector< IndependentVariableType >& independentVariableValues,
+            const double relativeTolerance = 1.0E-6 )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues )
+    {
+        if( independentVariableValues_.size( ) < 2 )
+        {
+            throw std::runtime_error( "Error when creating equidistant lookup scheme, at least two values are required" );
+        }
+
+        numberOfValues_ = static_cast< int >( independentVariableValues_.size( ) );
+        stepSize_ = static_cast< long double >( independentVariableValues_.back( ) - independentVariableValues_.front( ) ) /
+                static_cast< long double >( numberOfValues_ - 1 );
+
+        if( !isEquidistant( independentVariableValues_, relativeTolerance ) )
+        {
+            throw std::runtime_error( "Error when creating equidistant lookup scheme, data is not equidistant" );
+        }
+    }
+
+    //! Default destructor
+    /*!
+     *  Default destructor
+     */
+    ~EquidistantGridLookupScheme( ){ }
+
+    //! Find nearest left neighbour.
+    /*!
+     * Function finds nearest left neighbour of given value in independentVariableValues_.
+     * \param valueToLookup Value of which nearest neaighbour is to be determined.
+     * \return Index of entry in independentVariableValues_ vector which is nearest lower neighbour
+     * to valueToLookup.
+     */
+    int findNearestLowerNeighbour( const IndependentVariableType valueToLookup )
+    {
+        if( !( valueToLookup < independentVariableValues_.back( ) ) )
+        {
+            return numberOfValues_ - 1;
+        }
+        else if( valueToLookup < independentVariableValues_.front( ) )
+        {
+            return 0;
+        }
+
+        int nearestLowerIndex = static_cast< int >(
+                    std::floor( static_cast< long double >( valueToLookup - independentVariableValues_.front( ) ) / stepSize_ ) );
+
+        // Correct for rounding errors
+        if( nearestLowerIndex > numberOfValues_ - 2 )
+        {
+            nearestLowerIndex = numberOfValues_ - 2;
+        }
+        else if( nearestLowerIndex < 0 )
+        {
+            nearestLowerIndex = 0;
+        }
+
+        if( valueToLookup < independentVariableValues_[ nearestLowerIndex ] )
+        {
+            nearestLowerIndex--;
+        }
+        else if( !( valueToLookup < independentVariableValues_[ nearestLowerIndex + 1 ] ) )
+        {
+            nearestLowerIndex++;
+        }
+
+        return nearestLowerIndex;
+    }
+
+    //! Function to check whether a vector of independent variable values is equidistant
+    /*!
+     * Function to check whether a vector of independent variable values is equidistant
+     * \param independentVariableValues Vector of independent variable values, in ascending order
+     * \param relativeTolerance Tolerance, relative to the step size, with which data must be equidistant
+     * \return True if independentVariableValues is equidistant.
+     */
+    static bool isEquidistant( const std::vector< IndependentVariableType >& independentVariableValues,
+                               const double relativeTolerance = 1.0E-6 )
+    {
+        if( independentVariableValues.size( ) < 2 )
+        {
+            return false;
+        }
+
+        long double stepSize =
+                static_cast< long double >( independentVariableValues.back( ) - independentVariableValues.front( ) ) /
+                static_cast< long double >( independentVariableValues.size( ) - 1 );
+        if( !( stepSize > 0.0L ) )
+        {
+            return false;
+        }
+
+        for( unsigned int i = 1; i < independentVariableValues.size( ); i++ )
+        {
+            long double currentStepSize =
+                    static_cast< long double >( independentVariableValues[ i ] - independentVariableValues[ i - 1 ] );
+            if( std::fabs( currentStepSize - stepSize ) > relativeTolerance * stepSize )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+
+    //! Number of independent variable values.
+    int numberOfValues_;
+
+    //! Step size between independent variable values.
+    long double stepSize_;
+};
+
 //! Typedef for shared-pointer to LookUpScheme object with double-type entries.
 typedef std::shared_ptr< LookUpScheme< double > > LookUpSchemeDoublePointer;
 
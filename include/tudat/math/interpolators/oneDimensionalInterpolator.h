@@ -39,7 +39,8 @@ enum InterpolatorTypes
     lagrange_interpolator = 3,
     hermite_spline_interpolator = 4,
     piecewise_constant_interpolator = 5,
-    discrete_jump_linear_interpolator = 6
+    discrete_jump_linear_interpolator = 6,
+    quintic_hermite_state_interpolator = 7
 
 };
 
@@ -364,6 +365,14 @@ protected:
                       ( independentValues_ ) );
             break;
         }
+        case equidistantGridLookup:
+        {
+            // Create lookup scheme that directly computes the interval from the constant step size.
+            lookUpScheme_ = std::shared_ptr< LookUpScheme< IndependentVariableType > >
+                    ( new EquidistantGridLookupScheme< IndependentVariableType >
+                      ( independentValues_ ) );
+            break;
+        }
         default:
             throw std::runtime_error( "Warning: lookup scheme not found when making scheme for 1-D interpolator" );
         }
@@ -0,0 +1,345 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_QUINTIC_HERMITE_STATE_INTERPOLATOR_H
+#define TUDAT_QUINTIC_HERMITE_STATE_INTERPOLATOR_H
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/interpolators/oneDimensionalInterpolator.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Quintic Hermite interpolator for Cartesian states.
+/*!
+ *  Interpolator for Cartesian states (position and velocity), which uses the position, velocity and acceleration at the two
+ *  nodes surrounding the requested time to construct a quintic Hermite polynomial for the position. The interpolated velocity
+ *  is the time derivative of this polynomial, so that the interpolated position and velocity are fully consistent. Since
+ *  only the two surrounding nodes are used, each interpolation requires a single lookup and a fixed number of operations.
+ *  For equidistant nodes, the lookup is done directly from the step size (see EquidistantGridLookupScheme).
+ *  The positions, velocities and accelerations are stored contiguously per node. The accelerations may be provided directly
+ *  (e.g. from the state derivative model used to generate the states) or, if not available, are computed at each node from
+ *  the tabulated velocities, by differentiating a Lagrange polynomial through the surrounding nodes.
+ *  \tparam IndependentVariableType Type of independent variable (time)
+ *  \tparam StateScalarType Scalar type of the Cartesian state
+ *  \tparam ScalarType Scalar type used for computations with independent variable differences
+ */
+template< typename IndependentVariableType, typename StateScalarType = double,
+          typename ScalarType = typename scalar_type< IndependentVariableType >::value_type >
+class QuinticHermiteStateInterpolator :
+        public OneDimensionalInterpolator< IndependentVariableType, Eigen::Matrix< StateScalarType, 6, 1 > >
+{
+public:
+
+    //! Typedef for Cartesian state
+    typedef Eigen::Matrix< StateScalarType, 6, 1 > StateType;
+
+    //! Typedef for Cartesian acceleration
+    typedef Eigen::Matrix< StateScalarType, 3, 1 > AccelerationType;
+
+    using OneDimensionalInterpolator< IndependentVariableType, StateType >::dependentValues_;
+    using OneDimensionalInterpolator< IndependentVariableType, StateType >::independentValues_;
+    using OneDimensionalInterpolator< IndependentVariableType, StateType >::lookUpScheme_;
+    using Interpolator< IndependentVariableType, StateType >::interpolate;
+
+    //! Constructor, with accelerations at the nodes provided directly.
+    /*!
+     *  Constructor, with accelerations at the nodes provided directly.
+     *  \param stateMap Map with the independent variable values as keys and corresponding Cartesian states as values.
+     *  \param accelerationMap Map with the independent variable values as keys and corresponding Cartesian accelerations as
+     *      values. Keys must be identical to those of stateMap.
+     *  \param selectedLookupScheme Look-up scheme that is to be used when finding interval of requested independent variable
+     *      value. If undefinedScheme, the equidistantGridLookup is used for equidistant nodes, and the huntingAlgorithm
+     *      otherwise.
+     *  \param boundaryHandling Boundary handling method, in case the independent variable is outside the
+     *      specified range.
+     *  \param defaultExtrapolationValue Pair of default values to be used for extrapolation, in case
+     *      of use_default_value or use_default_value_with_warning as methods for boundaryHandling.
+     */
+    QuinticHermiteStateInterpolator(
+            const std::map< IndependentVariableType, StateType >& stateMap,
+            const std::map< IndependentVariableType, AccelerationType >& accelerationMap,
+            const AvailableLookupScheme selectedLookupScheme = undefinedScheme,
+            const BoundaryInterpolationType boundaryHandling = extrapolate_at_boundary,
+            const std::pair< StateType, StateType >& defaultExtrapolationValue =
+            std::make_pair( IdentityElement::getAdditionIdentity< StateType >( ),
+                            IdentityElement::getAdditionIdentity< StateType >( ) ) ):
+        OneDimensionalInterpolator< IndependentVariableType, StateType >( boundaryHandling, defaultExtrapolationValue )
+    {
+        if( stateMap.size( ) != accelerationMap.size( ) )
+        {
+            throw std::runtime_error( "Error when creating quintic Hermite state interpolator, state and acceleration data "
+                                      "have different size" );
+        }
+
+        setStateData( stateMap );
+
+        int currentIndex = 0;
+        for( const auto& accelerationIterator : accelerationMap )
+        {
+            if( !( accelerationIterator.first == independentValues_.at( currentIndex ) ) )
+            {
+                throw std::runtime_error( "Error when creating quintic Hermite state interpolator, state and acceleration data "
+                                          "are given at different times" );
+            }
+            nodeData_.block( 6, currentIndex, 3, 1 ) = accelerationIterator.second;
+            currentIndex++;
+        }
+
+        makeSelectedLookupScheme( selectedLookupScheme );
+    }
+
+    //! Constructor, with accelerations at the nodes computed from the tabulated velocities.
+    /*!
+     *  Constructor, with accelerations at the nodes computed from the tabulated velocities, by differentiating the Lagrange
+     *  polynomial through the velocities at the nearest numberOfAccelerationStencilPoints nodes.
+     *  \param stateMap Map with the independent variable values as keys and corresponding Cartesian states as values.
+     *  \param numberOfAccelerationStencilPoints Number of nodes used to compute the acceleration at each node.
+     *  \param selectedLookupScheme Look-up scheme that is to be used when finding interval of requested independent variable
+     *      value. If undefinedScheme, the equidistantGridLookup is used for equidistant nodes, and the huntingAlgorithm
+     *      otherwise.
+     *  \param boundaryHandling Boundary handling method, in case the independent variable is outside the
+     *      specified range.
+     *  \param defaultExtrapolationValue Pair of default values to be used for extrapolation, in case
+     *      of use_default_value or use_default_value_with_warning as methods for boundaryHandling.
+     */
+    QuinticHermiteStateInterpolator(
+            const std::map< IndependentVariableType, StateType >& stateMap,
+            const int numberOfAccelerationStencilPoints = 8,
+            const AvailableLookupScheme selectedLookupScheme = undefinedScheme,
+            const BoundaryInterpolationType boundaryHandling = extrapolate_at_boundary,
+            const std::pair< StateType, StateType >& defaultExtrapolationValue =
+            std::make_pair( IdentityElement::getAdditionIdentity< StateType >( ),
+                            IdentityElement::getAdditionIdentity< StateType >( ) ) ):
+        OneDimensionalInterpolator< IndependentVariableType, StateType >( boundaryHandling, defaultExtrapolationValue )
+    {
+        if( numberOfAccelerationStencilPoints < 2 )
+        {
+            throw std::runtime_error( "Error when creating quintic Hermite state interpolator, at least two points are "
+                                      "required to compute accelerations" );
+        }
+
+        setStateData( stateMap );
+        computeAccelerationsFromVelocities( numberOfAccelerationStencilPoints );
+        makeSelectedLookupScheme( selectedLookupScheme );
+    }
+
+    //! Destructor
+    ~QuinticHermiteStateInterpolator( ){ }
+
+    // Using statement to prevent compiler warning.
+    using OneDimensionalInterpolator< IndependentVariableType, StateType >::interpolate;
+
+    //! Function interpolates Cartesian state at given independent variable value.
+    /*!
+     *  Function interpolates Cartesian state at given independent variable value.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation
+     *      is to take place.
+     *  \return Interpolated Cartesian state.
+     */
+    StateType interpolate( const IndependentVariableType targetIndependentVariableValue )
+    {
+        // Check whether boundary handling needs to be applied, if independent variable is beyond its defined range.
+        StateType targetValue;
+        bool useValue = false;
+        this->checkBoundaryCase( targetValue, useValue, targetIndependentVariableValue );
+        if( useValue )
+        {
+            return targetValue;
+        }
+
+        // Determine the lower entry in the table corresponding to the target independent variable value.
+        int lowerEntry = lookUpScheme_->findNearestLowerNeighbour( targetIndependentVariableValue );
+        if( lowerEntry >= numberOfNodes_ - 1 )
+        {
+            lowerEntry = numberOfNodes_ - 2;
+        }
+
+        // Compute normalized time in interval
+        ScalarType stepSize = static_cast< ScalarType >(
+                    independentValues_[ lowerEntry + 1 ] - independentValues_[ lowerEntry ] );
+        StateScalarType step = static_cast< StateScalarType >( stepSize );
+        StateScalarType s = static_cast< StateScalarType >(
+                    static_cast< ScalarType >( targetIndependentVariableValue - independentValues_[ lowerEntry ] ) / stepSize );
+        StateScalarType s2 = s * s;
+        StateScalarType s3 = s2 * s;
+        StateScalarType s4 = s3 * s;
+        StateScalarType s5 = s4 * s;
+
+        // Compute Hermite basis functions (for lower position, velocity, acceleration and upper position, velocity,
+        // acceleration, respectively), and their derivatives w.r.t. s.
+        StateScalarType h0 = 1.0 - 10.0 * s3 + 15.0 * s4 - 6.0 * s5;
+        StateScalarType h1 = s - 6.0 * s3 + 8.0 * s4 - 3.0 * s5;
+        StateScalarType h2 = 0.5 * s2 - 1.5 * s3 + 1.5 * s4 - 0.5 * s5;
+        StateScalarType h3 = 10.0 * s3 - 15.0 * s4 + 6.0 * s5;
+        StateScalarType h4 = -4.0 * s3 + 7.0 * s4 - 3.0 * s5;
+        StateScalarType h5 = 0.5 * s3 - s4 + 0.5 * s5;
+
+        StateScalarType dh0 = -30.0 * s2 + 60.0 * s3 - 30.0 * s4;
+        StateScalarType dh1 = 1.0 - 18.0 * s2 + 32.0 * s3 - 15.0 * s4;
+        StateScalarType dh2 = s - 4.5 * s2 + 6.0 * s3 - 2.5 * s4;
+        StateScalarType dh4 = -12.0 * s2 + 28.0 * s3 - 15.0 * s4;
+        StateScalarType dh5 = 1.5 * s2 - 4.0 * s3 + 2.5 * s4;
+
+        const auto lowerData = nodeData_.col( lowerEntry );
+        const auto upperData = nodeData_.col( lowerEntry + 1 );
+
+        targetValue.segment( 0, 3 ) =
+                h0 * lowerData.segment( 0, 3 ) + h3 * upperData.segment( 0, 3 ) +
+                step * ( h1 * lowerData.segment( 3, 3 ) + h4 * upperData.segment( 3, 3 ) ) +
+                step * step * ( h2 * lowerData.segment( 6, 3 ) + h5 * upperData.segment( 6, 3 ) );
+        targetValue.segment( 3, 3 ) =
+                dh0 / step * ( lowerData.segment( 0, 3 ) - upperData.segment( 0, 3 ) ) +
+                dh1 * lowerData.segment( 3, 3 ) + dh4 * upperData.segment( 3, 3 ) +
+                step * ( dh2 * lowerData.segment( 6, 3 ) + dh5 * upperData.segment( 6, 3 ) );
+
+        return targetValue;
+    }
+
+    InterpolatorTypes getInterpolatorType( ){ return quintic_hermite_state_interpolator; }
+
+    //! Function to retrieve the accelerations at the nodes
+    /*!
+     *  Function to retrieve the accelerations at the nodes (either provided to, or computed by, the constructor).
+     *  \return Accelerations at the nodes
+     */
+    std::vector< AccelerationType > getAccelerationValues( )
+    {
+        std::vector< AccelerationType > accelerationValues;
+        for( int i = 0; i < numberOfNodes_; i++ )
+        {
+            accelerationValues.push_back( nodeData_.block( 6, i, 3, 1 ) );
+        }
+        return accelerationValues;
+    }
+
+protected:
+
+    //! Function to set the independent values, states, and contiguous node data from the input state map
+    void setStateData( const std::map< IndependentVariableType, StateType >& stateMap )
+    {
+        if( stateMap.size( ) < 2 )
+        {
+            throw std::runtime_error( "Error when creating quintic Hermite state interpolator, at least two nodes are required" );
+        }
+
+        numberOfNodes_ = static_cast< int >( stateMap.size( ) );
+        nodeData_.setZero( 9, numberOfNodes_ );
+        independentValues_.reserve( numberOfNodes_ );
+        dependentValues_.reserve( numberOfNodes_ );
+
+        int currentIndex = 0;
+        for( const auto& stateIterator : stateMap )
+        {
+            independentValues_.push_back( stateIterator.first );
+            dependentValues_.push_back( stateIterator.second );
+            nodeData_.block( 0, currentIndex, 6, 1 ) = stateIterator.second;
+            currentIndex++;
+        }
+    }
+
+    //! Function to compute accelerations at the nodes from the tabulated velocities
+    /*!
+     *  Function to compute accelerations at the nodes from the tabulated velocities, by differentiating the Lagrange
+     *  polynomial through the velocities at the nearest nodes.
+     *  \param numberOfStencilPoints Number of nodes used to compute the acceleration at each node.
+     */
+    void computeAccelerationsFromVelocities( const int numberOfStencilPoints )
+    {
+        int stencilSize = std::min( numberOfStencilPoints, numberOfNodes_ );
+        std::vector< ScalarType > timeDifferences( stencilSize );
+
+        for( int i = 0; i < numberOfNodes_; i++ )
+        {
+            // Select stencil centred on current node (shifted at the edges of the data)
+            int stencilStart = std::min( std::max( i - stencilSize / 2, 0 ), numberOfNodes_ - stencilSize );
+            int currentNodeInStencil = i - stencilStart;
+            for( int j = 0; j < stencilSize; j++ )
+            {
+                timeDifferences[ j ] = static_cast< ScalarType >(
+                            independentValues_[ i ] - independentValues_[ stencilStart + j ] );
+            }
+
+            // Add contribution of each node to derivative of Lagrange polynomial at current node
+            AccelerationType currentAcceleration = AccelerationType::Zero( );
+            ScalarType currentNodeWeight = 0.0;
+            for( int j = 0; j < stencilSize; j++ )
+            {
+                if( j == currentNodeInStencil )
+                {
+                    continue;
+                }
+
+                currentNodeWeight += 1.0 / timeDifferences[ j ];
+
+                // Weight is the derivative of Lagrange basis polynomial j at current node
+                ScalarType weight = 1.0;
+                for( int k = 0; k < stencilSize; k++ )
+                {
+                    if( k != j )
+                    {
+                        if( k != currentNodeInStencil )
+                        {
+                            weight *= timeDifferences[ k ];
+                        }
+                        weight /= ( timeDifferences[ k ] - timeDifferences[ j ] );
+                    }
+                }
+                currentAcceleration += static_cast< StateScalarType >( weight ) *
+                        nodeData_.block( 3, stencilStart + j, 3, 1 );
+            }
+            currentAcceleration += static_cast< StateScalarType >( currentNodeWeight ) * nodeData_.block( 3, i, 3, 1 );
+            nodeData_.block( 6, i, 3, 1 ) = currentAcceleration;
+        }
+    }
+
+    //! Function to create the lookup scheme, selecting the equidistant lookup automatically if requested
+    void makeSelectedLookupScheme( const AvailableLookupScheme selectedLookupScheme )
+    {
+        if( selectedLookupScheme == undefinedScheme )
+        {
+            if( EquidistantGridLookupScheme< IndependentVariableType >::isEquidistant( independentValues_ ) )
+            {
+                this->makeLookupScheme( equidistantGridLookup );
+            }
+            else
+            {
+                this->makeLookupScheme( huntingAlgorithm );
+            }
+        }
+        else
+        {
+            this->makeLookupScheme( selectedLookupScheme );
+        }
+    }
+
+private:
+
+    //! Number of nodes
+    int numberOfNodes_;
+
+    //! Position (rows 0-2), velocity (rows 3-5) and acceleration (rows 6-8) at each node (column)
+    Eigen::Matrix< StateScalarType, 9, Eigen::Dynamic > nodeData_;
+
+};
+
+} // namespace interpolators
+
+} // namespace tudat
+
+#endif // TUDAT_QUINTIC_HERMITE_STATE_INTERPOLATOR_H
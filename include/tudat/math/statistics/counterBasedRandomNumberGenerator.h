@@ -0,0 +1,211 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Salmon, J.K. et al., Parallel random numbers: as easy as 1, 2, 3, Proceedings of the International Conference for
+ *          High Performance Computing, Networking, Storage and Analysis (SC11), 2011.
+ *      Kasdin, N.J., Discrete simulation of colored noise and stochastic processes and 1/f^alpha power law noise
+ *          generation, Proceedings of the IEEE, 83(5), 1995.
+ */
+
+#ifndef TUDAT_COUNTER_BASED_RANDOM_NUMBER_GENERATOR_H
+#define TUDAT_COUNTER_BASED_RANDOM_NUMBER_GENERATOR_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+//! Function to compute the Philox4x32-10 block function (Salmon et al., 2011).
+/*!
+ *  Function to compute the Philox4x32-10 block function (Salmon et al., 2011), which maps a 128-bit counter and 64-bit key
+ *  to 128 pseudo-random bits. Contrary to a stateful generator, the output for a given counter is independent of any
+ *  previous calls, so that random numbers can be generated in any order (or in parallel) with identical results.
+ *  \param counter Counter that is to be mapped to random bits.
+ *  \param key Key (i.e. seed) of the generator.
+ *  \return Pseudo-random output block.
+ */
+std::array< std::uint32_t, 4 > computePhilox4x32Block(
+        const std::array< std::uint32_t, 4 >& counter, const std::array< std::uint32_t, 2 >& key );
+
+//! Function to combine a key of a counter-based random number generator with an integer, to create a new key.
+/*!
+ *  Function to combine a key of a counter-based random number generator with an integer, to create a new key, using the
+ *  splitmix64 finalizer. Used to derive a key for a specific noise source (e.g. observable and link ends) from a seed.
+ *  \param key Original key.
+ *  \param value Value with which key is to be combined.
+ *  \return Combined key.
+ */
+std::uint64_t combineRandomNumberGeneratorKey( const std::uint64_t key, const std::uint64_t value );
+
+//! Function to combine a key of a counter-based random number generator with a string, to create a new key.
+/*!
+ *  Function to combine a key of a counter-based random number generator with a string, to create a new key. The result
+ *  is platform-independent (contrary to std::hash).
+ *  \param key Original key.
+ *  \param value String with which key is to be combined.
+ *  \return Combined key.
+ */
+std::uint64_t combineRandomNumberGeneratorKey( const std::uint64_t key, const std::string& value );
+
+//! Counter-based generator of Gaussian random numbers.
+/*!
+ *  Counter-based generator of Gaussian random numbers, using the Philox4x32-10 block function and a Box-Muller transform.
+ *  Each random number is a function of only the key and its counter (and stream index), so that results do not depend
+ *  on the order in which numbers are generated. Each counter value provides two independent random numbers per stream
+ *  index, such that independent vectors can be generated at each counter value (e.g. at each observation time).
+ */
+class CounterBasedGaussianRandomNumberGenerator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param key Key (i.e. seed) of the generator.
+     *  \param standardDeviation Standard deviation of the generated random numbers.
+     *  \param mean Mean of the generated random numbers.
+     */
+    CounterBasedGaussianRandomNumberGenerator(
+            const std::uint64_t key,
+            const double standardDeviation = 1.0,
+            const double mean = 0.0 ):
+        key_( { static_cast< std::uint32_t >( key ), static_cast< std::uint32_t >( key >> 32 ) } ),
+        standardDeviation_( standardDeviation ), mean_( mean ){ }
+
+    //! Function to generate the pair of random numbers associated with a counter value and stream index.
+    /*!
+     *  Function to generate the pair of random numbers associated with a counter value and stream index.
+     *  \param counter Counter value.
+     *  \param streamIndex Index of the stream, used to generate more than two random numbers for a single counter value.
+     *  \return Pair of independent Gaussian random numbers.
+     */
+    std::pair< double, double > getRandomNumberPair( const std::uint64_t counter, const std::uint32_t streamIndex = 0 ) const;
+
+    //! Function to generate a vector of random numbers associated with a counter value.
+    /*!
+     *  Function to generate a vector of random numbers associated with a counter value. Entries 2i and 2i+1 are generated
+     *  from stream index i.
+     *  \param counter Counter value.
+     *  \param randomNumbers Vector in which the random numbers are set (size of vector is retained).
+     */
+    void getRandomVector( const std::uint64_t counter, Eigen::Ref< Eigen::VectorXd > randomNumbers ) const;
+
+    //! Function to generate a sequence of random numbers, for consecutive counter values.
+    /*!
+     *  Function to generate a sequence of random numbers, for consecutive counter values: entries 2i and 2i+1 are
+     *  generated from counter value firstCounter + i. The result is identical to generating the numbers one by one, so that
+     *  a long sequence may be generated in parallel batches.
+     *  \param firstCounter Counter value of the first two random numbers.
+     *  \param randomNumbers Vector in which the random numbers are set (size of vector is retained).
+     *  \param streamIndex Index of the stream from which the random numbers are generated.
+     */
+    void getRandomSequence( const std::uint64_t firstCounter, Eigen::Ref< Eigen::VectorXd > randomNumbers,
+                            const std::uint32_t streamIndex = 0 ) const;
+
+    //! Function to retrieve the counter value associated with a given time (which is its binary representation).
+    static std::uint64_t getCounterFromTime( const double time );
+
+private:
+
+    //! Key of the generator.
+    std::array< std::uint32_t, 2 > key_;
+
+    //! Standard deviation of the generated random numbers.
+    double standardDeviation_;
+
+    //! Mean of the generated random numbers.
+    double mean_;
+};
+
+//! Function to create a counter-based Gaussian noise function, which only depends on the time at which it is evaluated.
+/*!
+ *  Function to create a counter-based Gaussian noise function, which only depends on the time at which it is evaluated
+ *  (and the key). Evaluating the function at the same time returns the same noise, regardless of the order of evaluation,
+ *  or the number of previous evaluations. The entries of the output are mutually independent.
+ *  \param standardDeviation Standard deviation of the noise.
+ *  \param key Key (i.e. seed) of the noise
+ *  \param outputSize Size of the output vector.
+ *  \param mean Mean of the noise.
+ *  \return Noise function
+ */
+std::function< Eigen::VectorXd( const double ) > getCounterBasedGaussianNoiseFunction(
+        const double standardDeviation,
+        const std::uint64_t key,
+        const int outputSize = 1,
+        const double mean = 0.0 );
+
+//! Function to generate a first-order Gauss-Markov noise sequence at equally spaced times.
+/*!
+ *  Function to generate a first-order Gauss-Markov (exponentially correlated) noise sequence at equally spaced times,
+ *  using the exact discretization x_{k+1} = phi x_k + sqrt( 1 - phi^2 ) sigma w_k, with phi = exp( -dt / tau ). The first
+ *  entry is drawn from the stationary distribution. The white noise w_k is generated by a counter-based generator, with
+ *  counter k.
+ *  \param key Key (i.e. seed) of the noise
+ *  \param numberOfSamples Number of samples that is to be generated.
+ *  \param timeStep Time between samples.
+ *  \param correlationTime Correlation time tau of process.
+ *  \param standardDeviation Standard deviation sigma of (stationary) process.
+ *  \return Noise sequence.
+ */
+Eigen::VectorXd generateFirstOrderGaussMarkovNoise(
+        const std::uint64_t key,
+        const int numberOfSamples,
+        const double timeStep,
+        const double correlationTime,
+        const double standardDeviation );
+
+//! Function to generate power-law noise at equally spaced times, with spectral density proportional to f^( -alpha ).
+/*!
+ *  Function to generate power-law noise at equally spaced times, with (two-sided) spectral density proportional to
+ *  f^( -alpha ), using the method of Kasdin (1995): white noise is filtered with the impulse response
+ *  h_0 = 1, h_k = h_{k-1} ( alpha / 2 + k - 1 ) / k of the fractional integrator, where the convolution is computed with
+ *  fast Fourier transforms. For alpha = 0, the white noise itself is returned, for alpha = 2 a random walk. Typical clock
+ *  noise types are white phase (alpha = 0), flicker phase (alpha = 1), white frequency (alpha = 2), flicker
+ *  frequency (alpha = 3) and random walk frequency (alpha = 4) noise, when generating phase (time) deviations.
+ *  \param key Key (i.e. seed) of the noise
+ *  \param numberOfSamples Number of samples that is to be generated.
+ *  \param alpha Exponent of power law.
+ *  \param whiteNoiseStandardDeviation Standard deviation of the white noise that is filtered.
+ *  \return Noise sequence.
+ */
+Eigen::VectorXd generatePowerLawNoise(
+        const std::uint64_t key,
+        const int numberOfSamples,
+        const double alpha,
+        const double whiteNoiseStandardDeviation );
+
+//! Function to create a noise function that interpolates a noise sequence given at equally spaced times.
+/*!
+ *  Function to create a noise function that linearly interpolates a noise sequence given at equally spaced times. An
+ *  exception is thrown if the function is evaluated outside the interval covered by the sequence.
+ *  \param noiseSequence Noise sequence (entry i at time startTime + i * timeStep); each column is a separate entry of the
+ *  output of the noise function.
+ *  \param startTime Time of first sample.
+ *  \param timeStep Time between samples.
+ *  \return Noise function
+ */
+std::function< Eigen::VectorXd( const double ) > getTabulatedNoiseFunction(
+        const Eigen::MatrixXd& noiseSequence,
+        const double startTime,
+        const double timeStep );
+
+} // namespace statistics
+
+} // namespace tudat
+
+#endif // TUDAT_COUNTER_BASED_RANDOM_NUMBER_GENERATOR_H
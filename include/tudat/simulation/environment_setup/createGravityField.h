@@ -25,6 +25,7 @@
 #include "tudat/astro/gravitation/gravityFieldVariations.h"
 #include "tudat/astro/gravitation/polyhedronGravityField.h"
 #include "tudat/astro/gravitation/ringGravityField.h"
+#include "tudat/astro/gravitation/masconGravityField.h"
 
 namespace tudat
 {
@@ -44,7 +45,8 @@ enum GravityFieldType
     central_spice,
     spherical_harmonic,
     polyhedron,
-    one_dimensional_ring
+    one_dimensional_ring,
+    mascon
 };
 
 // Class for providing settings for gravity field model.
@@ -511,6 +513,111 @@ protected:
 
 };
 
+// Derived class of GravityFieldSettings defining settings of a gravity field represented by a set of point masses
+// (mascons), with fixed positions in the body-fixed frame.
+class MasconGravityFieldSettings: public GravityFieldSettings
+{
+public:
+
+    /*! Constructor.
+     *
+     * Constructor.
+     * @param gravitationalParameter Gravitational parameter of the body.
+     * @param masconPositions Body-fixed positions of the mascons (one row per mascon, 3 columns).
+     * @param associatedReferenceFrame Identifier for body-fixed reference frame to which the mascons are referred.
+     * @param masconMassFractions Fraction of the gravitational parameter represented by each mascon (equal if empty).
+     * @param openingAngle Opening angle below which distant groups of mascons are replaced by their multipole terms
+     *      (0 for direct summation over all mascons).
+     * @param maximumMasconsPerLeaf Maximum number of mascons in a leaf node of the octree.
+     */
+    MasconGravityFieldSettings( const double gravitationalParameter,
+                                const Eigen::MatrixXd& masconPositions,
+                                const std::string& associatedReferenceFrame,
+                                const Eigen::VectorXd& masconMassFractions = Eigen::VectorXd::Zero( 0 ),
+                                const double openingAngle = 0.0,
+                                const int maximumMasconsPerLeaf = 32 ):
+        GravityFieldSettings( mascon ),
+        gravitationalParameter_( gravitationalParameter ),
+        masconPositions_( masconPositions ),
+        associatedReferenceFrame_( associatedReferenceFrame ),
+        masconMassFractions_( masconMassFractions ),
+        openingAngle_( openingAngle ),
+        maximumMasconsPerLeaf_( maximumMasconsPerLeaf )
+    { }
+
+    //! Destructor
+    virtual ~MasconGravityFieldSettings( ){ }
+
+    // Function to return the gravitational parameter.
+    double getGravitationalParameter( )
+    { return gravitationalParameter_; }
+
+    // Function to reset the gravitational parameter.
+    void resetGravitationalParameter( const double gravitationalParameter )
+    { gravitationalParameter_ = gravitationalParameter; }
+
+    // Function to return the mascon positions.
+    const Eigen::MatrixXd& getMasconPositions( )
+    { return masconPositions_; }
+
+    // Function to reset the mascon positions.
+    void resetMasconPositions( const Eigen::MatrixXd& masconPositions )
+    { masconPositions_ = masconPositions; }
+
+    // Function to return the mascon mass fractions.
+    const Eigen::VectorXd& getMasconMassFractions( )
+    { return masconMassFractions_; }
+
+    // Function to reset the mascon mass fractions.
+    void resetMasconMassFractions( const Eigen::VectorXd& masconMassFractions )
+    { masconMassFractions_ = masconMassFractions; }
+
+    // Function to return the opening angle used for aggregating groups of mascons.
+    double getOpeningAngle( )
+    { return openingAngle_; }
+
+    // Function to reset the opening angle used for aggregating groups of mascons.
+    void resetOpeningAngle( const double openingAngle )
+    { openingAngle_ = openingAngle; }
+
+    // Function to return the maximum number of mascons in a leaf node of the octree.
+    int getMaximumMasconsPerLeaf( )
+    { return maximumMasconsPerLeaf_; }
+
+    // Function to reset the maximum number of mascons in a leaf node of the octree.
+    void resetMaximumMasconsPerLeaf( const int maximumMasconsPerLeaf )
+    { maximumMasconsPerLeaf_ = maximumMasconsPerLeaf; }
+
+    // Function to return identifier for body-fixed reference frame.
+    std::string getAssociatedReferenceFrame( )
+    { return associatedReferenceFrame_; }
+
+    // Function to reset identifier for body-fixed reference frame to which the mascons are referred.
+    void resetAssociatedReferenceFrame( const std::string& associatedReferenceFrame )
+    { associatedReferenceFrame_ = associatedReferenceFrame; }
+
+protected:
+
+    // Gravitational parameter
+    double gravitationalParameter_;
+
+    // Body-fixed positions of the mascons
+    Eigen::MatrixXd masconPositions_;
+
+    // Identifier for body-fixed reference frame to which the mascons are referred
+    std::string associatedReferenceFrame_;
+
+    // Fraction of the gravitational parameter represented by each mascon
+    Eigen::VectorXd masconMassFractions_;
+
+    // Opening angle used for aggregating groups of mascons
+    double openingAngle_;
+
+    // Maximum number of mascons in a leaf node of the octree
+    int maximumMasconsPerLeaf_;
+
+};
+
 // Spherical harmonics models supported by Tudat.
 //! @get_docstring(SphericalHarmonicsModel.__docstring__)
 enum SphericalHarmonicsModel
@@ -834,6 +941,32 @@ inline std::shared_ptr< GravityFieldSettings > ringGravitySettings(
             gravitationalParameter, ringRadius, associatedReferenceFrame, ellipticIntegralSFromDAndB);
 }
 
+inline std::shared_ptr< GravityFieldSettings > masconGravitySettings(
+        const double gravitationalParameter,
+        const Eigen::MatrixXd& masconPositions,
+        const std::string& associatedReferenceFrame,
+        const Eigen::VectorXd& masconMassFractions = Eigen::VectorXd::Zero( 0 ),
+        const double openingAngle = 0.0 )
+{
+    return std::make_shared< MasconGravityFieldSettings >(
+            gravitationalParameter, masconPositions, associatedReferenceFrame, masconMassFractions, openingAngle );
+}
+
+inline std::shared_ptr< GravityFieldSettings > masconGravitySettingsFromPolyhedron(
+        const double gravitationalParameter,
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const int numberOfCellsAlongLargestDimension,
+        const std::string& associatedReferenceFrame,
+        const double openingAngle = 0.0 )
+{
+    return std::make_shared< MasconGravityFieldSettings >(
+            gravitationalParameter,
+            gravitation::createMasconPositionsFromPolyhedron(
+                verticesCoordinates, verticesDefiningEachFacet, numberOfCellsAlongLargestDimension ),
+            associatedReferenceFrame, Eigen::VectorXd::Zero( 0 ), openingAngle );
+}
+
 enum RigidBodyPropertiesType
 {
     constant_rigid_body_properties,
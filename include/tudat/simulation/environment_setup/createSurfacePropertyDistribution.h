@@ -29,7 +29,8 @@ enum class SurfacePropertyDistributionType
     constant,
     spherical_harmonics,
     second_degree_zonal_periodic,
-    custom_surface_distribution
+    custom_surface_distribution,
+    gridded
 };
 
 /*!
@@ -257,6 +258,54 @@ private:
     std::function< double( const double, const double, const double ) > customFunction_;
 
 };
+/*!
+ * Settings for a surface property distribution that is sampled once on a regular latitude/longitude grid from another
+ * (time-invariant) distribution, and interpolated bilinearly afterwards.
+ *
+ * @see GriddedSurfacePropertyDistribution
+ */
+class GriddedSurfacePropertyDistributionSettings : public SurfacePropertyDistributionSettings
+{
+public:
+    /*!
+     * Constructor.
+     *
+     * @param originalDistributionSettings Settings of the time-invariant distribution from which the grid is sampled
+     * @param numberOfLatitudes Number of grid points in latitude direction (including both poles)
+     * @param numberOfLongitudes Number of grid points in longitude direction
+     */
+    explicit GriddedSurfacePropertyDistributionSettings(
+            const std::shared_ptr<SurfacePropertyDistributionSettings>& originalDistributionSettings,
+            const unsigned int numberOfLatitudes,
+            const unsigned int numberOfLongitudes) :
+            SurfacePropertyDistributionSettings(SurfacePropertyDistributionType::gridded),
+            originalDistributionSettings_(originalDistributionSettings),
+            numberOfLatitudes_(numberOfLatitudes),
+            numberOfLongitudes_(numberOfLongitudes) {}
+
+    const std::shared_ptr<SurfacePropertyDistributionSettings>& getOriginalDistributionSettings() const
+    {
+        return originalDistributionSettings_;
+    }
+
+    unsigned int getNumberOfLatitudes() const
+    {
+        return numberOfLatitudes_;
+    }
+
+    unsigned int getNumberOfLongitudes() const
+    {
+        return numberOfLongitudes_;
+    }
+
+private:
+    std::shared_ptr<SurfacePropertyDistributionSettings> originalDistributionSettings_;
+
+    unsigned int numberOfLatitudes_;
+
+    unsigned int numberOfLongitudes_;
+};
+
 /*!
  * Create settings for constant surface property distribution.
  *
@@ -333,6 +382,24 @@ customSurfacePropertyDistributionSettings(
     return std::make_shared< CustomSurfacePropertyDistributionSettings >(customFunction);
 }
 
+/*!
+ * Create settings for gridded surface property distribution, sampled from another time-invariant distribution.
+ *
+ * @param originalDistributionSettings Settings of the time-invariant distribution from which the grid is sampled
+ * @param numberOfLatitudes Number of grid points in latitude direction (including both poles)
+ * @param numberOfLongitudes Number of grid points in longitude direction
+ * @return Shared pointer to settings for a gridded surface property distribution.
+ */
+inline std::shared_ptr<SurfacePropertyDistributionSettings>
+griddedSurfacePropertyDistributionSettings(
+        const std::shared_ptr<SurfacePropertyDistributionSettings>& originalDistributionSettings,
+        const unsigned int numberOfLatitudes = 181,
+        const unsigned int numberOfLongitudes = 360)
+{
+    return std::make_shared< GriddedSurfacePropertyDistributionSettings >(
+            originalDistributionSettings, numberOfLatitudes, numberOfLongitudes);
+}
+
 /*!
  * Create surface property distribution from its settings.
  *
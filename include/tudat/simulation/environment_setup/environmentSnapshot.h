@@ -0,0 +1,228 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_ENVIRONMENTSNAPSHOT_H
+#define TUDAT_ENVIRONMENTSNAPSHOT_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "tudat/math/interpolators/createInterpolator.h"
+#include "tudat/simulation/environment_setup/body.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Data defining a one-dimensional interpolator (with double time and state entries), as stored in an environment snapshot.
+struct InterpolatorSnapshot
+{
+    InterpolatorSnapshot( ):
+        interpolatorType( interpolators::linear_interpolator ),
+        lookupScheme( interpolators::huntingAlgorithm ),
+        boundaryHandling( interpolators::extrapolate_at_boundary ),
+        numberOfStages( 0 ),
+        lagrangeBoundaryHandling( interpolators::lagrange_cubic_spline_boundary_interpolation ),
+        dependentVariableSize( 0 ){ }
+
+    //! Type of interpolator
+    interpolators::InterpolatorTypes interpolatorType;
+
+    //! Lookup scheme used by interpolator
+    interpolators::AvailableLookupScheme lookupScheme;
+
+    //! Boundary handling method used by interpolator
+    interpolators::BoundaryInterpolationType boundaryHandling;
+
+    //! Number of stages of Lagrange interpolator (unused for other interpolator types)
+    int numberOfStages;
+
+    //! Boundary handling method used by Lagrange interpolator (unused for other interpolator types)
+    interpolators::LagrangeInterpolatorBoundaryHandling lagrangeBoundaryHandling;
+
+    //! Size of the dependent variable
+    int dependentVariableSize;
+
+    //! Independent variables of interpolator
+    std::vector< double > independentValues;
+
+    //! Dependent variables of interpolator, concatenated (entry i starts at index i * dependentVariableSize)
+    std::vector< double > dependentValues;
+
+    //! Derivatives of dependent variables (Hermite spline interpolator only), concatenated as dependentValues.
+    std::vector< double > dependentValueDerivatives;
+
+    //! Default extrapolation values at lower and upper boundary, concatenated.
+    std::vector< double > defaultExtrapolationValues;
+};
+
+//! Data defining a tabulated Cartesian ephemeris, as stored in an environment snapshot.
+struct TabulatedEphemerisSnapshot
+{
+    //! Origin of frame in which ephemeris is defined
+    std::string frameOrigin;
+
+    //! Orientation of frame in which ephemeris is defined
+    std::string frameOrientation;
+
+    //! Interpolator of the Cartesian state
+    InterpolatorSnapshot stateInterpolator;
+};
+
+//! Data defining a spherical harmonic gravity field, as stored in an environment snapshot.
+struct SphericalHarmonicsGravityFieldSnapshot
+{
+    SphericalHarmonicsGravityFieldSnapshot( ):
+        gravitationalParameter( TUDAT_NAN ), referenceRadius( TUDAT_NAN ){ }
+
+    //! Gravitational parameter of the body
+    double gravitationalParameter;
+
+    //! Reference radius of the spherical harmonic expansion
+    double referenceRadius;
+
+    //! Identifier of body-fixed frame to which the field is fixed
+    std::string fixedReferenceFrame;
+
+    //! Cosine spherical harmonic coefficients (geodesy normalized)
+    Eigen::MatrixXd cosineCoefficients;
+
+    //! Sine spherical harmonic coefficients (geodesy normalized)
+    Eigen::MatrixXd sineCoefficients;
+};
+
+//! Data defining a tabulated rotation model, as stored in an environment snapshot.
+struct TabulatedRotationSnapshot
+{
+    //! Identifier of base frame of rotation model
+    std::string baseFrameOrientation;
+
+    //! Identifier of target frame of rotation model
+    std::string targetFrameOrientation;
+
+    //! Interpolator of the rotational state (quaternion entries and body-fixed angular velocity)
+    InterpolatorSnapshot rotationalStateInterpolator;
+};
+
+//! Class storing the data-heavy environment models of a set of bodies, which can be written to and read from a binary file.
+/*!
+ *  Class storing the data-heavy environment models of a set of bodies, which can be written to and read from a binary file.
+ *  The snapshot is used to avoid re-creating (e.g. re-reading and re-processing) these models in each run: a snapshot is
+ *  created from a fully set up SystemOfBodies and written to file once, after which it can be read in a later run and
+ *  attached to bodies that were created without these models (or with placeholders for them). The following models are
+ *  stored:
+ *  - Tabulated ephemerides (TabulatedCartesianEphemeris< double, double >)
+ *  - Spherical harmonic gravity fields (the coefficients, gravitational parameter, reference radius and frame)
+ *  - Tabulated rotation models (TabulatedRotationalEphemeris< double, double >)
+ *  Models of other types are not stored. The interpolators of the tabulated models must be linear, cubic spline,
+ *  Lagrange, Hermite spline or piecewise constant interpolators.
+ *  The binary file starts with an identifier and a format version: a file with a different format version is rejected.
+ */
+class EnvironmentSnapshot
+{
+public:
+
+    //! Constructor for empty snapshot
+    EnvironmentSnapshot( ){ }
+
+    //! Constructor, retrieves the data-heavy environment models from a set of bodies.
+    /*!
+     *  Constructor, retrieves the data-heavy environment models from a set of bodies.
+     *  \param bodies Bodies from which the environment models are to be retrieved.
+     */
+    EnvironmentSnapshot( const SystemOfBodies& bodies );
+
+    //! Function to write the snapshot to a binary file, which can be read with readFromBinaryFile.
+    /*!
+     *  Function to write the snapshot to a binary file, which can be read with readFromBinaryFile.
+     *  \param filePath Path of the file that is to be written.
+     */
+    void writeToBinaryFile( const std::string& filePath ) const;
+
+    //! Function to read the snapshot from a binary file, as written by writeToBinaryFile.
+    /*!
+     *  Function to read the snapshot from a binary file, as written by writeToBinaryFile. An exception is thrown if the file
+     *  cannot be read, was written with a different format version, or is truncated or otherwise corrupted, in which case
+     *  the contents of this snapshot are not modified.
+     *  \param filePath Path of the file that is to be read.
+     */
+    void readFromBinaryFile( const std::string& filePath );
+
+    //! Function to attach the environment models in the snapshot to a set of bodies.
+    /*!
+     *  Function to attach the environment models in the snapshot to a set of bodies. All bodies in the snapshot must exist
+     *  in the system of bodies. For ephemerides and rotation models, the interpolator of an existing tabulated model is
+     *  reset, any other existing model is replaced by a tabulated model. For gravity fields, the coefficients of an
+     *  existing spherical harmonic gravity field (of equal degree, order and reference radius) are reset, so that links to it
+     *  (e.g. from gravity field variations) are retained. If the body has no gravity field, a new one is created; an exception is
+     *  thrown if the body has a gravity field of another type or size.
+     *  \param bodies Bodies to which the environment models are to be attached.
+     */
+    void attachToBodies( const SystemOfBodies& bodies ) const;
+
+    //! Function to retrieve the tabulated ephemerides in the snapshot, with body name as key.
+    const std::map< std::string, TabulatedEphemerisSnapshot >& getEphemerides( ) const
+    {
+        return ephemerides_;
+    }
+
+    //! Function to retrieve the spherical harmonic gravity fields in the snapshot, with body name as key.
+    const std::map< std::string, SphericalHarmonicsGravityFieldSnapshot >& getGravityFields( ) const
+    {
+        return gravityFields_;
+    }
+
+    //! Function to retrieve the tabulated rotation models in the snapshot, with body name as key.
+    const std::map< std::string, TabulatedRotationSnapshot >& getRotationModels( ) const
+    {
+        return rotationModels_;
+    }
+
+private:
+
+    //! Tabulated ephemerides in the snapshot, with body name as key.
+    std::map< std::string, TabulatedEphemerisSnapshot > ephemerides_;
+
+    //! Spherical harmonic gravity fields in the snapshot, with body name as key.
+    std::map< std::string, SphericalHarmonicsGravityFieldSnapshot > gravityFields_;
+
+    //! Tabulated rotation models in the snapshot, with body name as key.
+    std::map< std::string, TabulatedRotationSnapshot > rotationModels_;
+};
+
+//! Function to write the data-heavy environment models of a set of bodies to a binary snapshot file.
+/*!
+ *  Function to write the data-heavy environment models of a set of bodies to a binary snapshot file (see
+ *  EnvironmentSnapshot).
+ *  \param bodies Bodies from which the environment models are to be retrieved.
+ *  \param filePath Path of the file that is to be written.
+ */
+void writeEnvironmentSnapshot( const SystemOfBodies& bodies, const std::string& filePath );
+
+//! Function to read a binary snapshot file, and attach its environment models to a set of bodies.
+/*!
+ *  Function to read a binary snapshot file, and attach its environment models to a set of bodies (see
+ *  EnvironmentSnapshot::attachToBodies).
+ *  \param bodies Bodies to which the environment models are to be attached.
+ *  \param filePath Path of the file that is to be read.
+ */
+void attachEnvironmentSnapshot( const SystemOfBodies& bodies, const std::string& filePath );
+
+} // namespace simulation_setup
+
+} // namespace tudat
+
+#endif // TUDAT_ENVIRONMENTSNAPSHOT_H
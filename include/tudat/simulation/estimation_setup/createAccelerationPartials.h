@@ -23,6 +23,7 @@
 #include "tudat/astro/orbit_determination/acceleration_partials/relativisticAccelerationPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/sphericalHarmonicAccelerationPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/polyhedronAccelerationPartial.h"
+#include "tudat/astro/orbit_determination/acceleration_partials/masconAccelerationPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/aerodynamicAccelerationPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/mutualSphericalHarmonicGravityPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/empiricalAccelerationPartial.h"
@@ -30,6 +31,7 @@
 #include "tudat/astro/orbit_determination/acceleration_partials/panelledRadiationPressureAccelerationPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/thrustAccelerationPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/yarkovskyAccelerationPartial.h"
+#include "tudat/astro/orbit_determination/acceleration_partials/einsteinInfeldHoffmannPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/customAccelerationPartial.h"
 #include "tudat/astro/orbit_determination/acceleration_partials/fullRadiationPressureAccelerationPartial.h"
 #include "tudat/astro/orbit_determination/observation_partials/rotationMatrixPartial.h"
@@ -201,6 +203,52 @@ std::vector< std::shared_ptr< orbit_determination::TidalLoveNumberPartialInterfa
         const std::string& acceleratingBodyName );
 
 
+//! Function to retrieve the settings for the numerical state partials of a single acceleration
+/*!
+ * Function to retrieve the settings for the numerical state partials of a single acceleration, as defined by the user through the
+ * custom partial settings of the (single-arc) initial state parameter of the body undergoing the acceleration.
+ * \param parametersToEstimate List of parameters that are to be estimated (may be nullptr)
+ * \param bodyUndergoingAcceleration Name of body undergoing the acceleration
+ * \param bodyExertingAcceleration Name of body exerting the acceleration
+ * \param accelerationType Type of the acceleration
+ * \return Settings for numerical state partials (nullptr if none are defined)
+ */
+template< typename InitialStateParameterType >
+std::shared_ptr< estimatable_parameters::NumericalAccelerationPartialSettings > getNumericalStatePartialSettings(
+        const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< InitialStateParameterType > >
+        parametersToEstimate,
+        const std::string& bodyUndergoingAcceleration,
+        const std::string& bodyExertingAcceleration,
+        const basic_astrodynamics::AvailableAcceleration accelerationType )
+{
+    std::shared_ptr< estimatable_parameters::NumericalAccelerationPartialSettings > numericalPartialSettings = nullptr;
+    if( parametersToEstimate != nullptr )
+    {
+        for( unsigned int i = 0; i < parametersToEstimate->getEstimatedInitialStateParameters( ).size( ); i++ )
+        {
+            std::vector< std::shared_ptr< estimatable_parameters::CustomAccelerationPartialSettings > > customPartialSettings =
+                    parametersToEstimate->getEstimatedInitialStateParameters( ).at( i )->getCustomPartialSettings( );
+            for( unsigned int j = 0; j < customPartialSettings.size( ); j++ )
+            {
+                if( customPartialSettings.at( j )->accelerationMatches(
+                        bodyUndergoingAcceleration, bodyExertingAcceleration, accelerationType ) )
+                {
+                    numericalPartialSettings =
+                            std::dynamic_pointer_cast< estimatable_parameters::NumericalAccelerationPartialSettings >(
+                                customPartialSettings.at( j ) );
+                    if( numericalPartialSettings == nullptr )
+                    {
+                        throw std::runtime_error( "Error, only numerical custom partial settings are supported for acceleration on " +
+                                                  bodyUndergoingAcceleration + " due to " + bodyExertingAcceleration + " of type " +
+                                                  basic_astrodynamics::getAccelerationModelName( accelerationType ) );
+                    }
+                }
+            }
+        }
+    }
+    return numericalPartialSettings;
+}
+
 std::shared_ptr< estimatable_parameters::NumericalAccelerationPartialSettings > getDefaultPanelledSurfaceRadiationPressurePartialSettings(
     const std::string bodyUndergoingAcceleration,
     const std::string bodyExertingAcceleration );
@@ -671,6 +719,68 @@ std::shared_ptr< acceleration_partials::AccelerationPartial > createAnalyticalAc
         }
         break;
     }
+    case mascon_gravity:
+    {
+        // Check if identifier is consistent with type.
+        std::shared_ptr< MasconGravitationalAccelerationModel > masconAcceleration =
+                std::dynamic_pointer_cast< MasconGravitationalAccelerationModel >( accelerationModel );
+        if( masconAcceleration == nullptr )
+        {
+            throw std::runtime_error(
+                        "Acceleration class type does not match acceleration type enum (mascon_gravity) set when making "
+                        "acceleration partial." );
+        }
+        else
+        {
+            std::map< std::pair< estimatable_parameters::EstimatebleParametersEnum, std::string >,
+                    std::shared_ptr< observation_partials::RotationMatrixPartial > >
+                    rotationMatrixPartials = observation_partials::createRotationMatrixPartials(
+                        parametersToEstimate, acceleratingBody.first, bodies );
+
+            // Create partial-calculating object.
+            accelerationPartial = std::make_shared< MasconGravityPartial >
+                    ( acceleratedBody.first, acceleratingBody.first, masconAcceleration, rotationMatrixPartials );
+
+        }
+        break;
+    }
+    case third_body_mascon_gravity:
+    {
+        // Check if identifier is consistent with type.
+        if( std::dynamic_pointer_cast< ThirdBodyMasconGravitationalAccelerationModel >( accelerationModel ) == nullptr )
+        {
+            throw std::runtime_error( "Acceleration class type does not match acceleration type "
+                                      "(third_body_mascon_gravity) when making acceleration partial." );
+        }
+        else
+        {
+            std::shared_ptr< ThirdBodyMasconGravitationalAccelerationModel > thirdBodyAccelerationModel  =
+                    std::dynamic_pointer_cast< ThirdBodyMasconGravitationalAccelerationModel >(
+                        accelerationModel );
+
+            // Create partials for constituent central gravity accelerations
+            std::shared_ptr< MasconGravityPartial > accelerationPartialForBodyUndergoingAcceleration =
+                    std::dynamic_pointer_cast< MasconGravityPartial >(
+                        createAnalyticalAccelerationPartial(
+                            thirdBodyAccelerationModel->getAccelerationModelForBodyUndergoingAcceleration( ),
+                            acceleratedBody, acceleratingBody, bodies, parametersToEstimate ) );
+            std::shared_ptr< MasconGravityPartial > accelerationPartialForCentralBody =
+                    std::dynamic_pointer_cast< MasconGravityPartial >(
+                        createAnalyticalAccelerationPartial(
+                            thirdBodyAccelerationModel->getAccelerationModelForCentralBody( ),
+                            std::make_pair( thirdBodyAccelerationModel->getCentralBodyName( ),
+                                            bodies.at( thirdBodyAccelerationModel->getCentralBodyName( ) ) ),
+                            acceleratingBody, bodies, parametersToEstimate  ) );
+
+            // Create partial-calculating object.
+            accelerationPartial = std::make_shared< ThirdBodyGravityPartial< MasconGravityPartial > >(
+                        accelerationPartialForBodyUndergoingAcceleration,
+                        accelerationPartialForCentralBody, acceleratedBody.first, acceleratingBody.first,
+                        thirdBodyAccelerationModel->getCentralBodyName( ) );
+
+        }
+        break;
+    }
     case aerodynamic:
     {
         // Check if identifier is consistent with type.
@@ -693,13 +803,37 @@ std::shared_ptr< acceleration_partials::AccelerationPartial > createAnalyticalAc
             }
             else
             {
+                // Retrieve user-defined settings for numerical state partials, if any
+                std::shared_ptr< estimatable_parameters::NumericalAccelerationPartialSettings > numericalPartialSettings =
+                        getNumericalStatePartialSettings(
+                            parametersToEstimate, acceleratedBody.first, acceleratingBody.first, aerodynamic );
+
                 // Create partial-calculating object.
-                accelerationPartial = std::make_shared< AerodynamicAccelerationPartial >
-                        ( aerodynamicAcceleration,
-                          flightConditions,
-                          std::bind( &Body::getState, acceleratedBody.second ),
-                          std::bind( &Body::setState, acceleratedBody.second, std::placeholders::_1 ),
-                          acceleratedBody.first, acceleratingBody.first );
+                if( numericalPartialSettings == nullptr )
+                {
+                    accelerationPartial = std::make_shared< AerodynamicAccelerationPartial >
+                            ( aerodynamicAcceleration,
+                              flightConditions,
+                              std::bind( &Body::getState, acceleratedBody.second ),
+                              std::bind( &Body::setState, acceleratedBody.second, std::placeholders::_1 ),
+                              acceleratedBody.first, acceleratingBody.first );
+                }
+                else
+                {
+                    if( numericalPartialSettings->parameterPerturbation_.rows( ) != 6 )
+                    {
+                        throw std::runtime_error( "Error when making aerodynamic acceleration partial, numerical partial settings "
+                                                  "should define 6 state perturbations" );
+                    }
+                    accelerationPartial = std::make_shared< AerodynamicAccelerationPartial >
+                            ( aerodynamicAcceleration,
+                              flightConditions,
+                              std::bind( &Body::getState, acceleratedBody.second ),
+                              std::bind( &Body::setState, acceleratedBody.second, std::placeholders::_1 ),
+                              acceleratedBody.first, acceleratingBody.first,
+                              numericalPartialSettings->stepSizeUpdateInterval_,
+                              numericalPartialSettings->parameterPerturbation_ );
+                }
             }
         }
         break;
@@ -831,6 +965,25 @@ std::shared_ptr< acceleration_partials::AccelerationPartial > createAnalyticalAc
         }
         break;
     }
+    case einstein_infeld_hoffmann_acceleration:
+    {
+        // Check if identifier is consistent with type.
+        std::shared_ptr< relativity::EinsteinInfeldHoffmannAcceleration > eihAcceleration =
+            std::dynamic_pointer_cast< relativity::EinsteinInfeldHoffmannAcceleration >( accelerationModel );
+        if( eihAcceleration == nullptr )
+        {
+            throw std::runtime_error(
+                "Acceleration class type does not match acceleration type enum (einstein_infeld_hoffmann_acceleration) set when making "
+                "acceleration partial." );
+        }
+        else
+        {
+            // Create partial-calculating object.
+            accelerationPartial = std::make_shared< EinsteinInfeldHoffmannPartial >
+                ( eihAcceleration, acceleratedBody.first, acceleratingBody.first );
+        }
+        break;
+    }
     default:
         std::string errorMessage = "Acceleration model " + std::to_string( accelerationType ) +
                 " not found when making acceleration partial";
@@ -1490,7 +1490,7 @@ std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd >
                         std::dynamic_pointer_cast< TimeDependentSphericalHarmonicsGravityField >( shGravityField );
 
                 std::function< Eigen::MatrixXd( ) > getCosineCoefficientsFunction;
-                std::function< void( Eigen::MatrixXd ) > setCosineCoefficientsFunction;
+                std::function< void( const Eigen::MatrixXd& ) > setCosineCoefficientsFunction;
 
                 if( timeDependentShField == nullptr )
                 {
@@ -1548,7 +1548,7 @@ std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd >
                 // Check if spherical harmonic gravity field is static or time-dependent; set associated
                 // functions accordingly
                 std::function< Eigen::MatrixXd( ) > getSineCoefficientsFunction;
-                std::function< void( Eigen::MatrixXd ) > setSineCoefficientsFunction;
+                std::function< void( const Eigen::MatrixXd& ) > setSineCoefficientsFunction;
                 std::shared_ptr< TimeDependentSphericalHarmonicsGravityField > timeDependentShField =
                         std::dynamic_pointer_cast< TimeDependentSphericalHarmonicsGravityField >( shGravityField );
 
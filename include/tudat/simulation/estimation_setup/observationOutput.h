@@ -26,12 +26,75 @@ typedef std::function< Eigen::VectorXd( const std::vector< double >& ,
                                         const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ) >
                                         ObservationDependentVariableFunction;
 
-typedef std::function< void( Eigen::VectorXd&,
+typedef std::function< void( Eigen::Ref< Eigen::VectorXd >,
                              const std::vector< double >&,
                              const std::vector< Eigen::Matrix< double, 6, 1 > >&,
                              const Eigen::VectorXd&,
                              const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ) > ObservationDependentVariableAddFunction;
 
+//! Class to store environment quantities that are shared between observation dependent variables
+/*!
+ *  Class to store environment quantities that are shared between observation dependent variables, such as the state of a
+ *  body w.r.t. which a link property is computed, or the rotation to the topocentric frame of a ground station. Each
+ *  quantity is computed once per observation, after which all dependent variables that require it retrieve the stored
+ *  value. The stored values are removed (by the ObservationDependentVariableCalculator) before each new observation.
+ */
+class ObservationDependentVariableSharedData
+{
+public:
+
+    ObservationDependentVariableSharedData( ){ }
+
+    //! Function to remove all stored quantities (retaining allocated memory)
+    void reset( )
+    {
+        bodyStates_.clear( );
+        topocentricRotations_.clear( );
+    }
+
+    //! Function to retrieve the state of a body at a given time, computing it from its ephemeris if not yet stored
+    Eigen::Vector6d getBodyState( const std::shared_ptr< Body > body, const double time )
+    {
+        for( unsigned int i = 0; i < bodyStates_.size( ); i++ )
+        {
+            if( std::get< 0 >( bodyStates_.at( i ) ) == body.get( ) && std::get< 1 >( bodyStates_.at( i ) ) == time )
+            {
+                return std::get< 2 >( bodyStates_.at( i ) );
+            }
+        }
+        bodyStates_.push_back( std::make_tuple(
+                                   body.get( ), time, body->getStateInBaseFrameFromEphemeris< double, double >( time ) ) );
+        return std::get< 2 >( bodyStates_.back( ) );
+    }
+
+    //! Function to retrieve the inertial to topocentric rotation of a station, computing it if not yet stored
+    Eigen::Quaterniond getRotationToTopocentricFrame(
+            const std::shared_ptr< ground_stations::PointingAnglesCalculator > pointingAnglesCalculator,
+            const double time )
+    {
+        for( unsigned int i = 0; i < topocentricRotations_.size( ); i++ )
+        {
+            if( std::get< 0 >( topocentricRotations_.at( i ) ) == pointingAnglesCalculator.get( ) &&
+                    std::get< 1 >( topocentricRotations_.at( i ) ) == time )
+            {
+                return std::get< 2 >( topocentricRotations_.at( i ) );
+            }
+        }
+        topocentricRotations_.push_back( std::make_tuple(
+                                             pointingAnglesCalculator.get( ), time,
+                                             pointingAnglesCalculator->getRotationFromInertialToTopocentricFrame( time ) ) );
+        return std::get< 2 >( topocentricRotations_.back( ) );
+    }
+
+private:
+
+    //! List of body states computed for current observation (with body and time for which they are computed)
+    std::vector< std::tuple< const Body*, double, Eigen::Vector6d > > bodyStates_;
+
+    //! List of topocentric rotations computed for current observation (with station and time for which they are computed)
+    std::vector< std::tuple< const ground_stations::PointingAnglesCalculator*, double, Eigen::Quaterniond > > topocentricRotations_;
+};
+
 void checkObservationDependentVariableEnvironment(
         const SystemOfBodies& bodies,
         const std::shared_ptr< ObservationDependentVariableSettings > variableSettings );
@@ -49,19 +112,22 @@ ObservationDependentVariableFunction getStationObservationAngleFunction(
         const SystemOfBodies& bodies,
         const std::shared_ptr< StationAngleObservationDependentVariableSettings > variableSettings,
         const observation_models::ObservableType observableType,
-        const observation_models::LinkDefinition linkEnds );
+        const observation_models::LinkDefinition linkEnds,
+        const std::shared_ptr< ObservationDependentVariableSharedData > sharedData = nullptr );
 
 ObservationDependentVariableFunction getObservationDoubleDependentVariableFunction(
         const SystemOfBodies& bodies,
         const std::shared_ptr< ObservationDependentVariableSettings > variableSettings,
         const observation_models::ObservableType observableType,
-        const observation_models::LinkDefinition linkEnds );
+        const observation_models::LinkDefinition linkEnds,
+        const std::shared_ptr< ObservationDependentVariableSharedData > sharedData = nullptr );
 
 ObservationDependentVariableFunction getObservationVectorDependentVariableFunction(
         const SystemOfBodies& bodies,
         const std::shared_ptr< ObservationDependentVariableSettings > variableSettings,
         const observation_models::ObservableType observableType,
-        const observation_models::LinkDefinition linkEnds );
+        const observation_models::LinkDefinition linkEnds,
+        const std::shared_ptr< ObservationDependentVariableSharedData > sharedData = nullptr );
 
 class ObservationDependentVariableCalculator
 {
@@ -69,7 +135,8 @@ public:
 
     ObservationDependentVariableCalculator( const observation_models::ObservableType observableType,
                                             const observation_models::LinkDefinition& linkEnds ):
-    observableType_( observableType ), linkEnds_( linkEnds )
+    observableType_( observableType ), linkEnds_( linkEnds ),
+    sharedData_( std::make_shared< ObservationDependentVariableSharedData >( ) )
     {
         totalDependentVariableSize_ = 0.0;
     }
@@ -80,6 +147,41 @@ public:
             const Eigen::VectorXd& observation,
             const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > );
 
+    //! Function to compute the dependent variables of a single observation, writing them into an existing vector
+    /*!
+     *  Function to compute the dependent variables of a single observation, writing them into an existing vector (or
+     *  column of a matrix) of size getTotalDependentVariableSize( ), without allocating any memory for the output.
+     *  \param dependentVariables Dependent variables of observation (returned by reference)
+     *  \param linkEndTimes Times at the link ends, as computed by the observation model
+     *  \param linkEndStates States at the link ends, as computed by the observation model
+     *  \param observation Value of the observation
+     *  \param ancilliarySimulationSettings Ancilliary settings of the observation
+     */
+    void calculateDependentVariables(
+            Eigen::Ref< Eigen::VectorXd > dependentVariables,
+            const std::vector< double >& linkEndTimes,
+            const std::vector< Eigen::Matrix< double, 6, 1 > >& linkEndStates,
+            const Eigen::VectorXd& observation,
+            const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySimulationSettings );
+
+    //! Function to compute the dependent variables of a batch of observations
+    /*!
+     *  Function to compute the dependent variables of a batch of observations, from the link end times and states that were
+     *  computed by the observation model. The dependent variables are written into a single matrix, with each column
+     *  containing the dependent variables of a single observation.
+     *  \param dependentVariables Dependent variables of observations, one column per observation (returned by reference)
+     *  \param linkEndTimes Times at the link ends, per observation
+     *  \param linkEndStates States at the link ends, per observation
+     *  \param observations Values of the observations, one column per observation
+     *  \param ancilliarySimulationSettings Ancilliary settings of the observations
+     */
+    void calculateDependentVariables(
+            Eigen::MatrixXd& dependentVariables,
+            const std::vector< std::vector< double > >& linkEndTimes,
+            const std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates,
+            const Eigen::MatrixXd& observations,
+            const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySimulationSettings );
+
     void addDependentVariable(
             const std::shared_ptr< ObservationDependentVariableSettings > settings,
             const SystemOfBodies& bodies );
@@ -100,6 +202,12 @@ public:
     {
         return linkEnds_;
     }
+
+    int getTotalDependentVariableSize( )
+    {
+        return totalDependentVariableSize_;
+    }
+
 private:
 
     observation_models::ObservableType observableType_;
@@ -108,12 +216,10 @@ private:
 
     std::vector< std::shared_ptr< ObservationDependentVariableSettings > > settingsList_;
 
-    std::vector< std::function< void(
-            Eigen::VectorXd&,
-            const std::vector< double >&,
-            const std::vector< Eigen::Matrix< double, 6, 1 > >&,
-            const Eigen::VectorXd&,
-            const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ) > > dependentVariableAddFunctions_;
+    std::vector< ObservationDependentVariableAddFunction > dependentVariableAddFunctions_;
+
+    //! Environment quantities shared between the dependent variables of a single observation
+    std::shared_ptr< ObservationDependentVariableSharedData > sharedData_;
 
     std::vector< int > dependentVariableStartIndices_;
 
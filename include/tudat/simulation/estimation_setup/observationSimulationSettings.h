@@ -18,6 +18,7 @@
 #include "tudat/astro/observation_models/observationSimulator.h"
 #include "tudat/simulation/estimation_setup/observations.h"
 #include "tudat/basics/utilities.h"
+#include "tudat/math/statistics/counterBasedRandomNumberGenerator.h"
 #include "tudat/math/statistics/randomVariableGenerator.h"
 #include "tudat/math/statistics/multiVariateGaussianProbabilityDistributions.h"
 #include "tudat/simulation/environment_setup/body.h"
@@ -39,6 +40,44 @@ std::function< Eigen::VectorXd( const double ) > getNoiseFunctionForObservable(
         const std::function< double( const double ) > singleNoiseFunction,
         const observation_models::ObservableType observableType );
 
+//! Function to retrieve the key of counter-based observation noise, for a given observable type and set of link ends.
+/*!
+ *  Function to retrieve the key of counter-based observation noise, for a given observable type and set of link ends,
+ *  derived from a user-defined seed. The key only depends on its input (and not on e.g. the order in which observation
+ *  simulation settings are created), so that noise for each observation is reproducible.
+ *  \param seed User-defined noise seed.
+ *  \param observableType Type of observable.
+ *  \param linkEnds Link ends of observable.
+ *  \return Key for counter-based random number generator.
+ */
+std::uint64_t getObservationNoiseKey(
+        const std::uint64_t seed,
+        const observation_models::ObservableType observableType,
+        const observation_models::LinkDefinition& linkEnds );
+
+//! Function to create a first-order Gauss-Markov noise function for an observable.
+/*!
+ *  Function to create a first-order Gauss-Markov noise function for an observable. The noise is generated at equally
+ *  spaced times (using a counter-based random number generator), and linearly interpolated. The entries of the
+ *  observable are independent.
+ *  \param standardDeviation Standard deviation of the (stationary) noise process.
+ *  \param correlationTime Correlation time of the noise process.
+ *  \param startTime Start time of interval in which noise is to be generated.
+ *  \param endTime End time of interval in which noise is to be generated.
+ *  \param timeStep Time step at which noise is to be generated.
+ *  \param key Key (i.e. seed) of the noise
+ *  \param observableSize Size of the observable.
+ *  \return Noise function
+ */
+std::function< Eigen::VectorXd( const double ) > getFirstOrderGaussMarkovNoiseFunction(
+        const double standardDeviation,
+        const double correlationTime,
+        const double startTime,
+        const double endTime,
+        const double timeStep,
+        const std::uint64_t key,
+        const int observableSize );
+
 
 struct ObservationNoiseModel
 {
@@ -504,6 +543,61 @@ void addGaussianNoiseToSingleObservationSimulationSettings(
     observationSimulationSettings->setObservationNoiseFunction( noiseFunction );
 }
 
+//! Function to add counter-based Gaussian noise to observation simulation settings
+/*!
+ *  Function to add counter-based Gaussian noise to observation simulation settings. Contrary to
+ *  addGaussianNoiseToSingleObservationSimulationSettings, the noise at each observation only depends on the seed, observable
+ *  type, link ends and observation time, and not on the order in which observations are simulated. As a result,
+ *  observations simulated in parallel, or in a different order, have identical noise.
+ *  \param observationSimulationSettings Observation simulation settings to which noise is to be added
+ *  \param observationNoiseAmplitude Standard deviation of the noise
+ *  \param seed User-defined noise seed.
+ */
+template< typename TimeType = double >
+void addCounterBasedGaussianNoiseToSingleObservationSimulationSettings(
+        const std::shared_ptr< ObservationSimulationSettings< TimeType > >& observationSimulationSettings,
+        const double observationNoiseAmplitude,
+        const std::uint64_t seed )
+{
+    observationSimulationSettings->setObservationNoiseFunction(
+                statistics::getCounterBasedGaussianNoiseFunction(
+                    observationNoiseAmplitude,
+                    getObservationNoiseKey( seed, observationSimulationSettings->getObservableType( ),
+                                            observationSimulationSettings->getLinkEnds( ) ),
+                    observation_models::getObservableSize( observationSimulationSettings->getObservableType( ) ) ) );
+}
+
+//! Function to add first-order Gauss-Markov (time-correlated) noise to observation simulation settings
+/*!
+ *  Function to add first-order Gauss-Markov (time-correlated) noise to observation simulation settings (see
+ *  getFirstOrderGaussMarkovNoiseFunction). The noise is reproducible in the same manner as for
+ *  addCounterBasedGaussianNoiseToSingleObservationSimulationSettings.
+ *  \param observationSimulationSettings Observation simulation settings to which noise is to be added
+ *  \param standardDeviation Standard deviation of the (stationary) noise process.
+ *  \param correlationTime Correlation time of the noise process.
+ *  \param startTime Start time of interval in which noise is to be generated.
+ *  \param endTime End time of interval in which noise is to be generated.
+ *  \param timeStep Time step at which noise is to be generated.
+ *  \param seed User-defined noise seed.
+ */
+template< typename TimeType = double >
+void addFirstOrderGaussMarkovNoiseToSingleObservationSimulationSettings(
+        const std::shared_ptr< ObservationSimulationSettings< TimeType > >& observationSimulationSettings,
+        const double standardDeviation,
+        const double correlationTime,
+        const double startTime,
+        const double endTime,
+        const double timeStep,
+        const std::uint64_t seed )
+{
+    observationSimulationSettings->setObservationNoiseFunction(
+                getFirstOrderGaussMarkovNoiseFunction(
+                    standardDeviation, correlationTime, startTime, endTime, timeStep,
+                    getObservationNoiseKey( seed, observationSimulationSettings->getObservableType( ),
+                                            observationSimulationSettings->getLinkEnds( ) ),
+                    observation_models::getObservableSize( observationSimulationSettings->getObservableType( ) ) ) );
+}
+
 template< typename TimeType = double >
 void modifyObservationSimulationSettings(
         const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationSimulationSettings,
@@ -588,6 +682,38 @@ void addGaussianNoiseFunctionToObservationSimulationSettings(
                 observationSimulationSettings, modificationFunction, args ... );
 }
 
+template< typename TimeType = double, typename... ArgTypes  >
+void addCounterBasedGaussianNoiseFunctionToObservationSimulationSettings(
+        const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationSimulationSettings,
+        const double observationNoiseAmplitude,
+        const std::uint64_t seed,
+        ArgTypes... args )
+{
+    std::function< void( const std::shared_ptr< ObservationSimulationSettings< TimeType > > ) > modificationFunction =
+            std::bind( &addCounterBasedGaussianNoiseToSingleObservationSimulationSettings< TimeType >,
+                       std::placeholders::_1, observationNoiseAmplitude, seed );
+    modifyObservationSimulationSettings(
+                observationSimulationSettings, modificationFunction, args ... );
+}
+
+template< typename TimeType = double, typename... ArgTypes  >
+void addFirstOrderGaussMarkovNoiseFunctionToObservationSimulationSettings(
+        const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationSimulationSettings,
+        const double standardDeviation,
+        const double correlationTime,
+        const double startTime,
+        const double endTime,
+        const double timeStep,
+        const std::uint64_t seed,
+        ArgTypes... args )
+{
+    std::function< void( const std::shared_ptr< ObservationSimulationSettings< TimeType > > ) > modificationFunction =
+            std::bind( &addFirstOrderGaussMarkovNoiseToSingleObservationSimulationSettings< TimeType >,
+                       std::placeholders::_1, standardDeviation, correlationTime, startTime, endTime, timeStep, seed );
+    modifyObservationSimulationSettings(
+                observationSimulationSettings, modificationFunction, args ... );
+}
+
 template< typename TimeType = double, typename... ArgTypes  >
 void addDependentVariablesToObservationSimulationSettings(
         const std::vector< std::shared_ptr< ObservationSimulationSettings< TimeType > > >& observationSimulationSettings,
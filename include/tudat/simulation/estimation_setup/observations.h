@@ -11,6 +11,9 @@
 #ifndef TUDAT_OBSERVATIONS_H
 #define TUDAT_OBSERVATIONS_H
 
+#include <algorithm>
+#include <map>
+#include <numeric>
 #include <vector>
 
 #include <memory>
@@ -47,6 +50,31 @@ public:
             const std::vector< Eigen::VectorXd >& observationsDependentVariables = std::vector< Eigen::VectorXd >( ),
             const std::shared_ptr< simulation_setup::ObservationDependentVariableCalculator > dependentVariableCalculator = nullptr,
             const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySettings = nullptr ):
+        SingleObservationSet( observableType, linkEnds, createObservationMatrix( observations, observationTimes.size( ) ),
+                              observationTimes, referenceLinkEnd, observationsDependentVariables,
+                              dependentVariableCalculator, ancilliarySettings ){ }
+
+    //! Constructor with observations provided in contiguous storage
+    /*!
+     * Constructor with observations provided in contiguous storage
+     * \param observableType Type of observable
+     * \param linkEnds Link ends of the observations
+     * \param observations Matrix of observations, with column i the observation at time observationTimes[i]
+     * \param observationTimes Times at which observations are given
+     * \param referenceLinkEnd Link end at which observation times are defined
+     * \param observationsDependentVariables Dependent variables associated with observations (empty if none)
+     * \param dependentVariableCalculator Object used to compute observation dependent variables
+     * \param ancilliarySettings Ancilliary settings with which observations were simulated
+     */
+    SingleObservationSet(
+            const ObservableType observableType,
+            const LinkDefinition& linkEnds,
+            const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, Eigen::Dynamic >& observations,
+            const std::vector< TimeType > observationTimes,
+            const LinkEndType referenceLinkEnd,
+            const std::vector< Eigen::VectorXd >& observationsDependentVariables = std::vector< Eigen::VectorXd >( ),
+            const std::shared_ptr< simulation_setup::ObservationDependentVariableCalculator > dependentVariableCalculator = nullptr,
+            const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySettings = nullptr ):
         observableType_( observableType ),
         linkEnds_( linkEnds ),
         observations_( observations ),
@@ -55,7 +83,7 @@ public:
         observationsDependentVariables_( observationsDependentVariables ),
         dependentVariableCalculator_( dependentVariableCalculator ),
         ancilliarySettings_( ancilliarySettings ),
-        numberOfObservations_( observations_.size( ) )
+        numberOfObservations_( observations_.cols( ) )
     {
         if( dependentVariableCalculator_ != nullptr )
         {
@@ -70,47 +98,44 @@ public:
             }
         }
 
-        if( observations_.size( ) != observationTimes_.size( ) )
+        if( static_cast< int >( observationTimes_.size( ) ) != numberOfObservations_ )
         {
             throw std::runtime_error( "Error when making SingleObservationSet, input sizes are inconsistent." +
-                std::to_string( observations_.size( ) ) + ", " + std::to_string( observationTimes_.size( ) ) );
-        }
-
-        for( unsigned int i = 1; i < observations.size( ); i++ )
-        {
-            if( observations.at( i ).rows( ) != observations.at( i - 1 ).rows( ) )
-            {
-                throw std::runtime_error( "Error when making SingleObservationSet, input observables not of consistent size." );
-            }
+                std::to_string( numberOfObservations_ ) + ", " + std::to_string( observationTimes_.size( ) ) );
         }
 
         if( !std::is_sorted( observationTimes_.begin( ), observationTimes_.end( ) ) )
         {
-            std::multimap< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observationsMap;
-            for( unsigned int i = 0; i < observations_.size( ); i++ )
+            if( observationsDependentVariables_.size( ) > 0 &&
+                static_cast< int >( observationsDependentVariables_.size( ) ) != numberOfObservations_ )
             {
-                observationsMap.insert( { observationTimes_.at( i ), observations_.at( i ) } );
+                throw std::runtime_error( "Error when making SingleObservationSet, number of dependent variables is incompatible with time ordering" );
             }
-            observationTimes_ = utilities::createVectorFromMultiMapKeys( observationsMap );
-            observations_ = utilities::createVectorFromMultiMapValues( observationsMap );
-            if( observationsDependentVariables_.size( ) > 0 )
+
+            // Reorder all data by (stable) time ordering of the observations
+            std::vector< int > sortedIndices( numberOfObservations_ );
+            std::iota( sortedIndices.begin( ), sortedIndices.end( ), 0 );
+            std::stable_sort( sortedIndices.begin( ), sortedIndices.end( ),
+                              [ & ]( const int i, const int j ){ return observationTimes_.at( i ) < observationTimes_.at( j ); } );
+
+            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, Eigen::Dynamic > sortedObservations( observations_.rows( ), numberOfObservations_ );
+            std::vector< TimeType > sortedObservationTimes( numberOfObservations_ );
+            std::vector< Eigen::VectorXd > sortedObservationsDependentVariables( observationsDependentVariables_.size( ) );
+            for( int i = 0; i < numberOfObservations_; i++ )
             {
-                std::map< TimeType, Eigen::VectorXd > observationsDependentVariablesMap;
-                for( unsigned int i = 0; i < observationsDependentVariables_.size( ); i++ )
+                sortedObservations.col( i ) = observations_.col( sortedIndices.at( i ) );
+                sortedObservationTimes[ i ] = observationTimes_.at( sortedIndices.at( i ) );
+                if( observationsDependentVariables_.size( ) > 0 )
                 {
-                    observationsDependentVariablesMap[ observationTimes_.at( i ) ] = observationsDependentVariables_.at( i );
+                    sortedObservationsDependentVariables[ i ] = observationsDependentVariables_.at( sortedIndices.at( i ) );
                 }
-                observationsDependentVariables_ = utilities::createVectorFromMapValues( observationsDependentVariablesMap );
-            }
-            if( static_cast< int >( observations_.size( ) ) != numberOfObservations_ )
-            {
-                throw std::runtime_error( "Error when making SingleObservationSet, number of observations is incompatible after time ordering" );
             }
+            observations_.swap( sortedObservations );
+            observationTimes_.swap( sortedObservationTimes );
+            observationsDependentVariables_.swap( sortedObservationsDependentVariables );
         }
     }
 
-
-
     ObservableType getObservableType( )
     {
         return observableType_;
@@ -123,22 +148,28 @@ public:
 
     std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservations( )
     {
-        return observations_;
+        std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations;
+        observations.reserve( numberOfObservations_ );
+        for( int i = 0; i < numberOfObservations_; i++ )
+        {
+            observations.push_back( observations_.col( i ) );
+        }
+        return observations;
     }
 
-    const std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >& getObservationsReference( )
+    //! Function to retrieve (by reference) the contiguous observation storage, with column i the i-th observation
+    const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, Eigen::Dynamic >& getObservationsReference( )
     {
         return observations_;
     }
 
-
     Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getObservation( const int index )
     {
         if( index >= numberOfObservations_ )
         {
             throw std::runtime_error( "Error when retrieving single observation, index is out of bounds" );
         }
-        return observations_.at( index );
+        return observations_.col( index );
     }
 
     std::vector< TimeType > getObservationTimes( )
@@ -161,29 +192,31 @@ public:
         return numberOfObservations_;
     }
 
+    int getSingleObservableSize( )
+    {
+        return observations_.rows( );
+    }
+
     Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getObservationsVector( )
     {
-        int singleObservableSize = 0;
-        if( numberOfObservations_ != 0 )
-        {
-            singleObservableSize = observations_.at( 0 ).rows( );
-        }
+        return getObservationsVectorReference( );
+    }
 
-        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector =
-                Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero(
-                    singleObservableSize * numberOfObservations_ );
-        for( unsigned int i = 0; i < observations_.size( ); i++ )
-        {
-            observationsVector.segment( i * singleObservableSize, singleObservableSize ) =
-                    observations_.at( i );
-        }
-        return observationsVector;
+    //! Function to retrieve a (non-owning) view of all observations, concatenated into a single vector
+    Eigen::Map< const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservationsVectorReference( )
+    {
+        return Eigen::Map< const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >(
+                    observations_.data( ), observations_.size( ) );
     }
 
     std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > getObservationsHistory( )
     {
-        return utilities::createMapFromVectors< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >(
-                    observationTimes_, observations_ );
+        std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observationsHistory;
+        for( int i = 0; i < numberOfObservations_; i++ )
+        {
+            observationsHistory[ observationTimes_.at( i ) ] = observations_.col( i );
+        }
+        return observationsHistory;
     }
 
 
@@ -217,18 +250,31 @@ public:
     std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > createFilteredObservationSet(
         std::vector< int > indices )
     {
-        std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > filteredObservations = observations_;
-        std::vector< TimeType > filteredObservationTimes = observationTimes_;
-        std::vector< Eigen::VectorXd > filteredObservationsDependentVariables = observationsDependentVariables_;
-
-        sort(indices.begin(), indices.end(), std::greater<int>());
+        std::vector< bool > retainObservation( numberOfObservations_, true );
         for( unsigned int i = 0; i < indices.size( ); i++ )
         {
-            filteredObservationTimes.erase( filteredObservationTimes.begin( ) + indices.at( i ) );
-            filteredObservations.erase( filteredObservations.begin( ) + indices.at( i ) );
-            if( filteredObservationsDependentVariables.size( ) >  0 )
+            retainObservation.at( indices.at( i ) ) = false;
+        }
+        int numberOfRetainedObservations = std::count( retainObservation.begin( ), retainObservation.end( ), true );
+
+        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, Eigen::Dynamic > filteredObservations(
+                    observations_.rows( ), numberOfRetainedObservations );
+        std::vector< TimeType > filteredObservationTimes;
+        filteredObservationTimes.reserve( numberOfRetainedObservations );
+        std::vector< Eigen::VectorXd > filteredObservationsDependentVariables;
+
+        int currentIndex = 0;
+        for( int i = 0; i < numberOfObservations_; i++ )
+        {
+            if( retainObservation.at( i ) )
             {
-                filteredObservationsDependentVariables.erase( filteredObservationsDependentVariables.begin( ) + indices.at( i ) );
+                filteredObservations.col( currentIndex ) = observations_.col( i );
+                filteredObservationTimes.push_back( observationTimes_.at( i ) );
+                if( observationsDependentVariables_.size( ) >  0 )
+                {
+                    filteredObservationsDependentVariables.push_back( observationsDependentVariables_.at( i ) );
+                }
+                currentIndex++;
             }
         }
         return std::make_shared< SingleObservationSet< ObservationScalarType, TimeType > >(
@@ -236,14 +282,73 @@ public:
             referenceLinkEnd_, filteredObservationsDependentVariables, dependentVariableCalculator_, ancilliarySettings_ );
     }
 
+    //! Function to create a new observation set from a contiguous range of the observations in this set
+    /*!
+     * Function to create a new observation set from a contiguous range of the observations in this set, copying only
+     * the data in the requested range.
+     * \param startIndex Index of first observation in new set
+     * \param numberOfObservations Number of observations in new set
+     * \return Observation set with requested subset of observations
+     */
+    std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > createObservationSubset(
+        const int startIndex, const int numberOfObservations )
+    {
+        if( startIndex < 0 || numberOfObservations < 0 || startIndex + numberOfObservations > numberOfObservations_ )
+        {
+            throw std::runtime_error( "Error when creating observation subset, range is out of bounds" );
+        }
+
+        std::vector< Eigen::VectorXd > subsetDependentVariables;
+        if( observationsDependentVariables_.size( ) > 0 )
+        {
+            subsetDependentVariables = std::vector< Eigen::VectorXd >(
+                observationsDependentVariables_.begin( ) + startIndex,
+                observationsDependentVariables_.begin( ) + startIndex + numberOfObservations );
+        }
+
+        return std::make_shared< SingleObservationSet< ObservationScalarType, TimeType > >(
+            observableType_, linkEnds_,
+            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, Eigen::Dynamic >(
+                observations_.middleCols( startIndex, numberOfObservations ) ),
+            std::vector< TimeType >( observationTimes_.begin( ) + startIndex,
+                                     observationTimes_.begin( ) + startIndex + numberOfObservations ),
+            referenceLinkEnd_, subsetDependentVariables, dependentVariableCalculator_, ancilliarySettings_ );
+    }
+
 
 private:
 
+    //! Function to convert list of observations to contiguous storage, with column i the i-th observation
+    static Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, Eigen::Dynamic > createObservationMatrix(
+        const std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > >& observations,
+        const unsigned int numberOfObservationTimes )
+    {
+        if( observations.size( ) != numberOfObservationTimes )
+        {
+            throw std::runtime_error( "Error when making SingleObservationSet, input sizes are inconsistent." +
+                std::to_string( observations.size( ) ) + ", " + std::to_string( numberOfObservationTimes ) );
+        }
+
+        int singleObservableSize = ( observations.size( ) > 0 ) ? observations.at( 0 ).rows( ) : 0;
+        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, Eigen::Dynamic > observationMatrix(
+            singleObservableSize, observations.size( ) );
+        for( unsigned int i = 0; i < observations.size( ); i++ )
+        {
+            if( observations.at( i ).rows( ) != singleObservableSize )
+            {
+                throw std::runtime_error( "Error when making SingleObservationSet, input observables not of consistent size." );
+            }
+            observationMatrix.col( i ) = observations.at( i );
+        }
+        return observationMatrix;
+    }
+
     const ObservableType observableType_;
 
     const LinkDefinition linkEnds_;
 
-    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observations_;
+    //! Observations in contiguous storage, with column i the i-th observation
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, Eigen::Dynamic > observations_;
 
     std::vector< TimeType > observationTimes_;
 
@@ -289,14 +394,9 @@ createResidualObservationSet(
 
     //ESTIMATION-TODO: Add comparison of ancilliary settings
 
-    std::vector< TimeType > observedTimes = observedObservationSet->getObservationTimes( );
-    std::vector< TimeType > computedTimes = computedObservationSet->getObservationTimes( );
+    const std::vector< TimeType >& observedTimes = observedObservationSet->getObservationTimesReference( );
+    const std::vector< TimeType >& computedTimes = computedObservationSet->getObservationTimesReference( );
 
-    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > observedData = observedObservationSet->getObservations( );
-    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > computedData = computedObservationSet->getObservations( );
-
-
-    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > residuals;
     for( unsigned int i = 0; i < observedTimes.size( ); i++ )
     {
         if( observedTimes.at( i ) != computedTimes.at( i ) )
@@ -304,14 +404,14 @@ createResidualObservationSet(
             throw std::runtime_error( "Error when computing residual observation set, observation time of index " + std::to_string( i ) +
             " is not equal: " + std::to_string( static_cast< double >( observedTimes.at( i ) ) ) + ", " + std::to_string( static_cast< double >( computedTimes.at( i ) ) ) );
         }
-        residuals.push_back( observedData.at( i ) - computedData.at( i ) );
     }
 
     return std::make_shared< SingleObservationSet< ObservationScalarType, TimeType > >(
         observedObservationSet->getObservableType( ),
         observedObservationSet->getLinkEnds( ),
-        residuals,
-        observedObservationSet->getObservationTimes( ),
+        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, Eigen::Dynamic >(
+            observedObservationSet->getObservationsReference( ) - computedObservationSet->getObservationsReference( ) ),
+        observedTimes,
         observedObservationSet->getReferenceLinkEnd( ),
         std::vector< Eigen::VectorXd >( ),
         nullptr,
@@ -373,6 +473,11 @@ public:
         return concatenatedTimes_;
     }
 
+    const std::vector< TimeType >& getConcatenatedTimeVectorReference( )
+    {
+        return concatenatedTimes_;
+    }
+
     std::pair< TimeType, TimeType > getTimeBounds( )
     {
         return std::make_pair ( *std::min_element( concatenatedTimes_.begin( ), concatenatedTimes_.end( ) ),
@@ -413,6 +518,11 @@ public:
         return concatenatedObservationSetStartAndSize_;
     }
 
+    const std::vector< std::pair< int, int > >& getConcatenatedObservationSetStartAndSizeReference( )
+    {
+        return concatenatedObservationSetStartAndSize_;
+    }
+
     std::map< ObservableType, std::map< LinkEnds, std::pair< int, int > > > getObservationTypeAndLinkEndStartAndSize( )
     {
         return observationTypeAndLinkEndStartAndSize_;
@@ -688,16 +798,11 @@ private:
 
                     std::pair< int, int > startAndSize =
                             observationSetStartAndSize_.at( currentObservableType ).at( currentLinkEnds ).at( i );
-                    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > currentObservables =
-                            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( startAndSize.second );
-
-                    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > currentObservationSet =
-                            linkEndIterator.second.at( i )->getObservations( );
-                    std::vector< TimeType > currentObservationTimes =
-                            linkEndIterator.second.at( i )->getObservationTimes( );
-                    for( unsigned int j = 0; j < currentObservationSet.size( ); j++ )
+
+                    const std::vector< TimeType >& currentObservationTimes =
+                            linkEndIterator.second.at( i )->getObservationTimesReference( );
+                    for( unsigned int j = 0; j < currentObservationTimes.size( ); j++ )
                     {
-                        currentObservables.segment( j * observableSize, observableSize ) = currentObservationSet.at( j );
                         for( int k = 0; k < observableSize; k++ )
                         {
                             concatenatedTimes_[ observationCounter ] = currentObservationTimes.at( j );
@@ -706,7 +811,8 @@ private:
                             observationCounter++;
                         }
                     }
-                    concatenatedObservations_.segment( startAndSize.first, startAndSize.second ) = currentObservables;
+                    concatenatedObservations_.segment( startAndSize.first, startAndSize.second ) =
+                            linkEndIterator.second.at( i )->getObservationsVectorReference( );
                 }
             }
         }
@@ -751,6 +857,482 @@ private:
     int totalNumberOfObservables_;
 };
 
+//! Class providing a selection of the observations in an ObservationCollection, without copying observation data
+/*!
+ *  Class providing a selection of the observations in an ObservationCollection, without copying observation data. The
+ *  selection is stored as a sorted list of indices into the concatenated observation vector of the collection (see
+ *  ObservationCollection::getObservationVector), so that it can be applied directly to any vector or matrix that uses the
+ *  same ordering (residuals, weights, design matrix). All selection functions in this class retain or remove complete
+ *  observations (i.e. all entries of a multi-valued observable), and return a new view on the same collection.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+class ObservationCollectionView
+{
+public:
+
+    //! Constructor, selecting all observations in the collection
+    /*!
+     * Constructor, selecting all observations in the collection
+     * \param observationCollection Collection of observations that is to be viewed
+     */
+    ObservationCollectionView(
+        const std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > observationCollection ):
+        observationCollection_( observationCollection ),
+        selectedIndices_( observationCollection->getTotalObservableSize( ) )
+    {
+        std::iota( selectedIndices_.begin( ), selectedIndices_.end( ), 0 );
+        setObservableTypeRanges( );
+    }
+
+    //! Constructor, with explicit selection of entries
+    /*!
+     * Constructor, with explicit selection of entries
+     * \param observationCollection Collection of observations that is to be viewed
+     * \param selectedIndices Indices in concatenated observation vector of collection that are selected (must be sorted
+     * in ascending order)
+     */
+    ObservationCollectionView(
+        const std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > observationCollection,
+        const std::vector< int >& selectedIndices ):
+        observationCollection_( observationCollection ),
+        selectedIndices_( selectedIndices )
+    {
+        if( !std::is_sorted( selectedIndices_.begin( ), selectedIndices_.end( ) ) ||
+            std::adjacent_find( selectedIndices_.begin( ), selectedIndices_.end( ) ) != selectedIndices_.end( ) )
+        {
+            throw std::runtime_error( "Error when creating observation collection view, indices are not strictly increasing" );
+        }
+
+        if( selectedIndices_.size( ) > 0 && ( selectedIndices_.front( ) < 0 ||
+            selectedIndices_.back( ) >= observationCollection_->getTotalObservableSize( ) ) )
+        {
+            throw std::runtime_error( "Error when creating observation collection view, indices are out of bounds" );
+        }
+        setObservableTypeRanges( );
+    }
+
+    std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > getObservationCollection( )
+    {
+        return observationCollection_;
+    }
+
+    const std::vector< int >& getSelectedIndices( ) const
+    {
+        return selectedIndices_;
+    }
+
+    int getNumberOfSelectedEntries( ) const
+    {
+        return selectedIndices_.size( );
+    }
+
+    //! Function to retrieve the selected entries from a vector ordered as the concatenated observation vector
+    /*!
+     * Function to retrieve the selected entries from a vector ordered as the concatenated observation vector (e.g.
+     * residuals or observation weights).
+     * \param fullVector Vector with size equal to total observable size of collection
+     * \return Selected entries of fullVector
+     */
+    template< typename Derived >
+    Eigen::Matrix< typename Derived::Scalar, Eigen::Dynamic, 1 > getSelectedEntries(
+        const Eigen::MatrixBase< Derived >& fullVector ) const
+    {
+        checkInputSize( fullVector.rows( ) );
+
+        Eigen::Matrix< typename Derived::Scalar, Eigen::Dynamic, 1 > selectedEntries( selectedIndices_.size( ) );
+        for( unsigned int i = 0; i < selectedIndices_.size( ); i++ )
+        {
+            selectedEntries( i ) = fullVector( selectedIndices_.at( i ) );
+        }
+        return selectedEntries;
+    }
+
+    //! Function to retrieve the selected rows from a matrix ordered as the concatenated observation vector (e.g. design matrix)
+    /*!
+     * Function to retrieve the selected rows from a matrix ordered as the concatenated observation vector (e.g. design matrix)
+     * \param fullMatrix Matrix with number of rows equal to total observable size of collection
+     * \return Selected rows of fullMatrix
+     */
+    Eigen::MatrixXd getSelectedRows( const Eigen::MatrixXd& fullMatrix ) const
+    {
+        checkInputSize( fullMatrix.rows( ) );
+
+        Eigen::MatrixXd selectedRows( selectedIndices_.size( ), fullMatrix.cols( ) );
+        for( unsigned int i = 0; i < selectedIndices_.size( ); i++ )
+        {
+            selectedRows.row( i ) = fullMatrix.row( selectedIndices_.at( i ) );
+        }
+        return selectedRows;
+    }
+
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getObservationVector( ) const
+    {
+        return getSelectedEntries( observationCollection_->getObservationVectorReference( ) );
+    }
+
+    std::vector< TimeType > getConcatenatedTimeVector( ) const
+    {
+        const std::vector< TimeType >& concatenatedTimes = observationCollection_->getConcatenatedTimeVectorReference( );
+
+        std::vector< TimeType > selectedTimes;
+        selectedTimes.reserve( selectedIndices_.size( ) );
+        for( unsigned int i = 0; i < selectedIndices_.size( ); i++ )
+        {
+            selectedTimes.push_back( concatenatedTimes.at( selectedIndices_.at( i ) ) );
+        }
+        return selectedTimes;
+    }
+
+    //! Function to compute the residuals of the selected observations w.r.t. a collection of computed observations
+    /*!
+     * Function to compute the residuals of the selected observations w.r.t. a collection of computed observations, with
+     * the same structure as the viewed collection (only the selected entries are evaluated).
+     * \param computedData Collection of computed observations
+     * \return Residuals (observed minus computed) of selected observations
+     */
+    Eigen::VectorXd getResiduals(
+        const std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > computedData ) const
+    {
+        checkInputSize( computedData->getTotalObservableSize( ) );
+
+        const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& observedVector =
+            observationCollection_->getObservationVectorReference( );
+        const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& computedVector =
+            computedData->getObservationVectorReference( );
+
+        Eigen::VectorXd residuals( selectedIndices_.size( ) );
+        for( unsigned int i = 0; i < selectedIndices_.size( ); i++ )
+        {
+            residuals( i ) = static_cast< double >(
+                observedVector( selectedIndices_.at( i ) ) - computedVector( selectedIndices_.at( i ) ) );
+        }
+        return residuals;
+    }
+
+    //! Function to compute the weighted residuals of the selected observations
+    /*!
+     * Function to compute the weighted residuals of the selected observations
+     * \param computedData Collection of computed observations
+     * \param weights Observation weights, ordered as the concatenated observation vector of the full collection
+     * \return Residuals (observed minus computed) of selected observations, multiplied by associated weights
+     */
+    Eigen::VectorXd getWeightedResiduals(
+        const std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > computedData,
+        const Eigen::VectorXd& weights ) const
+    {
+        return getResiduals( computedData ).cwiseProduct( getSelectedEntries( weights ) );
+    }
+
+    //! Function to create a view with only the selected observations of a given type
+    ObservationCollectionView< ObservationScalarType, TimeType > selectObservableType(
+        const ObservableType observableType ) const
+    {
+        std::map< ObservableType, std::pair< int, int > > typeStartAndSize =
+            observationCollection_->getObservationTypeStartAndSize( );
+        if( typeStartAndSize.count( observableType ) == 0 )
+        {
+            return ObservationCollectionView< ObservationScalarType, TimeType >( observationCollection_, std::vector< int >( ) );
+        }
+        return selectIndexRange( typeStartAndSize.at( observableType ).first, typeStartAndSize.at( observableType ).second );
+    }
+
+    //! Function to create a view with only the selected observations of a given type and link ends
+    ObservationCollectionView< ObservationScalarType, TimeType > selectLinkEnds(
+        const ObservableType observableType,
+        const LinkEnds& linkEnds ) const
+    {
+        std::map< ObservableType, std::map< LinkEnds, std::pair< int, int > > > typeAndLinkEndStartAndSize =
+            observationCollection_->getObservationTypeAndLinkEndStartAndSize( );
+        if( typeAndLinkEndStartAndSize.count( observableType ) == 0 ||
+            typeAndLinkEndStartAndSize.at( observableType ).count( linkEnds ) == 0 )
+        {
+            return ObservationCollectionView< ObservationScalarType, TimeType >( observationCollection_, std::vector< int >( ) );
+        }
+        std::pair< int, int > startAndSize = typeAndLinkEndStartAndSize.at( observableType ).at( linkEnds );
+        return selectIndexRange( startAndSize.first, startAndSize.second );
+    }
+
+    //! Function to create a view with only the selected observations in a given time interval (bounds included)
+    ObservationCollectionView< ObservationScalarType, TimeType > selectTimeInterval(
+        const TimeType startTime,
+        const TimeType endTime ) const
+    {
+        const std::vector< TimeType >& concatenatedTimes = observationCollection_->getConcatenatedTimeVectorReference( );
+
+        std::vector< int > newIndices;
+        for( unsigned int i = 0; i < selectedIndices_.size( ); i++ )
+        {
+            TimeType currentTime = concatenatedTimes.at( selectedIndices_.at( i ) );
+            if( !( currentTime < startTime ) && !( endTime < currentTime ) )
+            {
+                newIndices.push_back( selectedIndices_.at( i ) );
+            }
+        }
+        return ObservationCollectionView< ObservationScalarType, TimeType >( observationCollection_, newIndices );
+    }
+
+    //! Function to create a view from which observations with large residuals are removed
+    /*!
+     * Function to create a view from which observations with large residuals are removed. An observation is removed if the
+     * absolute residual of any of its entries exceeds the cutoff value for its observable type.
+     * \param residualVector Residuals, ordered as the concatenated observation vector of the full collection
+     * \param residualCutoffValuePerObservable Residual cutoff value per observable type (types that are not provided
+     * are not filtered)
+     * \return View with observations retained by filter
+     */
+    ObservationCollectionView< ObservationScalarType, TimeType > removeResidualOutliers(
+        const Eigen::VectorXd& residualVector,
+        const std::map< ObservableType, double >& residualCutoffValuePerObservable ) const
+    {
+        checkInputSize( residualVector.rows( ) );
+
+        std::vector< int > newIndices;
+        newIndices.reserve( selectedIndices_.size( ) );
+
+        unsigned int currentIndex = 0;
+        while( currentIndex < selectedIndices_.size( ) )
+        {
+            // Retrieve all selected entries of current observation
+            std::pair< int, int > observationStartAndSize = getObservationStartAndSize( selectedIndices_.at( currentIndex ) );
+            unsigned int observationEndIndex = currentIndex;
+            while( observationEndIndex < selectedIndices_.size( ) &&
+                   selectedIndices_.at( observationEndIndex ) < observationStartAndSize.first + observationStartAndSize.second )
+            {
+                observationEndIndex++;
+            }
+
+            bool removeObservation = false;
+            ObservableType currentObservableType = getObservableTypeOfEntry( selectedIndices_.at( currentIndex ) );
+            if( residualCutoffValuePerObservable.count( currentObservableType ) != 0 )
+            {
+                double filterValue = residualCutoffValuePerObservable.at( currentObservableType );
+                for( int j = 0; j < observationStartAndSize.second; j++ )
+                {
+                    if( std::fabs( residualVector( observationStartAndSize.first + j ) ) > filterValue )
+                    {
+                        removeObservation = true;
+                    }
+                }
+            }
+
+            if( !removeObservation )
+            {
+                newIndices.insert( newIndices.end( ), selectedIndices_.begin( ) + currentIndex,
+                                   selectedIndices_.begin( ) + observationEndIndex );
+            }
+            currentIndex = observationEndIndex;
+        }
+        return ObservationCollectionView< ObservationScalarType, TimeType >( observationCollection_, newIndices );
+    }
+
+    //! Function to split the selected observations into arcs
+    /*!
+     * Function to split the selected observations into arcs. Each single observation set is split where the time
+     * between two subsequent selected observations exceeds arcSplitInterval. Arcs with a number of observations that
+     * is equal to or smaller than minimumNumberOfObservations are discarded (as in splitObservationSetsIntoArcs).
+     * \param arcSplitInterval Minimum time between two observations for which a new arc is started
+     * \param minimumNumberOfObservations Number of observations that an arc must exceed to be retained
+     * \return List of views, one per arc
+     */
+    std::vector< ObservationCollectionView< ObservationScalarType, TimeType > > splitIntoArcs(
+        const double arcSplitInterval,
+        const int minimumNumberOfObservations ) const
+    {
+        const std::vector< TimeType >& concatenatedTimes = observationCollection_->getConcatenatedTimeVectorReference( );
+
+        std::vector< ObservationCollectionView< ObservationScalarType, TimeType > > arcViews;
+        std::vector< int > currentArcIndices;
+        int currentNumberOfObservations = 0;
+        int currentSetIndex = -1;
+        int previousObservationStart = -1;
+
+        auto finalizeArc = [ & ]( )
+        {
+            if( currentNumberOfObservations > minimumNumberOfObservations )
+            {
+                arcViews.push_back( ObservationCollectionView< ObservationScalarType, TimeType >(
+                                        observationCollection_, currentArcIndices ) );
+            }
+            currentArcIndices.clear( );
+            currentNumberOfObservations = 0;
+        };
+
+        for( unsigned int i = 0; i < selectedIndices_.size( ); i++ )
+        {
+            int currentEntry = selectedIndices_.at( i );
+            std::pair< int, int > observationStartAndSize = getObservationStartAndSize( currentEntry );
+
+            // Check if a new observation is reached, and if it starts a new arc
+            if( observationStartAndSize.first != previousObservationStart )
+            {
+                int setIndex = getObservationSetIndex( currentEntry );
+                if( setIndex != currentSetIndex ||
+                    ( static_cast< double >( concatenatedTimes.at( currentEntry ) -
+                                             concatenatedTimes.at( previousObservationStart ) ) > arcSplitInterval ) )
+                {
+                    finalizeArc( );
+                    currentSetIndex = setIndex;
+                }
+                currentNumberOfObservations++;
+                previousObservationStart = observationStartAndSize.first;
+            }
+            currentArcIndices.push_back( currentEntry );
+        }
+        finalizeArc( );
+
+        return arcViews;
+    }
+
+    //! Function to create a new ObservationCollection containing only the selected observations
+    /*!
+     * Function to create a new ObservationCollection containing only the selected observations. Observation sets that are
+     * fully selected are shared with the viewed collection, all other sets are copied with only their selected
+     * observations. An exception is thrown if only part of the entries of an observation is selected.
+     * \return Collection with selected observations
+     */
+    std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > createObservationCollection( ) const
+    {
+        typename ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets selectedObservationSets;
+
+        for( auto observationIt : observationCollection_->getObservationsReference( ) )
+        {
+            int observableSize = getObservableSize( observationIt.first );
+            for( auto linkEndIt : observationIt.second )
+            {
+                for( unsigned int i = 0; i < linkEndIt.second.size( ); i++ )
+                {
+                    std::pair< int, int > startAndSize =
+                        observationCollection_->getObservationSetStartAndSizeReference( ).at( observationIt.first ).at( linkEndIt.first ).at( i );
+
+                    std::vector< int >::const_iterator setStart =
+                        std::lower_bound( selectedIndices_.begin( ), selectedIndices_.end( ), startAndSize.first );
+                    std::vector< int >::const_iterator setEnd =
+                        std::lower_bound( setStart, selectedIndices_.end( ), startAndSize.first + startAndSize.second );
+
+                    if( setEnd - setStart == startAndSize.second )
+                    {
+                        selectedObservationSets[ observationIt.first ][ linkEndIt.first ].push_back( linkEndIt.second.at( i ) );
+                    }
+                    else
+                    {
+                        std::vector< bool > isObservationSelected( startAndSize.second / observableSize, false );
+                        std::vector< int > numberOfSelectedEntries( startAndSize.second / observableSize, 0 );
+                        for( std::vector< int >::const_iterator indexIt = setStart; indexIt != setEnd; indexIt++ )
+                        {
+                            int observationIndex = ( *indexIt - startAndSize.first ) / observableSize;
+                            isObservationSelected.at( observationIndex ) = true;
+                            numberOfSelectedEntries.at( observationIndex )++;
+                        }
+
+                        std::vector< int > indicesToRemove;
+                        for( unsigned int j = 0; j < isObservationSelected.size( ); j++ )
+                        {
+                            if( !isObservationSelected.at( j ) )
+                            {
+                                indicesToRemove.push_back( j );
+                            }
+                            else if( numberOfSelectedEntries.at( j ) != observableSize )
+                            {
+                                throw std::runtime_error( "Error when creating observation collection from view, observation is only partially selected" );
+                            }
+                        }
+                        selectedObservationSets[ observationIt.first ][ linkEndIt.first ].push_back(
+                            linkEndIt.second.at( i )->createFilteredObservationSet( indicesToRemove ) );
+                    }
+                }
+            }
+        }
+        return std::make_shared< ObservationCollection< ObservationScalarType, TimeType > >( selectedObservationSets );
+    }
+
+private:
+
+    //! Function to check whether the size of an input vector/matrix is consistent with the viewed collection
+    void checkInputSize( const int inputSize ) const
+    {
+        if( inputSize != observationCollection_->getTotalObservableSize( ) )
+        {
+            throw std::runtime_error( "Error when using observation collection view, input size " + std::to_string( inputSize ) +
+                                      " is incompatible with collection size " +
+                                      std::to_string( observationCollection_->getTotalObservableSize( ) ) );
+        }
+    }
+
+    //! Function to create a view with the selected entries in a given index range of the concatenated observation vector
+    ObservationCollectionView< ObservationScalarType, TimeType > selectIndexRange(
+        const int startIndex, const int size ) const
+    {
+        return ObservationCollectionView< ObservationScalarType, TimeType >(
+            observationCollection_, std::vector< int >(
+                std::lower_bound( selectedIndices_.begin( ), selectedIndices_.end( ), startIndex ),
+                std::lower_bound( selectedIndices_.begin( ), selectedIndices_.end( ), startIndex + size ) ) );
+    }
+
+    //! Function to set the ranges of the concatenated observation vector occupied by each observable type
+    void setObservableTypeRanges( )
+    {
+        for( auto typeIt : observationCollection_->getObservationTypeStartAndSize( ) )
+        {
+            observableTypes_.push_back( typeIt.first );
+            observableTypeStartAndSize_.push_back( typeIt.second );
+        }
+    }
+
+    //! Function to retrieve the index (in observableTypes_) of the observable type of a given entry
+    int getObservableTypeIndexOfEntry( const int index ) const
+    {
+        for( unsigned int i = 0; i < observableTypes_.size( ); i++ )
+        {
+            if( index >= observableTypeStartAndSize_.at( i ).first &&
+                index < observableTypeStartAndSize_.at( i ).first + observableTypeStartAndSize_.at( i ).second )
+            {
+                return i;
+            }
+        }
+        throw std::runtime_error( "Error in observation collection view, could not find observable type of entry " + std::to_string( index ) );
+    }
+
+    //! Function to retrieve the observable type of a given entry in the concatenated observation vector
+    ObservableType getObservableTypeOfEntry( const int index ) const
+    {
+        return observableTypes_.at( getObservableTypeIndexOfEntry( index ) );
+    }
+
+    //! Function to retrieve the index of the single observation set to which a given entry belongs
+    int getObservationSetIndex( const int index ) const
+    {
+        const std::vector< std::pair< int, int > >& setStartAndSize =
+            observationCollection_->getConcatenatedObservationSetStartAndSizeReference( );
+        // Find last set starting at or before index (which is never an empty set, since these share their start index
+        // with the next set)
+        auto setIterator = std::upper_bound(
+            setStartAndSize.begin( ), setStartAndSize.end( ), index,
+            [ ]( const int value, const std::pair< int, int >& startAndSize ){ return value < startAndSize.first; } );
+        return ( setIterator - setStartAndSize.begin( ) ) - 1;
+    }
+
+    //! Function to retrieve the start index and size of the observation to which a given entry belongs
+    std::pair< int, int > getObservationStartAndSize( const int index ) const
+    {
+        int typeIndex = getObservableTypeIndexOfEntry( index );
+        int observableSize = getObservableSize( observableTypes_.at( typeIndex ) );
+        int typeStartIndex = observableTypeStartAndSize_.at( typeIndex ).first;
+        return std::make_pair( typeStartIndex + ( ( index - typeStartIndex ) / observableSize ) * observableSize, observableSize );
+    }
+
+    //! Collection that is viewed
+    std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > observationCollection_;
+
+    //! Indices in concatenated observation vector of collection that are selected (in ascending order)
+    std::vector< int > selectedIndices_;
+
+    //! Observable types in collection
+    std::vector< ObservableType > observableTypes_;
+
+    //! Start index and size in concatenated observation vector of each entry of observableTypes_
+    std::vector< std::pair< int, int > > observableTypeStartAndSize_;
+};
+
 
 template< typename ObservationScalarType = double, typename TimeType = double,
     typename std::enable_if< is_state_scalar_and_time_type< ObservationScalarType, TimeType >::value, int >::type = 0 >
@@ -760,7 +1342,7 @@ std::vector< std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeT
     const int minimumNumberOfObservations )
 {
     std::vector< int > rawArcStartIndices = { 0 };
-    const std::vector< TimeType > originalObservationTimes = originalObservationSet->getObservationTimesReference( );
+    const std::vector< TimeType >& originalObservationTimes = originalObservationSet->getObservationTimesReference( );
     for( unsigned int i = 1; i < originalObservationTimes.size( ); i++ )
     {
         if( ( originalObservationTimes.at( i ) - originalObservationTimes.at( i - 1 ) ) > arcSplitInterval )
@@ -783,24 +1365,8 @@ std::vector< std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeT
     std::vector< std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > > splitSingleObervationSet;
     for( unsigned int i = 0; i < arcSplitIndices.size( ); i++ )
     {
-        std::vector< Eigen::VectorXd > currentSplitDependentVariables;
-        if( originalObservationSet->getObservationsDependentVariablesReference( ).size( ) > 0 )
-        {
-            currentSplitDependentVariables =
-                utilities::getStlVectorSegment( originalObservationSet->getObservationsDependentVariablesReference( ),
-                                  arcSplitIndices.at( i ).first, arcSplitIndices.at( i ).second );
-        }
-
         splitSingleObervationSet.push_back(
-            std::make_shared< SingleObservationSet< ObservationScalarType, TimeType > >(
-                originalObservationSet->getObservableType( ),
-                originalObservationSet->getLinkEnds( ),
-                utilities::getStlVectorSegment( originalObservationSet->getObservationsReference( ), arcSplitIndices.at( i ).first, arcSplitIndices.at( i ).second ),
-                utilities::getStlVectorSegment( originalObservationSet->getObservationTimesReference( ), arcSplitIndices.at( i ).first, arcSplitIndices.at( i ).second ),
-                originalObservationSet->getReferenceLinkEnd( ),
-                currentSplitDependentVariables,
-                originalObservationSet->getDependentVariableCalculator( ),
-                originalObservationSet->getAncilliarySettings( ) ) );
+            originalObservationSet->createObservationSubset( arcSplitIndices.at( i ).first, arcSplitIndices.at( i ).second ) );
     }
     return splitSingleObervationSet;
 }
@@ -1015,8 +1581,8 @@ std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > >  cre
     const std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > computedData )
 {
 //    std::map< ObservableType, std::map< LinkEnds, std::vector< std::shared_ptr< SingleObservationSet< ObservationScalarType, TimeType > > > > >
-    typename ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets observedObservationSets = observedData->getObservations( );
-    typename ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets computedObservationSets = computedData->getObservations( );
+    const typename ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets& observedObservationSets = observedData->getObservationsReference( );
+    const typename ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets& computedObservationSets = computedData->getObservationsReference( );
     typename ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets residualObservationSets;
 
     for( auto observationIt : observedObservationSets )
@@ -1047,7 +1613,7 @@ std::map< observation_models::ObservableType, std::vector< std::pair< LinkEnds,
     }
 
     // Retrieve observations to filter
-    typename ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets observationSetsToFilter = dataToFiler->getObservations( );
+    const typename ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets& observationSetsToFilter = dataToFiler->getObservationsReference( );
 
     // Create data structure with filtered results
     std::map< observation_models::ObservableType, std::vector< std::pair< LinkEnds, std::vector< std::vector< int > > > > > filterEntries;
@@ -1076,7 +1642,8 @@ std::map< observation_models::ObservableType, std::vector< std::pair< LinkEnds,
                 // Get residuals for current set
                 std::pair< int, int > fullVectorStartAndSize =
                     dataToFiler->getObservationSetStartAndSizeReference( ).at( observableType ).at( linkEnds ).at( i );
-                Eigen::VectorXd currentSetResiduals = residualVector.segment( fullVectorStartAndSize.first, fullVectorStartAndSize.second );
+                Eigen::Ref< const Eigen::VectorXd > currentSetResiduals =
+                    residualVector.segment( fullVectorStartAndSize.first, fullVectorStartAndSize.second );
 
                 int currentObservableSize = getObservableSize( observableType );
 
@@ -1089,7 +1656,7 @@ std::map< observation_models::ObservableType, std::vector< std::pair< LinkEnds,
                 }
 
                 std::vector< int > indicesToRemove;
-                for( unsigned int j = 0; j < currentObservationSet->getObservationTimes( ).size( ); j++ )
+                for( int j = 0; j < currentObservationSet->getNumberOfObservables( ); j++ )
                 {
                     bool removeObservation = false;
                     for( int k = 0; k < currentObservableSize; k++ )
@@ -1191,9 +1758,9 @@ std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > filt
                     std::vector<int> indicesToRemove;
                     std::shared_ptr<SingleObservationSet<ObservationScalarType, TimeType> >
                         residualObservationSet = linkEndIt.second.at( i );
-                    for ( unsigned int j = 0; j < currentObservationSet->getObservationTimes( ).size( ); j++ )
+                    for ( int j = 0; j < currentObservationSet->getNumberOfObservables( ); j++ )
                     {
-                        if ( currentObservationSet->getObservation( j ).array( ).abs( ).maxCoeff( ) > filterValue )
+                        if ( currentObservationSet->getObservationsReference( ).col( j ).array( ).abs( ).maxCoeff( ) > filterValue )
                         {
                             indicesToRemove.push_back( j );
                         }
@@ -41,36 +41,36 @@ void calculateResiduals(
 {
     residuals = Eigen::VectorXd::Zero( observationsCollection->getTotalObservableSize( ) );
 
-    typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets
-        sortedObservations = observationsCollection->getObservations( );
+    const typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets&
+        sortedObservations = observationsCollection->getObservationsReference( );
 
     // Iterate over all observable types in observationsAndTimes
-    for( auto observablesIterator : sortedObservations )
+    for( const auto& observablesIterator : sortedObservations )
     {
         observation_models::ObservableType currentObservableType = observablesIterator.first;
 
         // Iterate over all link ends for current observable type in observationsAndTimes
-        for( auto dataIterator : observablesIterator.second )
+        for( const auto& dataIterator : observablesIterator.second )
         {
             observation_models::LinkEnds currentLinkEnds = dataIterator.first;
             for( unsigned int i = 0; i < dataIterator.second.size( ); i++ )
             {
                 std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
                     dataIterator.second.at( i );
-                std::pair< int, int > observationIndices = observationsCollection->getObservationSetStartAndSize( ).at(
+                std::pair< int, int > observationIndices = observationsCollection->getObservationSetStartAndSizeReference( ).at(
                     currentObservableType ).at( currentLinkEnds ).at( i );
 
                 // Compute estimated ranges and range partials from current parameter estimate.
                 Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > observationsVector;
                 observationSimulator.at( currentObservableType )->
                     computeObservations(
-                    currentObservations->getObservationTimes( ), currentLinkEnds,
+                    currentObservations->getObservationTimesReference( ), currentLinkEnds,
                     currentObservations->getReferenceLinkEnd( ),
                     currentObservations->getAncilliarySettings( ),
                     observationsVector );
 
                 residuals.segment( observationIndices.first, observationIndices.second ) =
-                        ( currentObservations->getObservationsVector( ) - observationsVector ).template cast< double >( );
+                        ( currentObservations->getObservationsVectorReference( ) - observationsVector ).template cast< double >( );
 
             }
         }
@@ -125,23 +125,23 @@ void calculateDesignMatrixAndResiduals(
         residuals = Eigen::VectorXd::Zero( totalObservationSize );
     }
 
-    typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets
-        sortedObservations = observationsCollection->getObservations( );
+    const typename observation_models::ObservationCollection< ObservationScalarType, TimeType >::SortedObservationSets&
+        sortedObservations = observationsCollection->getObservationsReference( );
 
     // Iterate over all observable types in observationsAndTimes
-    for( auto observablesIterator : sortedObservations )
+    for( const auto& observablesIterator : sortedObservations )
     {
         observation_models::ObservableType currentObservableType = observablesIterator.first;
 
         // Iterate over all link ends for current observable type in observationsAndTimes
-        for( auto dataIterator : observablesIterator.second )
+        for( const auto& dataIterator : observablesIterator.second )
         {
             observation_models::LinkEnds currentLinkEnds = dataIterator.first;
             for( unsigned int i = 0; i < dataIterator.second.size( ); i++ )
             {
                 std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType, TimeType > > currentObservations =
                     dataIterator.second.at( i );
-                std::pair< int, int > observationIndices = observationsCollection->getObservationSetStartAndSize( ).at(
+                std::pair< int, int > observationIndices = observationsCollection->getObservationSetStartAndSizeReference( ).at(
                     currentObservableType ).at( currentLinkEnds ).at( i );
 
 //                std::cout<<"Current size "<<currentObservations->getObservationTimes( ).size( )<<
@@ -153,7 +153,7 @@ void calculateDesignMatrixAndResiduals(
                     Eigen::MatrixXd partialsMatrix;
                     observationManagers.at( currentObservableType )->
                             computeObservationsWithPartials(
-                            currentObservations->getObservationTimes( ), currentLinkEnds,
+                            currentObservations->getObservationTimesReference( ), currentLinkEnds,
                             currentObservations->getReferenceLinkEnd( ),
                             currentObservations->getAncilliarySettings( ),
                             observationsVector,
@@ -176,7 +176,7 @@ void calculateDesignMatrixAndResiduals(
                     if( calculateResiduals )
                     {
                         residuals.segment( observationIndices.first, observationIndices.second ) =
-                            ( currentObservations->getObservationsVector( ) - observationsVector ).template cast< double >( );
+                            ( currentObservations->getObservationsVectorReference( ) - observationsVector ).template cast< double >( );
 
                     }
                 }
@@ -452,6 +452,35 @@ public:
         return observationSimulators;
     }
 
+    //! Function to retrieve the indices of the observations in each arc
+    /*!
+     *  Function to retrieve the indices of the observations (in the concatenated observation vector) in each arc, with an
+     *  observation belonging to the last arc that starts at or before the observation time. Observations before the first arc
+     *  start time are not assigned to any arc.
+     *  \param observationCollection Total data structure of observations and associated times/link ends/type
+     *  \param arcStartTimes Start times of the observation arcs (sorted in ascending order)
+     *  \return List of observation indices for each arc
+     */
+    std::vector< std::vector< int > > getArcObservationIndices(
+            const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > >& observationCollection,
+            const std::vector< double >& arcStartTimes )
+    {
+        const std::vector< TimeType >& observationTimes = observationCollection->getConcatenatedTimeVectorReference( );
+
+        std::vector< std::vector< int > > arcObservationIndices( arcStartTimes.size( ) );
+        for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+        {
+            int arcIndex = static_cast< int >( std::upper_bound(
+                        arcStartTimes.begin( ), arcStartTimes.end( ), static_cast< double >( observationTimes.at( i ) ) ) -
+                                               arcStartTimes.begin( ) ) - 1;
+            if( arcIndex >= 0 )
+            {
+                arcObservationIndices.at( arcIndex ).push_back( i );
+            }
+        }
+        return arcObservationIndices;
+    }
+
     Eigen::MatrixXd normalizeAprioriCovariance(
             const Eigen::MatrixXd& inverseAPrioriCovariance,
             const Eigen::VectorXd& normalizationValues )
@@ -798,11 +827,36 @@ public:
                 {
                     conditionNumberCheck = TUDAT_NAN;
                 }
-                // Perform LSQ inversion
-                leastSquaresOutput = std::move( linear_algebra::performLeastSquaresAdjustmentFromDesignMatrix(
-                        designMatrixEstimatedParameters, residuals, estimationInput->getWeightsMatrixDiagonals( ),
-                        normalizedInverseAprioriCovarianceMatrix, conditionNumberCheck, constraintStateMultiplier, constraintRightHandSide,
-                        designMatrixConsiderParameters, normalizedConsiderParametersDeviation ) );
+                // Perform LSQ inversion, eliminating arc-local parameters arc-by-arc or using tiled normal matrix if requested
+                if( estimationInput->getArcStartTimesForReducedNormalEquations( ).size( ) > 0 &&
+                        constraintStateMultiplier.rows( ) == 0 )
+                {
+                    std::vector< std::vector< int > > arcObservationIndices = getArcObservationIndices(
+                                estimationInput->getObservationCollection( ), estimationInput->getArcStartTimesForReducedNormalEquations( ) );
+                    leastSquaresOutput = std::move( linear_algebra::performArcwiseReducedLeastSquaresAdjustment(
+                            designMatrixEstimatedParameters, residuals, estimationInput->getWeightsMatrixDiagonals( ),
+                            normalizedInverseAprioriCovarianceMatrix, arcObservationIndices,
+                            linear_algebra::getArcLocalParameterIndices(
+                                designMatrixEstimatedParameters, arcObservationIndices, normalizedInverseAprioriCovarianceMatrix ),
+                            conditionNumberCheck, designMatrixConsiderParameters, normalizedConsiderParametersDeviation ) );
+                }
+                else if( estimationInput->getTileSizeForTiledNormalEquations( ) > 0 &&
+                         constraintStateMultiplier.rows( ) == 0 )
+                {
+                    leastSquaresOutput = std::move( linear_algebra::performTiledLeastSquaresAdjustment(
+                            designMatrixEstimatedParameters, residuals, estimationInput->getWeightsMatrixDiagonals( ),
+                            normalizedInverseAprioriCovarianceMatrix, estimationInput->getTileSizeForTiledNormalEquations( ),
+                            estimationInput->getStorageFileForTiledNormalEquations( ),
+                            estimationInput->getNumberOfThreadsForTiledNormalEquations( ),
+                            designMatrixConsiderParameters, normalizedConsiderParametersDeviation ) );
+                }
+                else
+                {
+                    leastSquaresOutput = std::move( linear_algebra::performLeastSquaresAdjustmentFromDesignMatrix(
+                            designMatrixEstimatedParameters, residuals, estimationInput->getWeightsMatrixDiagonals( ),
+                            normalizedInverseAprioriCovarianceMatrix, conditionNumberCheck, constraintStateMultiplier, constraintRightHandSide,
+                            designMatrixConsiderParameters, normalizedConsiderParametersDeviation ) );
+                }
 
                 if( constraintStateMultiplier.rows( ) > 0 )
                 {
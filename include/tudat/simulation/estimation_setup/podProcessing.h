@@ -254,43 +254,41 @@ std::pair< Eigen::MatrixXd, std::vector< TimeType > > getTimeOrderedDesignMatrix
     return std::make_pair( sortedMatrix, sortOutput.second );
 }
 
-//! Function to create a map of the estimation covariance as a function of time
+//! Function to compute the estimation covariance as a function of time, stored as a single concatenated matrix
 /*!
- *  Function to create a map of the estimation covariance as a function of time
+ *  Function to compute the estimation covariance as a function of time, using all observations up to (and including) each
+ *  of the output times. The inverse covariance (normal) matrix is accumulated incrementally: between two consecutive output
+ *  times, only the contribution of the newly included observations is added, as a (weighted) rank-k update. The covariance
+ *  at each output time is then obtained from a Cholesky decomposition of the normal matrix. As a result, the cost of
+ *  computing the full time history is comparable to that of computing the covariance of the full data set.
  *  \param measurementData Data structure containing all observable values, as well as associated times and reference link ends
  *  \param typeAndLinkSortedNormalizedDesignMatrix Information matrix, normalized by the normalizationFactors, and
  *  sorted as in the normalizationFactors: first by observable type, then by link ends
  *  \param normalizationFactors Values by which the parameters (and partials) have been normalized, in order to stabilize
  *  the solution of the normal equations
- *  \param outputTimes Times at which the covariance is to be computed for the output map
+ *  \param outputTimes Times at which the covariance is to be computed (need not be sorted)
  *  \param diagonalOfWeightMatrix Vector containing the diagonal of the weights matrix used in the estimation
  *  \param unnormalizedInverseAPrioriCovariance Inverse a priori covariance matrix, with parameters not normalized by
  *  normalizationFactors
- *  \return Covariance (map values) as a function of time (map keys) for the given estimation input settings and output times.
+ *  \param covarianceHistory Covariance matrices at the output times, in ascending order of time, concatenated column-wise
+ *  into a single matrix of size P x (P x N), with P the number of parameters and N the number of output times
+ *  (returned by reference)
+ *  \return Output times, sorted in ascending order, corresponding to the blocks of covarianceHistory
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
-std::map< TimeType, Eigen::MatrixXd > calculateCovarianceUsingDataUpToEpoch(
+std::vector< double > calculateCovarianceHistoryUsingDataUpToEpoch(
         const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > measurementData,
         const Eigen::MatrixXd& typeAndLinkSortedNormalizedDesignMatrix,
         const Eigen::VectorXd& normalizationFactors,
         const std::vector< double >& outputTimes,
         const Eigen::VectorXd& diagonalOfWeightMatrix,
-        const Eigen::MatrixXd& unnormalizedInverseAPrioriCovariance )
+        const Eigen::MatrixXd& unnormalizedInverseAPrioriCovariance,
+        Eigen::MatrixXd& covarianceHistory )
 {
     int totalNumberOfParameters = unnormalizedInverseAPrioriCovariance.cols( );
 
-    Eigen::MatrixXd normalizedInverseAPrioriCovariance = Eigen::MatrixXd(  totalNumberOfParameters, totalNumberOfParameters );
-    for( int j = 0; j < totalNumberOfParameters; j++ )
-    {
-        for( int k = 0; k < totalNumberOfParameters; k++ )
-        {
-            normalizedInverseAPrioriCovariance( j, k ) = unnormalizedInverseAPrioriCovariance( j, k ) /
-                    ( normalizationFactors( j ) * normalizationFactors( k ) );
-        }
-    }
-
     // Check consistency of input data
-    if( normalizedInverseAPrioriCovariance.cols( ) != normalizedInverseAPrioriCovariance.rows( ) )
+    if( unnormalizedInverseAPrioriCovariance.cols( ) != unnormalizedInverseAPrioriCovariance.rows( ) )
     {
         throw std::runtime_error( "Error when calculating covariance as function of time, a priori covariance is not square" );
     }
@@ -311,79 +309,119 @@ std::map< TimeType, Eigen::MatrixXd > calculateCovarianceUsingDataUpToEpoch(
         throw std::runtime_error(
                     "Error when calculating covariance as function of time, weights are inconsistent with partials" );
     }
+    if( diagonalOfWeightMatrix.size( ) > 0 && diagonalOfWeightMatrix.minCoeff( ) < 0.0 )
+    {
+        throw std::runtime_error(
+                    "Error when calculating covariance as function of time, weights must be non-negative" );
+    }
 
-    // Order information matrix by time of observations
+    // Retrieve order of observations in time (design matrix is not reordered, rows are accessed through this order)
     std::vector< int > timeOrder;
-    std::pair< Eigen::MatrixXd, std::vector< TimeType > > timeOrderedMatrixOutput =
-            getTimeOrderedDesignMatrix< ObservationScalarType, TimeType >(
-                measurementData, typeAndLinkSortedNormalizedDesignMatrix, timeOrder );
-    std::vector< TimeType > orderedTimeVector = timeOrderedMatrixOutput.second;
-
-    Eigen::VectorXd timeOrderedDiagonalOfWeightMatrix = Eigen::VectorXd::Zero( diagonalOfWeightMatrix.rows( ) );
-    for( unsigned int i = 0; i < timeOrder.size( ); i++ )
+    std::vector< TimeType > orderedTimeVector;
+    std::tie( timeOrder, orderedTimeVector ) =
+            utilities::getSortOrderOfVectorAndSortedVector( measurementData->getConcatenatedTimeVector( ) );
+    if( static_cast< int >( timeOrder.size( ) ) != typeAndLinkSortedNormalizedDesignMatrix.rows( ) )
     {
-        timeOrderedDiagonalOfWeightMatrix( i ) = diagonalOfWeightMatrix( timeOrder.at( i ) );
+        throw std::runtime_error( "Error when sorting information matrix by time, sizes incompatible" );
     }
 
-    // Create lookupn scheme for time value
-    interpolators::BinarySearchLookupScheme< TimeType > timeLookup =
-            interpolators::BinarySearchLookupScheme< TimeType >( orderedTimeVector );
+    // Create normalized inverse a priori covariance, which is the initial normal matrix
+    Eigen::MatrixXd normalizationMatrix = normalizationFactors * normalizationFactors.transpose( );
+    Eigen::MatrixXd normalMatrix = unnormalizedInverseAPrioriCovariance.cwiseQuotient( normalizationMatrix );
 
-    // Declare return map.
-    std::map< TimeType, Eigen::MatrixXd > covarianceMatrixHistory;
+    // Sort output times
+    std::vector< double > sortedOutputTimes = outputTimes;
+    std::sort( sortedOutputTimes.begin( ), sortedOutputTimes.end( ) );
 
-    // Initialize loop variables.
-    TimeType currentTime = orderedTimeVector[ 0 ];
-    unsigned int currentIndex;
-    Eigen::MatrixXd currentInverseNormalizedCovarianceMatrix;
+    // Allocate output and workspace
+    const int maximumUpdateBlockSize = 1024;
+    covarianceHistory.setZero( totalNumberOfParameters, totalNumberOfParameters * sortedOutputTimes.size( ) );
+    Eigen::MatrixXd weightedPartialsBlock = Eigen::MatrixXd::Zero(
+                totalNumberOfParameters, std::min< int >( maximumUpdateBlockSize, timeOrder.size( ) ) );
+    Eigen::LLT< Eigen::MatrixXd, Eigen::Lower > normalMatrixDecomposition( totalNumberOfParameters );
+    Eigen::MatrixXd identityMatrix = Eigen::MatrixXd::Identity( totalNumberOfParameters, totalNumberOfParameters );
 
-    // Loop over matrix at given time interval.
-    for( unsigned int i = 0; i < outputTimes.size( ); i++ )
+    unsigned int numberOfProcessedObservations = 0;
+    for( unsigned int i = 0; i < sortedOutputTimes.size( ); i++ )
     {
-        // Increment time (no covariance computed for t=t0)
-        currentTime = outputTimes.at( i );
-
-        // Find index in list of times.
-        currentIndex = timeLookup.findNearestLowerNeighbour( currentTime );
+        // Find number of observations up to and including the current output time
+        unsigned int numberOfObservationsToProcess = static_cast< unsigned int >(
+                    std::upper_bound( orderedTimeVector.begin( ), orderedTimeVector.end( ),
+                                      static_cast< TimeType >( sortedOutputTimes.at( i ) ) ) - orderedTimeVector.begin( ) );
 
-        if( currentIndex != orderedTimeVector.size( ) - 1 )
+        // Add contribution of new observations to (lower triangle of) normal matrix, in blocks of rows
+        while( numberOfProcessedObservations < numberOfObservationsToProcess )
         {
-            while( orderedTimeVector.at( currentIndex) == orderedTimeVector.at( currentIndex + 1 ) )
+            int currentBlockSize = std::min< int >(
+                        maximumUpdateBlockSize, numberOfObservationsToProcess - numberOfProcessedObservations );
+            for( int j = 0; j < currentBlockSize; j++ )
             {
-                currentIndex++;
-                if( currentIndex == orderedTimeVector.size( ) - 1 )
-                {
-                    break;
-                }
+                int currentRow = timeOrder.at( numberOfProcessedObservations + j );
+                weightedPartialsBlock.col( j ) = std::sqrt( diagonalOfWeightMatrix( currentRow ) ) *
+                        typeAndLinkSortedNormalizedDesignMatrix.row( currentRow ).transpose( );
             }
+            normalMatrix.selfadjointView< Eigen::Lower >( ).rankUpdate(
+                        weightedPartialsBlock.leftCols( currentBlockSize ) );
+            numberOfProcessedObservations += currentBlockSize;
         }
 
-        if( orderedTimeVector.size( ) <= currentIndex )
+        // Compute (unnormalized) covariance
+        Eigen::Block< Eigen::MatrixXd > currentCovariance = covarianceHistory.block(
+                    0, i * totalNumberOfParameters, totalNumberOfParameters, totalNumberOfParameters );
+        normalMatrixDecomposition.compute( normalMatrix );
+        if( normalMatrixDecomposition.info( ) == Eigen::Success )
         {
-            throw std::runtime_error( "Error when getting covariance as a function of time, output time not found" );
+            currentCovariance = normalMatrixDecomposition.solve( identityMatrix );
         }
-
-        // Create information matrix up to current time.
-        Eigen::MatrixXd currentDesignMatrix = timeOrderedMatrixOutput.first.block(
-                    0, 0, currentIndex + 1, timeOrderedMatrixOutput.first.cols( ) );
-
-        // Create inverse of covariance matrix
-        currentInverseNormalizedCovarianceMatrix = linear_algebra::calculateInverseOfUpdatedCovarianceMatrix(
-                    currentDesignMatrix, timeOrderedDiagonalOfWeightMatrix.segment( 0, currentIndex + 1 ), normalizedInverseAPrioriCovariance );
-        Eigen::MatrixXd covarianceMatrix = currentInverseNormalizedCovarianceMatrix.inverse( );
-
-        for( int i = 0; i < covarianceMatrix.rows( ); i++ )
+        else
         {
-            for( int j = 0; j < covarianceMatrix.rows( ); j++ )
-            {
-                covarianceMatrix( i, j ) /= normalizationFactors( i ) * normalizationFactors( j );
-            }
+            // Normal matrix is not positive definite (e.g. no or insufficient data before output time); use general inverse
+            Eigen::MatrixXd fullNormalMatrix = normalMatrix.selfadjointView< Eigen::Lower >( );
+            currentCovariance = fullNormalMatrix.inverse( );
         }
-
-        covarianceMatrixHistory[ currentTime ] = covarianceMatrix;
+        currentCovariance.array( ) /= normalizationMatrix.array( );
     }
 
+    return sortedOutputTimes;
+}
 
+//! Function to create a map of the estimation covariance as a function of time
+/*!
+ *  Function to create a map of the estimation covariance as a function of time, using all observations up to (and including)
+ *  each of the output times (see calculateCovarianceHistoryUsingDataUpToEpoch).
+ *  \param measurementData Data structure containing all observable values, as well as associated times and reference link ends
+ *  \param typeAndLinkSortedNormalizedDesignMatrix Information matrix, normalized by the normalizationFactors, and
+ *  sorted as in the normalizationFactors: first by observable type, then by link ends
+ *  \param normalizationFactors Values by which the parameters (and partials) have been normalized, in order to stabilize
+ *  the solution of the normal equations
+ *  \param outputTimes Times at which the covariance is to be computed for the output map
+ *  \param diagonalOfWeightMatrix Vector containing the diagonal of the weights matrix used in the estimation
+ *  \param unnormalizedInverseAPrioriCovariance Inverse a priori covariance matrix, with parameters not normalized by
+ *  normalizationFactors
+ *  \return Covariance (map values) as a function of time (map keys) for the given estimation input settings and output times.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::map< TimeType, Eigen::MatrixXd > calculateCovarianceUsingDataUpToEpoch(
+        const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > > measurementData,
+        const Eigen::MatrixXd& typeAndLinkSortedNormalizedDesignMatrix,
+        const Eigen::VectorXd& normalizationFactors,
+        const std::vector< double >& outputTimes,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& unnormalizedInverseAPrioriCovariance )
+{
+    Eigen::MatrixXd covarianceHistory;
+    std::vector< double > sortedOutputTimes = calculateCovarianceHistoryUsingDataUpToEpoch< ObservationScalarType, TimeType >(
+                measurementData, typeAndLinkSortedNormalizedDesignMatrix, normalizationFactors, outputTimes,
+                diagonalOfWeightMatrix, unnormalizedInverseAPrioriCovariance, covarianceHistory );
+
+    // Split concatenated covariances into map
+    int numberOfParameters = covarianceHistory.rows( );
+    std::map< TimeType, Eigen::MatrixXd > covarianceMatrixHistory;
+    for( unsigned int i = 0; i < sortedOutputTimes.size( ); i++ )
+    {
+        covarianceMatrixHistory[ sortedOutputTimes.at( i ) ] = covarianceHistory.block(
+                    0, i * numberOfParameters, numberOfParameters, numberOfParameters );
+    }
     return covarianceMatrixHistory;
 }
 
@@ -740,8 +740,8 @@ std::shared_ptr< observation_models::SingleObservationSet< ObservationScalarType
         std::make_shared< ObservationAncilliarySimulationSettings >( *(originalDopplerData->getAncilliarySettings( ) ) );
     newAncilliarySettings->setAncilliaryDoubleData( doppler_integration_time, newCompressionTime );
 
-    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > originalObservations = originalDopplerData->getObservationsReference( );
-    std::vector< TimeType > originalObservationTimes = originalDopplerData->getObservationTimesReference( );
+    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > originalObservations = originalDopplerData->getObservations( );
+    const std::vector< TimeType >& originalObservationTimes = originalDopplerData->getObservationTimesReference( );
 
     std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > compressedObservations;
     std::vector< TimeType > compressedObservationTimes;
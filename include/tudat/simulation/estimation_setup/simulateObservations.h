@@ -303,32 +303,69 @@ simulatePerArcSingleObservationSet(
     std::vector< TimeType > observationTimes;
     std::vector< Eigen::VectorXd > observationsDependentVariables;
 
-    Eigen::VectorXd currentDependentVariable;
+    // Retrieve viable observations, and link end data needed for dependent variables
+    std::shared_ptr< ObservationDependentVariableCalculator > dependentVariableCalculator =
+            observationsToSimulate->getDependentVariableCalculator( );
+    std::vector< std::vector< Eigen::Vector6d > > observationsLinkEndStates;
+    std::vector< std::vector< double > > observationsLinkEndTimes;
     for( unsigned int i = 0; i < simulatedObservations.size( ); i++ )
     {
-        for( auto it : simulatedObservations.at( i ) )
+        for( auto& it : simulatedObservations.at( i ) )
         {
-            SingleObservationData singleObservation = it.second;
-            currentObservation = std::get< 0 >( singleObservation );
-            vectorOfStates = std::get< 1 >( singleObservation );
-            vectorOfTimes = std::get< 2 >( singleObservation );
-            currentDependentVariable = Eigen::VectorXd::Zero( 0 );
-
-            observationFeasible = isObservationViable( vectorOfStates, vectorOfTimes, additionalViabilityCalculators );
+            SingleObservationData& singleObservation = it.second;
+            observationFeasible = isObservationViable(
+                        std::get< 1 >( singleObservation ), std::get< 2 >( singleObservation ), additionalViabilityCalculators );
             if( observationFeasible )
             {
-                addNoiseAndDependentVariableToObservation< ObservationSize , ObservationScalarType, TimeType >(
-                            currentObservation, it.first, currentDependentVariable, vectorOfStates, vectorOfTimes, ancilliarySettings,
-                            observationModel->getObservableType( ),
-                            observationsToSimulate->getObservationNoiseFunction( ),
-                            observationsToSimulate->getDependentVariableCalculator( ) );
-                observations.push_back( currentObservation );
+                observations.push_back( std::get< 0 >( singleObservation ) );
                 observationTimes.push_back( it.first );
-                observationsDependentVariables.push_back( currentDependentVariable );
+                if( dependentVariableCalculator != nullptr )
+                {
+                    observationsLinkEndStates.push_back( std::move( std::get< 1 >( singleObservation ) ) );
+                    observationsLinkEndTimes.push_back( std::move( std::get< 2 >( singleObservation ) ) );
+                }
             }
         }
     }
 
+    // Compute dependent variables for all observations in a single batch (before adding noise)
+    if( dependentVariableCalculator != nullptr && observations.size( ) > 0 )
+    {
+        Eigen::MatrixXd observationMatrix = Eigen::MatrixXd( observations.at( 0 ).rows( ), observations.size( ) );
+        for( unsigned int i = 0; i < observations.size( ); i++ )
+        {
+            observationMatrix.col( i ) = observations.at( i ).template cast< double >( );
+        }
+
+        Eigen::MatrixXd dependentVariableMatrix;
+        dependentVariableCalculator->calculateDependentVariables(
+                    dependentVariableMatrix, observationsLinkEndTimes, observationsLinkEndStates, observationMatrix,
+                    ancilliarySettings );
+        for( unsigned int i = 0; i < observations.size( ); i++ )
+        {
+            observationsDependentVariables.push_back( dependentVariableMatrix.col( i ) );
+        }
+    }
+    else
+    {
+        observationsDependentVariables.resize( observations.size( ), Eigen::VectorXd::Zero( 0 ) );
+    }
+
+    // Add noise to observations
+    std::function< Eigen::VectorXd( const double ) > noiseFunction = observationsToSimulate->getObservationNoiseFunction( );
+    if( noiseFunction != nullptr )
+    {
+        Eigen::VectorXd currentDependentVariable;
+        for( unsigned int i = 0; i < observations.size( ); i++ )
+        {
+            currentObservation = observations.at( i );
+            addNoiseAndDependentVariableToObservation< ObservationSize , ObservationScalarType, TimeType >(
+                        currentObservation, observationTimes.at( i ), currentDependentVariable, vectorOfStates, vectorOfTimes,
+                        ancilliarySettings, observationModel->getObservableType( ), noiseFunction );
+            observations.at( i ) = currentObservation;
+        }
+    }
+
     return std::make_shared< observation_models::SingleObservationSet< ObservationScalarType, TimeType > >(
                 observationModel->getObservableType( ), observationModel->getLinkEnds( ),
                 observations, observationTimes, referenceLinkEnd, observationsDependentVariables,
@@ -209,6 +209,11 @@ inline std::shared_ptr< AccelerationSettings > ringAcceleration( )
     return std::make_shared< AccelerationSettings >( basic_astrodynamics::ring_gravity );
 }
 
+inline std::shared_ptr< AccelerationSettings > masconAcceleration( )
+{
+    return std::make_shared< AccelerationSettings >( basic_astrodynamics::mascon_gravity );
+}
+
 // Class to provide settings for typical relativistic corrections to the dynamics of an orbiter.
 /*
  *  Class to provide settings for typical relativistic corrections to the dynamics of an orbiter: the
@@ -352,6 +357,18 @@ inline std::shared_ptr< AccelerationSettings> yarkovskyAcceleration(
     return std::make_shared< YarkovskyAccelerationSettings >( yarkovskyParameter );
 }
 
+//! Function to create settings for the contribution of a body to the Einstein-Infeld-Hoffmann acceleration
+/*!
+ *  Function to create settings for the contribution of a body to the Einstein-Infeld-Hoffmann (EIH) acceleration of another
+ *  body. All EIH acceleration settings in a single acceleration settings map are combined into a single set of
+ *  mutually attracting bodies, which includes all bodies undergoing and all bodies exerting an EIH acceleration.
+ *  \return Settings for EIH acceleration
+ */
+inline std::shared_ptr< AccelerationSettings > einsteinInfeldHoffmannAcceleration( )
+{
+    return std::make_shared< AccelerationSettings >( basic_astrodynamics::einstein_infeld_hoffmann_acceleration );
+}
+
 // Interface class that allows single interpolator to be used for thrust direction and magnitude (which are separated in
 // thrust implementation)
 // TODO: not exposed
@@ -233,6 +233,24 @@ std::shared_ptr< gravitation::RingGravitationalAccelerationModel > createRingGra
         const std::string& nameOfBodyExertingAcceleration,
         const bool useCentralBodyFixedFrame);
 
+//! Function to create mascon gravity acceleration model.
+/*!
+ *  Function to create mascon gravity acceleration model from bodies exerting and
+ *  undergoing acceleration.
+ *  \param bodyUndergoingAcceleration Pointer to object of body that is being accelerated.
+ *  \param bodyExertingAcceleration Pointer to object of body that is exerting the mascon gravity acceleration.
+ *  \param nameOfBodyUndergoingAcceleration Name of body that is being accelerated.
+ *  \param nameOfBodyExertingAcceleration Name of body that is exerting the mascon gravity acceleration.
+ *  \param useCentralBodyFixedFrame Boolean denoting whether the mutual attraction of the two bodies is included.
+ *  \return Mascon gravity acceleration model pointer.
+ */
+std::shared_ptr< gravitation::MasconGravitationalAccelerationModel > createMasconGravityAcceleration(
+        const std::shared_ptr< Body > bodyUndergoingAcceleration,
+        const std::shared_ptr< Body > bodyExertingAcceleration,
+        const std::string& nameOfBodyUndergoingAcceleration,
+        const std::string& nameOfBodyExertingAcceleration,
+        const bool useCentralBodyFixedFrame);
+
 //! Function to create a third body central gravity acceleration model.
 /*!
  *  Function to create a third body central gravity acceleration model from bodies exerting and
@@ -507,6 +525,19 @@ std::shared_ptr< electromagnetism::YarkovskyAcceleration > createYarkovskyAccele
         const std::string& nameOfBodyExertingAcceleration,
         const std::shared_ptr< AccelerationSettings > accelerationSettings );
 
+//! Function to create the object computing the Einstein-Infeld-Hoffmann equations for all bodies with EIH accelerations.
+/*!
+ *  Function to create the object computing the Einstein-Infeld-Hoffmann (EIH) equations, which is shared by all EIH
+ *  accelerations in a list of acceleration settings. The set of mutually attracting bodies consists of all bodies
+ *  undergoing, and all bodies exerting, an EIH acceleration. All of these bodies must have a gravity field model.
+ *  \param bodies List of pointers to bodies required for the creation of the acceleration model objects.
+ *  \param selectedAccelerationPerBody List of acceleration settings per body.
+ *  \return Object computing the EIH equations (nullptr if no EIH accelerations are requested).
+ */
+std::shared_ptr< relativity::EinsteinInfeldHoffmannEquations > createEinsteinInfeldHoffmannEquations(
+        const SystemOfBodies& bodies,
+        const SelectedAccelerationList& selectedAccelerationPerBody );
+
 //! Function to create acceleration model object.
 /*!
  *  Function to create acceleration model object.
@@ -535,6 +566,27 @@ createAccelerationModel(
         const std::string& nameOfCentralBody = "",
         const SystemOfBodies& bodies = SystemOfBodies( ) );
 
+//! Function to let a third-body acceleration share its indirect term with previously created third-body accelerations
+/*!
+ *  Function to let a third-body acceleration share its indirect term (the acceleration of the central body due to the
+ *  body exerting acceleration) with previously created third-body accelerations with identical perturber, central body
+ *  and settings (e.g. the Sun and Moon perturbations on all satellites of a constellation orbiting the Earth). The
+ *  shared term is then computed only once per state derivative evaluation. Point-mass, spherical harmonic, polyhedron,
+ *  ring and mascon third-body accelerations can be shared; other acceleration models are left unchanged.
+ *  \param accelerationModel Newly created acceleration model
+ *  \param accelerationSettings Settings with which accelerationModel was created
+ *  \param nameOfBodyExertingAcceleration Name of body exerting acceleration
+ *  \param nameOfCentralBody Name of central body in frame centered at which acceleration is calculated
+ *  \param thirdBodyAccelerations List of previously created third-body accelerations, with a key identifying the perturber,
+ *  central body and acceleration settings (updated by this function if no matching acceleration is found)
+ */
+void shareThirdBodyIndirectAcceleration(
+        const std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
+        const std::shared_ptr< AccelerationSettings > accelerationSettings,
+        const std::string& nameOfBodyExertingAcceleration,
+        const std::string& nameOfCentralBody,
+        std::map< std::string, std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >& thirdBodyAccelerations );
+
 //! Function to put SelectedAccelerationMap in correct order, to ensure correct model creation
 /*!
  * Function to put SelectedAccelerationMap in correct order, to ensure correct model creation
@@ -571,6 +623,13 @@ inline basic_astrodynamics::AccelerationMap createAccelerationModelsMap(
     SelectedAccelerationList orderedAccelerationPerBody =
             orderSelectedAccelerationMap( selectedAccelerationPerBody );
 
+    // Declare list of third-body accelerations, used to share identical indirect terms between bodies
+    std::map< std::string, std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > > thirdBodyAccelerations;
+
+    // Create single object computing the EIH equations for all bodies with EIH accelerations
+    std::shared_ptr< relativity::EinsteinInfeldHoffmannEquations > eihEquations =
+            createEinsteinInfeldHoffmannEquations( bodies, orderedAccelerationPerBody );
+
     // Iterate over all bodies which are undergoing acceleration
     for( SelectedAccelerationList::const_iterator bodyIterator =
          orderedAccelerationPerBody.begin( ); bodyIterator != orderedAccelerationPerBody.end( );
@@ -636,7 +695,20 @@ inline basic_astrodynamics::AccelerationMap createAccelerationModelsMap(
                             ", but no such body found in map of bodies" );
             }
 
-            if( !( accelerationsForBody.at( i ).second->accelerationType_ == basic_astrodynamics::thrust_acceleration ) )
+            if( accelerationsForBody.at( i ).second->accelerationType_ ==
+                    basic_astrodynamics::einstein_infeld_hoffmann_acceleration )
+            {
+                if( !ephemerides::isFrameInertial( currentCentralBodyName ) )
+                {
+                    throw std::runtime_error(
+                                "Error when making Einstein-Infeld-Hoffmann acceleration on " + bodyUndergoingAcceleration +
+                                ", central body must be inertial, but " + currentCentralBodyName + " was found" );
+                }
+                mapOfAccelerationsForBody[ bodyExertingAcceleration ].push_back(
+                            std::make_shared< relativity::EinsteinInfeldHoffmannAcceleration >(
+                                eihEquations, bodyUndergoingAcceleration, bodyExertingAcceleration ) );
+            }
+            else if( !( accelerationsForBody.at( i ).second->accelerationType_ == basic_astrodynamics::thrust_acceleration ) )
             {
                 currentAcceleration = createAccelerationModel( bodies.at( bodyUndergoingAcceleration ),
                                                                bodies.at( bodyExertingAcceleration ),
@@ -646,6 +718,9 @@ inline basic_astrodynamics::AccelerationMap createAccelerationModelsMap(
                                                                currentCentralBody,
                                                                currentCentralBodyName,
                                                                bodies );
+                shareThirdBodyIndirectAcceleration(
+                            currentAcceleration, accelerationsForBody.at( i ).second, bodyExertingAcceleration,
+                            currentCentralBodyName, thirdBodyAccelerations );
 
 
                 // Create acceleration model.
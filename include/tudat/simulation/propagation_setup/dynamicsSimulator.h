@@ -786,7 +786,8 @@ public:
                     integratedStateAndBodyList, propagatorSettings_->getOutputSettingsWithCheck( ),
                     std::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::convertNumericalStateSolutionsToOutputSolutions,
                                dynamicsStateDerivative_,
-                               std::placeholders::_1, std::placeholders::_2 ), dependentVariableInterface, sequentialPropagation_ ) ;
+                               std::placeholders::_1, std::placeholders::_2 ), dependentVariableInterface, sequentialPropagation_,
+                    dynamicsStateDerivative_->isOutputSolutionEqualToPropagatedSolution( ) ) ;
 
         // Integrate equations of motion if required.
         if( areEquationsOfMotionToBeIntegrated )
@@ -1055,8 +1056,9 @@ public:
         if( outputSettings_->getSetIntegratedResult( ) )
         {
             try {
-                // Create and set interpolators for ephemerides
-                resetIntegratedStates( propagationResults_->equationsOfMotionNumericalSolution_,
+                // Create and set interpolators for ephemerides (converting the propagated solution to conventional form
+                // now, so that the conversion uses the environment of the current propagation)
+                resetIntegratedStates( propagationResults_->getEquationsOfMotionNumericalSolution( ),
                                        integratedStateProcessors_ );
             }
             catch ( const std::exception &caughtException ) {
@@ -1066,7 +1068,7 @@ public:
                 std::cerr << caughtException.what( ) << std::endl << std::endl;
                 std::cerr <<
                           "The problem may be that there is an insufficient number of data points (epochs) at which propagation results are produced. Integrated results are given at" +
-                          std::to_string( propagationResults_->equationsOfMotionNumericalSolution_.size( )) + " epochs"
+                          std::to_string( propagationResults_->equationsOfMotionNumericalSolutionRaw_.size( )) + " epochs"
                           << std::endl;
             }
 
@@ -1129,7 +1131,15 @@ public:
      */
     const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& getEquationsOfMotionNumericalSolution( )
     {
-        return propagationResults_->equationsOfMotionNumericalSolution_;
+        // Retrieve solution through results object, so that it is converted to conventional form if needed
+        if( propagationResults_->getPropagationIsPerformed( ) && !propagationResults_->getSolutionIsCleared( ) )
+        {
+            return propagationResults_->getEquationsOfMotionNumericalSolution( );
+        }
+        else
+        {
+            return propagationResults_->equationsOfMotionNumericalSolution_;
+        }
     }
 
     //! Function to return the map of state history of numerically integrated bodies, in propagation coordinates.
@@ -341,7 +341,8 @@ getGravitationalAccelerationForDependentVariables(
 
     for( basic_astrodynamics::AvailableAcceleration accelerationModelType:
         {basic_astrodynamics::spherical_harmonic_gravity, basic_astrodynamics::polyhedron_gravity,
-         basic_astrodynamics::point_mass_gravity, basic_astrodynamics::mutual_spherical_harmonic_gravity} )
+         basic_astrodynamics::point_mass_gravity, basic_astrodynamics::mutual_spherical_harmonic_gravity,
+         basic_astrodynamics::mascon_gravity} )
     {
         listOfSuitableAccelerationModels = getAccelerationBetweenBodies(
                 dependentVariableSettings->associatedBody_, dependentVariableSettings->secondaryBody_,
@@ -2309,6 +2310,28 @@ std::function< double( ) > getDoubleDependentVariableFunction(
                 ringAccelerationModel->resetUpdatePotential( true );
                 variableFunction = [=]( ){ return ringAccelerationModel->getCurrentPotential( ); };
             }
+            else if ( selectedAccelerationModelType == basic_astrodynamics::mascon_gravity )
+            {
+                std::shared_ptr< gravitation::MasconGravitationalAccelerationModel >
+                        masconAccelerationModel =  std::dynamic_pointer_cast<
+                                gravitation::MasconGravitationalAccelerationModel >( selectedAccelerationModel );
+                masconAccelerationModel->resetUpdatePotential( true );
+                variableFunction = [=]( ){ return masconAccelerationModel->getCurrentPotential( ); };
+            }
+            else if ( selectedAccelerationModelType == basic_astrodynamics::third_body_mascon_gravity )
+            {
+                std::shared_ptr< gravitation::ThirdBodyMasconGravitationalAccelerationModel >
+                        thirdBodyMasconAccelerationModel =  std::dynamic_pointer_cast<
+                                gravitation::ThirdBodyMasconGravitationalAccelerationModel >( selectedAccelerationModel );
+
+                std::shared_ptr< gravitation::MasconGravitationalAccelerationModel >
+                        masconAccelerationModel =  std::dynamic_pointer_cast<
+                                gravitation::MasconGravitationalAccelerationModel >(
+                                        thirdBodyMasconAccelerationModel->getAccelerationModelForBodyUndergoingAcceleration( ) );
+
+                masconAccelerationModel->resetUpdatePotential( true );
+                variableFunction = [=]( ){ return masconAccelerationModel->getCurrentPotential( ); };
+            }
             else
             {
                 std::string errorMessage = "Error, when setting up gravitational potential as dependent variable, for" +
@@ -76,7 +76,8 @@ namespace tudat
                                        const std::function< void ( std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
                                                                    const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& ) > rawSolutionConversionFunction,
                                        const std::shared_ptr< SingleArcDependentVariablesInterface< TimeType > > dependentVariableInterface,
-                                       const bool sequentialPropagation = true ) :
+                                       const bool sequentialPropagation = true,
+                                       const bool rawSolutionIsOutputSolution = false ) :
                     SimulationResults<StateScalarType, TimeType>(),
                     processedStateIds_(getProcessedStateStrings( integratedStateAndBodyList ) ),
                     propagatedStateIds_( getPropagatedStateStrings( integratedStateAndBodyList ) ),
@@ -85,6 +86,8 @@ namespace tudat
                     dependentVariableInterface_( dependentVariableInterface ),
                     sequentialPropagation_( sequentialPropagation ),
                     rawSolutionConversionFunction_( rawSolutionConversionFunction ),
+                    rawSolutionIsOutputSolution_( rawSolutionIsOutputSolution ),
+                    outputSolutionIsConverted_( false ),
                     propagationIsPerformed_(false),
                     solutionIsCleared_( false ),
                     onlyProcessedSolutionSet_( false ),
@@ -100,6 +103,7 @@ namespace tudat
                 propagationIsPerformed_ = false;
                 solutionIsCleared_ = false;
                 onlyProcessedSolutionSet_ = false;
+                outputSolutionIsConverted_ = false;
                 propagationTerminationReason_ = std::make_shared<PropagationTerminationDetails>(propagation_never_run);
             }
             
@@ -141,7 +145,10 @@ namespace tudat
                     cumulativeNumberOfFunctionEvaluations_.insert( cumulativeNumberOfFunctionEvaluations.begin( ), cumulativeNumberOfFunctionEvaluations.end( ) );
                     isPropagationOngoing_ = false;
                 }
-                rawSolutionConversionFunction_( equationsOfMotionNumericalSolution_, equationsOfMotionNumericalSolutionRaw_ );
+
+                // Conversion to conventional form is performed when the processed solution is first requested
+                equationsOfMotionNumericalSolution_.clear( );
+                outputSolutionIsConverted_ = false;
                 propagationTerminationReason_ = propagationTerminationReason;
 
             }
@@ -182,6 +189,7 @@ namespace tudat
                     const std::map <TimeType, Eigen::Matrix<StateScalarType, Eigen::Dynamic, 1>> & equationsOfMotionNumericalSolution )
             {
                 onlyProcessedSolutionSet_ = true;
+                outputSolutionIsConverted_ = true;
                 equationsOfMotionNumericalSolution_ = equationsOfMotionNumericalSolution;
             }
 
@@ -202,12 +210,32 @@ namespace tudat
                 }
             }
 
+            //! Function to retrieve the state history in conventional form
+            /*!
+             *  Function to retrieve the state history in conventional form. The conversion from the propagated form is
+             *  performed on the first call after a propagation. If the propagated and conventional forms are identical
+             *  (e.g. for a Cowell propagator), the raw solution is returned directly, so that it is not stored twice.
+             *  Note that the conversion uses the environment at the time of this first call (e.g. the gravitational
+             *  parameter of the central body for element-based propagators). If the environment is modified after the
+             *  propagation (e.g. by resetting estimated parameters), this function should be called before doing so. When
+             *  the integrated results are set in the environment, the conversion is performed directly after propagation.
+             *  \return State history in conventional form.
+             */
             std::map <TimeType, Eigen::Matrix<StateScalarType, Eigen::Dynamic, 1>> &
             getEquationsOfMotionNumericalSolution( )
             {
                 if( !onlyProcessedSolutionSet_ )
                 {
                     checkAvailabilityOfSolution( "equations of motion numerical solution", false );
+                    if( rawSolutionIsOutputSolution_ )
+                    {
+                        return equationsOfMotionNumericalSolutionRaw_;
+                    }
+                    else if( !outputSolutionIsConverted_ )
+                    {
+                        rawSolutionConversionFunction_( equationsOfMotionNumericalSolution_, equationsOfMotionNumericalSolutionRaw_ );
+                        outputSolutionIsConverted_ = true;
+                    }
                 }
                 return equationsOfMotionNumericalSolution_;
             }
@@ -420,6 +448,13 @@ namespace tudat
             const std::function< void ( std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
                                         const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& ) > rawSolutionConversionFunction_;
 
+            //! Boolean denoting whether the propagated and conventional form of the state are identical, in which case the
+            //! processed solution is not stored separately
+            bool rawSolutionIsOutputSolution_;
+
+            //! Boolean denoting whether the processed solution has been computed from the current raw solution
+            bool outputSolutionIsConverted_;
+
             bool propagationIsPerformed_;
 
             bool solutionIsCleared_;
@@ -105,5 +105,61 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
     return nrlmsiseInputData;
 }
 
+//! NRLMSISE00Input function, using columnar solar activity table
+NRLMSISE00Input nrlmsiseInputFunctionFromTable(
+        const double altitude, const double longitude,
+        const double latitude, const double time,
+        const std::shared_ptr< tudat::input_output::solar_activity::SolarActivityTable > solarActivityTable,
+        const bool adjustSolarTime,
+        const double localSolarTime )
+{
+    using namespace tudat::input_output::solar_activity;
+
+    // Declare input data class member
+    NRLMSISE00Input nrlmsiseInputData;
+
+    // Retrieve index of current day in table
+    double julianDate = tudat::basic_astrodynamics::convertSecondsSinceEpochToJulianDay(
+                time, basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    int dayIndex = solarActivityTable->getDayIndex( julianDate );
+
+    nrlmsiseInputData.year = solarActivityTable->getYear( dayIndex );
+    nrlmsiseInputData.dayOfTheYear = solarActivityTable->getDayOfYear( dayIndex );
+    nrlmsiseInputData.secondOfTheDay = time -
+            tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                solarActivityTable->getJulianDay( dayIndex ), tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+
+    if( solarActivityTable->getFluxQualifier( dayIndex ) == 1 )
+    { // requires adjustment
+        nrlmsiseInputData.f107 = solarActivityTable->getSolarRadioFlux107Adjusted( dayIndex );
+        nrlmsiseInputData.f107a = solarActivityTable->getCentered81DaySolarRadioFlux107Adjusted( dayIndex );
+    }
+    else
+    { // no adjustment required
+        nrlmsiseInputData.f107 = solarActivityTable->getSolarRadioFlux107Observed( dayIndex );
+        nrlmsiseInputData.f107a = solarActivityTable->getCentered81DaySolarRadioFlux107Observed( dayIndex );
+    }
+    nrlmsiseInputData.apDaily = solarActivityTable->getPlanetaryEquivalentAmplitudeAverage( dayIndex );
+
+    const double* planetaryEquivalentAmplitudes = solarActivityTable->getPlanetaryEquivalentAmplitudes( dayIndex );
+    nrlmsiseInputData.apVector.assign(
+                planetaryEquivalentAmplitudes,
+                planetaryEquivalentAmplitudes + SolarActivityTable::NUMBER_OF_INDICES_PER_DAY );
+
+    // Compute local solar time
+    // Hrs since begin of the day at longitude 0 (GMT) + Hrs passed at current longitude
+    if( adjustSolarTime )
+    {
+        nrlmsiseInputData.localSolarTime = localSolarTime;
+    }
+    else
+    {
+        nrlmsiseInputData.localSolarTime = nrlmsiseInputData.secondOfTheDay / 3600.0
+                + longitude / ( tudat::mathematical_constants::PI / 12.0 );
+    }
+
+    return nrlmsiseInputData;
+}
+
 }  // namespace aerodynamics
 }  // namespace tudat
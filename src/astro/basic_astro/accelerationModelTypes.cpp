@@ -41,6 +41,9 @@ std::string getAccelerationModelName( const AvailableAcceleration accelerationTy
     case ring_gravity:
         accelerationName = "ring gravity ";
         break;
+    case mascon_gravity:
+        accelerationName = "mascon gravity ";
+        break;
     case third_body_point_mass_gravity:
         accelerationName = "third-body central gravity ";
         break;
@@ -56,6 +59,9 @@ std::string getAccelerationModelName( const AvailableAcceleration accelerationTy
     case third_body_ring_gravity:
         accelerationName = "third-body ring gravity ";
         break;
+    case third_body_mascon_gravity:
+        accelerationName = "third-body mascon gravity ";
+        break;
     case thrust_acceleration:
         accelerationName = "thrust ";
         break;
@@ -86,6 +92,9 @@ std::string getAccelerationModelName( const AvailableAcceleration accelerationTy
     case custom_acceleration:
         accelerationName = "custom acceleration";
         break;
+    case einstein_infeld_hoffmann_acceleration:
+        accelerationName = "Einstein-Infeld-Hoffmann acceleration";
+        break;
     default:
         std::string errorMessage = "Error, acceleration type " +
                 std::to_string( accelerationType ) +
@@ -136,6 +145,10 @@ AvailableAcceleration getAccelerationModelType(
     {
         accelerationType = third_body_ring_gravity;
     }
+    else if( std::dynamic_pointer_cast< ThirdBodyMasconGravitationalAccelerationModel >( accelerationModel ) != nullptr )
+    {
+        accelerationType = third_body_mascon_gravity;
+    }
     else if( std::dynamic_pointer_cast< SphericalHarmonicsGravitationalAccelerationModel >(
                  accelerationModel ) != nullptr  )
     {
@@ -153,6 +166,10 @@ AvailableAcceleration getAccelerationModelType(
     {
         accelerationType = ring_gravity;
     }
+    else if( std::dynamic_pointer_cast< MasconGravitationalAccelerationModel >( accelerationModel ) != nullptr  )
+    {
+        accelerationType = mascon_gravity;
+    }
     else if( std::dynamic_pointer_cast< AerodynamicAcceleration >(
                  accelerationModel ) != nullptr )
     {
@@ -202,6 +219,10 @@ AvailableAcceleration getAccelerationModelType(
     {
         accelerationType = custom_acceleration;
     }
+    else if( std::dynamic_pointer_cast< relativity::EinsteinInfeldHoffmannAcceleration >( accelerationModel ) != nullptr )
+    {
+        accelerationType = einstein_infeld_hoffmann_acceleration;
+    }
     else
     {
         throw std::runtime_error(
@@ -270,7 +291,7 @@ bool isAccelerationDirectGravitational( const AvailableAcceleration acceleration
     bool accelerationIsDirectGravity = 0;
     if( accelerationType == point_mass_gravity || accelerationType == spherical_harmonic_gravity ||
         accelerationType == mutual_spherical_harmonic_gravity || accelerationType == polyhedron_gravity ||
-        accelerationType == ring_gravity )
+        accelerationType == ring_gravity || accelerationType == mascon_gravity )
     {
         accelerationIsDirectGravity = 1;
     }
@@ -284,7 +305,8 @@ bool isAccelerationFromThirdBody( const AvailableAcceleration accelerationType )
     bool accelerationIsFromThirdBody = false;
     if( accelerationType == third_body_point_mass_gravity || accelerationType == third_body_spherical_harmonic_gravity ||
         accelerationType == third_body_mutual_spherical_harmonic_gravity ||
-        accelerationType == third_body_polyhedron_gravity || accelerationType == third_body_ring_gravity )
+        accelerationType == third_body_polyhedron_gravity || accelerationType == third_body_ring_gravity ||
+        accelerationType == third_body_mascon_gravity )
     {
         accelerationIsFromThirdBody = true;
     }
@@ -323,6 +345,10 @@ AvailableAcceleration getAssociatedThirdBodyAcceleration( const AvailableAcceler
     {
         thirdBodyAccelerationType = third_body_ring_gravity;
     }
+    else if( accelerationType == mascon_gravity )
+    {
+        thirdBodyAccelerationType = third_body_mascon_gravity;
+    }
     else
     {        std::string errorMessage = "Error when getting thirdbody gravity type, requested type: " +
                 std::to_string( accelerationType ) + " is not recognized.";
@@ -0,0 +1,266 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "tudat/astro/basic_astro/universalVariableKeplerPropagator.h"
+
+namespace tudat
+{
+
+namespace orbital_element_conversions
+{
+
+//! Compute universal functions U_0 to U_5 of the universal anomaly.
+Eigen::Vector6d computeUniversalFunctions(
+        const double universalAnomaly,
+        const double reciprocalSemiMajorAxis )
+{
+    const double stumpffArgument = reciprocalSemiMajorAxis * universalAnomaly * universalAnomaly;
+
+    // Compute Stumpff functions c_0 to c_5
+    Eigen::Vector6d stumpffFunctions;
+    if( std::fabs( stumpffArgument ) < 1.0 )
+    {
+        // Use series expansion c_k( z ) = sum_j ( -z )^j / ( k + 2j )! to prevent cancellation
+        double kFactorial = 1.0;
+        for( int k = 0; k < 6; k++ )
+        {
+            if( k > 0 )
+            {
+                kFactorial *= static_cast< double >( k );
+            }
+
+            double term = 1.0 / kFactorial;
+            double sum = term;
+            for( int j = 1; j < 20; j++ )
+            {
+                term *= -stumpffArgument / static_cast< double >( ( k + 2 * j - 1 ) * ( k + 2 * j ) );
+                sum += term;
+                if( std::fabs( term ) < 1.0E-17 * std::fabs( sum ) )
+                {
+                    break;
+                }
+            }
+            stumpffFunctions( k ) = sum;
+        }
+    }
+    else
+    {
+        if( stumpffArgument > 0.0 )
+        {
+            const double squareRootOfArgument = std::sqrt( stumpffArgument );
+            stumpffFunctions( 0 ) = std::cos( squareRootOfArgument );
+            stumpffFunctions( 1 ) = std::sin( squareRootOfArgument ) / squareRootOfArgument;
+        }
+        else
+        {
+            const double squareRootOfArgument = std::sqrt( -stumpffArgument );
+            stumpffFunctions( 0 ) = std::cosh( squareRootOfArgument );
+            stumpffFunctions( 1 ) = std::sinh( squareRootOfArgument ) / squareRootOfArgument;
+        }
+
+        // Use recursion c_k( z ) = 1 / k! - z c_( k + 2 )( z )
+        stumpffFunctions( 2 ) = ( 1.0 - stumpffFunctions( 0 ) ) / stumpffArgument;
+        stumpffFunctions( 3 ) = ( 1.0 - stumpffFunctions( 1 ) ) / stumpffArgument;
+        stumpffFunctions( 4 ) = ( 1.0 / 2.0 - stumpffFunctions( 2 ) ) / stumpffArgument;
+        stumpffFunctions( 5 ) = ( 1.0 / 6.0 - stumpffFunctions( 3 ) ) / stumpffArgument;
+    }
+
+    // Compute universal functions U_k = chi^k c_k( alpha chi^2 )
+    Eigen::Vector6d universalFunctions;
+    double universalAnomalyPower = 1.0;
+    for( int k = 0; k < 6; k++ )
+    {
+        universalFunctions( k ) = universalAnomalyPower * stumpffFunctions( k );
+        universalAnomalyPower *= universalAnomaly;
+    }
+
+    return universalFunctions;
+}
+
+//! Propagate Cartesian state along a Kepler orbit using universal variables.
+Eigen::Vector6d propagateCartesianStateWithUniversalVariables(
+        const Eigen::Vector6d& initialCartesianState,
+        const double propagationTime,
+        const double centralBodyGravitationalParameter,
+        Eigen::Matrix6d* stateTransitionMatrix,
+        const double convergenceTolerance,
+        const int maximumNumberOfIterations )
+{
+    if( propagationTime == 0.0 )
+    {
+        if( stateTransitionMatrix != nullptr )
+        {
+            stateTransitionMatrix->setIdentity( );
+        }
+        return initialCartesianState;
+    }
+
+    const Eigen::Vector3d initialPosition = initialCartesianState.segment( 0, 3 );
+    const Eigen::Vector3d initialVelocity = initialCartesianState.segment( 3, 3 );
+
+    const double squareRootOfGravitationalParameter = std::sqrt( centralBodyGravitationalParameter );
+    const double initialDistance = initialPosition.norm( );
+    const double initialRadialVelocityTerm =
+            initialPosition.dot( initialVelocity ) / squareRootOfGravitationalParameter;
+    const double reciprocalSemiMajorAxis =
+            2.0 / initialDistance - initialVelocity.squaredNorm( ) / centralBodyGravitationalParameter;
+    const double scaledPropagationTime = squareRootOfGravitationalParameter * propagationTime;
+
+    // Set initial guess for universal anomaly
+    double universalAnomaly = scaledPropagationTime / initialDistance;
+    if( reciprocalSemiMajorAxis > 0.0 )
+    {
+        universalAnomaly = scaledPropagationTime * reciprocalSemiMajorAxis;
+    }
+    else if( reciprocalSemiMajorAxis < 0.0 )
+    {
+        const double semiMajorAxis = 1.0 / reciprocalSemiMajorAxis;
+        const double timeSign = ( propagationTime > 0.0 ) ? 1.0 : -1.0;
+        const double logarithmArgument =
+                ( -2.0 * centralBodyGravitationalParameter * reciprocalSemiMajorAxis * propagationTime ) /
+                ( initialPosition.dot( initialVelocity ) + timeSign *
+                  std::sqrt( -centralBodyGravitationalParameter * semiMajorAxis ) *
+                  ( 1.0 - initialDistance * reciprocalSemiMajorAxis ) );
+        if( logarithmArgument > 0.0 && std::isfinite( logarithmArgument ) )
+        {
+            universalAnomaly = timeSign * std::sqrt( -semiMajorAxis ) * std::log( logarithmArgument );
+        }
+    }
+
+    // Solve universal Kepler equation with Laguerre-Conway method
+    const double laguerreOrder = 5.0;
+    Eigen::Vector6d universalFunctions;
+    bool isConverged = false;
+    for( int i = 0; i < maximumNumberOfIterations; i++ )
+    {
+        universalFunctions = computeUniversalFunctions( universalAnomaly, reciprocalSemiMajorAxis );
+        const double keplerFunction = initialDistance * universalFunctions( 1 ) +
+                initialRadialVelocityTerm * universalFunctions( 2 ) + universalFunctions( 3 ) - scaledPropagationTime;
+        const double keplerFunctionFirstDerivative = initialDistance * universalFunctions( 0 ) +
+                initialRadialVelocityTerm * universalFunctions( 1 ) + universalFunctions( 2 );
+        const double keplerFunctionSecondDerivative = initialRadialVelocityTerm * universalFunctions( 0 ) +
+                ( 1.0 - reciprocalSemiMajorAxis * initialDistance ) * universalFunctions( 1 );
+
+        const double derivativeSign = ( keplerFunctionFirstDerivative >= 0.0 ) ? 1.0 : -1.0;
+        const double universalAnomalyCorrection = laguerreOrder * keplerFunction / (
+                    keplerFunctionFirstDerivative + derivativeSign * std::sqrt( std::fabs(
+                        ( laguerreOrder - 1.0 ) * ( laguerreOrder - 1.0 ) *
+                        keplerFunctionFirstDerivative * keplerFunctionFirstDerivative -
+                        laguerreOrder * ( laguerreOrder - 1.0 ) * keplerFunction * keplerFunctionSecondDerivative ) ) );
+        universalAnomaly -= universalAnomalyCorrection;
+
+        if( std::fabs( universalAnomalyCorrection ) <= convergenceTolerance * std::fabs( universalAnomaly ) )
+        {
+            isConverged = true;
+            break;
+        }
+    }
+
+    if( !isConverged )
+    {
+        throw std::runtime_error( "Error when propagating Kepler orbit with universal variables, Kepler equation did not converge after " +
+                                  std::to_string( maximumNumberOfIterations ) + " iterations." );
+    }
+
+    // Compute Lagrange coefficients
+    universalFunctions = computeUniversalFunctions( universalAnomaly, reciprocalSemiMajorAxis );
+    const double finalDistance = initialDistance * universalFunctions( 0 ) +
+            initialRadialVelocityTerm * universalFunctions( 1 ) + universalFunctions( 2 );
+
+    const double f = 1.0 - universalFunctions( 2 ) / initialDistance;
+    const double g = propagationTime - universalFunctions( 3 ) / squareRootOfGravitationalParameter;
+    const double fDot = -squareRootOfGravitationalParameter * universalFunctions( 1 ) / ( finalDistance * initialDistance );
+    const double gDot = 1.0 - universalFunctions( 2 ) / finalDistance;
+
+    Eigen::Vector6d finalCartesianState;
+    finalCartesianState.segment( 0, 3 ) = f * initialPosition + g * initialVelocity;
+    finalCartesianState.segment( 3, 3 ) = fDot * initialPosition + gDot * initialVelocity;
+
+    if( stateTransitionMatrix != nullptr )
+    {
+        // Partials of initial orbit scalars w.r.t. initial state
+        Eigen::Matrix< double, 1, 6 > initialDistancePartial;
+        initialDistancePartial << initialPosition.transpose( ) / initialDistance, Eigen::RowVector3d::Zero( );
+
+        Eigen::Matrix< double, 1, 6 > initialRadialVelocityTermPartial;
+        initialRadialVelocityTermPartial << initialVelocity.transpose( ), initialPosition.transpose( );
+        initialRadialVelocityTermPartial /= squareRootOfGravitationalParameter;
+
+        Eigen::Matrix< double, 1, 6 > reciprocalSemiMajorAxisPartial;
+        reciprocalSemiMajorAxisPartial <<
+            -2.0 * initialPosition.transpose( ) / ( initialDistance * initialDistance * initialDistance ),
+            -2.0 * initialVelocity.transpose( ) / centralBodyGravitationalParameter;
+
+        // Partials of U_0 to U_3 w.r.t. alpha at constant chi: dU_k/dalpha = -( chi U_( k + 1 ) - k U_( k + 2 ) ) / 2
+        Eigen::Vector4d universalFunctionAlphaPartials;
+        for( int k = 0; k < 4; k++ )
+        {
+            universalFunctionAlphaPartials( k ) = -0.5 * (
+                        universalAnomaly * universalFunctions( k + 1 ) - k * universalFunctions( k + 2 ) );
+        }
+
+        // Partial of universal anomaly from implicit differentiation of Kepler equation
+        const double keplerFunctionAlphaPartial = initialDistance * universalFunctionAlphaPartials( 1 ) +
+                initialRadialVelocityTerm * universalFunctionAlphaPartials( 2 ) + universalFunctionAlphaPartials( 3 );
+        const Eigen::Matrix< double, 1, 6 > universalAnomalyPartial =
+                -( universalFunctions( 1 ) * initialDistancePartial +
+                   universalFunctions( 2 ) * initialRadialVelocityTermPartial +
+                   keplerFunctionAlphaPartial * reciprocalSemiMajorAxisPartial ) / finalDistance;
+
+        // Total partials of U_0 to U_3, using dU_k/dchi = U_( k - 1 ) and U_( -1 ) = -alpha U_1
+        Eigen::Matrix< double, 4, 6 > universalFunctionPartials;
+        for( int k = 0; k < 4; k++ )
+        {
+            const double previousUniversalFunction = ( k == 0 ) ?
+                        ( -reciprocalSemiMajorAxis * universalFunctions( 1 ) ) : universalFunctions( k - 1 );
+            universalFunctionPartials.row( k ) = previousUniversalFunction * universalAnomalyPartial +
+                    universalFunctionAlphaPartials( k ) * reciprocalSemiMajorAxisPartial;
+        }
+
+        const Eigen::Matrix< double, 1, 6 > finalDistancePartial =
+                universalFunctions( 0 ) * initialDistancePartial + initialDistance * universalFunctionPartials.row( 0 ) +
+                universalFunctions( 1 ) * initialRadialVelocityTermPartial +
+                initialRadialVelocityTerm * universalFunctionPartials.row( 1 ) + universalFunctionPartials.row( 2 );
+
+        // Partials of Lagrange coefficients
+        const Eigen::Matrix< double, 1, 6 > fPartial =
+                -universalFunctionPartials.row( 2 ) / initialDistance +
+                universalFunctions( 2 ) / ( initialDistance * initialDistance ) * initialDistancePartial;
+        const Eigen::Matrix< double, 1, 6 > gPartial =
+                -universalFunctionPartials.row( 3 ) / squareRootOfGravitationalParameter;
+        const Eigen::Matrix< double, 1, 6 > fDotPartial =
+                -squareRootOfGravitationalParameter * (
+                    universalFunctionPartials.row( 1 ) / ( finalDistance * initialDistance ) -
+                    universalFunctions( 1 ) / ( finalDistance * initialDistance * finalDistance * initialDistance ) *
+                    ( initialDistance * finalDistancePartial + finalDistance * initialDistancePartial ) );
+        const Eigen::Matrix< double, 1, 6 > gDotPartial =
+                -universalFunctionPartials.row( 2 ) / finalDistance +
+                universalFunctions( 2 ) / ( finalDistance * finalDistance ) * finalDistancePartial;
+
+        stateTransitionMatrix->setZero( );
+        stateTransitionMatrix->block( 0, 0, 3, 3 ) = f * Eigen::Matrix3d::Identity( );
+        stateTransitionMatrix->block( 0, 3, 3, 3 ) = g * Eigen::Matrix3d::Identity( );
+        stateTransitionMatrix->block( 3, 0, 3, 3 ) = fDot * Eigen::Matrix3d::Identity( );
+        stateTransitionMatrix->block( 3, 3, 3, 3 ) = gDot * Eigen::Matrix3d::Identity( );
+        stateTransitionMatrix->block( 0, 0, 3, 6 ) += initialPosition * fPartial + initialVelocity * gPartial;
+        stateTransitionMatrix->block( 3, 0, 3, 6 ) += initialPosition * fDotPartial + initialVelocity * gDotPartial;
+    }
+
+    return finalCartesianState;
+}
+
+} // namespace orbital_element_conversions
+
+} // namespace tudat
@@ -179,7 +179,8 @@ DynamicallyPaneledRadiationSourceModel::DynamicallyPaneledRadiationSourceModel(
         const std::vector<std::unique_ptr<SourcePanelRadiosityModel>>& baseRadiosityModels,
         const std::vector<int>& numberOfPanelsPerRing) :
         PaneledRadiationSourceModel(sourceBodyShapeModel, std::move(sourcePanelRadiosityModelUpdater)),
-        numberOfPanelsPerRing_(numberOfPanelsPerRing)
+        numberOfPanelsPerRing_(numberOfPanelsPerRing),
+        panelingTemplate_(numberOfPanelsPerRing)
 {
     if( sourceBodyShapeModel == nullptr )
     {
@@ -213,25 +214,21 @@ DynamicallyPaneledRadiationSourceModel::DynamicallyPaneledRadiationSourceModel(
 IrradianceWithSourceList DynamicallyPaneledRadiationSourceModel::evaluateIrradianceAtPosition(
         const Eigen::Vector3d& targetPosition)
 {
-    // Generate center points of panels in spherical coordinates
-    const auto panelProperties = generatePaneledSphericalCap_EqualProjectedAttenuatedArea(
-            targetPosition, numberOfPanelsPerRing_, sourceBodyShapeModel_->getAverageRadius());
-    const auto panelCenters = std::get<0>(panelProperties);
-    const auto polarAngles = std::get<1>(panelProperties);
-    const auto azimuthAngles = std::get<2>(panelProperties);
-    const auto areas = std::get<3>(panelProperties);
+    // Generate panels by rotating the pole-aligned template to the sub-target direction
+    panelingTemplate_.generatePanels(targetPosition, sourceBodyShapeModel_->getAverageRadius());
+    const Eigen::Matrix3Xd& panelCenters = panelingTemplate_.getPanelCenters();
+    const std::vector<double>& polarAngles = panelingTemplate_.getPolarAngles();
+    const std::vector<double>& azimuthAngles = panelingTemplate_.getAzimuthAngles();
+    const std::vector<double>& areas = panelingTemplate_.getAreas();
 
     for (unsigned int i = 0; i < numberOfPanels; ++i)
     {
-        const auto& relativeCenter = panelCenters[i];
+        const Eigen::Vector3d relativeCenter = panelCenters.col(i);
         const Eigen::Vector3d surfaceNormal = relativeCenter.normalized();
-        const auto polarAngle = polarAngles[i];
-        const auto azimuthAngle = azimuthAngles[i];
-        const auto area = areas[i];
 
-        panels_[i].setRelativeCenter(relativeCenter, polarAngle, azimuthAngle);
+        panels_[i].setRelativeCenter(relativeCenter, polarAngles[i], azimuthAngles[i]);
         panels_[i].setSurfaceNormal(surfaceNormal);
-        panels_[i].setArea(area);
+        panels_[i].setArea(areas[i]);
 
         // Always update (independently of current time) because evaluation may come from different targets each call
         panels_[i].updateMembers(currentTime_);
@@ -246,6 +243,108 @@ void DynamicallyPaneledRadiationSourceModel::updateMembers_(double currentTime)
     sourcePanelRadiosityModelUpdater_->updateMembers(currentTime);
 }
 
+SphericalCapPanelingTemplate::SphericalCapPanelingTemplate(const std::vector<int>& numberOfPanelsPerRing) :
+    numberOfPanelsPerRing_(numberOfPanelsPerRing)
+{
+    numberOfPanels_ = 1;
+    for (const auto& numberOfPanelsInCurrentRing : numberOfPanelsPerRing_)
+    {
+        numberOfPanels_ += numberOfPanelsInCurrentRing;
+    }
+
+    poleAlignedAzimuthDirections_.resize(2, numberOfPanels_);
+    poleAlignedPanelCenters_.resize(3, numberOfPanels_);
+    panelCenters_.resize(3, numberOfPanels_);
+    polarAngles_.resize(numberOfPanels_);
+    azimuthAngles_.resize(numberOfPanels_);
+    areas_.resize(numberOfPanels_);
+
+    // Azimuthal directions of the panels only depend on the ring configuration
+    poleAlignedAzimuthDirections_.col(0).setZero();
+    unsigned int panelIndex = 1;
+    for (const auto& N_s : numberOfPanelsPerRing_)
+    {
+        const double angularResolutionAzimuth = 2 * PI / N_s;
+        for (int currentPanelNumber = 0; currentPanelNumber < N_s; currentPanelNumber++)
+        {
+            const double panelCenterAzimuthAngleInPoleAlignedFrame = currentPanelNumber * angularResolutionAzimuth;
+            poleAlignedAzimuthDirections_(0, panelIndex) = std::cos(panelCenterAzimuthAngleInPoleAlignedFrame);
+            poleAlignedAzimuthDirections_(1, panelIndex) = std::sin(panelCenterAzimuthAngleInPoleAlignedFrame);
+            panelIndex++;
+        }
+    }
+}
+
+void SphericalCapPanelingTemplate::updatePoleAlignedTemplate(const double r_s, const double R_e)
+{
+    // Same ring boundaries as generatePaneledSphericalCap_EqualProjectedAttenuatedArea, see there for nomenclature
+    if (r_s == templateTargetDistance_ && R_e == templateBodyRadius_)
+    {
+        return;
+    }
+    templateTargetDistance_ = r_s;
+    templateBodyRadius_ = R_e;
+
+    const int N = static_cast<int>(numberOfPanels_);
+    const auto zeta_m = asin(R_e / r_s);
+    const auto zeta_1 = acos((N - 1 + cos(zeta_m)) / N);
+    const auto gamma_1 = asin(std::min(1.0, r_s * sin(zeta_1) / R_e));
+    double previousBeta = gamma_1 - zeta_1;
+
+    // Central cap, whose center is computed directly from the target position in generatePanels
+    poleAlignedPanelCenters_.col(0) = Eigen::Vector3d(0.0, 0.0, R_e);
+    areas_[0] = 2 * PI * R_e * R_e * (1 - cos(previousBeta));
+
+    int k = 1;
+    unsigned int panelIndex = 1;
+    for (const auto& N_s : numberOfPanelsPerRing_)
+    {
+        k += N_s;
+        const auto zeta_i = acos(k * cos(zeta_1) - k + 1);
+        // min is necessary because argument may slightly exceed 1.0 due to floating point errors
+        const auto gamma_i = asin(std::min(1.0, r_s * sin(zeta_i) / R_e));
+        const double currentBeta = gamma_i - zeta_i;
+
+        const double beta_star = (previousBeta + currentBeta) / 2;
+        const double sinOfBetaStar = sin(beta_star);
+        const double cosOfBetaStar = cos(beta_star);
+        const double panelArea = 2 * PI * R_e * R_e * (cos(previousBeta) - cos(currentBeta)) / N_s;
+
+        for (int currentPanelNumber = 0; currentPanelNumber < N_s; currentPanelNumber++)
+        {
+            poleAlignedPanelCenters_(0, panelIndex) = R_e * sinOfBetaStar * poleAlignedAzimuthDirections_(0, panelIndex);
+            poleAlignedPanelCenters_(1, panelIndex) = R_e * sinOfBetaStar * poleAlignedAzimuthDirections_(1, panelIndex);
+            poleAlignedPanelCenters_(2, panelIndex) = R_e * cosOfBetaStar;
+            areas_[panelIndex] = panelArea;
+            panelIndex++;
+        }
+
+        previousBeta = currentBeta;
+    }
+}
+
+void SphericalCapPanelingTemplate::generatePanels(
+        const Eigen::Vector3d& targetPosition,
+        const double bodyRadius)
+{
+    updatePoleAlignedTemplate(targetPosition.norm(), bodyRadius);
+
+    // Rotate all panels from pole-aligned to target-aligned frame at once
+    const Eigen::Matrix3d rotationFromPoleAlignedToTargetAlignedFrame =
+            Eigen::Quaterniond::FromTwoVectors(Eigen::Vector3d::UnitZ(), targetPosition).toRotationMatrix();
+    panelCenters_.noalias() = rotationFromPoleAlignedToTargetAlignedFrame * poleAlignedPanelCenters_;
+
+    // Central cap center is exactly the subtarget point
+    panelCenters_.col(0) = targetPosition.normalized() * bodyRadius;
+
+    for (unsigned int i = 0; i < numberOfPanels_; ++i)
+    {
+        const double panelCenterDistance = panelCenters_.col(i).norm();
+        polarAngles_[i] = std::acos(panelCenters_(2, i) / panelCenterDistance);
+        azimuthAngles_[i] = computeModulo(std::atan2(panelCenters_(1, i), panelCenters_(0, i)), 2 * PI);
+    }
+}
+
 void RadiationSourcePanel::updateMembers(double currentTime)
 {
     for (const auto& radiosityModel : radiosityModels_)
@@ -264,14 +363,16 @@ void SourcePanelRadiosityModelUpdater::updateMembers(const double currentTime)
     {
         currentTime_ = currentTime;
 
-        Eigen::Vector3d sourceCenterPositionInGlobalFrame = sourcePositionFunction_(); // position of center of source (e.g. planet)
-        Eigen::Quaterniond sourceRotationFromLocalToGlobalFrame = sourceRotationFromLocalToGlobalFrameFunction_();
-        Eigen::Quaterniond sourceRotationFromGlobalToLocalFrame = sourceRotationFromLocalToGlobalFrame.inverse();
+        sourceCenterPositionInGlobalFrame_ = sourcePositionFunction_(); // position of center of source (e.g. planet)
+        sourceRotationFromLocalToGlobalFrame_ = sourceRotationFromLocalToGlobalFrameFunction_();
+        const Eigen::Vector3d& sourceCenterPositionInGlobalFrame = sourceCenterPositionInGlobalFrame_;
+        Eigen::Quaterniond sourceRotationFromGlobalToLocalFrame = sourceRotationFromLocalToGlobalFrame_.inverse();
 
         for ( const auto &kv : originalSourcePositionFunctions_ ) {
             auto originalSourceName = kv.first;
             auto originalSourcePositionFunction = kv.second;
             Eigen::Vector3d originalSourceCenterPositionInGlobalFrame = originalSourcePositionFunction();
+            originalSourceCenterPositionsInGlobalFrame_[originalSourceName] = originalSourceCenterPositionInGlobalFrame;
 
             // Evaluate irradiances from original source at source center in original source frame (for albedo-reflected radiation)
             // If other types than isotropic point sources are supported as original source, rotate to original source frame here
@@ -293,9 +394,7 @@ void SourcePanelRadiosityModelUpdater::updatePanel(
         RadiationSourcePanel& panel)
 {
     // Update all properties that depend on the panels
-    Eigen::Vector3d sourceCenterPositionInGlobalFrame = sourcePositionFunction_(); // position of center of source (e.g. planet)
-    Eigen::Quaterniond sourceRotationFromLocalToGlobalFrame = sourceRotationFromLocalToGlobalFrameFunction_();
-
+    // Source and original source states are retrieved in updateMembers, since they do not depend on the panel
     for(auto& radiosityModel : panel.getRadiosityModels())
     {
         if (!radiosityModel->dependsOnOriginalSource())
@@ -304,12 +403,13 @@ void SourcePanelRadiosityModelUpdater::updatePanel(
         }
 
         Eigen::Vector3d sourcePositionInGlobalFrame =
-                sourceCenterPositionInGlobalFrame + sourceRotationFromLocalToGlobalFrame * panel.getRelativeCenter();
+                sourceCenterPositionInGlobalFrame_ + sourceRotationFromLocalToGlobalFrame_ * panel.getRelativeCenter();
 
         auto* originalSourceDependentRadiosityModel =
                 static_cast<OriginalSourceDependentSourcePanelRadiosityModel*>(radiosityModel.get());
-        auto originalSourceName = originalSourceDependentRadiosityModel->getOriginalSourceName();
-        Eigen::Vector3d originalSourceCenterPositionInGlobalFrame = originalSourcePositionFunctions_[originalSourceName]();
+        const std::string& originalSourceName = originalSourceDependentRadiosityModel->getOriginalSourceName();
+        const Eigen::Vector3d& originalSourceCenterPositionInGlobalFrame =
+                originalSourceCenterPositionsInGlobalFrame_[originalSourceName];
 
         auto originalSourceToSourceReceivedFraction =
                 originalSourceToSourceOccultationModels_[originalSourceName]->evaluateReceivedFractionFromExtendedSource(
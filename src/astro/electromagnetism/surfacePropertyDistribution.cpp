@@ -11,6 +11,7 @@
 #include "tudat/astro/electromagnetism/surfacePropertyDistribution.h"
 
 #include "tudat/math/basic/legendrePolynomials.h"
+#include "tudat/math/basic/basicMathematicsFunctions.h"
 #include "tudat/astro/basic_astro/physicalConstants.h"
 
 
@@ -69,5 +70,63 @@ void SecondDegreeZonalPeriodicSurfacePropertyDistribution::updateMembers_(const
     a1 = c0 + c1 * cos(angularFrequency * daysSinceReferenceEpoch) + c2 * sin(angularFrequency * daysSinceReferenceEpoch);
 }
 
+GriddedSurfacePropertyDistribution::GriddedSurfacePropertyDistribution(
+        const std::shared_ptr<SurfacePropertyDistribution>& originalDistribution,
+        const unsigned int numberOfLatitudes,
+        const unsigned int numberOfLongitudes)
+{
+    if( !originalDistribution->isTimeInvariant() )
+    {
+        throw std::runtime_error(
+                "Error when creating gridded surface property distribution; original distribution is not time-invariant" );
+    }
+    if( numberOfLatitudes < 2 || numberOfLongitudes < 1 )
+    {
+        throw std::runtime_error(
+                "Error when creating gridded surface property distribution; at least 2 latitudes and 1 longitude required" );
+    }
+
+    latitudeStep_ = PI / ( numberOfLatitudes - 1 );
+    longitudeStep_ = 2.0 * PI / numberOfLongitudes;
+
+    gridValues_.resize( numberOfLatitudes, numberOfLongitudes );
+    for( unsigned int i = 0; i < numberOfLatitudes; i++ )
+    {
+        const double latitude = -PI / 2.0 + i * latitudeStep_;
+        for( unsigned int j = 0; j < numberOfLongitudes; j++ )
+        {
+            gridValues_( i, j ) = originalDistribution->getValue( latitude, j * longitudeStep_ );
+        }
+    }
+}
+
+double GriddedSurfacePropertyDistribution::getValue(
+        double latitude,
+        double longitude)
+{
+    const int numberOfLatitudes = static_cast< int >( gridValues_.rows( ) );
+    const int numberOfLongitudes = static_cast< int >( gridValues_.cols( ) );
+
+    // Find lower grid indices and interpolation fractions; longitude wraps around, latitude is clamped
+    const double latitudeIndex = std::min( std::max( ( latitude + PI / 2.0 ) / latitudeStep_, 0.0 ),
+                                           static_cast< double >( numberOfLatitudes - 1 ) );
+    const int lowerLatitudeIndex = std::min( static_cast< int >( latitudeIndex ), numberOfLatitudes - 2 );
+    const double latitudeFraction = latitudeIndex - lowerLatitudeIndex;
+
+    const double longitudeIndex = basic_mathematics::computeModulo( longitude, 2.0 * PI ) / longitudeStep_;
+    const int lowerLongitudeIndex = static_cast< int >( longitudeIndex ) % numberOfLongitudes;
+    const int upperLongitudeIndex = ( lowerLongitudeIndex + 1 ) % numberOfLongitudes;
+    const double longitudeFraction = longitudeIndex - std::floor( longitudeIndex );
+
+    const double lowerLatitudeValue =
+            ( 1.0 - longitudeFraction ) * gridValues_( lowerLatitudeIndex, lowerLongitudeIndex ) +
+            longitudeFraction * gridValues_( lowerLatitudeIndex, upperLongitudeIndex );
+    const double upperLatitudeValue =
+            ( 1.0 - longitudeFraction ) * gridValues_( lowerLatitudeIndex + 1, lowerLongitudeIndex ) +
+            longitudeFraction * gridValues_( lowerLatitudeIndex + 1, upperLongitudeIndex );
+
+    return ( 1.0 - latitudeFraction ) * lowerLatitudeValue + latitudeFraction * upperLatitudeValue;
+}
+
 } // tudat
 } // electromagnetism
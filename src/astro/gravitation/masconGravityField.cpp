@@ -0,0 +1,649 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <string>
+
+#include <Eigen/QR>
+
+#include "tudat/astro/basic_astro/physicalConstants.h"
+#include "tudat/astro/basic_astro/polyhedronFuntions.h"
+#include "tudat/astro/gravitation/masconGravityField.h"
+#include "tudat/math/basic/legendrePolynomials.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/basic/polyhedron.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Maximum number of mascons that is processed in a single block of the direct summation kernel.
+static const int MASCON_KERNEL_BLOCK_SIZE = 16;
+
+//! Typedef for the (stack-allocated) arrays used in a single block of the direct summation kernel.
+typedef Eigen::Array< double, Eigen::Dynamic, 1, Eigen::ColMajor, MASCON_KERNEL_BLOCK_SIZE, 1 > MasconBlockArray;
+
+//! Constructor.
+MasconGravityField::MasconGravityField(
+        const double gravitationalParameter,
+        const Eigen::MatrixXd& masconPositions,
+        const Eigen::VectorXd& masconMassFractions,
+        const double openingAngle,
+        const int maximumMasconsPerLeaf,
+        const std::string& fixedReferenceFrame,
+        const std::function< void( ) > updateInertiaTensor ):
+    GravityFieldModel( gravitationalParameter, updateInertiaTensor ),
+    openingAngle_( openingAngle ),
+    maximumMasconsPerLeaf_( maximumMasconsPerLeaf ),
+    fixedReferenceFrame_( fixedReferenceFrame )
+{
+    const int numberOfMascons = masconPositions.rows( );
+    if( numberOfMascons == 0 || masconPositions.cols( ) != 3 )
+    {
+        throw std::runtime_error( "Error when creating mascon gravity field, mascon positions should be a non-empty matrix "
+                                  "with 3 columns, but has size " + std::to_string( masconPositions.rows( ) ) + "x" +
+                                  std::to_string( masconPositions.cols( ) ) );
+    }
+    if( masconMassFractions.rows( ) != 0 && masconMassFractions.rows( ) != numberOfMascons )
+    {
+        throw std::runtime_error( "Error when creating mascon gravity field, number of mass fractions (" +
+                                  std::to_string( masconMassFractions.rows( ) ) + ") is inconsistent with number of "
+                                  "mascons (" + std::to_string( numberOfMascons ) + ")" );
+    }
+    if( maximumMasconsPerLeaf_ < 1 )
+    {
+        throw std::runtime_error( "Error when creating mascon gravity field, maximum number of mascons per leaf must be "
+                                  "positive" );
+    }
+
+    masconPositionsX_ = masconPositions.col( 0 );
+    masconPositionsY_ = masconPositions.col( 1 );
+    masconPositionsZ_ = masconPositions.col( 2 );
+    if( masconMassFractions.rows( ) == 0 )
+    {
+        masconMassFractions_ = Eigen::VectorXd::Constant( numberOfMascons, 1.0 / static_cast< double >( numberOfMascons ) );
+    }
+    else
+    {
+        masconMassFractions_ = masconMassFractions;
+    }
+
+    centerOfMass_ << masconMassFractions_.dot( masconPositionsX_ ), masconMassFractions_.dot( masconPositionsY_ ),
+            masconMassFractions_.dot( masconPositionsZ_ );
+    centerOfMass_ /= masconMassFractions_.sum( );
+
+    // Sort mascons into octree
+    masconOrder_.resize( numberOfMascons );
+    std::iota( masconOrder_.begin( ), masconOrder_.end( ), 0 );
+
+    MasconOctreeNode rootNode;
+    rootNode.firstMascon_ = 0;
+    rootNode.numberOfMascons_ = numberOfMascons;
+    octreeNodes_.push_back( rootNode );
+    createOctreeNode( 0 );
+
+    // Store mascon properties in octree order, so that the mascons of each node are contiguous
+    Eigen::VectorXd unsortedPositionsX = masconPositionsX_;
+    Eigen::VectorXd unsortedPositionsY = masconPositionsY_;
+    Eigen::VectorXd unsortedPositionsZ = masconPositionsZ_;
+    Eigen::VectorXd unsortedMassFractions = masconMassFractions_;
+    for( int i = 0; i < numberOfMascons; i++ )
+    {
+        masconPositionsX_( i ) = unsortedPositionsX( masconOrder_.at( i ) );
+        masconPositionsY_( i ) = unsortedPositionsY( masconOrder_.at( i ) );
+        masconPositionsZ_( i ) = unsortedPositionsZ( masconOrder_.at( i ) );
+        masconMassFractions_( i ) = unsortedMassFractions( masconOrder_.at( i ) );
+    }
+}
+
+//! Function to recursively create the octree node with given index, and its children.
+void MasconGravityField::createOctreeNode( const int nodeIndex )
+{
+    computeOctreeNodeMoments( octreeNodes_.at( nodeIndex ) );
+    octreeNodes_.at( nodeIndex ).firstChild_ = -1;
+    octreeNodes_.at( nodeIndex ).numberOfChildren_ = 0;
+
+    const int firstMascon = octreeNodes_.at( nodeIndex ).firstMascon_;
+    const int numberOfMascons = octreeNodes_.at( nodeIndex ).numberOfMascons_;
+    if( numberOfMascons <= maximumMasconsPerLeaf_ )
+    {
+        return;
+    }
+
+    // Determine bounding box of mascons in node
+    Eigen::Vector3d minimumCoordinates = Eigen::Vector3d::Constant( std::numeric_limits< double >::max( ) );
+    Eigen::Vector3d maximumCoordinates = Eigen::Vector3d::Constant( std::numeric_limits< double >::lowest( ) );
+    for( int i = firstMascon; i < firstMascon + numberOfMascons; i++ )
+    {
+        const int masconIndex = masconOrder_.at( i );
+        Eigen::Vector3d masconPosition( masconPositionsX_( masconIndex ), masconPositionsY_( masconIndex ),
+                                        masconPositionsZ_( masconIndex ) );
+        minimumCoordinates = minimumCoordinates.cwiseMin( masconPosition );
+        maximumCoordinates = maximumCoordinates.cwiseMax( masconPosition );
+    }
+
+    // Coincident mascons cannot be split further
+    if( ( maximumCoordinates - minimumCoordinates ).maxCoeff( ) <= 0.0 )
+    {
+        return;
+    }
+
+    // Sort mascons by octant
+    const Eigen::Vector3d boxCenter = 0.5 * ( minimumCoordinates + maximumCoordinates );
+    auto getOctant = [ & ]( const int masconIndex )
+    {
+        return static_cast< int >( masconPositionsX_( masconIndex ) > boxCenter.x( ) ) +
+                2 * static_cast< int >( masconPositionsY_( masconIndex ) > boxCenter.y( ) ) +
+                4 * static_cast< int >( masconPositionsZ_( masconIndex ) > boxCenter.z( ) );
+    };
+    std::stable_sort( masconOrder_.begin( ) + firstMascon, masconOrder_.begin( ) + firstMascon + numberOfMascons,
+                      [ & ]( const int first, const int second ){ return getOctant( first ) < getOctant( second ); } );
+
+    std::vector< int > numberOfMasconsPerOctant( 8, 0 );
+    for( int i = firstMascon; i < firstMascon + numberOfMascons; i++ )
+    {
+        numberOfMasconsPerOctant.at( getOctant( masconOrder_.at( i ) ) )++;
+    }
+
+    // Create child nodes for all non-empty octants
+    const int firstChild = static_cast< int >( octreeNodes_.size( ) );
+    int currentFirstMascon = firstMascon;
+    for( int i = 0; i < 8; i++ )
+    {
+        if( numberOfMasconsPerOctant.at( i ) > 0 )
+        {
+            MasconOctreeNode childNode;
+            childNode.firstMascon_ = currentFirstMascon;
+            childNode.numberOfMascons_ = numberOfMasconsPerOctant.at( i );
+            octreeNodes_.push_back( childNode );
+            currentFirstMascon += numberOfMasconsPerOctant.at( i );
+        }
+    }
+
+    const int numberOfChildren = static_cast< int >( octreeNodes_.size( ) ) - firstChild;
+    octreeNodes_.at( nodeIndex ).firstChild_ = firstChild;
+    octreeNodes_.at( nodeIndex ).numberOfChildren_ = numberOfChildren;
+    for( int i = 0; i < numberOfChildren; i++ )
+    {
+        createOctreeNode( firstChild + i );
+    }
+}
+
+//! Function to compute the multipole moments of an octree node.
+void MasconGravityField::computeOctreeNodeMoments( MasconOctreeNode& node )
+{
+    node.massFraction_ = 0.0;
+    Eigen::Vector3d weightedPositionSum = Eigen::Vector3d::Zero( );
+    Eigen::Vector3d positionSum = Eigen::Vector3d::Zero( );
+    bool areAllMassFractionsPositive = true;
+    for( int i = node.firstMascon_; i < node.firstMascon_ + node.numberOfMascons_; i++ )
+    {
+        const int masconIndex = masconOrder_.at( i );
+        Eigen::Vector3d masconPosition( masconPositionsX_( masconIndex ), masconPositionsY_( masconIndex ),
+                                        masconPositionsZ_( masconIndex ) );
+        node.massFraction_ += masconMassFractions_( masconIndex );
+        weightedPositionSum += masconMassFractions_( masconIndex ) * masconPosition;
+        positionSum += masconPosition;
+        if( !( masconMassFractions_( masconIndex ) > 0.0 ) )
+        {
+            areAllMassFractionsPositive = false;
+        }
+    }
+
+    if( areAllMassFractionsPositive )
+    {
+        node.expansionCenter_ = weightedPositionSum / node.massFraction_;
+    }
+    else
+    {
+        node.expansionCenter_ = positionSum / static_cast< double >( node.numberOfMascons_ );
+    }
+
+    node.radius_ = 0.0;
+    node.dipoleMoment_.setZero( );
+    node.quadrupoleTensor_.setZero( );
+    for( int i = node.firstMascon_; i < node.firstMascon_ + node.numberOfMascons_; i++ )
+    {
+        const int masconIndex = masconOrder_.at( i );
+        const Eigen::Vector3d relativePosition =
+                Eigen::Vector3d( masconPositionsX_( masconIndex ), masconPositionsY_( masconIndex ),
+                                 masconPositionsZ_( masconIndex ) ) - node.expansionCenter_;
+        const double massFraction = masconMassFractions_( masconIndex );
+
+        node.radius_ = std::max( node.radius_, relativePosition.norm( ) );
+        node.dipoleMoment_ += massFraction * relativePosition;
+        node.quadrupoleTensor_ += massFraction * (
+                    3.0 * relativePosition * relativePosition.transpose( ) -
+                    relativePosition.squaredNorm( ) * Eigen::Matrix3d::Identity( ) );
+    }
+
+    if( areAllMassFractionsPositive )
+    {
+        node.dipoleMoment_.setZero( );
+    }
+}
+
+//! Function to compute the potential, its gradient and its hessian in a single pass over the mascons.
+void MasconGravityField::computeGravityFieldTerms(
+        const Eigen::Vector3d& bodyFixedPosition,
+        const double gravitationalParameter,
+        double* potential,
+        Eigen::Vector3d* gradient,
+        Eigen::Matrix3d* hessian ) const
+{
+    if( potential != nullptr )
+    {
+        *potential = 0.0;
+    }
+    if( gradient != nullptr )
+    {
+        gradient->setZero( );
+    }
+    if( hessian != nullptr )
+    {
+        hessian->setZero( );
+    }
+
+    if( openingAngle_ > 0.0 )
+    {
+        addOctreeNodeContribution( bodyFixedPosition, octreeNodes_.at( 0 ), potential, gradient, hessian );
+    }
+    else
+    {
+        addDirectContribution( bodyFixedPosition, 0, static_cast< int >( masconOrder_.size( ) ),
+                               potential, gradient, hessian );
+    }
+
+    // Scale mass fractions to gravitational parameter
+    if( potential != nullptr )
+    {
+        *potential *= gravitationalParameter;
+    }
+    if( gradient != nullptr )
+    {
+        *gradient *= gravitationalParameter;
+    }
+    if( hessian != nullptr )
+    {
+        *hessian *= gravitationalParameter;
+    }
+}
+
+//! Function to recursively add the contribution of an octree node to the requested terms.
+void MasconGravityField::addOctreeNodeContribution(
+        const Eigen::Vector3d& bodyFixedPosition,
+        const MasconOctreeNode& node,
+        double* potential,
+        Eigen::Vector3d* gradient,
+        Eigen::Matrix3d* hessian ) const
+{
+    const double squaredDistance = ( bodyFixedPosition - node.expansionCenter_ ).squaredNorm( );
+    if( node.numberOfMascons_ > 1 &&
+            node.radius_ * node.radius_ < openingAngle_ * openingAngle_ * squaredDistance )
+    {
+        addMultipoleContribution( bodyFixedPosition, node, potential, gradient, hessian );
+    }
+    else if( node.numberOfChildren_ == 0 )
+    {
+        addDirectContribution( bodyFixedPosition, node.firstMascon_, node.numberOfMascons_, potential, gradient, hessian );
+    }
+    else
+    {
+        for( int i = node.firstChild_; i < node.firstChild_ + node.numberOfChildren_; i++ )
+        {
+            addOctreeNodeContribution( bodyFixedPosition, octreeNodes_[ i ], potential, gradient, hessian );
+        }
+    }
+}
+
+//! Function to add the contribution of a contiguous range of mascons, summed directly, to the requested terms.
+void MasconGravityField::addDirectContribution(
+        const Eigen::Vector3d& bodyFixedPosition,
+        const int firstMascon,
+        const int numberOfMascons,
+        double* potential,
+        Eigen::Vector3d* gradient,
+        Eigen::Matrix3d* hessian ) const
+{
+    const int endMascon = firstMascon + numberOfMascons;
+    for( int blockStart = firstMascon; blockStart < endMascon; blockStart += MASCON_KERNEL_BLOCK_SIZE )
+    {
+        const int blockSize = std::min( MASCON_KERNEL_BLOCK_SIZE, endMascon - blockStart );
+
+        // Compute inverse distances to all mascons in block
+        const MasconBlockArray relativePositionX =
+                bodyFixedPosition.x( ) - masconPositionsX_.segment( blockStart, blockSize ).array( );
+        const MasconBlockArray relativePositionY =
+                bodyFixedPosition.y( ) - masconPositionsY_.segment( blockStart, blockSize ).array( );
+        const MasconBlockArray relativePositionZ =
+                bodyFixedPosition.z( ) - masconPositionsZ_.segment( blockStart, blockSize ).array( );
+        const MasconBlockArray inverseDistance =
+                ( relativePositionX.square( ) + relativePositionY.square( ) + relativePositionZ.square( ) ).rsqrt( );
+        const MasconBlockArray weightedInverseDistance =
+                masconMassFractions_.segment( blockStart, blockSize ).array( ) * inverseDistance;
+
+        if( potential != nullptr )
+        {
+            *potential += weightedInverseDistance.sum( );
+        }
+
+        if( gradient != nullptr || hessian != nullptr )
+        {
+            const MasconBlockArray weightedInverseDistanceCubed = weightedInverseDistance * inverseDistance.square( );
+            if( gradient != nullptr )
+            {
+                ( *gradient )( 0 ) -= ( weightedInverseDistanceCubed * relativePositionX ).sum( );
+                ( *gradient )( 1 ) -= ( weightedInverseDistanceCubed * relativePositionY ).sum( );
+                ( *gradient )( 2 ) -= ( weightedInverseDistanceCubed * relativePositionZ ).sum( );
+            }
+
+            if( hessian != nullptr )
+            {
+                const MasconBlockArray scaledWeightedInverseDistanceFifth =
+                        3.0 * weightedInverseDistanceCubed * inverseDistance.square( );
+                const double diagonalTerm = weightedInverseDistanceCubed.sum( );
+
+                ( *hessian )( 0, 0 ) += ( scaledWeightedInverseDistanceFifth * relativePositionX.square( ) ).sum( ) -
+                        diagonalTerm;
+                ( *hessian )( 1, 1 ) += ( scaledWeightedInverseDistanceFifth * relativePositionY.square( ) ).sum( ) -
+                        diagonalTerm;
+                ( *hessian )( 2, 2 ) += ( scaledWeightedInverseDistanceFifth * relativePositionZ.square( ) ).sum( ) -
+                        diagonalTerm;
+                ( *hessian )( 0, 1 ) += ( scaledWeightedInverseDistanceFifth * relativePositionX * relativePositionY ).sum( );
+                ( *hessian )( 0, 2 ) += ( scaledWeightedInverseDistanceFifth * relativePositionX * relativePositionZ ).sum( );
+                ( *hessian )( 1, 2 ) += ( scaledWeightedInverseDistanceFifth * relativePositionY * relativePositionZ ).sum( );
+                ( *hessian )( 1, 0 ) = ( *hessian )( 0, 1 );
+                ( *hessian )( 2, 0 ) = ( *hessian )( 0, 2 );
+                ( *hessian )( 2, 1 ) = ( *hessian )( 1, 2 );
+            }
+        }
+    }
+}
+
+//! Function to add the multipole (up to quadrupole) contribution of an octree node to the requested terms.
+void MasconGravityField::addMultipoleContribution(
+        const Eigen::Vector3d& bodyFixedPosition,
+        const MasconOctreeNode& node,
+        double* potential,
+        Eigen::Vector3d* gradient,
+        Eigen::Matrix3d* hessian ) const
+{
+    const Eigen::Vector3d relativePosition = bodyFixedPosition - node.expansionCenter_;
+    const double inverseDistance = 1.0 / relativePosition.norm( );
+    const double inverseSquaredDistance = inverseDistance * inverseDistance;
+    const double inverseDistanceCubed = inverseDistance * inverseSquaredDistance;
+    const double inverseDistanceFifth = inverseDistanceCubed * inverseSquaredDistance;
+    const double inverseDistanceSeventh = inverseDistanceFifth * inverseSquaredDistance;
+
+    const double dipoleProjection = node.dipoleMoment_.dot( relativePosition );
+    const Eigen::Vector3d quadrupoleProjection = node.quadrupoleTensor_ * relativePosition;
+    const double quadrupoleQuadraticForm = relativePosition.dot( quadrupoleProjection );
+
+    if( potential != nullptr )
+    {
+        *potential += node.massFraction_ * inverseDistance + dipoleProjection * inverseDistanceCubed +
+                0.5 * quadrupoleQuadraticForm * inverseDistanceFifth;
+    }
+
+    if( gradient != nullptr )
+    {
+        *gradient += -node.massFraction_ * inverseDistanceCubed * relativePosition +
+                node.dipoleMoment_ * inverseDistanceCubed - 3.0 * dipoleProjection * inverseDistanceFifth * relativePosition +
+                quadrupoleProjection * inverseDistanceFifth -
+                2.5 * quadrupoleQuadraticForm * inverseDistanceSeventh * relativePosition;
+    }
+
+    if( hessian != nullptr )
+    {
+        const Eigen::Matrix3d relativePositionDyad = relativePosition * relativePosition.transpose( );
+        const Eigen::Matrix3d dipoleDyad = node.dipoleMoment_ * relativePosition.transpose( );
+        const Eigen::Matrix3d quadrupoleDyad = quadrupoleProjection * relativePosition.transpose( );
+
+        *hessian += node.massFraction_ * ( 3.0 * inverseDistanceFifth * relativePositionDyad -
+                                           inverseDistanceCubed * Eigen::Matrix3d::Identity( ) );
+        *hessian += -3.0 * inverseDistanceFifth * ( dipoleDyad + dipoleDyad.transpose( ) ) +
+                dipoleProjection * ( 15.0 * inverseDistanceSeventh * relativePositionDyad -
+                                     3.0 * inverseDistanceFifth * Eigen::Matrix3d::Identity( ) );
+        *hessian += inverseDistanceFifth * node.quadrupoleTensor_ -
+                5.0 * inverseDistanceSeventh * ( quadrupoleDyad + quadrupoleDyad.transpose( ) ) +
+                quadrupoleQuadraticForm * ( 17.5 * inverseDistanceSeventh * inverseSquaredDistance * relativePositionDyad -
+                                            2.5 * inverseDistanceSeventh * Eigen::Matrix3d::Identity( ) );
+    }
+}
+
+//! Function to retrieve the inertia tensor of the mascon distribution, w.r.t. the origin of the body-fixed frame.
+Eigen::Matrix3d MasconGravityField::getInertiaTensor( )
+{
+    Eigen::Matrix3d inertiaTensor = Eigen::Matrix3d::Zero( );
+    for( int i = 0; i < masconMassFractions_.rows( ); i++ )
+    {
+        Eigen::Vector3d masconPosition( masconPositionsX_( i ), masconPositionsY_( i ), masconPositionsZ_( i ) );
+        inertiaTensor += masconMassFractions_( i ) * (
+                    masconPosition.squaredNorm( ) * Eigen::Matrix3d::Identity( ) -
+                    masconPosition * masconPosition.transpose( ) );
+    }
+    return inertiaTensor * gravitationalParameter_ / physical_constants::GRAVITATIONAL_CONSTANT;
+}
+
+//! Function to retrieve the mascon positions, in the order in which they were provided to the constructor.
+Eigen::MatrixXd MasconGravityField::getMasconPositions( )
+{
+    Eigen::MatrixXd masconPositions( masconOrder_.size( ), 3 );
+    for( unsigned int i = 0; i < masconOrder_.size( ); i++ )
+    {
+        masconPositions.row( masconOrder_.at( i ) ) <<
+            masconPositionsX_( i ), masconPositionsY_( i ), masconPositionsZ_( i );
+    }
+    return masconPositions;
+}
+
+//! Function to retrieve the mascon mass fractions, in the order in which they were provided to the constructor.
+Eigen::VectorXd MasconGravityField::getMasconMassFractions( )
+{
+    Eigen::VectorXd masconMassFractions( masconOrder_.size( ) );
+    for( unsigned int i = 0; i < masconOrder_.size( ); i++ )
+    {
+        masconMassFractions( masconOrder_.at( i ) ) = masconMassFractions_( i );
+    }
+    return masconMassFractions;
+}
+
+//! Function to create mascons on a regular grid inside a polyhedron.
+Eigen::MatrixXd createMasconPositionsFromPolyhedron(
+        const Eigen::MatrixXd& verticesCoordinates,
+        const Eigen::MatrixXi& verticesDefiningEachFacet,
+        const int numberOfCellsAlongLargestDimension,
+        const bool shiftToPolyhedronCentroid )
+{
+    basic_mathematics::checkValidityOfPolyhedronSettings( verticesCoordinates, verticesDefiningEachFacet );
+    if( numberOfCellsAlongLargestDimension < 1 )
+    {
+        throw std::runtime_error( "Error when creating mascons from polyhedron, number of cells must be positive" );
+    }
+
+    // Define grid covering bounding box of polyhedron
+    const Eigen::Vector3d minimumCoordinates = verticesCoordinates.colwise( ).minCoeff( ).transpose( );
+    const Eigen::Vector3d boxDimensions = verticesCoordinates.colwise( ).maxCoeff( ).transpose( ) - minimumCoordinates;
+    const double cellSize = boxDimensions.maxCoeff( ) / static_cast< double >( numberOfCellsAlongLargestDimension );
+
+    Eigen::Vector3i numberOfCells;
+    Eigen::Vector3d firstCellCenter;
+    for( int i = 0; i < 3; i++ )
+    {
+        numberOfCells( i ) = std::max( 1, static_cast< int >( std::ceil( boxDimensions( i ) / cellSize - 1.0E-12 ) ) );
+        firstCellCenter( i ) = minimumCoordinates( i ) +
+                0.5 * ( boxDimensions( i ) - static_cast< double >( numberOfCells( i ) - 1 ) * cellSize );
+    }
+
+    // Retain cell centers inside polyhedron
+    std::vector< Eigen::Vector3d > masconPositionList;
+    Eigen::MatrixXd verticesCoordinatesRelativeToFieldPoint;
+    Eigen::VectorXd perFacetFactor;
+    for( int i = 0; i < numberOfCells.x( ); i++ )
+    {
+        for( int j = 0; j < numberOfCells.y( ); j++ )
+        {
+            for( int k = 0; k < numberOfCells.z( ); k++ )
+            {
+                const Eigen::Vector3d cellCenter = firstCellCenter + cellSize * Eigen::Vector3d( i, j, k );
+                basic_mathematics::calculatePolyhedronVerticesCoordinatesRelativeToFieldPoint(
+                            verticesCoordinatesRelativeToFieldPoint, cellCenter, verticesCoordinates );
+                basic_mathematics::calculatePolyhedronPerFacetFactor(
+                            perFacetFactor, verticesCoordinatesRelativeToFieldPoint, verticesDefiningEachFacet );
+
+                // Sum of solid angles is 4 pi inside polyhedron, and 0 outside
+                if( std::fabs( perFacetFactor.sum( ) ) > 2.0 * mathematical_constants::PI )
+                {
+                    masconPositionList.push_back( cellCenter );
+                }
+            }
+        }
+    }
+
+    if( masconPositionList.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when creating mascons from polyhedron, no grid cells found inside polyhedron; "
+                                  "increase the number of cells" );
+    }
+
+    Eigen::MatrixXd masconPositions( masconPositionList.size( ), 3 );
+    for( unsigned int i = 0; i < masconPositionList.size( ); i++ )
+    {
+        masconPositions.row( i ) = masconPositionList.at( i ).transpose( );
+    }
+
+    if( shiftToPolyhedronCentroid )
+    {
+        const Eigen::Vector3d centroidOffset = basic_astrodynamics::computePolyhedronCentroidPosition(
+                    verticesCoordinates, verticesDefiningEachFacet ) - masconPositions.colwise( ).mean( ).transpose( );
+        masconPositions.rowwise( ) += centroidOffset.transpose( );
+    }
+
+    return masconPositions;
+}
+
+//! Function to compute the design matrix relating mascon mass fractions to spherical harmonic coefficients.
+Eigen::MatrixXd computeMasconSphericalHarmonicDesignMatrix(
+        const Eigen::MatrixXd& masconPositions,
+        const double referenceRadius,
+        const int maximumDegree )
+{
+    const int numberOfCoefficients = ( maximumDegree + 1 ) * ( maximumDegree + 1 );
+    Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Zero( numberOfCoefficients, masconPositions.rows( ) );
+
+    basic_mathematics::LegendreCache legendreCache( maximumDegree, maximumDegree, true );
+    for( int i = 0; i < masconPositions.rows( ); i++ )
+    {
+        const double radius = masconPositions.row( i ).norm( );
+        const double longitude = std::atan2( masconPositions( i, 1 ), masconPositions( i, 0 ) );
+        legendreCache.update( radius > 0.0 ? masconPositions( i, 2 ) / radius : 0.0 );
+
+        // Rows are ordered as C_n0, (C_nm, S_nm) for m = 1..n, for n = 0..maximumDegree
+        int currentRow = 0;
+        double radiusRatioPower = 1.0;
+        for( int n = 0; n <= maximumDegree; n++ )
+        {
+            const double degreeFactor = radiusRatioPower / static_cast< double >( 2 * n + 1 );
+            for( int m = 0; m <= n; m++ )
+            {
+                const double legendrePolynomial = legendreCache.getLegendrePolynomial( n, m ) * degreeFactor;
+                designMatrix( currentRow++, i ) = legendrePolynomial * std::cos( m * longitude );
+                if( m > 0 )
+                {
+                    designMatrix( currentRow++, i ) = legendrePolynomial * std::sin( m * longitude );
+                }
+            }
+            radiusRatioPower *= radius / referenceRadius;
+        }
+    }
+    return designMatrix;
+}
+
+//! Function to compute the (geodesy-normalized) spherical harmonic coefficients of a mascon distribution.
+void computeMasconSphericalHarmonicCoefficients(
+        const Eigen::MatrixXd& masconPositions,
+        const Eigen::VectorXd& masconMassFractions,
+        const double referenceRadius,
+        const int maximumDegree,
+        Eigen::MatrixXd& cosineCoefficients,
+        Eigen::MatrixXd& sineCoefficients )
+{
+    if( masconPositions.rows( ) != masconMassFractions.rows( ) )
+    {
+        throw std::runtime_error( "Error when computing spherical harmonic coefficients of mascons, inconsistent number of "
+                                  "positions and mass fractions" );
+    }
+
+    const Eigen::VectorXd coefficientVector =
+            computeMasconSphericalHarmonicDesignMatrix( masconPositions, referenceRadius, maximumDegree ) *
+            masconMassFractions;
+
+    cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    int currentRow = 0;
+    for( int n = 0; n <= maximumDegree; n++ )
+    {
+        for( int m = 0; m <= n; m++ )
+        {
+            cosineCoefficients( n, m ) = coefficientVector( currentRow++ );
+            if( m > 0 )
+            {
+                sineCoefficients( n, m ) = coefficientVector( currentRow++ );
+            }
+        }
+    }
+}
+
+//! Function to compute the mascon mass fractions that reproduce a given spherical harmonic gravity field.
+Eigen::VectorXd fitMasconMassFractionsToSphericalHarmonics(
+        const Eigen::MatrixXd& masconPositions,
+        const Eigen::MatrixXd& cosineCoefficients,
+        const Eigen::MatrixXd& sineCoefficients,
+        const double referenceRadius )
+{
+    const int maximumDegree = std::min( cosineCoefficients.rows( ), sineCoefficients.rows( ) ) - 1;
+    if( maximumDegree < 0 || cosineCoefficients.cols( ) < maximumDegree + 1 || sineCoefficients.cols( ) < maximumDegree + 1 )
+    {
+        throw std::runtime_error( "Error when fitting mascons to spherical harmonics, coefficient matrices are not square" );
+    }
+
+    const Eigen::MatrixXd designMatrix =
+            computeMasconSphericalHarmonicDesignMatrix( masconPositions, referenceRadius, maximumDegree );
+
+    Eigen::VectorXd coefficientVector( designMatrix.rows( ) );
+    int currentRow = 0;
+    for( int n = 0; n <= maximumDegree; n++ )
+    {
+        for( int m = 0; m <= n; m++ )
+        {
+            coefficientVector( currentRow++ ) = cosineCoefficients( n, m );
+            if( m > 0 )
+            {
+                coefficientVector( currentRow++ ) = sineCoefficients( n, m );
+            }
+        }
+    }
+
+    // Find solution closest to equal mass distribution
+    const Eigen::VectorXd equalMassFractions = Eigen::VectorXd::Constant(
+                masconPositions.rows( ), 1.0 / static_cast< double >( masconPositions.rows( ) ) );
+    return equalMassFractions + designMatrix.completeOrthogonalDecomposition( ).solve(
+                coefficientVector - designMatrix * equalMassFractions );
+}
+
+} // namespace gravitation
+
+} // namespace tudat
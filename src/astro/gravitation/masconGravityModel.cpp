@@ -0,0 +1,45 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include "tudat/astro/gravitation/masconGravityModel.h"
+
+namespace tudat
+{
+namespace gravitation
+{
+
+void MasconGravitationalAccelerationModel::updateMembers( const double currentTime )
+{
+    if( !( this->currentTime_ == currentTime ) )
+    {
+        rotationToIntegrationFrame_ = rotationFromBodyFixedToIntegrationFrameFunction_( );
+
+        subjectPositionFunction_( positionOfBodySubjectToAcceleration_ );
+        sourcePositionFunction_( positionOfBodyExertingAcceleration_ );
+        currentInertialRelativePosition_ =
+                positionOfBodySubjectToAcceleration_ - positionOfBodyExertingAcceleration_;
+
+        currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * currentInertialRelativePosition_;
+
+        // Compute the current acceleration, and (if requested) the potential and its hessian, in a single pass
+        masconGravityField_->computeGravityFieldTerms(
+                    currentRelativePosition_, gravitationalParameterFunction_( ),
+                    updatePotential_ ? &currentPotential_ : nullptr,
+                    &currentAccelerationInBodyFixedFrame_,
+                    updateHessian_ ? &currentBodyFixedHessian_ : nullptr );
+
+        currentAcceleration_ = rotationToIntegrationFrame_ * currentAccelerationInBodyFixedFrame_;
+    }
+}
+
+} // namespace gravitation
+
+} // namespace tudat
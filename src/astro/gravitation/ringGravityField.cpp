@@ -9,6 +9,9 @@
  *
  */
 
+#include <algorithm>
+#include <string>
+
 #include "tudat/astro/gravitation/ringGravityField.h"
 
 namespace tudat
@@ -17,79 +20,261 @@ namespace tudat
 namespace gravitation
 {
 
-void RingGravityCache::update (const Eigen::Vector3d& currentBodyFixedPosition)
+//! Computes the complete elliptic integrals K(m), E(m), B(m) and D(m) in a single evaluation.
+void computeCompleteEllipticIntegrals(
+        const double m,
+        double& ellipticIntegralK,
+        double& ellipticIntegralE,
+        double& ellipticIntegralB,
+        double& ellipticIntegralD )
 {
-    if ( currentBodyFixedPosition != currentBodyFixedPosition_ )
+    if ( !( m < 1.0 ) || !( m >= 0.0 ) )
     {
-        currentBodyFixedPosition_ = currentBodyFixedPosition;
-
-        double x = currentBodyFixedPosition_( 0 );
-        double y = currentBodyFixedPosition_( 1 );
-        double z = currentBodyFixedPosition_( 2 );
-
-        // Fukushima (2010), eq. 2
-        double r = std::sqrt( std::pow( x, 2.0 ) + std::pow( y, 2.0 ) );
-
-        // Fukushima (2010), eq. 3
-        double p = std::sqrt( std::pow( r + ringRadius_, 2.0 ) + std::pow( z, 2.0 ) );
-
-        // Fukushima (2010), eq. 5
-        double m = 4.0 * ringRadius_ * r / std::pow( p, 2.0 );
-        // m = k^2
-        double k = std::sqrt( std::abs( m ) );
+        throw std::runtime_error( "Error when computing complete elliptic integrals, parameter m = " + std::to_string( m ) +
+                                  " is outside of the domain [0,1)." );
+    }
 
-        // Compute elliptic integrals
+    // Taylor series coefficients of B(m) and D(m) around m0 = 0.05, 0.15, ..., 0.85, each valid in [m0 - 0.05, m0 + 0.05]
+    // (Fukushima, 2009, sec. 2.2)
+    static const double BCoefficients[ ] = {
+        // m0 = 0.05
+        7.90401413584395085e-01, 1.02006266220019154e-01, 3.98783955585514591e-02, 2.17371363759821662e-02,
+        1.39609797676220580e-02, 9.89251882266914233e-03, 7.48461240066333570e-03, 5.93462566429547346e-03,
+        4.87424905358166405e-03, 4.11460693031088631e-03, 3.55045298919617674e-03, 3.11922995998847484e-03,
+        2.78178147627757303e-03,
+        // m0 = 0.15
+        8.01024064452844908e-01, 1.10695344529634018e-01, 4.73487467169937185e-02, 2.84843672550414220e-02,
+        2.02778114440035975e-02, 1.59650058530991200e-02, 1.34413202735536343e-02, 1.18715657369514397e-02,
+        1.08683636724855211e-02, 1.02315872327105647e-02, 9.84958554666621154e-03, 9.65660634715376567e-03,
+        9.61257154470198869e-03,
+        // m0 = 0.25
+        8.12597772919920525e-01, 1.21109617945510117e-01, 5.72933768312398756e-02, 3.85094516021673300e-02,
+        3.07834303017752338e-02, 2.72905649347325273e-02, 2.59163692894451986e-02, 2.58472033433617999e-02,
+        2.67409235393488535e-02, 2.84643145548257037e-02, 3.09954462372789528e-02, 3.43843691799409767e-02,
+        3.87380020724939350e-02, 4.42167743575283198e-02,
+        // m0 = 0.35
+        8.25323557983515865e-01, 1.33862116083687782e-01, 7.10112935979886756e-02, 5.41784774173873773e-02,
+        4.94517449481029908e-02, 5.02221962241074793e-02, 5.47429131718303527e-02, 6.27462579270016974e-02,
+        7.46698810434768823e-02, 9.14808451777334719e-02, 1.14705092110997817e-01, 1.46571132581439889e-01,
+        1.90257137333846277e-01, 2.50263124910315826e-01,
+        // m0 = 0.45
+        8.39479570270612929e-01, 1.49916440306396337e-01, 9.08319358194288329e-02, 8.03470334833417815e-02,
+        8.56384405004704530e-02, 1.01954725932990375e-01, 1.30574811533616025e-01, 1.76105076358849921e-01,
+        2.46835164402955443e-01, 3.56424476867718831e-01, 5.27002562230102778e-01, 7.94389634259304755e-01,
+        1.21676253242971799e+00, 1.88903129434469053e+00, 2.96674680855227413e+00,
+        // m0 = 0.55
+        8.55469615156419949e-01, 1.70896072689739581e-01, 1.21335229026948224e-01, 1.28201883574947412e-01,
+        1.64687281451527556e-01, 2.37418908749381735e-01, 3.69208104716495455e-01, 6.05658733847927677e-01,
+        1.03370556155781279e+00, 1.81898848936326796e+00, 3.27937765127385106e+00, 6.02988838071753630e+00,
+        1.12697968555779422e+01, 2.13545778503828352e+01, 4.09410281341002644e+01, 7.92908431127125226e+01,
+        // m0 = 0.65
+        8.73920061848643126e-01, 1.99814057482376933e-01, 1.72769615878015204e-01, 2.28106913284202156e-01,
+        3.70468141118071193e-01, 6.79271252884820598e-01, 1.34800849668175737e+00, 2.82767097685382085e+00,
+        6.17946825012391443e+00, 1.39356860103428115e+01, 3.22189292810597223e+01, 7.60069629592261009e+01,
+        1.82321449087754075e+02, 4.43515076441126496e+02, 1.09185472290283883e+03, 2.71576586640381947e+03,
+        6.81575390982641784e+03, 1.72407981111985100e+04,
+        // m0 = 0.75
+        8.95902820924731613e-01, 2.43140003766786655e-01, 2.73081875594105516e-01, 4.86280007533573311e-01,
+        1.08274743722823086e+00, 2.74344529098645262e+00, 7.55581782867023488e+00, 2.20519408249375246e+01,
+        6.71564064474022899e+01, 2.11272253788177096e+02, 6.81903784305327122e+02, 2.24695623159253637e+03,
+        7.53148386599971218e+03, 2.56085126013024164e+04, 8.81407474008960562e+04, 3.06564424209844670e+05,
+        1.07603607781107211e+06, 3.80721850257363264e+06, 1.35663822442213949e+07, 4.86474808511665612e+07,
+        1.75433859376114696e+08, 6.35889514683894992e+08,
+        // m0 = 0.85
+        9.23580375216857430e-01, 3.18738668171685391e-01, 5.30484287657681408e-01, 1.49222148171560409e+00,
+        5.38552790034117823e+00, 2.23747113856755426e+01, 1.01631590144536773e+02, 4.90786470624050651e+02,
+        2.47792791759709507e+03, 1.29405758540496681e+04, 6.93939660378700937e+04, 3.80144380256697885e+05,
+        2.11927068215055345e+06, 1.19892071827007253e+07, 6.86748356140663773e+07, 3.97601223406169415e+08,
+        2.32343328507309151e+09, 1.36882354684907932e+10, 8.12247787818145142e+10, 4.85076388530401917e+11,
+        2.91355072317091748e+12, 1.75905412654178125e+13, 1.06700932237896312e+14, 6.49989661829108500e+14,
+        3.97497522731861900e+15, 2.43956522476385040e+16, 1.50216415473289696e+17, 9.27770000264589568e+17,
+        5.74624669461556019e+18, 3.56830999831534756e+19, 2.22125038884584096e+20, 1.38585908573552404e+21
+    };
+    static const double DCoefficients[ ] = {
+        // m0 = 0.05
+        8.00602040206397025e-01, 3.13994477771767755e-01, 2.05913118705551956e-01, 1.57744346538923996e-01,
+        1.30595077319933084e-01, 1.13308474489758573e-01, 1.01454199173630188e-01, 9.29187842072974335e-02,
+        8.65653801481680862e-02, 8.17279846651030178e-02, 7.79906657291070393e-02, 7.50804268512680062e-02,
+        7.28108360591448456e-02,
+        // m0 = 0.15
+        8.34232667811735107e-01, 3.60495281619098273e-01, 2.62379664114505862e-01, 2.23723944518094270e-01,
+        2.06447811775681056e-01, 1.99809440876486860e-01, 1.99667451603795287e-01, 2.04157558868236833e-01,
+        2.12387467960572368e-01, 2.23948914061499360e-01, 2.38708097425597870e-01, 2.56707203545463780e-01,
+        2.78115880611412680e-01,
+        // m0 = 0.25
+        8.73152581892675528e-01, 4.20622230667770214e-01, 3.44231061559450380e-01, 3.31133021818721784e-01,
+        3.45277285052808414e-01, 3.77945322150393392e-01, 4.27378012464553869e-01, 4.94671744307822403e-01,
+        5.82685115665646181e-01, 6.95799207728083124e-01, 8.40018401472533371e-01, 1.02326850357360599e+00,
+        1.25585908513628253e+00, 1.55112005103135009e+00,
+        // m0 = 0.35
+        9.19027039242097388e-01, 5.01002159288247539e-01, 4.68831270566456848e-01, 5.17714227776399971e-01,
+        6.20843391317303150e-01, 7.82364393786869727e-01, 1.01911453507610283e+00, 1.35934520274849602e+00,
+        1.84571730235882803e+00, 2.54107170315392095e+00, 3.53740465520804115e+00, 4.96929600297742624e+00,
+        7.03382287003003093e+00, 1.00200432250344722e+01,
+        // m0 = 0.45
+        9.74404366546369638e-01, 6.13246805394160877e-01, 6.71096669502166954e-01, 8.70727620185086093e-01,
+        1.22954223120269068e+00, 1.82660596754442062e+00, 2.80693453099776269e+00, 4.41878932908402788e+00,
+        7.08323605747876517e+00, 1.15150881205575821e+01, 1.89315111859992733e+01, 3.14119969382049646e+01,
+        5.25207294545758288e+01, 8.83848547350653035e+01, 1.49566374493980476e+02,
+        // m0 = 0.55
+        1.04345529511513346e+00, 7.79625721928504878e-01, 1.02974236093206750e+00, 1.62203722341135315e+00,
+        2.78798953118534776e+00, 5.04838148737206893e+00, 9.46327761194348405e+00, 1.81814899494276681e+01,
+        3.55809805911791699e+01, 7.06339354619144473e+01, 1.41828580083433053e+02, 2.87448751250132148e+02,
+        5.87115384649923044e+02, 1.20706543522548054e+03, 2.49558872724866433e+03, 5.18469242939480682e+03,
+        // m0 = 0.65
+        1.13367833657573325e+00, 1.04864317372997040e+00, 1.75346504119846447e+00, 3.52318272680338573e+00,
+        7.74947641381397467e+00, 1.79864500558507316e+01, 4.32559163462326168e+01, 1.06681534454096024e+02,
+        2.68098486573117441e+02, 6.83624114850289857e+02, 1.76349708521918751e+03, 4.59237475383116362e+03,
+        1.20534410190488888e+04, 3.18466630207420822e+04, 8.46212213590568135e+04, 2.25956423182907893e+05,
+        6.05941517281758832e+05, 1.63108259953926830e+06,
+        // m0 = 0.75
+        1.26061282657491169e+00, 1.54866563808267665e+00, 3.55366941187160768e+00, 9.90044467610439938e+00,
+        3.03205666174524708e+01, 9.81802586588830906e+01, 3.29771010434557070e+02, 1.13665598974289037e+03,
+        3.99383433574622995e+03, 1.42427295865552715e+04, 5.13947572916887220e+04, 1.87246702914623165e+05,
+        6.87653092375389882e+05, 2.54238553565398231e+06, 9.45378121934749000e+06, 3.53283630179709196e+07,
+        1.32593262383393019e+08, 4.99544968184054792e+08, 1.88840934729443884e+09, 7.16026753447893715e+09,
+        2.72233079469633980e+10, 1.03756977734169113e+11,
+        // m0 = 0.85
+        1.46543611110872263e+00, 2.75986258255117267e+00, 1.02627509950379885e+01, 4.70671400943292397e+01,
+        2.38654797881312703e+02, 1.28276404471670594e+03, 7.16156967230518057e+03, 4.10616167386812522e+04,
+        2.40115585166110541e+05, 1.42556836387073528e+06, 8.56597319759552181e+06, 5.19764426617753431e+07,
+        3.17943245791449904e+08, 1.95816968154769945e+09, 1.21304014296652451e+10, 7.55230232795793304e+10,
+        4.72263303446795959e+11, 2.96456647212070166e+12, 1.86732841644591172e+13, 1.17978703740496859e+14,
+        7.47437902825423500e+14, 4.74700814011028800e+15, 3.02161377282234760e+16, 1.92728503380567744e+17,
+        1.23158900666324864e+18, 7.88374382854896845e+18, 5.05461130322290115e+19, 3.24548692678253085e+20,
+        2.08671289076255320e+21, 1.34336798821198426e+22, 8.65844011902217392e+22, 5.58680130030959547e+23
+    };
+
+    // Index of first coefficient and series order for each interval
+    static const int coefficientOffsets[ ] = { 0, 13, 26, 40, 54, 69, 85, 103, 125 };
+    static const int seriesOrders[ ] = { 12, 12, 13, 13, 14, 15, 17, 21, 31 };
+
+    if ( m < 0.9 )
+    {
+        const int intervalIndex = std::min( static_cast< int >( m * 10.0 ), 8 );
+        const double deltaM = m - ( 0.1 * static_cast< double >( intervalIndex ) + 0.05 );
+        const int offset = coefficientOffsets[ intervalIndex ];
 
-        try
+        ellipticIntegralB = BCoefficients[ offset + seriesOrders[ intervalIndex ] ];
+        ellipticIntegralD = DCoefficients[ offset + seriesOrders[ intervalIndex ] ];
+        for ( int i = seriesOrders[ intervalIndex ] - 1; i >= 0; i-- )
         {
-            currentEllipticIntegralK_ = boost::math::ellint_1( k );
+            ellipticIntegralB = ellipticIntegralB * deltaM + BCoefficients[ offset + i ];
+            ellipticIntegralD = ellipticIntegralD * deltaM + DCoefficients[ offset + i ];
         }
-        // If boost throws overflow error: occurs for r=ringRadius singularity
-        catch( std::runtime_error& caughtException )
+
+        ellipticIntegralK = ellipticIntegralB + ellipticIntegralD;
+        ellipticIntegralE = ellipticIntegralB + ( 1.0 - m ) * ellipticIntegralD;
+    }
+    // Close to the logarithmic singularity at m = 1, compute K(m) and E(m) from a single arithmetic-geometric mean
+    // sequence; B(m) and D(m) then follow without numerical cancellation.
+    else
+    {
+        double arithmeticMean = 1.0;
+        double geometricMean = std::sqrt( 1.0 - m );
+        double weight = 0.5;
+        double sumOfWeightedSquares = 0.5 * m;
+        for ( unsigned int i = 0; i < 20; i++ )
         {
-            throw std::runtime_error(
-                    "Error when computing ring gravity, likely as a result of trying to compute it for a point in or "
-                    "very close to the ring (singularity). Caught exception: \n" +
-                    std::string( caughtException.what( ) ) );
+            const double halfDifference = 0.5 * ( arithmeticMean - geometricMean );
+            weight *= 2.0;
+            sumOfWeightedSquares += weight * halfDifference * halfDifference;
+            const double nextGeometricMean = std::sqrt( arithmeticMean * geometricMean );
+            arithmeticMean = 0.5 * ( arithmeticMean + geometricMean );
+            geometricMean = nextGeometricMean;
+            if ( std::fabs( halfDifference ) <= 1.0E-16 * arithmeticMean )
+            {
+                break;
+            }
         }
 
-        currentEllipticIntegralE_ = boost::math::ellint_2( k );
-        // BOOST: https://www.boost.org/doc/libs/1_81_0/libs/math/doc/html/math_toolkit/ellint/ellint_intro.html
-        currentEllipticIntegralB_ = boost::math::ellint_rf( 0.0, 1.0 - m, 1.0 ) - boost::math::ellint_rd( 0.0, 1.0 - m, 1.0 ) / 3.0;
+        ellipticIntegralK = mathematical_constants::PI / ( 2.0 * arithmeticMean );
+        ellipticIntegralE = ellipticIntegralK * ( 1.0 - sumOfWeightedSquares );
+        ellipticIntegralD = ( ellipticIntegralK - ellipticIntegralE ) / m;
+        ellipticIntegralB = ( ellipticIntegralE - ( 1.0 - m ) * ellipticIntegralK ) / m;
+    }
+}
 
-        // If far from 1/m singularity: compute S using elliptic integrals
-        if ( m > 0.01 )
+//! Computes the complete elliptic integrals required for the ring gravity field at a given position.
+void computeRingEllipticIntegrals(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double ringRadius,
+        const bool ellipticIntegralSFromDAndB,
+        double& ellipticIntegralK,
+        double& ellipticIntegralE,
+        double& ellipticIntegralB,
+        double& ellipticIntegralS )
+{
+    double x = positionOfBodySubjectToAcceleration( 0 );
+    double y = positionOfBodySubjectToAcceleration( 1 );
+    double z = positionOfBodySubjectToAcceleration( 2 );
+
+    // Fukushima (2010), eq. 2
+    double r = std::sqrt( x * x + y * y );
+
+    // Fukushima (2010), eq. 3
+    double pSquared = ( r + ringRadius ) * ( r + ringRadius ) + z * z;
+
+    // Fukushima (2010), eq. 5
+    double m = 4.0 * ringRadius * r / pSquared;
+
+    // Compute elliptic integrals
+    double ellipticIntegralD;
+    try
+    {
+        computeCompleteEllipticIntegrals( m, ellipticIntegralK, ellipticIntegralE, ellipticIntegralB, ellipticIntegralD );
+    }
+    // Parameter m reaches 1 for r=ringRadius singularity
+    catch( std::runtime_error& caughtException )
+    {
+        throw std::runtime_error(
+                "Error when computing ring gravity, likely as a result of trying to compute it for a point in or "
+                "very close to the ring (singularity). Caught exception: \n" +
+                std::string( caughtException.what( ) ) );
+    }
+
+    // If far from 1/m singularity: compute S using elliptic integrals
+    if ( m > 0.01 )
+    {
+        if ( ellipticIntegralSFromDAndB )
         {
-            if ( ellipticIntegralSFromDAndB_ )
-            {
-                // Fukushima (2010), eq. 32
-                currentEllipticIntegralS_ = ( boost::math::ellint_d( k ) - currentEllipticIntegralB_ ) / m;
-            }
-            else
-            {
-                // Fukushima (2010), eq. 31
-                currentEllipticIntegralS_ = ( ( 2.0 - m ) * currentEllipticIntegralK_ - 2.0 * currentEllipticIntegralE_ ) / std::pow( m, 2.0 );
-            }
+            // Fukushima (2010), eq. 32
+            ellipticIntegralS = ( ellipticIntegralD - ellipticIntegralB ) / m;
         }
-        // If close to 1/m singularity, compute S via Taylor series, according to Fukushima (2010), sec. A.1
         else
         {
-            // Taylor series coefficients for m in [0, 0.1]
-            std::vector< double > taylorCoefficients = {
-                    0.204012532440038310, 0.159513582234205843, 0.130422818255893004, 0.111687838140976463,
-                    0.098925188226691425, 0.089815348807960028, 0.083084759300136632, 0.077987984857306626,
-                    0.074062924745595950, 0.071009059783923539, 0.068623059119746445, 0.066762755430661757,
-                    0.065325983044110253 };
-            double m0 = 0.05;
-
-            currentEllipticIntegralS_ = 0;
-
-            for ( unsigned int taylorOrder = 0; taylorOrder <= 12; ++taylorOrder )
-            {
-                currentEllipticIntegralS_ += taylorCoefficients.at( taylorOrder ) * std::pow( m - m0, taylorOrder );
-            }
+            // Fukushima (2010), eq. 31
+            ellipticIntegralS = ( ( 2.0 - m ) * ellipticIntegralK - 2.0 * ellipticIntegralE ) / ( m * m );
+        }
+    }
+    // If close to 1/m singularity, compute S via Taylor series, according to Fukushima (2010), sec. A.1
+    else
+    {
+        // Taylor series coefficients for m in [0, 0.1]
+        static const double taylorCoefficients[ ] = {
+                0.204012532440038310, 0.159513582234205843, 0.130422818255893004, 0.111687838140976463,
+                0.098925188226691425, 0.089815348807960028, 0.083084759300136632, 0.077987984857306626,
+                0.074062924745595950, 0.071009059783923539, 0.068623059119746445, 0.066762755430661757,
+                0.065325983044110253 };
+        const double m0 = 0.05;
+
+        ellipticIntegralS = taylorCoefficients[ 12 ];
+        for ( int taylorOrder = 11; taylorOrder >= 0; taylorOrder-- )
+        {
+            ellipticIntegralS = ellipticIntegralS * ( m - m0 ) + taylorCoefficients[ taylorOrder ];
         }
+    }
+}
+
+void RingGravityCache::update (const Eigen::Vector3d& currentBodyFixedPosition)
+{
+    if ( currentBodyFixedPosition != currentBodyFixedPosition_ )
+    {
+        currentBodyFixedPosition_ = currentBodyFixedPosition;
 
+        computeRingEllipticIntegrals(
+                currentBodyFixedPosition_, ringRadius_, ellipticIntegralSFromDAndB_,
+                currentEllipticIntegralK_, currentEllipticIntegralE_, currentEllipticIntegralB_, currentEllipticIntegralS_ );
     }
 }
 
@@ -156,6 +341,29 @@ Eigen::Vector3d computeRingGravitationalAcceleration(
     return acceleration;
 }
 
+//! Computes the gravitational acceleration of a one-dimensional ring at a set of positions.
+Eigen::Matrix3Xd computeRingGravitationalAccelerations(
+        const Eigen::Matrix3Xd& positionsOfBodiesSubjectToAcceleration,
+        const double ringRadius,
+        const double gravitationalParameter,
+        const bool ellipticIntegralSFromDAndB )
+{
+    Eigen::Matrix3Xd accelerations( 3, positionsOfBodiesSubjectToAcceleration.cols( ) );
+
+    double ellipticIntegralK, ellipticIntegralE, ellipticIntegralB, ellipticIntegralS;
+    for ( int i = 0; i < positionsOfBodiesSubjectToAcceleration.cols( ); i++ )
+    {
+        computeRingEllipticIntegrals(
+                positionsOfBodiesSubjectToAcceleration.col( i ), ringRadius, ellipticIntegralSFromDAndB,
+                ellipticIntegralK, ellipticIntegralE, ellipticIntegralB, ellipticIntegralS );
+        accelerations.col( i ) = computeRingGravitationalAcceleration(
+                positionsOfBodiesSubjectToAcceleration.col( i ), ringRadius, gravitationalParameter,
+                ellipticIntegralB, ellipticIntegralE, ellipticIntegralS );
+    }
+
+    return accelerations;
+}
+
 Eigen::Matrix3d computeRingHessianOfGravitationalPotential(
         const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
         const double ringRadius,
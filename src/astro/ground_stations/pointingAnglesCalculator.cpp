@@ -80,13 +80,13 @@ Eigen::Vector3d PointingAnglesCalculator::convertVectorFromInertialToTopocentric
         const Eigen::Vector3d& inertialVector, const double time )
 {
     // Calculate anf combine constituent rotations.
-    return rotationFromBodyFixedToTopoCentricFrame_( time ) * rotationFromInertialToBodyFixedFrame_( time ) * inertialVector;
+    return getRotationFromInertialToTopocentricFrame( time ) * inertialVector;
 }
 
 double calculateGroundStationElevationAngle(
         const std::shared_ptr< PointingAnglesCalculator > angleCalculator,
-        const std::vector< Eigen::Vector6d > linkEndStates,
-        const std::vector< double > linkEndTimes,
+        const std::vector< Eigen::Vector6d >& linkEndStates,
+        const std::vector< double >& linkEndTimes,
         const std::pair< int, int >& linkEndIndices )
 {
     double stationTime = linkEndTimes.at( linkEndIndices.first );
@@ -97,8 +97,8 @@ double calculateGroundStationElevationAngle(
 
 double calculateGroundStationAzimuthAngle(
         const std::shared_ptr< PointingAnglesCalculator > angleCalculator,
-        const std::vector< Eigen::Vector6d > linkEndStates,
-        const std::vector< double > linkEndTimes,
+        const std::vector< Eigen::Vector6d >& linkEndStates,
+        const std::vector< double >& linkEndTimes,
         const std::pair< int, int >& linkEndIndices )
 {
     double stationTime = linkEndTimes.at( linkEndIndices.first );
@@ -0,0 +1,198 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cmath>
+#include <stdexcept>
+
+#include "tudat/astro/basic_astro/modifiedEquinoctialElementConversions.h"
+#include "tudat/astro/basic_astro/physicalConstants.h"
+#include "tudat/astro/low_thrust/hybridMethodPropagator.h"
+#include "tudat/astro/propagators/nBodyGaussModifiedEquinoctialStateDerivative.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace low_thrust_trajectories
+{
+
+//! Compute optimal thrust direction from modified equinoctial elements co-states.
+Eigen::Vector3d computeMeeCostatesBasedThrustDirectionInRswFrame(
+        const Eigen::Vector6d& modifiedEquinoctialElements,
+        const Eigen::VectorXd& costates )
+{
+    using namespace orbital_element_conversions;
+
+    double p = modifiedEquinoctialElements[ semiParameterIndex ];
+    double f = modifiedEquinoctialElements[ fElementIndex ];
+    double g = modifiedEquinoctialElements[ gElementIndex ];
+    double h = modifiedEquinoctialElements[ hElementIndex ];
+    double k = modifiedEquinoctialElements[ kElementIndex ];
+    double sineTrueLongitude = std::sin( modifiedEquinoctialElements[ trueLongitudeIndex ] );
+    double cosineTrueLongitude = std::cos( modifiedEquinoctialElements[ trueLongitudeIndex ] );
+
+    double w1 = 1.0 + f * cosineTrueLongitude + g * sineTrueLongitude;
+    double w2 = 1.0 + h * h + k * k;
+    double recurringTermInFGTerms = h * sineTrueLongitude - k * cosineTrueLongitude;
+
+    // Compute B^T lambda (omitting the common factor sqrt( p / mu ) ), with B the matrix of the Gauss planetary equations.
+    Eigen::Vector3d costatesTimesGaussMatrix;
+    costatesTimesGaussMatrix[ 0 ] = costates[ fElementIndex ] * sineTrueLongitude - costates[ gElementIndex ] * cosineTrueLongitude;
+    costatesTimesGaussMatrix[ 1 ] = costates[ semiParameterIndex ] * ( 2.0 * p ) / w1 +
+            costates[ fElementIndex ] * ( ( w1 + 1.0 ) * cosineTrueLongitude + f ) / w1 +
+            costates[ gElementIndex ] * ( ( w1 + 1.0 ) * sineTrueLongitude + g ) / w1;
+    costatesTimesGaussMatrix[ 2 ] = ( - costates[ fElementIndex ] * g + costates[ gElementIndex ] * f ) * recurringTermInFGTerms / w1 +
+            costates[ hElementIndex ] * w2 * cosineTrueLongitude / ( 2.0 * w1 ) +
+            costates[ kElementIndex ] * w2 * sineTrueLongitude / ( 2.0 * w1 );
+
+    // Optimal thrust direction minimizes the Hamiltonian.
+    double costatesTimesGaussMatrixNorm = costatesTimesGaussMatrix.norm( );
+    if( costatesTimesGaussMatrixNorm > 0.0 )
+    {
+        return - costatesTimesGaussMatrix / costatesTimesGaussMatrixNorm;
+    }
+    else
+    {
+        return Eigen::Vector3d::Zero( );
+    }
+}
+
+//! Constructor.
+HybridMethodPropagator::HybridMethodPropagator(
+        const double centralBodyGravitationalParameter,
+        const double maximumThrust,
+        const double specificImpulse,
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings ):
+    centralBodyGravitationalParameter_( centralBodyGravitationalParameter ),
+    maximumThrust_( maximumThrust ),
+    timeOfFlight_( TUDAT_NAN ),
+    propagatedMass_( TUDAT_NAN )
+{
+    using namespace numerical_integrators;
+
+    // Only Runge-Kutta integrators allow the current state and time to be reset.
+    if( integratorSettings->integratorType_ != euler && integratorSettings->integratorType_ != rungeKutta4 &&
+            integratorSettings->integratorType_ != rungeKuttaFixedStepSize &&
+            integratorSettings->integratorType_ != rungeKuttaVariableStepSize )
+    {
+        throw std::runtime_error( "Error when creating hybrid method propagator, only Runge-Kutta integrators are supported." );
+    }
+
+    massRate_ = - maximumThrust_ / ( specificImpulse * physical_constants::SEA_LEVEL_GRAVITATIONAL_ACCELERATION );
+    initialTimeStep_ = std::fabs( integratorSettings->initialTimeStep_ );
+
+    initialCostates_ = Eigen::VectorXd::Zero( 5 );
+    finalCostates_ = Eigen::VectorXd::Zero( 5 );
+    propagatedState_ = Eigen::VectorXd::Zero( 7 );
+
+    // Create integrator once; its state and time are reset for each propagation.
+    integrator_ = createIntegrator< double, Eigen::VectorXd >(
+                std::bind( &HybridMethodPropagator::computeStateDerivative, this, std::placeholders::_1, std::placeholders::_2 ),
+                propagatedState_, 0.0, integratorSettings );
+}
+
+//! Function to reset the MEE co-states profile.
+void HybridMethodPropagator::resetCostates( const Eigen::VectorXd& initialCostates,
+                                            const Eigen::VectorXd& finalCostates,
+                                            const double timeOfFlight )
+{
+    if( initialCostates.rows( ) != 5 || finalCostates.rows( ) != 5 )
+    {
+        throw std::runtime_error( "Error when resetting co-states of hybrid method propagator, 5 initial and 5 final MEE "
+                                  "co-states are required." );
+    }
+
+    initialCostates_ = initialCostates;
+    finalCostates_ = finalCostates;
+    timeOfFlight_ = timeOfFlight;
+}
+
+//! Function to compute the derivative of the propagated state (MEE and mass).
+Eigen::VectorXd HybridMethodPropagator::computeStateDerivative(
+        const double currentTime, const Eigen::VectorXd& currentState )
+{
+    Eigen::Vector6d modifiedEquinoctialElements = currentState.segment( 0, 6 );
+
+    // Compute thrust acceleration in RSW frame.
+    Eigen::Vector3d thrustDirection = computeMeeCostatesBasedThrustDirectionInRswFrame(
+                modifiedEquinoctialElements, getCurrentCostates( currentTime ) );
+    Eigen::Vector3d thrustAcceleration = maximumThrust_ / currentState[ 6 ] * thrustDirection;
+
+    Eigen::VectorXd stateDerivative( 7 );
+    stateDerivative.segment( 0, 6 ) = propagators::computeGaussPlanetaryEquationsForModifiedEquinoctialElements(
+                modifiedEquinoctialElements, thrustAcceleration, centralBodyGravitationalParameter_ );
+    stateDerivative[ 6 ] = ( thrustDirection.squaredNorm( ) > 0.0 ) ? massRate_ : 0.0;
+
+    return stateDerivative;
+}
+
+//! Function to propagate the trajectory from initial to final time.
+Eigen::Vector6d HybridMethodPropagator::propagateTrajectory( const double initialTime,
+                                                             const double finalTime,
+                                                             const Eigen::Vector6d& initialState,
+                                                             const double initialMass )
+{
+    // Reset integrator to initial MEE and mass.
+    propagatedState_.segment( 0, 6 ) = orbital_element_conversions::convertCartesianToModifiedEquinoctialElements(
+                initialState, centralBodyGravitationalParameter_, false );
+    propagatedState_[ 6 ] = initialMass;
+    integrator_->modifyCurrentIntegrationVariables( propagatedState_, initialTime );
+
+    // Propagate to final time.
+    if( finalTime != initialTime )
+    {
+        propagatedState_ = integrator_->integrateTo(
+                    finalTime, ( finalTime > initialTime ) ? initialTimeStep_ : -initialTimeStep_ );
+    }
+    propagatedMass_ = propagatedState_[ 6 ];
+
+    return orbital_element_conversions::convertModifiedEquinoctialToCartesianElements(
+                static_cast< Eigen::Vector6d >( propagatedState_.segment( 0, 6 ) ), centralBodyGravitationalParameter_, false );
+}
+
+//! Function to propagate the trajectory to a set of epochs.
+std::map< double, Eigen::Vector6d > HybridMethodPropagator::propagateTrajectory( const std::vector< double >& epochs,
+                                                                                 const double initialTime,
+                                                                                 const Eigen::Vector6d& initialState,
+                                                                                 const double initialMass )
+{
+    // Reset integrator to initial MEE and mass.
+    propagatedState_.segment( 0, 6 ) = orbital_element_conversions::convertCartesianToModifiedEquinoctialElements(
+                initialState, centralBodyGravitationalParameter_, false );
+    propagatedState_[ 6 ] = initialMass;
+    integrator_->modifyCurrentIntegrationVariables( propagatedState_, initialTime );
+
+    std::map< double, Eigen::Vector6d > propagatedTrajectory;
+    double currentTime = initialTime;
+    for( unsigned int epochIndex = 0 ; epochIndex < epochs.size( ) ; epochIndex++ )
+    {
+        if( epochs[ epochIndex ] < currentTime )
+        {
+            throw std::runtime_error( "Error when propagating trajectory with hybrid method propagator, epochs at which the trajectory "
+                                      "should be computed are not in increasing order, or before initial time." );
+        }
+
+        // Continue integration from previous epoch.
+        if( epochs[ epochIndex ] > currentTime )
+        {
+            propagatedState_ = integrator_->integrateTo( epochs[ epochIndex ], initialTimeStep_ );
+            currentTime = epochs[ epochIndex ];
+        }
+
+        propagatedTrajectory[ currentTime ] = orbital_element_conversions::convertModifiedEquinoctialToCartesianElements(
+                    static_cast< Eigen::Vector6d >( propagatedState_.segment( 0, 6 ) ), centralBodyGravitationalParameter_, false );
+    }
+    propagatedMass_ = propagatedState_[ 6 ];
+
+    return propagatedTrajectory;
+}
+
+} // namespace low_thrust_trajectories
+} // namespace tudat
@@ -8,9 +8,12 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <boost/math/special_functions/beta.hpp>
+
+#include <Eigen/Geometry>
+
 #include "tudat/astro/observation_models/corrections/solarCoronaCorrection.h"
 
-#include "tudat/math/basic/linearAlgebra.h"
 #include "tudat/math/quadrature.h"
 
 namespace tudat
@@ -106,46 +109,99 @@ double InversePowerSeriesSolarCoronaCorrection::calculateLightTimeCorrectionWith
             legTransmissionTime, legReceptionTime );
 
     // Retrieve state wrt Sun
-    Eigen::Vector3d transmitterPositionWrtSun = ( legTransmitterState - sunStateFunction_( legTransmissionTime ) ).segment( 0, 3 );
-    Eigen::Vector3d receiverPositionWrtSun = ( legReceiverState - sunStateFunction_( legReceptionTime ) ).segment( 0, 3 );
+    LinkLegCache& legCache = getLinkLegCache( currentMultiLegTransmitterIndex, legTransmissionTime, legReceptionTime );
+    Eigen::Vector3d transmitterPositionWrtSun = legTransmitterState.segment( 0, 3 ) - legCache.sunPositionAtTransmission_;
+    Eigen::Vector3d receiverPositionWrtSun = legReceiverState.segment( 0, 3 ) - legCache.sunPositionAtReception_;
 
-    double sunReceiverTransmitterAngle = linear_algebra::computeAngleBetweenVectors(
-            - receiverPositionWrtSun,
-            transmitterPositionWrtSun - receiverPositionWrtSun );
-    double receiverSunTransmitterAngle = linear_algebra::computeAngleBetweenVectors(
-            receiverPositionWrtSun, transmitterPositionWrtSun );
+    // Compute electron density integral (if link end positions have changed): Verma et al. (2013), eq. 3/4
+    if( !( transmitterPositionWrtSun == legCache.transmitterPositionWrtSun_ &&
+           receiverPositionWrtSun == legCache.receiverPositionWrtSun_ ) )
+    {
+        legCache.electronDensityIntegral_ = computeElectronDensityIntegralAnalytically(
+                    transmitterPositionWrtSun, receiverPositionWrtSun );
+        legCache.transmitterPositionWrtSun_ = transmitterPositionWrtSun;
+        legCache.receiverPositionWrtSun_ = receiverPositionWrtSun;
+    }
 
-    // Compute electron density integral: Verma et al. (2013), eq. 3/4
-    double electronDensityIntegral = 0.0;
-    // If all exponents are integer calculate integral of electron density analytically
-    if ( exponentsAreIntegers_ && std::abs( receiverSunTransmitterAngle ) > 0.1 * mathematical_constants::PI / 180.0 )
+    // Verma et al. (2013), eq. 1
+    legCache.correctionScalingFactor_ = sign_ * criticalPlasmaDensityDelayCoefficient_ /
+            std::pow( getCurrentFrequency( ancillarySettings, linkEndsTimes.front( ) ), 2.0 ) /
+            physical_constants::getSpeedOfLight< double >( );
+    return legCache.correctionScalingFactor_ * legCache.electronDensityIntegral_;
+}
+
+Eigen::Matrix< double, 3, 1 > InversePowerSeriesSolarCoronaCorrection::calculateLightTimeCorrectionPartialDerivativeWrtLinkEndPosition(
+        const Eigen::Vector6d& transmitterState,
+        const Eigen::Vector6d& receiverState,
+        const double transmissionTime,
+        const double receptionTime,
+        const LinkEndType linkEndAtWhichPartialIsEvaluated )
+{
+    // Retrieve Sun positions and frequency-dependent scaling stored when computing the correction
+    int legIndex = -1;
+    for( unsigned int i = 0; i < linkLegCaches_.size( ); i++ )
     {
-        // Reset analytical integrals
-        cosinePowersIntegralsCache_.clear( );
-        for ( unsigned int i = 0; i < coefficients_.size( ); ++i )
+        if( linkLegCaches_.at( i ).transmissionTime_ == transmissionTime &&
+                linkLegCaches_.at( i ).receptionTime_ == receptionTime )
         {
-            electronDensityIntegral += coefficients_.at( i ) * computeSingleTermIntegralAnalytically(
-                    receiverPositionWrtSun, sunReceiverTransmitterAngle, receiverSunTransmitterAngle,
-                    static_cast< unsigned int >( positiveExponents_.at( i ) ) );
+            legIndex = i;
+            break;
         }
     }
-    // If exponents aren't integer, calculate integral numerically
-    // Verma et al. (2013) calculate it via integration of Taylor series (eq. A.6), but the expansion they use isn't valid.
-    // The function is integrated in [alpha - pi/2, beta + alpha - pi/2], using a Taylor series defined around 0.
-    // alpha = Sun-Receiver-Transmitter angle
-    // beta = Receiver-Sun-Transmitter angle
-    // Near conjunctions alpha is small (close to 0) and beta large (close to pi), so the integration is executed roughly
-    // between [-pi/2, pi/2]. Evidently the Taylor series can't be expected to be valid over that range. Numerical tests
-    // confirmed this.
-    else
+    if( legIndex < 0 )
     {
-        electronDensityIntegral = computeElectronDensityIntegralNumerically(
-            transmitterPositionWrtSun, receiverPositionWrtSun, ( legReceptionTime + legTransmissionTime ) / 2.0 );
+        throw std::runtime_error( "Error when computing solar corona correction partial: correction was not computed for "
+                                  "the current transmission and reception times." );
+    }
+    const LinkLegCache& legCache = linkLegCaches_.at( legIndex );
+
+    Eigen::Vector3d transmitterPositionWrtSun = transmitterState.segment( 0, 3 ) - legCache.sunPositionAtTransmission_;
+    Eigen::Vector3d receiverPositionWrtSun = receiverState.segment( 0, 3 ) - legCache.sunPositionAtReception_;
+
+    // Compute line-of-sight geometry: distances s along line of sight (w.r.t. point closest to the Sun), and vector p
+    // from the Sun to the point closest to the Sun (with norm d)
+    double lineOfSightLength = ( receiverPositionWrtSun - transmitterPositionWrtSun ).norm( );
+    Eigen::Vector3d lineOfSightDirection = ( receiverPositionWrtSun - transmitterPositionWrtSun ) / lineOfSightLength;
+    double transmitterDistanceAlongLineOfSight = transmitterPositionWrtSun.dot( lineOfSightDirection );
+    double receiverDistanceAlongLineOfSight = receiverPositionWrtSun.dot( lineOfSightDirection );
+    Eigen::Vector3d minimumDistanceVector = receiverPositionWrtSun - receiverDistanceAlongLineOfSight * lineOfSightDirection;
+    double minimumDistance = transmitterPositionWrtSun.cross( lineOfSightDirection ).norm( );
+    double transmitterDistance = transmitterPositionWrtSun.norm( );
+    double receiverDistance = receiverPositionWrtSun.norm( );
+
+    // Differentiate integral of each term w.r.t. s at transmitter/receiver and d, and map to link end position
+    Eigen::Vector3d partial = Eigen::Vector3d::Zero( );
+    for ( unsigned int i = 0; i < coefficients_.size( ); ++i )
+    {
+        double exponent = positiveExponents_.at( i );
+        double higherExponentIntegral = computeSingleTermIntegral(
+                    transmitterDistanceAlongLineOfSight, receiverDistanceAlongLineOfSight, minimumDistance, exponent + 2.0 );
+        double transmitterDensity = std::pow( transmitterDistance, -exponent );
+        double receiverDensity = std::pow( receiverDistance, -exponent );
+
+        Eigen::Vector3d termPartial;
+        if( linkEndAtWhichPartialIsEvaluated == receiver )
+        {
+            termPartial = receiverDensity * lineOfSightDirection + (
+                        receiverDensity - transmitterDensity +
+                        exponent * higherExponentIntegral * transmitterDistanceAlongLineOfSight ) *
+                    minimumDistanceVector / lineOfSightLength;
+        }
+        else if( linkEndAtWhichPartialIsEvaluated == transmitter )
+        {
+            termPartial = -transmitterDensity * lineOfSightDirection + (
+                        transmitterDensity - receiverDensity -
+                        exponent * higherExponentIntegral * receiverDistanceAlongLineOfSight ) *
+                    minimumDistanceVector / lineOfSightLength;
+        }
+        else
+        {
+            throw std::runtime_error( "Error when computing solar corona correction partial: link end type not recognized." );
+        }
+        partial += coefficients_.at( i ) * std::pow( sunRadius_, exponent ) * termPartial;
     }
 
-    // Verma et al. (2013), eq. 1
-    return sign_ * criticalPlasmaDensityDelayCoefficient_ / std::pow( getCurrentFrequency( ancillarySettings, linkEndsTimes.front( ) ), 2.0 ) *
-        electronDensityIntegral / physical_constants::getSpeedOfLight< double >( );
+    return legCache.correctionScalingFactor_ * partial;
 }
 
 double InversePowerSeriesSolarCoronaCorrection::computeElectronDensity( const Eigen::Vector3d& positionWrtSun,
@@ -162,70 +218,127 @@ double InversePowerSeriesSolarCoronaCorrection::computeElectronDensity( const Ei
     return electronDensity;
 }
 
-// Verma et al., eq. A.4
-double InversePowerSeriesSolarCoronaCorrection::computeSingleTermIntegralAnalytically(
-        const Eigen::Vector3d& receiverPositionWrtSun,
-        const double sunReceiverTransmitterAngle,
-        const double receiverSunTransmitterAngle,
-        const unsigned int positiveExponent )
+double InversePowerSeriesSolarCoronaCorrection::computeElectronDensityIntegralAnalytically(
+        const Eigen::Vector3d& transmitterPositionWrtSun,
+        const Eigen::Vector3d& receiverPositionWrtSun )
 {
-    // Rename terms for simplicity
-    double alpha = sunReceiverTransmitterAngle;
-    double beta = receiverSunTransmitterAngle;
+    // Compute distances along line of sight w.r.t. the point closest to the Sun, and minimum distance to the Sun
+    Eigen::Vector3d lineOfSightDirection = ( receiverPositionWrtSun - transmitterPositionWrtSun ).normalized( );
+    double transmitterDistanceAlongLineOfSight = transmitterPositionWrtSun.dot( lineOfSightDirection );
+    double receiverDistanceAlongLineOfSight = receiverPositionWrtSun.dot( lineOfSightDirection );
+    double minimumDistance = transmitterPositionWrtSun.cross( lineOfSightDirection ).norm( );
 
-    double upperBound = beta + alpha - mathematical_constants::PI / 2.0;
-    double lowerBound = alpha - mathematical_constants::PI / 2.0;
-
-    double mulTerm = std::pow( sunRadius_, positiveExponent ) /
-            std::pow( receiverPositionWrtSun.norm( ) * std::sin( alpha ), positiveExponent - 1.0 );
+    // Verma et al. (2013), eq. 3/4
+    double electronDensityIntegral = 0.0;
+    for ( unsigned int i = 0; i < coefficients_.size( ); ++i )
+    {
+        electronDensityIntegral += coefficients_.at( i ) * std::pow( sunRadius_, positiveExponents_.at( i ) ) *
+                computeSingleTermIntegral( transmitterDistanceAlongLineOfSight, receiverDistanceAlongLineOfSight,
+                                           minimumDistance, positiveExponents_.at( i ) );
+    }
+    return electronDensityIntegral;
+}
 
-    return mulTerm * computeCosinePowerIntegral( lowerBound, upperBound, positiveExponent - 2 );
+double computeCosinePowerIntegralFromLineOfSightDistance(
+        const double distanceAlongLineOfSight, const double minimumDistance, const double cosinePower )
+{
+    double squaredDistance = distanceAlongLineOfSight * distanceAlongLineOfSight + minimumDistance * minimumDistance;
+    if( cosinePower > -1.0 )
+    {
+        // Integral is half the incomplete beta function B( sin^2 theta; 1/2, (p+1)/2 ); complement used for |theta| > pi/4
+        double betaParameter = ( cosinePower + 1.0 ) / 2.0;
+        double squaredSine = distanceAlongLineOfSight * distanceAlongLineOfSight / squaredDistance;
+        double incompleteBeta = ( squaredSine <= 0.5 ) ?
+                    boost::math::beta( 0.5, betaParameter, squaredSine ) :
+                    boost::math::beta( 0.5, betaParameter ) -
+                    boost::math::beta( betaParameter, 0.5, minimumDistance * minimumDistance / squaredDistance );
+        return ( distanceAlongLineOfSight < 0.0 ? -0.5 : 0.5 ) * incompleteBeta;
+    }
+    else if( cosinePower == -1.0 )
+    {
+        return std::asinh( distanceAlongLineOfSight / minimumDistance );
+    }
+    else
+    {
+        // Reduction formula: (p+1) int cos^p = (p+2) int cos^(p+2) - cos^(p+1) sin
+        double distance = std::sqrt( squaredDistance );
+        return ( ( cosinePower + 2.0 ) * computeCosinePowerIntegralFromLineOfSightDistance(
+                     distanceAlongLineOfSight, minimumDistance, cosinePower + 2.0 ) -
+                 std::pow( minimumDistance / distance, cosinePower + 1.0 ) * distanceAlongLineOfSight / distance ) /
+                ( cosinePower + 1.0 );
+    }
 }
 
-// Wikipedia, https://en.wikipedia.org/wiki/List_of_integrals_of_trigonometric_functions
-double InversePowerSeriesSolarCoronaCorrection::computeCosinePowerIntegral(
-        const double lowerBound,
-        const double upperBound,
-        const unsigned int positiveExponent )
+double InversePowerSeriesSolarCoronaCorrection::computeSingleTermIntegral(
+        const double transmitterDistanceAlongLineOfSight,
+        const double receiverDistanceAlongLineOfSight,
+        const double minimumDistance,
+        const double positiveExponent )
 {
-    double integral;
+    double lowerBound = transmitterDistanceAlongLineOfSight;
+    double upperBound = receiverDistanceAlongLineOfSight;
 
-    // If integral hasn't been computed yet
-    if ( cosinePowersIntegralsCache_.count( positiveExponent ) == 0 )
+    // Check if link ends are on same side of point closest to Sun, and (nearly) radially aligned
+    bool linkEndsOnSameSide = ( lowerBound > 0.0 && upperBound > 0.0 ) || ( lowerBound < 0.0 && upperBound < 0.0 );
+    double closestLinkEndDistance = std::min( std::fabs( lowerBound ), std::fabs( upperBound ) );
+    if( linkEndsOnSameSide && minimumDistance * minimumDistance < 1.0E-2 * closestLinkEndDistance * closestLinkEndDistance )
     {
-        if ( positiveExponent == 0 )
-        {
-            integral = upperBound - lowerBound;
-        }
-        else if ( positiveExponent == 1 )
-        {
-            integral = std::sin( upperBound ) - std::sin( lowerBound );
-        }
-        else
+        // Integrate binomial expansion of (s^2 + d^2)^(-k/2) = |s|^-k (1 + d^2/s^2)^(-k/2) term by term
+        double farthestLinkEndDistance = std::max( std::fabs( lowerBound ), std::fabs( upperBound ) );
+        double logarithmOfDistanceRatio = std::log1p(
+                    ( farthestLinkEndDistance - closestLinkEndDistance ) / closestLinkEndDistance );
+        double squaredDistanceRatio = minimumDistance * minimumDistance / ( closestLinkEndDistance * closestLinkEndDistance );
+
+        double integral = 0.0;
+        double binomialCoefficient = 1.0;
+        double distanceRatioPower = 1.0;
+        for( unsigned int n = 0; n < 50; n++ )
         {
-            std::function< double ( double ) > indefiniteIntegral = [=] ( const double x ) {
-                return ( std::pow( std::cos( x ), positiveExponent - 1.0 ) * std::sin( x ) ) / positiveExponent; };
-
-            double term1 = indefiniteIntegral( upperBound ) - indefiniteIntegral( lowerBound );
-
-            double term2 = static_cast< double >( positiveExponent - 1 ) / positiveExponent * computeCosinePowerIntegral(
-                    lowerBound, upperBound, positiveExponent - 2 );
-
-            integral = term1 + term2;
+            double integralExponent = 1.0 - positiveExponent - 2.0 * n;
+            double powerIntegral = ( integralExponent == 0.0 ) ? logarithmOfDistanceRatio :
+                                   std::expm1( integralExponent * logarithmOfDistanceRatio ) / integralExponent;
+            double currentTerm = binomialCoefficient * distanceRatioPower * powerIntegral;
+            integral += currentTerm;
+            if( std::fabs( currentTerm ) <= std::numeric_limits< double >::epsilon( ) * std::fabs( integral ) )
+            {
+                break;
+            }
+            binomialCoefficient *= ( -positiveExponent / 2.0 - n ) / ( n + 1.0 );
+            distanceRatioPower *= squaredDistanceRatio;
         }
-
-        // Set computed value of integral
-        cosinePowersIntegralsCache_[ positiveExponent ] = integral;
+        return std::pow( closestLinkEndDistance, 1.0 - positiveExponent ) * integral;
     }
-    // If integral has already been computed, use previous value
     else
     {
-        integral = cosinePowersIntegralsCache_.at( positiveExponent );
+        // Substitute s = d tan(theta): integral is d^(1-k) times integral of cos^(k-2)(theta)
+        return std::pow( minimumDistance, 1.0 - positiveExponent ) * (
+                    computeCosinePowerIntegralFromLineOfSightDistance( upperBound, minimumDistance, positiveExponent - 2.0 ) -
+                    computeCosinePowerIntegralFromLineOfSightDistance( lowerBound, minimumDistance, positiveExponent - 2.0 ) );
     }
-
-    return integral;
 }
 
+InversePowerSeriesSolarCoronaCorrection::LinkLegCache& InversePowerSeriesSolarCoronaCorrection::getLinkLegCache(
+        const unsigned int legIndex, const double transmissionTime, const double receptionTime )
+{
+    if( linkLegCaches_.size( ) <= legIndex )
+    {
+        linkLegCaches_.resize( legIndex + 1 );
+    }
+
+    // Update Sun positions only if times have changed
+    LinkLegCache& legCache = linkLegCaches_.at( legIndex );
+    if( !( legCache.transmissionTime_ == transmissionTime ) )
+    {
+        legCache.sunPositionAtTransmission_ = sunStateFunction_( transmissionTime ).segment( 0, 3 );
+        legCache.transmissionTime_ = transmissionTime;
+    }
+    if( !( legCache.receptionTime_ == receptionTime ) )
+    {
+        legCache.sunPositionAtReception_ = sunStateFunction_( receptionTime ).segment( 0, 3 );
+        legCache.receptionTime_ = receptionTime;
+    }
+    return legCache;
+}
 
 } // namespace observation_models
 
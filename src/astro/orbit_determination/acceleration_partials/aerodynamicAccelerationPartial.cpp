@@ -20,44 +20,22 @@ namespace acceleration_partials
 void AerodynamicAccelerationPartial::update( const double currentTime )
 {
     Eigen::Vector6d nominalState = vehicleStateGetFunction_( );
-    Eigen::Vector6d perturbedState;
 
-    // Compute state partial by numerical difference
-    Eigen::Vector3d upperturbedAcceleration, downperturbedAcceleration;
-    for( unsigned int i = 0; i < 6; i++ )
+    // Function that updates environment/acceleration to perturbed state, and retrieves perturbed acceleration.
+    std::function< Eigen::VectorXd( const Eigen::VectorXd& ) > perturbedAccelerationFunction =
+            [ & ]( const Eigen::VectorXd& perturbedState )
     {
-        // Perturb state upwards
-        perturbedState = nominalState;
-        perturbedState( i ) += bodyStatePerturbations_( i );
-
-        // Update environment/acceleration to perturbed state.
-        flightConditions_->resetCurrentTime( );
-        aerodynamicAcceleration_->resetCurrentTime( );
-        vehicleStateSetFunction_( perturbedState );
-        flightConditions_->updateConditions( currentTime );
-        aerodynamicAcceleration_->updateMembers( currentTime );
-
-        // Retrieve perturbed acceleration.
-        upperturbedAcceleration = aerodynamicAcceleration_->getAcceleration( );
-
-        // Perturb state downwards
-        perturbedState = nominalState;
-        perturbedState( i ) -= bodyStatePerturbations_( i );
-
-        // Update environment/acceleration to perturbed state.
         flightConditions_->resetCurrentTime( );
         aerodynamicAcceleration_->resetCurrentTime( );
         vehicleStateSetFunction_( perturbedState );
         flightConditions_->updateConditions( currentTime );
         aerodynamicAcceleration_->updateMembers( currentTime );
+        return Eigen::VectorXd( aerodynamicAcceleration_->getAcceleration( ) );
+    };
 
-        // Retrieve perturbed acceleration.
-        downperturbedAcceleration = aerodynamicAcceleration_->getAcceleration( );
-
-        // Compute partial
-        currentAccelerationStatePartials_.block( 0, i, 3, 1 ) =
-                ( upperturbedAcceleration - downperturbedAcceleration ) / ( 2.0 * bodyStatePerturbations_( i ) );
-    }
+    // Compute state partial by numerical difference
+    stateJacobianCalculator_->computeJacobian(
+                perturbedAccelerationFunction, nominalState, currentAccelerationStatePartials_ );
 
     // Reset environment/acceleration mode to nominal conditions
     flightConditions_->resetCurrentTime( );
@@ -0,0 +1,64 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "tudat/astro/orbit_determination/acceleration_partials/einsteinInfeldHoffmannPartial.h"
+
+namespace tudat
+{
+
+namespace acceleration_partials
+{
+
+//! Function for setting up and retrieving a function returning a partial w.r.t. a double parameter.
+std::pair< std::function< void( Eigen::MatrixXd& ) >, int >
+EinsteinInfeldHoffmannPartial::getParameterPartialFunction(
+        std::shared_ptr< estimatable_parameters::EstimatableParameter< double > > parameter )
+{
+    std::function< void( Eigen::MatrixXd& ) > partialFunction;
+    int numberOfRows = 0;
+
+    // Create partial function if parameter is gravitational parameter of any body in EIH equations
+    if( eihEquations_->isBodyInSet( parameter->getParameterName( ).second.first ) )
+    {
+        switch( parameter->getParameterName( ).first )
+        {
+        case estimatable_parameters::gravitational_parameter:
+            partialFunction = std::bind( &EinsteinInfeldHoffmannPartial::wrtGravitationalParameter, this,
+                                         std::placeholders::_1,
+                                         eihEquations_->getBodyIndex( parameter->getParameterName( ).second.first ) );
+            numberOfRows = 1;
+            break;
+        default:
+            break;
+        }
+    }
+    // Create partial function if parameter is PPN parameter beta or gamma
+    else if( parameter->getParameterName( ).second.first == "global_metric"  )
+    {
+        switch( parameter->getParameterName( ).first )
+        {
+        case estimatable_parameters::ppn_parameter_gamma:
+            partialFunction = std::bind( &EinsteinInfeldHoffmannPartial::wrtPpnParameterGamma, this, std::placeholders::_1 );
+            numberOfRows = 1;
+            break;
+        case estimatable_parameters::ppn_parameter_beta:
+            partialFunction = std::bind( &EinsteinInfeldHoffmannPartial::wrtPpnParameterBeta, this, std::placeholders::_1 );
+            numberOfRows = 1;
+            break;
+        default:
+            break;
+        }
+    }
+    return std::make_pair( partialFunction, numberOfRows );
+}
+
+} // namespace acceleration_partials
+
+} // namespace tudat
@@ -168,6 +168,64 @@ void VariationalEquations::setStatePartialFunctionList( )
     }
 }
 
+//! Function to set the columns of the state transition and sensitivity matrix that are to be propagated
+void VariationalEquations::setPropagatedColumns( const std::vector< int >& propagatedColumns )
+{
+    propagatedColumnBlocks_.clear( );
+    unpropagatedColumnBlocks_.clear( );
+    isColumnPropagated_.clear( );
+
+    if( propagatedColumns.size( ) == 0 )
+    {
+        return;
+    }
+
+    // Set list of propagated columns
+    isColumnPropagated_.resize( numberOfParameterValues_, false );
+    for( unsigned int i = 0; i < propagatedColumns.size( ); i++ )
+    {
+        if( propagatedColumns.at( i ) < 0 || propagatedColumns.at( i ) >= numberOfParameterValues_ )
+        {
+            throw std::runtime_error( "Error when setting propagated columns of variational equations, column " +
+                                      std::to_string( propagatedColumns.at( i ) ) + " is not in range [0," +
+                                      std::to_string( numberOfParameterValues_ ) + ")" );
+        }
+        isColumnPropagated_[ propagatedColumns.at( i ) ] = true;
+    }
+
+    // Group (un)propagated columns into contiguous blocks, not crossing the boundary between state transition and
+    // sensitivity matrix
+    int currentBlockStart = 0;
+    for( int i = 1; i <= numberOfParameterValues_; i++ )
+    {
+        if( i == numberOfParameterValues_ || i == totalDynamicalStateSize_ ||
+                isColumnPropagated_[ i ] != isColumnPropagated_[ currentBlockStart ] )
+        {
+            if( isColumnPropagated_[ currentBlockStart ] )
+            {
+                propagatedColumnBlocks_.push_back( std::make_pair( currentBlockStart, i - currentBlockStart ) );
+            }
+            else
+            {
+                unpropagatedColumnBlocks_.push_back( std::make_pair( currentBlockStart, i - currentBlockStart ) );
+            }
+            currentBlockStart = i;
+        }
+    }
+}
+
+//! Function to check whether any of the columns in a given range is propagated
+bool VariationalEquations::isAnyColumnPropagated( const int startColumn, const int numberOfColumns )
+{
+    for( int i = startColumn; i < startColumn + numberOfColumns; i++ )
+    {
+        if( isColumnPropagated_.at( i ) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
 
 } // namespace propagators
 
@@ -0,0 +1,356 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+
+#include "tudat/astro/basic_astro/physicalConstants.h"
+#include "tudat/astro/relativity/einsteinInfeldHoffmannAcceleration.h"
+
+namespace tudat
+{
+
+namespace relativity
+{
+
+//! Constructor
+EinsteinInfeldHoffmannEquations::EinsteinInfeldHoffmannEquations(
+        const std::vector< std::string >& bodyNames,
+        const std::vector< std::function< double( ) > >& gravitationalParameterFunctions,
+        const std::vector< std::function< Eigen::Vector6d( ) > >& stateFunctions,
+        const std::function< double( ) > ppnParameterGammaFunction,
+        const std::function< double( ) > ppnParameterBetaFunction ):
+    bodyNames_( bodyNames ),
+    gravitationalParameterFunctions_( gravitationalParameterFunctions ),
+    stateFunctions_( stateFunctions ),
+    ppnParameterGammaFunction_( ppnParameterGammaFunction ),
+    ppnParameterBetaFunction_( ppnParameterBetaFunction ),
+    numberOfBodies_( static_cast< int >( bodyNames.size( ) ) ),
+    currentTime_( TUDAT_NAN ),
+    currentPartialsTime_( TUDAT_NAN )
+{
+    if( gravitationalParameterFunctions_.size( ) != bodyNames_.size( ) ||
+            stateFunctions_.size( ) != bodyNames_.size( ) )
+    {
+        throw std::runtime_error( "Error when creating Einstein-Infeld-Hoffmann equations, number of bodies (" +
+                                  std::to_string( bodyNames_.size( ) ) + "), gravitational parameter functions (" +
+                                  std::to_string( gravitationalParameterFunctions_.size( ) ) + ") and state functions (" +
+                                  std::to_string( stateFunctions_.size( ) ) + ") are inconsistent" );
+    }
+
+    for( int i = 0; i < numberOfBodies_; i++ )
+    {
+        if( std::count( bodyNames_.begin( ), bodyNames_.end( ), bodyNames_.at( i ) ) > 1 )
+        {
+            throw std::runtime_error( "Error when creating Einstein-Infeld-Hoffmann equations, body " +
+                                      bodyNames_.at( i ) + " is included more than once" );
+        }
+    }
+
+    // Allocate all pairwise quantities
+    int numberOfPairs = numberOfBodies_ * numberOfBodies_;
+    gravitationalParameters_.setZero( numberOfBodies_ );
+    positions_.setZero( 3, numberOfBodies_ );
+    velocities_.setZero( 3, numberOfBodies_ );
+    relativePositions_.resize( numberOfPairs, Eigen::Vector3d::Zero( ) );
+    distances_.setZero( numberOfBodies_, numberOfBodies_ );
+    inverseCubedDistances_.setZero( numberOfBodies_, numberOfBodies_ );
+    newtonianPotentials_.setZero( numberOfBodies_ );
+    newtonianAccelerations_.setZero( 3, numberOfBodies_ );
+    scalarCorrectionFactors_.setZero( numberOfBodies_, numberOfBodies_ );
+    accelerationContributions_.resize( numberOfPairs, Eigen::Vector3d::Zero( ) );
+    totalAccelerations_.setZero( 3, numberOfBodies_ );
+
+    partialsWrtPositions_.resize( numberOfPairs, Eigen::Matrix3Xd::Zero( 3, 3 * numberOfBodies_ ) );
+    partialsWrtVelocities_.resize( numberOfPairs, Eigen::Matrix3Xd::Zero( 3, 3 * numberOfBodies_ ) );
+    partialsWrtGravitationalParameters_.resize( numberOfPairs, Eigen::Matrix3Xd::Zero( 3, numberOfBodies_ ) );
+    partialsWrtPpnParameterGamma_.resize( numberOfPairs, Eigen::Vector3d::Zero( ) );
+    partialsWrtPpnParameterBeta_.resize( numberOfPairs, Eigen::Vector3d::Zero( ) );
+}
+
+//! Function to update the accelerations of all bodies to the current time
+void EinsteinInfeldHoffmannEquations::update( const double currentTime )
+{
+    if( !( currentTime_ == currentTime ) )
+    {
+        // Retrieve current states, gravitational parameters and PPN parameters
+        ppnParameterGamma_ = ppnParameterGammaFunction_( );
+        ppnParameterBeta_ = ppnParameterBetaFunction_( );
+        for( int i = 0; i < numberOfBodies_; i++ )
+        {
+            Eigen::Vector6d currentState = stateFunctions_.at( i )( );
+            positions_.col( i ) = currentState.segment( 0, 3 );
+            velocities_.col( i ) = currentState.segment( 3, 3 );
+            gravitationalParameters_( i ) = gravitationalParameterFunctions_.at( i )( );
+        }
+
+        // Compute pairwise distances, Newtonian accelerations and potentials, using symmetry of each pair
+        newtonianPotentials_.setZero( );
+        newtonianAccelerations_.setZero( );
+        for( int i = 0; i < numberOfBodies_; i++ )
+        {
+            for( int j = i + 1; j < numberOfBodies_; j++ )
+            {
+                Eigen::Vector3d relativePosition = positions_.col( j ) - positions_.col( i );
+                double distance = relativePosition.norm( );
+                double inverseCubedDistance = 1.0 / ( distance * distance * distance );
+
+                relativePositions_[ getPairIndex( i, j ) ] = relativePosition;
+                relativePositions_[ getPairIndex( j, i ) ] = -relativePosition;
+                distances_( i, j ) = distances_( j, i ) = distance;
+                inverseCubedDistances_( i, j ) = inverseCubedDistances_( j, i ) = inverseCubedDistance;
+
+                newtonianAccelerations_.col( i ) += gravitationalParameters_( j ) * inverseCubedDistance * relativePosition;
+                newtonianAccelerations_.col( j ) -= gravitationalParameters_( i ) * inverseCubedDistance * relativePosition;
+                newtonianPotentials_( i ) += gravitationalParameters_( j ) / distance;
+                newtonianPotentials_( j ) += gravitationalParameters_( i ) / distance;
+            }
+        }
+
+        // Compute contributions of each body to the acceleration of each other body
+        double inverseSquareSpeedOfLight = physical_constants::INVERSE_SQUARE_SPEED_OF_LIGHT;
+        double gamma = ppnParameterGamma_;
+        double beta = ppnParameterBeta_;
+        Eigen::VectorXd squaredVelocities = velocities_.colwise( ).squaredNorm( ).transpose( );
+
+        totalAccelerations_.setZero( );
+        for( int i = 0; i < numberOfBodies_; i++ )
+        {
+            for( int j = 0; j < numberOfBodies_; j++ )
+            {
+                if( i == j )
+                {
+                    continue;
+                }
+
+                const Eigen::Vector3d& relativePosition = relativePositions_[ getPairIndex( i, j ) ];
+                double distance = distances_( i, j );
+                double velocityDotProduct = velocities_.col( i ).dot( velocities_.col( j ) );
+
+                // Term (r_i - r_j).v_j / r_ij
+                double radialVelocityTerm = -relativePosition.dot( velocities_.col( j ) ) / distance;
+
+                // Scalar 1PN factor multiplying Newtonian term
+                double scalarCorrectionFactor =
+                        -2.0 * ( beta + gamma ) * newtonianPotentials_( i ) -
+                        ( 2.0 * beta - 1.0 ) * newtonianPotentials_( j ) +
+                        gamma * squaredVelocities( i ) + ( 1.0 + gamma ) * squaredVelocities( j ) -
+                        2.0 * ( 1.0 + gamma ) * velocityDotProduct -
+                        1.5 * radialVelocityTerm * radialVelocityTerm +
+                        0.5 * relativePosition.dot( newtonianAccelerations_.col( j ) );
+                scalarCorrectionFactors_( i, j ) = scalarCorrectionFactor;
+
+                // Scalar factor multiplying relative velocity term
+                double velocityTermFactor = -relativePosition.dot(
+                            ( 2.0 + 2.0 * gamma ) * velocities_.col( i ) - ( 1.0 + 2.0 * gamma ) * velocities_.col( j ) );
+
+                accelerationContributions_[ getPairIndex( i, j ) ] =
+                        gravitationalParameters_( j ) * inverseCubedDistances_( i, j ) * (
+                            ( 1.0 + inverseSquareSpeedOfLight * scalarCorrectionFactor ) * relativePosition +
+                            inverseSquareSpeedOfLight * velocityTermFactor * ( velocities_.col( i ) - velocities_.col( j ) ) ) +
+                        ( 3.0 + 4.0 * gamma ) / 2.0 * inverseSquareSpeedOfLight * gravitationalParameters_( j ) / distance *
+                        newtonianAccelerations_.col( j );
+                totalAccelerations_.col( i ) += accelerationContributions_[ getPairIndex( i, j ) ];
+            }
+        }
+
+        currentTime_ = currentTime;
+    }
+}
+
+//! Function to update the partial derivatives of the accelerations to the current time
+void EinsteinInfeldHoffmannEquations::updatePartials( const double currentTime )
+{
+    update( currentTime );
+
+    if( !( currentPartialsTime_ == currentTime ) )
+    {
+        int numberOfColumns = 3 * numberOfBodies_;
+        double inverseSquareSpeedOfLight = physical_constants::INVERSE_SQUARE_SPEED_OF_LIGHT;
+        double gamma = ppnParameterGamma_;
+        double beta = ppnParameterBeta_;
+
+        // Compute partials of Newtonian pair accelerations, and of Newtonian accelerations and potentials of each body
+        // w.r.t. positions and gravitational parameters of all bodies.
+        std::vector< Eigen::Matrix3d > newtonianPairPartials(
+                    numberOfBodies_ * numberOfBodies_, Eigen::Matrix3d::Zero( ) );
+        std::vector< Eigen::Matrix3Xd > newtonianAccelerationPartials(
+                    numberOfBodies_, Eigen::Matrix3Xd::Zero( 3, numberOfColumns ) );
+        std::vector< Eigen::Matrix3Xd > newtonianAccelerationGravitationalParameterPartials(
+                    numberOfBodies_, Eigen::Matrix3Xd::Zero( 3, numberOfBodies_ ) );
+        Eigen::MatrixXd potentialPartials = Eigen::MatrixXd::Zero( numberOfBodies_, numberOfColumns );
+        Eigen::MatrixXd potentialGravitationalParameterPartials = Eigen::MatrixXd::Zero( numberOfBodies_, numberOfBodies_ );
+        for( int i = 0; i < numberOfBodies_; i++ )
+        {
+            for( int j = 0; j < numberOfBodies_; j++ )
+            {
+                if( i == j )
+                {
+                    continue;
+                }
+
+                const Eigen::Vector3d& relativePosition = relativePositions_[ getPairIndex( i, j ) ];
+                double distance = distances_( i, j );
+                double inverseCubedDistance = inverseCubedDistances_( i, j );
+
+                // Partial of mu_j * r_ij / r_ij^3 w.r.t. position of body j
+                newtonianPairPartials[ getPairIndex( i, j ) ] =
+                        gravitationalParameters_( j ) * inverseCubedDistance * (
+                            Eigen::Matrix3d::Identity( ) - 3.0 * relativePosition * relativePosition.transpose( ) /
+                            ( distance * distance ) );
+                newtonianAccelerationPartials[ i ].block( 0, 3 * j, 3, 3 ) += newtonianPairPartials[ getPairIndex( i, j ) ];
+                newtonianAccelerationPartials[ i ].block( 0, 3 * i, 3, 3 ) -= newtonianPairPartials[ getPairIndex( i, j ) ];
+                newtonianAccelerationGravitationalParameterPartials[ i ].col( j ) = inverseCubedDistance * relativePosition;
+
+                potentialPartials.block( i, 3 * j, 1, 3 ) -=
+                        gravitationalParameters_( j ) * inverseCubedDistance * relativePosition.transpose( );
+                potentialPartials.block( i, 3 * i, 1, 3 ) +=
+                        gravitationalParameters_( j ) * inverseCubedDistance * relativePosition.transpose( );
+                potentialGravitationalParameterPartials( i, j ) = 1.0 / distance;
+            }
+        }
+
+        // Compute partials of contribution of body j to acceleration of body i
+        for( int i = 0; i < numberOfBodies_; i++ )
+        {
+            for( int j = 0; j < numberOfBodies_; j++ )
+            {
+                int pairIndex = getPairIndex( i, j );
+                Eigen::Matrix3Xd& positionPartial = partialsWrtPositions_[ pairIndex ];
+                Eigen::Matrix3Xd& velocityPartial = partialsWrtVelocities_[ pairIndex ];
+                Eigen::Matrix3Xd& gravitationalParameterPartial = partialsWrtGravitationalParameters_[ pairIndex ];
+
+                positionPartial.setZero( );
+                velocityPartial.setZero( );
+                gravitationalParameterPartial.setZero( );
+                if( i == j )
+                {
+                    partialsWrtPpnParameterGamma_[ pairIndex ].setZero( );
+                    partialsWrtPpnParameterBeta_[ pairIndex ].setZero( );
+                    continue;
+                }
+
+                const Eigen::Vector3d& relativePosition = relativePositions_[ pairIndex ];
+                double distance = distances_( i, j );
+                double inverseCubedDistance = inverseCubedDistances_( i, j );
+                double gravitationalParameter = gravitationalParameters_( j );
+                double scalarCorrectionFactor = scalarCorrectionFactors_( i, j );
+
+                Eigen::Vector3d relativeVelocity = velocities_.col( i ) - velocities_.col( j );
+                Eigen::Vector3d velocityTermVector =
+                        ( 2.0 + 2.0 * gamma ) * velocities_.col( i ) - ( 1.0 + 2.0 * gamma ) * velocities_.col( j );
+                double velocityTermFactor = -relativePosition.dot( velocityTermVector );
+                double radialVelocityTerm = -relativePosition.dot( velocities_.col( j ) ) / distance;
+                double accelerationTermFactor = ( 3.0 + 4.0 * gamma ) / 2.0 * inverseSquareSpeedOfLight;
+
+                Eigen::Vector3d newtonianContribution = gravitationalParameter * inverseCubedDistance * relativePosition;
+                const Eigen::Vector3d newtonianAccelerationOfExertingBody = newtonianAccelerations_.col( j );
+
+                // Partial of scalar correction factor w.r.t. positions of all bodies
+                Eigen::RowVectorXd scalarFactorPositionPartial =
+                        -2.0 * ( beta + gamma ) * potentialPartials.row( i ) -
+                        ( 2.0 * beta - 1.0 ) * potentialPartials.row( j ) +
+                        0.5 * relativePosition.transpose( ) * newtonianAccelerationPartials[ j ];
+                Eigen::RowVector3d radialVelocityTermPartial =
+                        -velocities_.col( j ).transpose( ) / distance -
+                        radialVelocityTerm * relativePosition.transpose( ) / ( distance * distance );
+                Eigen::RowVector3d scalarFactorRelativePositionPartial =
+                        -3.0 * radialVelocityTerm * radialVelocityTermPartial +
+                        0.5 * newtonianAccelerationOfExertingBody.transpose( );
+                scalarFactorPositionPartial.segment( 3 * j, 3 ) += scalarFactorRelativePositionPartial;
+                scalarFactorPositionPartial.segment( 3 * i, 3 ) -= scalarFactorRelativePositionPartial;
+
+                // Partials of Newtonian term, multiplied by scalar correction factor
+                positionPartial = inverseSquareSpeedOfLight * newtonianContribution * scalarFactorPositionPartial;
+                Eigen::Matrix3d relativePositionPartial =
+                        ( 1.0 + inverseSquareSpeedOfLight * scalarCorrectionFactor ) * newtonianPairPartials[ pairIndex ];
+
+                // Partials of relative velocity term
+                relativePositionPartial += inverseSquareSpeedOfLight * gravitationalParameter * inverseCubedDistance *
+                        relativeVelocity * ( -velocityTermVector.transpose( ) - 3.0 * velocityTermFactor *
+                                             relativePosition.transpose( ) / ( distance * distance ) );
+
+                // Partials of Newtonian acceleration of body exerting acceleration term
+                positionPartial += accelerationTermFactor * gravitationalParameter / distance *
+                        newtonianAccelerationPartials[ j ];
+                relativePositionPartial -= accelerationTermFactor * gravitationalParameter * inverseCubedDistance *
+                        newtonianAccelerationOfExertingBody * relativePosition.transpose( );
+
+                positionPartial.block( 0, 3 * j, 3, 3 ) += relativePositionPartial;
+                positionPartial.block( 0, 3 * i, 3, 3 ) -= relativePositionPartial;
+
+                // Compute partials w.r.t. velocities
+                Eigen::RowVector3d scalarFactorVelocityPartialOfAcceleratedBody =
+                        2.0 * gamma * velocities_.col( i ).transpose( ) -
+                        2.0 * ( 1.0 + gamma ) * velocities_.col( j ).transpose( );
+                Eigen::RowVector3d scalarFactorVelocityPartialOfAcceleratingBody =
+                        -2.0 * ( 1.0 + gamma ) * relativeVelocity.transpose( ) +
+                        3.0 * radialVelocityTerm * relativePosition.transpose( ) / distance;
+                velocityPartial.block( 0, 3 * i, 3, 3 ) = inverseSquareSpeedOfLight * (
+                            newtonianContribution * scalarFactorVelocityPartialOfAcceleratedBody +
+                            gravitationalParameter * inverseCubedDistance * (
+                                -( 2.0 + 2.0 * gamma ) * relativeVelocity * relativePosition.transpose( ) +
+                                velocityTermFactor * Eigen::Matrix3d::Identity( ) ) );
+                velocityPartial.block( 0, 3 * j, 3, 3 ) = inverseSquareSpeedOfLight * (
+                            newtonianContribution * scalarFactorVelocityPartialOfAcceleratingBody +
+                            gravitationalParameter * inverseCubedDistance * (
+                                ( 1.0 + 2.0 * gamma ) * relativeVelocity * relativePosition.transpose( ) -
+                                velocityTermFactor * Eigen::Matrix3d::Identity( ) ) );
+
+                // Compute partials w.r.t. gravitational parameters
+                Eigen::RowVectorXd scalarFactorGravitationalParameterPartial =
+                        -2.0 * ( beta + gamma ) * potentialGravitationalParameterPartials.row( i ) -
+                        ( 2.0 * beta - 1.0 ) * potentialGravitationalParameterPartials.row( j ) +
+                        0.5 * relativePosition.transpose( ) * newtonianAccelerationGravitationalParameterPartials[ j ];
+                gravitationalParameterPartial =
+                        inverseSquareSpeedOfLight * newtonianContribution * scalarFactorGravitationalParameterPartial +
+                        accelerationTermFactor * gravitationalParameter / distance *
+                        newtonianAccelerationGravitationalParameterPartials[ j ];
+                gravitationalParameterPartial.col( j ) +=
+                        inverseCubedDistance * (
+                            ( 1.0 + inverseSquareSpeedOfLight * scalarCorrectionFactor ) * relativePosition +
+                            inverseSquareSpeedOfLight * velocityTermFactor * relativeVelocity ) +
+                        accelerationTermFactor / distance * newtonianAccelerationOfExertingBody;
+
+                // Compute partials w.r.t. PPN parameters
+                partialsWrtPpnParameterGamma_[ pairIndex ] = inverseSquareSpeedOfLight * (
+                            ( -2.0 * newtonianPotentials_( i ) + relativeVelocity.squaredNorm( ) ) * newtonianContribution -
+                            2.0 * gravitationalParameter * inverseCubedDistance * relativePosition.dot( relativeVelocity ) *
+                            relativeVelocity +
+                            2.0 * gravitationalParameter / distance * newtonianAccelerationOfExertingBody );
+                partialsWrtPpnParameterBeta_[ pairIndex ] = inverseSquareSpeedOfLight *
+                        ( -2.0 * newtonianPotentials_( i ) - 2.0 * newtonianPotentials_( j ) ) * newtonianContribution;
+            }
+        }
+
+        currentPartialsTime_ = currentTime;
+    }
+}
+
+//! Function to retrieve the index of a body in the list of bodies
+int EinsteinInfeldHoffmannEquations::getBodyIndex( const std::string& bodyName ) const
+{
+    std::vector< std::string >::const_iterator bodyIterator =
+            std::find( bodyNames_.begin( ), bodyNames_.end( ), bodyName );
+    if( bodyIterator == bodyNames_.end( ) )
+    {
+        throw std::runtime_error( "Error, body " + bodyName + " not found in Einstein-Infeld-Hoffmann equations" );
+    }
+    return static_cast< int >( std::distance( bodyNames_.begin( ), bodyIterator ) );
+}
+
+//! Function to retrieve whether a body is in the list of bodies
+bool EinsteinInfeldHoffmannEquations::isBodyInSet( const std::string& bodyName ) const
+{
+    return ( std::find( bodyNames_.begin( ), bodyNames_.end( ), bodyName ) != bodyNames_.end( ) );
+}
+
+} // namespace relativity
+
+} // namespace tudat
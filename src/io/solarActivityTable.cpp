@@ -0,0 +1,558 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Data file:
+ *                        http://celestrak.com/SpaceData/sw19571001.txt
+ *      Data format explanation:
+ *                        http://celestrak.com/SpaceData/SpaceWx-format.asp
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "tudat/io/solarActivityTable.h"
+
+namespace tudat
+{
+namespace input_output
+{
+namespace solar_activity
+{
+
+namespace
+{
+
+//! Identifier at start of binary solar activity table files.
+const char BINARY_FILE_IDENTIFIER[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'S', 'W', '1' };
+
+//! Start column and width of the fields in a space weather file line (see SpaceWx-format.asp).
+const int YEAR_COLUMN = 0, YEAR_WIDTH = 4;
+const int MONTH_COLUMN = 4, MONTH_WIDTH = 3;
+const int DAY_COLUMN = 7, DAY_WIDTH = 3;
+const int BARTELS_NUMBER_COLUMN = 10, BARTELS_NUMBER_WIDTH = 5;
+const int BARTELS_DAY_COLUMN = 15, BARTELS_DAY_WIDTH = 3;
+const int KP_COLUMN = 18, KP_WIDTH = 3;
+const int KP_SUM_COLUMN = 42, KP_SUM_WIDTH = 4;
+const int AP_COLUMN = 46, AP_WIDTH = 4;
+const int AP_AVERAGE_COLUMN = 78, AP_AVERAGE_WIDTH = 4;
+const int CP_COLUMN = 82, CP_WIDTH = 4;
+const int C9_COLUMN = 86, C9_WIDTH = 2;
+const int SUNSPOT_NUMBER_COLUMN = 88, SUNSPOT_NUMBER_WIDTH = 4;
+const int F107_ADJUSTED_COLUMN = 92, F107_WIDTH = 6;
+const int FLUX_QUALIFIER_COLUMN = 98, FLUX_QUALIFIER_WIDTH = 2;
+const int CENTERED_F107_ADJUSTED_COLUMN = 100;
+const int LAST_F107_ADJUSTED_COLUMN = 106;
+const int F107_OBSERVED_COLUMN = 112;
+const int CENTERED_F107_OBSERVED_COLUMN = 118;
+const int LAST_F107_OBSERVED_COLUMN = 124;
+
+//! Function to check whether a fixed-width field of a line is blank (or beyond the end of the line).
+bool isFieldBlank( const char* line, const int lineLength, const int column, const int width )
+{
+    for( int i = column; i < std::min( column + width, lineLength ); i++ )
+    {
+        if( line[ i ] != ' ' && line[ i ] != '\t' && line[ i ] != '\r' )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Function to parse a fixed-width integer field of a line (zero if blank).
+int parseIntegerField( const char* line, const int lineLength, const int column, const int width )
+{
+    int value = 0;
+    bool isNegative = false;
+    for( int i = column; i < std::min( column + width, lineLength ); i++ )
+    {
+        const char character = line[ i ];
+        if( character >= '0' && character <= '9' )
+        {
+            value = 10 * value + ( character - '0' );
+        }
+        else if( character == '-' )
+        {
+            isNegative = true;
+        }
+        else if( character != ' ' && character != '\r' && character != '\t' )
+        {
+            throw std::runtime_error( "Error when parsing space weather file, could not parse integer field in line: " +
+                                      std::string( line, lineLength ) );
+        }
+    }
+    return isNegative ? -value : value;
+}
+
+//! Function to parse a fixed-width floating point field of a line (zero if blank).
+double parseDoubleField( const char* line, const int lineLength, const int column, const int width )
+{
+    char buffer[ 16 ];
+    const int numberOfCharacters = std::max( 0, std::min( column + width, lineLength ) - column );
+    std::memcpy( buffer, line + column, numberOfCharacters );
+    buffer[ numberOfCharacters ] = '\0';
+
+    char* end;
+    double value = std::strtod( buffer, &end );
+    for( ; *end != '\0'; end++ )
+    {
+        if( *end != ' ' && *end != '\r' && *end != '\t' )
+        {
+            throw std::runtime_error( "Error when parsing space weather file, could not parse floating point field in line: " +
+                                      std::string( line, lineLength ) );
+        }
+    }
+    return value;
+}
+
+//! Function to parse a single data line of a space weather file.
+void parseSpaceWeatherLine( const char* line, const int lineLength, const unsigned int dataType,
+                            SolarActivityData& solarActivityData )
+{
+    solarActivityData = SolarActivityData( );
+    solarActivityData.year = parseIntegerField( line, lineLength, YEAR_COLUMN, YEAR_WIDTH );
+    solarActivityData.month = parseIntegerField( line, lineLength, MONTH_COLUMN, MONTH_WIDTH );
+    solarActivityData.day = parseIntegerField( line, lineLength, DAY_COLUMN, DAY_WIDTH );
+    solarActivityData.bartelsSolarRotationNumber =
+            parseIntegerField( line, lineLength, BARTELS_NUMBER_COLUMN, BARTELS_NUMBER_WIDTH );
+    solarActivityData.dayOfBartelsCycle = parseIntegerField( line, lineLength, BARTELS_DAY_COLUMN, BARTELS_DAY_WIDTH );
+
+    // Geomagnetic indices are only available for observed days.
+    if( !isFieldBlank( line, lineLength, KP_COLUMN, KP_WIDTH ) )
+    {
+        for( int i = 0; i < SolarActivityTable::NUMBER_OF_INDICES_PER_DAY; i++ )
+        {
+            solarActivityData.planetaryRangeIndexVector( i ) =
+                    parseIntegerField( line, lineLength, KP_COLUMN + i * KP_WIDTH, KP_WIDTH );
+            solarActivityData.planetaryEquivalentAmplitudeVector( i ) =
+                    parseIntegerField( line, lineLength, AP_COLUMN + i * AP_WIDTH, AP_WIDTH );
+        }
+        solarActivityData.planetaryRangeIndexSum = parseIntegerField( line, lineLength, KP_SUM_COLUMN, KP_SUM_WIDTH );
+        solarActivityData.planetaryEquivalentAmplitudeAverage =
+                parseIntegerField( line, lineLength, AP_AVERAGE_COLUMN, AP_AVERAGE_WIDTH );
+    }
+
+    if( !isFieldBlank( line, lineLength, CP_COLUMN, CP_WIDTH ) )
+    {
+        solarActivityData.planetaryDailyCharacterFigure = parseDoubleField( line, lineLength, CP_COLUMN, CP_WIDTH );
+        solarActivityData.planetaryDailyCharacterFigureConverted =
+                parseIntegerField( line, lineLength, C9_COLUMN, C9_WIDTH );
+    }
+
+    solarActivityData.internationalSunspotNumber =
+            parseIntegerField( line, lineLength, SUNSPOT_NUMBER_COLUMN, SUNSPOT_NUMBER_WIDTH );
+    solarActivityData.fluxQualifier = parseIntegerField( line, lineLength, FLUX_QUALIFIER_COLUMN, FLUX_QUALIFIER_WIDTH );
+
+    solarActivityData.solarRadioFlux107Adjusted = parseDoubleField( line, lineLength, F107_ADJUSTED_COLUMN, F107_WIDTH );
+    solarActivityData.centered81DaySolarRadioFlux107Adjusted =
+            parseDoubleField( line, lineLength, CENTERED_F107_ADJUSTED_COLUMN, F107_WIDTH );
+    solarActivityData.last81DaySolarRadioFlux107Adjusted =
+            parseDoubleField( line, lineLength, LAST_F107_ADJUSTED_COLUMN, F107_WIDTH );
+    solarActivityData.solarRadioFlux107Observed = parseDoubleField( line, lineLength, F107_OBSERVED_COLUMN, F107_WIDTH );
+    solarActivityData.centered81DaySolarRadioFlux107Observed =
+            parseDoubleField( line, lineLength, CENTERED_F107_OBSERVED_COLUMN, F107_WIDTH );
+    solarActivityData.last81DaySolarRadioFlux107Observed =
+            parseDoubleField( line, lineLength, LAST_F107_OBSERVED_COLUMN, F107_WIDTH );
+
+    solarActivityData.dataType = dataType;
+}
+
+//! Function to set the calendar date of a solar activity data entry from a (noon-based) Julian day number.
+void setCalendarDateFromJulianDayNumber( const int julianDayNumber, SolarActivityData& solarActivityData )
+{
+    int day, month, year;
+    basic_astrodynamics::convertShiftedJulianDayToCalendarDate( julianDayNumber, day, month, year );
+    solarActivityData.day = day;
+    solarActivityData.month = month;
+    solarActivityData.year = year;
+}
+
+//! Function to compute the 64-bit FNV-1a hash of a string.
+std::uint64_t computeContentsHash( const std::string& contents )
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    for( const char character : contents )
+    {
+        hash = ( hash ^ static_cast< unsigned char >( character ) ) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+//! Function to write the contents of a vector to a binary stream.
+template< typename T >
+void writeVectorToBinaryStream( std::ofstream& stream, const std::vector< T >& vector )
+{
+    stream.write( reinterpret_cast< const char* >( vector.data( ) ), vector.size( ) * sizeof( T ) );
+}
+
+//! Function to read the contents of a vector (of given size) from a binary stream.
+template< typename T >
+void readVectorFromBinaryStream( std::ifstream& stream, std::vector< T >& vector, const int size )
+{
+    vector.resize( size );
+    stream.read( reinterpret_cast< char* >( vector.data( ) ), size * sizeof( T ) );
+}
+
+} // namespace
+
+//! Constructor from map of solar activity data, as produced by readSolarActivityData.
+SolarActivityTable::SolarActivityTable( const SolarActivityDataMap& solarActivityDataMap ):
+    firstJulianDayNumber_( 0 )
+{
+    for( auto dataIterator : solarActivityDataMap )
+    {
+        addDay( *dataIterator.second );
+    }
+}
+
+//! Function to add the data of a single day to the table.
+void SolarActivityTable::addDay( const SolarActivityData& solarActivityData )
+{
+    const int julianDayNumber = basic_astrodynamics::julianDayNumberFromDate(
+                solarActivityData.year, solarActivityData.month, solarActivityData.day );
+
+    if( getNumberOfDays( ) == 0 )
+    {
+        firstJulianDayNumber_ = julianDayNumber;
+    }
+
+    const int dayIndex = julianDayNumber - firstJulianDayNumber_;
+    if( dayIndex < 0 )
+    {
+        throw std::runtime_error( "Error when adding day to solar activity table, " +
+                                  std::to_string( solarActivityData.year ) + "-" +
+                                  std::to_string( solarActivityData.month ) + "-" +
+                                  std::to_string( solarActivityData.day ) + " is before first day in table" );
+    }
+
+    // Extend table up to new day
+    const int previousNumberOfDays = getNumberOfDays( );
+    if( dayIndex >= previousNumberOfDays )
+    {
+        resizeTable( dayIndex + 1 );
+    }
+    setDayData( dayIndex, solarActivityData, true );
+
+    // Fill subsequent days that are not in file (gap up to new day, or days following an overwritten entry)
+    SolarActivityData gapDayData = solarActivityData;
+    for( int i = dayIndex + 1; i < getNumberOfDays( ) && !isDayInFile( i ); i++ )
+    {
+        setCalendarDateFromJulianDayNumber( firstJulianDayNumber_ + i, gapDayData );
+        setDayData( i, gapDayData, false );
+    }
+    if( dayIndex > previousNumberOfDays && previousNumberOfDays > 0 )
+    {
+        gapDayData = *getSolarActivityData( previousNumberOfDays - 1 );
+        for( int i = previousNumberOfDays; i < dayIndex; i++ )
+        {
+            setCalendarDateFromJulianDayNumber( firstJulianDayNumber_ + i, gapDayData );
+            setDayData( i, gapDayData, false );
+        }
+    }
+}
+
+//! Function to resize all columns of the table to the given number of days.
+void SolarActivityTable::resizeTable( const int numberOfDays )
+{
+    years_.resize( numberOfDays );
+    months_.resize( numberOfDays );
+    daysOfMonth_.resize( numberOfDays );
+    daysOfYear_.resize( numberOfDays );
+    isDayInFile_.resize( numberOfDays, 0 );
+    bartelsSolarRotationNumbers_.resize( numberOfDays );
+    daysOfBartelsCycle_.resize( numberOfDays );
+    planetaryRangeIndices_.resize( NUMBER_OF_INDICES_PER_DAY * numberOfDays );
+    planetaryRangeIndexSums_.resize( numberOfDays );
+    planetaryEquivalentAmplitudes_.resize( NUMBER_OF_INDICES_PER_DAY * numberOfDays );
+    planetaryEquivalentAmplitudeAverages_.resize( numberOfDays );
+    planetaryDailyCharacterFigures_.resize( numberOfDays );
+    planetaryDailyCharacterFiguresConverted_.resize( numberOfDays );
+    internationalSunspotNumbers_.resize( numberOfDays );
+    solarRadioFlux107Adjusted_.resize( numberOfDays );
+    fluxQualifiers_.resize( numberOfDays );
+    centered81DaySolarRadioFlux107Adjusted_.resize( numberOfDays );
+    last81DaySolarRadioFlux107Adjusted_.resize( numberOfDays );
+    solarRadioFlux107Observed_.resize( numberOfDays );
+    centered81DaySolarRadioFlux107Observed_.resize( numberOfDays );
+    last81DaySolarRadioFlux107Observed_.resize( numberOfDays );
+    dataTypes_.resize( numberOfDays );
+}
+
+//! Function to set the data of the day with the given index.
+void SolarActivityTable::setDayData( const int dayIndex, const SolarActivityData& solarActivityData,
+                                     const bool isDayInFile )
+{
+    years_[ dayIndex ] = solarActivityData.year;
+    months_[ dayIndex ] = solarActivityData.month;
+    daysOfMonth_[ dayIndex ] = solarActivityData.day;
+    daysOfYear_[ dayIndex ] = firstJulianDayNumber_ + dayIndex -
+            basic_astrodynamics::julianDayNumberFromDate( solarActivityData.year, 1, 1 ) + 1;
+    isDayInFile_[ dayIndex ] = isDayInFile;
+
+    bartelsSolarRotationNumbers_[ dayIndex ] = solarActivityData.bartelsSolarRotationNumber;
+    daysOfBartelsCycle_[ dayIndex ] = solarActivityData.dayOfBartelsCycle;
+    for( int i = 0; i < NUMBER_OF_INDICES_PER_DAY; i++ )
+    {
+        planetaryRangeIndices_[ NUMBER_OF_INDICES_PER_DAY * dayIndex + i ] =
+                solarActivityData.planetaryRangeIndexVector( i );
+        planetaryEquivalentAmplitudes_[ NUMBER_OF_INDICES_PER_DAY * dayIndex + i ] =
+                solarActivityData.planetaryEquivalentAmplitudeVector( i );
+    }
+    planetaryRangeIndexSums_[ dayIndex ] = solarActivityData.planetaryRangeIndexSum;
+    planetaryEquivalentAmplitudeAverages_[ dayIndex ] = solarActivityData.planetaryEquivalentAmplitudeAverage;
+    planetaryDailyCharacterFigures_[ dayIndex ] = solarActivityData.planetaryDailyCharacterFigure;
+    planetaryDailyCharacterFiguresConverted_[ dayIndex ] = solarActivityData.planetaryDailyCharacterFigureConverted;
+    internationalSunspotNumbers_[ dayIndex ] = solarActivityData.internationalSunspotNumber;
+    solarRadioFlux107Adjusted_[ dayIndex ] = solarActivityData.solarRadioFlux107Adjusted;
+    fluxQualifiers_[ dayIndex ] = solarActivityData.fluxQualifier;
+    centered81DaySolarRadioFlux107Adjusted_[ dayIndex ] = solarActivityData.centered81DaySolarRadioFlux107Adjusted;
+    last81DaySolarRadioFlux107Adjusted_[ dayIndex ] = solarActivityData.last81DaySolarRadioFlux107Adjusted;
+    solarRadioFlux107Observed_[ dayIndex ] = solarActivityData.solarRadioFlux107Observed;
+    centered81DaySolarRadioFlux107Observed_[ dayIndex ] = solarActivityData.centered81DaySolarRadioFlux107Observed;
+    last81DaySolarRadioFlux107Observed_[ dayIndex ] = solarActivityData.last81DaySolarRadioFlux107Observed;
+    dataTypes_[ dayIndex ] = solarActivityData.dataType;
+}
+
+//! Function to retrieve the data of the day with the given index in the format of the SolarActivityData struct.
+std::shared_ptr< SolarActivityData > SolarActivityTable::getSolarActivityData( const int dayIndex ) const
+{
+    if( dayIndex < 0 || dayIndex >= getNumberOfDays( ) )
+    {
+        throw std::runtime_error( "Error when retrieving solar activity data, day index " + std::to_string( dayIndex ) +
+                                  " is out of range" );
+    }
+
+    std::shared_ptr< SolarActivityData > solarActivityData = std::make_shared< SolarActivityData >( );
+    solarActivityData->year = years_[ dayIndex ];
+    solarActivityData->month = months_[ dayIndex ];
+    solarActivityData->day = daysOfMonth_[ dayIndex ];
+    solarActivityData->bartelsSolarRotationNumber = bartelsSolarRotationNumbers_[ dayIndex ];
+    solarActivityData->dayOfBartelsCycle = daysOfBartelsCycle_[ dayIndex ];
+    for( int i = 0; i < NUMBER_OF_INDICES_PER_DAY; i++ )
+    {
+        solarActivityData->planetaryRangeIndexVector( i ) = planetaryRangeIndices_[ NUMBER_OF_INDICES_PER_DAY * dayIndex + i ];
+        solarActivityData->planetaryEquivalentAmplitudeVector( i ) =
+                planetaryEquivalentAmplitudes_[ NUMBER_OF_INDICES_PER_DAY * dayIndex + i ];
+    }
+    solarActivityData->planetaryRangeIndexSum = planetaryRangeIndexSums_[ dayIndex ];
+    solarActivityData->planetaryEquivalentAmplitudeAverage = planetaryEquivalentAmplitudeAverages_[ dayIndex ];
+    solarActivityData->planetaryDailyCharacterFigure = planetaryDailyCharacterFigures_[ dayIndex ];
+    solarActivityData->planetaryDailyCharacterFigureConverted = planetaryDailyCharacterFiguresConverted_[ dayIndex ];
+    solarActivityData->internationalSunspotNumber = internationalSunspotNumbers_[ dayIndex ];
+    solarActivityData->solarRadioFlux107Adjusted = solarRadioFlux107Adjusted_[ dayIndex ];
+    solarActivityData->fluxQualifier = fluxQualifiers_[ dayIndex ];
+    solarActivityData->centered81DaySolarRadioFlux107Adjusted = centered81DaySolarRadioFlux107Adjusted_[ dayIndex ];
+    solarActivityData->last81DaySolarRadioFlux107Adjusted = last81DaySolarRadioFlux107Adjusted_[ dayIndex ];
+    solarActivityData->solarRadioFlux107Observed = solarRadioFlux107Observed_[ dayIndex ];
+    solarActivityData->centered81DaySolarRadioFlux107Observed = centered81DaySolarRadioFlux107Observed_[ dayIndex ];
+    solarActivityData->last81DaySolarRadioFlux107Observed = last81DaySolarRadioFlux107Observed_[ dayIndex ];
+    solarActivityData->dataType = dataTypes_[ dayIndex ];
+    return solarActivityData;
+}
+
+//! Function to convert the table to a map of SolarActivityData, containing only the days that are in the file.
+SolarActivityDataMap SolarActivityTable::getSolarActivityDataMap( ) const
+{
+    SolarActivityDataMap solarActivityDataMap;
+    for( int i = 0; i < getNumberOfDays( ); i++ )
+    {
+        if( isDayInFile( i ) )
+        {
+            solarActivityDataMap[ getJulianDay( i ) ] = getSolarActivityData( i );
+        }
+    }
+    return solarActivityDataMap;
+}
+
+//! Function to write the table to a binary file, which can be read with readFromBinaryFile.
+void SolarActivityTable::writeToBinaryFile( const std::string& filePath, const std::uint64_t sourceFileHash ) const
+{
+    std::ofstream binaryFile( filePath, std::ios::binary | std::ios::trunc );
+    if( !binaryFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing binary solar activity file, file <" + filePath +
+                                  "> cannot be opened" );
+    }
+
+    const int numberOfDays = getNumberOfDays( );
+    binaryFile.write( BINARY_FILE_IDENTIFIER, sizeof( BINARY_FILE_IDENTIFIER ) );
+    binaryFile.write( reinterpret_cast< const char* >( &sourceFileHash ), sizeof( sourceFileHash ) );
+    binaryFile.write( reinterpret_cast< const char* >( &numberOfDays ), sizeof( numberOfDays ) );
+    binaryFile.write( reinterpret_cast< const char* >( &firstJulianDayNumber_ ), sizeof( firstJulianDayNumber_ ) );
+
+    writeVectorToBinaryStream( binaryFile, years_ );
+    writeVectorToBinaryStream( binaryFile, months_ );
+    writeVectorToBinaryStream( binaryFile, daysOfMonth_ );
+    writeVectorToBinaryStream( binaryFile, daysOfYear_ );
+    writeVectorToBinaryStream( binaryFile, isDayInFile_ );
+    writeVectorToBinaryStream( binaryFile, bartelsSolarRotationNumbers_ );
+    writeVectorToBinaryStream( binaryFile, daysOfBartelsCycle_ );
+    writeVectorToBinaryStream( binaryFile, planetaryRangeIndices_ );
+    writeVectorToBinaryStream( binaryFile, planetaryRangeIndexSums_ );
+    writeVectorToBinaryStream( binaryFile, planetaryEquivalentAmplitudes_ );
+    writeVectorToBinaryStream( binaryFile, planetaryEquivalentAmplitudeAverages_ );
+    writeVectorToBinaryStream( binaryFile, planetaryDailyCharacterFigures_ );
+    writeVectorToBinaryStream( binaryFile, planetaryDailyCharacterFiguresConverted_ );
+    writeVectorToBinaryStream( binaryFile, internationalSunspotNumbers_ );
+    writeVectorToBinaryStream( binaryFile, solarRadioFlux107Adjusted_ );
+    writeVectorToBinaryStream( binaryFile, fluxQualifiers_ );
+    writeVectorToBinaryStream( binaryFile, centered81DaySolarRadioFlux107Adjusted_ );
+    writeVectorToBinaryStream( binaryFile, last81DaySolarRadioFlux107Adjusted_ );
+    writeVectorToBinaryStream( binaryFile, solarRadioFlux107Observed_ );
+    writeVectorToBinaryStream( binaryFile, centered81DaySolarRadioFlux107Observed_ );
+    writeVectorToBinaryStream( binaryFile, last81DaySolarRadioFlux107Observed_ );
+    writeVectorToBinaryStream( binaryFile, dataTypes_ );
+}
+
+//! Function to read the table from a binary file, as written by writeToBinaryFile.
+bool SolarActivityTable::readFromBinaryFile( const std::string& filePath, const std::uint64_t sourceFileHash )
+{
+    std::ifstream binaryFile( filePath, std::ios::binary | std::ios::ate );
+    if( !binaryFile.is_open( ) )
+    {
+        return false;
+    }
+    const long long binaryFileSize = static_cast< long long >( binaryFile.tellg( ) );
+    binaryFile.seekg( 0 );
+
+    // Check file identifier and hash of source file.
+    char identifier[ sizeof( BINARY_FILE_IDENTIFIER ) ];
+    std::uint64_t storedSourceFileHash;
+    int numberOfDays;
+    binaryFile.read( identifier, sizeof( identifier ) );
+    binaryFile.read( reinterpret_cast< char* >( &storedSourceFileHash ), sizeof( storedSourceFileHash ) );
+    binaryFile.read( reinterpret_cast< char* >( &numberOfDays ), sizeof( numberOfDays ) );
+    if( binaryFile.fail( ) || std::memcmp( identifier, BINARY_FILE_IDENTIFIER, sizeof( identifier ) ) != 0 ||
+            ( sourceFileHash != 0 && storedSourceFileHash != sourceFileHash ) || numberOfDays < 0 ||
+            numberOfDays > binaryFileSize )
+    {
+        return false;
+    }
+    binaryFile.read( reinterpret_cast< char* >( &firstJulianDayNumber_ ), sizeof( firstJulianDayNumber_ ) );
+
+    readVectorFromBinaryStream( binaryFile, years_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, months_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, daysOfMonth_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, daysOfYear_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, isDayInFile_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, bartelsSolarRotationNumbers_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, daysOfBartelsCycle_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, planetaryRangeIndices_, NUMBER_OF_INDICES_PER_DAY * numberOfDays );
+    readVectorFromBinaryStream( binaryFile, planetaryRangeIndexSums_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, planetaryEquivalentAmplitudes_, NUMBER_OF_INDICES_PER_DAY * numberOfDays );
+    readVectorFromBinaryStream( binaryFile, planetaryEquivalentAmplitudeAverages_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, planetaryDailyCharacterFigures_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, planetaryDailyCharacterFiguresConverted_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, internationalSunspotNumbers_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, solarRadioFlux107Adjusted_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, fluxQualifiers_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, centered81DaySolarRadioFlux107Adjusted_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, last81DaySolarRadioFlux107Adjusted_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, solarRadioFlux107Observed_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, centered81DaySolarRadioFlux107Observed_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, last81DaySolarRadioFlux107Observed_, numberOfDays );
+    readVectorFromBinaryStream( binaryFile, dataTypes_, numberOfDays );
+
+    if( binaryFile.fail( ) )
+    {
+        *this = SolarActivityTable( );
+        return false;
+    }
+    return true;
+}
+
+//! Function that reads a space weather data file into a columnar solar activity table.
+std::shared_ptr< SolarActivityTable > readSolarActivityTable(
+        const std::string& filePath, const std::string& binaryCacheFilePath )
+{
+    // Read full file contents at once.
+    std::ifstream dataFile( filePath, std::ios::binary );
+    if( !dataFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading space weather data file. Requested file: <" + filePath +
+                                  "> cannot be opened" );
+    }
+    std::stringstream fileStream;
+    fileStream << dataFile.rdbuf( );
+    const std::string fileContents = fileStream.str( );
+    dataFile.close( );
+
+    // Use binary file, if it was created from identical text file.
+    std::shared_ptr< SolarActivityTable > solarActivityTable = std::make_shared< SolarActivityTable >( );
+    std::uint64_t fileContentsHash = 0;
+    if( binaryCacheFilePath != "" )
+    {
+        fileContentsHash = computeContentsHash( fileContents );
+        if( solarActivityTable->readFromBinaryFile( binaryCacheFilePath, fileContentsHash ) )
+        {
+            return solarActivityTable;
+        }
+    }
+
+    // Parse lines in data sections of file (observed/daily predicted/monthly predicted/monthly fit).
+    static const std::vector< std::string > dataSectionNames =
+    { "OBSERVED", "DAILY_PREDICTED", "MONTHLY_PREDICTED", "MONTHLY_FIT" };
+
+    SolarActivityData solarActivityData;
+    unsigned int dataType = 0;
+    std::size_t lineStart = 0;
+    while( lineStart < fileContents.size( ) )
+    {
+        std::size_t lineEnd = fileContents.find( '\n', lineStart );
+        if( lineEnd == std::string::npos )
+        {
+            lineEnd = fileContents.size( );
+        }
+        const char* line = fileContents.data( ) + lineStart;
+        const int lineLength = static_cast< int >( lineEnd - lineStart );
+
+        if( lineLength >= 4 && ( std::strncmp( line, "BEGIN ", 6 ) == 0 || std::strncmp( line, "END ", 4 ) == 0 ) )
+        {
+            const bool isSectionStart = ( line[ 0 ] == 'B' );
+            const std::string sectionName = fileContents.substr( lineStart + ( isSectionStart ? 6 : 4 ),
+                                                                 lineLength - ( isSectionStart ? 6 : 4 ) );
+            dataType = 0;
+            for( unsigned int i = 0; i < dataSectionNames.size( ); i++ )
+            {
+                if( isSectionStart && sectionName.compare( 0, dataSectionNames.at( i ).size( ), dataSectionNames.at( i ) ) == 0 )
+                {
+                    dataType = i + 1;
+                }
+            }
+        }
+        else if( dataType != 0 && !isFieldBlank( line, lineLength, 0, lineLength ) )
+        {
+            parseSpaceWeatherLine( line, lineLength, dataType, solarActivityData );
+            solarActivityTable->addDay( solarActivityData );
+        }
+
+        lineStart = lineEnd + 1;
+    }
+
+    // Write binary file; failure to do so (e.g. for a read-only directory) only means the text file is parsed next time.
+    if( binaryCacheFilePath != "" )
+    {
+        try
+        {
+            solarActivityTable->writeToBinaryFile( binaryCacheFilePath, fileContentsHash );
+        }
+        catch( const std::runtime_error& )
+        { }
+    }
+
+    return solarActivityTable;
+}
+
+} // namespace solar_activity
+} // namespace input_output
+} // namespace tudat
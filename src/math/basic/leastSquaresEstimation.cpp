@@ -9,8 +9,10 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <string>
 
 #include <Eigen/LU>
 
@@ -138,6 +140,41 @@ Eigen::MatrixXd calculateConsiderParametersCovarianceContribution(
     * ( considerDesignMatrix.transpose( ) * covarianceTimesWeightedPartials.transpose( ) );
 }
 
+//! Function to compute inverse of covariance matrix at current iteration as a tiled symmetric matrix
+void calculateTiledInverseOfUpdatedCovarianceMatrix(
+        TiledSymmetricMatrix& inverseOfCovarianceMatrix,
+        const Eigen::MatrixXd& designMatrix,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const int numberOfRowsPerBlock )
+{
+    int numberOfObservations = designMatrix.rows( );
+    if( inverseOfCovarianceMatrix.getMatrixSize( ) != designMatrix.cols( ) ||
+            diagonalOfWeightMatrix.rows( ) != numberOfObservations )
+    {
+        throw std::runtime_error( "Error when computing tiled inverse covariance, sizes are inconsistent" );
+    }
+
+    if( numberOfRowsPerBlock <= 0 )
+    {
+        throw std::runtime_error( "Error when computing tiled inverse covariance, number of rows per block must be positive" );
+    }
+
+    inverseOfCovarianceMatrix.setZero( );
+    for( int i = 0; i < numberOfObservations; i += numberOfRowsPerBlock )
+    {
+        int currentNumberOfRows = std::min( numberOfRowsPerBlock, numberOfObservations - i );
+        inverseOfCovarianceMatrix.addWeightedDesignMatrixRows(
+                    designMatrix.middleRows( i, currentNumberOfRows ),
+                    diagonalOfWeightMatrix.segment( i, currentNumberOfRows ) );
+    }
+
+    if( inverseOfAPrioriCovarianceMatrix.rows( ) != 0 )
+    {
+        inverseOfCovarianceMatrix.addSymmetricMatrix( inverseOfAPrioriCovarianceMatrix );
+    }
+}
+
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
 //! information
 std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromDesignMatrix(
@@ -205,6 +242,361 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromD
                 limitConditionNumberForWarning );
 }
 
+//! Function to determine which estimated parameters are local to a single arc of observations
+std::vector< std::vector< int > > getArcLocalParameterIndices(
+        const Eigen::MatrixXd& designMatrix,
+        const std::vector< std::vector< int > >& arcObservationIndices,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix )
+{
+    int numberOfObservations = designMatrix.rows( );
+    int numberOfParameters = designMatrix.cols( );
+    int numberOfArcs = static_cast< int >( arcObservationIndices.size( ) );
+
+    // Retrieve arc index of each observation (-1 if not in any arc)
+    std::vector< int > observationArcIndices( numberOfObservations, -1 );
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        for( const int observationIndex : arcObservationIndices.at( i ) )
+        {
+            if( observationIndex < 0 || observationIndex >= numberOfObservations )
+            {
+                throw std::runtime_error( "Error when determining arc-local parameters, observation index " +
+                                          std::to_string( observationIndex ) + " is out of bounds" );
+            }
+            if( observationArcIndices.at( observationIndex ) != -1 )
+            {
+                throw std::runtime_error( "Error when determining arc-local parameters, observation index " +
+                                          std::to_string( observationIndex ) + " is in more than one arc" );
+            }
+            observationArcIndices.at( observationIndex ) = i;
+        }
+    }
+
+    // Determine arc of each parameter: -1 if no non-zero partials, -2 if non-zero partials not in single arc
+    std::vector< int > parameterArcIndices( numberOfParameters, -1 );
+    for( int j = 0; j < numberOfParameters; j++ )
+    {
+        for( int i = 0; i < numberOfObservations; i++ )
+        {
+            if( designMatrix( i, j ) != 0.0 )
+            {
+                if( observationArcIndices.at( i ) == -1 ||
+                        ( parameterArcIndices.at( j ) != -1 && parameterArcIndices.at( j ) != observationArcIndices.at( i ) ) )
+                {
+                    parameterArcIndices.at( j ) = -2;
+                    break;
+                }
+                parameterArcIndices.at( j ) = observationArcIndices.at( i );
+            }
+        }
+    }
+
+    // Set parameters that are a priori correlated with local parameters of another arc as global
+    if( inverseOfAPrioriCovarianceMatrix.rows( ) != 0 )
+    {
+        if( inverseOfAPrioriCovarianceMatrix.rows( ) != numberOfParameters ||
+                inverseOfAPrioriCovarianceMatrix.cols( ) != numberOfParameters )
+        {
+            throw std::runtime_error( "Error when determining arc-local parameters, a priori covariance size is inconsistent" );
+        }
+
+        std::vector< bool > isCorrelatedWithOtherArc( numberOfParameters, false );
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            for( int k = j + 1; k < numberOfParameters; k++ )
+            {
+                if( parameterArcIndices.at( j ) >= 0 && parameterArcIndices.at( k ) >= 0 &&
+                        parameterArcIndices.at( j ) != parameterArcIndices.at( k ) &&
+                        ( inverseOfAPrioriCovarianceMatrix( j, k ) != 0.0 || inverseOfAPrioriCovarianceMatrix( k, j ) != 0.0 ) )
+                {
+                    isCorrelatedWithOtherArc.at( j ) = true;
+                    isCorrelatedWithOtherArc.at( k ) = true;
+                }
+            }
+        }
+
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            if( isCorrelatedWithOtherArc.at( j ) )
+            {
+                parameterArcIndices.at( j ) = -2;
+            }
+        }
+    }
+
+    std::vector< std::vector< int > > arcLocalParameterIndices( numberOfArcs );
+    for( int j = 0; j < numberOfParameters; j++ )
+    {
+        if( parameterArcIndices.at( j ) >= 0 )
+        {
+            arcLocalParameterIndices.at( parameterArcIndices.at( j ) ).push_back( j );
+        }
+    }
+    return arcLocalParameterIndices;
+}
+
+//! Function to perform an iteration of least squares estimation, eliminating arc-local parameters arc-by-arc
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performArcwiseReducedLeastSquaresAdjustment(
+        const Eigen::MatrixXd& designMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const std::vector< std::vector< int > >& arcObservationIndices,
+        const std::vector< std::vector< int > >& arcLocalParameterIndices,
+        const double limitConditionNumberForWarning,
+        const Eigen::MatrixXd& designMatrixConsiderParameters,
+        const Eigen::VectorXd& considerParametersDeviations )
+{
+    int numberOfObservations = designMatrix.rows( );
+    int numberOfParameters = designMatrix.cols( );
+    int numberOfArcs = static_cast< int >( arcObservationIndices.size( ) );
+    bool useAprioriCovariance = ( inverseOfAPrioriCovarianceMatrix.rows( ) != 0 );
+
+    if( static_cast< int >( arcLocalParameterIndices.size( ) ) != numberOfArcs )
+    {
+        throw std::runtime_error( "Error when performing arc-wise reduced least-squares, number of arcs is inconsistent" );
+    }
+
+    if( observationResiduals.rows( ) != numberOfObservations || diagonalOfWeightMatrix.rows( ) != numberOfObservations )
+    {
+        throw std::runtime_error( "Error when performing arc-wise reduced least-squares, number of observations is inconsistent" );
+    }
+
+    if( useAprioriCovariance && ( inverseOfAPrioriCovarianceMatrix.rows( ) != numberOfParameters ||
+                                  inverseOfAPrioriCovarianceMatrix.cols( ) != numberOfParameters ) )
+    {
+        throw std::runtime_error( "Error when performing arc-wise reduced least-squares, a priori covariance size is inconsistent" );
+    }
+
+    // Compute (weighted) residuals, including contribution of consider parameters
+    Eigen::VectorXd weightedResiduals;
+    if ( considerParametersDeviations.size( ) > 0 && designMatrixConsiderParameters.size( ) > 0 )
+    {
+        weightedResiduals = diagonalOfWeightMatrix.cwiseProduct(
+                    observationResiduals + designMatrixConsiderParameters * considerParametersDeviations );
+    }
+    else
+    {
+        weightedResiduals = diagonalOfWeightMatrix.cwiseProduct( observationResiduals );
+    }
+
+    // Determine global parameter indices
+    std::vector< bool > isParameterLocal( numberOfParameters, false );
+    for( const std::vector< int >& localParameterIndices : arcLocalParameterIndices )
+    {
+        for( const int parameterIndex : localParameterIndices )
+        {
+            if( parameterIndex < 0 || parameterIndex >= numberOfParameters || isParameterLocal.at( parameterIndex ) )
+            {
+                throw std::runtime_error( "Error when performing arc-wise reduced least-squares, local parameter index " +
+                                          std::to_string( parameterIndex ) + " is invalid or in more than one arc" );
+            }
+            isParameterLocal.at( parameterIndex ) = true;
+        }
+    }
+
+    std::vector< int > globalParameterIndices;
+    for( int j = 0; j < numberOfParameters; j++ )
+    {
+        if( !isParameterLocal.at( j ) )
+        {
+            globalParameterIndices.push_back( j );
+        }
+    }
+    int numberOfGlobalParameters = static_cast< int >( globalParameterIndices.size( ) );
+
+    // Compute normal equations of global parameters (local parameters have zero partials outside their arc, so all
+    // observations are included at once)
+    Eigen::MatrixXd globalDesignMatrix = Eigen::MatrixXd( numberOfObservations, numberOfGlobalParameters );
+    for( int j = 0; j < numberOfGlobalParameters; j++ )
+    {
+        globalDesignMatrix.col( j ) = designMatrix.col( globalParameterIndices.at( j ) );
+    }
+
+    Eigen::MatrixXd globalNormalMatrix = globalDesignMatrix.transpose( ) *
+            multiplyDesignMatrixByDiagonalWeightMatrix( globalDesignMatrix, diagonalOfWeightMatrix );
+    Eigen::VectorXd globalRightHandSide = globalDesignMatrix.transpose( ) * weightedResiduals;
+    if( useAprioriCovariance )
+    {
+        for( int j = 0; j < numberOfGlobalParameters; j++ )
+        {
+            for( int k = 0; k < numberOfGlobalParameters; k++ )
+            {
+                globalNormalMatrix( j, k ) += inverseOfAPrioriCovarianceMatrix(
+                            globalParameterIndices.at( j ), globalParameterIndices.at( k ) );
+            }
+        }
+    }
+
+    Eigen::MatrixXd reducedNormalMatrix = globalNormalMatrix;
+    Eigen::VectorXd reducedRightHandSide = globalRightHandSide;
+
+    // Eliminate local parameters of each arc
+    std::vector< Eigen::MatrixXd > localNormalMatrices( numberOfArcs );
+    std::vector< Eigen::MatrixXd > localGlobalNormalMatrices( numberOfArcs );
+    std::vector< Eigen::MatrixXd > eliminationMatrices( numberOfArcs );
+    std::vector< Eigen::VectorXd > eliminationVectors( numberOfArcs );
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        const std::vector< int >& currentObservationIndices = arcObservationIndices.at( i );
+        const std::vector< int >& currentLocalParameterIndices = arcLocalParameterIndices.at( i );
+        int numberOfArcObservations = static_cast< int >( currentObservationIndices.size( ) );
+        int numberOfLocalParameters = static_cast< int >( currentLocalParameterIndices.size( ) );
+        if( numberOfLocalParameters == 0 )
+        {
+            continue;
+        }
+
+        // Retrieve partials, weights and residuals of current arc
+        Eigen::MatrixXd localDesignMatrix = Eigen::MatrixXd( numberOfArcObservations, numberOfLocalParameters );
+        Eigen::MatrixXd arcGlobalDesignMatrix = Eigen::MatrixXd( numberOfArcObservations, numberOfGlobalParameters );
+        Eigen::VectorXd arcWeights = Eigen::VectorXd( numberOfArcObservations );
+        Eigen::VectorXd arcWeightedResiduals = Eigen::VectorXd( numberOfArcObservations );
+        for( int k = 0; k < numberOfArcObservations; k++ )
+        {
+            int observationIndex = currentObservationIndices.at( k );
+            for( int j = 0; j < numberOfLocalParameters; j++ )
+            {
+                localDesignMatrix( k, j ) = designMatrix( observationIndex, currentLocalParameterIndices.at( j ) );
+            }
+            arcGlobalDesignMatrix.row( k ) = globalDesignMatrix.row( observationIndex );
+            arcWeights( k ) = diagonalOfWeightMatrix( observationIndex );
+            arcWeightedResiduals( k ) = weightedResiduals( observationIndex );
+        }
+
+        // Compute normal equations of arc
+        Eigen::MatrixXd weightedLocalDesignMatrix = multiplyDesignMatrixByDiagonalWeightMatrix( localDesignMatrix, arcWeights );
+        localNormalMatrices[ i ] = localDesignMatrix.transpose( ) * weightedLocalDesignMatrix;
+        localGlobalNormalMatrices[ i ] = weightedLocalDesignMatrix.transpose( ) * arcGlobalDesignMatrix;
+        Eigen::VectorXd localRightHandSide = localDesignMatrix.transpose( ) * arcWeightedResiduals;
+        if( useAprioriCovariance )
+        {
+            for( int j = 0; j < numberOfLocalParameters; j++ )
+            {
+                for( int k = 0; k < numberOfLocalParameters; k++ )
+                {
+                    localNormalMatrices[ i ]( j, k ) += inverseOfAPrioriCovarianceMatrix(
+                                currentLocalParameterIndices.at( j ), currentLocalParameterIndices.at( k ) );
+                }
+                for( int k = 0; k < numberOfGlobalParameters; k++ )
+                {
+                    localGlobalNormalMatrices[ i ]( j, k ) += inverseOfAPrioriCovarianceMatrix(
+                                currentLocalParameterIndices.at( j ), globalParameterIndices.at( k ) );
+                }
+            }
+        }
+
+        // Eliminate local parameters, and update reduced normal equations with Schur complement
+        Eigen::JacobiSVD< Eigen::MatrixXd > localSvdDecomposition = localNormalMatrices[ i ].jacobiSvd(
+                    Eigen::ComputeThinU | Eigen::ComputeThinV );
+        if( limitConditionNumberForWarning == limitConditionNumberForWarning )
+        {
+            double conditionNumber = getConditionNumberOfDecomposedMatrix( localSvdDecomposition );
+            if( conditionNumber > limitConditionNumberForWarning )
+            {
+                std::cerr << "Warning when performing least squares, condition number for local parameters of arc " << i
+                          << " is " << conditionNumber << std::endl;
+            }
+        }
+        eliminationMatrices[ i ] = localSvdDecomposition.solve( localGlobalNormalMatrices[ i ] );
+        eliminationVectors[ i ] = localSvdDecomposition.solve( localRightHandSide );
+
+        reducedNormalMatrix.noalias( ) -= localGlobalNormalMatrices[ i ].transpose( ) * eliminationMatrices[ i ];
+        reducedRightHandSide.noalias( ) -= localGlobalNormalMatrices[ i ].transpose( ) * eliminationVectors[ i ];
+    }
+
+    // Solve reduced system for global parameters
+    Eigen::VectorXd globalSolution = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+    if( numberOfGlobalParameters > 0 )
+    {
+        globalSolution = solveSystemOfEquationsWithSvd(
+                    reducedNormalMatrix, reducedRightHandSide, limitConditionNumberForWarning );
+    }
+
+    // Recover local parameters by back-substitution, and assemble full solution and inverse covariance
+    Eigen::VectorXd solution = Eigen::VectorXd::Zero( numberOfParameters );
+    Eigen::MatrixXd inverseOfCovarianceMatrix = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    for( int j = 0; j < numberOfGlobalParameters; j++ )
+    {
+        solution( globalParameterIndices.at( j ) ) = globalSolution( j );
+        for( int k = 0; k < numberOfGlobalParameters; k++ )
+        {
+            inverseOfCovarianceMatrix( globalParameterIndices.at( j ), globalParameterIndices.at( k ) ) =
+                    globalNormalMatrix( j, k );
+        }
+    }
+
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        const std::vector< int >& currentLocalParameterIndices = arcLocalParameterIndices.at( i );
+        int numberOfLocalParameters = static_cast< int >( currentLocalParameterIndices.size( ) );
+        if( numberOfLocalParameters == 0 )
+        {
+            continue;
+        }
+
+        Eigen::VectorXd localSolution = eliminationVectors[ i ] - eliminationMatrices[ i ] * globalSolution;
+        for( int j = 0; j < numberOfLocalParameters; j++ )
+        {
+            int parameterIndex = currentLocalParameterIndices.at( j );
+            solution( parameterIndex ) = localSolution( j );
+            for( int k = 0; k < numberOfLocalParameters; k++ )
+            {
+                inverseOfCovarianceMatrix( parameterIndex, currentLocalParameterIndices.at( k ) ) =
+                        localNormalMatrices[ i ]( j, k );
+            }
+            for( int k = 0; k < numberOfGlobalParameters; k++ )
+            {
+                inverseOfCovarianceMatrix( parameterIndex, globalParameterIndices.at( k ) ) =
+                        localGlobalNormalMatrices[ i ]( j, k );
+                inverseOfCovarianceMatrix( globalParameterIndices.at( k ), parameterIndex ) =
+                        localGlobalNormalMatrices[ i ]( j, k );
+            }
+        }
+    }
+
+    return std::make_pair( solution, inverseOfCovarianceMatrix );
+}
+
+//! Function to perform an iteration of least squares estimation, solving the normal equations with a tiled Cholesky decomposition
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performTiledLeastSquaresAdjustment(
+        const Eigen::MatrixXd& designMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const int tileSize,
+        const std::string& storageFile,
+        const int numberOfThreads,
+        const Eigen::MatrixXd& designMatrixConsiderParameters,
+        const Eigen::VectorXd& considerParametersDeviations )
+{
+    if( observationResiduals.rows( ) != designMatrix.rows( ) )
+    {
+        throw std::runtime_error( "Error when performing tiled least-squares, number of observations is inconsistent" );
+    }
+
+    // Compute right-hand side of normal equations
+    Eigen::VectorXd weightedResiduals;
+    if ( considerParametersDeviations.size( ) > 0 && designMatrixConsiderParameters.size( ) > 0 )
+    {
+        weightedResiduals = diagonalOfWeightMatrix.cwiseProduct(
+                    observationResiduals + designMatrixConsiderParameters * considerParametersDeviations );
+    }
+    else
+    {
+        weightedResiduals = diagonalOfWeightMatrix.cwiseProduct( observationResiduals );
+    }
+    Eigen::VectorXd rightHandSide = designMatrix.transpose( ) * weightedResiduals;
+
+    // Accumulate normal matrix, and retrieve (dense) inverse covariance before it is overwritten by its decomposition
+    TiledSymmetricMatrix inverseOfCovarianceMatrix( designMatrix.cols( ), tileSize, storageFile, numberOfThreads );
+    calculateTiledInverseOfUpdatedCovarianceMatrix(
+                inverseOfCovarianceMatrix, designMatrix, diagonalOfWeightMatrix, inverseOfAPrioriCovarianceMatrix );
+    Eigen::MatrixXd denseInverseOfCovarianceMatrix = inverseOfCovarianceMatrix.getDenseMatrix( );
+
+    return std::make_pair( inverseOfCovarianceMatrix.solve( rightHandSide ), denseInverseOfCovarianceMatrix );
+}
+
 Eigen::VectorXd evaluatePolynomial(
     const Eigen::VectorXd& independentValues,
     const Eigen::VectorXd& polynomialCoefficients,
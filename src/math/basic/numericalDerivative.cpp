@@ -15,6 +15,8 @@
  *
  */
 
+#include <cmath>
+
 #include "tudat/math/basic/numericalDerivative.h"
 
 namespace tudat
@@ -83,6 +85,114 @@ Eigen::MatrixXd computeCentralDifference( const Eigen::VectorXd& input, const st
     return result;
 }
 
+//! Function to compute the Jacobian of a function at a given input.
+void CentralDifferenceJacobianCalculator::computeJacobian(
+        const std::function< Eigen::VectorXd( const Eigen::VectorXd& ) >& function,
+        const Eigen::VectorXd& nominalInput,
+        Eigen::Ref< Eigen::MatrixXd > jacobian )
+{
+    if( nominalInput.rows( ) != stepSizes_.rows( ) || jacobian.cols( ) != stepSizes_.rows( ) )
+    {
+        throw std::runtime_error( "Error when computing central difference Jacobian; sizes of input (" +
+                                  std::to_string( nominalInput.rows( ) ) + "), Jacobian (" +
+                                  std::to_string( jacobian.cols( ) ) + ") and step sizes (" +
+                                  std::to_string( stepSizes_.rows( ) ) + ") are inconsistent" );
+    }
+
+    // Check if step sizes are to be updated during this call
+    bool updateStepSizes = false;
+    if( stepSizeUpdateInterval_ > 0 )
+    {
+        if( !stepSizesAreSelected_ || numberOfCallsSinceUpdate_ >= stepSizeUpdateInterval_ )
+        {
+            updateStepSizes = true;
+            numberOfCallsSinceUpdate_ = 0;
+            stepSizesAreSelected_ = true;
+            estimatedTruncationErrors_.setZero( stepSizes_.rows( ) );
+        }
+        numberOfCallsSinceUpdate_++;
+    }
+
+    perturbedInput_ = nominalInput;
+    for( int i = 0; i < nominalInput.rows( ); i++ )
+    {
+        if( updateStepSizes )
+        {
+            computeColumnAndSelectStepSize( function, i, jacobian );
+        }
+        else
+        {
+            perturbedInput_( i ) += stepSizes_( i );
+            jacobian.col( i ) = function( perturbedInput_ );
+            perturbedInput_( i ) -= 2.0 * stepSizes_( i );
+            jacobian.col( i ) -= function( perturbedInput_ );
+            jacobian.col( i ) /= ( 2.0 * stepSizes_( i ) );
+        }
+        perturbedInput_( i ) = nominalInput( i );
+    }
+}
+
+//! Function to compute the Jacobian of a function at a given input (see other overload).
+Eigen::MatrixXd CentralDifferenceJacobianCalculator::computeJacobian(
+        const std::function< Eigen::VectorXd( const Eigen::VectorXd& ) >& function,
+        const Eigen::VectorXd& nominalInput )
+{
+    Eigen::MatrixXd jacobian;
+    if( nominalInput.rows( ) > 0 )
+    {
+        // Evaluate first column separately to determine number of rows
+        perturbedInput_ = nominalInput;
+        perturbedInput_( 0 ) += stepSizes_( 0 );
+        Eigen::VectorXd firstOutput = function( perturbedInput_ );
+        jacobian.setZero( firstOutput.rows( ), nominalInput.rows( ) );
+    }
+    computeJacobian( function, nominalInput, jacobian );
+    return jacobian;
+}
+
+//! Function to compute a single Jacobian column, and select a new step size for it
+void CentralDifferenceJacobianCalculator::computeColumnAndSelectStepSize(
+        const std::function< Eigen::VectorXd( const Eigen::VectorXd& ) >& function,
+        const int columnIndex,
+        Eigen::Ref< Eigen::MatrixXd > jacobian )
+{
+    double nominalValue = perturbedInput_( columnIndex );
+    double stepSize = stepSizes_( columnIndex );
+
+    // Compute central differences with full and half step size
+    perturbedInput_( columnIndex ) = nominalValue + stepSize;
+    Eigen::VectorXd upPerturbedOutput = function( perturbedInput_ );
+    perturbedInput_( columnIndex ) = nominalValue - stepSize;
+    Eigen::VectorXd downPerturbedOutput = function( perturbedInput_ );
+    Eigen::VectorXd fullStepDifference = ( upPerturbedOutput - downPerturbedOutput ) / ( 2.0 * stepSize );
+
+    perturbedInput_( columnIndex ) = nominalValue + stepSize / 2.0;
+    Eigen::VectorXd halfStepDifference = function( perturbedInput_ );
+    perturbedInput_( columnIndex ) = nominalValue - stepSize / 2.0;
+    halfStepDifference -= function( perturbedInput_ );
+    halfStepDifference /= stepSize;
+
+    // Use Richardson extrapolation of the two central differences as Jacobian column
+    jacobian.col( columnIndex ) = ( 4.0 * halfStepDifference - fullStepDifference ) / 3.0;
+
+    // Estimate truncation error (c h^2) of full-step central difference, and rounding error coefficient
+    double truncationError = 4.0 / 3.0 * ( fullStepDifference - halfStepDifference ).norm( );
+    double functionNoise = relativeFunctionNoise_ *
+            std::max( upPerturbedOutput.norm( ), downPerturbedOutput.norm( ) );
+    estimatedTruncationErrors_( columnIndex ) = truncationError;
+
+    // Select step size that minimizes the sum of truncation (c h^2) and rounding (noise / h) errors
+    if( truncationError > 0.0 && functionNoise > 0.0 )
+    {
+        double truncationErrorCoefficient = truncationError / ( stepSize * stepSize );
+        double optimalStepSize = std::cbrt( functionNoise / ( 2.0 * truncationErrorCoefficient ) );
+        double initialStepSize = std::fabs( initialStepSizes_( columnIndex ) );
+        optimalStepSize = std::min( std::max( optimalStepSize, minimumStepSizeFactor_ * initialStepSize ),
+                                    maximumStepSizeFactor_ * initialStepSize );
+        stepSizes_( columnIndex ) = optimalStepSize;
+    }
+}
+
 } // namespace numerical_derivatives
 
 } // namespace tudat
@@ -0,0 +1,403 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+#include <Eigen/Cholesky>
+
+#include <boost/interprocess/file_mapping.hpp>
+
+#include "tudat/math/basic/tiledSymmetricMatrix.h"
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Constructor
+TiledSymmetricMatrix::TiledSymmetricMatrix( const int matrixSize,
+                                            const int tileSize,
+                                            const std::string& storageFile,
+                                            const int numberOfThreads,
+                                            const bool removeStorageFile ):
+    matrixSize_( matrixSize ), tileSize_( tileSize ), storageFile_( storageFile ),
+    numberOfThreads_( std::max( numberOfThreads, 1 ) ), removeStorageFile_( removeStorageFile ),
+    tileData_( nullptr ), isDecomposed_( false ), hasDecompositionFailed_( false )
+{
+    if( matrixSize_ <= 0 || tileSize_ <= 0 )
+    {
+        throw std::runtime_error( "Error when creating tiled symmetric matrix, matrix and tile size must be positive" );
+    }
+    numberOfTiles_ = ( matrixSize_ + tileSize_ - 1 ) / tileSize_;
+
+    // Compute offsets of tiles in lower triangle
+    tileOffsets_.resize( numberOfTiles_ * numberOfTiles_ );
+    std::size_t currentOffset = 0;
+    for( int j = 0; j < numberOfTiles_; j++ )
+    {
+        for( int i = j; i < numberOfTiles_; i++ )
+        {
+            tileOffsets_[ i * numberOfTiles_ + j ] = currentOffset;
+            currentOffset += static_cast< std::size_t >( getCurrentTileSize( i ) ) *
+                    static_cast< std::size_t >( getCurrentTileSize( j ) );
+        }
+    }
+
+    // Allocate tile storage
+    if( storageFile_ == "" )
+    {
+        inMemoryTileData_.resize( currentOffset );
+        tileData_ = inMemoryTileData_.data( );
+    }
+    else
+    {
+        std::size_t storageSize = currentOffset * sizeof( double );
+        {
+            std::ofstream storageStream( storageFile_, std::ios::binary | std::ios::trunc );
+            if( !storageStream.good( ) )
+            {
+                throw std::runtime_error( "Error when creating tiled symmetric matrix, could not create file " + storageFile_ );
+            }
+            storageStream.seekp( storageSize - 1 );
+            storageStream.put( 0 );
+        }
+        boost::interprocess::file_mapping fileMapping( storageFile_.c_str( ), boost::interprocess::read_write );
+        mappedRegion_ = std::make_unique< boost::interprocess::mapped_region >(
+                    fileMapping, boost::interprocess::read_write, 0, storageSize );
+        tileData_ = static_cast< double* >( mappedRegion_->get_address( ) );
+    }
+
+    setZero( );
+}
+
+//! Destructor, removes storage file (if requested)
+TiledSymmetricMatrix::~TiledSymmetricMatrix( )
+{
+    mappedRegion_.reset( );
+    if( storageFile_ != "" && removeStorageFile_ )
+    {
+        std::remove( storageFile_.c_str( ) );
+    }
+}
+
+//! Function to retrieve a tile on or below the diagonal
+Eigen::Map< Eigen::MatrixXd > TiledSymmetricMatrix::getTile( const int rowTileIndex, const int columnTileIndex )
+{
+    if( columnTileIndex > rowTileIndex || rowTileIndex >= numberOfTiles_ || columnTileIndex < 0 )
+    {
+        throw std::runtime_error( "Error when retrieving tile of symmetric matrix, tile (" + std::to_string( rowTileIndex ) +
+                                  ", " + std::to_string( columnTileIndex ) + ") is not on or below the diagonal" );
+    }
+    return Eigen::Map< Eigen::MatrixXd >(
+                tileData_ + tileOffsets_[ rowTileIndex * numberOfTiles_ + columnTileIndex ],
+                getCurrentTileSize( rowTileIndex ), getCurrentTileSize( columnTileIndex ) );
+}
+
+//! Function to set all entries of the matrix to zero (and reset its decomposition status)
+void TiledSymmetricMatrix::setZero( )
+{
+    for( int j = 0; j < numberOfTiles_; j++ )
+    {
+        for( int i = j; i < numberOfTiles_; i++ )
+        {
+            getTile( i, j ).setZero( );
+        }
+    }
+    isDecomposed_ = false;
+    hasDecompositionFailed_ = false;
+}
+
+//! Function to check that the matrix can be used (i.e. no failed decomposition), throwing an exception otherwise
+void TiledSymmetricMatrix::checkDecompositionHasNotFailed( const std::string& operation )
+{
+    if( hasDecompositionFailed_ )
+    {
+        throw std::runtime_error( "Error when " + operation + ", Cholesky decomposition of tiled symmetric matrix has failed "
+                                  "and matrix has been partially overwritten; call setZero before re-using it" );
+    }
+}
+
+//! Function to add the normal matrix contribution of a block of rows of a design matrix
+void TiledSymmetricMatrix::addWeightedDesignMatrixRows( const Eigen::MatrixXd& designMatrixRows,
+                                                        const Eigen::VectorXd& diagonalOfWeightMatrix )
+{
+    checkDecompositionHasNotFailed( "adding design matrix rows to tiled symmetric matrix" );
+    if( isDecomposed_ )
+    {
+        throw std::runtime_error( "Error when adding to tiled symmetric matrix, matrix is already decomposed" );
+    }
+
+    if( designMatrixRows.cols( ) != matrixSize_ || designMatrixRows.rows( ) != diagonalOfWeightMatrix.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding design matrix rows to tiled symmetric matrix, sizes are inconsistent" );
+    }
+
+    Eigen::MatrixXd weightedDesignMatrixRows = diagonalOfWeightMatrix.asDiagonal( ) * designMatrixRows;
+
+    // Each column of tiles is updated by a single task
+    performTasksInParallel(
+                numberOfTiles_, [ & ]( const int j )
+    {
+        int currentColumnTileSize = getCurrentTileSize( j );
+        for( int i = j; i < numberOfTiles_; i++ )
+        {
+            getTile( i, j ).noalias( ) +=
+                    designMatrixRows.middleCols( i * tileSize_, getCurrentTileSize( i ) ).transpose( ) *
+                    weightedDesignMatrixRows.middleCols( j * tileSize_, currentColumnTileSize );
+        }
+    } );
+}
+
+//! Function to add a vector to the diagonal of the matrix (e.g. a diagonal inverse a priori covariance)
+void TiledSymmetricMatrix::addToDiagonal( const Eigen::VectorXd& diagonalToAdd )
+{
+    checkDecompositionHasNotFailed( "adding diagonal to tiled symmetric matrix" );
+    if( isDecomposed_ )
+    {
+        throw std::runtime_error( "Error when adding to tiled symmetric matrix, matrix is already decomposed" );
+    }
+
+    if( diagonalToAdd.rows( ) != matrixSize_ )
+    {
+        throw std::runtime_error( "Error when adding diagonal to tiled symmetric matrix, sizes are inconsistent" );
+    }
+
+    for( int i = 0; i < numberOfTiles_; i++ )
+    {
+        getTile( i, i ).diagonal( ) += diagonalToAdd.segment( i * tileSize_, getCurrentTileSize( i ) );
+    }
+}
+
+//! Function to add a (dense) symmetric matrix to the matrix (e.g. a full inverse a priori covariance)
+void TiledSymmetricMatrix::addSymmetricMatrix( const Eigen::MatrixXd& matrixToAdd )
+{
+    checkDecompositionHasNotFailed( "adding matrix to tiled symmetric matrix" );
+    if( isDecomposed_ )
+    {
+        throw std::runtime_error( "Error when adding to tiled symmetric matrix, matrix is already decomposed" );
+    }
+
+    if( matrixToAdd.rows( ) != matrixSize_ || matrixToAdd.cols( ) != matrixSize_ )
+    {
+        throw std::runtime_error( "Error when adding matrix to tiled symmetric matrix, sizes are inconsistent" );
+    }
+
+    for( int j = 0; j < numberOfTiles_; j++ )
+    {
+        for( int i = j; i < numberOfTiles_; i++ )
+        {
+            Eigen::Map< Eigen::MatrixXd > currentTile = getTile( i, j );
+            currentTile += matrixToAdd.block( i * tileSize_, j * tileSize_, currentTile.rows( ), currentTile.cols( ) );
+        }
+    }
+}
+
+//! Function to perform the blocked Cholesky decomposition of the matrix in-place
+void TiledSymmetricMatrix::performCholeskyDecomposition( )
+{
+    checkDecompositionHasNotFailed( "performing Cholesky decomposition" );
+    if( isDecomposed_ )
+    {
+        return;
+    }
+
+    for( int k = 0; k < numberOfTiles_; k++ )
+    {
+        // Decompose diagonal tile
+        Eigen::Map< Eigen::MatrixXd > diagonalTile = getTile( k, k );
+        Eigen::LLT< Eigen::Ref< Eigen::MatrixXd > > diagonalDecomposition( diagonalTile );
+        if( diagonalDecomposition.info( ) != Eigen::Success )
+        {
+            hasDecompositionFailed_ = true;
+            throw std::runtime_error( "Error when performing Cholesky decomposition of tiled symmetric matrix, "
+                                      "matrix is not positive definite" );
+        }
+        diagonalTile.triangularView< Eigen::StrictlyUpper >( ).setZero( );
+
+        // Compute tiles below diagonal tile: L_ik = A_ik * L_kk^-T
+        performTasksInParallel(
+                    numberOfTiles_ - k - 1, [ & ]( const int taskIndex )
+        {
+            Eigen::Map< Eigen::MatrixXd > currentTile = getTile( k + 1 + taskIndex, k );
+            diagonalTile.triangularView< Eigen::Lower >( ).transpose( ).solveInPlace< Eigen::OnTheRight >( currentTile );
+        } );
+
+        // Update trailing tiles: A_ij = A_ij - L_ik * L_jk^T (each column of tiles updated by a single task)
+        performTasksInParallel(
+                    numberOfTiles_ - k - 1, [ & ]( const int taskIndex )
+        {
+            int j = k + 1 + taskIndex;
+            Eigen::Map< Eigen::MatrixXd > transposedFactorTile = getTile( j, k );
+            for( int i = j; i < numberOfTiles_; i++ )
+            {
+                getTile( i, j ).noalias( ) -= getTile( i, k ) * transposedFactorTile.transpose( );
+            }
+        } );
+    }
+
+    isDecomposed_ = true;
+}
+
+//! Function to perform forward substitution L*Y = B, with rows of B before given row of tiles assumed to be zero
+void TiledSymmetricMatrix::solveWithCholeskyFactor( Eigen::MatrixXd& rightHandSide, const int firstNonZeroTile )
+{
+    for( int i = firstNonZeroTile; i < numberOfTiles_; i++ )
+    {
+        int currentTileSize = getCurrentTileSize( i );
+        for( int j = firstNonZeroTile; j < i; j++ )
+        {
+            rightHandSide.middleRows( i * tileSize_, currentTileSize ).noalias( ) -=
+                    getTile( i, j ) * rightHandSide.middleRows( j * tileSize_, getCurrentTileSize( j ) );
+        }
+        getTile( i, i ).triangularView< Eigen::Lower >( ).solveInPlace(
+                    rightHandSide.middleRows( i * tileSize_, currentTileSize ) );
+    }
+}
+
+//! Function to perform backward substitution L^T*X = Y
+void TiledSymmetricMatrix::solveWithTransposedCholeskyFactor( Eigen::MatrixXd& rightHandSide )
+{
+    for( int i = numberOfTiles_ - 1; i >= 0; i-- )
+    {
+        int currentTileSize = getCurrentTileSize( i );
+        for( int j = i + 1; j < numberOfTiles_; j++ )
+        {
+            rightHandSide.middleRows( i * tileSize_, currentTileSize ).noalias( ) -=
+                    getTile( j, i ).transpose( ) * rightHandSide.middleRows( j * tileSize_, getCurrentTileSize( j ) );
+        }
+        getTile( i, i ).triangularView< Eigen::Lower >( ).transpose( ).solveInPlace(
+                    rightHandSide.middleRows( i * tileSize_, currentTileSize ) );
+    }
+}
+
+//! Function to solve the system of equations N*x = b (performing the Cholesky decomposition if required)
+Eigen::MatrixXd TiledSymmetricMatrix::solve( const Eigen::MatrixXd& rightHandSide )
+{
+    if( rightHandSide.rows( ) != matrixSize_ )
+    {
+        throw std::runtime_error( "Error when solving system with tiled symmetric matrix, sizes are inconsistent" );
+    }
+    performCholeskyDecomposition( );
+
+    // Columns of right-hand side are solved independently
+    Eigen::MatrixXd solution = rightHandSide;
+    performTasksInParallel(
+                std::min( numberOfThreads_, static_cast< int >( solution.cols( ) ) ), [ & ]( const int taskIndex )
+    {
+        int numberOfTasks = std::min( numberOfThreads_, static_cast< int >( solution.cols( ) ) );
+        int startColumn = ( taskIndex * solution.cols( ) ) / numberOfTasks;
+        int endColumn = ( ( taskIndex + 1 ) * solution.cols( ) ) / numberOfTasks;
+        Eigen::MatrixXd currentSolution = solution.middleCols( startColumn, endColumn - startColumn );
+        solveWithCholeskyFactor( currentSolution );
+        solveWithTransposedCholeskyFactor( currentSolution );
+        solution.middleCols( startColumn, endColumn - startColumn ) = currentSolution;
+    } );
+    return solution;
+}
+
+//! Function to compute the diagonal of the inverse of the matrix (performing the Cholesky decomposition if required)
+Eigen::VectorXd TiledSymmetricMatrix::getInverseDiagonal( )
+{
+    performCholeskyDecomposition( );
+
+    // With N^-1 = L^-T * L^-1, diagonal entry i is the squared norm of column i of L^-1, which is zero above row tile of i
+    Eigen::VectorXd inverseDiagonal = Eigen::VectorXd::Zero( matrixSize_ );
+    performTasksInParallel(
+                numberOfTiles_, [ & ]( const int j )
+    {
+        int currentTileSize = getCurrentTileSize( j );
+        Eigen::MatrixXd inverseFactorColumns = Eigen::MatrixXd::Zero( matrixSize_, currentTileSize );
+        inverseFactorColumns.middleRows( j * tileSize_, currentTileSize ).setIdentity( );
+        solveWithCholeskyFactor( inverseFactorColumns, j );
+        inverseDiagonal.segment( j * tileSize_, currentTileSize ) =
+                inverseFactorColumns.colwise( ).squaredNorm( ).transpose( );
+    } );
+    return inverseDiagonal;
+}
+
+//! Function to compute a block of the inverse of the matrix (performing the Cholesky decomposition if required)
+Eigen::MatrixXd TiledSymmetricMatrix::getInverseBlock( const int startRow, const int startColumn,
+                                                       const int numberOfRows, const int numberOfColumns )
+{
+    if( startRow < 0 || startColumn < 0 || numberOfRows < 0 || numberOfColumns < 0 ||
+            startRow + numberOfRows > matrixSize_ || startColumn + numberOfColumns > matrixSize_ )
+    {
+        throw std::runtime_error( "Error when retrieving block of inverse of tiled symmetric matrix, block is out of bounds" );
+    }
+
+    Eigen::MatrixXd unitColumns = Eigen::MatrixXd::Zero( matrixSize_, numberOfColumns );
+    unitColumns.middleRows( startColumn, numberOfColumns ).setIdentity( );
+    return solve( unitColumns ).middleRows( startRow, numberOfRows );
+}
+
+//! Function to retrieve the full matrix as a dense matrix (requires memory for the full matrix)
+Eigen::MatrixXd TiledSymmetricMatrix::getDenseMatrix( )
+{
+    checkDecompositionHasNotFailed( "retrieving dense tiled symmetric matrix" );
+    Eigen::MatrixXd denseMatrix = Eigen::MatrixXd::Zero( matrixSize_, matrixSize_ );
+    for( int j = 0; j < numberOfTiles_; j++ )
+    {
+        for( int i = j; i < numberOfTiles_; i++ )
+        {
+            Eigen::Map< Eigen::MatrixXd > currentTile = getTile( i, j );
+            denseMatrix.block( i * tileSize_, j * tileSize_, currentTile.rows( ), currentTile.cols( ) ) = currentTile;
+            if( i != j && !isDecomposed_ )
+            {
+                denseMatrix.block( j * tileSize_, i * tileSize_, currentTile.cols( ), currentTile.rows( ) ) =
+                        currentTile.transpose( );
+            }
+        }
+    }
+
+    return denseMatrix;
+}
+
+//! Function to evaluate a list of independent tasks, distributed over the threads
+void TiledSymmetricMatrix::performTasksInParallel( const int numberOfTasks,
+                                                   const std::function< void( const int ) >& taskFunction )
+{
+    int numberOfUsedThreads = std::min( numberOfThreads_, numberOfTasks );
+    if( numberOfUsedThreads <= 1 )
+    {
+        for( int i = 0; i < numberOfTasks; i++ )
+        {
+            taskFunction( i );
+        }
+    }
+    else
+    {
+        // Tasks are interleaved over threads, since the cost of tile tasks typically decreases with task index
+        std::vector< std::thread > threads;
+        for( int t = 0; t < numberOfUsedThreads; t++ )
+        {
+            threads.push_back( std::thread( [ &, t ]( )
+            {
+                for( int i = t; i < numberOfTasks; i += numberOfUsedThreads )
+                {
+                    taskFunction( i );
+                }
+            } ) );
+        }
+        for( auto& thread : threads )
+        {
+            thread.join( );
+        }
+    }
+}
+
+} // namespace linear_algebra
+
+} // namespace tudat
@@ -0,0 +1,25 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include "tudat/math/integrators/bulirschStoerVariableOrderIntegrator.h"
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+template class BulirschStoerVariableOrderIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+template class BulirschStoerVariableOrderIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+template class BulirschStoerVariableOrderIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+} // namespace numerical_integrators
+
+} // namespace tudat
@@ -39,6 +39,13 @@ std::vector< unsigned int > getBulirschStoerStepSequence(
             stepSequence.push_back( 2 * ( i + 1 ) );
         }
         break;
+    case hairer_wanner_sequence:
+        // Sequence 2, 6, 10, 14, ..., for which the midpoint of each row is an odd substep (Hairer et al., 1993)
+        for ( unsigned int i = 0; i < lengthOfSequence; i++ )
+        {
+            stepSequence.push_back( 4 * i + 2 );
+        }
+        break;
     default: // The default case will never occur because sequence is an enum
         throw std::runtime_error( "Error, did not recognize step sequence" );
     }
@@ -0,0 +1,317 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/statistics/counterBasedRandomNumberGenerator.h"
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+//! Multipliers and key increments (Weyl sequence) of Philox4x32 generator.
+const std::uint32_t PHILOX_MULTIPLIER_0 = 0xD2511F53;
+const std::uint32_t PHILOX_MULTIPLIER_1 = 0xCD9E8D57;
+const std::uint32_t PHILOX_KEY_INCREMENT_0 = 0x9E3779B9;
+const std::uint32_t PHILOX_KEY_INCREMENT_1 = 0xBB67AE85;
+
+//! Stream index used for the white noise from which time-correlated noise sequences are generated.
+const std::uint32_t CORRELATED_NOISE_STREAM_INDEX = 0x80000000;
+
+//! Function to convert 64 random bits to a uniformly distributed number in the open interval (0,1).
+inline double convertToOpenUnitInterval( const std::uint32_t highBits, const std::uint32_t lowBits )
+{
+    std::uint64_t randomBits = ( ( static_cast< std::uint64_t >( highBits ) << 32 ) | lowBits ) >> 11;
+    return ( static_cast< double >( randomBits ) + 0.5 ) * ( 1.0 / 9007199254740992.0 );
+}
+
+//! Function to compute the in-place (radix-2) fast Fourier transform of a sequence, with size a power of 2.
+void computeFastFourierTransform( std::vector< std::complex< double > >& sequence, const bool computeInverse )
+{
+    const unsigned int size = sequence.size( );
+
+    // Bit-reversal permutation
+    for( unsigned int i = 1, j = 0; i < size; i++ )
+    {
+        unsigned int bit = size >> 1;
+        for( ; j & bit; bit >>= 1 )
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+        if( i < j )
+        {
+            std::swap( sequence[ i ], sequence[ j ] );
+        }
+    }
+
+    // Butterfly operations
+    for( unsigned int length = 2; length <= size; length <<= 1 )
+    {
+        double angle = 2.0 * mathematical_constants::PI / static_cast< double >( length ) * ( computeInverse ? 1.0 : -1.0 );
+        std::complex< double > baseFactor( std::cos( angle ), std::sin( angle ) );
+        for( unsigned int i = 0; i < size; i += length )
+        {
+            std::complex< double > factor( 1.0, 0.0 );
+            for( unsigned int j = 0; j < length / 2; j++ )
+            {
+                std::complex< double > evenValue = sequence[ i + j ];
+                std::complex< double > oddValue = sequence[ i + j + length / 2 ] * factor;
+                sequence[ i + j ] = evenValue + oddValue;
+                sequence[ i + j + length / 2 ] = evenValue - oddValue;
+                factor *= baseFactor;
+            }
+        }
+    }
+}
+
+} // namespace
+
+//! Function to compute the Philox4x32-10 block function (Salmon et al., 2011).
+std::array< std::uint32_t, 4 > computePhilox4x32Block(
+        const std::array< std::uint32_t, 4 >& counter, const std::array< std::uint32_t, 2 >& key )
+{
+    std::array< std::uint32_t, 4 > block = counter;
+    std::array< std::uint32_t, 2 > roundKey = key;
+    for( int round = 0; round < 10; round++ )
+    {
+        if( round > 0 )
+        {
+            roundKey[ 0 ] += PHILOX_KEY_INCREMENT_0;
+            roundKey[ 1 ] += PHILOX_KEY_INCREMENT_1;
+        }
+        std::uint64_t firstProduct = static_cast< std::uint64_t >( PHILOX_MULTIPLIER_0 ) * block[ 0 ];
+        std::uint64_t secondProduct = static_cast< std::uint64_t >( PHILOX_MULTIPLIER_1 ) * block[ 2 ];
+        block = { static_cast< std::uint32_t >( secondProduct >> 32 ) ^ block[ 1 ] ^ roundKey[ 0 ],
+                  static_cast< std::uint32_t >( secondProduct ),
+                  static_cast< std::uint32_t >( firstProduct >> 32 ) ^ block[ 3 ] ^ roundKey[ 1 ],
+                  static_cast< std::uint32_t >( firstProduct ) };
+    }
+    return block;
+}
+
+//! Function to combine a key of a counter-based random number generator with an integer, to create a new key.
+std::uint64_t combineRandomNumberGeneratorKey( const std::uint64_t key, const std::uint64_t value )
+{
+    std::uint64_t combinedKey = key ^ ( value + 0x9E3779B97F4A7C15ULL + ( key << 6 ) + ( key >> 2 ) );
+    combinedKey = ( combinedKey ^ ( combinedKey >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+    combinedKey = ( combinedKey ^ ( combinedKey >> 27 ) ) * 0x94D049BB133111EBULL;
+    return combinedKey ^ ( combinedKey >> 31 );
+}
+
+//! Function to combine a key of a counter-based random number generator with a string, to create a new key.
+std::uint64_t combineRandomNumberGeneratorKey( const std::uint64_t key, const std::string& value )
+{
+    // Compute FNV-1a hash of string
+    std::uint64_t stringHash = 14695981039346656037ULL;
+    for( const char character : value )
+    {
+        stringHash = ( stringHash ^ static_cast< unsigned char >( character ) ) * 1099511628211ULL;
+    }
+    return combineRandomNumberGeneratorKey( key, stringHash );
+}
+
+//! Function to generate the pair of random numbers associated with a counter value and stream index.
+std::pair< double, double > CounterBasedGaussianRandomNumberGenerator::getRandomNumberPair(
+        const std::uint64_t counter, const std::uint32_t streamIndex ) const
+{
+    std::array< std::uint32_t, 4 > randomBits = computePhilox4x32Block(
+    { static_cast< std::uint32_t >( counter ), static_cast< std::uint32_t >( counter >> 32 ), streamIndex, 0 }, key_ );
+
+    // Map uniform random numbers to Gaussian random numbers using Box-Muller transform
+    double radius = standardDeviation_ * std::sqrt( -2.0 * std::log( convertToOpenUnitInterval( randomBits[ 0 ], randomBits[ 1 ] ) ) );
+    double angle = 2.0 * mathematical_constants::PI * convertToOpenUnitInterval( randomBits[ 2 ], randomBits[ 3 ] );
+    return std::make_pair( mean_ + radius * std::cos( angle ), mean_ + radius * std::sin( angle ) );
+}
+
+//! Function to generate a vector of random numbers associated with a counter value.
+void CounterBasedGaussianRandomNumberGenerator::getRandomVector(
+        const std::uint64_t counter, Eigen::Ref< Eigen::VectorXd > randomNumbers ) const
+{
+    for( int i = 0; i < randomNumbers.rows( ); i += 2 )
+    {
+        std::pair< double, double > randomNumberPair = getRandomNumberPair( counter, i / 2 );
+        randomNumbers( i ) = randomNumberPair.first;
+        if( i + 1 < randomNumbers.rows( ) )
+        {
+            randomNumbers( i + 1 ) = randomNumberPair.second;
+        }
+    }
+}
+
+//! Function to generate a sequence of random numbers, for consecutive counter values.
+void CounterBasedGaussianRandomNumberGenerator::getRandomSequence(
+        const std::uint64_t firstCounter, Eigen::Ref< Eigen::VectorXd > randomNumbers,
+        const std::uint32_t streamIndex ) const
+{
+    for( int i = 0; i < randomNumbers.rows( ); i += 2 )
+    {
+        std::pair< double, double > randomNumberPair = getRandomNumberPair( firstCounter + i / 2, streamIndex );
+        randomNumbers( i ) = randomNumberPair.first;
+        if( i + 1 < randomNumbers.rows( ) )
+        {
+            randomNumbers( i + 1 ) = randomNumberPair.second;
+        }
+    }
+}
+
+//! Function to retrieve the counter value associated with a given time (which is its binary representation).
+std::uint64_t CounterBasedGaussianRandomNumberGenerator::getCounterFromTime( const double time )
+{
+    // Map negative zero to zero, so that both give the same noise
+    double timeToConvert = ( time == 0.0 ) ? 0.0 : time;
+    std::uint64_t counter;
+    std::memcpy( &counter, &timeToConvert, sizeof( counter ) );
+    return counter;
+}
+
+//! Function to create a counter-based Gaussian noise function, which only depends on the time at which it is evaluated.
+std::function< Eigen::VectorXd( const double ) > getCounterBasedGaussianNoiseFunction(
+        const double standardDeviation,
+        const std::uint64_t key,
+        const int outputSize,
+        const double mean )
+{
+    CounterBasedGaussianRandomNumberGenerator randomNumberGenerator( key, standardDeviation, mean );
+    return [ = ]( const double time )
+    {
+        Eigen::VectorXd noise( outputSize );
+        randomNumberGenerator.getRandomVector(
+                    CounterBasedGaussianRandomNumberGenerator::getCounterFromTime( time ), noise );
+        return noise;
+    };
+}
+
+//! Function to generate a first-order Gauss-Markov noise sequence at equally spaced times.
+Eigen::VectorXd generateFirstOrderGaussMarkovNoise(
+        const std::uint64_t key,
+        const int numberOfSamples,
+        const double timeStep,
+        const double correlationTime,
+        const double standardDeviation )
+{
+    if( !( timeStep > 0.0 ) || !( correlationTime > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when generating Gauss-Markov noise, time step and correlation time must be positive." );
+    }
+
+    // Generate white noise
+    Eigen::VectorXd noise = Eigen::VectorXd( numberOfSamples );
+    CounterBasedGaussianRandomNumberGenerator( key ).getRandomSequence( 0, noise, CORRELATED_NOISE_STREAM_INDEX );
+
+    // Apply exact discretization of first-order Gauss-Markov process
+    double transitionFactor = std::exp( -timeStep / correlationTime );
+    double processNoiseFactor = std::sqrt( 1.0 - transitionFactor * transitionFactor );
+    if( numberOfSamples > 0 )
+    {
+        noise( 0 ) *= standardDeviation;
+    }
+    for( int i = 1; i < numberOfSamples; i++ )
+    {
+        noise( i ) = transitionFactor * noise( i - 1 ) + processNoiseFactor * standardDeviation * noise( i );
+    }
+    return noise;
+}
+
+//! Function to generate power-law noise at equally spaced times, with spectral density proportional to f^( -alpha ).
+Eigen::VectorXd generatePowerLawNoise(
+        const std::uint64_t key,
+        const int numberOfSamples,
+        const double alpha,
+        const double whiteNoiseStandardDeviation )
+{
+    // Generate white noise
+    Eigen::VectorXd whiteNoise = Eigen::VectorXd( numberOfSamples );
+    CounterBasedGaussianRandomNumberGenerator( key, whiteNoiseStandardDeviation ).getRandomSequence(
+                0, whiteNoise, CORRELATED_NOISE_STREAM_INDEX );
+    if( alpha == 0.0 || numberOfSamples == 0 )
+    {
+        return whiteNoise;
+    }
+
+    // Compute zero-padded transforms of white noise and filter impulse response (with sizes a power of 2).
+    unsigned int transformSize = 1;
+    while( transformSize < 2 * static_cast< unsigned int >( numberOfSamples ) )
+    {
+        transformSize <<= 1;
+    }
+    std::vector< std::complex< double > > whiteNoiseTransform( transformSize, 0.0 );
+    std::vector< std::complex< double > > impulseResponseTransform( transformSize, 0.0 );
+    double impulseResponse = 1.0;
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        if( i > 0 )
+        {
+            impulseResponse *= ( 0.5 * alpha + static_cast< double >( i - 1 ) ) / static_cast< double >( i );
+        }
+        impulseResponseTransform[ i ] = impulseResponse;
+        whiteNoiseTransform[ i ] = whiteNoise( i );
+    }
+    computeFastFourierTransform( whiteNoiseTransform, false );
+    computeFastFourierTransform( impulseResponseTransform, false );
+
+    // Compute convolution
+    for( unsigned int i = 0; i < transformSize; i++ )
+    {
+        whiteNoiseTransform[ i ] *= impulseResponseTransform[ i ];
+    }
+    computeFastFourierTransform( whiteNoiseTransform, true );
+
+    Eigen::VectorXd noise = Eigen::VectorXd( numberOfSamples );
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        noise( i ) = whiteNoiseTransform[ i ].real( ) / static_cast< double >( transformSize );
+    }
+    return noise;
+}
+
+//! Function to create a noise function that interpolates a noise sequence given at equally spaced times.
+std::function< Eigen::VectorXd( const double ) > getTabulatedNoiseFunction(
+        const Eigen::MatrixXd& noiseSequence,
+        const double startTime,
+        const double timeStep )
+{
+    if( noiseSequence.rows( ) < 2 || !( timeStep > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating tabulated noise function, at least two samples and a positive time step are required." );
+    }
+
+    std::shared_ptr< Eigen::MatrixXd > noiseSequencePointer = std::make_shared< Eigen::MatrixXd >( noiseSequence );
+    return [ = ]( const double time )
+    {
+        double scaledTime = ( time - startTime ) / timeStep;
+        const int numberOfSamples = noiseSequencePointer->rows( );
+        if( !( scaledTime >= 0.0 ) || scaledTime > static_cast< double >( numberOfSamples - 1 ) )
+        {
+            throw std::runtime_error( "Error when evaluating tabulated noise function, time " + std::to_string( time ) +
+                                      " is outside of tabulated interval." );
+        }
+        int lowerIndex = std::min( static_cast< int >( scaledTime ), numberOfSamples - 2 );
+        double upperWeight = scaledTime - static_cast< double >( lowerIndex );
+        return Eigen::VectorXd( ( 1.0 - upperWeight ) * noiseSequencePointer->row( lowerIndex ).transpose( ) +
+                                upperWeight * noiseSequencePointer->row( lowerIndex + 1 ).transpose( ) );
+    };
+}
+
+} // namespace statistics
+
+} // namespace tudat
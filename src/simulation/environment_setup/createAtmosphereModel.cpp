@@ -19,6 +19,7 @@
 #endif
 #include "tudat/io/basicInputOutput.h"
 #include "tudat/io/solarActivityData.h"
+#include "tudat/io/solarActivityTable.h"
 #include "tudat/simulation/environment_setup/createAtmosphereModel.h"
 
 
@@ -198,12 +199,14 @@ std::shared_ptr< aerodynamics::AtmosphereModel > createAtmosphereModel(
             spaceWeatherFilePath = nrlmsise00AtmosphereSettings->getSpaceWeatherFile( );
         }
 
-        tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
-                tudat::input_output::solar_activity::readSolarActivityData( spaceWeatherFilePath ) ;
+        // Read space weather file into columnar table (using binary cache alongside file, if possible)
+        std::shared_ptr< tudat::input_output::solar_activity::SolarActivityTable > solarActivityTable =
+                tudat::input_output::solar_activity::readSolarActivityTable(
+                    spaceWeatherFilePath, spaceWeatherFilePath + ".bin" );
 
         // Create atmosphere model using NRLMISE00 input function
         atmosphereModel = std::make_shared< aerodynamics::NRLMSISE00Atmosphere >(
-                    solarActivityData, true );
+                    solarActivityTable, true );
         break;
     }
 #endif
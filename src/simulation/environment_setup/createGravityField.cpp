@@ -495,6 +495,54 @@ std::shared_ptr< gravitation::GravityFieldModel > createGravityFieldModel(
 
         break;
     }
+    case mascon:
+    {
+        // Check whether settings for mascon gravity field model are consistent with its type.
+        std::shared_ptr< MasconGravityFieldSettings > masconFieldSettings =
+                std::dynamic_pointer_cast< MasconGravityFieldSettings >( gravityFieldSettings );
+
+        if( masconFieldSettings == nullptr )
+        {
+            throw std::runtime_error(
+                "Error, expected mascon gravity settings when making gravity field model for body " + body);
+        }
+        else if( gravityFieldVariationSettings.size( ) != 0 )
+        {
+            throw std::runtime_error( "Error, requested mascon gravity field, but field variations settings are not empty." );
+        }
+        else
+        {
+            std::function< void( ) > inertiaTensorUpdateFunction = std::function< void( ) >( );
+
+            std::string associatedReferenceFrame = masconFieldSettings->getAssociatedReferenceFrame( );
+            if( associatedReferenceFrame == "" )
+            {
+                std::shared_ptr< ephemerides::RotationalEphemeris> rotationalEphemeris =
+                        bodies.at( body )->getRotationalEphemeris( );
+                if( rotationalEphemeris == nullptr )
+                {
+                    throw std::runtime_error( "Error when creating mascon gravity field for body " + body +
+                                              ", neither a frame ID nor a rotational model for the body have been defined" );
+                }
+                else
+                {
+                    associatedReferenceFrame = rotationalEphemeris->getTargetFrameOrientation( );
+                }
+            }
+
+            // Create and initialize mascon gravity field model.
+            gravityFieldModel = std::make_shared< MasconGravityField >(
+                    masconFieldSettings->getGravitationalParameter( ),
+                    masconFieldSettings->getMasconPositions( ),
+                    masconFieldSettings->getMasconMassFractions( ),
+                    masconFieldSettings->getOpeningAngle( ),
+                    masconFieldSettings->getMaximumMasconsPerLeaf( ),
+                    associatedReferenceFrame,
+                    inertiaTensorUpdateFunction );
+        }
+
+        break;
+    }
     default:
         throw std::runtime_error(
                     "Error, did not recognize gravity field model settings type " +
@@ -192,6 +192,23 @@ std::shared_ptr<electromagnetism::SurfacePropertyDistribution> createSurfaceProp
                 customSurfacePropertyDistributionSettings->getCustomFunction( ) );
             break;
         }
+        case SurfacePropertyDistributionType::gridded:
+        {
+            auto griddedSurfacePropertyDistributionSettings =
+                std::dynamic_pointer_cast<GriddedSurfacePropertyDistributionSettings>(distributionSettings);
+            if(griddedSurfacePropertyDistributionSettings == nullptr)
+            {
+                throw std::runtime_error(
+                    "Error, expected gridded surface property distribution for body " + body );
+            }
+
+            surfacePropertyDistribution = std::make_shared< GriddedSurfacePropertyDistribution >(
+                createSurfacePropertyDistribution(
+                    griddedSurfacePropertyDistributionSettings->getOriginalDistributionSettings( ), body ),
+                griddedSurfacePropertyDistributionSettings->getNumberOfLatitudes( ),
+                griddedSurfacePropertyDistributionSettings->getNumberOfLongitudes( ) );
+            break;
+        }
         default:
             throw std::runtime_error( "Error, do not recognize surface property distribution settings for " + body );
     }
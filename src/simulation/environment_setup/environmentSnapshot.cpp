@@ -0,0 +1,564 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "tudat/astro/ephemerides/tabulatedEphemeris.h"
+#include "tudat/astro/ephemerides/tabulatedRotationalEphemeris.h"
+#include "tudat/astro/gravitation/sphericalHarmonicsGravityField.h"
+#include "tudat/simulation/environment_setup/environmentSnapshot.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+namespace
+{
+
+//! Identifier at start of binary environment snapshot files.
+const char BINARY_FILE_IDENTIFIER[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'E', 'N', 'V' };
+
+//! Version of the binary environment snapshot file format, to be incremented whenever the format changes.
+const std::uint32_t BINARY_FILE_FORMAT_VERSION = 1;
+
+//! Function to write a value of fundamental type to a binary stream.
+template< typename T >
+void writeValueToBinaryStream( std::ofstream& stream, const T value )
+{
+    stream.write( reinterpret_cast< const char* >( &value ), sizeof( T ) );
+}
+
+//! Function to read a value of fundamental type from a binary stream.
+template< typename T >
+T readValueFromBinaryStream( std::ifstream& stream )
+{
+    T value = T( );
+    stream.read( reinterpret_cast< char* >( &value ), sizeof( T ) );
+    return value;
+}
+
+//! Function to write a vector of doubles, preceded by its size, to a binary stream.
+void writeVectorToBinaryStream( std::ofstream& stream, const std::vector< double >& vector )
+{
+    writeValueToBinaryStream< std::uint64_t >( stream, vector.size( ) );
+    stream.write( reinterpret_cast< const char* >( vector.data( ) ), vector.size( ) * sizeof( double ) );
+}
+
+//! Function to read a vector of doubles, preceded by its size, from a binary stream.
+void readVectorFromBinaryStream( std::ifstream& stream, std::vector< double >& vector, const std::uint64_t fileSize )
+{
+    std::uint64_t size = readValueFromBinaryStream< std::uint64_t >( stream );
+    if( stream.fail( ) || size * sizeof( double ) > fileSize )
+    {
+        throw std::runtime_error( "Error when reading environment snapshot, vector size is inconsistent with file size." );
+    }
+    vector.resize( size );
+    stream.read( reinterpret_cast< char* >( vector.data( ) ), size * sizeof( double ) );
+}
+
+//! Function to write a string, preceded by its size, to a binary stream.
+void writeStringToBinaryStream( std::ofstream& stream, const std::string& string )
+{
+    writeValueToBinaryStream< std::uint64_t >( stream, string.size( ) );
+    stream.write( string.data( ), string.size( ) );
+}
+
+//! Function to read a string, preceded by its size, from a binary stream.
+std::string readStringFromBinaryStream( std::ifstream& stream, const std::uint64_t fileSize )
+{
+    std::uint64_t size = readValueFromBinaryStream< std::uint64_t >( stream );
+    if( stream.fail( ) || size > fileSize )
+    {
+        throw std::runtime_error( "Error when reading environment snapshot, string size is inconsistent with file size." );
+    }
+    std::string string( size, ' ' );
+    stream.read( &string[ 0 ], size );
+    return string;
+}
+
+//! Function to write a matrix of doubles, preceded by its size, to a binary stream.
+void writeMatrixToBinaryStream( std::ofstream& stream, const Eigen::MatrixXd& matrix )
+{
+    writeValueToBinaryStream< std::uint64_t >( stream, matrix.rows( ) );
+    writeValueToBinaryStream< std::uint64_t >( stream, matrix.cols( ) );
+    stream.write( reinterpret_cast< const char* >( matrix.data( ) ), matrix.size( ) * sizeof( double ) );
+}
+
+//! Function to read a matrix of doubles, preceded by its size, from a binary stream.
+void readMatrixFromBinaryStream( std::ifstream& stream, Eigen::MatrixXd& matrix, const std::uint64_t fileSize )
+{
+    std::uint64_t rows = readValueFromBinaryStream< std::uint64_t >( stream );
+    std::uint64_t cols = readValueFromBinaryStream< std::uint64_t >( stream );
+    if( stream.fail( ) || ( rows > 0 && cols * sizeof( double ) > fileSize / rows ) )
+    {
+        throw std::runtime_error( "Error when reading environment snapshot, matrix size is inconsistent with file size." );
+    }
+    matrix.resize( rows, cols );
+    stream.read( reinterpret_cast< char* >( matrix.data( ) ), matrix.size( ) * sizeof( double ) );
+}
+
+//! Function to write the data of an interpolator to a binary stream.
+void writeInterpolatorToBinaryStream( std::ofstream& stream, const InterpolatorSnapshot& interpolator )
+{
+    writeValueToBinaryStream< std::int32_t >( stream, interpolator.interpolatorType );
+    writeValueToBinaryStream< std::int32_t >( stream, interpolator.lookupScheme );
+    writeValueToBinaryStream< std::int32_t >( stream, interpolator.boundaryHandling );
+    writeValueToBinaryStream< std::int32_t >( stream, interpolator.numberOfStages );
+    writeValueToBinaryStream< std::int32_t >( stream, interpolator.lagrangeBoundaryHandling );
+    writeValueToBinaryStream< std::int32_t >( stream, interpolator.dependentVariableSize );
+    writeVectorToBinaryStream( stream, interpolator.independentValues );
+    writeVectorToBinaryStream( stream, interpolator.dependentValues );
+    writeVectorToBinaryStream( stream, interpolator.dependentValueDerivatives );
+    writeVectorToBinaryStream( stream, interpolator.defaultExtrapolationValues );
+}
+
+//! Function to read the data of an interpolator from a binary stream.
+InterpolatorSnapshot readInterpolatorFromBinaryStream( std::ifstream& stream, const std::uint64_t fileSize )
+{
+    InterpolatorSnapshot interpolator;
+    interpolator.interpolatorType = static_cast< interpolators::InterpolatorTypes >(
+                readValueFromBinaryStream< std::int32_t >( stream ) );
+    interpolator.lookupScheme = static_cast< interpolators::AvailableLookupScheme >(
+                readValueFromBinaryStream< std::int32_t >( stream ) );
+    interpolator.boundaryHandling = static_cast< interpolators::BoundaryInterpolationType >(
+                readValueFromBinaryStream< std::int32_t >( stream ) );
+    interpolator.numberOfStages = readValueFromBinaryStream< std::int32_t >( stream );
+    interpolator.lagrangeBoundaryHandling = static_cast< interpolators::LagrangeInterpolatorBoundaryHandling >(
+                readValueFromBinaryStream< std::int32_t >( stream ) );
+    interpolator.dependentVariableSize = readValueFromBinaryStream< std::int32_t >( stream );
+    readVectorFromBinaryStream( stream, interpolator.independentValues, fileSize );
+    readVectorFromBinaryStream( stream, interpolator.dependentValues, fileSize );
+    readVectorFromBinaryStream( stream, interpolator.dependentValueDerivatives, fileSize );
+    readVectorFromBinaryStream( stream, interpolator.defaultExtrapolationValues, fileSize );
+    return interpolator;
+}
+
+//! Function to concatenate a list of vectors into a single vector.
+template< int Size >
+std::vector< double > concatenateVectors( const std::vector< Eigen::Matrix< double, Size, 1 > >& vectors )
+{
+    std::vector< double > concatenatedVectors( Size * vectors.size( ) );
+    for( unsigned int i = 0; i < vectors.size( ); i++ )
+    {
+        Eigen::Map< Eigen::Matrix< double, Size, 1 > >( concatenatedVectors.data( ) + Size * i ) = vectors.at( i );
+    }
+    return concatenatedVectors;
+}
+
+//! Function to split a concatenated vector (see concatenateVectors) into a list of vectors.
+template< int Size >
+std::vector< Eigen::Matrix< double, Size, 1 > > splitVectors( const std::vector< double >& concatenatedVectors )
+{
+    std::vector< Eigen::Matrix< double, Size, 1 > > vectors( concatenatedVectors.size( ) / Size );
+    for( unsigned int i = 0; i < vectors.size( ); i++ )
+    {
+        vectors[ i ] = Eigen::Map< const Eigen::Matrix< double, Size, 1 > >( concatenatedVectors.data( ) + Size * i );
+    }
+    return vectors;
+}
+
+//! Function to retrieve the data defining an interpolator.
+template< int Size >
+InterpolatorSnapshot getInterpolatorSnapshot(
+        const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Matrix< double, Size, 1 > > >
+        interpolator )
+{
+    typedef Eigen::Matrix< double, Size, 1 > StateType;
+
+    InterpolatorSnapshot snapshot;
+    snapshot.interpolatorType = interpolator->getInterpolatorType( );
+    snapshot.lookupScheme = interpolator->getSelectedLookupScheme( );
+    snapshot.boundaryHandling = interpolator->getBoundaryHandling( );
+    snapshot.dependentVariableSize = Size;
+
+    switch( snapshot.interpolatorType )
+    {
+    case interpolators::linear_interpolator:
+    case interpolators::cubic_spline_interpolator:
+    case interpolators::piecewise_constant_interpolator:
+        break;
+    case interpolators::lagrange_interpolator:
+    {
+        std::shared_ptr< interpolators::LagrangeInterpolator< double, StateType > > lagrangeInterpolator =
+                std::dynamic_pointer_cast< interpolators::LagrangeInterpolator< double, StateType > >( interpolator );
+        if( lagrangeInterpolator == nullptr )
+        {
+            throw std::runtime_error( "Error when creating environment snapshot, Lagrange interpolator type is not supported." );
+        }
+        snapshot.numberOfStages = lagrangeInterpolator->getNumberOfStages( );
+        snapshot.lagrangeBoundaryHandling = lagrangeInterpolator->getLagrangeBoundaryHandling( );
+        break;
+    }
+    case interpolators::hermite_spline_interpolator:
+    {
+        std::shared_ptr< interpolators::HermiteCubicSplineInterpolator< double, StateType > > hermiteInterpolator =
+                std::dynamic_pointer_cast< interpolators::HermiteCubicSplineInterpolator< double, StateType > >(
+                    interpolator );
+        if( hermiteInterpolator == nullptr )
+        {
+            throw std::runtime_error( "Error when creating environment snapshot, Hermite interpolator type is not supported." );
+        }
+        snapshot.dependentValueDerivatives = concatenateVectors< Size >( hermiteInterpolator->getDerivativeValues( ) );
+        break;
+    }
+    default:
+        throw std::runtime_error( "Error when creating environment snapshot, interpolator type " +
+                                  std::to_string( snapshot.interpolatorType ) + " is not supported." );
+    }
+
+    snapshot.independentValues = interpolator->getIndependentValues( );
+    snapshot.dependentValues = concatenateVectors< Size >( interpolator->getDependentValues( ) );
+
+    std::pair< StateType, StateType > defaultExtrapolationValue = interpolator->getDefaultExtrapolationValue( );
+    snapshot.defaultExtrapolationValues = concatenateVectors< Size >(
+                std::vector< StateType >( { defaultExtrapolationValue.first, defaultExtrapolationValue.second } ) );
+
+    return snapshot;
+}
+
+//! Function to create an interpolator from the data stored in an environment snapshot.
+template< int Size >
+std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Matrix< double, Size, 1 > > >
+createInterpolatorFromSnapshot( const InterpolatorSnapshot& snapshot )
+{
+    typedef Eigen::Matrix< double, Size, 1 > StateType;
+
+    if( snapshot.dependentVariableSize != Size ||
+            snapshot.dependentValues.size( ) != Size * snapshot.independentValues.size( ) ||
+            snapshot.defaultExtrapolationValues.size( ) != 2 * Size )
+    {
+        throw std::runtime_error( "Error when creating interpolator from environment snapshot, data size is inconsistent." );
+    }
+
+    std::vector< StateType > dependentValues = splitVectors< Size >( snapshot.dependentValues );
+    std::vector< StateType > defaultExtrapolationValues = splitVectors< Size >( snapshot.defaultExtrapolationValues );
+    std::pair< StateType, StateType > defaultExtrapolationValue =
+            std::make_pair( defaultExtrapolationValues.at( 0 ), defaultExtrapolationValues.at( 1 ) );
+
+    std::shared_ptr< interpolators::OneDimensionalInterpolator< double, StateType > > interpolator;
+    switch( snapshot.interpolatorType )
+    {
+    case interpolators::linear_interpolator:
+        interpolator = std::make_shared< interpolators::LinearInterpolator< double, StateType > >(
+                    snapshot.independentValues, dependentValues, snapshot.lookupScheme, snapshot.boundaryHandling,
+                    defaultExtrapolationValue );
+        break;
+    case interpolators::cubic_spline_interpolator:
+        interpolator = std::make_shared< interpolators::CubicSplineInterpolator< double, StateType > >(
+                    snapshot.independentValues, dependentValues, snapshot.lookupScheme, snapshot.boundaryHandling,
+                    defaultExtrapolationValue );
+        break;
+    case interpolators::piecewise_constant_interpolator:
+        interpolator = std::make_shared< interpolators::PiecewiseConstantInterpolator< double, StateType > >(
+                    snapshot.independentValues, dependentValues, snapshot.lookupScheme, snapshot.boundaryHandling,
+                    defaultExtrapolationValue );
+        break;
+    case interpolators::lagrange_interpolator:
+        interpolator = std::make_shared< interpolators::LagrangeInterpolator< double, StateType > >(
+                    snapshot.independentValues, dependentValues, snapshot.numberOfStages, snapshot.lookupScheme,
+                    snapshot.lagrangeBoundaryHandling, snapshot.boundaryHandling, defaultExtrapolationValue );
+        break;
+    case interpolators::hermite_spline_interpolator:
+        if( snapshot.dependentValueDerivatives.size( ) != snapshot.dependentValues.size( ) )
+        {
+            throw std::runtime_error( "Error when creating Hermite interpolator from environment snapshot, derivative size is inconsistent." );
+        }
+        interpolator = std::make_shared< interpolators::HermiteCubicSplineInterpolator< double, StateType > >(
+                    snapshot.independentValues, dependentValues, splitVectors< Size >( snapshot.dependentValueDerivatives ),
+                    snapshot.lookupScheme, snapshot.boundaryHandling, defaultExtrapolationValue );
+        break;
+    default:
+        throw std::runtime_error( "Error when creating interpolator from environment snapshot, interpolator type " +
+                                  std::to_string( snapshot.interpolatorType ) + " is not supported." );
+    }
+    return interpolator;
+}
+
+} // namespace
+
+//! Constructor, retrieves the data-heavy environment models from a set of bodies.
+EnvironmentSnapshot::EnvironmentSnapshot( const SystemOfBodies& bodies )
+{
+    for( const auto& bodyIterator : bodies.getMap( ) )
+    {
+        const std::string& bodyName = bodyIterator.first;
+        const std::shared_ptr< Body > body = bodyIterator.second;
+
+        std::shared_ptr< ephemerides::TabulatedCartesianEphemeris< double, double > > tabulatedEphemeris =
+                std::dynamic_pointer_cast< ephemerides::TabulatedCartesianEphemeris< double, double > >(
+                    body->getEphemeris( ) );
+        if( tabulatedEphemeris != nullptr && tabulatedEphemeris->getInterpolator( ) != nullptr )
+        {
+            TabulatedEphemerisSnapshot ephemerisSnapshot;
+            ephemerisSnapshot.frameOrigin = tabulatedEphemeris->getReferenceFrameOrigin( );
+            ephemerisSnapshot.frameOrientation = tabulatedEphemeris->getReferenceFrameOrientation( );
+            ephemerisSnapshot.stateInterpolator = getInterpolatorSnapshot< 6 >( tabulatedEphemeris->getInterpolator( ) );
+            ephemerides_[ bodyName ] = ephemerisSnapshot;
+        }
+
+        std::shared_ptr< gravitation::SphericalHarmonicsGravityField > sphericalHarmonicsGravityField =
+                std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >( body->getGravityFieldModel( ) );
+        if( sphericalHarmonicsGravityField != nullptr )
+        {
+            SphericalHarmonicsGravityFieldSnapshot gravityFieldSnapshot;
+            gravityFieldSnapshot.gravitationalParameter = sphericalHarmonicsGravityField->getGravitationalParameter( );
+            gravityFieldSnapshot.referenceRadius = sphericalHarmonicsGravityField->getReferenceRadius( );
+            gravityFieldSnapshot.fixedReferenceFrame = sphericalHarmonicsGravityField->getFixedReferenceFrame( );
+            gravityFieldSnapshot.cosineCoefficients = sphericalHarmonicsGravityField->getCosineCoefficients( );
+            gravityFieldSnapshot.sineCoefficients = sphericalHarmonicsGravityField->getSineCoefficients( );
+            gravityFields_[ bodyName ] = gravityFieldSnapshot;
+        }
+
+        std::shared_ptr< ephemerides::TabulatedRotationalEphemeris< double, double > > tabulatedRotationModel =
+                std::dynamic_pointer_cast< ephemerides::TabulatedRotationalEphemeris< double, double > >(
+                    body->getRotationalEphemeris( ) );
+        if( tabulatedRotationModel != nullptr && tabulatedRotationModel->getInterpolator( ) != nullptr )
+        {
+            TabulatedRotationSnapshot rotationSnapshot;
+            rotationSnapshot.baseFrameOrientation = tabulatedRotationModel->getBaseFrameOrientation( );
+            rotationSnapshot.targetFrameOrientation = tabulatedRotationModel->getTargetFrameOrientation( );
+            rotationSnapshot.rotationalStateInterpolator =
+                    getInterpolatorSnapshot< 7 >( tabulatedRotationModel->getInterpolator( ) );
+            rotationModels_[ bodyName ] = rotationSnapshot;
+        }
+    }
+}
+
+//! Function to write the snapshot to a binary file, which can be read with readFromBinaryFile.
+void EnvironmentSnapshot::writeToBinaryFile( const std::string& filePath ) const
+{
+    std::ofstream binaryFile( filePath, std::ios::binary | std::ios::trunc );
+    if( !binaryFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing environment snapshot, file <" + filePath + "> could not be opened." );
+    }
+
+    binaryFile.write( BINARY_FILE_IDENTIFIER, sizeof( BINARY_FILE_IDENTIFIER ) );
+    writeValueToBinaryStream( binaryFile, BINARY_FILE_FORMAT_VERSION );
+
+    writeValueToBinaryStream< std::uint64_t >( binaryFile, ephemerides_.size( ) );
+    for( const auto& ephemerisIterator : ephemerides_ )
+    {
+        writeStringToBinaryStream( binaryFile, ephemerisIterator.first );
+        writeStringToBinaryStream( binaryFile, ephemerisIterator.second.frameOrigin );
+        writeStringToBinaryStream( binaryFile, ephemerisIterator.second.frameOrientation );
+        writeInterpolatorToBinaryStream( binaryFile, ephemerisIterator.second.stateInterpolator );
+    }
+
+    writeValueToBinaryStream< std::uint64_t >( binaryFile, gravityFields_.size( ) );
+    for( const auto& gravityFieldIterator : gravityFields_ )
+    {
+        writeStringToBinaryStream( binaryFile, gravityFieldIterator.first );
+        writeValueToBinaryStream( binaryFile, gravityFieldIterator.second.gravitationalParameter );
+        writeValueToBinaryStream( binaryFile, gravityFieldIterator.second.referenceRadius );
+        writeStringToBinaryStream( binaryFile, gravityFieldIterator.second.fixedReferenceFrame );
+        writeMatrixToBinaryStream( binaryFile, gravityFieldIterator.second.cosineCoefficients );
+        writeMatrixToBinaryStream( binaryFile, gravityFieldIterator.second.sineCoefficients );
+    }
+
+    writeValueToBinaryStream< std::uint64_t >( binaryFile, rotationModels_.size( ) );
+    for( const auto& rotationIterator : rotationModels_ )
+    {
+        writeStringToBinaryStream( binaryFile, rotationIterator.first );
+        writeStringToBinaryStream( binaryFile, rotationIterator.second.baseFrameOrientation );
+        writeStringToBinaryStream( binaryFile, rotationIterator.second.targetFrameOrientation );
+        writeInterpolatorToBinaryStream( binaryFile, rotationIterator.second.rotationalStateInterpolator );
+    }
+
+    if( binaryFile.fail( ) )
+    {
+        throw std::runtime_error( "Error when writing environment snapshot to file <" + filePath + ">." );
+    }
+}
+
+//! Function to read the snapshot from a binary file, as written by writeToBinaryFile.
+void EnvironmentSnapshot::readFromBinaryFile( const std::string& filePath )
+{
+    std::ifstream binaryFile( filePath, std::ios::binary | std::ios::ate );
+    if( !binaryFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading environment snapshot, file <" + filePath + "> could not be opened." );
+    }
+    const std::uint64_t binaryFileSize = static_cast< std::uint64_t >( binaryFile.tellg( ) );
+    binaryFile.seekg( 0 );
+
+    // Check file identifier and format version.
+    char identifier[ sizeof( BINARY_FILE_IDENTIFIER ) ];
+    binaryFile.read( identifier, sizeof( identifier ) );
+    std::uint32_t formatVersion = readValueFromBinaryStream< std::uint32_t >( binaryFile );
+    if( binaryFile.fail( ) || std::memcmp( identifier, BINARY_FILE_IDENTIFIER, sizeof( identifier ) ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading environment snapshot, file <" + filePath +
+                                  "> is not an environment snapshot file." );
+    }
+    if( formatVersion != BINARY_FILE_FORMAT_VERSION )
+    {
+        throw std::runtime_error( "Error when reading environment snapshot, file <" + filePath + "> has format version " +
+                                  std::to_string( formatVersion ) + ", but version " +
+                                  std::to_string( BINARY_FILE_FORMAT_VERSION ) + " is required." );
+    }
+
+    std::map< std::string, TabulatedEphemerisSnapshot > ephemerides;
+    std::uint64_t numberOfEntries = readValueFromBinaryStream< std::uint64_t >( binaryFile );
+    for( std::uint64_t i = 0; i < numberOfEntries && !binaryFile.fail( ); i++ )
+    {
+        std::string bodyName = readStringFromBinaryStream( binaryFile, binaryFileSize );
+        TabulatedEphemerisSnapshot& ephemerisSnapshot = ephemerides[ bodyName ];
+        ephemerisSnapshot.frameOrigin = readStringFromBinaryStream( binaryFile, binaryFileSize );
+        ephemerisSnapshot.frameOrientation = readStringFromBinaryStream( binaryFile, binaryFileSize );
+        ephemerisSnapshot.stateInterpolator = readInterpolatorFromBinaryStream( binaryFile, binaryFileSize );
+    }
+
+    std::map< std::string, SphericalHarmonicsGravityFieldSnapshot > gravityFields;
+    numberOfEntries = readValueFromBinaryStream< std::uint64_t >( binaryFile );
+    for( std::uint64_t i = 0; i < numberOfEntries && !binaryFile.fail( ); i++ )
+    {
+        std::string bodyName = readStringFromBinaryStream( binaryFile, binaryFileSize );
+        SphericalHarmonicsGravityFieldSnapshot& gravityFieldSnapshot = gravityFields[ bodyName ];
+        gravityFieldSnapshot.gravitationalParameter = readValueFromBinaryStream< double >( binaryFile );
+        gravityFieldSnapshot.referenceRadius = readValueFromBinaryStream< double >( binaryFile );
+        gravityFieldSnapshot.fixedReferenceFrame = readStringFromBinaryStream( binaryFile, binaryFileSize );
+        readMatrixFromBinaryStream( binaryFile, gravityFieldSnapshot.cosineCoefficients, binaryFileSize );
+        readMatrixFromBinaryStream( binaryFile, gravityFieldSnapshot.sineCoefficients, binaryFileSize );
+    }
+
+    std::map< std::string, TabulatedRotationSnapshot > rotationModels;
+    numberOfEntries = readValueFromBinaryStream< std::uint64_t >( binaryFile );
+    for( std::uint64_t i = 0; i < numberOfEntries && !binaryFile.fail( ); i++ )
+    {
+        std::string bodyName = readStringFromBinaryStream( binaryFile, binaryFileSize );
+        TabulatedRotationSnapshot& rotationSnapshot = rotationModels[ bodyName ];
+        rotationSnapshot.baseFrameOrientation = readStringFromBinaryStream( binaryFile, binaryFileSize );
+        rotationSnapshot.targetFrameOrientation = readStringFromBinaryStream( binaryFile, binaryFileSize );
+        rotationSnapshot.rotationalStateInterpolator = readInterpolatorFromBinaryStream( binaryFile, binaryFileSize );
+    }
+
+    if( binaryFile.fail( ) )
+    {
+        throw std::runtime_error( "Error when reading environment snapshot, file <" + filePath + "> is incomplete." );
+    }
+    if( binaryFile.peek( ) != std::ifstream::traits_type::eof( ) )
+    {
+        throw std::runtime_error( "Error when reading environment snapshot, file <" + filePath + "> contains unexpected data "
+                                  "after the snapshot." );
+    }
+
+    ephemerides_ = ephemerides;
+    gravityFields_ = gravityFields;
+    rotationModels_ = rotationModels;
+}
+
+//! Function to attach the environment models in the snapshot to a set of bodies.
+void EnvironmentSnapshot::attachToBodies( const SystemOfBodies& bodies ) const
+{
+    for( const auto& ephemerisIterator : ephemerides_ )
+    {
+        std::shared_ptr< Body > body = bodies.at( ephemerisIterator.first );
+        std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector6d > > stateInterpolator =
+                createInterpolatorFromSnapshot< 6 >( ephemerisIterator.second.stateInterpolator );
+
+        std::shared_ptr< ephemerides::TabulatedCartesianEphemeris< double, double > > tabulatedEphemeris =
+                std::dynamic_pointer_cast< ephemerides::TabulatedCartesianEphemeris< double, double > >(
+                    body->getEphemeris( ) );
+        if( tabulatedEphemeris != nullptr &&
+                tabulatedEphemeris->getReferenceFrameOrigin( ) == ephemerisIterator.second.frameOrigin &&
+                tabulatedEphemeris->getReferenceFrameOrientation( ) == ephemerisIterator.second.frameOrientation )
+        {
+            tabulatedEphemeris->resetInterpolator( stateInterpolator );
+        }
+        else
+        {
+            body->setEphemeris( std::make_shared< ephemerides::TabulatedCartesianEphemeris< double, double > >(
+                                    stateInterpolator, ephemerisIterator.second.frameOrigin,
+                                    ephemerisIterator.second.frameOrientation ) );
+        }
+    }
+
+    for( const auto& gravityFieldIterator : gravityFields_ )
+    {
+        std::shared_ptr< Body > body = bodies.at( gravityFieldIterator.first );
+        const SphericalHarmonicsGravityFieldSnapshot& gravityFieldSnapshot = gravityFieldIterator.second;
+        if( body->getGravityFieldModel( ) == nullptr )
+        {
+            body->setGravityFieldModel( std::make_shared< gravitation::SphericalHarmonicsGravityField >(
+                                            gravityFieldSnapshot.gravitationalParameter,
+                                            gravityFieldSnapshot.referenceRadius,
+                                            gravityFieldSnapshot.cosineCoefficients,
+                                            gravityFieldSnapshot.sineCoefficients,
+                                            gravityFieldSnapshot.fixedReferenceFrame ) );
+        }
+        else
+        {
+            std::shared_ptr< gravitation::SphericalHarmonicsGravityField > sphericalHarmonicsGravityField =
+                    std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >(
+                        body->getGravityFieldModel( ) );
+            if( sphericalHarmonicsGravityField == nullptr ||
+                    sphericalHarmonicsGravityField->getReferenceRadius( ) != gravityFieldSnapshot.referenceRadius ||
+                    sphericalHarmonicsGravityField->getCosineCoefficients( ).rows( ) !=
+                    gravityFieldSnapshot.cosineCoefficients.rows( ) ||
+                    sphericalHarmonicsGravityField->getCosineCoefficients( ).cols( ) !=
+                    gravityFieldSnapshot.cosineCoefficients.cols( ) )
+            {
+                throw std::runtime_error( "Error when attaching environment snapshot, gravity field of body " +
+                                          gravityFieldIterator.first +
+                                          " is not a spherical harmonic gravity field of the same size and reference radius." );
+            }
+            sphericalHarmonicsGravityField->resetGravitationalParameter( gravityFieldSnapshot.gravitationalParameter );
+            sphericalHarmonicsGravityField->setCosineCoefficients( gravityFieldSnapshot.cosineCoefficients );
+            sphericalHarmonicsGravityField->setSineCoefficients( gravityFieldSnapshot.sineCoefficients );
+        }
+    }
+
+    for( const auto& rotationIterator : rotationModels_ )
+    {
+        std::shared_ptr< Body > body = bodies.at( rotationIterator.first );
+        std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Matrix< double, 7, 1 > > >
+                rotationalStateInterpolator =
+                createInterpolatorFromSnapshot< 7 >( rotationIterator.second.rotationalStateInterpolator );
+
+        std::shared_ptr< ephemerides::TabulatedRotationalEphemeris< double, double > > tabulatedRotationModel =
+                std::dynamic_pointer_cast< ephemerides::TabulatedRotationalEphemeris< double, double > >(
+                    body->getRotationalEphemeris( ) );
+        if( tabulatedRotationModel != nullptr &&
+                tabulatedRotationModel->getBaseFrameOrientation( ) == rotationIterator.second.baseFrameOrientation &&
+                tabulatedRotationModel->getTargetFrameOrientation( ) == rotationIterator.second.targetFrameOrientation )
+        {
+            tabulatedRotationModel->reset( rotationalStateInterpolator );
+        }
+        else
+        {
+            body->setRotationalEphemeris( std::make_shared< ephemerides::TabulatedRotationalEphemeris< double, double > >(
+                                              rotationalStateInterpolator, rotationIterator.second.baseFrameOrientation,
+                                              rotationIterator.second.targetFrameOrientation ) );
+        }
+    }
+}
+
+//! Function to write the data-heavy environment models of a set of bodies to a binary snapshot file.
+void writeEnvironmentSnapshot( const SystemOfBodies& bodies, const std::string& filePath )
+{
+    EnvironmentSnapshot( bodies ).writeToBinaryFile( filePath );
+}
+
+//! Function to read a binary snapshot file, and attach its environment models to a set of bodies.
+void attachEnvironmentSnapshot( const SystemOfBodies& bodies, const std::string& filePath )
+{
+    EnvironmentSnapshot snapshot;
+    snapshot.readFromBinaryFile( filePath );
+    snapshot.attachToBodies( bodies );
+}
+
+} // namespace simulation_setup
+
+} // namespace tudat
@@ -141,11 +141,27 @@ std::pair< int, int > getLinkEndStateTimeIndices(
     return currentStateTimeIndex.at( 0 );
 }
 
+//! Function to create a function returning the state of a body, retrieved from shared observation data if possible
+std::function< Eigen::Vector6d( const double ) > getObservationDependentVariableBodyStateFunction(
+    const std::shared_ptr< Body > body,
+    const std::shared_ptr< ObservationDependentVariableSharedData > sharedData )
+{
+    if( sharedData == nullptr )
+    {
+        return [=]( const double time ){ return body->getStateInBaseFrameFromEphemeris< double, double >( time ); };
+    }
+    else
+    {
+        return [=]( const double time ){ return sharedData->getBodyState( body, time ); };
+    }
+}
+
 ObservationDependentVariableFunction getStationObservationAngleFunction(
         const SystemOfBodies& bodies,
         const std::shared_ptr< StationAngleObservationDependentVariableSettings > variableSettings,
         const observation_models::ObservableType observableType,
-        const observation_models::LinkDefinition linkEnds )
+        const observation_models::LinkDefinition linkEnds,
+        const std::shared_ptr< ObservationDependentVariableSharedData > sharedData )
 {
     // Check if relevant properties of environment exist
     checkObservationDependentVariableEnvironment( bodies, variableSettings );
@@ -164,6 +180,25 @@ ObservationDependentVariableFunction getStationObservationAngleFunction(
             bodies.at( bodyName )->getGroundStationMap( ).at( stationName )->getPointingAnglesCalculator( );
     ObservationDependentVariableFunction outputFunction;
 
+    // Create function to transform link vector to topocentric frame (with rotation shared between all station angles if possible)
+    std::function< Eigen::Vector3d( const std::vector< double >&, const std::vector< Eigen::Matrix< double, 6, 1 > >& ) >
+            topocentricVectorFunction = [=]( const std::vector< double >& linkEndTimes,
+            const std::vector< Eigen::Matrix< double, 6, 1 > >& linkEndStates )
+    {
+        double stationTime = linkEndTimes.at( linkEndIndicesToUse.first );
+        Eigen::Vector3d targetRelativePosition = ( linkEndStates.at( linkEndIndicesToUse.second ) -
+                linkEndStates.at( linkEndIndicesToUse.first ) ).segment( 0, 3 );
+        if( sharedData == nullptr )
+        {
+            return pointingAnglesCalculator->convertVectorFromInertialToTopocentricFrame( targetRelativePosition, stationTime );
+        }
+        else
+        {
+            return Eigen::Vector3d( sharedData->getRotationToTopocentricFrame( pointingAnglesCalculator, stationTime ) *
+                                    targetRelativePosition );
+        }
+    };
+
     if( variableSettings->variableType_ == station_elevation_angle )
     {
         outputFunction = [=]( const std::vector< double >& linkEndTimes,
@@ -171,8 +206,8 @@ ObservationDependentVariableFunction getStationObservationAngleFunction(
                 const Eigen::VectorXd& observationValue,
                 const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySimulationSettings )
         {
-            return ( Eigen::VectorXd( 1 ) << ground_stations::calculateGroundStationElevationAngle(
-                        pointingAnglesCalculator, linkEndStates, linkEndTimes, linkEndIndicesToUse ) ).finished( );
+            return ( Eigen::VectorXd( 1 ) << pointingAnglesCalculator->calculateElevationAngle(
+                        topocentricVectorFunction( linkEndTimes, linkEndStates ) ) ).finished( );
         };
     }
     else if( variableSettings->variableType_ == station_azimuth_angle )
@@ -182,8 +217,8 @@ ObservationDependentVariableFunction getStationObservationAngleFunction(
                 const Eigen::VectorXd& observationValue,
                 const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySimulationSettings )
         {
-            return ( Eigen::VectorXd( 1 ) << ground_stations::calculateGroundStationAzimuthAngle(
-                        pointingAnglesCalculator, linkEndStates, linkEndTimes, linkEndIndicesToUse ) ).finished( );
+            return ( Eigen::VectorXd( 1 ) << pointingAnglesCalculator->calculateAzimuthAngle(
+                        topocentricVectorFunction( linkEndTimes, linkEndStates ) ) ).finished( );
         };
     }
     return outputFunction;
@@ -194,7 +229,8 @@ ObservationDependentVariableFunction getInterlinkObservationVariableFunction(
     const SystemOfBodies& bodies,
     const std::shared_ptr< InterlinkObservationDependentVariableSettings > variableSettings,
     const observation_models::ObservableType observableType,
-    const observation_models::LinkDefinition linkEnds )
+    const observation_models::LinkDefinition linkEnds,
+    const std::shared_ptr< ObservationDependentVariableSharedData > sharedData )
 {
     std::pair< int, int > linkEndIndicesToUse = getLinkEndStateTimeIndices(
         observableType, linkEnds, linkEnds.at( variableSettings->startLinkEnd_ ),
@@ -236,6 +272,8 @@ ObservationDependentVariableFunction getInterlinkObservationVariableFunction(
             throw std::runtime_error( "Error when parsing body avoidance observation dependent variable w.r.t. " +
                                       variableSettings->relativeBody_ + ", body has no ephemeris" );
         }
+        std::function< Eigen::Vector6d( const double ) > relativeBodyStateFunction =
+            getObservationDependentVariableBodyStateFunction( bodies.at( variableSettings->relativeBody_ ), sharedData );
 
         outputFunction = [ = ]( const std::vector<double> &linkEndTimes,
                                 const std::vector<Eigen::Matrix<double, 6, 1> > &linkEndStates,
@@ -245,7 +283,7 @@ ObservationDependentVariableFunction getInterlinkObservationVariableFunction(
             double cosineOfAvoidanceAngle = observation_models::computeCosineBodyAvoidanceAngle(
                 linkEndStates.at( linkEndIndicesToUse.first ).segment( 0, 3 ),
                 linkEndStates.at( linkEndIndicesToUse.second ).segment( 0, 3 ),
-                bodies.at( variableSettings->relativeBody_ )->getStateInBaseFrameFromEphemeris<double, double>(
+                relativeBodyStateFunction(
                     ( linkEndTimes.at( linkEndIndicesToUse.first ) + linkEndTimes.at( linkEndIndicesToUse.second ) ) / 2.0 ).segment( 0, 3 ));
             if ( std::fabs( cosineOfAvoidanceAngle ) >= 1.0 )
             {
@@ -272,6 +310,8 @@ ObservationDependentVariableFunction getInterlinkObservationVariableFunction(
             throw std::runtime_error( "Error when parsing link-body distance observation dependent variable w.r.t. " +
                                       variableSettings->relativeBody_ + ", body has no ephemeris" );
         }
+        std::function< Eigen::Vector6d( const double ) > relativeBodyStateFunction =
+            getObservationDependentVariableBodyStateFunction( bodies.at( variableSettings->relativeBody_ ), sharedData );
 
         outputFunction = [ = ]( const std::vector<double> &linkEndTimes,
                                 const std::vector<Eigen::Matrix<double, 6, 1> > &linkEndStates,
@@ -281,7 +321,7 @@ ObservationDependentVariableFunction getInterlinkObservationVariableFunction(
             double minimumDistance = observation_models::computeMinimumLinkDistanceToPoint(
                 linkEndStates.at( linkEndIndicesToUse.first ).segment( 0, 3 ),
                 linkEndStates.at( linkEndIndicesToUse.second ).segment( 0, 3 ),
-                bodies.at( variableSettings->relativeBody_ )->getStateInBaseFrameFromEphemeris<double, double>(
+                relativeBodyStateFunction(
                     ( linkEndTimes.at( linkEndIndicesToUse.first ) + linkEndTimes.at( linkEndIndicesToUse.second ) ) / 2.0 ).segment( 0, 3 ));
             return ( Eigen::Vector1d( ) << minimumDistance ).finished( );
         };
@@ -300,6 +340,8 @@ ObservationDependentVariableFunction getInterlinkObservationVariableFunction(
             throw std::runtime_error( "Error when parsing link-body distance observation dependent variable w.r.t. " +
                                       variableSettings->relativeBody_ + ", body has no ephemeris" );
         }
+        std::function< Eigen::Vector6d( const double ) > relativeBodyStateFunction =
+            getObservationDependentVariableBodyStateFunction( bodies.at( variableSettings->relativeBody_ ), sharedData );
 
         if ( bodies.at( variableSettings->relativeBody_ )->getShapeModel( ) == nullptr )
         {
@@ -315,7 +357,7 @@ ObservationDependentVariableFunction getInterlinkObservationVariableFunction(
             double minimumDistance = observation_models::computeMinimumLinkDistanceToPoint(
                 linkEndStates.at( linkEndIndicesToUse.first ).segment( 0, 3 ),
                 linkEndStates.at( linkEndIndicesToUse.second ).segment( 0, 3 ),
-                bodies.at( variableSettings->relativeBody_ )->getStateInBaseFrameFromEphemeris<double, double>(
+                relativeBodyStateFunction(
                     ( linkEndTimes.at( linkEndIndicesToUse.first ) + linkEndTimes.at( linkEndIndicesToUse.second ) ) / 2.0 ).segment( 0, 3 ));
             return ( Eigen::Vector1d( ) << minimumDistance - shapeModel->getAverageRadius( ) ).finished( );
         };
@@ -334,6 +376,8 @@ ObservationDependentVariableFunction getInterlinkObservationVariableFunction(
             throw std::runtime_error( "Error when parsing link-orbital plane angle observation dependent variable w.r.t. " +
                                       variableSettings->relativeBody_ + ", body has no ephemeris" );
         }
+        std::function< Eigen::Vector6d( const double ) > relativeBodyStateFunction =
+            getObservationDependentVariableBodyStateFunction( bodies.at( variableSettings->relativeBody_ ), sharedData );
 
         outputFunction = [ = ]( const std::vector<double> &linkEndTimes,
                                 const std::vector<Eigen::Matrix<double, 6, 1> > &linkEndStates,
@@ -344,7 +388,7 @@ ObservationDependentVariableFunction getInterlinkObservationVariableFunction(
                 linkEndStates.at( linkEndIndicesToUse.second ).segment( 0, 3 ) -
                 linkEndStates.at( linkEndIndicesToUse.first ).segment( 0, 3 );
             Eigen::Vector6d targetStateWrtCentralBody = linkEndStates.at( linkEndIndicesToUse.second ) -
-                bodies.at( variableSettings->relativeBody_ )->getStateInBaseFrameFromEphemeris<double, double>(
+                relativeBodyStateFunction(
                     linkEndTimes.at( linkEndIndicesToUse.second ) );
             Eigen::Vector3d orbitNormal = targetStateWrtCentralBody.segment< 3 >( 0 ).cross( targetStateWrtCentralBody.segment< 3 >( 3 ) );
             return ( Eigen::Vector1d( ) << linear_algebra::computeAngleBetweenVectors( orbitNormal, vectorToTarget ) - mathematical_constants::PI / 2.0 ).finished( );
@@ -363,7 +407,8 @@ ObservationDependentVariableFunction getObservationVectorDependentVariableFuncti
         const SystemOfBodies& bodies,
         const std::shared_ptr< ObservationDependentVariableSettings > variableSettings,
         const observation_models::ObservableType observableType,
-        const observation_models::LinkDefinition linkEnds )
+        const observation_models::LinkDefinition linkEnds,
+        const std::shared_ptr< ObservationDependentVariableSharedData > sharedData )
 {
     ObservationDependentVariableFunction outputFunction;
     switch( variableSettings->variableType_ )
@@ -378,7 +423,7 @@ ObservationDependentVariableFunction getObservationVectorDependentVariableFuncti
             throw std::runtime_error( "Error in observation dependent variables, incorrect type found for station_elevation_angle" );
         }
         outputFunction = getStationObservationAngleFunction(
-            bodies, angleSettings, observableType, linkEnds );
+            bodies, angleSettings, observableType, linkEnds, sharedData );
         break;
     }
     case station_azimuth_angle:
@@ -392,7 +437,7 @@ ObservationDependentVariableFunction getObservationVectorDependentVariableFuncti
         }
 
         outputFunction = getStationObservationAngleFunction(
-            bodies, angleSettings, observableType, linkEnds );
+            bodies, angleSettings, observableType, linkEnds, sharedData );
         break;
     }
     case target_range:
@@ -406,7 +451,7 @@ ObservationDependentVariableFunction getObservationVectorDependentVariableFuncti
         }
 
         outputFunction = getInterlinkObservationVariableFunction(
-            bodies, linkSettings, observableType, linkEnds );
+            bodies, linkSettings, observableType, linkEnds, sharedData );
         break;
     }
     case body_avoidance_angle_variable:
@@ -420,7 +465,7 @@ ObservationDependentVariableFunction getObservationVectorDependentVariableFuncti
         }
 
         outputFunction = getInterlinkObservationVariableFunction(
-            bodies, linkSettings, observableType, linkEnds );
+            bodies, linkSettings, observableType, linkEnds, sharedData );
         break;
     }
     case link_limb_distance:
@@ -434,7 +479,7 @@ ObservationDependentVariableFunction getObservationVectorDependentVariableFuncti
         }
 
         outputFunction = getInterlinkObservationVariableFunction(
-            bodies, linkSettings, observableType, linkEnds );
+            bodies, linkSettings, observableType, linkEnds, sharedData );
         break;
     }
     case link_body_center_distance:
@@ -448,7 +493,7 @@ ObservationDependentVariableFunction getObservationVectorDependentVariableFuncti
         }
 
         outputFunction = getInterlinkObservationVariableFunction(
-            bodies, linkSettings, observableType, linkEnds );
+            bodies, linkSettings, observableType, linkEnds, sharedData );
         break;
     }
     case link_angle_with_orbital_plane:
@@ -462,7 +507,7 @@ ObservationDependentVariableFunction getObservationVectorDependentVariableFuncti
         }
 
         outputFunction = getInterlinkObservationVariableFunction(
-            bodies, linkSettings, observableType, linkEnds );
+            bodies, linkSettings, observableType, linkEnds, sharedData );
         break;
     }
     case doppler_integration_time_dependent_variable:
@@ -540,11 +585,11 @@ void ObservationDependentVariableCalculator::addDependentVariable(
         // Create function to compute dependent variable
         ObservationDependentVariableFunction observationDependentVariableFunction =
                 getObservationVectorDependentVariableFunction(
-                    bodies, variableSettings, observableType_, linkEnds_ );
+                    bodies, variableSettings, observableType_, linkEnds_, sharedData_ );
 
         // Create function to compute dependent variable and add to existing list
         ObservationDependentVariableAddFunction dependentVariableAddFunction = [=](
-                Eigen::VectorXd& dependentVariables,
+                Eigen::Ref< Eigen::VectorXd > dependentVariables,
                 const std::vector< double >& linkEndTimes,
                 const std::vector< Eigen::Matrix< double, 6, 1 > >& linkEndStates,
                 const Eigen::VectorXd& observable,
@@ -612,7 +657,29 @@ Eigen::VectorXd ObservationDependentVariableCalculator::calculateDependentVariab
         const Eigen::VectorXd& observation,
         const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > observationAncilliarySimulationSettings )
 {
-    Eigen::VectorXd dependentVariables = Eigen::VectorXd::Constant( totalDependentVariableSize_, TUDAT_NAN );
+    Eigen::VectorXd dependentVariables = Eigen::VectorXd( totalDependentVariableSize_ );
+    calculateDependentVariables( dependentVariables, linkEndTimes, linkEndStates, observation,
+                                 observationAncilliarySimulationSettings );
+    return dependentVariables;
+}
+
+void ObservationDependentVariableCalculator::calculateDependentVariables(
+        Eigen::Ref< Eigen::VectorXd > dependentVariables,
+        const std::vector< double >& linkEndTimes,
+        const std::vector< Eigen::Matrix< double, 6, 1 > >& linkEndStates,
+        const Eigen::VectorXd& observation,
+        const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > observationAncilliarySimulationSettings )
+{
+    if( dependentVariables.rows( ) != totalDependentVariableSize_ )
+    {
+        throw std::runtime_error( "Error when computing observation dependent variables; output size is " +
+                                  std::to_string( dependentVariables.rows( ) ) + ", but " +
+                                  std::to_string( totalDependentVariableSize_ ) + " is required" );
+    }
+    dependentVariables.setConstant( TUDAT_NAN );
+
+    // Remove environment quantities stored for previous observation
+    sharedData_->reset( );
 
     for( unsigned int i = 0; i < dependentVariableAddFunctions_.size( ); i++ )
     {
@@ -620,7 +687,31 @@ Eigen::VectorXd ObservationDependentVariableCalculator::calculateDependentVariab
                     dependentVariables, linkEndTimes, linkEndStates, observation, observationAncilliarySimulationSettings );
 
     }
-    return dependentVariables;
+}
+
+void ObservationDependentVariableCalculator::calculateDependentVariables(
+        Eigen::MatrixXd& dependentVariables,
+        const std::vector< std::vector< double > >& linkEndTimes,
+        const std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates,
+        const Eigen::MatrixXd& observations,
+        const std::shared_ptr< observation_models::ObservationAncilliarySimulationSettings > ancilliarySimulationSettings )
+{
+    int numberOfObservations = linkEndTimes.size( );
+    if( static_cast< int >( linkEndStates.size( ) ) != numberOfObservations || observations.cols( ) != numberOfObservations )
+    {
+        throw std::runtime_error( "Error when computing observation dependent variables for batch of observations; input sizes are inconsistent" );
+    }
+
+    dependentVariables.resize( totalDependentVariableSize_, numberOfObservations );
+
+    // Compute dependent variables of each observation directly in the associated column of the output
+    Eigen::VectorXd currentObservation;
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        currentObservation = observations.col( i );
+        calculateDependentVariables( dependentVariables.col( i ), linkEndTimes.at( i ), linkEndStates.at( i ),
+                                     currentObservation, ancilliarySimulationSettings );
+    }
 }
 
 
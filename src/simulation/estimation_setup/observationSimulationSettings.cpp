@@ -40,6 +40,48 @@ std::function< Eigen::VectorXd( const double ) > getNoiseFunctionForObservable(
     return noiseFunction;
 }
 
+//! Function to retrieve the key of counter-based observation noise, for a given observable type and set of link ends.
+std::uint64_t getObservationNoiseKey(
+        const std::uint64_t seed,
+        const observation_models::ObservableType observableType,
+        const observation_models::LinkDefinition& linkEnds )
+{
+    std::uint64_t key = statistics::combineRandomNumberGeneratorKey( seed, static_cast< std::uint64_t >( observableType ) );
+    for( auto linkEndIterator : linkEnds.linkEnds_ )
+    {
+        key = statistics::combineRandomNumberGeneratorKey( key, static_cast< std::uint64_t >( linkEndIterator.first ) );
+        key = statistics::combineRandomNumberGeneratorKey( key, linkEndIterator.second.bodyName_ );
+        key = statistics::combineRandomNumberGeneratorKey( key, linkEndIterator.second.stationName_ );
+    }
+    return key;
+}
+
+//! Function to create a first-order Gauss-Markov noise function for an observable.
+std::function< Eigen::VectorXd( const double ) > getFirstOrderGaussMarkovNoiseFunction(
+        const double standardDeviation,
+        const double correlationTime,
+        const double startTime,
+        const double endTime,
+        const double timeStep,
+        const std::uint64_t key,
+        const int observableSize )
+{
+    if( !( endTime > startTime ) || !( timeStep > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating Gauss-Markov noise function, time interval or step is invalid." );
+    }
+
+    // Generate noise for each entry of observable, covering full time interval
+    int numberOfSamples = static_cast< int >( std::ceil( ( endTime - startTime ) / timeStep ) ) + 1;
+    Eigen::MatrixXd noiseSequence = Eigen::MatrixXd( numberOfSamples, observableSize );
+    for( int i = 0; i < observableSize; i++ )
+    {
+        noiseSequence.col( i ) = statistics::generateFirstOrderGaussMarkovNoise(
+                    statistics::combineRandomNumberGeneratorKey( key, static_cast< std::uint64_t >( i ) ),
+                    numberOfSamples, timeStep, correlationTime, standardDeviation );
+    }
+    return statistics::getTabulatedNoiseFunction( noiseSequence, startTime, timeStep );
+}
 
 Eigen::VectorXd getIdenticallyAndIndependentlyDistributedNoise(
         const std::function< double( const double ) > noiseFunction,
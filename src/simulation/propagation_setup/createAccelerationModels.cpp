@@ -25,6 +25,7 @@
 #include "tudat/astro/reference_frames/referenceFrameTransformations.h"
 #include "tudat/astro/relativity/relativisticAccelerationCorrection.h"
 #include "tudat/astro/relativity/metric.h"
+#include "tudat/astro/relativity/einsteinInfeldHoffmannAcceleration.h"
 #include "tudat/basics/utilities.h"
 #include "tudat/simulation/propagation_setup/accelerationSettings.h"
 #include "tudat/simulation/propagation_setup/createAccelerationModels.h"
@@ -110,6 +111,14 @@ std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > cre
                 nameOfBodyExertingAcceleration,
                 sumGravitationalParameters);
         break;
+    case mascon_gravity:
+        accelerationModel = createMasconGravityAcceleration(
+                bodyUndergoingAcceleration,
+                bodyExertingAcceleration,
+                nameOfBodyUndergoingAcceleration,
+                nameOfBodyExertingAcceleration,
+                sumGravitationalParameters);
+        break;
     default:
 
         std::string errorMessage = "Error when making gravitional acceleration model, cannot parse type " +
@@ -196,6 +205,19 @@ std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > cre
                         accelerationSettings, "", 1 ) ),
                 nameOfCentralBody );
         break;
+    case mascon_gravity:
+        accelerationModel = std::make_shared< ThirdBodyMasconGravitationalAccelerationModel >(
+                std::dynamic_pointer_cast< MasconGravitationalAccelerationModel >(
+                    createDirectGravitationalAcceleration(
+                        bodyUndergoingAcceleration, bodyExertingAcceleration,
+                        nameOfBodyUndergoingAcceleration, nameOfBodyExertingAcceleration,
+                        accelerationSettings, "", 0 ) ),
+                std::dynamic_pointer_cast< MasconGravitationalAccelerationModel >(
+                    createDirectGravitationalAcceleration(
+                        centralBody, bodyExertingAcceleration, nameOfCentralBody, nameOfBodyExertingAcceleration,
+                        accelerationSettings, "", 1 ) ),
+                nameOfCentralBody );
+        break;
     default:
 
         std::string errorMessage = "Error when making third-body gravitional acceleration model, cannot parse type " +
@@ -221,7 +243,8 @@ std::shared_ptr< AccelerationModel< Eigen::Vector3d > > createGravitationalAccel
             accelerationSettings->accelerationType_ != spherical_harmonic_gravity &&
             accelerationSettings->accelerationType_ != mutual_spherical_harmonic_gravity &&
             accelerationSettings->accelerationType_ != polyhedron_gravity &&
-            accelerationSettings->accelerationType_ != ring_gravity )
+            accelerationSettings->accelerationType_ != ring_gravity &&
+            accelerationSettings->accelerationType_ != mascon_gravity )
     {
         throw std::runtime_error( "Error when making gravitational acceleration, type is inconsistent" );
     }
@@ -756,6 +779,88 @@ std::shared_ptr< gravitation::RingGravitationalAccelerationModel > createRingGra
     return accelerationModel;
 }
 
+std::shared_ptr< gravitation::MasconGravitationalAccelerationModel > createMasconGravityAcceleration(
+        const std::shared_ptr< Body > bodyUndergoingAcceleration,
+        const std::shared_ptr< Body > bodyExertingAcceleration,
+        const std::string& nameOfBodyUndergoingAcceleration,
+        const std::string& nameOfBodyExertingAcceleration,
+        const bool useCentralBodyFixedFrame )
+{
+
+    // Declare pointer to return object
+    std::shared_ptr< MasconGravitationalAccelerationModel > accelerationModel;
+
+    // Get pointer to gravity field of central body and cast to required type.
+    std::shared_ptr< MasconGravityField > masconGravityField =
+            std::dynamic_pointer_cast< MasconGravityField >(
+                bodyExertingAcceleration->getGravityFieldModel( ) );
+
+    std::shared_ptr< RotationalEphemeris> rotationalEphemeris = bodyExertingAcceleration->getRotationalEphemeris( );
+
+    if( masconGravityField == nullptr )
+    {
+        throw std::runtime_error(
+                    std::string( "Error, mascon gravity field model not set when ")
+                    + " making mascon gravitational acceleration of " +
+                    nameOfBodyExertingAcceleration +
+                    " on " + nameOfBodyUndergoingAcceleration );
+    }
+    else
+    {
+        if( rotationalEphemeris == nullptr )
+        {
+            throw std::runtime_error( "Warning when making mascon acceleration on body " +
+                                      nameOfBodyUndergoingAcceleration + ", no rotation model found for " +
+                                      nameOfBodyExertingAcceleration );
+        }
+
+        if( rotationalEphemeris->getTargetFrameOrientation( ) != masconGravityField->getFixedReferenceFrame( ) )
+        {
+            throw std::runtime_error( "Warning when making mascon acceleration on body " +
+                                      nameOfBodyUndergoingAcceleration + ", rotation model found for " +
+                                      nameOfBodyExertingAcceleration + " is incompatible, frames are: " +
+                                      rotationalEphemeris->getTargetFrameOrientation( ) + " and " +
+                                      masconGravityField->getFixedReferenceFrame( ) );
+        }
+
+        std::function< double( ) > gravitationalParameterFunction;
+
+        // Check if mutual acceleration is to be used.
+        if( useCentralBodyFixedFrame == false ||
+                bodyUndergoingAcceleration->getGravityFieldModel( ) == nullptr )
+        {
+            gravitationalParameterFunction =
+                    std::bind( &MasconGravityField::getGravitationalParameter, masconGravityField );
+        }
+        else
+        {
+            // Create function returning summed gravitational parameter of the two bodies.
+            std::function< double( ) > gravitationalParameterOfBodyExertingAcceleration =
+                    std::bind( &gravitation::GravityFieldModel::getGravitationalParameter,
+                               masconGravityField );
+            std::function< double( ) > gravitationalParameterOfBodyUndergoingAcceleration =
+                    std::bind( &gravitation::GravityFieldModel::getGravitationalParameter,
+                               bodyUndergoingAcceleration->getGravityFieldModel( ) );
+            gravitationalParameterFunction =
+                    std::bind( &utilities::sumFunctionReturn< double >,
+                               gravitationalParameterOfBodyExertingAcceleration,
+                               gravitationalParameterOfBodyUndergoingAcceleration );
+        }
+
+        // Create acceleration object.
+        accelerationModel =
+                std::make_shared< MasconGravitationalAccelerationModel >(
+                        std::bind( &Body::getPositionByReference, bodyUndergoingAcceleration, std::placeholders::_1 ),
+                        gravitationalParameterFunction,
+                        masconGravityField,
+                        std::bind( &Body::getPositionByReference, bodyExertingAcceleration, std::placeholders::_1 ),
+                        std::bind( &Body::getCurrentRotationToGlobalFrame, bodyExertingAcceleration ),
+                        useCentralBodyFixedFrame );
+
+    }
+    return accelerationModel;
+}
+
 //! Function to create a third body central gravity acceleration model.
 std::shared_ptr< gravitation::ThirdBodyCentralGravityAcceleration >
 createThirdBodyCentralGravityAccelerationModel(
@@ -1274,6 +1379,65 @@ std::shared_ptr< electromagnetism::YarkovskyAcceleration > createYarkovskyAccele
 }
 
 
+//! Function to create the object computing the Einstein-Infeld-Hoffmann equations for all bodies with EIH accelerations.
+std::shared_ptr< relativity::EinsteinInfeldHoffmannEquations > createEinsteinInfeldHoffmannEquations(
+        const SystemOfBodies& bodies,
+        const SelectedAccelerationList& selectedAccelerationPerBody )
+{
+    // Retrieve names of all bodies undergoing or exerting EIH accelerations, in order of first occurrence
+    std::vector< std::string > bodyNames;
+    for( auto bodyIterator : selectedAccelerationPerBody )
+    {
+        for( unsigned int i = 0; i < bodyIterator.second.size( ); i++ )
+        {
+            if( bodyIterator.second.at( i ).second->accelerationType_ ==
+                    basic_astrodynamics::einstein_infeld_hoffmann_acceleration )
+            {
+                if( std::find( bodyNames.begin( ), bodyNames.end( ), bodyIterator.first ) == bodyNames.end( ) )
+                {
+                    bodyNames.push_back( bodyIterator.first );
+                }
+                if( std::find( bodyNames.begin( ), bodyNames.end( ), bodyIterator.second.at( i ).first ) == bodyNames.end( ) )
+                {
+                    bodyNames.push_back( bodyIterator.second.at( i ).first );
+                }
+            }
+        }
+    }
+
+    std::shared_ptr< relativity::EinsteinInfeldHoffmannEquations > eihEquations;
+    if( bodyNames.size( ) > 0 )
+    {
+        // Retrieve state and gravitational parameter functions of all bodies
+        std::vector< std::function< double( ) > > gravitationalParameterFunctions;
+        std::vector< std::function< Eigen::Vector6d( ) > > stateFunctions;
+        for( unsigned int i = 0; i < bodyNames.size( ); i++ )
+        {
+            if( bodies.count( bodyNames.at( i ) ) == 0 )
+            {
+                throw std::runtime_error( "Error when making Einstein-Infeld-Hoffmann equations, body " +
+                                          bodyNames.at( i ) + " not found" );
+            }
+            std::shared_ptr< Body > currentBody = bodies.at( bodyNames.at( i ) );
+            std::shared_ptr< GravityFieldModel > gravityField = currentBody->getGravityFieldModel( );
+            if( gravityField == nullptr )
+            {
+                throw std::runtime_error( "Error when making Einstein-Infeld-Hoffmann equations, body " +
+                                          bodyNames.at( i ) + " does not have a gravity field" );
+            }
+            gravitationalParameterFunctions.push_back(
+                        std::bind( &GravityFieldModel::getGravitationalParameter, gravityField ) );
+            stateFunctions.push_back( std::bind( &Body::getState, currentBody ) );
+        }
+
+        eihEquations = std::make_shared< relativity::EinsteinInfeldHoffmannEquations >(
+                    bodyNames, gravitationalParameterFunctions, stateFunctions,
+                    std::bind( &relativity::PPNParameterSet::getParameterGamma, relativity::ppnParameterSet ),
+                    std::bind( &relativity::PPNParameterSet::getParameterBeta, relativity::ppnParameterSet ) );
+    }
+    return eihEquations;
+}
+
 std::shared_ptr< basic_astrodynamics::CustomAccelerationModel > createCustomAccelerationModel(
         const std::shared_ptr< AccelerationSettings > accelerationSettings,
         const std::string& nameOfBodyUndergoingAcceleration )
@@ -1757,6 +1921,7 @@ std::shared_ptr< AccelerationModel< Eigen::Vector3d > > createAccelerationModel(
     case mutual_spherical_harmonic_gravity:
     case polyhedron_gravity:
     case ring_gravity:
+    case mascon_gravity:
         accelerationModelPointer = createGravitationalAccelerationModel(
                     bodyUndergoingAcceleration, bodyExertingAcceleration, accelerationSettings,
                     nameOfBodyUndergoingAcceleration, nameOfBodyExertingAcceleration,
@@ -1838,6 +2003,12 @@ std::shared_ptr< AccelerationModel< Eigen::Vector3d > > createAccelerationModel(
                     nameOfBodyExertingAcceleration,
                     accelerationSettings );
         break;
+    case einstein_infeld_hoffmann_acceleration:
+        throw std::runtime_error(
+                    "Error, Einstein-Infeld-Hoffmann acceleration of " + nameOfBodyExertingAcceleration + " on " +
+                    nameOfBodyUndergoingAcceleration + " must be created through createAccelerationModelsMap, "
+                    "as it requires the full set of mutually attracting bodies" );
+        break;
     case custom_acceleration:
         accelerationModelPointer = createCustomAccelerationModel(
                     accelerationSettings,
@@ -1855,6 +2026,78 @@ std::shared_ptr< AccelerationModel< Eigen::Vector3d > > createAccelerationModel(
     return accelerationModelPointer;
 }
 
+//! Function to let a third-body acceleration of a given type share its central body acceleration model
+template< typename ThirdBodyAccelerationType >
+void shareThirdBodyIndirectAccelerationOfType(
+        const std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
+        const std::string& accelerationKey,
+        std::map< std::string, std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >& thirdBodyAccelerations )
+{
+    std::shared_ptr< ThirdBodyAccelerationType > thirdBodyAcceleration =
+            std::dynamic_pointer_cast< ThirdBodyAccelerationType >( accelerationModel );
+    if( thirdBodyAcceleration != nullptr )
+    {
+        if( thirdBodyAccelerations.count( accelerationKey ) == 0 )
+        {
+            thirdBodyAccelerations[ accelerationKey ] = accelerationModel;
+        }
+        else
+        {
+            thirdBodyAcceleration->shareAccelerationModelForCentralBody(
+                        std::dynamic_pointer_cast< ThirdBodyAccelerationType >( thirdBodyAccelerations.at( accelerationKey ) ) );
+        }
+    }
+}
+
+//! Function to let a third-body acceleration share its indirect term with previously created third-body accelerations
+void shareThirdBodyIndirectAcceleration(
+        const std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
+        const std::shared_ptr< AccelerationSettings > accelerationSettings,
+        const std::string& nameOfBodyExertingAcceleration,
+        const std::string& nameOfCentralBody,
+        std::map< std::string, std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >& thirdBodyAccelerations )
+{
+    // Identify indirect term by type, perturber and central body
+    std::string accelerationKey = std::to_string( accelerationSettings->accelerationType_ ) + "_" +
+            nameOfBodyExertingAcceleration + "_" + nameOfCentralBody;
+
+    switch( accelerationSettings->accelerationType_ )
+    {
+    case point_mass_gravity:
+        shareThirdBodyIndirectAccelerationOfType< ThirdBodyCentralGravityAcceleration >(
+                    accelerationModel, accelerationKey, thirdBodyAccelerations );
+        break;
+    case spherical_harmonic_gravity:
+    {
+        // Indirect term also depends on the degree and order of the expansion
+        std::shared_ptr< SphericalHarmonicAccelerationSettings > sphericalHarmonicsSettings =
+                std::dynamic_pointer_cast< SphericalHarmonicAccelerationSettings >( accelerationSettings );
+        if( sphericalHarmonicsSettings != nullptr )
+        {
+            accelerationKey += "_" + std::to_string( sphericalHarmonicsSettings->maximumDegree_ ) +
+                    "_" + std::to_string( sphericalHarmonicsSettings->maximumOrder_ );
+            shareThirdBodyIndirectAccelerationOfType< ThirdBodySphericalHarmonicsGravitationalAccelerationModel >(
+                        accelerationModel, accelerationKey, thirdBodyAccelerations );
+        }
+        break;
+    }
+    case polyhedron_gravity:
+        shareThirdBodyIndirectAccelerationOfType< ThirdBodyPolyhedronGravitationalAccelerationModel >(
+                    accelerationModel, accelerationKey, thirdBodyAccelerations );
+        break;
+    case ring_gravity:
+        shareThirdBodyIndirectAccelerationOfType< ThirdBodyRingGravitationalAccelerationModel >(
+                    accelerationModel, accelerationKey, thirdBodyAccelerations );
+        break;
+    case mascon_gravity:
+        shareThirdBodyIndirectAccelerationOfType< ThirdBodyMasconGravitationalAccelerationModel >(
+                    accelerationModel, accelerationKey, thirdBodyAccelerations );
+        break;
+    default:
+        break;
+    }
+}
+
 //! Function to put SelectedAccelerationMap in correct order, to ensure correct model creation
 SelectedAccelerationList orderSelectedAccelerationMap( const SelectedAccelerationMap& selectedAccelerationsPerBody )
 {
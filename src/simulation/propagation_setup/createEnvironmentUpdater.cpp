@@ -501,6 +501,10 @@ createTranslationalEquationsOfMotionEnvironmentUpdaterSettings(
                     singleAccelerationUpdateNeeds[ body_rotational_state_update ].push_back(
                             accelerationModelIterator->first );
                     break;
+                case mascon_gravity:
+                    singleAccelerationUpdateNeeds[ body_rotational_state_update ].push_back(
+                            accelerationModelIterator->first );
+                    break;
                 case third_body_spherical_harmonic_gravity:
                 {
                     singleAccelerationUpdateNeeds[ body_rotational_state_update ].push_back(
@@ -611,6 +615,30 @@ createTranslationalEquationsOfMotionEnvironmentUpdaterSettings(
                     }
                     break;
                 }
+                case third_body_mascon_gravity:
+                {
+                    singleAccelerationUpdateNeeds[ body_rotational_state_update ].push_back(
+                        accelerationModelIterator->first );
+
+                    std::shared_ptr< gravitation::ThirdBodyMasconGravitationalAccelerationModel >
+                        thirdBodyAcceleration = std::dynamic_pointer_cast<
+                            gravitation::ThirdBodyMasconGravitationalAccelerationModel >(
+                                accelerationModelIterator->second.at( i ) );
+
+                    if( thirdBodyAcceleration != nullptr && translationalAccelerationModels.count(
+                                thirdBodyAcceleration->getCentralBodyName( ) ) == 0 )
+                    {
+                        singleAccelerationUpdateNeeds[ body_translational_state_update ].push_back(
+                                    thirdBodyAcceleration->getCentralBodyName( ) );
+                    }
+                    else if( thirdBodyAcceleration == nullptr )
+                    {
+                        throw std::runtime_error(
+                                "Error, incompatible input (ThirdBodyMasconGravitationalAccelerationModel "
+                                "to createTranslationalEquationsOfMotion EnvironmentUpdaterSettings" );
+                    }
+                    break;
+                }
                 case thrust_acceleration:
                 {
                     std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > > thrustModelUpdates =
@@ -657,6 +685,22 @@ createTranslationalEquationsOfMotionEnvironmentUpdaterSettings(
                     break;
                 case yarkovsky_acceleration:
                         break;
+                case einstein_infeld_hoffmann_acceleration:
+                {
+                    // Add translational states of all bodies in the EIH equations that are not propagated
+                    std::vector< std::string > eihBodyNames =
+                            std::dynamic_pointer_cast< relativity::EinsteinInfeldHoffmannAcceleration >(
+                                accelerationModelIterator->second.at( i ) )->getEihEquations( )->getBodyNames( );
+                    for( unsigned int j = 0; j < eihBodyNames.size( ); j++ )
+                    {
+                        if( translationalAccelerationModels.count( eihBodyNames.at( j ) ) == 0 )
+                        {
+                            singleAccelerationUpdateNeeds[ body_translational_state_update ].push_back(
+                                        eihBodyNames.at( j ) );
+                        }
+                    }
+                    break;
+                }
                 case custom_acceleration:
                     break;
                 default:
@@ -1102,6 +1102,59 @@ BOOST_AUTO_TEST_CASE( test_nrlmise_InputFunction_with_adjustment )
     BOOST_CHECK_CLOSE_FRACTION(verificationData[5]*1000 , computedDensity , 1E-11);
 }
 
+//! Perform NRLMSISE-00 test 23 - Test input function using solar activity table
+// Corresponds to test 22, but uses columnar solar activity table to retrieve solar activity data.
+BOOST_AUTO_TEST_CASE( test_nrlmise_InputFunction_from_table )
+{
+    // DD-MM-YY = 21-06-2030 , Hrs-Min-Sec = 8-3-20
+    double julianDate = tudat::basic_astrodynamics::convertCalendarDateToJulianDay< double >( 2030, 6, 21, 8, 3, 20.0 );
+    double time = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                    julianDate , tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000) ;
+
+    double altitude     = 400.0E3       ; // km
+    double longitude    = -70.0 * PI / 180.0  ;
+    double latitude     = 60.0 * PI / 180.0  ;
+
+    // find space weather file
+    std::string spaceWeatherFilePath = tudat::paths::getTudatTestDataPath( ) + "/swAtmosTestWithAdjust.txt";
+
+    tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
+            tudat::input_output::solar_activity::readSolarActivityData( spaceWeatherFilePath );
+    std::shared_ptr< tudat::input_output::solar_activity::SolarActivityTable > solarActivityTable =
+            tudat::input_output::solar_activity::readSolarActivityTable( spaceWeatherFilePath );
+
+    // Check that input from table is identical to input from map
+    tudat::aerodynamics::NRLMSISE00Input inputFromMap = tudat::aerodynamics::nrlmsiseInputFunction(
+                altitude, longitude, latitude, time, solarActivityData, true, 16.0 );
+    tudat::aerodynamics::NRLMSISE00Input inputFromTable = tudat::aerodynamics::nrlmsiseInputFunctionFromTable(
+                altitude, longitude, latitude, time, solarActivityTable, true, 16.0 );
+    BOOST_CHECK_EQUAL( inputFromMap.year, inputFromTable.year );
+    BOOST_CHECK_EQUAL( inputFromMap.dayOfTheYear, inputFromTable.dayOfTheYear );
+    BOOST_CHECK_EQUAL( inputFromMap.secondOfTheDay, inputFromTable.secondOfTheDay );
+    BOOST_CHECK_EQUAL( inputFromMap.f107, inputFromTable.f107 );
+    BOOST_CHECK_EQUAL( inputFromMap.f107a, inputFromTable.f107a );
+    BOOST_CHECK_EQUAL( inputFromMap.apDaily, inputFromTable.apDaily );
+    BOOST_CHECK_EQUAL_COLLECTIONS( inputFromMap.apVector.begin( ), inputFromMap.apVector.end( ),
+                                   inputFromTable.apVector.begin( ), inputFromTable.apVector.end( ) );
+
+    // Create atmosphere model using NRLMISE00 input function
+    // Local solar time is set to 16.0 to correspond with testing data!
+    std::function< tudat::aerodynamics::NRLMSISE00Input (double,double,double,double) > inputFunction =
+            std::bind( &tudat::aerodynamics::nrlmsiseInputFunctionFromTable, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, std::placeholders::_4, solarActivityTable, true, 16.0 );
+    tudat::aerodynamics::NRLMSISE00Atmosphere atmosphereModel( inputFunction );
+
+    // Verification data
+    std::vector<double> verificationData = { 6.665176904952E+05, 1.138805559752E+08, 1.998210925573E+07,
+            4.022763585713E+05, 3.557464994516E+03, 4.074713532757E-15,
+            3.475312399717E+04, 4.095913268293E+06, 2.667273209336E+04,
+            1.250539943561E+03, 1.241416130019E+03 };
+
+    double computedDensity = atmosphereModel.getDensity( altitude , longitude, latitude , time ) ;
+
+    BOOST_CHECK_CLOSE_FRACTION(verificationData[5]*1000 , computedDensity , 1E-11);
+}
+
 BOOST_AUTO_TEST_CASE( test_nrlmise_FullFileLoad )
 {
 
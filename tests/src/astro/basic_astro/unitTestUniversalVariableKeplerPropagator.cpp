@@ -0,0 +1,152 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/basic_astro/keplerPropagator.h"
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/basic_astro/universalVariableKeplerPropagator.h"
+#include "tudat/basics/basicTypedefs.h"
+#include "tudat/math/basic/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace orbital_element_conversions;
+
+BOOST_AUTO_TEST_SUITE( test_universal_variable_kepler_propagator )
+
+//! Get set of Keplerian test orbits (elliptic, near-circular, near-parabolic and hyperbolic)
+std::vector< Eigen::Vector6d > getTestKeplerianStates( )
+{
+    std::vector< Eigen::Vector6d > keplerianStates;
+
+    Eigen::Vector6d keplerianState;
+    keplerianState << 7.0E6, 0.1, 0.5, 1.2, 2.3, 0.4;
+    keplerianStates.push_back( keplerianState );
+
+    keplerianState << 4.2E7, 1.0E-4, 1.0E-3, 0.2, 4.0, 5.0;
+    keplerianStates.push_back( keplerianState );
+
+    keplerianState << 1.0E8, 0.95, 2.0, 3.0, 1.0, 0.3;
+    keplerianStates.push_back( keplerianState );
+
+    keplerianState << -2.0E7, 1.8, 0.3, 0.7, 1.5, -0.6;
+    keplerianStates.push_back( keplerianState );
+
+    return keplerianStates;
+}
+
+//! Compare propagated states with conventional Kepler propagation through Keplerian elements
+BOOST_AUTO_TEST_CASE( testUniversalVariablePropagationAgainstKeplerPropagation )
+{
+    const double gravitationalParameter = 3.986004418E14;
+    const std::vector< double > propagationTimes = { 600.0, -600.0, 2.0E4, -3.5E4, 1.0E5 };
+
+    std::vector< Eigen::Vector6d > keplerianStates = getTestKeplerianStates( );
+    for( unsigned int i = 0; i < keplerianStates.size( ); i++ )
+    {
+        const Eigen::Vector6d initialCartesianState = convertKeplerianToCartesianElements(
+                    keplerianStates.at( i ), gravitationalParameter );
+
+        for( unsigned int j = 0; j < propagationTimes.size( ); j++ )
+        {
+            const Eigen::Vector6d expectedFinalState = convertKeplerianToCartesianElements(
+                        propagateKeplerOrbit( keplerianStates.at( i ), propagationTimes.at( j ), gravitationalParameter ),
+                        gravitationalParameter );
+            const Eigen::Vector6d computedFinalState = propagateCartesianStateWithUniversalVariables(
+                        initialCartesianState, propagationTimes.at( j ), gravitationalParameter );
+
+            for( int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( computedFinalState( k ) - expectedFinalState( k ),
+                                   1.0E-9 * expectedFinalState.segment( 0, 3 ).norm( ) );
+                BOOST_CHECK_SMALL( computedFinalState( k + 3 ) - expectedFinalState( k + 3 ),
+                                   1.0E-9 * expectedFinalState.segment( 3, 3 ).norm( ) );
+            }
+        }
+
+        // Check that forward and backward propagation returns the initial state
+        const Eigen::Vector6d intermediateState = propagateCartesianStateWithUniversalVariables(
+                    initialCartesianState, 1.0E4, gravitationalParameter );
+        const Eigen::Vector6d returnedState = propagateCartesianStateWithUniversalVariables(
+                    intermediateState, -1.0E4, gravitationalParameter );
+        for( int k = 0; k < 3; k++ )
+        {
+            BOOST_CHECK_SMALL( returnedState( k ) - initialCartesianState( k ),
+                               1.0E-11 * initialCartesianState.segment( 0, 3 ).norm( ) );
+            BOOST_CHECK_SMALL( returnedState( k + 3 ) - initialCartesianState( k + 3 ),
+                               1.0E-11 * initialCartesianState.segment( 3, 3 ).norm( ) );
+        }
+    }
+}
+
+//! Compare analytical state transition matrix with central differences
+BOOST_AUTO_TEST_CASE( testUniversalVariableStateTransitionMatrix )
+{
+    const double gravitationalParameter = 3.986004418E14;
+    const std::vector< double > propagationTimes = { 900.0, -4.0E3, 3.0E4 };
+
+    std::vector< Eigen::Vector6d > keplerianStates = getTestKeplerianStates( );
+    for( unsigned int i = 0; i < keplerianStates.size( ); i++ )
+    {
+        const Eigen::Vector6d initialCartesianState = convertKeplerianToCartesianElements(
+                    keplerianStates.at( i ), gravitationalParameter );
+
+        for( unsigned int j = 0; j < propagationTimes.size( ); j++ )
+        {
+            Eigen::Matrix6d analyticalStateTransitionMatrix;
+            propagateCartesianStateWithUniversalVariables(
+                        initialCartesianState, propagationTimes.at( j ), gravitationalParameter,
+                        &analyticalStateTransitionMatrix );
+
+            Eigen::Matrix6d numericalStateTransitionMatrix;
+            for( int k = 0; k < 6; k++ )
+            {
+                const double perturbation = ( k < 3 ) ? 1.0 : 1.0E-3;
+                Eigen::Vector6d perturbedInitialState = initialCartesianState;
+
+                perturbedInitialState( k ) += perturbation;
+                const Eigen::Vector6d upperState = propagateCartesianStateWithUniversalVariables(
+                            perturbedInitialState, propagationTimes.at( j ), gravitationalParameter );
+
+                perturbedInitialState( k ) -= 2.0 * perturbation;
+                const Eigen::Vector6d lowerState = propagateCartesianStateWithUniversalVariables(
+                            perturbedInitialState, propagationTimes.at( j ), gravitationalParameter );
+
+                numericalStateTransitionMatrix.col( k ) = ( upperState - lowerState ) / ( 2.0 * perturbation );
+            }
+
+            for( int k = 0; k < 6; k++ )
+            {
+                for( int l = 0; l < 6; l++ )
+                {
+                    BOOST_CHECK_SMALL( analyticalStateTransitionMatrix( k, l ) - numericalStateTransitionMatrix( k, l ),
+                                       1.0E-5 * numericalStateTransitionMatrix.block( 3 * ( k / 3 ), 3 * ( l / 3 ), 3, 3 ).norm( ) );
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
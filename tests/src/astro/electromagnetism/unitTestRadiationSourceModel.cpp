@@ -953,6 +953,47 @@ BOOST_AUTO_TEST_CASE( generatePaneledSphericalCap_EqualProjectedAttenuatedArea_R
     }
 }
 
+//! Test if pole-aligned paneling template gives same panels as direct generation for changing target positions
+BOOST_AUTO_TEST_CASE( testSphericalCapPanelingTemplate )
+{
+    const auto radius = 1736e3;
+    const std::vector<int> numberOfPanelsPerRing{6, 12, 18};
+
+    SphericalCapPanelingTemplate panelingTemplate(numberOfPanelsPerRing);
+    BOOST_CHECK_EQUAL(panelingTemplate.getNumberOfPanels(), 37);
+
+    const std::vector<Eigen::Vector3d> targetPositions{
+            Eigen::Vector3d(389737.1519614824, 1558948.6078459297, -779474.3039229648),
+            Eigen::Vector3d(389737.1519614824, 1558948.6078459297, -779474.3039229648),
+            (radius + 20e3) * Eigen::Vector3d(0.3, -0.2, 0.9).normalized(),
+            (radius + 2000e3) * Eigen::Vector3d(-0.7, 0.1, -0.1).normalized()
+    };
+
+    for (const auto& targetPosition : targetPositions)
+    {
+        panelingTemplate.generatePanels(targetPosition, radius);
+
+        const auto expectedPanels = generatePaneledSphericalCap_EqualProjectedAttenuatedArea(
+                targetPosition, numberOfPanelsPerRing, radius);
+        const auto& expectedPanelCenters = std::get<0>(expectedPanels);
+        const auto& expectedPolarAngles = std::get<1>(expectedPanels);
+        const auto& expectedAzimuthAngles = std::get<2>(expectedPanels);
+        const auto& expectedAreas = std::get<3>(expectedPanels);
+
+        for (unsigned int i = 0; i < panelingTemplate.getNumberOfPanels(); ++i)
+        {
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                BOOST_CHECK_SMALL(panelingTemplate.getPanelCenters()(j, i) - expectedPanelCenters[i](j), 1e-8);
+            }
+            BOOST_CHECK_SMALL(panelingTemplate.getPolarAngles()[i] - expectedPolarAngles[i], 1e-14);
+            BOOST_CHECK_SMALL(
+                    std::sin(panelingTemplate.getAzimuthAngles()[i] - expectedAzimuthAngles[i]), 1e-14);
+            BOOST_CHECK_CLOSE_FRACTION(panelingTemplate.getAreas()[i], expectedAreas[i], 1e-14);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -113,6 +113,51 @@ BOOST_AUTO_TEST_CASE( testSphericalHarmonicsSurfacePropertyDistribution )
     }
 }
 
+//! Test gridded surface property distribution
+BOOST_AUTO_TEST_CASE( testGriddedSurfacePropertyDistribution )
+{
+    Eigen::MatrixXd cosineCoefficients(2, 2);
+    cosineCoefficients << 0.1, 0.0,
+                          0.2, 0.3;
+
+    Eigen::MatrixXd sineCoefficients(2, 2);
+    sineCoefficients << 0.0, 0.0,
+                        0.0, 0.4;
+
+    auto originalDistribution = std::make_shared<SphericalHarmonicsSurfacePropertyDistribution>(
+            cosineCoefficients, sineCoefficients);
+
+    GriddedSurfacePropertyDistribution distributionModel(originalDistribution, 181, 360);
+    distributionModel.updateMembers(TUDAT_NAN);
+
+    BOOST_CHECK(distributionModel.getGridValues().rows() == 181);
+    BOOST_CHECK(distributionModel.getGridValues().cols() == 360);
+
+    // Values at grid points are reproduced exactly, also for longitudes outside [0, 2π)
+    BOOST_CHECK_CLOSE_FRACTION(
+            distributionModel.getValue(0, PI / 4), originalDistribution->getValue(0, PI / 4), 1.0e-14);
+    BOOST_CHECK_CLOSE_FRACTION(
+            distributionModel.getValue(PI / 2, PI / 2), originalDistribution->getValue(PI / 2, PI / 2), 1.0e-14);
+    BOOST_CHECK_CLOSE_FRACTION(
+            distributionModel.getValue(-PI / 4, -PI / 2), originalDistribution->getValue(-PI / 4, 3 * PI / 2), 1.0e-14);
+
+    // Values between grid points are interpolated to second order in grid spacing
+    for (double latitude = -1.5; latitude < 1.5; latitude += 0.137)
+    {
+        for (double longitude = 0.01; longitude < 2 * PI; longitude += 0.291)
+        {
+            BOOST_CHECK_SMALL(
+                    distributionModel.getValue(latitude, longitude) - originalDistribution->getValue(latitude, longitude),
+                    1.0e-4);
+        }
+    }
+
+    // Time-variable distributions cannot be gridded
+    auto timeVariableDistribution = std::make_shared<SecondDegreeZonalPeriodicSurfacePropertyDistribution>(
+            0.34, 0, 0.1, 0, 0.29, 0, 365.25);
+    BOOST_CHECK_THROW(GriddedSurfacePropertyDistribution(timeVariableDistribution, 181, 360), std::runtime_error);
+}
+
 //! Test if second-degree zonal surface property distribution is zonal
 BOOST_AUTO_TEST_CASE( testSecondDegreeZonalPeriodicSurfacePropertyDistribution_Zonality )
 {
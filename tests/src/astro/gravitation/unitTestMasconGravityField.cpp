@@ -0,0 +1,277 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/astro/gravitation/masconGravityField.h"
+#include "tudat/astro/gravitation/polyhedronGravityField.h"
+#include "tudat/astro/basic_astro/polyhedronFuntions.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to create a (pseudo-random) cloud of mascons inside a box, with some negative mass fractions.
+void createTestMascons( const int numberOfMascons, Eigen::MatrixXd& masconPositions, Eigen::VectorXd& masconMassFractions )
+{
+    std::srand( 42 );
+    masconPositions = Eigen::MatrixXd::Random( numberOfMascons, 3 );
+    masconPositions.col( 0 ) *= 2000.0;
+    masconPositions.col( 1 ) *= 1500.0;
+    masconPositions.col( 2 ) *= 1000.0;
+    masconMassFractions = ( Eigen::VectorXd::Random( numberOfMascons ).array( ) + 1.5 ).matrix( );
+    masconMassFractions( 3 ) = -0.4;
+    masconMassFractions( 7 ) = -0.2;
+    masconMassFractions /= masconMassFractions.sum( );
+}
+
+//! Test the functionality of the mascon gravity field class.
+BOOST_AUTO_TEST_SUITE( test_mascon_gravity_field )
+
+//! Test direct summation against a straightforward loop over the mascons
+BOOST_AUTO_TEST_CASE( testDirectSummation )
+{
+    const double gravitationalParameter = 3.0E5;
+    Eigen::MatrixXd masconPositions;
+    Eigen::VectorXd masconMassFractions;
+    createTestMascons( 101, masconPositions, masconMassFractions );
+
+    gravitation::MasconGravityField gravityField(
+                gravitationalParameter, masconPositions, masconMassFractions, 0.0, 8 );
+
+    // Getters return the mascons in the input order
+    BOOST_CHECK_EQUAL( gravityField.getNumberOfMascons( ), 101 );
+    BOOST_CHECK_EQUAL( gravityField.getMasconPositions( ), masconPositions );
+    BOOST_CHECK_EQUAL( gravityField.getMasconMassFractions( ), masconMassFractions );
+
+    std::vector< Eigen::Vector3d > testPositions =
+    { Eigen::Vector3d( 5.0E3, -2.0E3, 1.0E3 ), Eigen::Vector3d( 100.0, 50.0, -20.0 ),
+      Eigen::Vector3d( -3.0E4, 1.0E4, 2.0E4 ) };
+
+    for( const Eigen::Vector3d& position : testPositions )
+    {
+        double expectedPotential = 0.0;
+        Eigen::Vector3d expectedGradient = Eigen::Vector3d::Zero( );
+        Eigen::Matrix3d expectedHessian = Eigen::Matrix3d::Zero( );
+        for( int i = 0; i < masconPositions.rows( ); i++ )
+        {
+            Eigen::Vector3d relativePosition = position - masconPositions.row( i ).transpose( );
+            double distance = relativePosition.norm( );
+            double scaledMu = gravitationalParameter * masconMassFractions( i );
+            expectedPotential += scaledMu / distance;
+            expectedGradient -= scaledMu * relativePosition / std::pow( distance, 3 );
+            expectedHessian += scaledMu * ( 3.0 * relativePosition * relativePosition.transpose( ) /
+                                            std::pow( distance, 5 ) -
+                                            Eigen::Matrix3d::Identity( ) / std::pow( distance, 3 ) );
+        }
+
+        BOOST_CHECK_CLOSE_FRACTION( gravityField.getGravitationalPotential( position ), expectedPotential, 1.0E-13 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( gravityField.getGradientOfPotential( position ), expectedGradient, 1.0E-12 );
+
+        Eigen::Matrix3d computedHessian = gravityField.getHessianOfPotential( position );
+        for( int i = 0; i < 3; i++ )
+        {
+            for( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( computedHessian( i, j ) - expectedHessian( i, j ),
+                                   1.0E-12 * expectedHessian.norm( ) );
+            }
+        }
+
+        // Laplacian vanishes outside the mascons
+        BOOST_CHECK_SMALL( gravityField.getLaplacianOfPotential( position ), 1.0E-12 * expectedHessian.norm( ) );
+    }
+}
+
+//! Test octree (multipole) evaluation against direct summation
+BOOST_AUTO_TEST_CASE( testOctreeEvaluation )
+{
+    const double gravitationalParameter = 3.0E5;
+    Eigen::MatrixXd masconPositions;
+    Eigen::VectorXd masconMassFractions;
+    createTestMascons( 2000, masconPositions, masconMassFractions );
+
+    gravitation::MasconGravityField directField(
+                gravitationalParameter, masconPositions, masconMassFractions, 0.0, 16 );
+    gravitation::MasconGravityField octreeField(
+                gravitationalParameter, masconPositions, masconMassFractions, 0.4, 16 );
+    BOOST_CHECK( octreeField.getOctreeNodes( ).size( ) > 1 );
+
+    std::vector< Eigen::Vector3d > testPositions =
+    { Eigen::Vector3d( 3.0E3, -2.0E3, 1.5E3 ), Eigen::Vector3d( 1.0E4, 2.0E3, -4.0E3 ),
+      Eigen::Vector3d( -1.0E5, 3.0E4, 2.0E4 ) };
+
+    for( const Eigen::Vector3d& position : testPositions )
+    {
+        double directPotential, octreePotential;
+        Eigen::Vector3d directGradient, octreeGradient;
+        Eigen::Matrix3d directHessian, octreeHessian;
+        directField.computeGravityFieldTerms(
+                    position, gravitationalParameter, &directPotential, &directGradient, &directHessian );
+        octreeField.computeGravityFieldTerms(
+                    position, gravitationalParameter, &octreePotential, &octreeGradient, &octreeHessian );
+
+        // Truncation error of quadrupole expansion scales with the cube of the opening angle
+        BOOST_CHECK_CLOSE_FRACTION( octreePotential, directPotential, 1.0E-3 );
+        BOOST_CHECK_SMALL( ( octreeGradient - directGradient ).norm( ) / directGradient.norm( ), 1.0E-3 );
+        BOOST_CHECK_SMALL( ( octreeHessian - directHessian ).norm( ) / directHessian.norm( ), 1.0E-2 );
+
+        // Separate function calls are consistent with single pass
+        BOOST_CHECK_CLOSE_FRACTION( octreeField.getGravitationalPotential( position ), octreePotential, 1.0E-14 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( octreeField.getGradientOfPotential( position ), octreeGradient, 1.0E-14 );
+    }
+
+    // Far away, the field is evaluated from the root node only and must match direct summation closely
+    Eigen::Vector3d farPosition( 2.0E6, -1.0E6, 5.0E5 );
+    BOOST_CHECK_CLOSE_FRACTION( octreeField.getGravitationalPotential( farPosition ),
+                                directField.getGravitationalPotential( farPosition ), 1.0E-8 );
+}
+
+//! Test hessian against numerical differentiation of the gradient, for direct and multipole evaluation
+BOOST_AUTO_TEST_CASE( testHessianOfPotential )
+{
+    const double gravitationalParameter = 3.0E5;
+    Eigen::MatrixXd masconPositions;
+    Eigen::VectorXd masconMassFractions;
+    createTestMascons( 500, masconPositions, masconMassFractions );
+
+    for( double openingAngle : { 0.0, 0.5 } )
+    {
+        gravitation::MasconGravityField gravityField(
+                    gravitationalParameter, masconPositions, masconMassFractions, openingAngle, 8 );
+
+        Eigen::Vector3d position( 6.0E3, 4.0E3, -3.0E3 );
+        Eigen::Matrix3d analyticalHessian = gravityField.getHessianOfPotential( position );
+
+        Eigen::Matrix3d numericalHessian;
+        const double perturbation = 1.0;
+        for( int i = 0; i < 3; i++ )
+        {
+            Eigen::Vector3d perturbedPosition = position;
+            perturbedPosition( i ) += perturbation;
+            Eigen::Vector3d upperGradient = gravityField.getGradientOfPotential( perturbedPosition );
+            perturbedPosition( i ) -= 2.0 * perturbation;
+            Eigen::Vector3d lowerGradient = gravityField.getGradientOfPotential( perturbedPosition );
+            numericalHessian.col( i ) = ( upperGradient - lowerGradient ) / ( 2.0 * perturbation );
+        }
+
+        // Node selection does not change for small perturbations, so the multipole hessian is consistent as well
+        BOOST_CHECK_SMALL( ( analyticalHessian - numericalHessian ).norm( ) / analyticalHessian.norm( ), 1.0E-6 );
+        BOOST_CHECK_SMALL( ( analyticalHessian - analyticalHessian.transpose( ) ).norm( ) / analyticalHessian.norm( ),
+                           1.0E-14 );
+    }
+}
+
+//! Test creation of mascons from polyhedron, and comparison with polyhedron gravity field
+BOOST_AUTO_TEST_CASE( testMasconsFromPolyhedron )
+{
+    // Define cuboid polyhedron dimensions
+    const double w = 10.0; // width
+    const double h = 10.0; // height
+    const double l = 20.0; // length
+
+    const double gravitationalParameter = 6.67259e-11 * 2670 * w * h * l;
+
+    // Define cuboid
+    Eigen::MatrixXd verticesCoordinates(8,3);
+    verticesCoordinates <<
+        0.0, 0.0, 0.0,
+        l, 0.0, 0.0,
+        0.0, w, 0.0,
+        l, w, 0.0,
+        0.0, 0.0, h,
+        l, 0.0, h,
+        0.0, w, h,
+        l, w, h;
+    Eigen::MatrixXi verticesDefiningEachFacet(12,3);
+    verticesDefiningEachFacet <<
+        2, 1, 0,
+        1, 2, 3,
+        4, 2, 0,
+        2, 4, 6,
+        1, 4, 0,
+        4, 1, 5,
+        6, 5, 7,
+        5, 6, 4,
+        3, 6, 7,
+        6, 3, 2,
+        5, 3, 7,
+        3, 5, 1;
+
+    // Grid of 20 x 10 x 10 cells fully covers the cuboid
+    Eigen::MatrixXd masconPositions = gravitation::createMasconPositionsFromPolyhedron(
+                verticesCoordinates, verticesDefiningEachFacet, 20 );
+    BOOST_CHECK_EQUAL( masconPositions.rows( ), 2000 );
+
+    gravitation::MasconGravityField masconField( gravitationalParameter, masconPositions );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                masconField.getCenterOfMass( ), Eigen::Vector3d( l / 2.0, w / 2.0, h / 2.0 ), 1.0E-12 );
+
+    gravitation::PolyhedronGravityField polyhedronField(
+                gravitationalParameter, verticesCoordinates, verticesDefiningEachFacet );
+
+    std::vector< Eigen::Vector3d > testPositions =
+    { Eigen::Vector3d( 60.0, 20.0, -30.0 ), Eigen::Vector3d( -40.0, 5.0, 25.0 ) };
+    for( const Eigen::Vector3d& position : testPositions )
+    {
+        Eigen::Vector3d masconGradient = masconField.getGradientOfPotential( position );
+        Eigen::Vector3d polyhedronGradient = polyhedronField.getGradientOfPotential( position );
+        BOOST_CHECK_SMALL( ( masconGradient - polyhedronGradient ).norm( ) / polyhedronGradient.norm( ), 1.0E-4 );
+    }
+}
+
+//! Test computation of spherical harmonic coefficients, and fit of mass fractions to spherical harmonic coefficients
+BOOST_AUTO_TEST_CASE( testSphericalHarmonicCoefficients )
+{
+    Eigen::MatrixXd masconPositions;
+    Eigen::VectorXd masconMassFractions;
+    createTestMascons( 300, masconPositions, masconMassFractions );
+    const double referenceRadius = 2500.0;
+
+    // Degree 0 and 1 coefficients are given by the mass and center of mass
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    gravitation::computeMasconSphericalHarmonicCoefficients(
+                masconPositions, masconMassFractions, referenceRadius, 4, cosineCoefficients, sineCoefficients );
+    Eigen::Vector3d centerOfMass = masconPositions.transpose( ) * masconMassFractions;
+    BOOST_CHECK_CLOSE_FRACTION( cosineCoefficients( 0, 0 ), 1.0, 1.0E-14 );
+    BOOST_CHECK_CLOSE_FRACTION( cosineCoefficients( 1, 0 ), centerOfMass.z( ) / ( referenceRadius * std::sqrt( 3.0 ) ),
+                                1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( cosineCoefficients( 1, 1 ), centerOfMass.x( ) / ( referenceRadius * std::sqrt( 3.0 ) ),
+                                1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( sineCoefficients( 1, 1 ), centerOfMass.y( ) / ( referenceRadius * std::sqrt( 3.0 ) ),
+                                1.0E-12 );
+
+    // Fit mass fractions to coefficients, and check that coefficients are recovered
+    Eigen::VectorXd fittedMassFractions = gravitation::fitMasconMassFractionsToSphericalHarmonics(
+                masconPositions, cosineCoefficients, sineCoefficients, referenceRadius );
+    BOOST_CHECK_CLOSE_FRACTION( fittedMassFractions.sum( ), 1.0, 1.0E-12 );
+
+    Eigen::MatrixXd fittedCosineCoefficients, fittedSineCoefficients;
+    gravitation::computeMasconSphericalHarmonicCoefficients(
+                masconPositions, fittedMassFractions, referenceRadius, 4,
+                fittedCosineCoefficients, fittedSineCoefficients );
+    BOOST_CHECK_SMALL( ( fittedCosineCoefficients - cosineCoefficients ).cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( ( fittedSineCoefficients - sineCoefficients ).cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -16,6 +16,11 @@
 
 #include <boost/test/tools/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
+#include <boost/math/special_functions/ellint_1.hpp>
+#include <boost/math/special_functions/ellint_2.hpp>
+#include <boost/math/special_functions/ellint_d.hpp>
+#include <boost/math/special_functions/ellint_rd.hpp>
+#include <boost/math/special_functions/ellint_rf.hpp>
 
 #include "tudat/basics/testMacros.h"
 #include "tudat/astro/gravitation/ringGravityField.h"
@@ -119,6 +124,48 @@ BOOST_AUTO_TEST_CASE( testEllipticIntegralsComputation )
 
 }
 
+//! Test combined computation of complete elliptic integrals against Boost implementation
+BOOST_AUTO_TEST_CASE( testCombinedEllipticIntegralsComputation )
+{
+    std::vector< double > testParameters;
+    for ( unsigned int i = 0; i <= 1000; i++ )
+    {
+        testParameters.push_back( 0.999 * static_cast< double >( i ) / 1000.0 );
+    }
+    for ( double oneMinusM : { 1.0E-4, 1.0E-6, 1.0E-9, 1.0E-12 } )
+    {
+        testParameters.push_back( 1.0 - oneMinusM );
+    }
+
+    double ellipticIntegralK, ellipticIntegralE, ellipticIntegralB, ellipticIntegralD;
+    for ( double m : testParameters )
+    {
+        gravitation::computeCompleteEllipticIntegrals(
+                m, ellipticIntegralK, ellipticIntegralE, ellipticIntegralB, ellipticIntegralD );
+
+        // Compute Carlson forms directly from m, since computation from modulus k = sqrt(m) loses accuracy near m = 1
+        double expectedEllipticIntegralK = boost::math::ellint_rf( 0.0, 1.0 - m, 1.0 );
+        double expectedEllipticIntegralD = boost::math::ellint_rd( 0.0, 1.0 - m, 1.0 ) / 3.0;
+        BOOST_CHECK_CLOSE_FRACTION( expectedEllipticIntegralK, ellipticIntegralK, 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( expectedEllipticIntegralK - m * expectedEllipticIntegralD, ellipticIntegralE, 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( expectedEllipticIntegralK - expectedEllipticIntegralD, ellipticIntegralB, 1.0E-14 );
+        BOOST_CHECK_CLOSE_FRACTION( expectedEllipticIntegralD, ellipticIntegralD, 1.0E-14 );
+
+        if ( m < 0.99 )
+        {
+            double k = std::sqrt( m );
+            BOOST_CHECK_CLOSE_FRACTION( boost::math::ellint_1( k ), ellipticIntegralK, 1.0E-14 );
+            BOOST_CHECK_CLOSE_FRACTION( boost::math::ellint_2( k ), ellipticIntegralE, 1.0E-14 );
+            BOOST_CHECK_CLOSE_FRACTION( boost::math::ellint_d( k ), ellipticIntegralD, 1.0E-14 );
+        }
+    }
+
+    // Check that singularity is detected
+    BOOST_CHECK_THROW( gravitation::computeCompleteEllipticIntegrals(
+                           1.0, ellipticIntegralK, ellipticIntegralE, ellipticIntegralB, ellipticIntegralD ),
+                       std::runtime_error );
+}
+
 //! Test computation of potential, gradient of potential
 BOOST_AUTO_TEST_CASE( testGravityComputation )
 {
@@ -176,6 +223,23 @@ BOOST_AUTO_TEST_CASE( testGravityComputation )
                 computedGradient(0) / computedGradient(1), tolerance );
         BOOST_CHECK_EQUAL(
                 std::signbit( - bodyFixedPosition(0) ), std::signbit( computedGradient(0) ) );
+
+        // Check that batch computation of gradient matches computation for single points
+        Eigen::Matrix3Xd bodyFixedPositions( 3, 4 );
+        bodyFixedPositions.col( 0 ) << 0.0, 0.0, 500.0e3;
+        bodyFixedPositions.col( 1 ) << 100.0e3, 500.0e3, 0.0;
+        bodyFixedPositions.col( 2 ) << - 2 * ringRadius, 1.3 * ringRadius, 0.0;
+        bodyFixedPositions.col( 3 ) << 0.5 * ringRadius, - 0.6 * ringRadius, 0.1 * ringRadius;
+        Eigen::Matrix3Xd computedGradients = gravityField.getGradientsOfPotential( bodyFixedPositions );
+        for ( int i = 0; i < bodyFixedPositions.cols( ); i++ )
+        {
+            Eigen::Vector3d expectedPointGradient = gravityField.getGradientOfPotential( bodyFixedPositions.col( i ) );
+            for ( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_CLOSE_FRACTION( expectedPointGradient( j ), computedGradients( j, i ),
+                                            std::numeric_limits< double >::epsilon( ) );
+            }
+        }
     }
 
 }
@@ -284,6 +284,80 @@ BOOST_AUTO_TEST_CASE( testRealisticThirdBodyPerturbation )
                                        tolerance );
 }
 
+//! Test if indirect term of third-body perturbation is correctly shared between two bodies
+BOOST_AUTO_TEST_CASE( testSharedThirdBodyIndirectAcceleration )
+{
+    double tolerance = 1.0e-14;
+
+    // Define positions of two satellites, central body and perturber (Moon-like)
+    Eigen::Vector3d centralBodyPosition( 100E9, -110E9, 3E9 );
+    Eigen::Vector3d perturberPosition = centralBodyPosition + Eigen::Vector3d( 25000000.0, -380000000.0, -55000000.0 );
+    Eigen::Vector3d firstTestPosition = centralBodyPosition + Eigen::Vector3d( -40000000.0, 9000000.0, -9500000.0 );
+    Eigen::Vector3d secondTestPosition = centralBodyPosition + Eigen::Vector3d( 7000000.0, 1000000.0, -500000.0 );
+    double gravitationalParameterOfPerturbingBody = 4900.0e9;
+
+    // Count evaluations of central body position by central body acceleration models
+    int numberOfCentralBodyPositionEvaluations = 0;
+
+    // Create third-body accelerations on both satellites
+    std::vector< std::shared_ptr< gravitation::ThirdBodyCentralGravityAcceleration > > thirdBodyAccelerations;
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        Eigen::Vector3d* testPosition = ( i == 0 ) ? &firstTestPosition : &secondTestPosition;
+        thirdBodyAccelerations.push_back(
+                    std::make_shared< gravitation::ThirdBodyCentralGravityAcceleration >(
+                        std::make_shared< gravitation::CentralGravitationalAccelerationModel3d >(
+                            [ = ]( Eigen::Vector3d& input ){ input = *testPosition; },
+                            gravitationalParameterOfPerturbingBody,
+                            [ & ]( Eigen::Vector3d& input ){ input = perturberPosition; } ),
+                        std::make_shared< gravitation::CentralGravitationalAccelerationModel3d >(
+                            [ & ]( Eigen::Vector3d& input ){
+                                numberOfCentralBodyPositionEvaluations++;
+                                input = centralBodyPosition; },
+                            gravitationalParameterOfPerturbingBody,
+                            [ & ]( Eigen::Vector3d& input ){ input = perturberPosition; } ),
+                        "centralBody" ) );
+    }
+
+    BOOST_CHECK_EQUAL( thirdBodyAccelerations.at( 1 )->isAccelerationModelForCentralBodyShared( ), false );
+    thirdBodyAccelerations.at( 1 )->shareAccelerationModelForCentralBody( thirdBodyAccelerations.at( 0 ) );
+    BOOST_CHECK_EQUAL( thirdBodyAccelerations.at( 0 )->isAccelerationModelForCentralBodyShared( ), true );
+    BOOST_CHECK_EQUAL( thirdBodyAccelerations.at( 1 )->isAccelerationModelForCentralBodyShared( ), true );
+    BOOST_CHECK( thirdBodyAccelerations.at( 0 )->getAccelerationModelForCentralBody( ) ==
+                 thirdBodyAccelerations.at( 1 )->getAccelerationModelForCentralBody( ) );
+
+    // Evaluate accelerations at two subsequent times, and check that indirect term is computed once per time
+    for( unsigned int j = 0; j < 2; j++ )
+    {
+        for( unsigned int i = 0; i < 2; i++ )
+        {
+            thirdBodyAccelerations.at( i )->resetCurrentTime( );
+        }
+
+        for( unsigned int i = 0; i < 2; i++ )
+        {
+            thirdBodyAccelerations.at( i )->updateMembers( static_cast< double >( j ) );
+            Eigen::Vector3d computedAcceleration = thirdBodyAccelerations.at( i )->getAcceleration( );
+            Eigen::Vector3d expectedAcceleration = gravitation::computeThirdBodyPerturbingAcceleration(
+                        gravitationalParameterOfPerturbingBody, perturberPosition,
+                        ( i == 0 ) ? firstTestPosition : secondTestPosition, centralBodyPosition );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedAcceleration, computedAcceleration, tolerance );
+        }
+        BOOST_CHECK_EQUAL( numberOfCentralBodyPositionEvaluations, j + 1 );
+
+        // Move bodies for next evaluation
+        centralBodyPosition += Eigen::Vector3d( 1.0E6, 2.0E6, -3.0E5 );
+    }
+
+    // Check that accelerations with different central bodies can not be shared
+    std::shared_ptr< gravitation::ThirdBodyCentralGravityAcceleration > otherThirdBodyAcceleration =
+            std::make_shared< gravitation::ThirdBodyCentralGravityAcceleration >(
+                thirdBodyAccelerations.at( 0 )->getAccelerationModelForBodyUndergoingAcceleration( ),
+                thirdBodyAccelerations.at( 0 )->getAccelerationModelForCentralBody( ), "otherCentralBody" );
+    BOOST_CHECK_THROW( otherThirdBodyAcceleration->shareAccelerationModelForCentralBody( thirdBodyAccelerations.at( 0 ) ),
+                       std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,168 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "tudat/astro/basic_astro/celestialBodyConstants.h"
+#include "tudat/astro/basic_astro/keplerPropagator.h"
+#include "tudat/astro/basic_astro/modifiedEquinoctialElementConversions.h"
+#include "tudat/astro/basic_astro/orbitalElementConversions.h"
+#include "tudat/astro/basic_astro/physicalConstants.h"
+#include "tudat/astro/low_thrust/hybridMethodPropagator.h"
+#include "tudat/astro/reference_frames/referenceFrameTransformations.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace low_thrust_trajectories;
+using namespace numerical_integrators;
+
+BOOST_AUTO_TEST_SUITE( test_hybrid_method_propagator )
+
+//! Test that trajectory without thrust reduces to a Kepler orbit.
+BOOST_AUTO_TEST_CASE( testHybridMethodPropagatorKeplerLimitCase )
+{
+    double centralBodyGravitationalParameter = celestial_body_constants::SUN_GRAVITATIONAL_PARAMETER;
+    double timeOfFlight = 200.0 * physical_constants::JULIAN_DAY;
+
+    Eigen::Vector6d initialKeplerianState;
+    initialKeplerianState << 1.2 * physical_constants::ASTRONOMICAL_UNIT, 0.1, 0.2, 1.0, 2.0, 0.5;
+    Eigen::Vector6d initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                initialKeplerianState, centralBodyGravitationalParameter );
+
+    HybridMethodPropagator propagator(
+                centralBodyGravitationalParameter, 0.0, 3000.0,
+                rungeKuttaVariableStepSettingsScalarTolerances< double >(
+                    3600.0, rungeKuttaFehlberg78, 1.0E-3, physical_constants::JULIAN_DAY, 1.0E-13, 1.0E-13 ) );
+    propagator.resetCostates( Eigen::VectorXd::Constant( 5, 1.0 ), Eigen::VectorXd::Constant( 5, -1.0 ), timeOfFlight );
+
+    Eigen::Vector6d propagatedState = propagator.propagateTrajectory( 0.0, timeOfFlight, initialState, 1000.0 );
+    Eigen::Vector6d expectedState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                orbital_element_conversions::propagateKeplerOrbit(
+                    initialKeplerianState, timeOfFlight, centralBodyGravitationalParameter ), centralBodyGravitationalParameter );
+
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( propagatedState[ i ] - expectedState[ i ] ) / expectedState.segment( 0, 3 ).norm( ), 1.0E-10 );
+        BOOST_CHECK_SMALL( std::fabs( propagatedState[ i + 3 ] - expectedState[ i + 3 ] ) / expectedState.segment( 3, 3 ).norm( ), 1.0E-10 );
+    }
+    BOOST_CHECK_EQUAL( propagator.getPropagatedMass( ), 1000.0 );
+}
+
+//! Test propagation against Cartesian propagation with same thrust law, and repeated use of the same propagator.
+BOOST_AUTO_TEST_CASE( testHybridMethodPropagatorAgainstCartesianPropagation )
+{
+    double centralBodyGravitationalParameter = celestial_body_constants::SUN_GRAVITATIONAL_PARAMETER;
+    double timeOfFlight = 150.0 * physical_constants::JULIAN_DAY;
+    double maximumThrust = 0.5;
+    double specificImpulse = 3000.0;
+    double initialMass = 1500.0;
+
+    Eigen::Vector6d initialKeplerianState;
+    initialKeplerianState << physical_constants::ASTRONOMICAL_UNIT, 0.05, 0.1, 0.3, 1.2, 2.0;
+    Eigen::Vector6d initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                initialKeplerianState, centralBodyGravitationalParameter );
+
+    HybridMethodPropagator propagator(
+                centralBodyGravitationalParameter, maximumThrust, specificImpulse,
+                rungeKuttaVariableStepSettingsScalarTolerances< double >(
+                    3600.0, rungeKuttaFehlberg78, 1.0E-3, physical_constants::JULIAN_DAY, 1.0E-12, 1.0E-12 ) );
+
+    for( int testCase = 0; testCase < 2; testCase++ )
+    {
+        Eigen::VectorXd initialCostates( 5 ), finalCostates( 5 );
+        if( testCase == 0 )
+        {
+            initialCostates << -1.0E-11, 0.4, -0.2, 0.3, 0.1;
+            finalCostates << -2.0E-11, -0.1, 0.5, -0.2, 0.4;
+        }
+        else
+        {
+            initialCostates << 3.0E-12, -0.6, 0.1, -0.1, -0.5;
+            finalCostates << 1.0E-12, 0.2, 0.3, 0.6, -0.2;
+        }
+        propagator.resetCostates( initialCostates, finalCostates, timeOfFlight );
+
+        // Propagate reference trajectory in Cartesian elements, with thrust direction from same control law.
+        std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > cartesianStateDerivativeFunction =
+                [ & ]( const double currentTime, const Eigen::VectorXd& currentState )
+        {
+            Eigen::Vector6d currentCartesianState = currentState.segment( 0, 6 );
+            Eigen::Vector3d thrustDirection =
+                    reference_frames::getRswSatelliteCenteredToInertialFrameRotationMatrix( currentCartesianState ) *
+                    computeMeeCostatesBasedThrustDirectionInRswFrame(
+                        orbital_element_conversions::convertCartesianToModifiedEquinoctialElements(
+                            currentCartesianState, centralBodyGravitationalParameter, false ),
+                        propagator.getCurrentCostates( currentTime ) );
+
+            Eigen::VectorXd stateDerivative( 7 );
+            stateDerivative.segment( 0, 3 ) = currentState.segment( 3, 3 );
+            stateDerivative.segment( 3, 3 ) =
+                    - centralBodyGravitationalParameter * currentState.segment( 0, 3 ) /
+                    std::pow( currentState.segment( 0, 3 ).norm( ), 3 ) +
+                    maximumThrust / currentState[ 6 ] * thrustDirection;
+            stateDerivative[ 6 ] = - maximumThrust / ( specificImpulse * physical_constants::SEA_LEVEL_GRAVITATIONAL_ACCELERATION );
+            return stateDerivative;
+        };
+
+        Eigen::VectorXd initialCartesianStateAndMass( 7 );
+        initialCartesianStateAndMass << initialState, initialMass;
+        std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > cartesianIntegrator =
+                createIntegrator< double, Eigen::VectorXd >(
+                    cartesianStateDerivativeFunction, initialCartesianStateAndMass, 0.0,
+                    rungeKuttaVariableStepSettingsScalarTolerances< double >(
+                        3600.0, rungeKuttaFehlberg78, 1.0E-3, physical_constants::JULIAN_DAY, 1.0E-12, 1.0E-12 ) );
+
+        std::vector< double > epochs = { 0.0, 0.25 * timeOfFlight, 0.6 * timeOfFlight, timeOfFlight };
+        std::map< double, Eigen::Vector6d > propagatedTrajectory =
+                propagator.propagateTrajectory( epochs, 0.0, initialState, initialMass );
+        BOOST_CHECK_EQUAL( propagatedTrajectory.size( ), epochs.size( ) );
+
+        for( unsigned int j = 1; j < epochs.size( ); j++ )
+        {
+            Eigen::VectorXd expectedStateAndMass = cartesianIntegrator->integrateTo( epochs.at( j ), 3600.0 );
+            Eigen::Vector6d expectedState = expectedStateAndMass.segment( 0, 6 );
+            Eigen::Vector6d propagatedState = propagatedTrajectory.at( epochs.at( j ) );
+
+            for( int i = 0; i < 3; i++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( propagatedState[ i ] - expectedState[ i ] ) /
+                                   expectedState.segment( 0, 3 ).norm( ), 1.0E-8 );
+                BOOST_CHECK_SMALL( std::fabs( propagatedState[ i + 3 ] - expectedState[ i + 3 ] ) /
+                                   expectedState.segment( 3, 3 ).norm( ), 1.0E-8 );
+            }
+        }
+
+        // Check consistency of final state and mass with single-interval propagation.
+        Eigen::Vector6d finalState = propagator.propagateTrajectory( 0.0, timeOfFlight, initialState, initialMass );
+        for( int i = 0; i < 6; i++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( finalState[ i ] - propagatedTrajectory.at( timeOfFlight )[ i ] ) /
+                               propagatedTrajectory.at( timeOfFlight ).segment( 3 * ( i / 3 ), 3 ).norm( ), 1.0E-9 );
+        }
+        BOOST_CHECK_CLOSE_FRACTION(
+                    propagator.getPropagatedMass( ),
+                    initialMass - maximumThrust / ( specificImpulse * physical_constants::SEA_LEVEL_GRAVITATIONAL_ACCELERATION ) *
+                    timeOfFlight, 1.0E-12 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
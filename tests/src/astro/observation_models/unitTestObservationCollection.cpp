@@ -0,0 +1,306 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/simulation/estimation_setup/observations.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::observation_models;
+
+BOOST_AUTO_TEST_SUITE( test_observation_collection )
+
+//! Function to create observation set with arcs of observations, separated by 1000 s, with noise-like values
+std::shared_ptr< SingleObservationSet< > > createTestObservationSet(
+    const ObservableType observableType,
+    const LinkEnds& linkEnds,
+    const double startTime,
+    const std::vector< int >& numberOfObservationsPerArc,
+    const double valueOffset )
+{
+    int observableSize = getObservableSize( observableType );
+
+    std::vector< Eigen::VectorXd > observations;
+    std::vector< double > observationTimes;
+    double currentTime = startTime;
+    int counter = 0;
+    for( unsigned int i = 0; i < numberOfObservationsPerArc.size( ); i++ )
+    {
+        for( int j = 0; j < numberOfObservationsPerArc.at( i ); j++ )
+        {
+            Eigen::VectorXd currentObservation = Eigen::VectorXd::Zero( observableSize );
+            for( int k = 0; k < observableSize; k++ )
+            {
+                currentObservation( k ) = valueOffset + std::sin( static_cast< double >( 3 * counter + k ) );
+            }
+            observations.push_back( currentObservation );
+            observationTimes.push_back( currentTime );
+            currentTime += 10.0;
+            counter++;
+        }
+        currentTime += 1000.0;
+    }
+
+    return std::make_shared< SingleObservationSet< > >(
+        observableType, linkEnds, observations, observationTimes, receiver );
+}
+
+//! Test contiguous storage in single observation set
+BOOST_AUTO_TEST_CASE( testSingleObservationSetStorage )
+{
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = LinkEndId( "Earth", "Station1" );
+    linkEnds[ receiver ] = LinkEndId( "Spacecraft" );
+
+    // Create observations in reverse time order
+    std::vector< Eigen::VectorXd > observations;
+    std::vector< double > observationTimes;
+    std::vector< Eigen::VectorXd > dependentVariables;
+    for( int i = 0; i < 10; i++ )
+    {
+        observations.push_back( ( Eigen::VectorXd( 3 ) << i, 2 * i, 3 * i ).finished( ) );
+        observationTimes.push_back( 100.0 - static_cast< double >( i ) );
+        dependentVariables.push_back( ( Eigen::VectorXd( 1 ) << -i ).finished( ) );
+    }
+
+    SingleObservationSet< > observationSet(
+        position_observable, linkEnds, observations, observationTimes, receiver, dependentVariables );
+
+    // Check that observations are time-ordered and stored contiguously
+    BOOST_CHECK_EQUAL( observationSet.getNumberOfObservables( ), 10 );
+    BOOST_CHECK_EQUAL( observationSet.getSingleObservableSize( ), 3 );
+    Eigen::VectorXd observationsVector = observationSet.getObservationsVector( );
+    for( int i = 0; i < 10; i++ )
+    {
+        BOOST_CHECK_EQUAL( observationSet.getObservationTimesReference( ).at( i ), 91.0 + static_cast< double >( i ) );
+        BOOST_CHECK_EQUAL( observationSet.getObservationsDependentVariablesReference( ).at( i )( 0 ), -( 9 - i ) );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( observationsVector( 3 * i + j ), ( j + 1 ) * ( 9 - i ) );
+            BOOST_CHECK_EQUAL( observationSet.getObservationsVectorReference( )( 3 * i + j ), ( j + 1 ) * ( 9 - i ) );
+            BOOST_CHECK_EQUAL( observationSet.getObservation( i )( j ), ( j + 1 ) * ( 9 - i ) );
+            BOOST_CHECK_EQUAL( observationSet.getObservations( ).at( i )( j ), ( j + 1 ) * ( 9 - i ) );
+        }
+    }
+
+    // Check that view on data does not copy
+    BOOST_CHECK( observationSet.getObservationsVectorReference( ).data( ) == observationSet.getObservationsReference( ).data( ) );
+
+    // Check subset and filtered set
+    std::shared_ptr< SingleObservationSet< > > observationSubset = observationSet.createObservationSubset( 2, 5 );
+    std::shared_ptr< SingleObservationSet< > > filteredObservationSet =
+        observationSet.createFilteredObservationSet( { 0, 1, 7, 8, 9 } );
+    BOOST_CHECK_EQUAL( observationSubset->getNumberOfObservables( ), 5 );
+    BOOST_CHECK_EQUAL( filteredObservationSet->getNumberOfObservables( ), 5 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( observationSubset->getObservationsVectorReference( ),
+                                       observationsVector.segment( 6, 15 ), std::numeric_limits< double >::epsilon( ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( filteredObservationSet->getObservationsVectorReference( ),
+                                       observationsVector.segment( 6, 15 ), std::numeric_limits< double >::epsilon( ) );
+    for( int i = 0; i < 5; i++ )
+    {
+        BOOST_CHECK_EQUAL( observationSubset->getObservationTimesReference( ).at( i ), 93.0 + static_cast< double >( i ) );
+        BOOST_CHECK_EQUAL( filteredObservationSet->getObservationTimesReference( ).at( i ), 93.0 + static_cast< double >( i ) );
+        BOOST_CHECK_EQUAL( observationSubset->getObservationsDependentVariablesReference( ).at( i )( 0 ), -( 7 - i ) );
+        BOOST_CHECK_EQUAL( filteredObservationSet->getObservationsDependentVariablesReference( ).at( i )( 0 ), -( 7 - i ) );
+    }
+    BOOST_CHECK_THROW( observationSet.createObservationSubset( 8, 5 ), std::runtime_error );
+
+    // Check inconsistent input
+    observations.at( 4 ) = Eigen::VectorXd::Zero( 2 );
+    BOOST_CHECK_THROW( ( SingleObservationSet< >( position_observable, linkEnds, observations, observationTimes, receiver ) ),
+                       std::runtime_error );
+}
+
+//! Test selection, filtering, residual computation and arc splitting using observation collection views
+BOOST_AUTO_TEST_CASE( testObservationCollectionView )
+{
+    LinkEnds firstLinkEnds;
+    firstLinkEnds[ transmitter ] = LinkEndId( "Earth", "Station1" );
+    firstLinkEnds[ receiver ] = LinkEndId( "Spacecraft" );
+
+    LinkEnds secondLinkEnds;
+    secondLinkEnds[ transmitter ] = LinkEndId( "Earth", "Station2" );
+    secondLinkEnds[ receiver ] = LinkEndId( "Spacecraft" );
+
+    LinkEnds positionLinkEnds;
+    positionLinkEnds[ observed_body ] = LinkEndId( "Spacecraft" );
+
+    // Create observed and computed observations
+    std::vector< std::shared_ptr< SingleObservationSet< > > > observedSets, computedSets;
+    observedSets.push_back( createTestObservationSet( one_way_range, firstLinkEnds, 0.0, { 10, 2, 8 }, 0.0 ) );
+    observedSets.push_back( createTestObservationSet( one_way_range, firstLinkEnds, 1.0E5, { 5, 6 }, 0.0 ) );
+    observedSets.push_back( createTestObservationSet( one_way_range, secondLinkEnds, 0.0, { 4 }, 0.0 ) );
+    observedSets.push_back( createTestObservationSet( position_observable, positionLinkEnds, 0.0, { 7, 9 }, 0.0 ) );
+
+    computedSets.push_back( createTestObservationSet( one_way_range, firstLinkEnds, 0.0, { 10, 2, 8 }, 0.1 ) );
+    computedSets.push_back( createTestObservationSet( one_way_range, firstLinkEnds, 1.0E5, { 5, 6 }, 0.1 ) );
+    computedSets.push_back( createTestObservationSet( one_way_range, secondLinkEnds, 0.0, { 4 }, 0.1 ) );
+    computedSets.push_back( createTestObservationSet( position_observable, positionLinkEnds, 0.0, { 7, 9 }, 0.1 ) );
+
+    std::shared_ptr< ObservationCollection< > > observedCollection = std::make_shared< ObservationCollection< > >( observedSets );
+    std::shared_ptr< ObservationCollection< > > computedCollection = std::make_shared< ObservationCollection< > >( computedSets );
+    int totalObservableSize = observedCollection->getTotalObservableSize( );
+    BOOST_CHECK_EQUAL( totalObservableSize, 20 + 11 + 4 + 3 * 16 );
+
+    // Check full view
+    ObservationCollectionView< > fullView( observedCollection );
+    BOOST_CHECK_EQUAL( fullView.getNumberOfSelectedEntries( ), totalObservableSize );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( fullView.getObservationVector( ), observedCollection->getObservationVector( ),
+                                       std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK( fullView.getConcatenatedTimeVector( ) == observedCollection->getConcatenatedTimeVector( ) );
+
+    // Check residuals and weighting
+    Eigen::VectorXd fullResiduals = observedCollection->getObservationVector( ) - computedCollection->getObservationVector( );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( createResidualCollection( observedCollection, computedCollection )->getObservationVector( ),
+                                       fullResiduals, std::numeric_limits< double >::epsilon( ) );
+    Eigen::VectorXd weights = Eigen::VectorXd::LinSpaced( totalObservableSize, 1.0, 2.0 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( fullView.getResiduals( computedCollection ), fullResiduals,
+                                       std::numeric_limits< double >::epsilon( ) );
+    Eigen::VectorXd expectedWeightedResiduals = fullResiduals.cwiseProduct( weights );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( fullView.getWeightedResiduals( computedCollection, weights ),
+                                       expectedWeightedResiduals, std::numeric_limits< double >::epsilon( ) );
+
+    // Check selection of observable type, link ends and time interval
+    {
+        std::pair< int, int > positionStartAndSize =
+            observedCollection->getObservationTypeStartAndSize( ).at( position_observable );
+        ObservationCollectionView< > positionView = fullView.selectObservableType( position_observable );
+        BOOST_CHECK_EQUAL( positionView.getNumberOfSelectedEntries( ), 48 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+            positionView.getObservationVector( ),
+            observedCollection->getObservationVector( ).segment( positionStartAndSize.first, positionStartAndSize.second ),
+            std::numeric_limits< double >::epsilon( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+            positionView.getResiduals( computedCollection ),
+            fullResiduals.segment( positionStartAndSize.first, positionStartAndSize.second ),
+            std::numeric_limits< double >::epsilon( ) );
+
+        ObservationCollectionView< > secondLinkView = fullView.selectLinkEnds( one_way_range, secondLinkEnds );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+            secondLinkView.getObservationVector( ),
+            observedCollection->getSingleLinkObservations( one_way_range, secondLinkEnds ),
+            std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_EQUAL( fullView.selectLinkEnds( position_observable, secondLinkEnds ).getNumberOfSelectedEntries( ), 0 );
+        BOOST_CHECK_EQUAL( fullView.selectObservableType( one_way_doppler ).getNumberOfSelectedEntries( ), 0 );
+
+        ObservationCollectionView< > timeIntervalView = positionView.selectTimeInterval( 20.0, 60.0 );
+        BOOST_CHECK_EQUAL( timeIntervalView.getNumberOfSelectedEntries( ), 15 );
+        std::vector< double > selectedTimes = timeIntervalView.getConcatenatedTimeVector( );
+        for( unsigned int i = 0; i < selectedTimes.size( ); i++ )
+        {
+            BOOST_CHECK( selectedTimes.at( i ) >= 20.0 && selectedTimes.at( i ) <= 60.0 );
+        }
+    }
+
+    // Check outlier removal against filtering of residual collection
+    {
+        std::map< ObservableType, double > residualCutoffValuePerObservable;
+        residualCutoffValuePerObservable[ one_way_range ] = 0.7;
+        residualCutoffValuePerObservable[ position_observable ] = 0.9;
+
+        // Create residuals with values in the range [-1.1, 0.9]
+        Eigen::VectorXd perturbedResiduals = fullResiduals + observedCollection->getObservationVector( );
+
+        ObservationCollectionView< > filteredView = fullView.removeResidualOutliers(
+            perturbedResiduals, residualCutoffValuePerObservable );
+        std::shared_ptr< ObservationCollection< > > filteredViewCollection = filteredView.createObservationCollection( );
+
+        // Compute expected filtered data
+        std::vector< std::shared_ptr< SingleObservationSet< > > > expectedFilteredSets;
+        int currentIndex = 0;
+        for( auto observationIt : observedCollection->getObservationsReference( ) )
+        {
+            int observableSize = getObservableSize( observationIt.first );
+            for( auto linkEndIt : observationIt.second )
+            {
+                for( unsigned int i = 0; i < linkEndIt.second.size( ); i++ )
+                {
+                    std::vector< int > indicesToRemove;
+                    for( int j = 0; j < linkEndIt.second.at( i )->getNumberOfObservables( ); j++ )
+                    {
+                        if( perturbedResiduals.segment( currentIndex, observableSize ).cwiseAbs( ).maxCoeff( ) >
+                            residualCutoffValuePerObservable.at( observationIt.first ) )
+                        {
+                            indicesToRemove.push_back( j );
+                        }
+                        currentIndex += observableSize;
+                    }
+                    expectedFilteredSets.push_back( linkEndIt.second.at( i )->createFilteredObservationSet( indicesToRemove ) );
+                }
+            }
+        }
+        std::shared_ptr< ObservationCollection< > > expectedFilteredCollection =
+            std::make_shared< ObservationCollection< > >( expectedFilteredSets );
+
+        BOOST_CHECK( filteredView.getNumberOfSelectedEntries( ) < totalObservableSize );
+        BOOST_CHECK( filteredView.getNumberOfSelectedEntries( ) > 0 );
+        BOOST_CHECK_EQUAL( filteredViewCollection->getTotalObservableSize( ), filteredView.getNumberOfSelectedEntries( ) );
+        BOOST_CHECK_EQUAL( expectedFilteredCollection->getTotalObservableSize( ), filteredView.getNumberOfSelectedEntries( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( filteredViewCollection->getObservationVector( ),
+                                           expectedFilteredCollection->getObservationVector( ),
+                                           std::numeric_limits< double >::epsilon( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( filteredView.getObservationVector( ),
+                                           expectedFilteredCollection->getObservationVector( ),
+                                           std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK( filteredViewCollection->getConcatenatedTimeVector( ) == filteredView.getConcatenatedTimeVector( ) );
+
+        // Check that fully selected sets are not copied
+        std::shared_ptr< ObservationCollection< > > unfilteredViewCollection = fullView.createObservationCollection( );
+        BOOST_CHECK( unfilteredViewCollection->getObservationsReference( ).at( position_observable ).at( positionLinkEnds ).at( 0 ) ==
+                     observedCollection->getObservationsReference( ).at( position_observable ).at( positionLinkEnds ).at( 0 ) );
+    }
+
+    // Check arc splitting against splitting of collection
+    {
+        std::shared_ptr< ObservationCollection< > > splitCollection = splitObservationSetsIntoArcs( observedCollection, 100.0, 4 );
+        std::vector< ObservationCollectionView< > > arcViews = fullView.splitIntoArcs( 100.0, 4 );
+
+        // Arcs with 2 and 4 observations are discarded
+        BOOST_CHECK_EQUAL( arcViews.size( ), 6 );
+        BOOST_CHECK_EQUAL( splitCollection->getConcatenatedObservationSetStartAndSize( ).size( ), 6 );
+
+        std::vector< std::pair< int, int > > splitSetStartAndSize = splitCollection->getConcatenatedObservationSetStartAndSize( );
+        for( unsigned int i = 0; i < arcViews.size( ); i++ )
+        {
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                arcViews.at( i ).getObservationVector( ),
+                splitCollection->getObservationVector( ).segment( splitSetStartAndSize.at( i ).first, splitSetStartAndSize.at( i ).second ),
+                std::numeric_limits< double >::epsilon( ) );
+        }
+    }
+
+    // Check inconsistent input
+    BOOST_CHECK_THROW( fullView.getSelectedEntries( Eigen::VectorXd::Zero( totalObservableSize + 1 ) ), std::runtime_error );
+    BOOST_CHECK_THROW( ( ObservationCollectionView< >( observedCollection, { 2, 1 } ) ), std::runtime_error );
+    BOOST_CHECK_THROW( ( ObservationCollectionView< >( observedCollection, { 0, totalObservableSize } ) ), std::runtime_error );
+
+    // Check that partial selection of position observation cannot be converted to collection
+    std::vector< int > partialSelection( 37 );
+    std::iota( partialSelection.begin( ), partialSelection.end( ), 0 );
+    BOOST_CHECK_THROW( ObservationCollectionView< >( observedCollection, partialSelection ).createObservationCollection( ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
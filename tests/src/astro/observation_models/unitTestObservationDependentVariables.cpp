@@ -774,6 +774,36 @@ BOOST_AUTO_TEST_CASE( testObservationDependentVariables )
 
 
                     }
+
+                    // Check that dependent variables computed for batch of observations are identical to those of simulation
+                    std::shared_ptr< SingleObservationSet< > > observationSet =
+                        idealObservationsAndTimes->getObservations( ).at( currentObservableType ).at( currentLinkEnds ).at( 0 );
+                    std::vector< double > observationSetTimes = observationSet->getObservationTimes( );
+                    std::vector< std::vector< double > > batchLinkEndTimes;
+                    std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > > batchLinkEndStates;
+                    Eigen::MatrixXd batchObservations = Eigen::MatrixXd( 1, observationSetTimes.size( ) );
+                    for( unsigned int i = 0; i < observationSetTimes.size( ); i++ )
+                    {
+                        batchObservations.col( i ) = observationModel1->computeIdealObservationsWithLinkEndData(
+                            observationSetTimes.at( i ), referenceLinkEnd, linkEndTimes, linkEndStates );
+                        batchLinkEndTimes.push_back( linkEndTimes );
+                        batchLinkEndStates.push_back( linkEndStates );
+                    }
+
+                    Eigen::MatrixXd batchDependentVariables;
+                    observationSet->getDependentVariableCalculator( )->calculateDependentVariables(
+                        batchDependentVariables, batchLinkEndTimes, batchLinkEndStates, batchObservations,
+                        observationSet->getAncilliarySettings( ) );
+                    std::vector< Eigen::VectorXd > simulatedDependentVariables = observationSet->getObservationsDependentVariables( );
+                    BOOST_CHECK_EQUAL( batchDependentVariables.cols( ), observationSetTimes.size( ) );
+                    for( unsigned int i = 0; i < observationSetTimes.size( ); i++ )
+                    {
+                        for( int j = 0; j < batchDependentVariables.rows( ); j++ )
+                        {
+                            BOOST_CHECK_EQUAL( batchDependentVariables( j, i ),
+                                               simulatedDependentVariables.at( i )( j ) );
+                        }
+                    }
                 }
                 if( compareAgainstReceiver )
                 {
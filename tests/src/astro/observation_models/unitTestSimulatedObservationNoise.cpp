@@ -11,6 +11,8 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
 
@@ -398,6 +400,154 @@ BOOST_AUTO_TEST_CASE( testObservationNoiseModels )
         }
 }
 
+//! Function to compute the sample correlation coefficient of two equally sized sequences
+double computeSampleCorrelation( const Eigen::VectorXd& firstSequence, const Eigen::VectorXd& secondSequence )
+{
+    Eigen::VectorXd firstDeviation = firstSequence.array( ) - firstSequence.mean( );
+    Eigen::VectorXd secondDeviation = secondSequence.array( ) - secondSequence.mean( );
+    return firstDeviation.dot( secondDeviation ) / ( firstDeviation.norm( ) * secondDeviation.norm( ) );
+}
+
+//! Test whether counter-based white and Gauss-Markov observation noise is reproducible for identical seeds, observables and
+//! link ends (independent of order of creation and evaluation), and independent between different observables and links
+BOOST_AUTO_TEST_CASE( testCounterBasedObservationNoise )
+{
+    // Define link ends
+    LinkEnds firstLinkEnds;
+    firstLinkEnds[ transmitter ] = std::pair< std::string, std::string >( "Earth", "Station1" );
+    firstLinkEnds[ receiver ] = std::pair< std::string, std::string >( "Moon", "" );
+
+    LinkEnds secondLinkEnds = firstLinkEnds;
+    secondLinkEnds[ transmitter ] = std::pair< std::string, std::string >( "Earth", "Station2" );
+
+    LinkEnds reversedLinkEnds;
+    reversedLinkEnds[ transmitter ] = firstLinkEnds.at( receiver );
+    reversedLinkEnds[ receiver ] = firstLinkEnds.at( transmitter );
+
+    // Check that noise key depends on (only) seed, observable type and link ends
+    std::uint64_t noiseKey = getObservationNoiseKey( 42, one_way_range, firstLinkEnds );
+    BOOST_CHECK_EQUAL( noiseKey, getObservationNoiseKey( 42, one_way_range, firstLinkEnds ) );
+    BOOST_CHECK( noiseKey != getObservationNoiseKey( 43, one_way_range, firstLinkEnds ) );
+    BOOST_CHECK( noiseKey != getObservationNoiseKey( 42, one_way_doppler, firstLinkEnds ) );
+    BOOST_CHECK( noiseKey != getObservationNoiseKey( 42, one_way_range, secondLinkEnds ) );
+    BOOST_CHECK( noiseKey != getObservationNoiseKey( 42, one_way_range, reversedLinkEnds ) );
+
+    // Define observation times
+    int numberOfObservations = 1000;
+    double observationTimeStep = 60.0;
+    double initialTime = 1.0E7;
+    double finalTime = initialTime + ( numberOfObservations - 1 ) * observationTimeStep;
+    std::vector< double > observationTimes;
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        observationTimes.push_back( initialTime + i * observationTimeStep );
+    }
+
+    std::map< ObservableType, std::vector< LinkDefinition > > linkEndsPerObservable;
+    linkEndsPerObservable[ one_way_range ].push_back( firstLinkEnds );
+    linkEndsPerObservable[ one_way_range ].push_back( secondLinkEnds );
+    linkEndsPerObservable[ angular_position ].push_back( firstLinkEnds );
+
+    double noiseAmplitude = 2.0;
+    double correlationTime = 300.0;
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        // Create identical settings (in different order), and settings with different seed
+        std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > observationSimulationSettings =
+                createTabulatedObservationSimulationSettingsList< double >( linkEndsPerObservable, observationTimes );
+        std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > reversedObservationSimulationSettings =
+                createTabulatedObservationSimulationSettingsList< double >( linkEndsPerObservable, observationTimes );
+        std::reverse( reversedObservationSimulationSettings.begin( ), reversedObservationSimulationSettings.end( ) );
+        std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > otherSeedObservationSimulationSettings =
+                createTabulatedObservationSimulationSettingsList< double >( linkEndsPerObservable, observationTimes );
+
+        if( test == 0 )
+        {
+            addCounterBasedGaussianNoiseFunctionToObservationSimulationSettings< double >(
+                        observationSimulationSettings, noiseAmplitude, 42 );
+            addCounterBasedGaussianNoiseFunctionToObservationSimulationSettings< double >(
+                        reversedObservationSimulationSettings, noiseAmplitude, 42 );
+            addCounterBasedGaussianNoiseFunctionToObservationSimulationSettings< double >(
+                        otherSeedObservationSimulationSettings, noiseAmplitude, 43 );
+        }
+        else
+        {
+            addFirstOrderGaussMarkovNoiseFunctionToObservationSimulationSettings< double >(
+                        observationSimulationSettings, noiseAmplitude, correlationTime, initialTime, finalTime,
+                        observationTimeStep, 42 );
+            addFirstOrderGaussMarkovNoiseFunctionToObservationSimulationSettings< double >(
+                        reversedObservationSimulationSettings, noiseAmplitude, correlationTime, initialTime, finalTime,
+                        observationTimeStep, 42 );
+            addFirstOrderGaussMarkovNoiseFunctionToObservationSimulationSettings< double >(
+                        otherSeedObservationSimulationSettings, noiseAmplitude, correlationTime, initialTime, finalTime,
+                        observationTimeStep, 43 );
+        }
+
+        // Retrieve noise sequences of all entries of all observables, evaluating identical settings in reverse order
+        std::vector< Eigen::VectorXd > noiseSequences;
+        int numberOfSettings = static_cast< int >( observationSimulationSettings.size( ) );
+        for( int i = 0; i < numberOfSettings; i++ )
+        {
+            std::shared_ptr< ObservationSimulationSettings< double > > currentSettings = observationSimulationSettings.at( i );
+            std::shared_ptr< ObservationSimulationSettings< double > > currentReversedSettings =
+                    reversedObservationSimulationSettings.at( numberOfSettings - 1 - i );
+            BOOST_CHECK_EQUAL( currentSettings->getObservableType( ), currentReversedSettings->getObservableType( ) );
+            BOOST_CHECK( currentSettings->getLinkEnds( ) == currentReversedSettings->getLinkEnds( ) );
+
+            int observableSize = getObservableSize( currentSettings->getObservableType( ) );
+            Eigen::MatrixXd currentNoise = Eigen::MatrixXd::Zero( numberOfObservations, observableSize );
+            for( int j = 0; j < numberOfObservations; j++ )
+            {
+                currentNoise.row( j ) = currentSettings->getObservationNoiseFunction( )( observationTimes.at( j ) ).transpose( );
+            }
+
+            for( int j = numberOfObservations - 1; j >= 0; j-- )
+            {
+                Eigen::VectorXd reversedNoise = currentReversedSettings->getObservationNoiseFunction( )( observationTimes.at( j ) );
+                Eigen::VectorXd otherSeedNoise =
+                        otherSeedObservationSimulationSettings.at( i )->getObservationNoiseFunction( )( observationTimes.at( j ) );
+                BOOST_CHECK_EQUAL( reversedNoise.rows( ), observableSize );
+                for( int k = 0; k < observableSize; k++ )
+                {
+                    BOOST_CHECK_EQUAL( reversedNoise( k ), currentNoise( j, k ) );
+                    BOOST_CHECK( otherSeedNoise( k ) != currentNoise( j, k ) );
+                }
+            }
+
+            for( int k = 0; k < observableSize; k++ )
+            {
+                noiseSequences.push_back( currentNoise.col( k ) );
+            }
+        }
+
+        // Check statistics of each noise sequence: white noise is uncorrelated in time, Gauss-Markov noise strongly correlated
+        BOOST_CHECK_EQUAL( noiseSequences.size( ), 4u );
+        double expectedLagOneCorrelation = ( test == 0 ) ? 0.0 : std::exp( -observationTimeStep / correlationTime );
+        for( unsigned int i = 0; i < noiseSequences.size( ); i++ )
+        {
+            Eigen::VectorXd currentSequence = noiseSequences.at( i );
+            double standardDeviation = std::sqrt(
+                        ( currentSequence.array( ) - currentSequence.mean( ) ).square( ).sum( ) / ( numberOfObservations - 1 ) );
+            BOOST_CHECK_CLOSE_FRACTION( standardDeviation, noiseAmplitude, ( test == 0 ) ? 0.1 : 0.3 );
+
+            double lagOneCorrelation = computeSampleCorrelation(
+                        currentSequence.segment( 0, numberOfObservations - 1 ),
+                        currentSequence.segment( 1, numberOfObservations - 1 ) );
+            BOOST_CHECK_SMALL( lagOneCorrelation - expectedLagOneCorrelation, 0.15 );
+        }
+
+        // Check that noise of different links, observables, and entries of a single observable is independent
+        for( unsigned int i = 0; i < noiseSequences.size( ); i++ )
+        {
+            for( unsigned int j = i + 1; j < noiseSequences.size( ); j++ )
+            {
+                BOOST_CHECK_SMALL( computeSampleCorrelation( noiseSequences.at( i ), noiseSequences.at( j ) ),
+                                   ( test == 0 ) ? 0.15 : 0.4 );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
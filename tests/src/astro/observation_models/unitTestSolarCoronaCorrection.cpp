@@ -112,6 +112,114 @@ BOOST_AUTO_TEST_CASE( testInversePowerSeriesCorrectionMorley )
     }
 }
 
+// Compare closed-form electron density integral with numerical quadrature, for non-integer exponents and geometries
+// ranging from conjunction to (nearly) radially aligned link ends, and check position partials and caching.
+BOOST_AUTO_TEST_CASE( testInversePowerSeriesCorrectionClosedForm )
+{
+    double frequency = 8.4e9;
+    std::function< double ( std::vector< FrequencyBands >, double ) > frequencyFunction =
+            [ = ]( std::vector< FrequencyBands >, double ){ return frequency; };
+    std::shared_ptr< ObservationAncilliarySimulationSettings > dummyAncillarySettings = std::make_shared<
+            ObservationAncilliarySimulationSettings >( );
+    dummyAncillarySettings->setAncilliaryDoubleVectorData( frequency_bands, { TUDAT_NAN } );
+
+    // Define Sun state function, counting the number of evaluations
+    int numberOfSunStateEvaluations = 0;
+    Eigen::Vector6d sunState = Eigen::Vector6d::Zero( );
+    sunState.segment( 0, 3 ) << 1.0e9, -2.0e9, 0.5e9;
+    std::function< Eigen::Vector6d ( double time ) > sunStateFunction =
+            [ & ]( double time ){ numberOfSunStateEvaluations++; return sunState; };
+
+    const double sunRadius = 696e6;
+    const double astronomicalUnit = physical_constants::ASTRONOMICAL_UNIT;
+    for( double exponent : { 0.6, 1.0, 2.3, 5.7 } )
+    {
+        InversePowerSeriesSolarCoronaCorrection coronaCorrection = InversePowerSeriesSolarCoronaCorrection(
+                observation_models::n_way_range, sunStateFunction, frequencyFunction, { 1.0e12 }, { exponent }, 40.3, sunRadius );
+
+        // Transmitter positions w.r.t. Sun: near conjunction, generic, and (nearly) radially aligned with receiver
+        Eigen::Vector3d receiverPosition = ( Eigen::Vector3d( ) << astronomicalUnit, 0.0, 0.0 ).finished( );
+        std::vector< Eigen::Vector3d > transmitterPositions =
+        { ( Eigen::Vector3d( ) << -1.5 * astronomicalUnit, 3.0 * sunRadius, 0.0 ).finished( ),
+          ( Eigen::Vector3d( ) << 0.3 * astronomicalUnit, 1.2 * astronomicalUnit, -0.1 * astronomicalUnit ).finished( ),
+          ( Eigen::Vector3d( ) << 2.5 * astronomicalUnit, 1.0E-3 * astronomicalUnit, 0.0 ).finished( ),
+          ( Eigen::Vector3d( ) << 0.4 * astronomicalUnit, 1.0E-4 * astronomicalUnit, 0.0 ).finished( ) };
+
+        for( unsigned int i = 0; i < transmitterPositions.size( ); i++ )
+        {
+            Eigen::Vector6d transmitterState = Eigen::Vector6d::Zero( ), receiverState = Eigen::Vector6d::Zero( );
+            transmitterState.segment( 0, 3 ) = transmitterPositions.at( i ) + sunState.segment( 0, 3 );
+            receiverState.segment( 0, 3 ) = receiverPosition + sunState.segment( 0, 3 );
+
+            // Compute integral numerically, substituting s = d sinh(t) for distance s along line of sight (w.r.t. point
+            // closest to Sun at distance d), and using composite Simpson rule
+            Eigen::Vector3d lineOfSight = ( receiverPosition - transmitterPositions.at( i ) ).normalized( );
+            double minimumDistance = transmitterPositions.at( i ).cross( lineOfSight ).norm( );
+            double lowerBound = std::asinh( transmitterPositions.at( i ).dot( lineOfSight ) / minimumDistance );
+            double upperBound = std::asinh( receiverPosition.dot( lineOfSight ) / minimumDistance );
+            int numberOfIntervals = 20000;
+            double stepSize = ( upperBound - lowerBound ) / numberOfIntervals;
+            double numericalIntegral = 0.0;
+            for( int j = 0; j <= numberOfIntervals; j++ )
+            {
+                double weight = ( j == 0 || j == numberOfIntervals ) ? 1.0 : ( ( j % 2 == 1 ) ? 4.0 : 2.0 );
+                numericalIntegral += weight * std::pow( std::cosh( lowerBound + j * stepSize ), 1.0 - exponent );
+            }
+            numericalIntegral *= stepSize / 3.0 * 1.0e12 * std::pow( sunRadius, exponent ) *
+                    std::pow( minimumDistance, 1.0 - exponent );
+
+            double correction = coronaCorrection.calculateLightTimeCorrectionWithMultiLegLinkEndStates(
+                        { transmitterState, receiverState }, { 0.0, 1000.0 }, 0, dummyAncillarySettings );
+            double computedIntegral = correction * physical_constants::getSpeedOfLight< double >( ) *
+                    frequency * frequency / 40.3;
+            BOOST_CHECK_CLOSE_FRACTION( computedIntegral, numericalIntegral, 1.0E-9 );
+
+            // Check position partials against central differences
+            for( LinkEndType linkEnd : { transmitter, receiver } )
+            {
+                Eigen::Vector3d analyticalPartial =
+                        coronaCorrection.calculateLightTimeCorrectionPartialDerivativeWrtLinkEndPosition(
+                            transmitterState, receiverState, 0.0, 1000.0, linkEnd );
+                Eigen::Vector3d numericalPartial;
+                double positionPerturbation = 1.0E4;
+                for( unsigned int j = 0; j < 3; j++ )
+                {
+                    std::vector< double > perturbedCorrections;
+                    for( double perturbationSign : { 1.0, -1.0 } )
+                    {
+                        Eigen::Vector6d perturbedTransmitterState = transmitterState;
+                        Eigen::Vector6d perturbedReceiverState = receiverState;
+                        ( linkEnd == transmitter ? perturbedTransmitterState : perturbedReceiverState )( j ) +=
+                                perturbationSign * positionPerturbation;
+                        perturbedCorrections.push_back( coronaCorrection.calculateLightTimeCorrectionWithMultiLegLinkEndStates(
+                                    { perturbedTransmitterState, perturbedReceiverState }, { 0.0, 1000.0 }, 0,
+                                    dummyAncillarySettings ) );
+                    }
+                    numericalPartial( j ) = ( perturbedCorrections.at( 0 ) - perturbedCorrections.at( 1 ) ) /
+                            ( 2.0 * positionPerturbation );
+                }
+                for( unsigned int j = 0; j < 3; j++ )
+                {
+                    BOOST_CHECK_SMALL( analyticalPartial( j ) - numericalPartial( j ),
+                                       1.0E-6 * analyticalPartial.norm( ) );
+                }
+            }
+
+            // Check that Sun states are not recomputed for unchanged link end times
+            int previousNumberOfSunStateEvaluations = numberOfSunStateEvaluations;
+            double repeatedCorrection = coronaCorrection.calculateLightTimeCorrectionWithMultiLegLinkEndStates(
+                        { transmitterState, receiverState }, { 0.0, 1000.0 }, 0, dummyAncillarySettings );
+            BOOST_CHECK_EQUAL( numberOfSunStateEvaluations, previousNumberOfSunStateEvaluations );
+            BOOST_CHECK_EQUAL( repeatedCorrection, correction );
+        }
+
+        // Check that partial cannot be computed for times at which correction was not evaluated
+        BOOST_CHECK_THROW( coronaCorrection.calculateLightTimeCorrectionPartialDerivativeWrtLinkEndPosition(
+                               Eigen::Vector6d::Zero( ), Eigen::Vector6d::Zero( ), 10.0, 1000.0, receiver ),
+                           std::runtime_error );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -667,6 +667,128 @@ BOOST_AUTO_TEST_CASE( testAerodynamicAccelerationPartials )
                                        partialWrtDragCoefficient, 1.0E-10 );
 }
 
+//! Test aerodynamic partials with numerical partial settings (state perturbations re-selected during the updates)
+BOOST_AUTO_TEST_CASE( testAerodynamicAccelerationPartialsWithStepSizeSelection )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Create Earth and vehicle objects
+    BodyListSettings defaultBodySettings =
+            getDefaultBodySettings( { "Earth" } );
+    defaultBodySettings.at( "Earth" )->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ) );
+    SystemOfBodies bodies = createSystemOfBodies( defaultBodySettings );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.at( "Vehicle" )->setConstantBodyMass( 5.0E3 );
+    bodies.at( "Vehicle" )->setAerodynamicCoefficientInterface(
+                createAerodynamicCoefficientInterface(
+                    std::make_shared< ConstantAerodynamicCoefficientSettings >(
+                        2.0, 4.0, Eigen::Vector3d::Zero( ), ( Eigen::Vector3d( ) << 2.5, -0.1, 0.5 ).finished( ),
+                        Eigen::Vector3d::Zero( ), aerodynamics::getAerodynamicCoefficientFrame( 1, 1 ),
+                        aerodynamics::getAerodynamicCoefficientFrame( 1, 1 ) ), "Vehicle", bodies ) );
+
+    // Set vehicle state
+    Eigen::Vector6d vehicleSphericalEntryState;
+    vehicleSphericalEntryState( SphericalOrbitalStateElementIndices::radiusIndex ) =
+            spice_interface::getAverageRadius( "Earth" ) + 120.0E3;
+    vehicleSphericalEntryState( SphericalOrbitalStateElementIndices::latitudeIndex ) = 0.0;
+    vehicleSphericalEntryState( SphericalOrbitalStateElementIndices::longitudeIndex ) = 1.2;
+    vehicleSphericalEntryState( SphericalOrbitalStateElementIndices::speedIndex ) = 7.7E3;
+    vehicleSphericalEntryState( SphericalOrbitalStateElementIndices::flightPathIndex ) =
+            -0.9 * mathematical_constants::PI / 180.0;
+    vehicleSphericalEntryState( SphericalOrbitalStateElementIndices::headingAngleIndex ) = 0.6;
+    Eigen::Vector6d systemInitialState = tudat::ephemerides::transformStateToTargetFrame(
+                convertSphericalOrbitalToCartesianState(
+                    vehicleSphericalEntryState ), 0.0, bodies.at( "Earth" )->getRotationalEphemeris( ) );
+
+    bodies.at( "Earth" )->setStateFromEphemeris( 0.0 );
+    bodies.at( "Earth" )->setCurrentRotationToLocalFrameFromEphemeris( 0.0 );
+    bodies.at( "Vehicle" )->setState( systemInitialState );
+
+    std::shared_ptr< basic_astrodynamics::AccelerationModel3d > accelerationModel =
+            simulation_setup::createAerodynamicAcceleratioModel(
+                bodies.at( "Vehicle" ), bodies.at( "Earth" ), "Vehicle", "Earth" );
+    bodies.at( "Vehicle" )->getFlightConditions( )->updateConditions( 0.0 );
+    accelerationModel->updateMembers( 0.0 );
+
+    // Create initial state parameter, with numerical partial settings for the aerodynamic acceleration
+    Eigen::Vector6d initialPerturbations = ( Eigen::Vector6d( ) << 10.0, 10.0, 10.0, 1.0E-2, 1.0E-2, 1.0E-2 ).finished( );
+    std::shared_ptr< EstimatableParameter< Eigen::VectorXd > > initialStateParameter =
+            std::make_shared< InitialTranslationalStateParameter< double > >(
+                "Vehicle", systemInitialState, "Earth", "ECLIPJ2000" );
+    initialStateParameter->addCustomPartialSettings(
+                numericalAccelerationPartialSettings(
+                    initialPerturbations, "Vehicle", "Earth", basic_astrodynamics::aerodynamic,
+                    std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >( ), 2 ) );
+    std::shared_ptr< EstimatableParameterSet< double > > parameterSet =
+            std::make_shared< EstimatableParameterSet< double > >(
+                std::vector< std::shared_ptr< EstimatableParameter< double > > >( ),
+                std::vector< std::shared_ptr< EstimatableParameter< Eigen::VectorXd > > >( ),
+                std::vector< std::shared_ptr< EstimatableParameter< Eigen::VectorXd > > >( { initialStateParameter } ) );
+
+    // Create partial, and check that the settings are used
+    std::shared_ptr< AerodynamicAccelerationPartial > aerodynamicAccelerationPartial =
+            std::dynamic_pointer_cast< AerodynamicAccelerationPartial >(
+                createAnalyticalAccelerationPartial(
+                    accelerationModel, std::make_pair( "Vehicle", bodies.at( "Vehicle" ) ),
+                    std::make_pair( "Earth", bodies.at( "Earth" ) ), bodies, parameterSet ) );
+    BOOST_CHECK( aerodynamicAccelerationPartial != nullptr );
+
+    Eigen::VectorXd stepSizes = aerodynamicAccelerationPartial->getStateJacobianCalculator( )->getStepSizes( );
+    Eigen::VectorXd expectedStepSizes = initialPerturbations;
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( stepSizes, expectedStepSizes, std::numeric_limits< double >::epsilon( ) );
+
+    std::function< void( ) > environmentUpdateFunction =
+            std::bind( &updateFlightConditionsWithPerturbedState, bodies.at( "Vehicle" )->getFlightConditions( ), 0.0 );
+    std::function< void( Eigen::Vector6d ) > vehicleStateSetFunction =
+            std::bind( &Body::setState, bodies.at( "Vehicle" ), std::placeholders::_1 );
+    Eigen::Vector3d positionPerturbation = Eigen::Vector3d::Constant( 1.0 );
+    Eigen::Vector3d velocityPerturbation = Eigen::Vector3d::Constant( 1.0E-3 );
+
+    // Update partial repeatedly (step sizes are re-selected at the first and third update), and compare to numerical partials
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        aerodynamicAccelerationPartial->resetCurrentTime( );
+        aerodynamicAccelerationPartial->update( 0.0 );
+        Eigen::MatrixXd partialWrtVehiclePosition = Eigen::Matrix3d::Zero( );
+        aerodynamicAccelerationPartial->wrtPositionOfAcceleratedBody( partialWrtVehiclePosition.block( 0, 0, 3, 3 ) );
+        Eigen::MatrixXd partialWrtVehicleVelocity = Eigen::Matrix3d::Zero( );
+        aerodynamicAccelerationPartial->wrtVelocityOfAcceleratedBody( partialWrtVehicleVelocity.block( 0, 0, 3, 3 ), 1, 0, 0 );
+
+        Eigen::MatrixXd testPartialWrtVehiclePosition = calculateAccelerationWrtStatePartials(
+                    vehicleStateSetFunction, accelerationModel, bodies.at( "Vehicle" )->getState( ), positionPerturbation, 0,
+                    environmentUpdateFunction );
+        Eigen::MatrixXd testPartialWrtVehicleVelocity = calculateAccelerationWrtStatePartials(
+                    vehicleStateSetFunction, accelerationModel, bodies.at( "Vehicle" )->getState( ), velocityPerturbation, 3,
+                    environmentUpdateFunction );
+
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testPartialWrtVehiclePosition, partialWrtVehiclePosition, 1.0E-6 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( testPartialWrtVehicleVelocity, partialWrtVehicleVelocity, 1.0E-6 );
+    }
+
+    // Check that step sizes have been re-selected
+    stepSizes = aerodynamicAccelerationPartial->getStateJacobianCalculator( )->getStepSizes( );
+    BOOST_CHECK( ( stepSizes - initialPerturbations ).cwiseAbs( ).maxCoeff( ) > 0.0 );
+
+    // Check that inconsistent numerical partial settings are rejected
+    initialStateParameter->setCustomPartialSettings(
+    { numericalAccelerationPartialSettings(
+      Eigen::Vector3d::Constant( 1.0 ), "Vehicle", "Earth", basic_astrodynamics::aerodynamic ) } );
+    bool isExceptionCaught = false;
+    try
+    {
+        createAnalyticalAccelerationPartial(
+                    accelerationModel, std::make_pair( "Vehicle", bodies.at( "Vehicle" ) ),
+                    std::make_pair( "Earth", bodies.at( "Earth" ) ), bodies, parameterSet );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
 
 BOOST_AUTO_TEST_CASE( testRelativisticAccelerationPartial )
 {
@@ -0,0 +1,189 @@
+/*    Copyright (c) 2010-2023, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/astro/orbit_determination/acceleration_partials/numericalAccelerationPartial.h"
+#include "tudat/simulation/estimation.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::simulation_setup;
+
+BOOST_AUTO_TEST_SUITE( test_mascon_partials )
+
+//! Test mascon acceleration models and partials (direct and third-body), created from settings, against numerical partials
+BOOST_AUTO_TEST_CASE( testMasconAccelerationPartials )
+{
+    double testTime = 1.0E4;
+
+    // Create bodies: rotating asteroid with mascon gravity field, small moon, and two vehicles
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    bodies.createEmptyBody( "Asteroid" );
+    bodies.createEmptyBody( "Moonlet" );
+    bodies.createEmptyBody( "Vehicle" );
+    bodies.createEmptyBody( "Vehicle2" );
+
+    bodies.at( "Asteroid" )->setRotationalEphemeris(
+                std::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                    Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) *
+                                        Eigen::AngleAxisd( 0.2, Eigen::Vector3d::UnitX( ) ) ),
+                    2.0 * mathematical_constants::PI / 18000.0, 0.0, "ECLIPJ2000", "Asteroid_Fixed" ) );
+
+    // Define irregular set of mascons with unequal masses
+    int numberOfMascons = 40;
+    Eigen::MatrixXd masconPositions = Eigen::MatrixXd::Zero( numberOfMascons, 3 );
+    Eigen::VectorXd masconMassFractions = Eigen::VectorXd::Zero( numberOfMascons );
+    for( int i = 0; i < numberOfMascons; i++ )
+    {
+        masconPositions( i, 0 ) = 8.0E3 * std::sin( 1.3 * i );
+        masconPositions( i, 1 ) = 5.0E3 * std::cos( 2.1 * i + 0.4 );
+        masconPositions( i, 2 ) = 3.0E3 * std::sin( 0.7 * i + 1.1 );
+        masconMassFractions( i ) = 1.0 + 0.5 * std::sin( 3.1 * i );
+    }
+    masconMassFractions /= masconMassFractions.sum( );
+
+    double asteroidGravitationalParameter = 4.0E5;
+    bodies.at( "Asteroid" )->setGravityFieldModel(
+                createGravityFieldModel(
+                    masconGravitySettings( asteroidGravitationalParameter, masconPositions, "Asteroid_Fixed",
+                                           masconMassFractions ), "Asteroid", bodies ) );
+    bodies.at( "Moonlet" )->setGravityFieldModel(
+                createGravityFieldModel( centralGravitySettings( 1.0E3 ), "Moonlet", bodies ) );
+
+    // Set current states and rotation
+    bodies.at( "Asteroid" )->setState( ( Eigen::Vector6d( ) << 1.0E8, -2.0E8, 3.0E7, 1.0E3, 2.0E3, -5.0E2 ).finished( ) );
+    bodies.at( "Moonlet" )->setState( bodies.at( "Asteroid" )->getState( ) +
+                                      ( Eigen::Vector6d( ) << 6.0E4, 1.0E4, -5.0E3, -2.0, 1.5, 0.3 ).finished( ) );
+    bodies.at( "Vehicle" )->setState( bodies.at( "Asteroid" )->getState( ) +
+                                      ( Eigen::Vector6d( ) << 1.5E4, -1.2E4, 6.0E3, 1.0, 3.0, -2.0 ).finished( ) );
+    bodies.at( "Vehicle2" )->setState( bodies.at( "Moonlet" )->getState( ) +
+                                       ( Eigen::Vector6d( ) << -2.0E3, 1.0E3, 5.0E2, 0.2, -0.1, 0.1 ).finished( ) );
+    bodies.at( "Asteroid" )->setCurrentRotationToLocalFrameFromEphemeris( testTime );
+
+    // Create direct (Vehicle) and third-body (Vehicle2) mascon accelerations from settings
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Asteroid" ].push_back( masconAcceleration( ) );
+    accelerationSettingsMap[ "Vehicle2" ][ "Asteroid" ].push_back( masconAcceleration( ) );
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationSettingsMap, { "Vehicle", "Vehicle2" }, { "Asteroid", "Moonlet" } );
+
+    std::shared_ptr< basic_astrodynamics::AccelerationModel3d > directAcceleration =
+            accelerationModelMap.at( "Vehicle" ).at( "Asteroid" ).at( 0 );
+    std::shared_ptr< basic_astrodynamics::AccelerationModel3d > thirdBodyAcceleration =
+            accelerationModelMap.at( "Vehicle2" ).at( "Asteroid" ).at( 0 );
+    BOOST_CHECK_EQUAL( basic_astrodynamics::getAccelerationModelType( directAcceleration ),
+                       basic_astrodynamics::mascon_gravity );
+    BOOST_CHECK_EQUAL( basic_astrodynamics::getAccelerationModelType( thirdBodyAcceleration ),
+                       basic_astrodynamics::third_body_mascon_gravity );
+
+    // Check direct acceleration against direct summation over mascons
+    directAcceleration->updateMembers( testTime );
+    Eigen::Matrix3d rotationToBodyFixedFrame =
+            bodies.at( "Asteroid" )->getCurrentRotationToLocalFrame( ).toRotationMatrix( );
+    Eigen::Vector3d bodyFixedPosition = rotationToBodyFixedFrame * (
+                bodies.at( "Vehicle" )->getPosition( ) - bodies.at( "Asteroid" )->getPosition( ) );
+    Eigen::Vector3d expectedBodyFixedAcceleration = Eigen::Vector3d::Zero( );
+    for( int i = 0; i < numberOfMascons; i++ )
+    {
+        Eigen::Vector3d relativePosition = bodyFixedPosition - masconPositions.row( i ).transpose( );
+        expectedBodyFixedAcceleration -= asteroidGravitationalParameter * masconMassFractions( i ) *
+                relativePosition / std::pow( relativePosition.norm( ), 3.0 );
+    }
+    Eigen::Vector3d expectedAcceleration = rotationToBodyFixedFrame.transpose( ) * expectedBodyFixedAcceleration;
+    Eigen::Vector3d computedAcceleration = directAcceleration->getAcceleration( );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( computedAcceleration, expectedAcceleration, 1.0E-12 );
+
+    // Create acceleration partials from acceleration models
+    std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parameterSet =
+            createParametersToEstimate< double >(
+                std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSettings > >( ), bodies );
+    std::shared_ptr< acceleration_partials::AccelerationPartial > directPartial =
+            createAnalyticalAccelerationPartial(
+                directAcceleration, std::make_pair( "Vehicle", bodies.at( "Vehicle" ) ),
+                std::make_pair( "Asteroid", bodies.at( "Asteroid" ) ), bodies, parameterSet );
+    std::shared_ptr< acceleration_partials::AccelerationPartial > thirdBodyPartial =
+            createAnalyticalAccelerationPartial(
+                thirdBodyAcceleration, std::make_pair( "Vehicle2", bodies.at( "Vehicle2" ) ),
+                std::make_pair( "Asteroid", bodies.at( "Asteroid" ) ), bodies, parameterSet );
+    BOOST_CHECK( std::dynamic_pointer_cast< acceleration_partials::MasconGravityPartial >( directPartial ) != nullptr );
+
+    std::vector< std::pair< std::shared_ptr< basic_astrodynamics::AccelerationModel3d >,
+            std::shared_ptr< acceleration_partials::AccelerationPartial > > > accelerationsToTest =
+    { std::make_pair( directAcceleration, directPartial ), std::make_pair( thirdBodyAcceleration, thirdBodyPartial ) };
+    std::vector< std::vector< std::string > > bodiesToPerturb =
+    { { "Vehicle", "Asteroid" }, { "Vehicle2", "Asteroid", "Moonlet" } };
+
+    Eigen::Vector3d positionPerturbation = Eigen::Vector3d::Constant( 1.0 );
+    Eigen::Vector3d velocityPerturbation = Eigen::Vector3d::Constant( 1.0E-3 );
+    for( unsigned int i = 0; i < accelerationsToTest.size( ); i++ )
+    {
+        std::shared_ptr< basic_astrodynamics::AccelerationModel3d > currentAcceleration = accelerationsToTest.at( i ).first;
+        std::shared_ptr< acceleration_partials::AccelerationPartial > currentPartial = accelerationsToTest.at( i ).second;
+
+        currentAcceleration->resetCurrentTime( );
+        currentAcceleration->updateMembers( testTime );
+        currentPartial->resetCurrentTime( );
+        currentPartial->update( testTime );
+
+        for( unsigned int j = 0; j < bodiesToPerturb.at( i ).size( ); j++ )
+        {
+            std::string currentBody = bodiesToPerturb.at( i ).at( j );
+
+            // Compute analytical partial w.r.t. state of current body
+            std::pair< std::function< void( Eigen::Block< Eigen::MatrixXd > ) >, int > partialFunction =
+                    currentPartial->getDerivativeFunctionWrtStateOfIntegratedBody(
+                        std::make_pair( currentBody, "" ), propagators::translational_state );
+            BOOST_CHECK_EQUAL( partialFunction.second, 6 );
+            Eigen::MatrixXd analyticalPartial = Eigen::MatrixXd::Zero( 3, 6 );
+            partialFunction.first( analyticalPartial.block( 0, 0, 3, 6 ) );
+
+            // Compute numerical partial w.r.t. state of current body
+            std::function< void( Eigen::Vector6d ) > stateSetFunction =
+                    std::bind( &Body::setState, bodies.at( currentBody ), std::placeholders::_1 );
+            Eigen::Vector6d nominalState = bodies.at( currentBody )->getState( );
+            Eigen::Matrix3d numericalPositionPartial = acceleration_partials::calculateAccelerationWrtStatePartials(
+                        stateSetFunction, currentAcceleration, nominalState, positionPerturbation, 0,
+                        &acceleration_partials::emptyFunction, testTime );
+            Eigen::Matrix3d numericalVelocityPartial = acceleration_partials::calculateAccelerationWrtStatePartials(
+                        stateSetFunction, currentAcceleration, nominalState, velocityPerturbation, 3,
+                        &acceleration_partials::emptyFunction, testTime );
+            stateSetFunction( nominalState );
+
+            Eigen::Matrix3d analyticalPositionPartial = analyticalPartial.block( 0, 0, 3, 3 );
+            Eigen::Matrix3d analyticalVelocityPartial = analyticalPartial.block( 0, 3, 3, 3 );
+            double maximumPartialEntry = numericalPositionPartial.cwiseAbs( ).maxCoeff( );
+            BOOST_CHECK( maximumPartialEntry > 0.0 );
+            for( int k = 0; k < 3; k++ )
+            {
+                for( int l = 0; l < 3; l++ )
+                {
+                    BOOST_CHECK_SMALL( analyticalPositionPartial( k, l ) - numericalPositionPartial( k, l ),
+                                       1.0E-6 * maximumPartialEntry );
+                    BOOST_CHECK_EQUAL( analyticalVelocityPartial( k, l ), 0.0 );
+                    BOOST_CHECK_EQUAL( numericalVelocityPartial( k, l ), 0.0 );
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
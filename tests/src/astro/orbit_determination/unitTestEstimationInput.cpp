@@ -174,6 +174,24 @@ BOOST_AUTO_TEST_CASE( test_CovarianceAsFunctionOfTime )
         TUDAT_CHECK_MATRIX_CLOSE_FRACTION( covarianceIterator->second, manualCovarianes.at( counter ), 1.0E-8 );
         counter++;
     }
+
+    // Check consistency of concatenated covariance history, with output times in reverse order
+    std::vector< double > outputTimes = utilities::createVectorFromMapKeys( automaticCovariances );
+    std::reverse( outputTimes.begin( ), outputTimes.end( ) );
+    Eigen::MatrixXd covarianceHistory;
+    std::vector< double > sortedOutputTimes = simulation_setup::calculateCovarianceHistoryUsingDataUpToEpoch(
+                podData.second->getObservationCollection( ), podData.first->normalizedDesignMatrix_,
+                podData.first->designMatrixTransformationDiagonal_, outputTimes, podData.first->weightsMatrixDiagonal_,
+                podData.second->getInverseOfAprioriCovariance( podData.first->numberOfParameters_ ), covarianceHistory );
+    int numberOfParameters = podData.first->numberOfParameters_;
+    BOOST_CHECK_EQUAL( sortedOutputTimes.size( ), automaticCovariances.size( ) );
+    BOOST_CHECK_EQUAL( covarianceHistory.cols( ), numberOfParameters * static_cast< int >( automaticCovariances.size( ) ) );
+    for( unsigned int i = 0; i < sortedOutputTimes.size( ); i++ )
+    {
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    covarianceHistory.block( 0, i * numberOfParameters, numberOfParameters, numberOfParameters ),
+                    automaticCovariances.at( sortedOutputTimes.at( i ) ), 1.0E-14 );
+    }
 }
 
 BOOST_AUTO_TEST_CASE( test_WeightDefinitions )
@@ -427,6 +445,48 @@ BOOST_AUTO_TEST_CASE( test_WeightDefinitions )
 
 }
 
+//! Test whether resetting the values of a parameter set only resets the parameters that are modified
+BOOST_AUTO_TEST_CASE( test_ParameterSetResetOfUnchangedParameters )
+{
+    using namespace tudat::estimatable_parameters;
+
+    // Create two custom parameters that count the number of times they are reset
+    std::vector< Eigen::VectorXd > parameterValues = { Eigen::Vector2d( 1.0, 2.0 ), Eigen::Vector3d( 3.0, 4.0, 5.0 ) };
+    std::vector< int > numberOfResets = { 0, 0 };
+    std::vector< std::shared_ptr< EstimatableParameter< Eigen::VectorXd > > > vectorParameters;
+    for( unsigned int i = 0; i < parameterValues.size( ); i++ )
+    {
+        vectorParameters.push_back( std::make_shared< CustomEstimatableParameter >(
+                                        "Parameter" + std::to_string( i ), parameterValues.at( i ).rows( ),
+                                        [ &parameterValues, i ]( ){ return parameterValues.at( i ); },
+                                        [ &parameterValues, &numberOfResets, i ]( const Eigen::VectorXd& newValue )
+        {
+            parameterValues.at( i ) = newValue;
+            numberOfResets.at( i )++;
+        } ) );
+    }
+    std::shared_ptr< EstimatableParameterSet< double > > parameterSet = std::make_shared< EstimatableParameterSet< double > >(
+                std::vector< std::shared_ptr< EstimatableParameter< double > > >( ), vectorParameters );
+
+    // Reset to current values: no parameter should be reset
+    Eigen::VectorXd fullParameterValues = parameterSet->getFullParameterValues< double >( );
+    parameterSet->resetParameterValues( fullParameterValues );
+    BOOST_CHECK_EQUAL( numberOfResets.at( 0 ), 0 );
+    BOOST_CHECK_EQUAL( numberOfResets.at( 1 ), 0 );
+
+    // Perturb only second parameter
+    fullParameterValues( 3 ) += 1.0;
+    parameterSet->resetParameterValues( fullParameterValues );
+    BOOST_CHECK_EQUAL( numberOfResets.at( 0 ), 0 );
+    BOOST_CHECK_EQUAL( numberOfResets.at( 1 ), 1 );
+    BOOST_CHECK_EQUAL( parameterValues.at( 1 )( 1 ), 5.0 );
+
+    // Force reset of all parameters
+    parameterSet->resetParameterValues( fullParameterValues, true );
+    BOOST_CHECK_EQUAL( numberOfResets.at( 0 ), 1 );
+    BOOST_CHECK_EQUAL( numberOfResets.at( 1 ), 2 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
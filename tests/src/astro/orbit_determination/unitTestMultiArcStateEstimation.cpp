@@ -578,6 +578,200 @@ BOOST_AUTO_TEST_CASE( test_MultiArcMultiBodyStateEstimation )
     }
 }
 
+//! Test whether estimation with arc-wise reduced, or tiled, normal equations reproduces the estimation with the full normal equations
+BOOST_AUTO_TEST_CASE( test_MultiArcEstimationWithReducedNormalEquations )
+{
+    //Load spice kernels
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Specify simulation time
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = initialEphemerisTime + 4.0 * 86400.0;
+
+    // Create bodies
+    BodyListSettings bodySettings =
+            getDefaultBodySettings( { "Earth", "Sun", "Moon" }, initialEphemerisTime - 86400.0, finalEphemerisTime + 86400.0,
+                                    "Earth", "ECLIPJ2000" );
+    SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+
+    std::vector< std::string > vehicleNames = { "Borzi1", "Borzi2" };
+    int numberOfVehicles = vehicleNames.size( );
+    for( int i = 0; i < numberOfVehicles; i++ )
+    {
+        bodies.createEmptyBody( vehicleNames.at( i ) );
+        bodies.at( vehicleNames.at( i ) )->setEphemeris( std::make_shared< MultiArcEphemeris >(
+                                                           std::map< double, std::shared_ptr< Ephemeris > >( ), "Earth", "ECLIPJ2000" ) );
+    }
+
+    // Create acceleration models
+    SelectedAccelerationMap accelerationMap;
+    for( int i = 0; i < numberOfVehicles; i++ )
+    {
+        accelerationMap[ vehicleNames.at( i ) ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+        accelerationMap[ vehicleNames.at( i ) ][ "Moon" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+        accelerationMap[ vehicleNames.at( i ) ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( point_mass_gravity ) );
+    }
+    std::vector< std::string > centralBodies( numberOfVehicles, "Earth" );
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationMap, vehicleNames, centralBodies );
+
+    // Define integration arcs
+    std::vector< double > integrationArcStartTimes;
+    std::vector< double > integrationArcEndTimes;
+    std::vector< double > integrationArcLimits;
+    double arcDuration = 1.01 * 86400.0;
+    double arcOverlap = 300.0;
+    double currentStartTime = initialEphemerisTime;
+    double currentEndTime = initialEphemerisTime + arcDuration;
+    do
+    {
+        integrationArcLimits.push_back( currentStartTime );
+        integrationArcEndTimes.push_back( currentEndTime );
+        integrationArcStartTimes.push_back( currentStartTime );
+        currentStartTime = currentEndTime - arcOverlap;
+        currentEndTime = currentStartTime + arcDuration;
+    }
+    while( currentEndTime < finalEphemerisTime );
+    integrationArcLimits.push_back( currentStartTime + arcOverlap );
+    int numberOfArcs = integrationArcStartTimes.size( );
+
+    // Define propagator settings, with (semi-arbitrary) initial states for vehicles
+    double earthGravitationalParameter = bodies.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( );
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< IntegratorSettings< > >( rungeKutta4, initialEphemerisTime, 60.0 );
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< > > > propagatorSettingsList;
+    for( int j = 0; j < numberOfArcs; j++ )
+    {
+        Eigen::VectorXd currentArcInitialStates = Eigen::VectorXd::Zero( 6 * numberOfVehicles );
+        for( int i = 0; i < numberOfVehicles; i++ )
+        {
+            Eigen::Vector6d initialStateInKeplerianElements;
+            initialStateInKeplerianElements( semiMajorAxisIndex ) = 7500.0E3;
+            initialStateInKeplerianElements( eccentricityIndex ) = 0.1;
+            initialStateInKeplerianElements( inclinationIndex ) = 1.0 + 0.3 * static_cast< double >( i );
+            initialStateInKeplerianElements( argumentOfPeriapsisIndex ) = unit_conversions::convertDegreesToRadians( 235.7 );
+            initialStateInKeplerianElements( longitudeOfAscendingNodeIndex ) = unit_conversions::convertDegreesToRadians( 23.4 );
+            initialStateInKeplerianElements( trueAnomalyIndex ) = 0.5 * static_cast< double >( j );
+            currentArcInitialStates.segment( i * 6, 6 ) = convertKeplerianToCartesianElements(
+                        initialStateInKeplerianElements, earthGravitationalParameter );
+        }
+        propagatorSettingsList.push_back(
+                    std::make_shared< TranslationalStatePropagatorSettings< > >
+                    ( centralBodies, accelerationModelMap, vehicleNames, currentArcInitialStates,
+                      integrationArcEndTimes.at( j ), cowell, std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > >( ), 60.0 ) );
+    }
+    std::shared_ptr< MultiArcPropagatorSettings< > > propagatorSettings =
+            std::make_shared< MultiArcPropagatorSettings< > >( propagatorSettingsList );
+
+    // Set parameters that are to be estimated: arc initial states (local to each arc) and Earth gravitational parameter (global)
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames =
+            getInitialMultiArcParameterSettings< >( propagatorSettings, bodies, integrationArcStartTimes );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate< double >( parameterNames, bodies );
+
+    // Create orbit determination object.
+    std::vector< LinkDefinition > linkEndsList( numberOfVehicles );
+    std::vector< std::shared_ptr< ObservationModelSettings > > observationSettingsList;
+    for( int i = 0; i < numberOfVehicles; i++ )
+    {
+        linkEndsList[ i ][ observed_body ] = std::pair< std::string, std::string >( vehicleNames.at( i ), "" );
+        observationSettingsList.push_back( std::make_shared< ObservationModelSettings >(
+                                               position_observable, linkEndsList[ i ] ) );
+    }
+    OrbitDeterminationManager< > orbitDeterminationManager = OrbitDeterminationManager< >(
+                bodies, parametersToEstimate, observationSettingsList, integratorSettings, propagatorSettings );
+    Eigen::VectorXd truthParameters = parametersToEstimate->getFullParameterValues< double >( );
+
+    // Simulate observations, away from the arc overlaps
+    int numberOfObservationsPerArc = 50;
+    double timeBuffer = 600.0;
+    std::vector< double > observationTimes;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        double currentTimeStep = ( integrationArcLimits[ i + 1 ] - integrationArcLimits[ i ] - 2.0 * timeBuffer ) /
+                static_cast< double >( numberOfObservationsPerArc - 1 );
+        for( int j = 0; j < numberOfObservationsPerArc; j++ )
+        {
+            observationTimes.push_back( integrationArcLimits[ i ] + timeBuffer + currentTimeStep * static_cast< double >( j ) );
+        }
+    }
+
+    std::vector< std::shared_ptr< ObservationSimulationSettings< double > > > measurementSimulationInput;
+    for( int i = 0; i < numberOfVehicles; i++ )
+    {
+        measurementSimulationInput.push_back(
+                    std::make_shared< TabulatedObservationSimulationSettings< > >(
+                        position_observable, linkEndsList[ i ], observationTimes, observed_body ) );
+    }
+    std::shared_ptr< ObservationCollection< > > observationsAndTimes = simulateObservations< double, double >(
+                measurementSimulationInput, orbitDeterminationManager.getObservationSimulators( ), bodies  );
+
+    // Check assignment of observations to arcs
+    std::vector< std::vector< int > > arcObservationIndices = orbitDeterminationManager.getArcObservationIndices(
+                observationsAndTimes, integrationArcStartTimes );
+    BOOST_CHECK_EQUAL( static_cast< int >( arcObservationIndices.size( ) ), numberOfArcs );
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        BOOST_CHECK_EQUAL( static_cast< int >( arcObservationIndices.at( i ).size( ) ), 3 * numberOfVehicles * numberOfObservationsPerArc );
+    }
+
+    // Perturb parameters
+    Eigen::VectorXd initialParameterEstimate = truthParameters;
+    for( int i = 0; i < numberOfVehicles * numberOfArcs; i++ )
+    {
+        initialParameterEstimate.segment( 6 * i, 3 ) += Eigen::Vector3d::Constant( 1.0 );
+        initialParameterEstimate.segment( 6 * i + 3, 3 ) += Eigen::Vector3d::Constant( 1.0E-3 );
+    }
+    initialParameterEstimate( initialParameterEstimate.rows( ) - 1 ) *= ( 1.0 + 1.0E-8 );
+
+    // Estimate parameters with full, arc-wise reduced and tiled normal equations, from the same initial estimate
+    std::vector< std::shared_ptr< EstimationOutput< > > > estimationOutputs;
+    for( unsigned int testCase = 0; testCase < 3; testCase++ )
+    {
+        parametersToEstimate->resetParameterValues( initialParameterEstimate );
+        std::shared_ptr< EstimationInput< > > estimationInput = std::make_shared< EstimationInput< > >(
+                    observationsAndTimes );
+        estimationInput->setConvergenceChecker( std::make_shared< EstimationConvergenceChecker >( 2 ) );
+        estimationInput->defineEstimationSettings( true, true, false, true, false );
+        if( testCase == 1 )
+        {
+            estimationInput->setArcwiseReducedNormalEquations( integrationArcStartTimes );
+        }
+        else if( testCase == 2 )
+        {
+            estimationInput->setTiledNormalEquations( 8, "tiledNormalEquationsTest.dat", 2 );
+        }
+        estimationOutputs.push_back( orbitDeterminationManager.estimateParameters( estimationInput ) );
+    }
+
+    Eigen::VectorXd fullEstimate = estimationOutputs.at( 0 )->parameterEstimate_;
+    Eigen::MatrixXd fullInverseCovariance = estimationOutputs.at( 0 )->getUnnormalizedInverseCovarianceMatrix( );
+    Eigen::VectorXd fullFormalErrors = estimationOutputs.at( 0 )->getFormalErrorVector( );
+    for( unsigned int testCase = 1; testCase < 3; testCase++ )
+    {
+        // Compare estimated parameters, and check that estimation has converged
+        Eigen::VectorXd currentEstimate = estimationOutputs.at( testCase )->parameterEstimate_;
+        BOOST_CHECK_EQUAL( estimationOutputs.at( 0 )->bestIteration_, estimationOutputs.at( testCase )->bestIteration_ );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( fullEstimate, currentEstimate, 1.0E-12 );
+        for( int i = 0; i < numberOfVehicles * numberOfArcs; i++ )
+        {
+            for( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( currentEstimate( 6 * i + j ) - truthParameters( 6 * i + j ) ), 1.0E-3 );
+                BOOST_CHECK_SMALL( std::fabs( currentEstimate( 6 * i + j + 3 ) - truthParameters( 6 * i + j + 3 ) ), 1.0E-6 );
+            }
+        }
+
+        // Compare inverse covariance and formal errors
+        Eigen::MatrixXd currentInverseCovariance = estimationOutputs.at( testCase )->getUnnormalizedInverseCovarianceMatrix( );
+        BOOST_CHECK_SMALL( ( fullInverseCovariance - currentInverseCovariance ).norm( ) / fullInverseCovariance.norm( ), 1.0E-12 );
+
+        Eigen::VectorXd currentFormalErrors = estimationOutputs.at( testCase )->getFormalErrorVector( );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( fullFormalErrors, currentFormalErrors, 1.0E-8 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -216,6 +216,165 @@ namespace tudat
                 }
             }
 
+//! Unit test to check if the conversion of the propagated solution to conventional form is performed correctly
+            BOOST_AUTO_TEST_CASE( test_OutputSolutionConversion )
+            {
+                // Create Earth with central gravity field, and empty vehicle
+                double earthGravitationalParameter = 3.986004418E14;
+                BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+                bodySettings.addSettings( "Earth" );
+                bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings(
+                        Eigen::Vector6d::Zero( ), "Earth", "ECLIPJ2000" );
+                bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( earthGravitationalParameter );
+                SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+                bodies.createEmptyBody( "Vehicle" );
+
+                SelectedAccelerationMap accelerationMap;
+                accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >(
+                        basic_astrodynamics::point_mass_gravity ) );
+                std::vector< std::string > bodiesToIntegrate = { "Vehicle" };
+                std::vector< std::string > centralBodies = { "Earth" };
+                AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                        bodies, accelerationMap, bodiesToIntegrate, centralBodies );
+
+                Eigen::Vector6d initialKeplerElements;
+                initialKeplerElements << 8000.0E3, 0.1, 0.4, 1.0, 2.0, 3.0;
+                Eigen::Vector6d systemInitialState = convertKeplerianToCartesianElements(
+                        initialKeplerElements, earthGravitationalParameter );
+
+                double initialTime = 0.0;
+                std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+                        std::make_shared< RungeKuttaFixedStepSizeSettings< double > >(
+                                10.0, CoefficientSets::rungeKuttaFehlberg78 );
+
+                std::vector< TranslationalPropagatorType > propagatorTypes =
+                        { cowell, encke, gauss_keplerian, gauss_modified_equinoctial };
+                std::map< double, Eigen::VectorXd > cowellSolution;
+                for( unsigned int i = 0; i < propagatorTypes.size( ); i++ )
+                {
+                    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                                    centralBodies, accelerationModelMap, bodiesToIntegrate, systemInitialState, initialTime,
+                                    integratorSettings, std::make_shared< PropagationTimeTerminationSettings >( 3600.0 ),
+                                    propagatorTypes.at( i ) );
+                    SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+                    std::shared_ptr< SingleArcSimulationResults< double, double > > propagationResults =
+                            dynamicsSimulator.getSingleArcPropagationResults( );
+
+                    std::map< double, Eigen::VectorXd >& rawSolution = propagationResults->getEquationsOfMotionNumericalSolutionRaw( );
+                    std::map< double, Eigen::VectorXd >& processedSolution = propagationResults->getEquationsOfMotionNumericalSolution( );
+                    BOOST_CHECK_EQUAL( rawSolution.size( ), processedSolution.size( ) );
+
+                    if( propagatorTypes.at( i ) == cowell )
+                    {
+                        // Check that Cowell solution is not stored twice
+                        BOOST_CHECK_EQUAL( &rawSolution, &processedSolution );
+                        cowellSolution = processedSolution;
+                    }
+                    else
+                    {
+                        // Check that each converted state is identical to direct conversion of propagated state
+                        BOOST_CHECK( &rawSolution != &processedSolution );
+                        auto processedIterator = processedSolution.begin( );
+                        for( auto rawIterator : rawSolution )
+                        {
+                            BOOST_CHECK_EQUAL( rawIterator.first, processedIterator->first );
+                            Eigen::VectorXd directlyConvertedState =
+                                    dynamicsSimulator.getDynamicsStateDerivative( )->convertToOutputSolution(
+                                        rawIterator.second, rawIterator.first );
+                            for( int j = 0; j < 6; j++ )
+                            {
+                                BOOST_CHECK_EQUAL( directlyConvertedState( j ), processedIterator->second( j ) );
+                            }
+                            processedIterator++;
+                        }
+
+                        // Check that converted solution is consistent with Cowell solution
+                        Eigen::VectorXd stateDifference = processedSolution.rbegin( )->second - cowellSolution.rbegin( )->second;
+                        BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 1.0E-3 );
+                        BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 1.0E-6 );
+                    }
+                }
+            }
+
+//! Unit test to check if the converted solution is used when setting the integrated results in the environment
+            BOOST_AUTO_TEST_CASE( test_OutputSolutionConversionWithIntegratedResultSetting )
+            {
+                // Create Earth with central gravity field, and vehicle with (empty) tabulated ephemeris
+                double earthGravitationalParameter = 3.986004418E14;
+                BodyListSettings bodySettings = BodyListSettings( "Earth", "ECLIPJ2000" );
+                bodySettings.addSettings( "Earth" );
+                bodySettings.at( "Earth" )->ephemerisSettings = constantEphemerisSettings(
+                        Eigen::Vector6d::Zero( ), "Earth", "ECLIPJ2000" );
+                bodySettings.at( "Earth" )->gravityFieldSettings = centralGravitySettings( earthGravitationalParameter );
+                SystemOfBodies bodies = createSystemOfBodies( bodySettings );
+                bodies.createEmptyBody( "Vehicle" );
+                addEmptyTabulatedEphemeris< double, double >( bodies, "Vehicle", "Earth" );
+
+                SelectedAccelerationMap accelerationMap;
+                accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >(
+                        basic_astrodynamics::point_mass_gravity ) );
+                std::vector< std::string > bodiesToIntegrate = { "Vehicle" };
+                std::vector< std::string > centralBodies = { "Earth" };
+                AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                        bodies, accelerationMap, bodiesToIntegrate, centralBodies );
+
+                Eigen::Vector6d initialKeplerElements;
+                initialKeplerElements << 8000.0E3, 0.1, 0.4, 1.0, 2.0, 3.0;
+                Eigen::Vector6d systemInitialState = convertKeplerianToCartesianElements(
+                        initialKeplerElements, earthGravitationalParameter );
+
+                std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+                        std::make_shared< RungeKuttaFixedStepSizeSettings< double > >(
+                                10.0, CoefficientSets::rungeKuttaFehlberg78 );
+
+                std::vector< TranslationalPropagatorType > propagatorTypes = { cowell, gauss_keplerian };
+                for( unsigned int i = 0; i < propagatorTypes.size( ); i++ )
+                {
+                    bodies.at( "Earth" )->getGravityFieldModel( )->resetGravitationalParameter( earthGravitationalParameter );
+
+                    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                                    centralBodies, accelerationModelMap, bodiesToIntegrate, systemInitialState, 0.0,
+                                    integratorSettings, std::make_shared< PropagationTimeTerminationSettings >( 3600.0 ),
+                                    propagatorTypes.at( i ) );
+                    propagatorSettings->getOutputSettings( )->setIntegratedResult( true );
+                    SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+
+                    // Modify environment after propagation, which should not influence the converted solution
+                    bodies.at( "Earth" )->getGravityFieldModel( )->resetGravitationalParameter( 2.0 * earthGravitationalParameter );
+
+                    // Check that solution retrieved from simulator is identical to solution retrieved from results
+                    const std::map< double, Eigen::VectorXd >& simulatorSolution =
+                            dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+                    const std::map< double, Eigen::VectorXd >& processedSolution =
+                            dynamicsSimulator.getSingleArcPropagationResults( )->getEquationsOfMotionNumericalSolution( );
+                    BOOST_CHECK_EQUAL( simulatorSolution.size( ), 361 );
+                    BOOST_CHECK_EQUAL( &simulatorSolution, &processedSolution );
+
+                    // Check that propagated orbit is (close to) the unperturbed Kepler orbit, converted with original
+                    // gravitational parameter
+                    Eigen::Vector6d finalKeplerElements = convertCartesianToKeplerianElements(
+                                Eigen::Vector6d( simulatorSolution.rbegin( )->second ), earthGravitationalParameter );
+                    BOOST_CHECK_SMALL( std::fabs( finalKeplerElements( 0 ) - initialKeplerElements( 0 ) ), 1.0E-3 );
+
+                    // Check that vehicle ephemeris has been reset with converted solution
+                    for( auto stateIterator : simulatorSolution )
+                    {
+                        if( stateIterator.first > 100.0 && stateIterator.first < 3500.0 )
+                        {
+                            Eigen::Vector6d ephemerisState =
+                                    bodies.at( "Vehicle" )->getEphemeris( )->getCartesianState( stateIterator.first );
+                            for( int j = 0; j < 3; j++ )
+                            {
+                                BOOST_CHECK_SMALL( std::fabs( ephemerisState( j ) - stateIterator.second( j ) ), 1.0E-6 );
+                                BOOST_CHECK_SMALL( std::fabs( ephemerisState( j + 3 ) - stateIterator.second( j + 3 ) ), 1.0E-9 );
+                            }
+                        }
+                    }
+                }
+            }
+
         BOOST_AUTO_TEST_SUITE_END( )
 
     }
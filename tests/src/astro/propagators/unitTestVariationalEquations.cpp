@@ -11,6 +11,7 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <algorithm>
 #include <string>
 #include <thread>
 
@@ -345,7 +346,8 @@ executeOrbiterSimulation(
         const Eigen::Matrix< StateScalarType, 6, 1 > initialStateDifference =
         Eigen::Matrix< StateScalarType, 6, 1 >::Zero( ),
         const Eigen::VectorXd parameterPerturbation = Eigen::VectorXd::Zero( 10 ),
-        const bool propagateVariationalEquations = 1 )
+        const bool propagateVariationalEquations = 1,
+        const std::vector< int >& propagatedColumns = std::vector< int >( ) )
 {
     int numberOfParametersToEstimate = 10;
 
@@ -483,6 +485,7 @@ executeOrbiterSimulation(
                 SingleArcVariationalEquationsSolver< StateScalarType, TimeType >(
                     bodies, integratorSettings, propagatorSettings, parametersToEstimate,
                     1, std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ), 0, 0 );
+        dynamicsSimulator.getVariationalEquationsObject( )->setPropagatedColumns( propagatedColumns );
 
         // Propagate requested equations.
         if( propagateVariationalEquations )
@@ -603,6 +606,50 @@ BOOST_AUTO_TEST_CASE( testEarthOrbiterVariationalEquationCalculation )
 
 }
 
+//! Test propagation of a subset of the columns of the state transition and sensitivity matrices, against full propagation
+BOOST_AUTO_TEST_CASE( testPartialColumnVariationalEquationCalculation )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Compute full state transition and sensitivity matrices
+    Eigen::MatrixXd fullMatrix = executeOrbiterSimulation< double, double >( ).first.at( 0 );
+
+    // Compute matrices with subset of columns (two state transition matrix columns, and consider-type parameter columns)
+    std::vector< int > propagatedColumns = { 1, 4, 7, 8, 11, 12, 13 };
+    Eigen::MatrixXd partialMatrix = executeOrbiterSimulation< double, double >(
+                Eigen::Matrix< double, 6, 1 >::Zero( ), Eigen::VectorXd::Zero( 10 ), 1, propagatedColumns ).first.at( 0 );
+
+    for( int i = 0; i < fullMatrix.cols( ); i++ )
+    {
+        if( std::find( propagatedColumns.begin( ), propagatedColumns.end( ), i ) != propagatedColumns.end( ) )
+        {
+            // Check that propagated columns are equal to those from full propagation
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        partialMatrix.block( 0, i, 6, 1 ), fullMatrix.block( 0, i, 6, 1 ), 1.0E-10 );
+        }
+        else
+        {
+            // Check that other columns retain their initial values
+            Eigen::VectorXd expectedColumn = Eigen::VectorXd::Zero( 6 );
+            if( i < 6 )
+            {
+                expectedColumn( i ) = 1.0;
+            }
+            for( int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( partialMatrix( j, i ) - expectedColumn( j ) ), 1.0E-12 );
+            }
+        }
+    }
+
+    // Check invalid column input
+    std::vector< int > invalidPropagatedColumns = { 16 };
+    BOOST_CHECK_THROW( ( executeOrbiterSimulation< double, double >(
+                             Eigen::Matrix< double, 6, 1 >::Zero( ), Eigen::VectorXd::Zero( 10 ), 1, invalidPropagatedColumns ) ),
+                       std::runtime_error );
+}
+
 template< typename TimeType = double , typename StateScalarType  = double >
 std::pair< std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > >,
 std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >
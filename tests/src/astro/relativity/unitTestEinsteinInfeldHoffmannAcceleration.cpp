@@ -0,0 +1,509 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/astro/relativity/einsteinInfeldHoffmannAcceleration.h"
+#include "tudat/astro/relativity/relativisticAccelerationCorrection.h"
+#include "tudat/astro/orbit_determination/acceleration_partials/einsteinInfeldHoffmannPartial.h"
+#include "tudat/simulation/simulation.h"
+#include "tudat/simulation/estimation.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::relativity;
+
+BOOST_AUTO_TEST_SUITE( test_einstein_infeld_hoffmann_acceleration )
+
+//! Function to check whether two matrices are equal, to within a tolerance relative to the largest entry
+void checkMatricesClose( const Eigen::MatrixXd& computedMatrix, const Eigen::MatrixXd& expectedMatrix,
+                         const double tolerance )
+{
+    BOOST_CHECK_EQUAL( computedMatrix.rows( ), expectedMatrix.rows( ) );
+    BOOST_CHECK_EQUAL( computedMatrix.cols( ), expectedMatrix.cols( ) );
+    double maximumDifference = ( computedMatrix - expectedMatrix ).cwiseAbs( ).maxCoeff( );
+    BOOST_CHECK_SMALL( maximumDifference, tolerance * expectedMatrix.cwiseAbs( ).maxCoeff( ) );
+}
+
+//! Test whether EIH equations reduce to Newtonian and Schwarzschild terms for a test particle orbiting a static body
+BOOST_AUTO_TEST_CASE( testEinsteinInfeldHoffmannSchwarzschildLimit )
+{
+    double ppnParameterGamma = 0.8;
+    double ppnParameterBeta = 1.3;
+    double gravitationalParameter = 3.986004418E14;
+
+    Eigen::Vector6d centralBodyState = Eigen::Vector6d::Zero( );
+    centralBodyState.segment( 0, 3 ) << 1.0E9, -2.0E9, 3.0E8;
+    Eigen::Vector6d testParticleState = centralBodyState;
+    testParticleState += ( Eigen::Vector6d( ) << 5.0E6, 4.0E6, -3.0E5, -4.0E3, 3.5E3, 1.0E3 ).finished( );
+
+    std::shared_ptr< EinsteinInfeldHoffmannEquations > eihEquations =
+            std::make_shared< EinsteinInfeldHoffmannEquations >(
+                std::vector< std::string >( { "Earth", "Satellite" } ),
+                std::vector< std::function< double( ) > >(
+                    { [ = ]( ){ return gravitationalParameter; }, [ ]( ){ return 0.0; } } ),
+                std::vector< std::function< Eigen::Vector6d( ) > >(
+                    { [ = ]( ){ return centralBodyState; }, [ = ]( ){ return testParticleState; } } ),
+                [ = ]( ){ return ppnParameterGamma; }, [ = ]( ){ return ppnParameterBeta; } );
+
+    EinsteinInfeldHoffmannAcceleration eihAcceleration( eihEquations, "Satellite", "Earth" );
+    eihAcceleration.updateMembers( 0.0 );
+    Eigen::Vector3d computedAcceleration = eihAcceleration.getAcceleration( );
+
+    Eigen::Vector6d relativeState = testParticleState - centralBodyState;
+    Eigen::Vector3d expectedAcceleration =
+            -gravitationalParameter * relativeState.segment( 0, 3 ) / std::pow( relativeState.segment( 0, 3 ).norm( ), 3 ) +
+            calculateScharzschildGravitationalAccelerationCorrection(
+                gravitationalParameter, relativeState, ppnParameterGamma, ppnParameterBeta );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( computedAcceleration, expectedAcceleration, 1.0E-15 );
+
+    // Check relativistic part separately
+    Eigen::Vector3d computedCorrection = computedAcceleration - eihEquations->getNewtonianAcceleration( 1 );
+    Eigen::Vector3d expectedCorrection = calculateScharzschildGravitationalAccelerationCorrection(
+                gravitationalParameter, relativeState, ppnParameterGamma, ppnParameterBeta );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( computedCorrection, expectedCorrection, 1.0E-6 );
+
+    // Check that massless body exerts no acceleration, and that body can not accelerate itself
+    Eigen::Vector3d centralBodyAcceleration = eihEquations->getTotalAcceleration( 0 );
+    BOOST_CHECK_EQUAL( centralBodyAcceleration.norm( ), 0.0 );
+    BOOST_CHECK_THROW( EinsteinInfeldHoffmannAcceleration( eihEquations, "Earth", "Earth" ), std::runtime_error );
+    BOOST_CHECK_THROW( EinsteinInfeldHoffmannAcceleration( eihEquations, "Moon", "Earth" ), std::runtime_error );
+}
+
+//! Test analytical partials of EIH accelerations against numerical partials, in a (fictitious) strong-field N-body system
+BOOST_AUTO_TEST_CASE( testEinsteinInfeldHoffmannPartials )
+{
+    // Define system for which 1PN terms are of order 1E-2 of Newtonian terms, so that errors in 1PN partials are detected
+    int numberOfBodies = 4;
+    std::vector< std::string > bodyNames = { "Body0", "Body1", "Body2", "Body3" };
+    Eigen::VectorXd gravitationalParameters = ( Eigen::VectorXd( 4 ) << 2.0E22, 5.0E21, 1.0E21, 3.0E20 ).finished( );
+    std::vector< Eigen::Vector6d > bodyStates( numberOfBodies );
+    bodyStates[ 0 ] << 1.0E6, -2.0E6, 5.0E5, 1.0E6, -3.0E6, 2.0E6;
+    bodyStates[ 1 ] << 2.1E7, 3.0E6, -4.0E6, -5.0E6, 2.5E7, 3.0E6;
+    bodyStates[ 2 ] << -1.5E7, 1.2E7, 6.0E6, 1.5E7, 1.0E7, -1.2E7;
+    bodyStates[ 3 ] << 4.0E6, -2.4E7, -1.0E7, 2.2E7, 4.0E6, 5.0E6;
+    double ppnParameterGamma = 1.1;
+    double ppnParameterBeta = 0.9;
+
+    int numberOfStateFunctionEvaluations = 0;
+    std::vector< std::function< double( ) > > gravitationalParameterFunctions;
+    std::vector< std::function< Eigen::Vector6d( ) > > stateFunctions;
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        gravitationalParameterFunctions.push_back( [ &, i ]( ){ return gravitationalParameters( i ); } );
+        stateFunctions.push_back( [ &, i ]( ){ numberOfStateFunctionEvaluations++; return bodyStates[ i ]; } );
+    }
+    std::shared_ptr< EinsteinInfeldHoffmannEquations > eihEquations =
+            std::make_shared< EinsteinInfeldHoffmannEquations >(
+                bodyNames, gravitationalParameterFunctions, stateFunctions,
+                [ & ]( ){ return ppnParameterGamma; }, [ & ]( ){ return ppnParameterBeta; } );
+
+    // Create acceleration models and partials for all pairs
+    std::vector< std::shared_ptr< EinsteinInfeldHoffmannAcceleration > > accelerationModels;
+    std::vector< std::shared_ptr< acceleration_partials::EinsteinInfeldHoffmannPartial > > accelerationPartials;
+    std::vector< std::pair< int, int > > bodyPairs;
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        for( int j = 0; j < numberOfBodies; j++ )
+        {
+            if( i != j )
+            {
+                accelerationModels.push_back( std::make_shared< EinsteinInfeldHoffmannAcceleration >(
+                                                  eihEquations, bodyNames.at( i ), bodyNames.at( j ) ) );
+                accelerationPartials.push_back( std::make_shared< acceleration_partials::EinsteinInfeldHoffmannPartial >(
+                                                    accelerationModels.back( ), bodyNames.at( i ), bodyNames.at( j ) ) );
+                bodyPairs.push_back( std::make_pair( i, j ) );
+            }
+        }
+    }
+
+    // Function to compute all acceleration contributions (after resetting models)
+    auto computeAccelerations = [ & ]( )
+    {
+        Eigen::MatrixXd accelerations = Eigen::MatrixXd::Zero( 3, accelerationModels.size( ) );
+        for( unsigned int k = 0; k < accelerationModels.size( ); k++ )
+        {
+            accelerationModels.at( k )->resetCurrentTime( );
+        }
+        for( unsigned int k = 0; k < accelerationModels.size( ); k++ )
+        {
+            accelerationModels.at( k )->updateMembers( 0.0 );
+            accelerations.col( k ) = accelerationModels.at( k )->getAcceleration( );
+        }
+        return accelerations;
+    };
+
+    // Check that states are retrieved only once for all acceleration models, and that contributions sum to total
+    Eigen::MatrixXd nominalAccelerations = computeAccelerations( );
+    BOOST_CHECK_EQUAL( numberOfStateFunctionEvaluations, numberOfBodies );
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        Eigen::Vector3d summedAcceleration = Eigen::Vector3d::Zero( );
+        for( unsigned int k = 0; k < bodyPairs.size( ); k++ )
+        {
+            if( bodyPairs.at( k ).first == i )
+            {
+                summedAcceleration += nominalAccelerations.col( k );
+            }
+        }
+        Eigen::Vector3d totalAcceleration = eihEquations->getTotalAcceleration( i );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( summedAcceleration, totalAcceleration, 1.0E-14 );
+
+        // Check that 1PN terms are sufficiently large for test to be meaningful
+        Eigen::Vector3d newtonianAcceleration = eihEquations->getNewtonianAcceleration( i );
+        BOOST_CHECK( ( totalAcceleration - newtonianAcceleration ).norm( ) > 1.0E-3 * newtonianAcceleration.norm( ) );
+    }
+
+    // Compute analytical partials
+    for( unsigned int k = 0; k < accelerationPartials.size( ); k++ )
+    {
+        accelerationPartials.at( k )->resetCurrentTime( );
+        accelerationPartials.at( k )->update( 0.0 );
+    }
+
+    // Compute numerical partials w.r.t. states, and compare with analytical partials
+    for( int m = 0; m < numberOfBodies; m++ )
+    {
+        std::vector< Eigen::MatrixXd > numericalStatePartials( bodyPairs.size( ), Eigen::MatrixXd::Zero( 3, 6 ) );
+        for( int l = 0; l < 6; l++ )
+        {
+            double perturbation = ( l < 3 ) ? 100.0 : 1.0E3;
+            Eigen::Vector6d nominalState = bodyStates[ m ];
+            bodyStates[ m ]( l ) += perturbation;
+            Eigen::MatrixXd upperAccelerations = computeAccelerations( );
+            bodyStates[ m ]( l ) -= 2.0 * perturbation;
+            Eigen::MatrixXd lowerAccelerations = computeAccelerations( );
+            bodyStates[ m ] = nominalState;
+
+            for( unsigned int k = 0; k < bodyPairs.size( ); k++ )
+            {
+                numericalStatePartials[ k ].col( l ) =
+                        ( upperAccelerations.col( k ) - lowerAccelerations.col( k ) ) / ( 2.0 * perturbation );
+            }
+        }
+
+        for( unsigned int k = 0; k < bodyPairs.size( ); k++ )
+        {
+            std::pair< std::string, std::string > stateReferencePoint = std::make_pair( bodyNames.at( m ), "" );
+            BOOST_CHECK_EQUAL( accelerationPartials.at( k )->isStateDerivativeDependentOnIntegratedState(
+                                   stateReferencePoint, propagators::translational_state ), true );
+
+            Eigen::MatrixXd analyticalStatePartial = Eigen::MatrixXd::Zero( 3, 6 );
+            accelerationPartials.at( k )->getDerivativeFunctionWrtStateOfIntegratedBody(
+                        stateReferencePoint, propagators::translational_state ).first(
+                        analyticalStatePartial.block( 0, 0, 3, 6 ) );
+
+            Eigen::MatrixXd analyticalPositionPartial = analyticalStatePartial.block( 0, 0, 3, 3 );
+            Eigen::MatrixXd numericalPositionPartial = numericalStatePartials[ k ].block( 0, 0, 3, 3 );
+            checkMatricesClose( analyticalPositionPartial, numericalPositionPartial, 1.0E-7 );
+
+            Eigen::MatrixXd analyticalVelocityPartial = analyticalStatePartial.block( 0, 3, 3, 3 );
+            Eigen::MatrixXd numericalVelocityPartial = numericalStatePartials[ k ].block( 0, 3, 3, 3 );
+            if( m == bodyPairs.at( k ).first || m == bodyPairs.at( k ).second )
+            {
+                checkMatricesClose( analyticalVelocityPartial, numericalVelocityPartial, 1.0E-7 );
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL( analyticalVelocityPartial.cwiseAbs( ).maxCoeff( ), 0.0 );
+                BOOST_CHECK_SMALL( numericalVelocityPartial.cwiseAbs( ).maxCoeff( ),
+                                   1.0E-12 * nominalAccelerations.col( k ).norm( ) );
+            }
+        }
+    }
+
+    // Compute numerical partials w.r.t. gravitational parameters, and compare with analytical partials
+    for( int m = 0; m < numberOfBodies; m++ )
+    {
+        double perturbation = gravitationalParameters( m ) * 1.0E-4;
+        gravitationalParameters( m ) += perturbation;
+        Eigen::MatrixXd upperAccelerations = computeAccelerations( );
+        gravitationalParameters( m ) -= 2.0 * perturbation;
+        Eigen::MatrixXd lowerAccelerations = computeAccelerations( );
+        gravitationalParameters( m ) += perturbation;
+
+        for( unsigned int k = 0; k < bodyPairs.size( ); k++ )
+        {
+            Eigen::MatrixXd analyticalPartial;
+            accelerationPartials.at( k )->wrtGravitationalParameter( analyticalPartial, m );
+            Eigen::MatrixXd numericalPartial =
+                    ( upperAccelerations.col( k ) - lowerAccelerations.col( k ) ) / ( 2.0 * perturbation );
+            if( analyticalPartial.norm( ) == 0.0 )
+            {
+                BOOST_CHECK_SMALL( numericalPartial.norm( ), 1.0E-14 );
+            }
+            else
+            {
+                checkMatricesClose( analyticalPartial, numericalPartial, 1.0E-6 );
+            }
+        }
+    }
+
+    // Compute numerical partials w.r.t. PPN parameters (linear dependency), and compare with analytical partials
+    for( unsigned int parameter = 0; parameter < 2; parameter++ )
+    {
+        double& ppnParameter = ( parameter == 0 ) ? ppnParameterGamma : ppnParameterBeta;
+        double perturbation = 0.1;
+        ppnParameter += perturbation;
+        Eigen::MatrixXd upperAccelerations = computeAccelerations( );
+        ppnParameter -= 2.0 * perturbation;
+        Eigen::MatrixXd lowerAccelerations = computeAccelerations( );
+        ppnParameter += perturbation;
+
+        for( unsigned int k = 0; k < bodyPairs.size( ); k++ )
+        {
+            Eigen::MatrixXd analyticalPartial;
+            if( parameter == 0 )
+            {
+                accelerationPartials.at( k )->wrtPpnParameterGamma( analyticalPartial );
+            }
+            else
+            {
+                accelerationPartials.at( k )->wrtPpnParameterBeta( analyticalPartial );
+            }
+            Eigen::MatrixXd numericalPartial =
+                    ( upperAccelerations.col( k ) - lowerAccelerations.col( k ) ) / ( 2.0 * perturbation );
+            checkMatricesClose( analyticalPartial, numericalPartial, 1.0E-6 );
+        }
+    }
+}
+
+//! Test EIH accelerations, environment updates and partials created from settings, against directly created EIH equations
+BOOST_AUTO_TEST_CASE( testEinsteinInfeldHoffmannFromSettings )
+{
+    using namespace tudat::simulation_setup;
+    using namespace tudat::propagators;
+    using namespace tudat::numerical_integrators;
+
+    // Create star with constant state, and two planets that are to be propagated
+    std::vector< std::string > bodyNames = { "Star", "PlanetA", "PlanetB" };
+    std::vector< double > gravitationalParameters = { 1.0E20, 1.0E17, 5.0E16 };
+    Eigen::Vector6d starState = ( Eigen::Vector6d( ) << 1.0E9, -2.0E9, 5.0E8, 0.0, 0.0, 0.0 ).finished( );
+
+    SystemOfBodies bodies = SystemOfBodies( "SSB", "ECLIPJ2000" );
+    for( unsigned int i = 0; i < bodyNames.size( ); i++ )
+    {
+        bodies.createEmptyBody( bodyNames.at( i ) );
+        bodies.at( bodyNames.at( i ) )->setGravityFieldModel(
+                    std::make_shared< gravitation::GravityFieldModel >( gravitationalParameters.at( i ) ) );
+    }
+    bodies.at( "Star" )->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                           starState, "SSB", "ECLIPJ2000" ) );
+
+    // Define EIH accelerations between all bodies, for the propagated planets
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "PlanetA" ][ "Star" ].push_back( einsteinInfeldHoffmannAcceleration( ) );
+    accelerationSettingsMap[ "PlanetA" ][ "PlanetB" ].push_back( einsteinInfeldHoffmannAcceleration( ) );
+    accelerationSettingsMap[ "PlanetB" ][ "Star" ].push_back( einsteinInfeldHoffmannAcceleration( ) );
+    accelerationSettingsMap[ "PlanetB" ][ "PlanetA" ].push_back( einsteinInfeldHoffmannAcceleration( ) );
+    std::vector< std::string > bodiesToPropagate = { "PlanetA", "PlanetB" };
+
+    // Check that a single set of EIH equations is created, including the non-propagated star
+    std::shared_ptr< EinsteinInfeldHoffmannEquations > eihEquationsFromSettings = createEinsteinInfeldHoffmannEquations(
+                bodies, orderSelectedAccelerationMap( accelerationSettingsMap ) );
+    BOOST_CHECK( eihEquationsFromSettings != nullptr );
+    std::vector< std::string > eihBodyNames = eihEquationsFromSettings->getBodyNames( );
+    BOOST_CHECK_EQUAL( eihBodyNames.size( ), bodyNames.size( ) );
+    for( unsigned int i = 0; i < bodyNames.size( ); i++ )
+    {
+        BOOST_CHECK( std::find( eihBodyNames.begin( ), eihBodyNames.end( ), bodyNames.at( i ) ) != eihBodyNames.end( ) );
+    }
+
+    // Check that EIH accelerations can only be created w.r.t. an inertial origin
+    BOOST_CHECK_THROW( createAccelerationModelsMap(
+                           bodies, accelerationSettingsMap, bodiesToPropagate, { "Star", "Star" } ), std::runtime_error );
+
+    // Create acceleration models, and check that they share a single set of EIH equations
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodies, accelerationSettingsMap, bodiesToPropagate, { "SSB", "SSB" } );
+    std::shared_ptr< EinsteinInfeldHoffmannEquations > sharedEihEquations;
+    for( auto accelerationIterator : accelerationModelMap )
+    {
+        BOOST_CHECK_EQUAL( accelerationIterator.second.size( ), 2u );
+        for( auto singleBodyIterator : accelerationIterator.second )
+        {
+            BOOST_CHECK_EQUAL( singleBodyIterator.second.size( ), 1u );
+            std::shared_ptr< EinsteinInfeldHoffmannAcceleration > eihAcceleration =
+                    std::dynamic_pointer_cast< EinsteinInfeldHoffmannAcceleration >( singleBodyIterator.second.at( 0 ) );
+            BOOST_CHECK( eihAcceleration != nullptr );
+            BOOST_CHECK_EQUAL( basic_astrodynamics::getAccelerationModelType( eihAcceleration ),
+                               basic_astrodynamics::einstein_infeld_hoffmann_acceleration );
+            if( sharedEihEquations == nullptr )
+            {
+                sharedEihEquations = eihAcceleration->getEihEquations( );
+            }
+            BOOST_CHECK( eihAcceleration->getEihEquations( ) == sharedEihEquations );
+        }
+    }
+
+    // Check that state of (only) the non-propagated star is updated by the environment
+    std::map< EnvironmentModelsToUpdate, std::vector< std::string > > environmentUpdateSettings =
+            createTranslationalEquationsOfMotionEnvironmentUpdaterSettings( accelerationModelMap, bodies );
+    BOOST_CHECK_EQUAL( environmentUpdateSettings.count( body_translational_state_update ), 1u );
+    std::vector< std::string > bodiesToUpdate = environmentUpdateSettings.at( body_translational_state_update );
+    BOOST_CHECK( std::find( bodiesToUpdate.begin( ), bodiesToUpdate.end( ), "Star" ) != bodiesToUpdate.end( ) );
+    BOOST_CHECK( std::find( bodiesToUpdate.begin( ), bodiesToUpdate.end( ), "PlanetA" ) == bodiesToUpdate.end( ) );
+    BOOST_CHECK( std::find( bodiesToUpdate.begin( ), bodiesToUpdate.end( ), "PlanetB" ) == bodiesToUpdate.end( ) );
+
+    // Define initial states of planets (near-circular orbits about star)
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 12 );
+    initialState.segment( 0, 6 ) = starState + ( Eigen::Vector6d( ) << 1.5E10, 0.0, 1.0E8, 0.0, 8.2E4, 1.0E3 ).finished( );
+    initialState.segment( 6, 6 ) = starState + ( Eigen::Vector6d( ) << 0.0, -3.0E10, 0.0, 5.8E4, 0.0, -2.0E3 ).finished( );
+
+    // Propagate planets
+    double initialTime = 0.0;
+    double finalTime = 86400.0;
+    double timeStep = 600.0;
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            translationalStatePropagatorSettings< double >(
+                { "SSB", "SSB" }, accelerationModelMap, bodiesToPropagate, initialState, initialTime,
+                rungeKutta4Settings< double >( timeStep ), propagationTimeTerminationSettings( finalTime ) );
+    SingleArcDynamicsSimulator< > dynamicsSimulator( bodies, propagatorSettings );
+    std::map< double, Eigen::VectorXd > stateHistory = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+    // Create EIH equations and accelerations directly, with body states set independently of environment
+    std::vector< Eigen::Vector6d > bodyStates = { starState, Eigen::Vector6d::Zero( ), Eigen::Vector6d::Zero( ) };
+    std::vector< std::function< double( ) > > gravitationalParameterFunctions;
+    std::vector< std::function< Eigen::Vector6d( ) > > stateFunctions;
+    for( unsigned int i = 0; i < bodyNames.size( ); i++ )
+    {
+        gravitationalParameterFunctions.push_back( [ &, i ]( ){ return gravitationalParameters.at( i ); } );
+        stateFunctions.push_back( [ &, i ]( ){ return bodyStates.at( i ); } );
+    }
+    std::shared_ptr< EinsteinInfeldHoffmannEquations > directEihEquations =
+            std::make_shared< EinsteinInfeldHoffmannEquations >(
+                bodyNames, gravitationalParameterFunctions, stateFunctions,
+                [ ]( ){ return relativity::ppnParameterSet->getParameterGamma( ); },
+                [ ]( ){ return relativity::ppnParameterSet->getParameterBeta( ); } );
+    std::vector< std::vector< std::shared_ptr< EinsteinInfeldHoffmannAcceleration > > > directAccelerations( 2 );
+    for( unsigned int i = 0; i < bodiesToPropagate.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < bodyNames.size( ); j++ )
+        {
+            if( bodyNames.at( j ) != bodiesToPropagate.at( i ) )
+            {
+                directAccelerations[ i ].push_back( std::make_shared< EinsteinInfeldHoffmannAcceleration >(
+                                                        directEihEquations, bodiesToPropagate.at( i ), bodyNames.at( j ) ) );
+            }
+        }
+    }
+
+    // Propagate planets with directly created EIH equations, using same (RK4) integration scheme
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state )
+    {
+        bodyStates[ 1 ] = state.segment( 0, 6 );
+        bodyStates[ 2 ] = state.segment( 6, 6 );
+        Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 12 );
+        for( unsigned int i = 0; i < directAccelerations.size( ); i++ )
+        {
+            stateDerivative.segment( 6 * i, 3 ) = state.segment( 6 * i + 3, 3 );
+            for( unsigned int j = 0; j < directAccelerations.at( i ).size( ); j++ )
+            {
+                directAccelerations.at( i ).at( j )->resetCurrentTime( );
+                directAccelerations.at( i ).at( j )->updateMembers( time );
+                stateDerivative.segment( 6 * i + 3, 3 ) += directAccelerations.at( i ).at( j )->getAcceleration( );
+            }
+        }
+        return stateDerivative;
+    };
+    Eigen::VectorXd directState = initialState;
+    double currentTime = initialTime;
+    while( currentTime < finalTime - 0.5 * timeStep )
+    {
+        Eigen::VectorXd k1 = stateDerivativeFunction( currentTime, directState );
+        Eigen::VectorXd k2 = stateDerivativeFunction( currentTime + 0.5 * timeStep, directState + 0.5 * timeStep * k1 );
+        Eigen::VectorXd k3 = stateDerivativeFunction( currentTime + 0.5 * timeStep, directState + 0.5 * timeStep * k2 );
+        Eigen::VectorXd k4 = stateDerivativeFunction( currentTime + timeStep, directState + timeStep * k3 );
+        directState += timeStep / 6.0 * ( k1 + 2.0 * k2 + 2.0 * k3 + k4 );
+        currentTime += timeStep;
+
+        // Compare propagated states
+        Eigen::VectorXd propagatedState = stateHistory.at( currentTime );
+        for( int i = 0; i < 4; i++ )
+        {
+            Eigen::Vector3d propagatedVector = propagatedState.segment( 3 * i, 3 );
+            Eigen::Vector3d directVector = directState.segment( 3 * i, 3 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( propagatedVector, directVector, 1.0E-12 );
+        }
+    }
+
+    // Check that star has been moved by the environment update, and set planets to final states
+    Eigen::Vector6d currentStarState = bodies.at( "Star" )->getState( );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( currentStarState, starState, std::numeric_limits< double >::epsilon( ) );
+    bodies.at( "PlanetA" )->setState( directState.segment( 0, 6 ) );
+    bodies.at( "PlanetB" )->setState( directState.segment( 6, 6 ) );
+    bodyStates[ 1 ] = directState.segment( 0, 6 );
+    bodyStates[ 2 ] = directState.segment( 6, 6 );
+
+    // Create partials from acceleration models, and compare with partials of directly created models
+    std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parameterSet =
+            createParametersToEstimate< double >(
+                std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSettings > >( ), bodies );
+    for( unsigned int i = 0; i < bodiesToPropagate.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < directAccelerations.at( i ).size( ); j++ )
+        {
+            std::string acceleratingBody = bodyNames.at( directAccelerations.at( i ).at( j )->getAcceleratingBodyIndex( ) );
+            std::shared_ptr< basic_astrodynamics::AccelerationModel3d > accelerationFromSettings =
+                    accelerationModelMap.at( bodiesToPropagate.at( i ) ).at( acceleratingBody ).at( 0 );
+            std::shared_ptr< acceleration_partials::AccelerationPartial > partialFromSettings =
+                    createAnalyticalAccelerationPartial(
+                        accelerationFromSettings, std::make_pair( bodiesToPropagate.at( i ), bodies.at( bodiesToPropagate.at( i ) ) ),
+                        std::make_pair( acceleratingBody, bodies.at( acceleratingBody ) ), bodies, parameterSet );
+            BOOST_CHECK( std::dynamic_pointer_cast< acceleration_partials::EinsteinInfeldHoffmannPartial >(
+                             partialFromSettings ) != nullptr );
+            std::shared_ptr< acceleration_partials::EinsteinInfeldHoffmannPartial > directPartial =
+                    std::make_shared< acceleration_partials::EinsteinInfeldHoffmannPartial >(
+                        directAccelerations.at( i ).at( j ), bodiesToPropagate.at( i ), acceleratingBody );
+
+            accelerationFromSettings->resetCurrentTime( );
+            accelerationFromSettings->updateMembers( finalTime );
+            partialFromSettings->resetCurrentTime( );
+            partialFromSettings->update( finalTime );
+            directAccelerations.at( i ).at( j )->resetCurrentTime( );
+            directAccelerations.at( i ).at( j )->updateMembers( finalTime );
+            directPartial->resetCurrentTime( );
+            directPartial->update( finalTime );
+
+            Eigen::Vector3d accelerationFromSettingsValue = accelerationFromSettings->getAcceleration( );
+            Eigen::Vector3d directAccelerationValue = directAccelerations.at( i ).at( j )->getAcceleration( );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( accelerationFromSettingsValue, directAccelerationValue, 1.0E-14 );
+
+            for( unsigned int k = 0; k < bodyNames.size( ); k++ )
+            {
+                std::pair< std::string, std::string > stateReferencePoint = std::make_pair( bodyNames.at( k ), "" );
+                Eigen::MatrixXd partialFromSettingsValue = Eigen::MatrixXd::Zero( 3, 6 );
+                partialFromSettings->getDerivativeFunctionWrtStateOfIntegratedBody(
+                            stateReferencePoint, translational_state ).first( partialFromSettingsValue.block( 0, 0, 3, 6 ) );
+                Eigen::MatrixXd directPartialValue = Eigen::MatrixXd::Zero( 3, 6 );
+                directPartial->getDerivativeFunctionWrtStateOfIntegratedBody(
+                            stateReferencePoint, translational_state ).first( directPartialValue.block( 0, 0, 3, 6 ) );
+                checkMatricesClose( partialFromSettingsValue, directPartialValue, 1.0E-14 );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
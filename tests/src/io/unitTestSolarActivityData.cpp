@@ -23,6 +23,7 @@
 
 #include <memory>
 #include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
 
 #include <Eigen/Core>
 
@@ -31,6 +32,7 @@
 #include "tudat/io/parseSolarActivityData.h"
 #include "tudat/io/extractSolarActivityData.h"
 #include "tudat/io/solarActivityData.h"
+#include "tudat/io/solarActivityTable.h"
 #include "tudat/io/basicInputOutput.h"
 
 
@@ -174,6 +176,95 @@ BOOST_AUTO_TEST_CASE( test_function_readSolarActivityData )
     }
 }
 
+//! Function to check whether all entries of two solar activity data objects are equal.
+void checkSolarActivityDataEqual( const input_output::solar_activity::SolarActivityData& expectedData,
+                                  const input_output::solar_activity::SolarActivityData& computedData )
+{
+    BOOST_CHECK_EQUAL( expectedData.year, computedData.year );
+    BOOST_CHECK_EQUAL( expectedData.month, computedData.month );
+    BOOST_CHECK_EQUAL( expectedData.day, computedData.day );
+    BOOST_CHECK_EQUAL( expectedData.bartelsSolarRotationNumber, computedData.bartelsSolarRotationNumber );
+    BOOST_CHECK_EQUAL( expectedData.dayOfBartelsCycle, computedData.dayOfBartelsCycle );
+    BOOST_CHECK_EQUAL( expectedData.planetaryRangeIndexSum, computedData.planetaryRangeIndexSum );
+    BOOST_CHECK_EQUAL( expectedData.planetaryEquivalentAmplitudeAverage, computedData.planetaryEquivalentAmplitudeAverage );
+    BOOST_CHECK_EQUAL( expectedData.planetaryDailyCharacterFigure, computedData.planetaryDailyCharacterFigure );
+    BOOST_CHECK_EQUAL( expectedData.planetaryDailyCharacterFigureConverted,
+                       computedData.planetaryDailyCharacterFigureConverted );
+    BOOST_CHECK_EQUAL( expectedData.internationalSunspotNumber, computedData.internationalSunspotNumber );
+    BOOST_CHECK_EQUAL( expectedData.solarRadioFlux107Adjusted, computedData.solarRadioFlux107Adjusted );
+    BOOST_CHECK_EQUAL( expectedData.fluxQualifier, computedData.fluxQualifier );
+    BOOST_CHECK_EQUAL( expectedData.centered81DaySolarRadioFlux107Adjusted,
+                       computedData.centered81DaySolarRadioFlux107Adjusted );
+    BOOST_CHECK_EQUAL( expectedData.last81DaySolarRadioFlux107Adjusted, computedData.last81DaySolarRadioFlux107Adjusted );
+    BOOST_CHECK_EQUAL( expectedData.solarRadioFlux107Observed, computedData.solarRadioFlux107Observed );
+    BOOST_CHECK_EQUAL( expectedData.centered81DaySolarRadioFlux107Observed,
+                       computedData.centered81DaySolarRadioFlux107Observed );
+    BOOST_CHECK_EQUAL( expectedData.last81DaySolarRadioFlux107Observed, computedData.last81DaySolarRadioFlux107Observed );
+    BOOST_CHECK_EQUAL( expectedData.dataType, computedData.dataType );
+    TUDAT_CHECK_MATRIX_CLOSE( expectedData.planetaryRangeIndexVector, computedData.planetaryRangeIndexVector, 0 );
+    TUDAT_CHECK_MATRIX_CLOSE( expectedData.planetaryEquivalentAmplitudeVector,
+                              computedData.planetaryEquivalentAmplitudeVector, 0 );
+}
+
+BOOST_AUTO_TEST_CASE( test_function_readSolarActivityTable )
+{
+    using namespace tudat::input_output::solar_activity;
+
+    for( std::string fileName : { "/testSolarActivity.txt", "/sw19571001.txt" } )
+    {
+        std::string filePath = paths::getTudatTestDataPath( ) + fileName;
+        std::string binaryFilePath = paths::getTudatTestDataPath( ) + "/solarActivityTableTest.bin";
+        boost::filesystem::remove( binaryFilePath );
+
+        // Read file with existing parser, and into table (text file is parsed for first read, binary file for second).
+        SolarActivityDataMap solarActivityMap = readSolarActivityData( filePath );
+        std::shared_ptr< SolarActivityTable > solarActivityTable = readSolarActivityTable( filePath, binaryFilePath );
+        BOOST_CHECK( boost::filesystem::exists( binaryFilePath ) );
+        std::shared_ptr< SolarActivityTable > cachedSolarActivityTable = readSolarActivityTable( filePath, binaryFilePath );
+        boost::filesystem::remove( binaryFilePath );
+
+        BOOST_CHECK_EQUAL( solarActivityTable->getNumberOfDays( ), cachedSolarActivityTable->getNumberOfDays( ) );
+        BOOST_CHECK_EQUAL( solarActivityTable->getFirstJulianDay( ), solarActivityMap.begin( )->first );
+        BOOST_CHECK_EQUAL( solarActivityTable->getLastJulianDay( ), solarActivityMap.rbegin( )->first );
+
+        // Check that all days in file are retrieved identically from both tables, also with day index from arbitrary time.
+        SolarActivityDataMap solarActivityMapFromTable = cachedSolarActivityTable->getSolarActivityDataMap( );
+        BOOST_CHECK_EQUAL( solarActivityMapFromTable.size( ), solarActivityMap.size( ) );
+        for( auto mapIterator : solarActivityMap )
+        {
+            int dayIndex = solarActivityTable->getDayIndex( mapIterator.first + 0.7 );
+            BOOST_CHECK_EQUAL( solarActivityTable->getJulianDay( dayIndex ), mapIterator.first );
+            BOOST_CHECK( solarActivityTable->isDayInFile( dayIndex ) );
+            checkSolarActivityDataEqual( *mapIterator.second, *solarActivityTable->getSolarActivityData( dayIndex ) );
+            checkSolarActivityDataEqual( *mapIterator.second, *solarActivityMapFromTable.at( mapIterator.first ) );
+        }
+
+        // Check that days not in file use data of most recent preceding day, with date of current day.
+        SolarActivityContainer solarActivityContainer( solarActivityMap );
+        for( int dayIndex = 0; dayIndex < solarActivityTable->getNumberOfDays( ); dayIndex += 97 )
+        {
+            double julianDay = solarActivityTable->getJulianDay( dayIndex );
+            SolarActivityData expectedData = *solarActivityContainer.getSolarActivityDataAtJulianDay( julianDay + 0.5 );
+
+            int year, month, day;
+            basic_astrodynamics::convertJulianDayToCalendarDate( julianDay + 0.5, day, month, year );
+            expectedData.year = year;
+            expectedData.month = month;
+            expectedData.day = day;
+
+            checkSolarActivityDataEqual( expectedData, *cachedSolarActivityTable->getSolarActivityData( dayIndex ) );
+            BOOST_CHECK_EQUAL( cachedSolarActivityTable->getDayOfYear( dayIndex ),
+                               julianDay - basic_astrodynamics::convertCalendarDateToJulianDay( year, 1, 1, 0, 0, 0.0 ) + 1 );
+        }
+
+        // Check that retrieving data outside of table throws an exception
+        BOOST_CHECK_THROW( solarActivityTable->getDayIndex( solarActivityTable->getFirstJulianDay( ) - 0.1 ),
+                           std::runtime_error );
+        BOOST_CHECK_THROW( solarActivityTable->getDayIndex( solarActivityTable->getLastJulianDay( ) + 1.1 ),
+                           std::runtime_error );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }   // unit_tests
@@ -0,0 +1,212 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/math/basic/leastSquaresEstimation.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace linear_algebra;
+
+BOOST_AUTO_TEST_SUITE( test_least_squares_estimation )
+
+//! Test arc-wise elimination of local parameters against full least-squares solution
+BOOST_AUTO_TEST_CASE( testArcwiseReducedLeastSquaresAdjustment )
+{
+    // Define problem size: 3 global parameters, and 4 local parameters in each arc
+    int numberOfArcs = 5;
+    int numberOfGlobalParameters = 3;
+    int numberOfLocalParametersPerArc = 4;
+    int numberOfObservationsPerArc = 30;
+    int numberOfParameters = numberOfGlobalParameters + numberOfArcs * numberOfLocalParametersPerArc;
+    int numberOfObservations = numberOfArcs * numberOfObservationsPerArc;
+
+    // Create design matrix, with observations of different arcs interleaved, and local parameters interleaved with global
+    // parameters
+    std::srand( 42 );
+    Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Zero( numberOfObservations, numberOfParameters );
+    std::vector< std::vector< int > > arcObservationIndices( numberOfArcs );
+    std::vector< std::vector< int > > expectedArcLocalParameterIndices( numberOfArcs );
+    std::vector< int > globalParameterIndices = { 0, 7, numberOfParameters - 1 };
+    int currentParameterIndex = 0;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        for( int j = 0; j < numberOfLocalParametersPerArc; j++ )
+        {
+            while( std::find( globalParameterIndices.begin( ), globalParameterIndices.end( ), currentParameterIndex ) !=
+                   globalParameterIndices.end( ) )
+            {
+                currentParameterIndex++;
+            }
+            expectedArcLocalParameterIndices.at( i ).push_back( currentParameterIndex );
+            currentParameterIndex++;
+        }
+
+        for( int k = 0; k < numberOfObservationsPerArc; k++ )
+        {
+            int observationIndex = k * numberOfArcs + i;
+            arcObservationIndices.at( i ).push_back( observationIndex );
+            for( const int parameterIndex : expectedArcLocalParameterIndices.at( i ) )
+            {
+                designMatrix( observationIndex, parameterIndex ) = Eigen::VectorXd::Random( 1 )( 0 );
+            }
+            for( const int parameterIndex : globalParameterIndices )
+            {
+                designMatrix( observationIndex, parameterIndex ) = Eigen::VectorXd::Random( 1 )( 0 );
+            }
+        }
+    }
+
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) +
+            Eigen::VectorXd::Constant( numberOfObservations, 0.5 );
+
+    // Create a priori covariance, with local-global correlation
+    Eigen::MatrixXd inverseAprioriCovariance = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    for( int j = 0; j < numberOfParameters; j++ )
+    {
+        inverseAprioriCovariance( j, j ) = 0.1 * static_cast< double >( j + 1 );
+    }
+    inverseAprioriCovariance( 0, 1 ) = inverseAprioriCovariance( 1, 0 ) = 0.01;
+    inverseAprioriCovariance( 2, 3 ) = inverseAprioriCovariance( 3, 2 ) = 0.02;
+
+    // Check identification of local parameters
+    std::vector< std::vector< int > > arcLocalParameterIndices = getArcLocalParameterIndices(
+                designMatrix, arcObservationIndices, inverseAprioriCovariance );
+    BOOST_CHECK( arcLocalParameterIndices == expectedArcLocalParameterIndices );
+
+    // Compare solution with and without arc-wise reduction
+    for( unsigned int test = 0; test < 3; test++ )
+    {
+        Eigen::MatrixXd currentInverseAprioriCovariance = ( test == 0 ) ? Eigen::MatrixXd( 0, 0 ) : inverseAprioriCovariance;
+        Eigen::MatrixXd considerDesignMatrix = Eigen::MatrixXd( 0, 0 );
+        Eigen::VectorXd considerDeviations = Eigen::VectorXd( 0 );
+        if( test == 2 )
+        {
+            considerDesignMatrix = Eigen::MatrixXd::Random( numberOfObservations, 2 );
+            considerDeviations = Eigen::VectorXd::Random( 2 );
+        }
+
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > fullOutput = performLeastSquaresAdjustmentFromDesignMatrix(
+                    designMatrix, residuals, weights,
+                    ( test == 0 ) ? Eigen::MatrixXd( Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ) ) :
+                                    inverseAprioriCovariance, 1.0E8, Eigen::MatrixXd( 0, 0 ), Eigen::VectorXd( 0 ),
+                    considerDesignMatrix, considerDeviations );
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > reducedOutput = performArcwiseReducedLeastSquaresAdjustment(
+                    designMatrix, residuals, weights, currentInverseAprioriCovariance, arcObservationIndices,
+                    arcLocalParameterIndices, 1.0E8, considerDesignMatrix, considerDeviations );
+
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( reducedOutput.first, fullOutput.first, 1.0E-10 );
+        Eigen::MatrixXd normalMatrixDifference = reducedOutput.second - fullOutput.second;
+        BOOST_CHECK_SMALL( normalMatrixDifference.cwiseAbs( ).maxCoeff( ),
+                           10.0 * std::numeric_limits< double >::epsilon( ) * fullOutput.second.cwiseAbs( ).maxCoeff( ) );
+    }
+
+    // Check that local parameters correlated with other arcs through a priori covariance are set as global
+    inverseAprioriCovariance( expectedArcLocalParameterIndices.at( 1 ).at( 0 ), expectedArcLocalParameterIndices.at( 3 ).at( 2 ) ) = 0.01;
+    arcLocalParameterIndices = getArcLocalParameterIndices(
+                designMatrix, arcObservationIndices, inverseAprioriCovariance );
+    BOOST_CHECK_EQUAL( arcLocalParameterIndices.at( 1 ).size( ), numberOfLocalParametersPerArc - 1 );
+    BOOST_CHECK_EQUAL( arcLocalParameterIndices.at( 3 ).size( ), numberOfLocalParametersPerArc - 1 );
+    BOOST_CHECK_EQUAL( arcLocalParameterIndices.at( 0 ).size( ), numberOfLocalParametersPerArc );
+
+    // Check that parameters observed outside their arc are set as global
+    std::vector< std::vector< int > > incompleteArcObservationIndices = arcObservationIndices;
+    incompleteArcObservationIndices.at( 2 ).pop_back( );
+    arcLocalParameterIndices = getArcLocalParameterIndices( designMatrix, incompleteArcObservationIndices );
+    BOOST_CHECK_EQUAL( arcLocalParameterIndices.at( 2 ).size( ), 0 );
+
+    // Check inconsistent input
+    incompleteArcObservationIndices.at( 2 ).push_back( arcObservationIndices.at( 1 ).at( 0 ) );
+    BOOST_CHECK_THROW( getArcLocalParameterIndices( designMatrix, incompleteArcObservationIndices ), std::runtime_error );
+}
+
+//! Test least-squares solution with tiled normal matrix against full least-squares solution
+BOOST_AUTO_TEST_CASE( testTiledLeastSquaresAdjustment )
+{
+    std::srand( 7 );
+    int numberOfObservations = 250;
+    int numberOfParameters = 37;
+    Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Random( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) +
+            Eigen::VectorXd::Constant( numberOfObservations, 0.5 );
+
+    // Create full a priori covariance
+    Eigen::MatrixXd inverseAprioriCovariance = 0.01 * Eigen::MatrixXd::Random( numberOfParameters, numberOfParameters );
+    inverseAprioriCovariance = ( inverseAprioriCovariance * inverseAprioriCovariance.transpose( ) ).eval( );
+    inverseAprioriCovariance.diagonal( ) += Eigen::VectorXd::LinSpaced( numberOfParameters, 0.1, 1.0 );
+
+    // Check tiled inverse covariance, accumulated from blocks of rows (number of rows not a multiple of block size)
+    TiledSymmetricMatrix tiledInverseCovariance( numberOfParameters, 10 );
+    calculateTiledInverseOfUpdatedCovarianceMatrix(
+                tiledInverseCovariance, designMatrix, weights, inverseAprioriCovariance, 60 );
+    Eigen::MatrixXd inverseCovariance = calculateInverseOfUpdatedCovarianceMatrix(
+                designMatrix, weights, inverseAprioriCovariance );
+    Eigen::MatrixXd inverseCovarianceDifference = tiledInverseCovariance.getDenseMatrix( ) - inverseCovariance;
+    BOOST_CHECK_SMALL( inverseCovarianceDifference.cwiseAbs( ).maxCoeff( ),
+                       1.0E-13 * inverseCovariance.cwiseAbs( ).maxCoeff( ) );
+
+    // Compare solution with and without tiled normal matrix (without/with a priori, with consider parameters, in file)
+    for( unsigned int test = 0; test < 4; test++ )
+    {
+        Eigen::MatrixXd currentInverseAprioriCovariance = ( test == 0 ) ? Eigen::MatrixXd( 0, 0 ) : inverseAprioriCovariance;
+        Eigen::MatrixXd considerDesignMatrix = Eigen::MatrixXd( 0, 0 );
+        Eigen::VectorXd considerDeviations = Eigen::VectorXd( 0 );
+        if( test >= 2 )
+        {
+            considerDesignMatrix = Eigen::MatrixXd::Random( numberOfObservations, 2 );
+            considerDeviations = Eigen::VectorXd::Random( 2 );
+        }
+        std::string storageFile = ( test == 3 ) ? "tiledLeastSquaresTest.dat" : "";
+
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > fullOutput = performLeastSquaresAdjustmentFromDesignMatrix(
+                    designMatrix, residuals, weights,
+                    ( test == 0 ) ? Eigen::MatrixXd( Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ) ) :
+                                    inverseAprioriCovariance, 1.0E8, Eigen::MatrixXd( 0, 0 ), Eigen::VectorXd( 0 ),
+                    considerDesignMatrix, considerDeviations );
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > tiledOutput = performTiledLeastSquaresAdjustment(
+                    designMatrix, residuals, weights, currentInverseAprioriCovariance, 8, storageFile, 2,
+                    considerDesignMatrix, considerDeviations );
+
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( tiledOutput.first, fullOutput.first, 1.0E-10 );
+        Eigen::MatrixXd normalMatrixDifference = tiledOutput.second - fullOutput.second;
+        BOOST_CHECK_SMALL( normalMatrixDifference.cwiseAbs( ).maxCoeff( ),
+                           1.0E-13 * fullOutput.second.cwiseAbs( ).maxCoeff( ) );
+    }
+
+    // Check that normal matrix that is not positive definite is rejected
+    BOOST_CHECK_THROW( performTiledLeastSquaresAdjustment(
+                           designMatrix.topRows( 20 ), residuals.segment( 0, 20 ), weights.segment( 0, 20 ),
+                           -100.0 * Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters ), 8 ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
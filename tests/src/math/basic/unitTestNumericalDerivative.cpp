@@ -12,6 +12,7 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <cmath>
 #include <iostream>
 
 #include <boost/test/unit_test.hpp>
@@ -125,6 +126,68 @@ BOOST_AUTO_TEST_CASE( testNumericalDerivatives )
     }
 }
 
+//! Test central difference Jacobian calculator, with and without step size selection.
+BOOST_AUTO_TEST_CASE( testCentralDifferenceJacobianCalculator )
+{
+    using numerical_derivatives::CentralDifferenceJacobianCalculator;
+
+    // Point-mass gravity acceleration, with analytical Jacobian
+    double gravitationalParameter = 3.986004418E14;
+    std::function< Eigen::VectorXd( const Eigen::VectorXd& ) > accelerationFunction =
+            [ = ]( const Eigen::VectorXd& position )
+    {
+        return Eigen::VectorXd( -gravitationalParameter * position / std::pow( position.norm( ), 3.0 ) );
+    };
+
+    Eigen::VectorXd nominalPosition = ( Eigen::VectorXd( 3 ) << 7000.0E3, -1200.0E3, 450.0E3 ).finished( );
+    double distance = nominalPosition.norm( );
+    Eigen::MatrixXd analyticalJacobian = -gravitationalParameter / std::pow( distance, 3.0 ) * (
+                Eigen::MatrixXd::Identity( 3, 3 ) -
+                3.0 * nominalPosition * nominalPosition.transpose( ) / ( distance * distance ) );
+
+    // Use poorly chosen initial step sizes
+    Eigen::VectorXd initialStepSizes = Eigen::VectorXd::Constant( 3, 1.0E4 );
+
+    // Compute Jacobian with fixed step sizes
+    CentralDifferenceJacobianCalculator fixedStepCalculator( initialStepSizes );
+    Eigen::MatrixXd fixedStepJacobian = fixedStepCalculator.computeJacobian( accelerationFunction, nominalPosition );
+    double fixedStepError = ( fixedStepJacobian - analyticalJacobian ).norm( ) / analyticalJacobian.norm( );
+    BOOST_CHECK_EQUAL( ( fixedStepCalculator.getStepSizes( ) - initialStepSizes ).norm( ), 0.0 );
+
+    // Compute Jacobian with step size selection every 5 calls
+    CentralDifferenceJacobianCalculator adaptiveStepCalculator( initialStepSizes, 5 );
+    for( int i = 0; i < 7; i++ )
+    {
+        Eigen::MatrixXd adaptiveStepJacobian =
+                adaptiveStepCalculator.computeJacobian( accelerationFunction, nominalPosition );
+        double adaptiveStepError = ( adaptiveStepJacobian - analyticalJacobian ).norm( ) / analyticalJacobian.norm( );
+
+        // Check that selected step sizes improve the result significantly
+        BOOST_CHECK_SMALL( adaptiveStepError, 1.0E-8 );
+        BOOST_CHECK( adaptiveStepError < 1.0E-2 * fixedStepError );
+
+        // Check that step sizes were reduced, and remain within bounds
+        Eigen::VectorXd currentStepSizes = adaptiveStepCalculator.getStepSizes( );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK( currentStepSizes( j ) < initialStepSizes( j ) );
+            BOOST_CHECK( currentStepSizes( j ) >= 1.0E-3 * initialStepSizes( j ) );
+        }
+    }
+
+    // Check consistency of fixed and adaptive step size results when using the same step sizes
+    fixedStepCalculator.resetStepSizes( adaptiveStepCalculator.getStepSizes( ) );
+    Eigen::MatrixXd fixedStepJacobianWithSelectedSteps =
+            fixedStepCalculator.computeJacobian( accelerationFunction, nominalPosition );
+    BOOST_CHECK_SMALL( ( fixedStepJacobianWithSelectedSteps - analyticalJacobian ).norm( ) / analyticalJacobian.norm( ),
+                       1.0E-8 );
+
+    // Check that inconsistent input is rejected
+    Eigen::MatrixXd wrongSizeJacobian = Eigen::MatrixXd::Zero( 3, 2 );
+    BOOST_CHECK_THROW( fixedStepCalculator.computeJacobian( accelerationFunction, nominalPosition, wrongSizeJacobian ),
+                       std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
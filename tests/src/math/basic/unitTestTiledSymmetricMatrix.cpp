@@ -0,0 +1,178 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cstdlib>
+#include <fstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Cholesky>
+#include <Eigen/LU>
+
+#include "tudat/basics/testMacros.h"
+#include "tudat/math/basic/tiledSymmetricMatrix.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace linear_algebra;
+
+BOOST_AUTO_TEST_SUITE( test_tiled_symmetric_matrix )
+
+//! Test accumulation, decomposition, solution and inverse of tiled normal matrix against dense computations
+BOOST_AUTO_TEST_CASE( testTiledSymmetricMatrix )
+{
+    // Create design matrix and weights (matrix size not a multiple of tile size)
+    std::srand( 1 );
+    int numberOfObservations = 400;
+    int numberOfParameters = 53;
+    Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Random( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd weights = Eigen::VectorXd::Random( numberOfObservations ).cwiseAbs( ) +
+            Eigen::VectorXd::Constant( numberOfObservations, 0.5 );
+    Eigen::VectorXd aprioriDiagonal = Eigen::VectorXd::LinSpaced( numberOfParameters, 0.1, 1.0 );
+    Eigen::MatrixXd rightHandSide = Eigen::MatrixXd::Random( numberOfParameters, 3 );
+
+    // Compute dense normal matrix, its decomposition and inverse
+    Eigen::MatrixXd normalMatrix = designMatrix.transpose( ) * weights.asDiagonal( ) * designMatrix;
+    normalMatrix.diagonal( ) += aprioriDiagonal;
+    Eigen::LLT< Eigen::MatrixXd > denseDecomposition( normalMatrix );
+    Eigen::MatrixXd denseCholeskyFactor = denseDecomposition.matrixL( );
+    Eigen::MatrixXd denseSolution = denseDecomposition.solve( rightHandSide );
+    Eigen::MatrixXd denseInverse = normalMatrix.inverse( );
+
+    // Test in-memory and memory-mapped storage, with single and multiple threads
+    for( unsigned int test = 0; test < 4; test++ )
+    {
+        std::string storageFile = ( test < 2 ) ? "" : "tiledSymmetricMatrixTest.dat";
+        int numberOfThreads = ( test % 2 == 0 ) ? 1 : 4;
+
+        TiledSymmetricMatrix tiledNormalMatrix( numberOfParameters, 8, storageFile, numberOfThreads );
+        BOOST_CHECK_EQUAL( tiledNormalMatrix.getNumberOfTiles( ), 7 );
+        if( storageFile != "" )
+        {
+            BOOST_CHECK( std::ifstream( storageFile ).good( ) );
+        }
+
+        // Accumulate normal matrix from blocks of design matrix rows
+        for( int i = 0; i < numberOfObservations; i += 64 )
+        {
+            int numberOfRows = std::min( 64, numberOfObservations - i );
+            tiledNormalMatrix.addWeightedDesignMatrixRows(
+                        designMatrix.middleRows( i, numberOfRows ), weights.segment( i, numberOfRows ) );
+        }
+        tiledNormalMatrix.addToDiagonal( aprioriDiagonal );
+
+        Eigen::MatrixXd normalMatrixDifference = tiledNormalMatrix.getDenseMatrix( ) - normalMatrix;
+        BOOST_CHECK_SMALL( normalMatrixDifference.cwiseAbs( ).maxCoeff( ), 1.0E-13 * normalMatrix.cwiseAbs( ).maxCoeff( ) );
+
+        // Check Cholesky factor, solution and (selected entries of) inverse
+        tiledNormalMatrix.performCholeskyDecomposition( );
+        BOOST_CHECK( tiledNormalMatrix.getIsDecomposed( ) );
+        Eigen::MatrixXd tiledCholeskyFactor = tiledNormalMatrix.getDenseMatrix( );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( tiledCholeskyFactor, denseCholeskyFactor, 1.0E-12 );
+
+        Eigen::MatrixXd tiledSolution = tiledNormalMatrix.solve( rightHandSide );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( tiledSolution, denseSolution, 1.0E-10 );
+
+        Eigen::VectorXd tiledInverseDiagonal = tiledNormalMatrix.getInverseDiagonal( );
+        Eigen::VectorXd denseInverseDiagonal = denseInverse.diagonal( );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( tiledInverseDiagonal, denseInverseDiagonal, 1.0E-10 );
+
+        Eigen::MatrixXd tiledInverseBlock = tiledNormalMatrix.getInverseBlock( 5, 30, 20, 11 );
+        Eigen::MatrixXd denseInverseBlock = denseInverse.block( 5, 30, 20, 11 );
+        for( int i = 0; i < tiledInverseBlock.rows( ); i++ )
+        {
+            for( int j = 0; j < tiledInverseBlock.cols( ); j++ )
+            {
+                BOOST_CHECK_SMALL( tiledInverseBlock( i, j ) - denseInverseBlock( i, j ),
+                                   1.0E-10 * denseInverseDiagonal.maxCoeff( ) );
+            }
+        }
+
+        // Check that decomposed matrix can not be modified
+        BOOST_CHECK_THROW( tiledNormalMatrix.addToDiagonal( aprioriDiagonal ), std::runtime_error );
+    }
+
+    // Check that storage file is removed
+    BOOST_CHECK( !std::ifstream( "tiledSymmetricMatrixTest.dat" ).good( ) );
+
+    // Check that non-positive-definite matrix is rejected
+    TiledSymmetricMatrix singularNormalMatrix( numberOfParameters, 8 );
+    singularNormalMatrix.addWeightedDesignMatrixRows( designMatrix.topRows( 20 ), weights.segment( 0, 20 ) );
+    singularNormalMatrix.addToDiagonal( -aprioriDiagonal );
+    BOOST_CHECK_THROW( singularNormalMatrix.performCholeskyDecomposition( ), std::runtime_error );
+    BOOST_CHECK( singularNormalMatrix.getHasDecompositionFailed( ) );
+}
+
+//! Test that a matrix for which the decomposition failed (after overwriting part of its tiles) can only be re-used after reset
+BOOST_AUTO_TEST_CASE( testTiledSymmetricMatrixFailedDecomposition )
+{
+    std::srand( 2 );
+    int numberOfParameters = 30;
+    Eigen::MatrixXd designMatrix = Eigen::MatrixXd::Random( 100, numberOfParameters );
+    Eigen::VectorXd weights = Eigen::VectorXd::Constant( 100, 2.0 );
+    Eigen::MatrixXd aprioriMatrix = Eigen::MatrixXd::Random( numberOfParameters, numberOfParameters );
+    aprioriMatrix = ( aprioriMatrix * aprioriMatrix.transpose( ) ).eval( );
+    Eigen::VectorXd rightHandSide = Eigen::VectorXd::Random( numberOfParameters );
+
+    Eigen::MatrixXd normalMatrix = designMatrix.transpose( ) * weights.asDiagonal( ) * designMatrix + aprioriMatrix;
+    Eigen::VectorXd denseSolution = normalMatrix.llt( ).solve( rightHandSide );
+
+    // Make matrix indefinite in its last tile only, so that the decomposition fails after the first tiles are overwritten
+    Eigen::VectorXd indefiniteDiagonal = Eigen::VectorXd::Zero( numberOfParameters );
+    indefiniteDiagonal( numberOfParameters - 1 ) = -1.0E6;
+
+    TiledSymmetricMatrix tiledNormalMatrix( numberOfParameters, 8 );
+    tiledNormalMatrix.addWeightedDesignMatrixRows( designMatrix, weights );
+    tiledNormalMatrix.addSymmetricMatrix( aprioriMatrix );
+    tiledNormalMatrix.addToDiagonal( indefiniteDiagonal );
+    Eigen::MatrixXd originalFirstTile = tiledNormalMatrix.getTile( 0, 0 );
+    BOOST_CHECK_THROW( tiledNormalMatrix.performCholeskyDecomposition( ), std::runtime_error );
+    BOOST_CHECK( tiledNormalMatrix.getHasDecompositionFailed( ) );
+    BOOST_CHECK( !tiledNormalMatrix.getIsDecomposed( ) );
+
+    // Check that first tile has been overwritten
+    Eigen::MatrixXd overwrittenTile = tiledNormalMatrix.getTile( 0, 0 );
+    BOOST_CHECK( ( overwrittenTile - originalFirstTile ).cwiseAbs( ).maxCoeff( ) > 0.0 );
+
+    // Check that all operations on the matrix are rejected
+    BOOST_CHECK_THROW( tiledNormalMatrix.performCholeskyDecomposition( ), std::runtime_error );
+    BOOST_CHECK_THROW( tiledNormalMatrix.solve( rightHandSide ), std::runtime_error );
+    BOOST_CHECK_THROW( tiledNormalMatrix.getInverseDiagonal( ), std::runtime_error );
+    BOOST_CHECK_THROW( tiledNormalMatrix.getInverseBlock( 0, 0, 2, 2 ), std::runtime_error );
+    BOOST_CHECK_THROW( tiledNormalMatrix.getDenseMatrix( ), std::runtime_error );
+    BOOST_CHECK_THROW( tiledNormalMatrix.addToDiagonal( -indefiniteDiagonal ), std::runtime_error );
+    BOOST_CHECK_THROW( tiledNormalMatrix.addSymmetricMatrix( aprioriMatrix ), std::runtime_error );
+    BOOST_CHECK_THROW( tiledNormalMatrix.addWeightedDesignMatrixRows( designMatrix, weights ), std::runtime_error );
+
+    // Reset and re-accumulate matrix, and check solution
+    tiledNormalMatrix.setZero( );
+    BOOST_CHECK( !tiledNormalMatrix.getHasDecompositionFailed( ) );
+    tiledNormalMatrix.addWeightedDesignMatrixRows( designMatrix, weights );
+    tiledNormalMatrix.addSymmetricMatrix( aprioriMatrix );
+    Eigen::MatrixXd normalMatrixDifference = tiledNormalMatrix.getDenseMatrix( ) - normalMatrix;
+    BOOST_CHECK_SMALL( normalMatrixDifference.cwiseAbs( ).maxCoeff( ), 1.0E-13 * normalMatrix.cwiseAbs( ).maxCoeff( ) );
+
+    Eigen::VectorXd tiledSolution = tiledNormalMatrix.solve( rightHandSide );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( tiledSolution, denseSolution, 1.0E-10 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
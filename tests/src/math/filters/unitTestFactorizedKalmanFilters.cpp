@@ -0,0 +1,242 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/utilities.h"
+#include "tudat/basics/testMacros.h"
+
+#include "tudat/math/filters/createFilter.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_factorized_kalman_filters )
+
+// Discrete-time system, measurement functions and Jacobians for factorized Kalman filters.
+const double filteringTimeStep = 0.1;
+
+Eigen::VectorXd stateFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    Eigen::VectorXd nextState = Eigen::VectorXd::Zero( 4 );
+    nextState[ 0 ] = state[ 0 ] + filteringTimeStep * state[ 1 ];
+    nextState[ 1 ] = state[ 1 ] - filteringTimeStep * std::sin( state[ 0 ] ) + 0.1 * filteringTimeStep * state[ 2 ];
+    nextState[ 2 ] = 0.99 * state[ 2 ] + filteringTimeStep * state[ 3 ];
+    nextState[ 3 ] = state[ 3 ] - 0.5 * filteringTimeStep * state[ 2 ];
+    return nextState;
+}
+Eigen::VectorXd measurementFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    Eigen::VectorXd measurement = Eigen::VectorXd::Zero( 3 );
+    measurement[ 0 ] = state[ 0 ] + 0.1 * state[ 0 ] * state[ 0 ];
+    measurement[ 1 ] = state[ 1 ] + state[ 2 ];
+    measurement[ 2 ] = state[ 3 ];
+    return measurement;
+}
+Eigen::MatrixXd stateJacobianFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    Eigen::MatrixXd stateJacobian = Eigen::MatrixXd::Identity( 4, 4 );
+    stateJacobian( 0, 1 ) = filteringTimeStep;
+    stateJacobian( 1, 0 ) = -filteringTimeStep * std::cos( state[ 0 ] );
+    stateJacobian( 1, 2 ) = 0.1 * filteringTimeStep;
+    stateJacobian( 2, 2 ) = 0.99;
+    stateJacobian( 2, 3 ) = filteringTimeStep;
+    stateJacobian( 3, 2 ) = -0.5 * filteringTimeStep;
+    return stateJacobian;
+}
+Eigen::MatrixXd stateNoiseJacobianFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    TUDAT_UNUSED_PARAMETER( state );
+    return Eigen::MatrixXd::Identity( 4, 4 );
+}
+Eigen::MatrixXd measurementJacobianFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    Eigen::MatrixXd measurementJacobian = Eigen::MatrixXd::Zero( 3, 4 );
+    measurementJacobian( 0, 0 ) = 1.0 + 0.2 * state[ 0 ];
+    measurementJacobian( 1, 1 ) = 1.0;
+    measurementJacobian( 1, 2 ) = 1.0;
+    measurementJacobian( 2, 3 ) = 1.0;
+    return measurementJacobian;
+}
+Eigen::MatrixXd measurementNoiseJacobianFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    TUDAT_UNUSED_PARAMETER( state );
+    return Eigen::MatrixXd::Identity( 3, 3 );
+}
+
+//! Function to create a filter of the requested type for the test system.
+std::shared_ptr< filters::FilterBase< > > createTestFilter( const filters::AvailableFilteringTechniques filteringTechnique,
+                                                            const Eigen::MatrixXd& measurementUncertainty )
+{
+    using namespace tudat::filters;
+
+    // Set system uncertainty and initial estimates
+    Eigen::MatrixXd systemUncertainty = Eigen::MatrixXd::Zero( 4, 4 );
+    systemUncertainty.diagonal( ) << 1.0e-4, 2.0e-4, 1.0e-5, 5.0e-5;
+    systemUncertainty( 0, 1 ) = systemUncertainty( 1, 0 ) = 5.0e-5;
+    systemUncertainty( 2, 3 ) = systemUncertainty( 3, 2 ) = -1.0e-5;
+    Eigen::VectorXd initialStateEstimate = ( Eigen::VectorXd( 4 ) << 0.5, 0.0, 0.2, -0.1 ).finished( );
+    Eigen::MatrixXd initialCovarianceEstimate = Eigen::MatrixXd::Zero( 4, 4 );
+    initialCovarianceEstimate.diagonal( ) << 0.1, 0.2, 0.05, 0.05;
+    initialCovarianceEstimate( 0, 2 ) = initialCovarianceEstimate( 2, 0 ) = 0.01;
+
+    std::shared_ptr< FilterSettings< > > filterSettings;
+    switch ( filteringTechnique )
+    {
+    case ud_extended_kalman_filter:
+        filterSettings = std::make_shared< UDExtendedKalmanFilterSettings< > >(
+                    systemUncertainty, measurementUncertainty, filteringTimeStep, 0.0, initialStateEstimate,
+                    initialCovarianceEstimate );
+        break;
+    case square_root_information_filter:
+        filterSettings = std::make_shared< SquareRootInformationFilterSettings< > >(
+                    systemUncertainty, measurementUncertainty, filteringTimeStep, 0.0, initialStateEstimate,
+                    initialCovarianceEstimate );
+        break;
+    default:
+        filterSettings = std::make_shared< ExtendedKalmanFilterSettings< > >(
+                    systemUncertainty, measurementUncertainty, filteringTimeStep, 0.0, initialStateEstimate,
+                    initialCovarianceEstimate );
+    }
+
+    return createFilter< double, double >( filterSettings, &stateFunction, &measurementFunction, &stateJacobianFunction,
+                            &stateNoiseJacobianFunction, &measurementJacobianFunction, &measurementNoiseJacobianFunction );
+}
+
+//! Function to generate the (deterministic) measurements used in the test.
+std::vector< Eigen::VectorXd > generateTestMeasurements( const unsigned int numberOfTimeSteps )
+{
+    std::vector< Eigen::VectorXd > measurements;
+    Eigen::VectorXd actualState = ( Eigen::VectorXd( 4 ) << 0.6, -0.1, 0.25, -0.05 ).finished( );
+    for ( unsigned int i = 0; i < numberOfTimeSteps; i++ )
+    {
+        actualState = stateFunction( 0.0, actualState );
+        Eigen::VectorXd measurementError = ( Eigen::VectorXd( 3 ) << std::sin( 1.3 * i ), std::cos( 0.7 * i ),
+                                             std::sin( 2.1 * i + 0.4 ) ).finished( );
+        measurements.push_back( measurementFunction( 0.0, actualState ) + 1.0e-2 * measurementError );
+    }
+    return measurements;
+}
+
+// Test that UD-factorized and square root information filters reproduce the extended Kalman filter.
+BOOST_AUTO_TEST_CASE( testFactorizedFiltersAgainstExtendedKalmanFilter )
+{
+    using namespace tudat::filters;
+
+    // Check both uncorrelated and correlated measurement noise
+    for ( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        Eigen::MatrixXd measurementUncertainty = Eigen::MatrixXd::Zero( 3, 3 );
+        measurementUncertainty.diagonal( ) << 1.0e-4, 4.0e-4, 2.0e-4;
+        if ( testCase == 1 )
+        {
+            measurementUncertainty( 0, 1 ) = measurementUncertainty( 1, 0 ) = 1.0e-4;
+            measurementUncertainty( 1, 2 ) = measurementUncertainty( 2, 1 ) = -0.5e-4;
+        }
+
+        std::shared_ptr< FilterBase< > > extendedFilter = createTestFilter( extended_kalman_filter, measurementUncertainty );
+        std::vector< std::shared_ptr< FilterBase< > > > factorizedFilters =
+        { createTestFilter( ud_extended_kalman_filter, measurementUncertainty ),
+          createTestFilter( square_root_information_filter, measurementUncertainty ) };
+
+        // Run filters and compare estimates at each step
+        std::vector< Eigen::VectorXd > measurements = generateTestMeasurements( 200 );
+        for ( unsigned int i = 0; i < measurements.size( ); i++ )
+        {
+            extendedFilter->updateFilter( measurements.at( i ) );
+            for ( std::shared_ptr< FilterBase< > > filter: factorizedFilters )
+            {
+                filter->updateFilter( measurements.at( i ) );
+                BOOST_CHECK_CLOSE_FRACTION( filter->getCurrentTime( ), extendedFilter->getCurrentTime( ),
+                                            std::numeric_limits< double >::epsilon( ) );
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION( filter->getCurrentStateEstimate( ),
+                                                   extendedFilter->getCurrentStateEstimate( ), 1.0e-8 );
+                Eigen::MatrixXd covarianceDifference =
+                        filter->getCurrentCovarianceEstimate( ) - extendedFilter->getCurrentCovarianceEstimate( );
+                BOOST_CHECK_SMALL( covarianceDifference.cwiseAbs( ).maxCoeff( ) /
+                                   extendedFilter->getCurrentCovarianceEstimate( ).cwiseAbs( ).maxCoeff( ), 1.0e-10 );
+            }
+        }
+
+        // Check that covariance history is stored
+        for ( std::shared_ptr< FilterBase< > > filter: factorizedFilters )
+        {
+            BOOST_CHECK_EQUAL( filter->getEstimatedCovarianceHistory( ).size( ), measurements.size( ) + 1 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( filter->getEstimatedCovarianceHistory( ).rbegin( )->second,
+                                               filter->getCurrentCovarianceEstimate( ),
+                                               std::numeric_limits< double >::epsilon( ) );
+        }
+    }
+}
+
+// Test bounded storage of the filter history.
+BOOST_AUTO_TEST_CASE( testFilterHistoryStorage )
+{
+    using namespace tudat::filters;
+
+    Eigen::MatrixXd measurementUncertainty = Eigen::MatrixXd::Zero( 3, 3 );
+    measurementUncertainty.diagonal( ) << 1.0e-4, 4.0e-4, 2.0e-4;
+    std::vector< Eigen::VectorXd > measurements = generateTestMeasurements( 50 );
+
+    std::shared_ptr< FilterBase< > > boundedFilter = createTestFilter( ud_extended_kalman_filter, measurementUncertainty );
+    std::shared_ptr< FilterBase< > > unboundedFilter = createTestFilter( ud_extended_kalman_filter, measurementUncertainty );
+    std::shared_ptr< FilterBase< > > stateOnlyFilter = createTestFilter( square_root_information_filter, measurementUncertainty );
+    boundedFilter->setHistoryStorage( 10 );
+    stateOnlyFilter->setHistoryStorage( 0, false );
+    for ( unsigned int i = 0; i < measurements.size( ); i++ )
+    {
+        boundedFilter->updateFilter( measurements.at( i ) );
+        unboundedFilter->updateFilter( measurements.at( i ) );
+        stateOnlyFilter->updateFilter( measurements.at( i ) );
+    }
+
+    // Check that only the most recent entries are retained
+    std::map< double, Eigen::VectorXd > boundedStateHistory = boundedFilter->getEstimatedStateHistory( );
+    std::map< double, Eigen::VectorXd > unboundedStateHistory = unboundedFilter->getEstimatedStateHistory( );
+    BOOST_CHECK_EQUAL( boundedStateHistory.size( ), 10 );
+    BOOST_CHECK_EQUAL( boundedFilter->getEstimatedCovarianceHistory( ).size( ), 10 );
+    BOOST_CHECK_EQUAL( unboundedStateHistory.size( ), measurements.size( ) + 1 );
+    for ( std::map< double, Eigen::VectorXd >::const_iterator stateIterator = boundedStateHistory.begin( );
+          stateIterator != boundedStateHistory.end( ); stateIterator++ )
+    {
+        BOOST_CHECK_EQUAL( unboundedStateHistory.count( stateIterator->first ), 1 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( stateIterator->second, unboundedStateHistory.at( stateIterator->first ),
+                                           std::numeric_limits< double >::epsilon( ) );
+    }
+
+    // Check that covariance history is not stored, if so requested
+    BOOST_CHECK_EQUAL( stateOnlyFilter->getEstimatedStateHistory( ).size( ), measurements.size( ) + 1 );
+    BOOST_CHECK_EQUAL( stateOnlyFilter->getEstimatedCovarianceHistory( ).size( ), 0 );
+    BOOST_CHECK_THROW( stateOnlyFilter->revertToPreviousTimeStep( stateOnlyFilter->getCurrentTime( ) ), std::runtime_error );
+
+    // Check that reverting restores the factorized covariance
+    Eigen::MatrixXd previousCovariance = std::prev( unboundedFilter->getEstimatedCovarianceHistory( ).end( ), 2 )->second;
+    unboundedFilter->revertToPreviousTimeStep( unboundedFilter->getCurrentTime( ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( unboundedFilter->getCurrentCovarianceEstimate( ), previousCovariance, 1.0e-12 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
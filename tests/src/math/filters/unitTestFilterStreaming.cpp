@@ -0,0 +1,336 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+// Allows checking that no heap allocation is done by Eigen during a filter step
+#define EIGEN_RUNTIME_NO_MALLOC
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/basics/utilities.h"
+#include "tudat/basics/testMacros.h"
+
+#include "tudat/math/filters/createFilter.h"
+#include "tudat/math/filters/filterHistoryBuffer.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_filter_streaming )
+
+// Discrete-time system, measurement functions and Jacobians. Since the functions return by value, heap allocation is
+// temporarily allowed inside them, restoring the setting that was active when they were called.
+const double filteringTimeStep = 0.1;
+
+Eigen::VectorXd stateFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    bool isMallocAllowed = Eigen::internal::is_malloc_allowed( );
+    Eigen::internal::set_is_malloc_allowed( true );
+    Eigen::VectorXd nextState = Eigen::VectorXd::Zero( 4 );
+    nextState[ 0 ] = state[ 0 ] + filteringTimeStep * state[ 1 ];
+    nextState[ 1 ] = state[ 1 ] - filteringTimeStep * std::sin( state[ 0 ] ) + 0.1 * filteringTimeStep * state[ 2 ];
+    nextState[ 2 ] = 0.99 * state[ 2 ] + filteringTimeStep * state[ 3 ];
+    nextState[ 3 ] = state[ 3 ] - 0.5 * filteringTimeStep * state[ 2 ];
+    Eigen::internal::set_is_malloc_allowed( isMallocAllowed );
+    return nextState;
+}
+Eigen::VectorXd measurementFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    bool isMallocAllowed = Eigen::internal::is_malloc_allowed( );
+    Eigen::internal::set_is_malloc_allowed( true );
+    Eigen::VectorXd measurement = Eigen::VectorXd::Zero( 3 );
+    measurement[ 0 ] = state[ 0 ] + 0.1 * state[ 0 ] * state[ 0 ];
+    measurement[ 1 ] = state[ 1 ] + state[ 2 ];
+    measurement[ 2 ] = state[ 3 ];
+    Eigen::internal::set_is_malloc_allowed( isMallocAllowed );
+    return measurement;
+}
+Eigen::MatrixXd stateJacobianFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    bool isMallocAllowed = Eigen::internal::is_malloc_allowed( );
+    Eigen::internal::set_is_malloc_allowed( true );
+    Eigen::MatrixXd stateJacobian = Eigen::MatrixXd::Identity( 4, 4 );
+    stateJacobian( 0, 1 ) = filteringTimeStep;
+    stateJacobian( 1, 0 ) = -filteringTimeStep * std::cos( state[ 0 ] );
+    stateJacobian( 1, 2 ) = 0.1 * filteringTimeStep;
+    stateJacobian( 2, 2 ) = 0.99;
+    stateJacobian( 2, 3 ) = filteringTimeStep;
+    stateJacobian( 3, 2 ) = -0.5 * filteringTimeStep;
+    Eigen::internal::set_is_malloc_allowed( isMallocAllowed );
+    return stateJacobian;
+}
+Eigen::MatrixXd stateNoiseJacobianFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    TUDAT_UNUSED_PARAMETER( state );
+    bool isMallocAllowed = Eigen::internal::is_malloc_allowed( );
+    Eigen::internal::set_is_malloc_allowed( true );
+    Eigen::MatrixXd stateNoiseJacobian = Eigen::MatrixXd::Identity( 4, 4 );
+    Eigen::internal::set_is_malloc_allowed( isMallocAllowed );
+    return stateNoiseJacobian;
+}
+Eigen::MatrixXd measurementJacobianFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    bool isMallocAllowed = Eigen::internal::is_malloc_allowed( );
+    Eigen::internal::set_is_malloc_allowed( true );
+    Eigen::MatrixXd measurementJacobian = Eigen::MatrixXd::Zero( 3, 4 );
+    measurementJacobian( 0, 0 ) = 1.0 + 0.2 * state[ 0 ];
+    measurementJacobian( 1, 1 ) = 1.0;
+    measurementJacobian( 1, 2 ) = 1.0;
+    measurementJacobian( 2, 3 ) = 1.0;
+    Eigen::internal::set_is_malloc_allowed( isMallocAllowed );
+    return measurementJacobian;
+}
+Eigen::MatrixXd measurementNoiseJacobianFunction( const double time, const Eigen::VectorXd& state )
+{
+    TUDAT_UNUSED_PARAMETER( time );
+    TUDAT_UNUSED_PARAMETER( state );
+    bool isMallocAllowed = Eigen::internal::is_malloc_allowed( );
+    Eigen::internal::set_is_malloc_allowed( true );
+    Eigen::MatrixXd measurementNoiseJacobian = Eigen::MatrixXd::Identity( 3, 3 );
+    Eigen::internal::set_is_malloc_allowed( isMallocAllowed );
+    return measurementNoiseJacobian;
+}
+
+//! Function to create a filter of the requested type for the test system.
+std::shared_ptr< filters::FilterBase< > > createTestFilter( const filters::AvailableFilteringTechniques filteringTechnique )
+{
+    using namespace tudat::filters;
+
+    // Set uncertainties and initial estimates
+    Eigen::MatrixXd systemUncertainty = Eigen::MatrixXd::Zero( 4, 4 );
+    systemUncertainty.diagonal( ) << 1.0e-4, 2.0e-4, 1.0e-5, 5.0e-5;
+    Eigen::MatrixXd measurementUncertainty = Eigen::MatrixXd::Zero( 3, 3 );
+    measurementUncertainty.diagonal( ) << 1.0e-4, 4.0e-4, 2.0e-4;
+    Eigen::VectorXd initialStateEstimate = ( Eigen::VectorXd( 4 ) << 0.5, 0.0, 0.2, -0.1 ).finished( );
+    Eigen::MatrixXd initialCovarianceEstimate = Eigen::MatrixXd::Zero( 4, 4 );
+    initialCovarianceEstimate.diagonal( ) << 0.1, 0.2, 0.05, 0.05;
+
+    std::shared_ptr< FilterSettings< > > filterSettings;
+    if ( filteringTechnique == unscented_kalman_filter )
+    {
+        filterSettings = std::make_shared< UnscentedKalmanFilterSettings< > >(
+                    systemUncertainty, measurementUncertainty, filteringTimeStep, 0.0, initialStateEstimate,
+                    initialCovarianceEstimate );
+    }
+    else
+    {
+        filterSettings = std::make_shared< ExtendedKalmanFilterSettings< > >(
+                    systemUncertainty, measurementUncertainty, filteringTimeStep, 0.0, initialStateEstimate,
+                    initialCovarianceEstimate );
+    }
+
+    return createFilter< double, double >( filterSettings, &stateFunction, &measurementFunction, &stateJacobianFunction,
+                            &stateNoiseJacobianFunction, &measurementJacobianFunction, &measurementNoiseJacobianFunction );
+}
+
+//! Function to generate the (deterministic) measurements used in the test.
+std::vector< Eigen::VectorXd > generateTestMeasurements( const unsigned int numberOfTimeSteps )
+{
+    std::vector< Eigen::VectorXd > measurements;
+    Eigen::VectorXd actualState = ( Eigen::VectorXd( 4 ) << 0.6, -0.1, 0.25, -0.05 ).finished( );
+    for ( unsigned int i = 0; i < numberOfTimeSteps; i++ )
+    {
+        actualState = stateFunction( 0.0, actualState );
+        Eigen::VectorXd measurementError = ( Eigen::VectorXd( 3 ) << std::sin( 1.3 * i ), std::cos( 0.7 * i ),
+                                             std::sin( 2.1 * i + 0.4 ) ).finished( );
+        measurements.push_back( measurementFunction( 0.0, actualState ) + 1.0e-2 * measurementError );
+    }
+    return measurements;
+}
+
+// Test the bounded and unbounded behaviour of the filter history buffer.
+BOOST_AUTO_TEST_CASE( testFilterHistoryBuffer )
+{
+    using namespace tudat::filters;
+
+    // Fill bounded buffer beyond its capacity
+    FilterHistoryBuffer< double, Eigen::VectorXd > boundedBuffer( 4, Eigen::VectorXd::Zero( 2 ) );
+    FilterHistoryBuffer< double, Eigen::VectorXd > unboundedBuffer;
+    for ( unsigned int i = 0; i < 7; i++ )
+    {
+        boundedBuffer.push( static_cast< double >( i ), Eigen::VectorXd::Constant( 2, i ) );
+        unboundedBuffer.push( static_cast< double >( i ), Eigen::VectorXd::Constant( 2, i ) );
+    }
+    BOOST_CHECK_EQUAL( boundedBuffer.capacity( ), 4 );
+    BOOST_CHECK_EQUAL( boundedBuffer.size( ), 4 );
+    BOOST_CHECK_EQUAL( unboundedBuffer.size( ), 7 );
+    for ( unsigned int i = 0; i < 4; i++ )
+    {
+        BOOST_CHECK_EQUAL( boundedBuffer.getTime( i ), static_cast< double >( i + 3 ) );
+        BOOST_CHECK_EQUAL( boundedBuffer.getValue( i )[ 0 ], static_cast< double >( i + 3 ) );
+    }
+    BOOST_CHECK_THROW( boundedBuffer.getValue( 4 ), std::runtime_error );
+
+    // Check removal of most recent entry, and re-insertion
+    boundedBuffer.popBack( );
+    BOOST_CHECK_EQUAL( boundedBuffer.size( ), 3 );
+    BOOST_CHECK_EQUAL( boundedBuffer.backTime( ), 5.0 );
+    boundedBuffer.push( 5.5, Eigen::VectorXd::Constant( 2, 5.5 ) );
+    boundedBuffer.push( 6.0, Eigen::VectorXd::Constant( 2, 6.0 ) );
+    BOOST_CHECK_EQUAL( boundedBuffer.getTime( 0 ), 4.0 );
+    BOOST_CHECK_EQUAL( boundedBuffer.back( )[ 1 ], 6.0 );
+
+    // Check conversion to map and vector
+    std::map< double, Eigen::VectorXd > historyMap = boundedBuffer.getHistoryMap( );
+    BOOST_CHECK_EQUAL( historyMap.size( ), 4 );
+    BOOST_CHECK_EQUAL( historyMap.begin( )->first, 4.0 );
+    BOOST_CHECK_EQUAL( historyMap.rbegin( )->first, 6.0 );
+    std::vector< Eigen::VectorXd > historyVector = unboundedBuffer.getHistoryVector( );
+    BOOST_CHECK_EQUAL( historyVector.size( ), 7 );
+    BOOST_CHECK_EQUAL( historyVector.at( 2 )[ 0 ], 2.0 );
+
+    // Check that most recent entries are retained when bounding a buffer
+    unboundedBuffer.setCapacity( 3, Eigen::VectorXd::Zero( 2 ) );
+    BOOST_CHECK_EQUAL( unboundedBuffer.size( ), 3 );
+    BOOST_CHECK_EQUAL( unboundedBuffer.getTime( 0 ), 4.0 );
+    BOOST_CHECK_EQUAL( unboundedBuffer.backTime( ), 6.0 );
+
+    // Check clearing of buffer
+    boundedBuffer.clear( );
+    BOOST_CHECK( boundedBuffer.empty( ) );
+    BOOST_CHECK_EQUAL( boundedBuffer.capacity( ), 4 );
+}
+
+// Test that bounded history storage does not affect the estimates of the extended and unscented Kalman filters.
+BOOST_AUTO_TEST_CASE( testBoundedFilterHistory )
+{
+    using namespace tudat::filters;
+
+    std::vector< Eigen::VectorXd > measurements = generateTestMeasurements( 40 );
+    for ( AvailableFilteringTechniques filteringTechnique: { extended_kalman_filter, unscented_kalman_filter } )
+    {
+        std::shared_ptr< FilterBase< > > boundedFilter = createTestFilter( filteringTechnique );
+        std::shared_ptr< FilterBase< > > unboundedFilter = createTestFilter( filteringTechnique );
+        boundedFilter->setHistoryStorage( 10 );
+        for ( unsigned int i = 0; i < measurements.size( ); i++ )
+        {
+            boundedFilter->updateFilter( measurements.at( i ) );
+            unboundedFilter->updateFilter( measurements.at( i ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( boundedFilter->getCurrentStateEstimate( ),
+                                               unboundedFilter->getCurrentStateEstimate( ),
+                                               std::numeric_limits< double >::epsilon( ) );
+        }
+
+        // Check size and contents of histories
+        BOOST_CHECK_EQUAL( boundedFilter->getEstimatedStateHistoryBuffer( ).size( ), 10 );
+        BOOST_CHECK_EQUAL( boundedFilter->getEstimatedCovarianceHistory( ).size( ), 10 );
+        BOOST_CHECK_EQUAL( unboundedFilter->getEstimatedStateHistory( ).size( ), measurements.size( ) + 1 );
+        BOOST_CHECK_CLOSE_FRACTION( boundedFilter->getEstimatedStateHistoryBuffer( ).backTime( ),
+                                    unboundedFilter->getCurrentTime( ), std::numeric_limits< double >::epsilon( ) );
+        if ( filteringTechnique == unscented_kalman_filter )
+        {
+            BOOST_CHECK_EQUAL( std::dynamic_pointer_cast< UnscentedKalmanFilter< > >(
+                                   boundedFilter )->getHistoryOfSigmaPoints( ).size( ), 10 );
+        }
+
+        // Check that reverting a bounded filter restores the previous estimate
+        Eigen::VectorXd previousState = boundedFilter->getEstimatedStateHistoryBuffer( ).getValue( 8 );
+        Eigen::MatrixXd previousCovariance = boundedFilter->getEstimatedCovarianceHistoryBuffer( ).getValue( 8 );
+        boundedFilter->revertToPreviousTimeStep( boundedFilter->getCurrentTime( ) );
+        BOOST_CHECK_EQUAL( boundedFilter->getEstimatedStateHistoryBuffer( ).size( ), 9 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( boundedFilter->getCurrentStateEstimate( ), previousState,
+                                           std::numeric_limits< double >::epsilon( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( boundedFilter->getCurrentCovarianceEstimate( ), previousCovariance,
+                                           std::numeric_limits< double >::epsilon( ) );
+    }
+}
+
+// Test generation of system and measurement noise.
+BOOST_AUTO_TEST_CASE( testFilterNoiseGeneration )
+{
+    using namespace tudat::filters;
+
+    std::shared_ptr< FilterBase< > > firstFilter = createTestFilter( extended_kalman_filter );
+    std::shared_ptr< FilterBase< > > secondFilter = createTestFilter( extended_kalman_filter );
+
+    // Check that noise is reproducible for equal seeds, and that in-place generation is equivalent
+    Eigen::VectorXd systemNoise = Eigen::VectorXd::Zero( 4 );
+    Eigen::VectorXd measurementNoise = Eigen::VectorXd::Zero( 3 );
+    for ( unsigned int i = 0; i < 5; i++ )
+    {
+        secondFilter->produceSystemNoise( systemNoise );
+        secondFilter->produceMeasurementNoise( measurementNoise );
+        Eigen::VectorXd expectedSystemNoise = firstFilter->produceSystemNoise( );
+        Eigen::VectorXd expectedMeasurementNoise = firstFilter->produceMeasurementNoise( );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedSystemNoise, systemNoise, std::numeric_limits< double >::epsilon( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedMeasurementNoise, measurementNoise,
+                                           std::numeric_limits< double >::epsilon( ) );
+    }
+    BOOST_CHECK_EQUAL( firstFilter->getNoiseHistory( ).first.size( ), 5 );
+    BOOST_CHECK_EQUAL( secondFilter->getNoiseHistory( ).second.size( ), 5 );
+
+    // Check that a different seed results in different noise
+    secondFilter->resetNoiseSeed( 42 );
+    BOOST_CHECK( ( firstFilter->produceSystemNoise( ) - secondFilter->produceSystemNoise( ) ).norm( ) > 0.0 );
+
+    // Check statistics of generated noise
+    const unsigned int numberOfSamples = 100000;
+    Eigen::VectorXd sampleSum = Eigen::VectorXd::Zero( 4 );
+    Eigen::VectorXd sampleSquaredSum = Eigen::VectorXd::Zero( 4 );
+    for ( unsigned int i = 0; i < numberOfSamples; i++ )
+    {
+        firstFilter->produceSystemNoise( systemNoise );
+        sampleSum += systemNoise;
+        sampleSquaredSum += systemNoise.cwiseProduct( systemNoise );
+    }
+    Eigen::VectorXd expectedStandardDeviation = ( Eigen::VectorXd( 4 ) << 1.0e-4, 2.0e-4, 1.0e-5, 5.0e-5 ).finished( ).cwiseSqrt( );
+    for ( unsigned int i = 0; i < 4; i++ )
+    {
+        BOOST_CHECK_SMALL( sampleSum[ i ] / numberOfSamples / expectedStandardDeviation[ i ], 2.0e-2 );
+        BOOST_CHECK_CLOSE_FRACTION( std::sqrt( sampleSquaredSum[ i ] / numberOfSamples ), expectedStandardDeviation[ i ],
+                                    2.0e-2 );
+    }
+}
+
+// Test that a filter step, including storage of history and generation of noise, does not allocate memory.
+BOOST_AUTO_TEST_CASE( testFilterStepWithoutAllocation )
+{
+    using namespace tudat::filters;
+
+    std::vector< Eigen::VectorXd > measurements = generateTestMeasurements( 20 );
+    std::shared_ptr< FilterBase< > > streamingFilter = createTestFilter( extended_kalman_filter );
+    std::shared_ptr< FilterBase< > > referenceFilter = createTestFilter( extended_kalman_filter );
+    streamingFilter->setHistoryStorage( 5 );
+
+    Eigen::VectorXd systemNoise = Eigen::VectorXd::Zero( 4 );
+    Eigen::VectorXd measurementNoise = Eigen::VectorXd::Zero( 3 );
+    streamingFilter->produceSystemNoise( systemNoise );
+    streamingFilter->produceMeasurementNoise( measurementNoise );
+    for ( unsigned int i = 0; i < measurements.size( ); i++ )
+    {
+        Eigen::internal::set_is_malloc_allowed( false );
+        streamingFilter->updateFilter( measurements.at( i ) );
+        streamingFilter->produceSystemNoise( systemNoise );
+        streamingFilter->produceMeasurementNoise( measurementNoise );
+        Eigen::internal::set_is_malloc_allowed( true );
+
+        referenceFilter->updateFilter( measurements.at( i ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( streamingFilter->getCurrentStateEstimate( ),
+                                           referenceFilter->getCurrentStateEstimate( ),
+                                           std::numeric_limits< double >::epsilon( ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
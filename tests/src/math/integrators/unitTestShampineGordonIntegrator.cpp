@@ -0,0 +1,160 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Fehlberg, E. Classical Fifth-, Sixth-, Seventh- and Eigth-Order Runge-Kutta Formulas with Stepsize Control,
+ *          NASA TR R-287, 1968.
+ *
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <cmath>
+
+#include <Eigen/Core>
+
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/math/basic/mathematicalConstants.h"
+#include "tudat/math/integrators/createNumericalIntegrator.h"
+#include "tudat/math/integrators/shampineGordonIntegrator.h"
+#include "tudat/math/integrators/rungeKuttaVariableStepSizeIntegrator.h"
+#include "tudat/math/integrators/numericalIntegratorTestFunctions.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_shampine_gordon_integrator )
+
+using numerical_integrator_test_functions::computeFehlbergLogirithmicTestODEStateDerivative;
+using numerical_integrator_test_functions::computeAnalyticalStateFehlbergODE;
+
+using namespace numerical_integrators;
+
+//! Compute state derivative of Kepler orbit with unit gravitational parameter.
+Eigen::VectorXd computeKeplerStateDerivative( const double time, const Eigen::VectorXd& state )
+{
+    Eigen::VectorXd stateDerivative( 6 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -state.segment( 0, 3 ) / std::pow( state.segment( 0, 3 ).norm( ), 3 );
+    return stateDerivative;
+}
+
+//! Test integration and dense output on Fehlberg's logarithmic test problem.
+BOOST_AUTO_TEST_CASE( testShampineGordonIntegratorFehlbergODE )
+{
+    // Initial conditions
+    double initialTime = 0.0;
+    double finalTime = 5.0;
+    Eigen::VectorXd initialState = computeAnalyticalStateFehlbergODE( initialTime, Eigen::VectorXd::Zero( 2 ) );
+
+    ShampineGordonIntegratorXd integrator(
+                computeFehlbergLogirithmicTestODEStateDerivative, initialTime, initialState,
+                std::numeric_limits< double >::epsilon( ), std::numeric_limits< double >::infinity( ), 1.0E-2,
+                1.0E-12, 1.0E-12 );
+
+    // Integrate step by step, and check both the states at the grid points and the dense output inside each step.
+    int maximumOrderUsed = 0;
+    double maximumDenseOutputError = 0.0;
+    while( integrator.getCurrentIndependentVariable( ) < finalTime )
+    {
+        integrator.performIntegrationStep( integrator.getNextStepSize( ) );
+        maximumOrderUsed = std::max( maximumOrderUsed, integrator.getOrderOfLastStep( ) );
+
+        double previousTime = integrator.getPreviousIndependentVariable( );
+        double currentTime = integrator.getCurrentIndependentVariable( );
+        for( int i = 1; i < 4; i++ )
+        {
+            double interpolationTime = previousTime + static_cast< double >( i ) / 4.0 * ( currentTime - previousTime );
+            Eigen::VectorXd interpolationError = integrator.getDenseOutputState( interpolationTime ) -
+                    computeAnalyticalStateFehlbergODE( interpolationTime, initialState );
+            maximumDenseOutputError = std::max( maximumDenseOutputError, interpolationError.cwiseAbs( ).maxCoeff( ) );
+        }
+
+        // Dense output at the end points of the step should reproduce the integrated states.
+        BOOST_CHECK_SMALL( ( integrator.getDenseOutputState( currentTime ) - integrator.getCurrentState( ) ).norm( ),
+                           std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_SMALL( ( integrator.getDenseOutputState( previousTime ) - integrator.getPreviousState( ) ).norm( ), 1.0E-11 );
+    }
+
+    Eigen::VectorXd finalState = integrator.getDenseOutputState( finalTime );
+    Eigen::VectorXd expectedFinalState = computeAnalyticalStateFehlbergODE( finalTime, initialState );
+
+    BOOST_CHECK_SMALL( ( finalState - expectedFinalState ).cwiseAbs( ).maxCoeff( ), 1.0E-9 );
+    BOOST_CHECK_SMALL( maximumDenseOutputError, 1.0E-9 );
+    BOOST_CHECK_GT( maximumOrderUsed, 6 );
+}
+
+//! Test integration of an eccentric Kepler orbit over one orbital period, forward and backward.
+BOOST_AUTO_TEST_CASE( testShampineGordonIntegratorEccentricKeplerOrbit )
+{
+    // Initial state at pericenter of orbit with a = 1, e = 0.8 (unit gravitational parameter).
+    double eccentricity = 0.8;
+    double orbitalPeriod = 2.0 * mathematical_constants::PI;
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 );
+    initialState( 0 ) = 1.0 - eccentricity;
+    initialState( 4 ) = std::sqrt( ( 1.0 + eccentricity ) / ( 1.0 - eccentricity ) );
+
+    // Create integrator from settings.
+    std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > integrator =
+            createIntegrator< double, Eigen::VectorXd >(
+                &computeKeplerStateDerivative, initialState, 0.0,
+                shampineGordonSettings< double >( 1.0E-3, 1.0E-10, 1.0, 1.0E-13, 1.0E-13 ) );
+
+    std::shared_ptr< ShampineGordonIntegratorXd > shampineGordonIntegrator =
+            std::dynamic_pointer_cast< ShampineGordonIntegratorXd >( integrator );
+    BOOST_CHECK( shampineGordonIntegrator != nullptr );
+
+    // Propagate over one period, state should return to initial state.
+    Eigen::VectorXd finalState = integrator->integrateTo( orbitalPeriod, 1.0E-3 );
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( finalState( i ) - initialState( i ) ), 1.0E-9 );
+    }
+
+    // Compare number of function evaluations with RKF7(8) at same tolerances.
+    RungeKuttaVariableStepSizeIntegratorXd rungeKuttaIntegrator(
+                RungeKuttaCoefficients::get( rungeKuttaFehlberg78 ), &computeKeplerStateDerivative, 0.0, initialState,
+                1.0E-10, 1.0, 1.0E-3, 1.0E-13, 1.0E-13 );
+    int numberOfRungeKuttaSteps = 0;
+    while( rungeKuttaIntegrator.getCurrentIndependentVariable( ) < orbitalPeriod )
+    {
+        rungeKuttaIntegrator.performIntegrationStep( rungeKuttaIntegrator.getNextStepSize( ) );
+        numberOfRungeKuttaSteps++;
+    }
+    BOOST_CHECK_LT( shampineGordonIntegrator->getNumberOfStateDerivativeEvaluations( ), 13 * numberOfRungeKuttaSteps );
+
+    // Propagate back to initial time.
+    Eigen::VectorXd propagatedBackState = integrator->integrateTo( 0.0, -1.0E-3 );
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( propagatedBackState( i ) - initialState( i ) ), 1.0E-9 );
+    }
+
+    // Check that maximum order is respected.
+    integrator = createIntegrator< double, Eigen::VectorXd >(
+                &computeKeplerStateDerivative, initialState, 0.0,
+                shampineGordonSettings< double >( 1.0E-3, 1.0E-10, 1.0, 1.0E-13, 1.0E-13, 5 ) );
+    shampineGordonIntegrator = std::dynamic_pointer_cast< ShampineGordonIntegratorXd >( integrator );
+    while( shampineGordonIntegrator->getCurrentIndependentVariable( ) < 1.0 )
+    {
+        shampineGordonIntegrator->performIntegrationStep( shampineGordonIntegrator->getNextStepSize( ) );
+        BOOST_CHECK( shampineGordonIntegrator->getOrderOfLastStep( ) <= 5 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
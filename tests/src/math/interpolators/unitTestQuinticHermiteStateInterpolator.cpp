@@ -0,0 +1,199 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include "tudat/basics/testMacros.h"
+
+#include "tudat/math/interpolators/lagrangeInterpolator.h"
+#include "tudat/math/interpolators/quinticHermiteStateInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace interpolators;
+
+//! Function to compute Cartesian state on an inclined circular orbit with radius 7000 km and period of ~100 minutes
+Eigen::Vector6d getCircularOrbitState( const double time )
+{
+    double radius = 7000.0E3;
+    double meanMotion = 2.0 * mathematical_constants::PI / 6000.0;
+    double inclination = 0.5;
+
+    Eigen::Vector6d state;
+    state << radius * std::cos( meanMotion * time ),
+            radius * std::cos( inclination ) * std::sin( meanMotion * time ),
+            radius * std::sin( inclination ) * std::sin( meanMotion * time ),
+            -radius * meanMotion * std::sin( meanMotion * time ),
+            radius * meanMotion * std::cos( inclination ) * std::cos( meanMotion * time ),
+            radius * meanMotion * std::sin( inclination ) * std::cos( meanMotion * time );
+    return state;
+}
+
+//! Function to compute Cartesian acceleration on circular orbit given by getCircularOrbitState
+Eigen::Vector3d getCircularOrbitAcceleration( const double time )
+{
+    double meanMotion = 2.0 * mathematical_constants::PI / 6000.0;
+    return -meanMotion * meanMotion * getCircularOrbitState( time ).segment( 0, 3 );
+}
+
+BOOST_AUTO_TEST_SUITE( test_quintic_hermite_state_interpolator )
+
+//! Test equidistant lookup scheme against binary search.
+BOOST_AUTO_TEST_CASE( testEquidistantGridLookupScheme )
+{
+    std::vector< double > independentValues;
+    for( int i = 0; i < 101; i++ )
+    {
+        independentValues.push_back( 1.0E7 + 0.1 * static_cast< double >( i ) );
+    }
+
+    EquidistantGridLookupScheme< double > equidistantLookup( independentValues );
+    BinarySearchLookupScheme< double > binarySearchLookup( independentValues );
+
+    // Check at, in between, and outside of nodes
+    std::vector< double > valuesToLookup;
+    for( int i = -5; i < 1010; i++ )
+    {
+        valuesToLookup.push_back( 1.0E7 + 0.01 * static_cast< double >( i ) );
+    }
+    valuesToLookup.insert( valuesToLookup.end( ), independentValues.begin( ), independentValues.end( ) );
+
+    for( unsigned int i = 0; i < valuesToLookup.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( equidistantLookup.findNearestLowerNeighbour( valuesToLookup.at( i ) ),
+                           binarySearchLookup.findNearestLowerNeighbour( valuesToLookup.at( i ) ) );
+    }
+
+    // Check that non-equidistant data is rejected
+    independentValues.at( 50 ) += 0.01;
+    BOOST_CHECK( !EquidistantGridLookupScheme< double >::isEquidistant( independentValues ) );
+    BOOST_CHECK_THROW( ( EquidistantGridLookupScheme< double >( independentValues, 1.0E-6 ) ), std::runtime_error );
+}
+
+//! Test quintic Hermite state interpolator against analytical circular orbit, and against Lagrange interpolation
+BOOST_AUTO_TEST_CASE( testQuinticHermiteStateInterpolator )
+{
+    // Create tabulated states and accelerations (60 s step size)
+    double stepSize = 60.0;
+    std::map< double, Eigen::Vector6d > stateMap;
+    std::map< double, Eigen::Vector3d > accelerationMap;
+    for( int i = 0; i <= 100; i++ )
+    {
+        double currentTime = stepSize * static_cast< double >( i );
+        stateMap[ currentTime ] = getCircularOrbitState( currentTime );
+        accelerationMap[ currentTime ] = getCircularOrbitAcceleration( currentTime );
+    }
+
+    // Create interpolators
+    QuinticHermiteStateInterpolator< double > hermiteInterpolator( stateMap, accelerationMap );
+    QuinticHermiteStateInterpolator< double > hermiteInterpolatorWithComputedAccelerations( stateMap );
+    LagrangeInterpolator< double, Eigen::Vector6d > lagrangeInterpolator(
+                stateMap, 6, huntingAlgorithm, lagrange_cubic_spline_boundary_interpolation );
+
+    BOOST_CHECK_EQUAL( hermiteInterpolator.getSelectedLookupScheme( ), equidistantGridLookup );
+    BOOST_CHECK_EQUAL( hermiteInterpolator.getInterpolatorType( ), quintic_hermite_state_interpolator );
+
+    // Check computed accelerations
+    std::vector< Eigen::Vector3d > computedAccelerations =
+            hermiteInterpolatorWithComputedAccelerations.getAccelerationValues( );
+    int currentIndex = 0;
+    for( auto accelerationIterator : accelerationMap )
+    {
+        BOOST_CHECK_SMALL( ( computedAccelerations.at( currentIndex ) - accelerationIterator.second ).norm( ) /
+                           accelerationIterator.second.norm( ), 1.0E-8 );
+        currentIndex++;
+    }
+
+    // Check interpolation at nodes
+    for( auto stateIterator : stateMap )
+    {
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( hermiteInterpolator.interpolate( stateIterator.first ), stateIterator.second,
+                                           std::numeric_limits< double >::epsilon( ) );
+    }
+
+    // Compute interpolation errors, away from the edges of the data
+    double maximumHermitePositionError = 0.0, maximumHermiteVelocityError = 0.0;
+    double maximumComputedAccelerationHermitePositionError = 0.0, maximumComputedAccelerationHermiteVelocityError = 0.0;
+    double maximumLagrangePositionError = 0.0, maximumLagrangeVelocityError = 0.0;
+    for( double currentTime = 5.0 * stepSize; currentTime < 95.0 * stepSize; currentTime += 7.3 )
+    {
+        Eigen::Vector6d exactState = getCircularOrbitState( currentTime );
+        Eigen::Vector6d hermiteError = hermiteInterpolator.interpolate( currentTime ) - exactState;
+        Eigen::Vector6d computedAccelerationHermiteError =
+                hermiteInterpolatorWithComputedAccelerations.interpolate( currentTime ) - exactState;
+        Eigen::Vector6d lagrangeError = lagrangeInterpolator.interpolate( currentTime ) - exactState;
+
+        maximumHermitePositionError = std::max(
+                    maximumHermitePositionError, hermiteError.segment( 0, 3 ).norm( ) );
+        maximumHermiteVelocityError = std::max(
+                    maximumHermiteVelocityError, hermiteError.segment( 3, 3 ).norm( ) );
+        maximumComputedAccelerationHermitePositionError = std::max(
+                    maximumComputedAccelerationHermitePositionError, computedAccelerationHermiteError.segment( 0, 3 ).norm( ) );
+        maximumComputedAccelerationHermiteVelocityError = std::max(
+                    maximumComputedAccelerationHermiteVelocityError, computedAccelerationHermiteError.segment( 3, 3 ).norm( ) );
+        maximumLagrangePositionError = std::max(
+                    maximumLagrangePositionError, lagrangeError.segment( 0, 3 ).norm( ) );
+        maximumLagrangeVelocityError = std::max(
+                    maximumLagrangeVelocityError, lagrangeError.segment( 3, 3 ).norm( ) );
+    }
+
+    // Check absolute errors (position in m, velocity in m/s)
+    BOOST_CHECK_SMALL( maximumHermitePositionError, 2.0E-5 );
+    BOOST_CHECK_SMALL( maximumHermiteVelocityError, 1.0E-6 );
+    BOOST_CHECK_SMALL( maximumComputedAccelerationHermitePositionError, 2.0E-5 );
+    BOOST_CHECK_SMALL( maximumComputedAccelerationHermiteVelocityError, 1.0E-6 );
+
+    // Check that results are more accurate than using Lagrange interpolation
+    BOOST_CHECK( maximumHermitePositionError < 1.0E-2 * maximumLagrangePositionError );
+    BOOST_CHECK( maximumComputedAccelerationHermitePositionError < 1.0E-2 * maximumLagrangePositionError );
+    BOOST_CHECK( maximumHermiteVelocityError < maximumLagrangeVelocityError );
+    BOOST_CHECK( maximumComputedAccelerationHermiteVelocityError < maximumLagrangeVelocityError );
+
+    // Check that results for non-equidistant nodes are consistent
+    std::map< double, Eigen::Vector6d > unevenStateMap = stateMap;
+    std::map< double, Eigen::Vector3d > unevenAccelerationMap = accelerationMap;
+    unevenStateMap.erase( 50.0 * stepSize );
+    unevenAccelerationMap.erase( 50.0 * stepSize );
+    QuinticHermiteStateInterpolator< double > unevenHermiteInterpolator( unevenStateMap, unevenAccelerationMap );
+    BOOST_CHECK_EQUAL( unevenHermiteInterpolator.getSelectedLookupScheme( ), huntingAlgorithm );
+    for( double currentTime = 5.0 * stepSize; currentTime < 95.0 * stepSize; currentTime += 7.3 )
+    {
+        if( currentTime < 49.0 * stepSize || currentTime > 51.0 * stepSize )
+        {
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( unevenHermiteInterpolator.interpolate( currentTime ),
+                                               hermiteInterpolator.interpolate( currentTime ),
+                                               std::numeric_limits< double >::epsilon( ) );
+        }
+    }
+
+    // Check boundary handling
+    QuinticHermiteStateInterpolator< double > hermiteInterpolatorWithBoundaryCheck(
+                stateMap, accelerationMap, undefinedScheme, throw_exception_at_boundary );
+    BOOST_CHECK_THROW( hermiteInterpolatorWithBoundaryCheck.interpolate( -1.0 ), std::runtime_error );
+
+    // Check inconsistent input
+    accelerationMap.erase( 0.0 );
+    BOOST_CHECK_THROW( ( QuinticHermiteStateInterpolator< double >( stateMap, accelerationMap ) ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,170 @@
+/*    Copyright (c) 2010-2019, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Random123 library (D.E. Shaw Research), known-answer test vectors (kat_vectors) for philox4x32_10.
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/tools/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "tudat/math/statistics/counterBasedRandomNumberGenerator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace statistics;
+
+BOOST_AUTO_TEST_SUITE( test_counter_based_random_number_generator )
+
+//! Test Philox block function against known-answer test vectors, and properties of generated Gaussian numbers.
+BOOST_AUTO_TEST_CASE( testCounterBasedGaussianNumbers )
+{
+    // Check known-answer test vectors
+    {
+        std::array< std::uint32_t, 4 > block = computePhilox4x32Block( { 0, 0, 0, 0 }, { 0, 0 } );
+        std::array< std::uint32_t, 4 > expectedBlock = { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 };
+        BOOST_CHECK( block == expectedBlock );
+
+        block = computePhilox4x32Block( { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff }, { 0xffffffff, 0xffffffff } );
+        expectedBlock = { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd };
+        BOOST_CHECK( block == expectedBlock );
+
+        block = computePhilox4x32Block( { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }, { 0xa4093822, 0x299f31d0 } );
+        expectedBlock = { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 };
+        BOOST_CHECK( block == expectedBlock );
+    }
+
+    // Check that noise is independent of order of evaluation, and depends on key
+    {
+        std::function< Eigen::VectorXd( const double ) > noiseFunction = getCounterBasedGaussianNoiseFunction( 2.0, 42, 3 );
+        std::function< Eigen::VectorXd( const double ) > otherNoiseFunction = getCounterBasedGaussianNoiseFunction( 2.0, 43, 3 );
+        std::vector< double > times;
+        std::vector< Eigen::VectorXd > forwardNoise;
+        for( int i = 0; i < 100; i++ )
+        {
+            times.push_back( 1.0E8 + 10.0 * i );
+            forwardNoise.push_back( noiseFunction( times.back( ) ) );
+        }
+        for( int i = 99; i >= 0; i-- )
+        {
+            Eigen::VectorXd backwardNoise = noiseFunction( times.at( i ) );
+            Eigen::VectorXd otherNoise = otherNoiseFunction( times.at( i ) );
+            for( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_EQUAL( backwardNoise( j ), forwardNoise.at( i )( j ) );
+                BOOST_CHECK( otherNoise( j ) != forwardNoise.at( i )( j ) );
+            }
+            BOOST_CHECK( backwardNoise( 0 ) != backwardNoise( 1 ) );
+            BOOST_CHECK( backwardNoise( 0 ) != backwardNoise( 2 ) );
+        }
+    }
+
+    // Check that a sequence generated in batches is identical to one generated at once, and check its statistics
+    {
+        const int numberOfSamples = 1000000;
+        CounterBasedGaussianRandomNumberGenerator randomNumberGenerator( 12345, 3.0, 1.0 );
+        Eigen::VectorXd sequence = Eigen::VectorXd( numberOfSamples );
+        randomNumberGenerator.getRandomSequence( 0, sequence );
+
+        Eigen::VectorXd batchedSequence = Eigen::VectorXd( numberOfSamples );
+        for( int i = 0; i < numberOfSamples; i += 10000 )
+        {
+            randomNumberGenerator.getRandomSequence( i / 2, batchedSequence.segment( i, 10000 ) );
+        }
+        BOOST_CHECK_EQUAL( ( sequence - batchedSequence ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+        double mean = sequence.mean( );
+        Eigen::VectorXd centeredSequence = sequence.array( ) - mean;
+        double variance = centeredSequence.squaredNorm( ) / ( numberOfSamples - 1 );
+        double lagOneCorrelation = centeredSequence.head( numberOfSamples - 1 ).dot(
+                    centeredSequence.tail( numberOfSamples - 1 ) ) / ( variance * ( numberOfSamples - 1 ) );
+        double fourthMoment = centeredSequence.array( ).pow( 4 ).mean( ) / ( variance * variance );
+
+        BOOST_CHECK_SMALL( mean - 1.0, 5.0 * 3.0 / std::sqrt( numberOfSamples ) );
+        BOOST_CHECK_CLOSE_FRACTION( std::sqrt( variance ), 3.0, 5.0E-3 );
+        BOOST_CHECK_SMALL( lagOneCorrelation, 5.0 / std::sqrt( numberOfSamples ) );
+        BOOST_CHECK_CLOSE_FRACTION( fourthMoment, 3.0, 2.0E-2 );
+    }
+}
+
+//! Test generation of time-correlated noise
+BOOST_AUTO_TEST_CASE( testTimeCorrelatedNoise )
+{
+    // Check variance and correlation of first-order Gauss-Markov process
+    {
+        const int numberOfSamples = 2000000;
+        const double timeStep = 10.0, correlationTime = 100.0, standardDeviation = 0.5;
+        Eigen::VectorXd noise = generateFirstOrderGaussMarkovNoise(
+                    7, numberOfSamples, timeStep, correlationTime, standardDeviation );
+
+        double variance = noise.squaredNorm( ) / numberOfSamples;
+        double lagOneCorrelation = noise.head( numberOfSamples - 1 ).dot( noise.tail( numberOfSamples - 1 ) ) /
+                ( variance * ( numberOfSamples - 1 ) );
+        double lagTenCorrelation = noise.head( numberOfSamples - 10 ).dot( noise.tail( numberOfSamples - 10 ) ) /
+                ( variance * ( numberOfSamples - 10 ) );
+        BOOST_CHECK_CLOSE_FRACTION( std::sqrt( variance ), standardDeviation, 1.0E-2 );
+        BOOST_CHECK_SMALL( lagOneCorrelation - std::exp( -timeStep / correlationTime ), 5.0E-3 );
+        BOOST_CHECK_SMALL( lagTenCorrelation - std::exp( -10.0 * timeStep / correlationTime ), 1.0E-2 );
+    }
+
+    // Check power-law noise against direct convolution, and random walk (alpha = 2) against cumulative sum of white noise
+    {
+        const int numberOfSamples = 300;
+        Eigen::VectorXd whiteNoise = generatePowerLawNoise( 11, numberOfSamples, 0.0, 2.0 );
+        Eigen::VectorXd randomWalkNoise = generatePowerLawNoise( 11, numberOfSamples, 2.0, 2.0 );
+        Eigen::VectorXd flickerNoise = generatePowerLawNoise( 11, numberOfSamples, 1.0, 2.0 );
+
+        double cumulativeSum = 0.0;
+        for( int i = 0; i < numberOfSamples; i++ )
+        {
+            cumulativeSum += whiteNoise( i );
+            BOOST_CHECK_SMALL( randomWalkNoise( i ) - cumulativeSum, 1.0E-12 * numberOfSamples );
+
+            double directConvolution = 0.0;
+            double impulseResponse = 1.0;
+            for( int j = 0; j <= i; j++ )
+            {
+                if( j > 0 )
+                {
+                    impulseResponse *= ( 0.5 + static_cast< double >( j - 1 ) ) / static_cast< double >( j );
+                }
+                directConvolution += impulseResponse * whiteNoise( i - j );
+            }
+            BOOST_CHECK_SMALL( flickerNoise( i ) - directConvolution, 1.0E-12 * numberOfSamples );
+        }
+    }
+
+    // Check interpolation of tabulated noise
+    {
+        Eigen::MatrixXd noiseSequence = Eigen::MatrixXd( 3, 2 );
+        noiseSequence << 1.0, 2.0, 3.0, 6.0, -1.0, 0.0;
+        std::function< Eigen::VectorXd( const double ) > noiseFunction =
+                getTabulatedNoiseFunction( noiseSequence, 100.0, 10.0 );
+        BOOST_CHECK_CLOSE_FRACTION( noiseFunction( 100.0 )( 1 ), 2.0, std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_CLOSE_FRACTION( noiseFunction( 102.5 )( 0 ), 1.5, std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_CLOSE_FRACTION( noiseFunction( 115.0 )( 1 ), 3.0, std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_CLOSE_FRACTION( noiseFunction( 120.0 )( 0 ), -1.0, std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_THROW( noiseFunction( 99.0 ), std::runtime_error );
+        BOOST_CHECK_THROW( noiseFunction( 121.0 ), std::runtime_error );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
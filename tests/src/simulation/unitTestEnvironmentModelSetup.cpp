@@ -11,6 +11,9 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 
+#include <cstdint>
+#include <fstream>
+#include <iterator>
 #include <limits>
 
 #include <boost/test/unit_test.hpp>
@@ -33,6 +36,7 @@
 #include "tudat/astro/electromagnetism/reflectionLaw.h"
 #include "tudat/astro/ephemerides/approximatePlanetPositions.h"
 #include "tudat/astro/ephemerides/tabulatedEphemeris.h"
+#include "tudat/astro/ephemerides/tabulatedRotationalEphemeris.h"
 #include "tudat/astro/ephemerides/simpleRotationalEphemeris.h"
 #include "tudat/astro/ephemerides/itrsToGcrsRotationModel.h"
 #include "tudat/astro/gravitation/centralGravityModel.h"
@@ -58,6 +62,7 @@
 #include "tudat/simulation/environment_setup/createRadiationPressureTargetModel.h"
 #include "tudat/simulation/environment_setup/createSurfacePropertyDistribution.h"
 #include "tudat/simulation/environment_setup/defaultBodies.h"
+#include "tudat/simulation/environment_setup/environmentSnapshot.h"
 
 namespace tudat
 {
@@ -2140,6 +2145,185 @@ BOOST_AUTO_TEST_CASE( test_DefaultSettingsDifferentBody )
 
 }
 
+//! Test writing the data-heavy environment models of bodies to a binary snapshot, and attaching them to new bodies
+BOOST_AUTO_TEST_CASE( test_environmentSnapshot )
+{
+    using namespace interpolators;
+    using namespace ephemerides;
+    using namespace gravitation;
+
+    // Create tabulated state and rotational state histories
+    std::map< double, Eigen::Vector6d > stateHistory;
+    std::map< double, Eigen::Matrix< double, 7, 1 > > rotationalStateHistory;
+    for( int i = 0; i < 200; i++ )
+    {
+        double currentTime = 60.0 * i;
+        stateHistory[ currentTime ] = ( Eigen::Vector6d( ) << 7.0E6 * std::cos( 1.0E-3 * currentTime ),
+                                        7.0E6 * std::sin( 1.0E-3 * currentTime ), 1.0E3 * currentTime,
+                                        -7.0E3 * std::sin( 1.0E-3 * currentTime ),
+                                        7.0E3 * std::cos( 1.0E-3 * currentTime ), 1.0E3 ).finished( );
+
+        Eigen::Quaterniond currentRotation(
+                    Eigen::AngleAxisd( 1.0E-4 * currentTime, Eigen::Vector3d::UnitZ( ) ) *
+                    Eigen::AngleAxisd( 0.1, Eigen::Vector3d::UnitX( ) ) );
+        rotationalStateHistory[ currentTime ] << currentRotation.w( ), currentRotation.x( ), currentRotation.y( ),
+                currentRotation.z( ), 0.0, 1.0E-4 * std::sin( 0.1 ), 1.0E-4 * std::cos( 0.1 );
+    }
+
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 6, 6 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 6, 6 );
+    for( int i = 0; i < 6; i++ )
+    {
+        for( int j = 0; j <= i; j++ )
+        {
+            cosineCoefficients( i, j ) = 1.0E-6 / ( 1.0 + i + 2.0 * j );
+            sineCoefficients( i, j ) = ( j > 0 ) ? -1.0E-6 / ( 2.0 + i + j ) : 0.0;
+        }
+    }
+    cosineCoefficients( 0, 0 ) = 1.0;
+
+    // Create bodies with tabulated ephemerides, rotation models, and spherical harmonic gravity field
+    SystemOfBodies bodies;
+    bodies.createEmptyBody( "Asterix" );
+    bodies.createEmptyBody( "Obelix" );
+    bodies.at( "Asterix" )->setEphemeris(
+                std::make_shared< TabulatedCartesianEphemeris< double, double > >(
+                    createOneDimensionalInterpolator(
+                        stateHistory, std::make_shared< LagrangeInterpolatorSettings >( 8 ) ), "Obelix", "J2000" ) );
+    bodies.at( "Asterix" )->setRotationalEphemeris(
+                std::make_shared< TabulatedRotationalEphemeris< double, double > >(
+                    createOneDimensionalInterpolator(
+                        rotationalStateHistory, std::make_shared< InterpolatorSettings >( cubic_spline_interpolator ) ),
+                    "J2000", "Asterix_Fixed" ) );
+    bodies.at( "Asterix" )->setGravityFieldModel(
+                std::make_shared< SphericalHarmonicsGravityField >(
+                    3.986E14, 6.378E6, cosineCoefficients, sineCoefficients, "Asterix_Fixed" ) );
+    bodies.at( "Obelix" )->setEphemeris(
+                std::make_shared< TabulatedCartesianEphemeris< double, double > >(
+                    createOneDimensionalInterpolator(
+                        stateHistory, std::make_shared< InterpolatorSettings >( linear_interpolator ) ), "SSB", "J2000" ) );
+
+    const std::string snapshotFile = "environmentSnapshotTest.dat";
+    writeEnvironmentSnapshot( bodies, snapshotFile );
+
+    // Create new bodies: Asterix without environment models, Obelix with tabulated ephemeris and spherical harmonic field
+    // (of same size) that are reset by the snapshot
+    SystemOfBodies newBodies;
+    newBodies.createEmptyBody( "Asterix" );
+    newBodies.createEmptyBody( "Obelix" );
+    std::map< double, Eigen::Vector6d > dummyStateHistory;
+    dummyStateHistory[ 0.0 ] = Eigen::Vector6d::Zero( );
+    dummyStateHistory[ 1.0 ] = Eigen::Vector6d::Zero( );
+    std::shared_ptr< Ephemeris > existingObelixEphemeris =
+            std::make_shared< TabulatedCartesianEphemeris< double, double > >(
+                createOneDimensionalInterpolator(
+                    dummyStateHistory, std::make_shared< InterpolatorSettings >( linear_interpolator ) ), "SSB", "J2000" );
+    newBodies.at( "Obelix" )->setEphemeris( existingObelixEphemeris );
+
+    attachEnvironmentSnapshot( newBodies, snapshotFile );
+    std::remove( snapshotFile.c_str( ) );
+
+    // Check that existing ephemeris is reused, and that models have been created
+    BOOST_CHECK_EQUAL( newBodies.at( "Obelix" )->getEphemeris( ), existingObelixEphemeris );
+    BOOST_CHECK_EQUAL( newBodies.at( "Asterix" )->getEphemeris( )->getReferenceFrameOrigin( ), "Obelix" );
+    BOOST_CHECK_EQUAL( newBodies.at( "Asterix" )->getEphemeris( )->getReferenceFrameOrientation( ), "J2000" );
+    BOOST_CHECK_EQUAL( newBodies.at( "Asterix" )->getRotationalEphemeris( )->getBaseFrameOrientation( ), "J2000" );
+    BOOST_CHECK_EQUAL( newBodies.at( "Asterix" )->getRotationalEphemeris( )->getTargetFrameOrientation( ), "Asterix_Fixed" );
+    BOOST_CHECK_EQUAL( newBodies.at( "Obelix" )->getRotationalEphemeris( ) == nullptr, true );
+    BOOST_CHECK_EQUAL( newBodies.at( "Obelix" )->getGravityFieldModel( ) == nullptr, true );
+
+    std::shared_ptr< SphericalHarmonicsGravityField > newGravityField =
+            std::dynamic_pointer_cast< SphericalHarmonicsGravityField >(
+                newBodies.at( "Asterix" )->getGravityFieldModel( ) );
+    BOOST_CHECK_EQUAL( newGravityField != nullptr, true );
+    BOOST_CHECK_EQUAL( newGravityField->getGravitationalParameter( ), 3.986E14 );
+    BOOST_CHECK_EQUAL( newGravityField->getReferenceRadius( ), 6.378E6 );
+    BOOST_CHECK_EQUAL( newGravityField->getFixedReferenceFrame( ), "Asterix_Fixed" );
+    BOOST_CHECK_EQUAL( ( newGravityField->getCosineCoefficients( ) - cosineCoefficients ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( ( newGravityField->getSineCoefficients( ) - sineCoefficients ).norm( ), 0.0 );
+
+    // Check that states and rotations are identical, both at and in between nodes
+    for( double testTime = 15.0; testTime < 11000.0; testTime += 437.0 )
+    {
+        for( std::string bodyName : { "Asterix", "Obelix" } )
+        {
+            Eigen::Vector6d originalState = bodies.at( bodyName )->getEphemeris( )->getCartesianState( testTime );
+            Eigen::Vector6d newState = newBodies.at( bodyName )->getEphemeris( )->getCartesianState( testTime );
+            for( int i = 0; i < 6; i++ )
+            {
+                BOOST_CHECK_EQUAL( originalState( i ), newState( i ) );
+            }
+        }
+
+        Eigen::Matrix3d originalRotation =
+                bodies.at( "Asterix" )->getRotationalEphemeris( )->getRotationMatrixToBaseFrame( testTime );
+        Eigen::Matrix3d newRotation =
+                newBodies.at( "Asterix" )->getRotationalEphemeris( )->getRotationMatrixToBaseFrame( testTime );
+        BOOST_CHECK_EQUAL( ( originalRotation - newRotation ).norm( ), 0.0 );
+    }
+
+    // Check that a spherical harmonic gravity field of another size is rejected
+    SystemOfBodies inconsistentBodies;
+    inconsistentBodies.createEmptyBody( "Asterix" );
+    inconsistentBodies.createEmptyBody( "Obelix" );
+    inconsistentBodies.at( "Asterix" )->setGravityFieldModel(
+                std::make_shared< SphericalHarmonicsGravityField >(
+                    3.986E14, 6.378E6, Eigen::MatrixXd::Identity( 3, 3 ), Eigen::MatrixXd::Zero( 3, 3 ) ) );
+    BOOST_CHECK_THROW( EnvironmentSnapshot( bodies ).attachToBodies( inconsistentBodies ), std::runtime_error );
+
+    // Check that a file that does not exist is rejected
+    EnvironmentSnapshot emptySnapshot;
+    BOOST_CHECK_THROW( emptySnapshot.readFromBinaryFile( "nonExistingEnvironmentSnapshot.dat" ), std::runtime_error );
+
+    // Read contents of valid snapshot file (identifier, format version, number of ephemerides, size of first body name, ...)
+    writeEnvironmentSnapshot( bodies, snapshotFile );
+    std::string snapshotContents;
+    {
+        std::ifstream snapshotStream( snapshotFile, std::ios::binary );
+        snapshotContents.assign( std::istreambuf_iterator< char >( snapshotStream ), std::istreambuf_iterator< char >( ) );
+    }
+    std::remove( snapshotFile.c_str( ) );
+    BOOST_CHECK( snapshotContents.size( ) > 100 );
+
+    // Create modified snapshot files: wrong identifier, wrong format version, truncated, corrupted size, trailing data
+    std::vector< std::string > invalidSnapshotContents;
+    invalidSnapshotContents.push_back( snapshotContents );
+    invalidSnapshotContents.back( ).replace( 0, 8, "TUDATXXX" );
+
+    invalidSnapshotContents.push_back( snapshotContents );
+    std::uint32_t wrongFormatVersion = 1000;
+    invalidSnapshotContents.back( ).replace( 8, sizeof( std::uint32_t ),
+                                             reinterpret_cast< const char* >( &wrongFormatVersion ), sizeof( std::uint32_t ) );
+
+    invalidSnapshotContents.push_back( snapshotContents.substr( 0, 10 ) );
+    invalidSnapshotContents.push_back( snapshotContents.substr( 0, snapshotContents.size( ) / 2 ) );
+    invalidSnapshotContents.push_back( snapshotContents.substr( 0, snapshotContents.size( ) - 1 ) );
+
+    invalidSnapshotContents.push_back( snapshotContents );
+    std::uint64_t corruptedStringSize = std::numeric_limits< std::uint64_t >::max( ) / 2;
+    invalidSnapshotContents.back( ).replace( 20, sizeof( std::uint64_t ),
+                                             reinterpret_cast< const char* >( &corruptedStringSize ), sizeof( std::uint64_t ) );
+
+    invalidSnapshotContents.push_back( snapshotContents + "trailing data" );
+
+    // Check that invalid files are rejected, and that snapshot that is read into is not modified
+    EnvironmentSnapshot existingSnapshot( bodies );
+    const std::string invalidSnapshotFile = "invalidEnvironmentSnapshotTest.dat";
+    for( unsigned int i = 0; i < invalidSnapshotContents.size( ); i++ )
+    {
+        {
+            std::ofstream invalidSnapshotStream( invalidSnapshotFile, std::ios::binary | std::ios::trunc );
+            invalidSnapshotStream.write( invalidSnapshotContents.at( i ).data( ), invalidSnapshotContents.at( i ).size( ) );
+        }
+        BOOST_CHECK_THROW( existingSnapshot.readFromBinaryFile( invalidSnapshotFile ), std::runtime_error );
+        BOOST_CHECK_THROW( attachEnvironmentSnapshot( newBodies, invalidSnapshotFile ), std::runtime_error );
+        BOOST_CHECK_EQUAL( existingSnapshot.getEphemerides( ).size( ), 2u );
+        BOOST_CHECK_EQUAL( existingSnapshot.getGravityFields( ).size( ), 1u );
+        BOOST_CHECK_EQUAL( existingSnapshot.getRotationModels( ).size( ), 1u );
+    }
+    std::remove( invalidSnapshotFile.c_str( ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests